@@ -29,17 +29,14 @@ function Tick(deltaTime)
     -- local newLocation = FVector.new(100, 200, 300)
     -- actor:SetLocation(newLocation * deltaTime)
 
-    -- 스케일 변경
-    local newScale = FVector.new(2, 2, 2)
-    MyActor:SetScale(newScale)
+    -- 스케일 변경 (숫자 버전은 FVector를 만들지 않아 GC 할당이 없음)
+    MyActor:SetScaleXYZ(2, 2, 2)
 
     -- 회전 변경
-    local newRotation = FQuat.MakeFromEuler(10, 80, 20)
-    MyActor:SetRotation(newRotation)
+    MyActor:SetRotationEuler(10, 80, 20)
 
     -- 상대 위치 이동
-    local deltaLocation = FVector.new(0, 10, 0)
-    MyActor:AddWorldLocation(deltaLocation * deltaTime)
+    MyActor:AddWorldLocationXYZ(0, 10 * deltaTime, 0)
 
     -- elapsed = elapsed + deltaTime
     
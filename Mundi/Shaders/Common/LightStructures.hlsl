@@ -87,4 +87,6 @@ struct FSpotLightInfo
     float3 Padding;          // 12 bytes - 패딩
 
     row_major float4x4 LightViewProjection; // 64 bytes - 라이트 공간 변환 행렬
+
+    float4 ShadowAtlasScaleOffset; // 16 bytes - 섀도우 아틀라스 타일 (uv * xy + zw)
 };
@@ -166,9 +166,10 @@ static const float2 PoissonDisk64[64] =
  * @param currentDepth - 현재 깊이 값
  * @param sampleCount - PCF 샘플 수 (3, 4, 5 등)
  * @param texelSize - 섀도우 맵의 텍셀 크기 (1.0 / resolution)
+ * @param tapClampRect - 탭 좌표를 가둘 UV 사각형 (min.xy, max.xy). 아틀라스 타일이면 옆 타일을 읽지 않도록 타일 안쪽
  * @return 섀도우 값 (0.0 = 완전한 그림자, 1.0 = 완전히 밝음)
  */
-float SamplePCF_2DArray(Texture2DArray shadowMap, float2 shadowTexCoord, uint shadowMapIndex, float currentDepth, uint sampleCount, float texelSize)
+float SamplePCF_2DArray(Texture2DArray shadowMap, float2 shadowTexCoord, uint shadowMapIndex, float currentDepth, uint sampleCount, float texelSize, float4 tapClampRect = float4(0.0f, 0.0f, 1.0f, 1.0f))
 {
     float shadow = 0.0f;
     uint totalSamples = sampleCount * sampleCount;
@@ -183,7 +184,7 @@ float SamplePCF_2DArray(Texture2DArray shadowMap, float2 shadowTexCoord, uint sh
         uint poissonIndex = (poissonStart + i) % 64;
         float2 offset = PoissonDisk64[poissonIndex] * texelSize * halfSample;
 
-        float2 sampleCoord = shadowTexCoord + offset;
+        float2 sampleCoord = clamp(shadowTexCoord + offset, tapClampRect.xy, tapClampRect.zw);
         float3 samplePos = float3(sampleCoord, shadowMapIndex);
 
         // Comparison sampler를 사용하여 깊이 비교
@@ -347,9 +348,10 @@ float SampleEVSM(float2 moments, float depth, float positiveExponent, float nega
  * @param texelSize - 1.0 / shadowMapResolution
  * @param sampleRadius - 샘플링 반경 (픽셀 단위, 기본 2.0)
  * @param sigma - Gaussian 표준편차 (기본 1.5)
+ * @param tapClampRect - 탭 좌표를 가둘 UV 사각형 (SamplePCF_2DArray 참고)
  * @return float2 - 가중 평균된 moments
  */
-float2 SampleGaussian_2DArray(Texture2DArray shadowMap, float2 shadowTexCoord, uint shadowMapIndex, float texelSize, float sampleRadius, float sigma)
+float2 SampleGaussian_2DArray(Texture2DArray shadowMap, float2 shadowTexCoord, uint shadowMapIndex, float texelSize, float sampleRadius, float sigma, float4 tapClampRect = float4(0.0f, 0.0f, 1.0f, 1.0f))
 {
     float2 moments = float2(0.0f, 0.0f);
     float totalWeight = 0.0f;
@@ -368,7 +370,7 @@ float2 SampleGaussian_2DArray(Texture2DArray shadowMap, float2 shadowTexCoord, u
         float weight = GaussianWeight(distance, sigma);
 
         // 샘플 좌표 계산
-        float2 sampleCoord = shadowTexCoord + offset;
+        float2 sampleCoord = clamp(shadowTexCoord + offset, tapClampRect.xy, tapClampRect.zw);
         float3 samplePos = float3(sampleCoord, shadowMapIndex);
 
         // VSM moments 샘플링
@@ -398,6 +400,7 @@ float2 SampleGaussian_2DArray(Texture2DArray shadowMap, float2 shadowTexCoord, u
  * @param lightBleedingReduction - Light bleeding 감소 파라미터
  * @param texelSize - 1.0 / resolution
  * @param sampleRadius - 샘플링 반경 (픽셀 단위)
+ * @param tapClampRect - 탭 좌표를 가둘 UV 사각형 (SamplePCF_2DArray 참고)
  * @return 평균화된 섀도우 값
  */
 float SampleEVSM_PCF_2DArray(
@@ -409,7 +412,8 @@ float SampleEVSM_PCF_2DArray(
     float negativeExponent,
     float lightBleedingReduction,
     float texelSize,
-    float sampleRadius)
+    float sampleRadius,
+    float4 tapClampRect = float4(0.0f, 0.0f, 1.0f, 1.0f))
 {
     float shadowSum = 0.0f;
     const uint sampleCount = 32;
@@ -418,7 +422,7 @@ float SampleEVSM_PCF_2DArray(
     {
         // Poisson Disk 패턴으로 오프셋 계산
         float2 offset = PoissonDisk64[i] * texelSize * sampleRadius;
-        float2 sampleCoord = shadowTexCoord + offset;
+        float2 sampleCoord = clamp(shadowTexCoord + offset, tapClampRect.xy, tapClampRect.zw);
         float3 samplePos = float3(sampleCoord, shadowMapIndex);
 
         // 해당 위치의 EVSM moments 샘플링
@@ -589,8 +593,9 @@ float SampleEVSM_PCF_CubeArray(
  * @param worldNormal - World space normal for slope-scaled bias
  * @param lightDir - Light direction for slope calculation
  * @param shadowMapResolution - 섀도우 맵 해상도 (PCF texelSize 계산용)
+ * @param atlasScaleOffset - 아틀라스 안의 이 라이트 타일 (uv * xy + zw)
  */
-float SampleSpotLightShadowMap(uint shadowMapIndex, float4 lightSpacePos, float3 worldNormal, float3 lightDir, float shadowMapResolution)
+float SampleSpotLightShadowMap(uint shadowMapIndex, float4 lightSpacePos, float3 worldNormal, float3 lightDir, float shadowMapResolution, float4 atlasScaleOffset)
 {
     // Perspective divide to get NDC coordinates
     float3 projCoords = lightSpacePos.xyz / lightSpacePos.w;
@@ -608,6 +613,14 @@ float SampleSpotLightShadowMap(uint shadowMapIndex, float4 lightSpacePos, float3
         return 1.0f; // Outside shadow map = not shadowed
     }
 
+    // 타일 UV -> 아틀라스 UV (가장자리 반 텍셀 안쪽으로 잘라 옆 타일을 샘플하지 않도록)
+    float halfTexel = 0.5f / (atlasScaleOffset.x * shadowMapResolution);
+    shadowTexCoord = clamp(shadowTexCoord, halfTexel, 1.0f - halfTexel) * atlasScaleOffset.xy + atlasScaleOffset.zw;
+
+    // 필터 탭도 하나씩 같은 타일 안쪽 (아틀라스 UV, 반 텍셀 여유)으로 가둬 옆 타일의 깊이/moments가 섞이지 않게 함
+    float halfAtlasTexel = 0.5f / shadowMapResolution;
+    float4 tileClampRect = float4(atlasScaleOffset.zw + halfAtlasTexel, atlasScaleOffset.zw + atlasScaleOffset.xy - halfAtlasTexel);
+
     // Current depth in light space
     float currentDepth = projCoords.z;
 
@@ -636,7 +649,7 @@ float SampleSpotLightShadowMap(uint shadowMapIndex, float4 lightSpacePos, float3
         // 소프트웨어 PCF
         uint sampleCount = (PCFSampleCount == 0) ? PCFCustomSampleCount : PCFSampleCount;
         float texelSize = 1.0f / shadowMapResolution;
-        shadow = SamplePCF_2DArray(g_SpotLightShadowMaps, shadowTexCoord, shadowMapIndex, biasedDepth, sampleCount, texelSize);
+        shadow = SamplePCF_2DArray(g_SpotLightShadowMaps, shadowTexCoord, shadowMapIndex, biasedDepth, sampleCount, texelSize, tileClampRect);
     }
     else if (FilterType == 2) // VSM
     {
@@ -648,7 +661,8 @@ float SampleSpotLightShadowMap(uint shadowMapIndex, float4 lightSpacePos, float3
             shadowMapIndex,
             texelSize,
             5.1f,  // sampleRadius
-            2.0f   // sigma
+            2.0f,  // sigma
+            tileClampRect
         );
         shadow = ChebyshevUpperBound(moments, currentDepth, VSMMinVariance, VSMLightBleedingReduction);
     }
@@ -662,7 +676,8 @@ float SampleSpotLightShadowMap(uint shadowMapIndex, float4 lightSpacePos, float3
             shadowMapIndex,
             texelSize,
             5.1f,  // sampleRadius
-            2.0f   // sigma
+            2.0f,  // sigma
+            tileClampRect
         );
         // moments.r에 exp(c * depth)가 저장되어 있음
         shadow = SampleESM(moments.r, currentDepth, ESMExponent);
@@ -685,7 +700,8 @@ float SampleSpotLightShadowMap(uint shadowMapIndex, float4 lightSpacePos, float3
             EVSMNegativeExponent,
             EVSMLightBleedingReduction,
             texelSize,
-            2.5f  // sampleRadius: 부드러운 경계를 위한 반경
+            2.5f,  // sampleRadius: 부드러운 경계를 위한 반경
+            tileClampRect
         );
     }
 
@@ -1188,7 +1204,7 @@ float3 CalculateSpotLight(FSpotLightInfo light, float3 worldPos, float3 normal,
     {
         // Transform world position to light space
         float4 lightSpacePos = mul(float4(worldPos, 1.0f), light.LightViewProjection);
-        shadow = SampleSpotLightShadowMap(light.ShadowMapIndex, lightSpacePos, normal, lightDir, SpotLightResolution);
+        shadow = SampleSpotLightShadowMap(light.ShadowMapIndex, lightSpacePos, normal, lightDir, SpotLightResolution, light.ShadowAtlasScaleOffset);
     }
 
     // Diffuse (light.Color는 이미 Intensity 포함)
@@ -0,0 +1,71 @@
+//================================================================================================
+// Filename:      PackedVertex.hlsl
+// Description:   패킹 정점 포맷 디코드 (C++ FPackedVertexFormat / FPackedVertexCodec와 1:1 대응)
+//                매크로:
+//                - PACKED_VERTEX              : 패킹 레이아웃 사용
+//                - PACKED_POSITION_QUANTIZED  : 위치 R16G16B16A16_UNORM (ModelBuffer의 Scale/Bias로 역양자화)
+//                - PACKED_VERTEX_COLOR        : 정점 색상 R8G8B8A8_UNORM (없으면 흰색)
+//================================================================================================
+
+#ifndef PACKED_VERTEX_HLSL
+#define PACKED_VERTEX_HLSL
+
+#if PACKED_VERTEX
+
+struct VS_INPUT_PACKED
+{
+#if PACKED_POSITION_QUANTIZED
+    float4 Position : POSITION;     // UNORM16 x4 (w 미사용)
+#else
+    float3 Position : POSITION;
+#endif
+    float2 Normal : NORMAL0;        // 옥타헤드럴 SNORM16 x2
+    uint2 Tangent : TANGENT0;       // 옥타헤드럴 UNORM16 + UNORM15, y 최상위 비트 = 바이탱전트 부호
+    float2 TexCoord : TEXCOORD0;    // half x2
+#if PACKED_VERTEX_COLOR
+    float4 Color : COLOR;           // UNORM8 x4
+#endif
+};
+
+// 옥타헤드럴 [-1, 1]^2 → 단위 벡터
+float3 OctDecode(float2 E)
+{
+    float3 N = float3(E.xy, 1.0f - abs(E.x) - abs(E.y));
+    float T = saturate(-N.z);
+    N.xy += (N.xy >= 0.0f) ? -T : T;
+    return normalize(N);
+}
+
+float3 DecodePackedPosition(VS_INPUT_PACKED Input, float4 DequantScale, float4 DequantBias)
+{
+#if PACKED_POSITION_QUANTIZED
+    return Input.Position.xyz * DequantScale.xyz + DequantBias.xyz;
+#else
+    return Input.Position;
+#endif
+}
+
+float3 DecodePackedNormal(VS_INPUT_PACKED Input)
+{
+    return OctDecode(Input.Normal);
+}
+
+float4 DecodePackedTangent(VS_INPUT_PACKED Input)
+{
+    float2 E = float2(Input.Tangent.x / 65535.0f, (Input.Tangent.y & 0x7FFF) / 32767.0f) * 2.0f - 1.0f;
+    float Sign = (Input.Tangent.y & 0x8000) ? -1.0f : 1.0f;
+    return float4(OctDecode(E), Sign);
+}
+
+float4 DecodePackedColor(VS_INPUT_PACKED Input)
+{
+#if PACKED_VERTEX_COLOR
+    return Input.Color;
+#else
+    return float4(1.0f, 1.0f, 1.0f, 1.0f);
+#endif
+}
+
+#endif // PACKED_VERTEX
+
+#endif // PACKED_VERTEX_HLSL
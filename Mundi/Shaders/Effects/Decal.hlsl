@@ -16,12 +16,15 @@
 #include "../Common/LightStructures.hlsl"
 #include "../Common/LightingBuffers.hlsl"
 #include "../Common/LightingCommon.hlsl"
+#include "../Common/PackedVertex.hlsl"
 
 // --- Decal 전용 상수 버퍼 ---
 cbuffer ModelBuffer : register(b0)
 {
     row_major float4x4 WorldMatrix;
     row_major float4x4 WorldInverseTranspose;
+    float4 PositionDequantScale;    // 패킹 정점 위치 역양자화 (PackedVertex.hlsl)
+    float4 PositionDequantBias;
 }
 
 // ViewProjBuffer는 LightingBuffers.hlsl에서 공통으로 정의됨 (register b1)
@@ -71,8 +74,19 @@ struct PS_INPUT
 //================================================================================================
 // 버텍스 셰이더
 //================================================================================================
+#if PACKED_VERTEX
+PS_INPUT mainVS(VS_INPUT_PACKED packedInput)
+{
+    VS_INPUT input;
+    input.position = DecodePackedPosition(packedInput, PositionDequantScale, PositionDequantBias);
+    input.normal = DecodePackedNormal(packedInput);
+    input.texCoord = packedInput.TexCoord;
+    input.Tangent = DecodePackedTangent(packedInput);
+    input.color = DecodePackedColor(packedInput);
+#else
 PS_INPUT mainVS(VS_INPUT input)
 {
+#endif
     PS_INPUT output;
 
     // World position
@@ -2,10 +2,15 @@
 // Simple depth-only shader for rendering shadow maps
 // This shader only outputs depth, no color information needed
 
-// b0: Object Transform
+#include "../Common/PackedVertex.hlsl"
+
+// b0: Object Transform (ModelBufferType)
 cbuffer ObjectBuffer : register(b0)
 {
     row_major float4x4 WorldMatrix;
+    row_major float4x4 WorldInverseTranspose;   // Unused, keeps the ModelBufferType layout
+    float4 PositionDequantScale;                // Packed vertex position dequantization
+    float4 PositionDequantBias;
 };
 
 // b1: View/Projection for light's perspective
@@ -31,8 +36,15 @@ struct PS_INPUT
 //-----------------------------------------------------------------------------
 // Vertex Shader
 //-----------------------------------------------------------------------------
+#if PACKED_VERTEX
+PS_INPUT mainVS(VS_INPUT_PACKED packedInput)
+{
+    VS_INPUT input;
+    input.Position = DecodePackedPosition(packedInput, PositionDequantScale, PositionDequantBias);
+#else
 PS_INPUT mainVS(VS_INPUT input)
 {
+#endif
     PS_INPUT output;
 
     // Transform vertex to world space
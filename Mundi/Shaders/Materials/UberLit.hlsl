@@ -33,6 +33,8 @@ cbuffer ModelBuffer : register(b0)
 {
     row_major float4x4 WorldMatrix;              // 64 bytes
     row_major float4x4 WorldInverseTranspose;    // 64 bytes - 올바른 노멀 변환을 위함
+    float4 PositionDequantScale;                 // 16 bytes - 패킹 정점 위치 역양자화 (PackedVertex.hlsl)
+    float4 PositionDequantBias;                  // 16 bytes
 };
 
 // b1: ViewProjBuffer (VS) - LightingBuffers.hlsl에서 공통으로 정의됨
@@ -64,6 +66,7 @@ cbuffer PixelConstBuffer : register(b4)
 #include "../Common/LightStructures.hlsl"
 #include "../Common/LightingBuffers.hlsl"
 #include "../Common/LightingCommon.hlsl"
+#include "../Common/PackedVertex.hlsl"
 
 // --- 텍스처 및 샘플러 리소스 ---
 Texture2D g_DiffuseTexColor : register(t0);
@@ -94,13 +97,12 @@ struct PS_INPUT
 struct PS_OUTPUT
 {
     float4 Color : SV_Target0;
-    uint UUID : SV_Target1;
 };
 
 //================================================================================================
 // 버텍스 셰이더 (Vertex Shader)
 //================================================================================================
-PS_INPUT mainVS(VS_INPUT Input)
+PS_INPUT ProcessVertex(VS_INPUT Input)
 {
     PS_INPUT Out;
 
@@ -194,13 +196,30 @@ PS_INPUT mainVS(VS_INPUT Input)
     return Out;
 }
 
+#if PACKED_VERTEX
+PS_INPUT mainVS(VS_INPUT_PACKED PackedInput)
+{
+    VS_INPUT Input;
+    Input.Position = DecodePackedPosition(PackedInput, PositionDequantScale, PositionDequantBias);
+    Input.Normal = DecodePackedNormal(PackedInput);
+    Input.TexCoord = PackedInput.TexCoord;
+    Input.Tangent = DecodePackedTangent(PackedInput);
+    Input.Color = DecodePackedColor(PackedInput);
+    return ProcessVertex(Input);
+}
+#else
+PS_INPUT mainVS(VS_INPUT Input)
+{
+    return ProcessVertex(Input);
+}
+#endif
+
 //================================================================================================
 // 픽셀 셰이더 (Pixel Shader)
 //================================================================================================
 PS_OUTPUT mainPS(PS_INPUT Input)
 {
     PS_OUTPUT Output;
-    Output.UUID = UUID;
     
     // UV 스크롤링 적용 (활성화된 경우)
     float2 uv = Input.TexCoord;
@@ -34,7 +34,6 @@ struct PS_INPUT
 struct PS_OUTPUT
 {
     float4 Color : SV_Target0;
-    uint UUID : SV_Target1;
 };
 
 Texture2D BillboardTex : register(t0);
@@ -68,6 +67,5 @@ PS_OUTPUT mainPS(PS_INPUT i)
         discard;
     c = c * Color;
     Output.Color = c;
-    Output.UUID = UUID;
     return Output;
 }
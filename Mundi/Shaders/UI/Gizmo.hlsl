@@ -6,6 +6,8 @@
 //                - Custom color per gizmo with highlight support
 //================================================================================================
 
+#include "../Common/PackedVertex.hlsl"
+
 // --- Constant Buffers ---
 
 // b0: ModelBuffer (VS) - World transform
@@ -13,6 +15,8 @@ cbuffer ModelBuffer : register(b0)
 {
     row_major float4x4 WorldMatrix;
     row_major float4x4 WorldInverseTranspose; // Not used for gizmos, kept for compatibility
+    float4 PositionDequantScale;              // Packed vertex position dequantization
+    float4 PositionDequantBias;
 }
 
 // b1: ViewProjBuffer (VS) - Camera matrices
@@ -24,11 +28,11 @@ cbuffer ViewProjBuffer : register(b1)
     row_major float4x4 InverseProjectionMatrix;
 }
 
-// b3: ColorBuffer (PS) - UUID for object picking
+// b3: ColorBuffer (PS) - Matches ColorBufferType
 cbuffer ColorBuffer : register(b3)
 {
     float4 LerpColor;
-    uint UUID;          // Object ID for picking
+    uint UUID;          // Unused here (picking is a CPU ray test)
 }
 
 // --- Input/Output Structures ---
@@ -47,14 +51,20 @@ struct PS_INPUT
 struct PS_OUTPUT
 {
     float4 Color : SV_Target0;      // Final color output
-    uint UUID : SV_Target1;         // Object ID for picking
 };
 
 //================================================================================================
 // Vertex Shader
 //================================================================================================
+#if PACKED_VERTEX
+PS_INPUT mainVS(VS_INPUT_PACKED packedInput)
+{
+    VS_INPUT input;
+    input.position = DecodePackedPosition(packedInput, PositionDequantScale, PositionDequantBias);
+#else
 PS_INPUT mainVS(VS_INPUT input)
 {
+#endif
     PS_INPUT output;
 
     // Transform vertex position: Model -> World -> View -> Clip space
@@ -74,7 +84,6 @@ PS_OUTPUT mainPS(PS_INPUT input)
 
     // Gizmo is unlit - just pass through the color from vertex shader
     Output.Color = input.color;
-    Output.UUID = UUID;
 
     return Output;
 }
@@ -0,0 +1,55 @@
+// 텍스트/빌보드 공유 정점 스트림 (FSpriteVertexStream)
+// 정점은 CPU에서 이미 월드 공간으로 만들어지므로 WorldMatrix는 쓰지 않음
+
+// b1: ViewProjBuffer (VS) - Matches ViewProjBufferType
+cbuffer ViewProjBuffer : register(b1)
+{
+    row_major float4x4 ViewMatrix;
+    row_major float4x4 ProjectionMatrix;
+    row_major float4x4 InverseViewMatrix;
+    row_major float4x4 InverseProjectionMatrix;
+};
+
+struct VS_INPUT
+{
+    float3 worldPos : POSITION;
+    float2 uv       : TEXCOORD0;
+    float4 color    : COLOR0;     // R8G8B8A8_UNORM
+    uint objectId   : OBJECTID;   // FSpriteVertex 레이아웃 유지용 (피킹은 CPU 레이 테스트라 셰이더에서 쓰지 않음)
+};
+
+struct PS_INPUT
+{
+    float4 pos : SV_POSITION;
+    float2 uv  : TEXCOORD0;
+    float4 color : COLOR0;
+};
+
+struct PS_OUTPUT
+{
+    float4 Color : SV_Target0;
+};
+
+Texture2D SpriteAtlas : register(t0);
+SamplerState LinearSamp : register(s0);
+
+PS_INPUT mainVS(VS_INPUT input)
+{
+    PS_INPUT o;
+    o.pos = mul(float4(input.worldPos, 1.0f), mul(ViewMatrix, ProjectionMatrix));
+    o.uv = input.uv;
+    o.color = input.color;
+    return o;
+}
+
+PS_OUTPUT mainPS(PS_INPUT i)
+{
+    PS_OUTPUT Output;
+
+    float4 c = SpriteAtlas.Sample(LinearSamp, i.uv);
+    if (c.a < 0.1f)
+        discard;
+
+    Output.Color = c * i.color;
+    return Output;
+}
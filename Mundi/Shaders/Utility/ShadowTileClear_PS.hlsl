@@ -0,0 +1,14 @@
+﻿// 섀도우 아틀라스 타일 하나만 지우는 PS (VSM/ESM/EVSM의 RTV 경로)
+// FullScreenTriangle_VS와 함께 타일 크기 뷰포트로 Draw(6, 0) 합니다.
+
+struct PS_INPUT
+{
+    float4 Position : SV_POSITION;
+    float2 TexCoord : TEXCOORD0;
+};
+
+float4 mainPS(PS_INPUT In) : SV_TARGET
+{
+    // white = 무한대 depth (ClearRenderTargetView와 같은 값)
+    return float4(1.0f, 1.0f, 1.0f, 1.0f);
+}
@@ -152,7 +152,17 @@ void UGizmoArrowComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		// 머티리얼과 셰이더는 루프 밖에서 이미 결정되었습니다.
 		FMeshBatchElement BatchElement;
 
-		FShaderVariant* ShaderVariant = ShaderToUse->GetShaderVariant(MaterialToUse->GetShaderMacros());
+		FShaderVariant* ShaderVariant = nullptr;
+		if (StaticMesh->IsPackedVertex())
+		{
+			TArray<FShaderMacro> ShaderMacros = MaterialToUse->GetShaderMacros();
+			StaticMesh->AppendVertexShaderMacros(ShaderMacros);
+			ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(UResourceManager::GetInstance().GetDevice(), ShaderMacros);
+		}
+		else
+		{
+			ShaderVariant = ShaderToUse->GetShaderVariant(MaterialToUse->GetShaderMacros());
+		}
 
 		// --- 정렬 키 ---
 		BatchElement.VertexShader = ShaderVariant->VertexShader;
@@ -162,6 +172,9 @@ void UGizmoArrowComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		BatchElement.VertexBuffer = StaticMesh->GetVertexBuffer();
 		BatchElement.IndexBuffer = StaticMesh->GetIndexBuffer();
 		BatchElement.VertexStride = StaticMesh->GetVertexStride();
+		BatchElement.PackedVertexFlags = StaticMesh->GetPackedVertexFlags();
+		BatchElement.PositionDequantScale = StaticMesh->GetPositionDequantScale();
+		BatchElement.PositionDequantBias = StaticMesh->GetPositionDequantBias();
 
 		// --- 드로우 데이터 (1번에서 결정된 값 사용) ---
 		BatchElement.IndexCount = IndexCount;
@@ -7,6 +7,10 @@
 #include "Enums.h"
 #include "WindowsBinReader.h"
 #include "WindowsBinWriter.h"
+#include "MeshOptimizer.h"
+#include "CookedStaticMesh.h"
+#include "ParallelFor.h"
+#include "PlatformTime.h"
 #include <filesystem>
 #include <unordered_set>
 
@@ -166,14 +170,15 @@ bool GetMtlDependencies(const FString& ObjPath, TArray<FString>& OutMtlFilePaths
 /**
  * @brief 캐시 파일이 원본(.obj) 및 모든 의존성(.mtl) 파일보다 최신인지 검사합니다.
  * @param ObjPath 원본 .obj 파일의 경로입니다.
- * @param BinPath 메쉬 데이터 캐시(.obj.bin) 파일의 경로입니다.
+ * @param BinPath 메쉬 데이터 캐시(.obj.umesh 또는 구버전 .obj.bin) 파일의 경로입니다.
  * @param MatBinPath 머티리얼 데이터 캐시(.mtl.bin) 파일의 경로입니다.
  * @return 캐시를 다시 생성해야 하면 true, 캐시가 유효하면 false를 반환합니다.
  */
 bool ShouldRegenerateCache(const FString& ObjPath, const FString& BinPath, const FString& MatBinPath)
 {
-	// 캐시 파일 중 하나라도 존재하지 않으면 무조건 재생성해야 합니다.
-	if (!fs::exists(BinPath) || !fs::exists(MatBinPath))
+	// 캐시 파일 중 하나라도 존재하지 않으면 무조건 재생성해야 합니다. (확인 자체가 실패해도 재생성)
+	std::error_code ExistsError;
+	if (!fs::exists(BinPath, ExistsError) || !fs::exists(MatBinPath, ExistsError))
 	{
 		return true;
 	}
@@ -228,6 +233,7 @@ void FObjManager::Preload()
 
 	size_t LoadedCount = 0;
 	std::unordered_set<FString> ProcessedFiles; // 중복 로딩 방지
+	TArray<FString> ObjPaths;
 
 	for (const auto& Entry : fs::recursive_directory_iterator(DataDir))
 	{
@@ -246,8 +252,7 @@ void FObjManager::Preload()
 			if (ProcessedFiles.find(PathStr) == ProcessedFiles.end())
 			{
 				ProcessedFiles.insert(PathStr);
-				LoadObjStaticMesh(PathStr);
-				++LoadedCount;
+				ObjPaths.Add(PathStr);
 			}
 		}
 		else if (Extension == ".dds" || Extension == ".jpg" || Extension == ".png")
@@ -256,6 +261,14 @@ void FObjManager::Preload()
 		}
 	}
 
+	// 메시 CPU 로드(캐시 읽기/쿠킹)는 병렬로 먼저 끝내고, GPU 버퍼 생성은 순서대로 수행
+	PrefetchObjStaticMeshAssets(ObjPaths);
+	for (const FString& ObjPath : ObjPaths)
+	{
+		LoadObjStaticMesh(ObjPath);
+		++LoadedCount;
+	}
+
 	// 4) 모든 StaticMeshs 가져오기
 	RESOURCE.SetStaticMeshs();
 
@@ -283,6 +296,84 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		return *It;
 	}
 
+	TArray<FMaterialInfo> MaterialInfos;
+	FStaticMesh* NewFStaticMesh = LoadStaticMeshData(NormalizedPathStr, MaterialInfos);
+	if (!NewFStaticMesh)
+	{
+		return nullptr;
+	}
+	return RegisterStaticMeshAsset(NormalizedPathStr, NewFStaticMesh, MaterialInfos);
+}
+
+// 여러 OBJ의 파일 캐시 로드/쿠킹을 워커 스레드에서 병렬로 수행한 뒤, 머티리얼/메모리 캐시 등록은 호출 스레드에서 처리
+void FObjManager::PrefetchObjStaticMeshAssets(const TArray<FString>& PathFileNames)
+{
+	// 중복 요청과 이미 로드된 에셋 제거
+	TArray<FString> PendingPaths;
+	TSet<FString> UniquePaths;
+	for (const FString& PathFileName : PathFileNames)
+	{
+		FString NormalizedPathStr = NormalizePath(PathFileName);
+		if (ObjStaticMeshMap.Find(NormalizedPathStr) || UniquePaths.Contains(NormalizedPathStr))
+		{
+			continue;
+		}
+		UniquePaths.Add(NormalizedPathStr);
+		PendingPaths.Add(NormalizedPathStr);
+	}
+
+	if (PendingPaths.IsEmpty())
+	{
+		return;
+	}
+
+	struct FPendingMesh
+	{
+		FStaticMesh* StaticMesh = nullptr;
+		TArray<FMaterialInfo> MaterialInfos;
+		FString Error;	// 워커에서 잡은 예외 (로그는 호출 스레드에서)
+	};
+	TArray<FPendingMesh> Results;
+	Results.resize(PendingPaths.Num());
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	ParallelFor(PendingPaths.Num(), [&](int32 Index)
+	{
+		// 한 메시의 실패가 나머지 프리페치를 멈추지 않도록 항목별로 잡음 (실패한 메시는 첫 사용 시 다시 로드를 시도)
+		try
+		{
+			Results[Index].StaticMesh = LoadStaticMeshData(PendingPaths[Index], Results[Index].MaterialInfos);
+		}
+		catch (const std::exception& e)
+		{
+			Results[Index].Error = e.what();
+		}
+		catch (...)
+		{
+			Results[Index].Error = "unknown exception";
+		}
+	});
+	const double ParallelMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+	for (int32 i = 0; i < PendingPaths.Num(); ++i)
+	{
+		if (!Results[i].Error.empty())
+		{
+			UE_LOG("FObjManager: Prefetch failed for '%s': %s", PendingPaths[i].c_str(), Results[i].Error.c_str());
+		}
+		if (Results[i].StaticMesh)
+		{
+			RegisterStaticMeshAsset(PendingPaths[i], Results[i].StaticMesh, Results[i].MaterialInfos);
+		}
+	}
+
+	UE_LOG("FObjManager: Prefetched %d mesh assets in %.2f ms (%u workers)", PendingPaths.Num(), ParallelMs, GetParallelWorkerCount());
+}
+
+// 파일 캐시(.umesh) 로드 또는 OBJ 임포트/최적화/쿠킹까지의 CPU 작업
+// 전역 캐시/리소스 매니저에 쓰지 않으므로 워커 스레드에서 호출할 수 있습니다. (기본 머티리얼은 읽기만 함)
+FStaticMesh* FObjManager::LoadStaticMeshData(const FString& NormalizedPathStr, TArray<FMaterialInfo>& MaterialInfos)
+{
 	std::filesystem::path Path(NormalizedPathStr);
 
 	// 2. 파일 경로 설정
@@ -300,23 +391,36 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	// 2-1. 캐시 파일 경로 설정
 	FString CachePathStr = ConvertDataPathToCachePath(NormalizedPathStr);
 
-	const FString BinPathFileName = CachePathStr + ".bin";
+	const FString CookedPathFileName = CachePathStr + ".umesh";  // 쿠킹 메시 캐시 (메모리 매핑 로드)
+	const FString BinPathFileName = CachePathStr + ".bin";         // 구버전 메시 캐시 (쿠킹 캐시가 없을 때 폴백)
 	const FString MatBinPathFileName = CachePathStr + ".mat.bin";
 
-	// 캐시를 저장할 디렉토리가 없으면 생성
-	fs::path CacheFileDirPath(BinPathFileName);
+	// 캐시를 저장할 디렉토리가 없으면 생성 (워커 스레드에서도 불리므로 예외 대신 error_code, 실패하면 캐시 기록만 실패)
+	fs::path CacheFileDirPath(CookedPathFileName);
 	if (CacheFileDirPath.has_parent_path())
 	{
-		fs::create_directories(CacheFileDirPath.parent_path());
+		std::error_code DirectoryError;
+		fs::create_directories(CacheFileDirPath.parent_path(), DirectoryError);
+		if (DirectoryError)
+		{
+			UE_LOG("Failed to create cache directory for '%s': %s", NormalizedPathStr.c_str(), DirectoryError.message().c_str());
+		}
 	}
 
 	// 3. 캐시 데이터 로드 시도 및 실패 시 재생성 로직
 	FStaticMesh* NewFStaticMesh = new FStaticMesh();
-	TArray<FMaterialInfo> MaterialInfos;
 	bool bLoadedSuccessfully = false;
 
 	// 캐시가 오래되었는지 먼저 확인
-	bool bShouldRegenerate = ShouldRegenerateCache(NormalizedPathStr, BinPathFileName, MatBinPathFileName);
+	bool bShouldRegenerate = ShouldRegenerateCache(NormalizedPathStr, CookedPathFileName, MatBinPathFileName);
+
+	// 쿠킹 캐시는 없지만 구버전 .bin 캐시가 최신이면 .bin에서 읽고 쿠킹 캐시로 변환
+	bool bUpgradeLegacyCache = false;
+	if (bShouldRegenerate && !ShouldRegenerateCache(NormalizedPathStr, BinPathFileName, MatBinPathFileName))
+	{
+		bShouldRegenerate = false;
+		bUpgradeLegacyCache = true;
+	}
 
 	if (!bShouldRegenerate)
 	{
@@ -324,14 +428,30 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		try
 		{
 			// 캐시에서 FStaticMesh 데이터 로드
-			FWindowsBinReader Reader(BinPathFileName);
-			if (!Reader.IsOpen())
+			if (bUpgradeLegacyCache)
 			{
-				// Reader 생성자에서 예외를 던지지 않는 경우를 대비한 명시적 실패 처리
-				throw std::runtime_error("Failed to open bin file for reading.");
+				FWindowsBinReader Reader(BinPathFileName);
+				if (!Reader.IsOpen())
+				{
+					// Reader 생성자에서 예외를 던지지 않는 경우를 대비한 명시적 실패 처리
+					throw std::runtime_error("Failed to open bin file for reading.");
+				}
+				Reader << *NewFStaticMesh;
+				Reader.Close();
+			}
+			else
+			{
+				// 매핑 후 헤더/섹션 체크섬 검증, 섹션 단위 memcpy로 복사
+				// (FStaticMesh가 CPU 정점/인덱스를 계속 소유하므로 매핑을 넘겨주지 않고 복사한 뒤 바로 닫음)
+				FCookedStaticMeshView CookedView;
+				FString CookedError;
+				if (!CookedView.Open(CookedPathFileName, &CookedError))
+				{
+					throw std::runtime_error("Failed to open cooked mesh file: " + CookedError);
+				}
+				CookedView.CopyTo(*NewFStaticMesh);
+				CookedView.Close();
 			}
-			Reader << *NewFStaticMesh;
-			Reader.Close();
 
 			// 캐시에서 Material 데이터 로드
 			FWindowsBinReader MatReader(MatBinPathFileName);
@@ -342,7 +462,18 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 			Serialization::ReadArray<FMaterialInfo>(MatReader, MaterialInfos);
 			MatReader.Close();
 
-			NewFStaticMesh->CacheFilePath = BinPathFileName;
+			NewFStaticMesh->CacheFilePath = CookedPathFileName;
+			if (bUpgradeLegacyCache)
+			{
+				if (FCookedStaticMesh::Write(CookedPathFileName, *NewFStaticMesh))
+				{
+					UE_LOG("Upgraded legacy cache to cooked mesh '%s'.", CookedPathFileName.c_str());
+				}
+				else
+				{
+					NewFStaticMesh->CacheFilePath = BinPathFileName;
+				}
+			}
 
 			// 모든 로드가 성공적으로 완료됨
 			bLoadedSuccessfully = true;
@@ -357,16 +488,17 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 			delete NewFStaticMesh;
 			NewFStaticMesh = nullptr; // 포인터를 nullptr로 설정하여 이중 삭제 방지
 
-			// 손상된 캐시 파일 삭제
-			fs::remove(BinPathFileName);
-			fs::remove(MatBinPathFileName);
+			// 손상된 캐시 파일 삭제 (실패해도 아래에서 재생성하며 덮어씀)
+			std::error_code RemoveError;
+			fs::remove(CookedPathFileName, RemoveError);
+			fs::remove(BinPathFileName, RemoveError);
+			fs::remove(MatBinPathFileName, RemoveError);
 
 			bLoadedSuccessfully = false;
 		}
 	}
 #else
 	FStaticMesh* NewFStaticMesh = new FStaticMesh();
-	TArray<FMaterialInfo> MaterialInfos;
 	bool bLoadedSuccessfully = false;
 #endif // USE_OBJ_CACHE
 
@@ -410,14 +542,28 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 
 		FObjImporter::ConvertToStaticMesh(RawObjInfo, MaterialInfos, NewFStaticMesh);
 
+		// 정점 캐시 / 오버드로우 / 정점 페치 순서 최적화 (결과 순서가 그대로 캐시에 저장됨)
+		FMeshOptimizer::OptimizeStaticMesh(NewFStaticMesh);
+		const FMeshOptimizationStats& OptStats = NewFStaticMesh->OptimizationStats;
+		UE_LOG("[MeshOptimizer] '%s': ACMR(FIFO %u) %.3f -> %.3f, ATVR %.3f -> %.3f | ACMR(LRU) %.3f -> %.3f",
+			NormalizedPathStr.c_str(), OptStats.CacheSize,
+			OptStats.BeforeFIFO.ACMR, OptStats.AfterFIFO.ACMR,
+			OptStats.BeforeFIFO.ATVR, OptStats.AfterFIFO.ATVR,
+			OptStats.BeforeLRU.ACMR, OptStats.AfterLRU.ACMR);
+
 		// 캐시 저장 *직전에* 기본 머티리얼 로직을 호출합니다.
 		EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos);
 
 #ifdef USE_OBJ_CACHE
-		// 새로운 캐시 파일(.bin) 저장 (이제 올바른 데이터가 저장됨)
-		FWindowsBinWriter Writer(BinPathFileName);
-		Writer << *NewFStaticMesh;
-		Writer.Close();
+		// 새로운 캐시 파일(.umesh) 저장 (이제 올바른 데이터가 저장됨)
+		if (FCookedStaticMesh::Write(CookedPathFileName, *NewFStaticMesh))
+		{
+			NewFStaticMesh->CacheFilePath = CookedPathFileName;
+		}
+		else
+		{
+			UE_LOG("Failed to write cooked mesh cache '%s'.", CookedPathFileName.c_str());
+		}
 
 		FWindowsBinWriter MatWriter(MatBinPathFileName);
 		Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
@@ -437,9 +583,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 			UE_LOG("Updating outdated cache for '%s' with default material.", NormalizedPathStr.c_str());
 			try
 			{
-				FWindowsBinWriter Writer(BinPathFileName);
-				Writer << *NewFStaticMesh;
-				Writer.Close();
+				FCookedStaticMesh::Write(CookedPathFileName, *NewFStaticMesh);
 				FWindowsBinWriter MatWriter(MatBinPathFileName);
 				Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
 				MatWriter.Close();
@@ -452,6 +596,12 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		}
 	}
 
+	return NewFStaticMesh;
+}
+
+// 머티리얼 생성/등록 후 메모리 캐시에 등록 (리소스 매니저를 사용하므로 메인 스레드 전용)
+FStaticMesh* FObjManager::RegisterStaticMeshAsset(const FString& NormalizedPathStr, FStaticMesh* NewFStaticMesh, TArray<FMaterialInfo>& MaterialInfos)
+{
 	// 4. 머티리얼 및 텍스처 경로 처리 (공통 로직)
 	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 경로 처리
 
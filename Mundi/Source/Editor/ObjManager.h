@@ -66,4 +66,11 @@ public:
 	static void Clear();
 	static FStaticMesh* LoadObjStaticMeshAsset(const FString& PathFileName);
 	static UStaticMesh* LoadObjStaticMesh(const FString& PathFileName);
+
+	// 아직 로드되지 않은 OBJ들의 CPU 로드(캐시 읽기/쿠킹)를 병렬로 수행해 메모리 캐시에 올려둡니다. (GPU 버퍼는 만들지 않음)
+	static void PrefetchObjStaticMeshAssets(const TArray<FString>& PathFileNames);
+
+private:
+	static FStaticMesh* LoadStaticMeshData(const FString& NormalizedPathStr, TArray<FMaterialInfo>& MaterialInfos);
+	static FStaticMesh* RegisterStaticMeshAsset(const FString& NormalizedPathStr, FStaticMesh* NewFStaticMesh, TArray<FMaterialInfo>& MaterialInfos);
 };
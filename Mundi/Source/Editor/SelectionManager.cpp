@@ -59,6 +59,25 @@ void USelectionManager::SelectComponent(UActorComponent* Component)
     
 }
 
+void USelectionManager::SelectActors(const TArray<AActor*>& Actors)
+{
+    ClearSelection();
+
+    for (AActor* Actor : Actors)
+    {
+        if (Actor && !IsActorSelected(Actor))
+        {
+            SelectedActors.Add(Actor);
+        }
+    }
+
+    if (AActor* FirstActor = GetSelectedActor())
+    {
+        SelectedComponent = FirstActor->GetRootComponent();
+        bIsActorMode = true;
+    }
+}
+
 void USelectionManager::DeselectActor(AActor* Actor)
 {
     if (!Actor) return;
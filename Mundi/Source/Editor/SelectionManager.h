@@ -20,6 +20,8 @@ public:
     /** === 선택 관리 === */
     void SelectActor(AActor* Actor);
     void SelectComponent(UActorComponent* Component);
+    // 마키 선택용 다중 선택 (기존 선택 해제, 기즈모는 첫 액터의 루트 컴포넌트)
+    void SelectActors(const TArray<AActor*>& Actors);
     void DeselectActor(AActor* Actor);
     void ClearSelection();
     
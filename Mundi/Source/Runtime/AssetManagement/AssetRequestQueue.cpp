@@ -0,0 +1,62 @@
+﻿#include "pch.h"
+#include "AssetRequestQueue.h"
+#include "ObjManager.h"
+
+bool FAssetRequestQueue::IsRequestablePath(const FString& InPath)
+{
+    if (InPath.size() < 4)
+    {
+        return false;
+    }
+
+    FString Extension = InPath.substr(InPath.size() - 4);
+    std::transform(Extension.begin(), Extension.end(), Extension.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return Extension == ".obj";
+}
+
+bool FAssetRequestQueue::Request(const FString& InPath)
+{
+    if (!IsRequestablePath(InPath))
+    {
+        return false;
+    }
+
+    ++RequestCount;
+
+    FString NormalizedPath = NormalizePath(InPath);
+    if (RequestedPaths.Contains(NormalizedPath))
+    {
+        return false;
+    }
+
+    RequestedPaths.Add(NormalizedPath);
+    PendingStaticMeshes.Add(NormalizedPath);
+    return true;
+}
+
+void FAssetRequestQueue::Flush(const std::function<void(uint32, uint32)>& OnProgress)
+{
+    if (PendingStaticMeshes.IsEmpty())
+    {
+        return;
+    }
+
+    const uint32 Total = static_cast<uint32>(PendingStaticMeshes.size());
+
+    // 1) CPU 로드 (병렬). 이미 로드된 에셋은 내부에서 건너뜀
+    FObjManager::PrefetchObjStaticMeshAssets(PendingStaticMeshes);
+
+    // 2) GPU 리소스 생성 (호출 스레드)
+    uint32 Completed = 0;
+    for (const FString& Path : PendingStaticMeshes)
+    {
+        UResourceManager::GetInstance().Load<UStaticMesh>(Path);
+        if (OnProgress)
+        {
+            OnProgress(++Completed, Total);
+        }
+    }
+
+    PendingStaticMeshes.Empty();
+}
@@ -0,0 +1,31 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include <functional>
+
+/**
+ * 레벨 로드용 에셋 요청 큐.
+ * 액터를 만들기 전에 레벨이 참조하는 에셋 경로를 모아 (경로 정규화 후 중복 제거) 한 번에 처리합니다.
+ * - 스태틱 메시: 파일 캐시 로드/쿠킹은 워커 스레드에서 병렬로, GPU 버퍼 생성은 호출 스레드에서 에셋당 한 번
+ * 이후 액터 역직렬화의 SetStaticMesh()는 리소스 매니저 캐시 조회만 하게 됩니다.
+ *
+ * 텍스처는 같은 경로라도 sRGB 여부에 따라 포맷이 달라지고 첫 로드 설정이 캐시되므로 미리 로드하지 않습니다.
+ */
+class FAssetRequestQueue
+{
+public:
+    // 경로 확장자로 요청 가능 여부를 판별 (.obj만 처리). 새로 추가된 요청이면 true
+    bool Request(const FString& InPath);
+
+    // 대기 중인 요청 처리. OnProgress(완료 수, 전체 수)는 호출 스레드에서 호출됨
+    void Flush(const std::function<void(uint32, uint32)>& OnProgress = nullptr);
+
+    static bool IsRequestablePath(const FString& InPath);
+
+    uint32 GetRequestCount() const { return RequestCount; }                         // 중복 포함
+    uint32 GetUniqueCount() const { return static_cast<uint32>(RequestedPaths.size()); }
+
+private:
+    TArray<FString> PendingStaticMeshes;
+    TSet<FString> RequestedPaths;
+    uint32 RequestCount = 0;
+};
@@ -0,0 +1,419 @@
+﻿#include "pch.h"
+#include "CookedStaticMesh.h"
+#include "PackedVertex.h"
+#include "Crc.h"
+#include <filesystem>
+
+static_assert(std::is_trivially_copyable_v<FNormalVertex>, "FNormalVertex must be trivially copyable for raw cooking");
+static_assert(sizeof(FNormalVertex) == sizeof(FVertexDynamic), "Cooked vertex blob is uploaded as FVertexDynamic");
+static_assert(offsetof(FNormalVertex, Tangent) == offsetof(FVertexDynamic, Tangent) && offsetof(FNormalVertex, color) == offsetof(FVertexDynamic, Color),
+    "Cooked vertex blob is uploaded as FVertexDynamic");
+
+namespace
+{
+    inline uint64 AlignUp(uint64 InValue, uint64 InAlignment)
+    {
+        return (InValue + InAlignment - 1) & ~(InAlignment - 1);
+    }
+
+    inline void ToCookedStats(const FVertexCacheStats& InStats, FCookedVertexCacheStats& OutStats)
+    {
+        OutStats = {};
+        OutStats.ACMR = InStats.ACMR;
+        OutStats.ATVR = InStats.ATVR;
+        OutStats.TransformedVertexCount = InStats.TransformedVertexCount;
+    }
+
+    inline FVertexCacheStats FromCookedStats(const FCookedVertexCacheStats& InStats)
+    {
+        FVertexCacheStats Stats;
+        Stats.ACMR = InStats.ACMR;
+        Stats.ATVR = InStats.ATVR;
+        Stats.TransformedVertexCount = InStats.TransformedVertexCount;
+        return Stats;
+    }
+
+    inline uint32 ComputeHeaderChecksum(const FCookedMeshHeader& InHeader)
+    {
+        FCookedMeshHeader Copy = InHeader;
+        Copy.HeaderChecksum = 0;
+        return FCrc::MemCrc32(&Copy, sizeof(Copy));
+    }
+
+    inline bool Fail(FString* OutError, const char* InMessage)
+    {
+        if (OutError)
+        {
+            *OutError = InMessage;
+        }
+        return false;
+    }
+
+    // 쿠킹 중 섹션 데이터를 모으는 임시 버퍼
+    struct FSectionBlob
+    {
+        ECookedMeshSection Type;
+        uint32 ElementSize;
+        const void* Data;
+        uint64 Size;
+    };
+}
+
+// ─────────────────────────────
+// 쓰기
+// ─────────────────────────────
+void FCookedStaticMesh::Cook(const FStaticMesh& InStaticMesh, TArray<uint8>& OutBytes)
+{
+    // 문자열 테이블: 경로 + 그룹별 머티리얼 이름
+    FString StringTable;
+    auto AddString = [&StringTable](const FString& InString, uint32& OutOffset, uint32& OutLength)
+        {
+            OutOffset = static_cast<uint32>(StringTable.size());
+            OutLength = static_cast<uint32>(InString.size());
+            StringTable += InString;
+        };
+
+    FCookedMeshMetadata Metadata = {};
+    AddString(InStaticMesh.PathFileName, Metadata.PathFileNameOffset, Metadata.PathFileNameLength);
+    Metadata.bHasMaterial = InStaticMesh.bHasMaterial ? 1u : 0u;
+    Metadata.PositionDequantScale[0] = Metadata.PositionDequantScale[1] = Metadata.PositionDequantScale[2] = 1.0f;
+
+    const FMeshOptimizationStats& OptStats = InStaticMesh.OptimizationStats;
+    Metadata.bOptimized = OptStats.bOptimized ? 1u : 0u;
+    Metadata.CacheSize = OptStats.CacheSize;
+    ToCookedStats(OptStats.BeforeFIFO, Metadata.BeforeFIFO);
+    ToCookedStats(OptStats.AfterFIFO, Metadata.AfterFIFO);
+    ToCookedStats(OptStats.BeforeLRU, Metadata.BeforeLRU);
+    ToCookedStats(OptStats.AfterLRU, Metadata.AfterLRU);
+
+    TArray<FCookedMeshGroup> Groups;
+    Groups.Reserve(static_cast<int32>(InStaticMesh.GroupInfos.size()));
+    for (const FGroupInfo& GroupInfo : InStaticMesh.GroupInfos)
+    {
+        FCookedMeshGroup Group = {};
+        Group.StartIndex = GroupInfo.StartIndex;
+        Group.IndexCount = GroupInfo.IndexCount;
+        AddString(GroupInfo.InitialMaterialName, Group.MaterialNameOffset, Group.MaterialNameLength);
+        Groups.Add(Group);
+    }
+
+    // 패킹 정점 스트림은 쿠킹 시 한 번만 인코딩/검증 (로드 시에는 그대로 업로드)
+    FPackedVertexBuffer Packed;
+#ifdef USE_PACKED_STATIC_MESH_VERTEX
+    if (!InStaticMesh.Vertices.empty())
+    {
+        FPackedVertexCodec::Encode(InStaticMesh.Vertices, FPackedVertexCodec::ChooseFormat(InStaticMesh.Vertices), Packed);
+        if (FPackedVertexCodec::Verify(InStaticMesh.Vertices, Packed).bWithinTolerance)
+        {
+            Metadata.PackedVertexFlags = Packed.Format.GetFlags();
+            memcpy(Metadata.PositionDequantScale, &Packed.PositionDequantScale.X, sizeof(float) * 4);
+            memcpy(Metadata.PositionDequantBias, &Packed.PositionDequantBias.X, sizeof(float) * 4);
+        }
+        else
+        {
+            Packed.Data.clear();
+        }
+    }
+#endif
+
+    const FSectionBlob Blobs[] = {
+        { ECookedMeshSection::Metadata, sizeof(FCookedMeshMetadata), &Metadata, sizeof(FCookedMeshMetadata) },
+        { ECookedMeshSection::Vertices, sizeof(FNormalVertex), InStaticMesh.Vertices.data(), sizeof(FNormalVertex) * static_cast<uint64>(InStaticMesh.Vertices.size()) },
+        { ECookedMeshSection::Indices, sizeof(uint32), InStaticMesh.Indices.data(), sizeof(uint32) * static_cast<uint64>(InStaticMesh.Indices.size()) },
+        { ECookedMeshSection::Groups, sizeof(FCookedMeshGroup), Groups.data(), sizeof(FCookedMeshGroup) * static_cast<uint64>(Groups.size()) },
+        { ECookedMeshSection::StringTable, 1, StringTable.data(), static_cast<uint64>(StringTable.size()) },
+        { ECookedMeshSection::PackedVertices, Packed.Data.empty() ? 0u : Packed.Format.GetStride(), Packed.Data.data(), static_cast<uint64>(Packed.Data.size()) },
+    };
+    constexpr uint32 SectionCount = static_cast<uint32>(sizeof(Blobs) / sizeof(Blobs[0]));
+    static_assert(SectionCount == static_cast<uint32>(ECookedMeshSection::Count), "Every section type must be written");
+
+    // 레이아웃 계산
+    const uint64 SectionTableOffset = sizeof(FCookedMeshHeader);
+    uint64 Cursor = AlignUp(SectionTableOffset + sizeof(FCookedMeshSectionEntry) * SectionCount, COOKED_MESH_ALIGNMENT);
+
+    FCookedMeshSectionEntry Entries[SectionCount] = {};
+    for (uint32 i = 0; i < SectionCount; ++i)
+    {
+        Entries[i].Type = static_cast<uint32>(Blobs[i].Type);
+        Entries[i].ElementSize = Blobs[i].ElementSize;
+        Entries[i].Offset = Cursor;
+        Entries[i].Size = Blobs[i].Size;
+        Entries[i].Checksum = Blobs[i].Size > 0 ? FCrc::MemCrc32(Blobs[i].Data, Blobs[i].Size) : 0;
+        Cursor = AlignUp(Cursor + Blobs[i].Size, COOKED_MESH_ALIGNMENT);
+    }
+    const uint64 FileSize = Cursor;
+
+    FCookedMeshHeader Header = {};
+    Header.Magic = COOKED_MESH_MAGIC;
+    Header.Version = COOKED_MESH_VERSION;
+    Header.HeaderSize = sizeof(FCookedMeshHeader);
+    Header.SectionCount = SectionCount;
+    Header.FileSize = FileSize;
+    Header.SectionTableOffset = SectionTableOffset;
+    Header.VertexElementSize = sizeof(FNormalVertex);
+    Header.SectionTableChecksum = FCrc::MemCrc32(Entries, sizeof(Entries));
+    Header.HeaderChecksum = ComputeHeaderChecksum(Header);
+
+    // 패딩은 0으로 채워 같은 입력이 항상 같은 파일을 만들도록 함
+    OutBytes.clear();
+    OutBytes.resize(FileSize, 0);
+    memcpy(OutBytes.data(), &Header, sizeof(Header));
+    memcpy(OutBytes.data() + SectionTableOffset, Entries, sizeof(Entries));
+    for (uint32 i = 0; i < SectionCount; ++i)
+    {
+        if (Blobs[i].Size > 0)
+        {
+            memcpy(OutBytes.data() + Entries[i].Offset, Blobs[i].Data, Blobs[i].Size);
+        }
+    }
+}
+
+bool FCookedStaticMesh::Write(const FString& InFilePath, const FStaticMesh& InStaticMesh)
+{
+    TArray<uint8> Bytes;
+    Cook(InStaticMesh, Bytes);
+
+    const FWideString WFinalPath = UTF8ToWide(InFilePath);
+    const FWideString WTempPath = WFinalPath + L".tmp";
+    {
+        std::ofstream File(std::filesystem::path(WTempPath), std::ios::binary | std::ios::out | std::ios::trunc);
+        if (!File.is_open())
+        {
+            UE_LOG("[CookedMesh] Failed to open '%s' for writing.", InFilePath.c_str());
+            return false;
+        }
+        File.write(reinterpret_cast<const char*>(Bytes.data()), static_cast<std::streamsize>(Bytes.size()));
+        if (!File.good())
+        {
+            UE_LOG("[CookedMesh] Failed to write '%s'.", InFilePath.c_str());
+            return false;
+        }
+    }
+
+    std::error_code Ec;
+    std::filesystem::rename(std::filesystem::path(WTempPath), std::filesystem::path(WFinalPath), Ec);
+    if (Ec)
+    {
+        std::filesystem::remove(std::filesystem::path(WTempPath), Ec);
+        UE_LOG("[CookedMesh] Failed to replace '%s'.", InFilePath.c_str());
+        return false;
+    }
+    return true;
+}
+
+// ─────────────────────────────
+// 읽기
+// ─────────────────────────────
+bool FCookedStaticMeshView::Open(const FString& InFilePath, FString* OutError)
+{
+    Close();
+    if (!MappedFile.Open(InFilePath))
+    {
+        return Fail(OutError, "Failed to map cooked mesh file");
+    }
+    if (!Initialize(MappedFile.GetData(), MappedFile.GetSize(), OutError))
+    {
+        MappedFile.Close();
+        return false;
+    }
+    return true;
+}
+
+bool FCookedStaticMeshView::Initialize(const uint8* InData, uint64 InSize, FString* OutError)
+{
+    Data = nullptr;
+    Size = 0;
+    Metadata = nullptr;
+    for (const FCookedMeshSectionEntry*& Section : Sections)
+    {
+        Section = nullptr;
+    }
+
+    if (!InData || InSize < sizeof(FCookedMeshHeader))
+    {
+        return Fail(OutError, "File too small");
+    }
+    if (reinterpret_cast<uintptr_t>(InData) % alignof(FNormalVertex) != 0)
+    {
+        return Fail(OutError, "Misaligned cooked data");
+    }
+
+    // 1. 헤더
+    const FCookedMeshHeader& Header = *reinterpret_cast<const FCookedMeshHeader*>(InData);
+    if (Header.Magic != COOKED_MESH_MAGIC)
+    {
+        return Fail(OutError, "Bad magic");
+    }
+    if (Header.Version != COOKED_MESH_VERSION)
+    {
+        return Fail(OutError, "Cache outdated: cooked mesh version mismatch");
+    }
+    if (Header.HeaderSize != sizeof(FCookedMeshHeader) || Header.VertexElementSize != sizeof(FNormalVertex))
+    {
+        return Fail(OutError, "Cache outdated: vertex layout mismatch");
+    }
+    if (ComputeHeaderChecksum(Header) != Header.HeaderChecksum)
+    {
+        return Fail(OutError, "Header checksum mismatch");
+    }
+    if (Header.FileSize != InSize)
+    {
+        return Fail(OutError, "File size mismatch (truncated?)");
+    }
+
+    // 2. 섹션 테이블
+    const uint64 TableSize = sizeof(FCookedMeshSectionEntry) * static_cast<uint64>(Header.SectionCount);
+    if (Header.SectionTableOffset < sizeof(FCookedMeshHeader) || Header.SectionTableOffset + TableSize > InSize)
+    {
+        return Fail(OutError, "Section table out of range");
+    }
+    const FCookedMeshSectionEntry* Entries = reinterpret_cast<const FCookedMeshSectionEntry*>(InData + Header.SectionTableOffset);
+    if (FCrc::MemCrc32(Entries, TableSize) != Header.SectionTableChecksum)
+    {
+        return Fail(OutError, "Section table checksum mismatch");
+    }
+
+    // 3. 섹션 범위/정렬/체크섬 (알 수 없는 섹션은 무시하여 상위 호환)
+    for (uint32 i = 0; i < Header.SectionCount; ++i)
+    {
+        const FCookedMeshSectionEntry& Entry = Entries[i];
+        if (Entry.Offset % COOKED_MESH_ALIGNMENT != 0 || Entry.Offset > InSize || Entry.Size > InSize - Entry.Offset)
+        {
+            return Fail(OutError, "Section out of range");
+        }
+        if (Entry.ElementSize > 0 && Entry.Size % Entry.ElementSize != 0)
+        {
+            return Fail(OutError, "Section size is not a multiple of its element size");
+        }
+        if (Entry.Size > 0 && FCrc::MemCrc32(InData + Entry.Offset, Entry.Size) != Entry.Checksum)
+        {
+            return Fail(OutError, "Section checksum mismatch");
+        }
+        if (Entry.Type < static_cast<uint32>(ECookedMeshSection::Count))
+        {
+            Sections[Entry.Type] = &Entry;
+        }
+    }
+
+    // 4. 필수 섹션
+    const FCookedMeshSectionEntry* MetadataSection = Sections[static_cast<uint32>(ECookedMeshSection::Metadata)];
+    if (!MetadataSection || MetadataSection->Size != sizeof(FCookedMeshMetadata) ||
+        !Sections[static_cast<uint32>(ECookedMeshSection::Vertices)] ||
+        !Sections[static_cast<uint32>(ECookedMeshSection::Indices)] ||
+        !Sections[static_cast<uint32>(ECookedMeshSection::Groups)] ||
+        !Sections[static_cast<uint32>(ECookedMeshSection::StringTable)])
+    {
+        return Fail(OutError, "Missing required section");
+    }
+    if (Sections[static_cast<uint32>(ECookedMeshSection::Vertices)]->ElementSize != sizeof(FNormalVertex) ||
+        Sections[static_cast<uint32>(ECookedMeshSection::Indices)]->ElementSize != sizeof(uint32) ||
+        Sections[static_cast<uint32>(ECookedMeshSection::Groups)]->ElementSize != sizeof(FCookedMeshGroup))
+    {
+        return Fail(OutError, "Section element size mismatch");
+    }
+
+    Data = InData;
+    Size = InSize;
+    Metadata = reinterpret_cast<const FCookedMeshMetadata*>(InData + MetadataSection->Offset);
+
+    // 5. 문자열 참조 범위
+    const uint64 StringTableSize = GetSectionSize(ECookedMeshSection::StringTable);
+    bool bStringsValid = static_cast<uint64>(Metadata->PathFileNameOffset) + Metadata->PathFileNameLength <= StringTableSize;
+    const FCookedMeshGroup* Groups = GetGroups();
+    for (uint32 i = 0; i < GetGroupCount() && bStringsValid; ++i)
+    {
+        bStringsValid = static_cast<uint64>(Groups[i].MaterialNameOffset) + Groups[i].MaterialNameLength <= StringTableSize;
+    }
+    if (!bStringsValid)
+    {
+        Close();
+        return Fail(OutError, "String reference out of range");
+    }
+
+    return true;
+}
+
+void FCookedStaticMeshView::Close()
+{
+    MappedFile.Close();
+    Data = nullptr;
+    Size = 0;
+    Metadata = nullptr;
+    for (const FCookedMeshSectionEntry*& Section : Sections)
+    {
+        Section = nullptr;
+    }
+}
+
+const uint8* FCookedStaticMeshView::GetSectionData(ECookedMeshSection InSection) const
+{
+    const FCookedMeshSectionEntry* Entry = Sections[static_cast<uint32>(InSection)];
+    return (Data && Entry) ? Data + Entry->Offset : nullptr;
+}
+
+uint64 FCookedStaticMeshView::GetSectionSize(ECookedMeshSection InSection) const
+{
+    const FCookedMeshSectionEntry* Entry = Sections[static_cast<uint32>(InSection)];
+    return (Data && Entry) ? Entry->Size : 0;
+}
+
+uint32 FCookedStaticMeshView::GetElementCount(ECookedMeshSection InSection) const
+{
+    const FCookedMeshSectionEntry* Entry = Sections[static_cast<uint32>(InSection)];
+    return (Data && Entry && Entry->ElementSize > 0) ? static_cast<uint32>(Entry->Size / Entry->ElementSize) : 0;
+}
+
+FString FCookedStaticMeshView::GetString(uint32 InOffset, uint32 InLength) const
+{
+    const char* Strings = reinterpret_cast<const char*>(GetSectionData(ECookedMeshSection::StringTable));
+    return Strings ? FString(Strings + InOffset, InLength) : FString();
+}
+
+void FCookedStaticMeshView::CopyTo(FStaticMesh& OutStaticMesh) const
+{
+    OutStaticMesh.PathFileName = GetString(Metadata->PathFileNameOffset, Metadata->PathFileNameLength);
+
+    OutStaticMesh.Vertices.resize(GetVertexCount());
+    if (GetVertexCount() > 0)
+    {
+        memcpy(OutStaticMesh.Vertices.data(), GetVertices(), sizeof(FNormalVertex) * static_cast<size_t>(GetVertexCount()));
+    }
+
+    OutStaticMesh.Indices.resize(GetIndexCount());
+    if (GetIndexCount() > 0)
+    {
+        memcpy(OutStaticMesh.Indices.data(), GetIndices(), sizeof(uint32) * static_cast<size_t>(GetIndexCount()));
+    }
+
+    const FCookedMeshGroup* Groups = GetGroups();
+    OutStaticMesh.GroupInfos.resize(GetGroupCount());
+    for (uint32 i = 0; i < GetGroupCount(); ++i)
+    {
+        FGroupInfo& GroupInfo = OutStaticMesh.GroupInfos[i];
+        GroupInfo.StartIndex = Groups[i].StartIndex;
+        GroupInfo.IndexCount = Groups[i].IndexCount;
+        GroupInfo.InitialMaterialName = GetString(Groups[i].MaterialNameOffset, Groups[i].MaterialNameLength);
+    }
+
+    OutStaticMesh.bHasMaterial = Metadata->bHasMaterial != 0;
+
+    FMeshOptimizationStats& OptStats = OutStaticMesh.OptimizationStats;
+    OptStats.bOptimized = Metadata->bOptimized != 0;
+    OptStats.CacheSize = Metadata->CacheSize;
+    OptStats.BeforeFIFO = FromCookedStats(Metadata->BeforeFIFO);
+    OptStats.AfterFIFO = FromCookedStats(Metadata->AfterFIFO);
+    OptStats.BeforeLRU = FromCookedStats(Metadata->BeforeLRU);
+    OptStats.AfterLRU = FromCookedStats(Metadata->AfterLRU);
+
+    // 패킹 스트림도 이미 검증된 이 매핑에서 복사해 두어 GPU 업로드 시 파일을 다시 열지 않음
+    OutStaticMesh.CookedPackedVertices.clear();
+    OutStaticMesh.CookedPackedVertexFlags = 0;
+    if (HasPackedVertices())
+    {
+        OutStaticMesh.CookedPackedVertices.resize(static_cast<size_t>(GetPackedVertexDataSize()));
+        memcpy(OutStaticMesh.CookedPackedVertices.data(), GetPackedVertexData(), static_cast<size_t>(GetPackedVertexDataSize()));
+        OutStaticMesh.CookedPackedVertexFlags = Metadata->PackedVertexFlags;
+        memcpy(OutStaticMesh.CookedPositionDequantScale, Metadata->PositionDequantScale, sizeof(Metadata->PositionDequantScale));
+        memcpy(OutStaticMesh.CookedPositionDequantBias, Metadata->PositionDequantBias, sizeof(Metadata->PositionDequantBias));
+    }
+}
@@ -0,0 +1,155 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Enums.h"
+#include "WindowsMappedFile.h"
+
+/**
+ * 쿠킹된 스태틱 메시 파일 (.umesh)
+ *
+ *   [FCookedMeshHeader 64B][섹션 테이블 FCookedMeshSectionEntry x N][섹션 데이터 ...]
+ *
+ * - 모든 섹션은 COOKED_MESH_ALIGNMENT(64B) 정렬이므로 매핑 주소에서 그대로 FNormalVertex/uint32 배열로 볼 수 있습니다.
+ * - 헤더, 섹션 테이블, 각 섹션마다 CRC32를 가집니다.
+ * - 정점 블롭은 FVertexDynamic과 같은 레이아웃이라 변환 없이 정점 버퍼로 업로드됩니다.
+ * - USE_PACKED_STATIC_MESH_VERTEX이면 쿠킹 시 검증된 패킹 정점 스트림도 함께 저장합니다.
+ */
+constexpr uint32 COOKED_MESH_MAGIC = 0x48534D55; // "UMSH"
+constexpr uint32 COOKED_MESH_VERSION = 1;
+constexpr uint32 COOKED_MESH_ALIGNMENT = 64;
+
+enum class ECookedMeshSection : uint32
+{
+    Metadata = 0,       // FCookedMeshMetadata 1개
+    Vertices,           // FNormalVertex[]
+    Indices,            // uint32[]
+    Groups,             // FCookedMeshGroup[]
+    StringTable,        // UTF-8 문자열 풀 (오프셋/길이로 참조, 널 종료 없음)
+    PackedVertices,     // FPackedVertexFormat 정점 스트림 (선택)
+
+    Count
+};
+
+struct FCookedMeshHeader
+{
+    uint32 Magic;
+    uint32 Version;
+    uint32 HeaderSize;
+    uint32 SectionCount;
+    uint64 FileSize;
+    uint64 SectionTableOffset;
+    uint32 VertexElementSize;       // 쿠킹 시 sizeof(FNormalVertex). 레이아웃이 바뀌면 재쿠킹
+    uint32 SectionTableChecksum;
+    uint32 HeaderChecksum;          // 이 필드를 0으로 두고 계산한 CRC32
+    uint32 Reserved[5];
+};
+static_assert(sizeof(FCookedMeshHeader) == 64, "FCookedMeshHeader must be 64 bytes");
+
+struct FCookedMeshSectionEntry
+{
+    uint32 Type;            // ECookedMeshSection
+    uint32 ElementSize;
+    uint64 Offset;          // 파일 시작 기준
+    uint64 Size;            // 바이트 (패딩 제외)
+    uint32 Checksum;
+    uint32 Reserved;
+};
+static_assert(sizeof(FCookedMeshSectionEntry) == 32, "FCookedMeshSectionEntry must be 32 bytes");
+
+struct FCookedMeshGroup
+{
+    uint32 StartIndex;
+    uint32 IndexCount;
+    uint32 MaterialNameOffset;
+    uint32 MaterialNameLength;
+};
+
+struct FCookedVertexCacheStats
+{
+    float ACMR;
+    float ATVR;
+    uint32 TransformedVertexCount;
+    uint32 Padding;
+};
+
+struct FCookedMeshMetadata
+{
+    uint32 PathFileNameOffset;
+    uint32 PathFileNameLength;
+    uint32 bHasMaterial;
+    uint32 PackedVertexFlags;       // EPackedVertexFlags, 0이면 PackedVertices 섹션 없음
+    float PositionDequantScale[4];
+    float PositionDequantBias[4];
+
+    // FMeshOptimizationStats
+    uint32 bOptimized;
+    uint32 CacheSize;
+    uint32 Padding[2];
+    FCookedVertexCacheStats BeforeFIFO;
+    FCookedVertexCacheStats AfterFIFO;
+    FCookedVertexCacheStats BeforeLRU;
+    FCookedVertexCacheStats AfterLRU;
+};
+
+/**
+ * 쿠킹 메시 파일의 읽기 전용 뷰.
+ * Open()은 파일을 매핑하고 헤더/섹션/체크섬을 검증만 하며, 정점/인덱스는 매핑된 메모리를 그대로 가리킵니다.
+ * 뷰가 살아있는 동안 파일이 매핑되어 있으므로 짧게 사용하고 닫습니다.
+ */
+class FCookedStaticMeshView
+{
+public:
+    FCookedStaticMeshView() = default;
+
+    bool Open(const FString& InFilePath, FString* OutError = nullptr);
+
+    // 이미 메모리에 있는 쿠킹 데이터 검증 (InData는 16바이트 이상 정렬이어야 함)
+    bool Initialize(const uint8* InData, uint64 InSize, FString* OutError = nullptr);
+    void Close();
+
+    bool IsValid() const { return Data != nullptr; }
+
+    const FCookedMeshMetadata& GetMetadata() const { return *Metadata; }
+
+    const FNormalVertex* GetVertices() const { return reinterpret_cast<const FNormalVertex*>(GetSectionData(ECookedMeshSection::Vertices)); }
+    uint32 GetVertexCount() const { return GetElementCount(ECookedMeshSection::Vertices); }
+
+    const uint32* GetIndices() const { return reinterpret_cast<const uint32*>(GetSectionData(ECookedMeshSection::Indices)); }
+    uint32 GetIndexCount() const { return GetElementCount(ECookedMeshSection::Indices); }
+
+    const FCookedMeshGroup* GetGroups() const { return reinterpret_cast<const FCookedMeshGroup*>(GetSectionData(ECookedMeshSection::Groups)); }
+    uint32 GetGroupCount() const { return GetElementCount(ECookedMeshSection::Groups); }
+
+    bool HasPackedVertices() const { return Metadata && Metadata->PackedVertexFlags != 0 && GetSectionSize(ECookedMeshSection::PackedVertices) > 0; }
+    const uint8* GetPackedVertexData() const { return GetSectionData(ECookedMeshSection::PackedVertices); }
+    uint64 GetPackedVertexDataSize() const { return GetSectionSize(ECookedMeshSection::PackedVertices); }
+
+    FString GetString(uint32 InOffset, uint32 InLength) const;
+
+    // FStaticMesh로 복사 (섹션당 memcpy 1회, 요소별 역직렬화 없음)
+    // 매핑을 그대로 쓰는 제로 카피가 아니라 로드 시 한 번 복사하는 방식입니다.
+    // FStaticMesh는 정점/인덱스를 TArray로 소유하고 피킹/BVH/충돌용으로 에셋 수명 내내 유지하는데,
+    // 매핑은 로드 직후 닫으므로 (파일 핸들을 잡아 두면 캐시 재생성 시 덮어쓸 수 없음) 소유 사본이 필요합니다.
+    // 아낀 것은 파싱/요소별 역직렬화 비용이고 복사 자체는 남아 있습니다.
+    void CopyTo(FStaticMesh& OutStaticMesh) const;
+
+private:
+    const uint8* GetSectionData(ECookedMeshSection InSection) const;
+    uint64 GetSectionSize(ECookedMeshSection InSection) const;
+    uint32 GetElementCount(ECookedMeshSection InSection) const;
+
+    FWindowsMappedFile MappedFile;
+    const uint8* Data = nullptr;
+    uint64 Size = 0;
+    const FCookedMeshMetadata* Metadata = nullptr;
+    const FCookedMeshSectionEntry* Sections[static_cast<uint32>(ECookedMeshSection::Count)] = {};
+};
+
+struct FCookedStaticMesh
+{
+public:
+    // FStaticMesh를 쿠킹 파일로 저장합니다. (임시 파일에 쓴 뒤 교체하므로 실패해도 기존 파일은 유지)
+    static bool Write(const FString& InFilePath, const FStaticMesh& InStaticMesh);
+
+    // 쓰기 없이 쿠킹 결과 바이트만 생성 (Write 내부 및 검증용)
+    static void Cook(const FStaticMesh& InStaticMesh, TArray<uint8>& OutBytes);
+};
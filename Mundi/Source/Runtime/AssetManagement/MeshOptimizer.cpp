@@ -0,0 +1,548 @@
+﻿#include "pch.h"
+#include "MeshOptimizer.h"
+
+namespace
+{
+    // ─────────────────────────────
+    // Forsyth 점수 함수 상수 ("Linear-Speed Vertex Cache Optimisation", Tom Forsyth)
+    // ─────────────────────────────
+    constexpr int32 ForsythCacheSize = 32;
+    constexpr float ForsythCacheDecayPower = 1.5f;
+    constexpr float ForsythLastTriScore = 0.75f;
+    constexpr float ForsythValenceBoostScale = 2.0f;
+    constexpr float ForsythValenceBoostPower = 0.5f;
+
+    // 점수 계산의 pow 호출을 피하기 위한 테이블
+    constexpr uint32 MaxValenceTable = 32;
+
+    struct FForsythScoreTable
+    {
+        float CachePositionScore[ForsythCacheSize];
+        float ValenceScore[MaxValenceTable];
+
+        FForsythScoreTable()
+        {
+            for (int32 i = 0; i < ForsythCacheSize; ++i)
+            {
+                if (i < 3)
+                {
+                    // 방금 사용된 삼각형의 정점은 고정 점수 (같은 삼각형을 연속으로 고르지 않도록)
+                    CachePositionScore[i] = ForsythLastTriScore;
+                }
+                else
+                {
+                    const float Scaler = 1.0f / static_cast<float>(ForsythCacheSize - 3);
+                    CachePositionScore[i] = std::pow(1.0f - static_cast<float>(i - 3) * Scaler, ForsythCacheDecayPower);
+                }
+            }
+            ValenceScore[0] = 0.0f;
+            for (uint32 i = 1; i < MaxValenceTable; ++i)
+            {
+                ValenceScore[i] = ForsythValenceBoostScale * std::pow(static_cast<float>(i), -ForsythValenceBoostPower);
+            }
+        }
+    };
+
+    const FForsythScoreTable& GetForsythScoreTable()
+    {
+        static FForsythScoreTable Table;
+        return Table;
+    }
+
+    float ComputeVertexScore(int32 CachePosition, uint32 RemainingValence)
+    {
+        if (RemainingValence == 0)
+        {
+            // 더 이상 사용할 삼각형이 없는 정점
+            return -1.0f;
+        }
+
+        const FForsythScoreTable& Table = GetForsythScoreTable();
+        float Score = (CachePosition >= 0) ? Table.CachePositionScore[CachePosition] : 0.0f;
+
+        if (RemainingValence < MaxValenceTable)
+        {
+            Score += Table.ValenceScore[RemainingValence];
+        }
+        else
+        {
+            Score += ForsythValenceBoostScale * std::pow(static_cast<float>(RemainingValence), -ForsythValenceBoostPower);
+        }
+        return Score;
+    }
+
+    // 정점 캐시 시뮬레이터. 변환(=캐시 미스)이 일어난 정점 수를 반환합니다.
+    class FVertexCacheSimulator
+    {
+    public:
+        FVertexCacheSimulator(uint32 InVertexCount, uint32 InCacheSize, EVertexCacheModel InModel)
+            : CacheSize(InCacheSize)
+            , Model(InModel)
+        {
+            // FIFO: 정점이 캐시에 들어간 시점(타임스탬프)만 기억하면 O(1)로 판정 가능
+            Timestamps.assign(InVertexCount, 0);
+            Time = CacheSize + 1;
+        }
+
+        void Reset()
+        {
+            if (Model == EVertexCacheModel::FIFO)
+            {
+                // 타임스탬프를 캐시 크기 이상 밀면 모든 정점이 미스로 판정됨
+                Time += CacheSize + 1;
+            }
+            else
+            {
+                LRU.clear();
+            }
+        }
+
+        uint32 Access(uint32 Vertex)
+        {
+            if (Model == EVertexCacheModel::FIFO)
+            {
+                if (Time - Timestamps[Vertex] > CacheSize)
+                {
+                    Timestamps[Vertex] = Time++;
+                    return 1;
+                }
+                return 0;
+            }
+
+            auto It = std::find(LRU.begin(), LRU.end(), Vertex);
+            const bool bHit = (It != LRU.end());
+            if (bHit)
+            {
+                LRU.erase(It);
+            }
+            LRU.insert(LRU.begin(), Vertex);
+            if (LRU.size() > CacheSize)
+            {
+                LRU.pop_back();
+            }
+            return bHit ? 0 : 1;
+        }
+
+        uint32 AccessTriangle(uint32 A, uint32 B, uint32 C)
+        {
+            return Access(A) + Access(B) + Access(C);
+        }
+
+    private:
+        uint32 CacheSize;
+        EVertexCacheModel Model;
+
+        TArray<uint32> Timestamps;
+        uint32 Time = 0;
+
+        TArray<uint32> LRU;
+    };
+}
+
+void FMeshOptimizer::OptimizeStaticMesh(FStaticMesh* InOutStaticMesh, const FMeshOptimizationSettings& InSettings)
+{
+    if (!InOutStaticMesh || InOutStaticMesh->Indices.empty() || InOutStaticMesh->Vertices.empty())
+    {
+        return;
+    }
+
+    TArray<FNormalVertex>& Vertices = InOutStaticMesh->Vertices;
+    TArray<uint32>& Indices = InOutStaticMesh->Indices;
+    FMeshOptimizationStats& Stats = InOutStaticMesh->OptimizationStats;
+
+    const uint32 VertexCount = static_cast<uint32>(Vertices.size());
+    Stats.CacheSize = InSettings.ReportCacheSize;
+    Stats.BeforeFIFO = AnalyzeVertexCache(Indices, VertexCount, InSettings.ReportCacheSize, EVertexCacheModel::FIFO);
+    Stats.BeforeLRU = AnalyzeVertexCache(Indices, VertexCount, InSettings.ReportCacheSize, EVertexCacheModel::LRU);
+
+    // 섹션(머티리얼 그룹) 경계를 넘지 않도록 그룹 단위로 삼각형 순서를 바꿈
+    TArray<TPair<uint32, uint32>> Sections;
+    for (const FGroupInfo& Group : InOutStaticMesh->GroupInfos)
+    {
+        Sections.push_back({ Group.StartIndex, Group.IndexCount });
+    }
+    if (Sections.empty())
+    {
+        Sections.push_back({ 0u, static_cast<uint32>(Indices.size()) });
+    }
+
+    for (const TPair<uint32, uint32>& Section : Sections)
+    {
+        if (Section.second < 3 || Section.first + Section.second > Indices.size())
+        {
+            continue;
+        }
+
+        if (InSettings.bOptimizeVertexCache)
+        {
+            OptimizeVertexCache(Indices, Section.first, Section.second, VertexCount);
+        }
+        if (InSettings.bOptimizeOverdraw)
+        {
+            OptimizeOverdraw(Indices, Section.first, Section.second, Vertices, InSettings.OverdrawThreshold);
+        }
+    }
+
+    // 정점 재배치는 인덱스 순서가 확정된 뒤 메시 전체에 대해 한 번 수행
+    if (InSettings.bOptimizeVertexFetch)
+    {
+        OptimizeVertexFetch(Vertices, Indices);
+    }
+
+    const uint32 NewVertexCount = static_cast<uint32>(Vertices.size());
+    Stats.AfterFIFO = AnalyzeVertexCache(Indices, NewVertexCount, InSettings.ReportCacheSize, EVertexCacheModel::FIFO);
+    Stats.AfterLRU = AnalyzeVertexCache(Indices, NewVertexCount, InSettings.ReportCacheSize, EVertexCacheModel::LRU);
+    Stats.bOptimized = true;
+}
+
+void FMeshOptimizer::OptimizeVertexCache(TArray<uint32>& InOutIndices, uint32 InStart, uint32 InCount, uint32 InVertexCount)
+{
+    const uint32 TriangleCount = InCount / 3;
+    if (TriangleCount < 2)
+    {
+        return;
+    }
+
+    const uint32* SrcIndices = InOutIndices.data() + InStart;
+
+    // 1) 정점별 인접 삼각형 목록 (CSR 형태: Offset + 연속 배열)
+    TArray<uint32> Valence(InVertexCount, 0);
+    for (uint32 i = 0; i < TriangleCount * 3; ++i)
+    {
+        ++Valence[SrcIndices[i]];
+    }
+
+    TArray<uint32> AdjacencyOffset(InVertexCount + 1, 0);
+    for (uint32 v = 0; v < InVertexCount; ++v)
+    {
+        AdjacencyOffset[v + 1] = AdjacencyOffset[v] + Valence[v];
+    }
+
+    TArray<uint32> Adjacency(TriangleCount * 3);
+    TArray<uint32> FillCursor(AdjacencyOffset.begin(), AdjacencyOffset.end() - 1);
+    for (uint32 Tri = 0; Tri < TriangleCount; ++Tri)
+    {
+        for (uint32 k = 0; k < 3; ++k)
+        {
+            const uint32 v = SrcIndices[Tri * 3 + k];
+            Adjacency[FillCursor[v]++] = Tri;
+        }
+    }
+
+    // 2) 초기 점수
+    TArray<int32> CachePosition(InVertexCount, -1);
+    TArray<float> VertexScore(InVertexCount, 0.0f);
+    TArray<uint32> RemainingValence = Valence;
+    for (uint32 v = 0; v < InVertexCount; ++v)
+    {
+        VertexScore[v] = ComputeVertexScore(-1, RemainingValence[v]);
+    }
+
+    TArray<float> TriangleScore(TriangleCount, 0.0f);
+    TArray<uint8> bTriangleEmitted(TriangleCount, 0);
+    for (uint32 Tri = 0; Tri < TriangleCount; ++Tri)
+    {
+        TriangleScore[Tri] = VertexScore[SrcIndices[Tri * 3]] + VertexScore[SrcIndices[Tri * 3 + 1]] + VertexScore[SrcIndices[Tri * 3 + 2]];
+    }
+
+    // 3) 탐욕적 선택 루프
+    TArray<uint32> OutIndices;
+    OutIndices.reserve(TriangleCount * 3);
+
+    int32 Cache[ForsythCacheSize + 3];
+    int32 CacheCount = 0;
+    int32 NewCache[ForsythCacheSize + 3];
+
+    // 캐시 주변에서 후보를 못 찾으면 파일 순서상 다음 미출력 삼각형으로 (결정적)
+    uint32 ScanCursor = 0;
+    int32 BestTriangle = -1;
+    {
+        float BestScore = -1.0f;
+        for (uint32 Tri = 0; Tri < TriangleCount; ++Tri)
+        {
+            if (TriangleScore[Tri] > BestScore)
+            {
+                BestScore = TriangleScore[Tri];
+                BestTriangle = static_cast<int32>(Tri);
+            }
+        }
+    }
+
+    for (uint32 Emitted = 0; Emitted < TriangleCount; ++Emitted)
+    {
+        if (BestTriangle < 0)
+        {
+            while (ScanCursor < TriangleCount && bTriangleEmitted[ScanCursor])
+            {
+                ++ScanCursor;
+            }
+            assert(ScanCursor < TriangleCount);
+            BestTriangle = static_cast<int32>(ScanCursor);
+        }
+
+        const uint32 Tri = static_cast<uint32>(BestTriangle);
+        const uint32 TriVerts[3] = { SrcIndices[Tri * 3], SrcIndices[Tri * 3 + 1], SrcIndices[Tri * 3 + 2] };
+
+        OutIndices.push_back(TriVerts[0]);
+        OutIndices.push_back(TriVerts[1]);
+        OutIndices.push_back(TriVerts[2]);
+        bTriangleEmitted[Tri] = 1;
+
+        // 출력된 삼각형을 각 정점의 인접 목록에서 제거 (남은 목록 앞쪽으로 swap)
+        for (uint32 k = 0; k < 3; ++k)
+        {
+            const uint32 v = TriVerts[k];
+            uint32* Begin = Adjacency.data() + AdjacencyOffset[v];
+            uint32* End = Begin + RemainingValence[v];
+            uint32* Found = std::find(Begin, End, Tri);
+            if (Found != End)
+            {
+                std::swap(*Found, *(End - 1));
+                --RemainingValence[v];
+            }
+        }
+
+        // 새 캐시 = 방금 삼각형의 정점 3개 + 기존 캐시 (중복 제거)
+        int32 NewCacheCount = 0;
+        for (uint32 k = 0; k < 3; ++k)
+        {
+            NewCache[NewCacheCount++] = static_cast<int32>(TriVerts[k]);
+        }
+        for (int32 i = 0; i < CacheCount; ++i)
+        {
+            const int32 v = Cache[i];
+            if (v != static_cast<int32>(TriVerts[0]) && v != static_cast<int32>(TriVerts[1]) && v != static_cast<int32>(TriVerts[2]))
+            {
+                NewCache[NewCacheCount++] = v;
+            }
+        }
+
+        // 캐시에서 밀려난 정점은 위치 정보를 지우고 점수 갱신
+        for (int32 i = ForsythCacheSize; i < NewCacheCount; ++i)
+        {
+            const uint32 v = static_cast<uint32>(NewCache[i]);
+            CachePosition[v] = -1;
+            VertexScore[v] = ComputeVertexScore(-1, RemainingValence[v]);
+        }
+        CacheCount = std::min(NewCacheCount, ForsythCacheSize);
+        std::copy(NewCache, NewCache + CacheCount, Cache);
+
+        // 캐시 내 정점 점수 갱신
+        for (int32 i = 0; i < CacheCount; ++i)
+        {
+            const uint32 v = static_cast<uint32>(Cache[i]);
+            CachePosition[v] = i;
+            VertexScore[v] = ComputeVertexScore(i, RemainingValence[v]);
+        }
+
+        // 캐시 정점에 인접한 삼각형만 재평가하여 다음 후보 선택
+        BestTriangle = -1;
+        float BestScore = -1.0f;
+        for (int32 i = 0; i < CacheCount; ++i)
+        {
+            const uint32 v = static_cast<uint32>(Cache[i]);
+            const uint32* Begin = Adjacency.data() + AdjacencyOffset[v];
+            for (uint32 a = 0; a < RemainingValence[v]; ++a)
+            {
+                const uint32 Candidate = Begin[a];
+                const float Score = VertexScore[SrcIndices[Candidate * 3]] + VertexScore[SrcIndices[Candidate * 3 + 1]] + VertexScore[SrcIndices[Candidate * 3 + 2]];
+                TriangleScore[Candidate] = Score;
+
+                // 동점이면 작은 삼각형 번호 우선 (결정성)
+                if (Score > BestScore || (Score == BestScore && static_cast<int32>(Candidate) < BestTriangle))
+                {
+                    BestScore = Score;
+                    BestTriangle = static_cast<int32>(Candidate);
+                }
+            }
+        }
+    }
+
+    std::copy(OutIndices.begin(), OutIndices.end(), InOutIndices.begin() + InStart);
+}
+
+void FMeshOptimizer::OptimizeOverdraw(TArray<uint32>& InOutIndices, uint32 InStart, uint32 InCount, const TArray<FNormalVertex>& InVertices, float InThreshold)
+{
+    const uint32 TriangleCount = InCount / 3;
+    if (TriangleCount < 2)
+    {
+        return;
+    }
+
+    const uint32 VertexCount = static_cast<uint32>(InVertices.size());
+    const uint32* SrcIndices = InOutIndices.data() + InStart;
+    constexpr uint32 ClusterCacheSize = 16;
+
+    // 1) Hard boundary: 세 정점 모두 캐시 미스인 지점 (여기서 끊어도 캐시 효율 손실 없음)
+    TArray<uint32> HardClusters;
+    {
+        FVertexCacheSimulator Cache(VertexCount, ClusterCacheSize, EVertexCacheModel::FIFO);
+        for (uint32 Tri = 0; Tri < TriangleCount; ++Tri)
+        {
+            const uint32 Misses = Cache.AccessTriangle(SrcIndices[Tri * 3], SrcIndices[Tri * 3 + 1], SrcIndices[Tri * 3 + 2]);
+            if (Tri == 0 || Misses == 3)
+            {
+                HardClusters.push_back(Tri);
+            }
+        }
+    }
+
+    // 2) Soft boundary: hard 클러스터 내부에서도 누적 ACMR이 임계값 이하로 떨어지면 분할
+    TArray<uint32> Clusters;
+    {
+        FVertexCacheSimulator Cache(VertexCount, ClusterCacheSize, EVertexCacheModel::FIFO);
+        for (size_t c = 0; c < HardClusters.size(); ++c)
+        {
+            const uint32 Begin = HardClusters[c];
+            const uint32 End = (c + 1 < HardClusters.size()) ? HardClusters[c + 1] : TriangleCount;
+
+            Cache.Reset();
+            uint32 ClusterMisses = 0;
+            for (uint32 Tri = Begin; Tri < End; ++Tri)
+            {
+                ClusterMisses += Cache.AccessTriangle(SrcIndices[Tri * 3], SrcIndices[Tri * 3 + 1], SrcIndices[Tri * 3 + 2]);
+            }
+            const float ClusterThreshold = InThreshold * (static_cast<float>(ClusterMisses) / static_cast<float>(End - Begin));
+
+            Clusters.push_back(Begin);
+            Cache.Reset();
+            uint32 RunningMisses = 0;
+            uint32 RunningTriangles = 0;
+            for (uint32 Tri = Begin; Tri < End; ++Tri)
+            {
+                RunningMisses += Cache.AccessTriangle(SrcIndices[Tri * 3], SrcIndices[Tri * 3 + 1], SrcIndices[Tri * 3 + 2]);
+                ++RunningTriangles;
+
+                if (static_cast<float>(RunningMisses) / static_cast<float>(RunningTriangles) <= ClusterThreshold)
+                {
+                    Clusters.push_back(Tri + 1);
+                    Cache.Reset();
+                    RunningMisses = 0;
+                    RunningTriangles = 0;
+                }
+            }
+
+            // 마지막 삼각형에서 분할된 경우 빈 클러스터 제거
+            if (Clusters.back() == End)
+            {
+                Clusters.pop_back();
+            }
+        }
+    }
+
+    const uint32 ClusterCount = static_cast<uint32>(Clusters.size());
+    if (ClusterCount < 2)
+    {
+        return;
+    }
+
+    // 3) 섹션 중심 (면적 가중)
+    FVector MeshCentroid(0, 0, 0);
+    float MeshArea = 0.0f;
+    for (uint32 Tri = 0; Tri < TriangleCount; ++Tri)
+    {
+        const FVector& P0 = InVertices[SrcIndices[Tri * 3]].pos;
+        const FVector& P1 = InVertices[SrcIndices[Tri * 3 + 1]].pos;
+        const FVector& P2 = InVertices[SrcIndices[Tri * 3 + 2]].pos;
+        const float Area = FVector::Cross(P1 - P0, P2 - P0).Size();
+        MeshCentroid += (P0 + P1 + P2) * (Area / 3.0f);
+        MeshArea += Area;
+    }
+    if (MeshArea > 0.0f)
+    {
+        MeshCentroid /= MeshArea;
+    }
+
+    // 4) 클러스터별 정렬 키: (클러스터 중심 - 섹션 중심) · 클러스터 법선
+    //    바깥을 향하는 클러스터가 먼저 그려져 뒤쪽 면을 가리므로 오버드로우가 줄어듦
+    TArray<float> SortKeys(ClusterCount, 0.0f);
+    for (uint32 c = 0; c < ClusterCount; ++c)
+    {
+        const uint32 Begin = Clusters[c];
+        const uint32 End = (c + 1 < ClusterCount) ? Clusters[c + 1] : TriangleCount;
+
+        FVector Centroid(0, 0, 0);
+        FVector Normal(0, 0, 0);
+        float ClusterArea = 0.0f;
+        for (uint32 Tri = Begin; Tri < End; ++Tri)
+        {
+            const FVector& P0 = InVertices[SrcIndices[Tri * 3]].pos;
+            const FVector& P1 = InVertices[SrcIndices[Tri * 3 + 1]].pos;
+            const FVector& P2 = InVertices[SrcIndices[Tri * 3 + 2]].pos;
+            const FVector AreaNormal = FVector::Cross(P1 - P0, P2 - P0);
+            const float Area = AreaNormal.Size();
+            Centroid += (P0 + P1 + P2) * (Area / 3.0f);
+            Normal += AreaNormal;
+            ClusterArea += Area;
+        }
+        if (ClusterArea > 0.0f)
+        {
+            Centroid /= ClusterArea;
+        }
+        Normal.Normalize();
+
+        SortKeys[c] = FVector::Dot(Centroid - MeshCentroid, Normal);
+    }
+
+    TArray<uint32> Order(ClusterCount);
+    for (uint32 c = 0; c < ClusterCount; ++c)
+    {
+        Order[c] = c;
+    }
+    // stable_sort: 키가 같으면 기존(캐시 최적화된) 순서 유지 → 결정적 결과
+    std::stable_sort(Order.begin(), Order.end(), [&SortKeys](uint32 A, uint32 B) { return SortKeys[A] > SortKeys[B]; });
+
+    TArray<uint32> OutIndices;
+    OutIndices.reserve(TriangleCount * 3);
+    for (uint32 c : Order)
+    {
+        const uint32 Begin = Clusters[c];
+        const uint32 End = (c + 1 < ClusterCount) ? Clusters[c + 1] : TriangleCount;
+        OutIndices.insert(OutIndices.end(), SrcIndices + Begin * 3, SrcIndices + End * 3);
+    }
+
+    std::copy(OutIndices.begin(), OutIndices.end(), InOutIndices.begin() + InStart);
+}
+
+void FMeshOptimizer::OptimizeVertexFetch(TArray<FNormalVertex>& InOutVertices, TArray<uint32>& InOutIndices)
+{
+    constexpr uint32 Unassigned = 0xFFFFFFFFu;
+    TArray<uint32> Remap(InOutVertices.size(), Unassigned);
+
+    TArray<FNormalVertex> NewVertices;
+    NewVertices.reserve(InOutVertices.size());
+
+    for (uint32& Index : InOutIndices)
+    {
+        if (Remap[Index] == Unassigned)
+        {
+            Remap[Index] = static_cast<uint32>(NewVertices.size());
+            NewVertices.push_back(InOutVertices[Index]);
+        }
+        Index = Remap[Index];
+    }
+
+    InOutVertices = std::move(NewVertices);
+}
+
+FVertexCacheStats FMeshOptimizer::AnalyzeVertexCache(const TArray<uint32>& InIndices, uint32 InVertexCount, uint32 InCacheSize, EVertexCacheModel InModel)
+{
+    FVertexCacheStats Result;
+    const uint32 TriangleCount = static_cast<uint32>(InIndices.size() / 3);
+    if (TriangleCount == 0 || InVertexCount == 0)
+    {
+        return Result;
+    }
+
+    FVertexCacheSimulator Cache(InVertexCount, InCacheSize, InModel);
+    uint32 Transformed = 0;
+    for (uint32 Tri = 0; Tri < TriangleCount; ++Tri)
+    {
+        Transformed += Cache.AccessTriangle(InIndices[Tri * 3], InIndices[Tri * 3 + 1], InIndices[Tri * 3 + 2]);
+    }
+
+    Result.TransformedVertexCount = Transformed;
+    Result.ACMR = static_cast<float>(Transformed) / static_cast<float>(TriangleCount);
+    Result.ATVR = static_cast<float>(Transformed) / static_cast<float>(InVertexCount);
+    return Result;
+}
@@ -0,0 +1,46 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Enums.h"
+
+// 정점 캐시 시뮬레이션 모델
+enum class EVertexCacheModel : uint8
+{
+    FIFO,   // 고정 크기 FIFO (구형/모바일 GPU 근사)
+    LRU,    // 최근 사용 순서 유지 (Forsyth 가정)
+};
+
+struct FMeshOptimizationSettings
+{
+    bool bOptimizeVertexCache = true;    // 섹션별 Forsyth 삼각형 재정렬
+    bool bOptimizeOverdraw = true;       // 캐시 최적화 이후 클러스터 단위 오버드로우 정렬 (Tipsify)
+    bool bOptimizeVertexFetch = true;    // 첫 사용 순서로 정점 재배치
+
+    // 클러스터 분할 시 허용하는 ACMR 악화 비율 (1.0 = 캐시 효율 손실 없음)
+    float OverdrawThreshold = 1.05f;
+
+    // 리포트용 시뮬레이션 캐시 크기
+    uint32 ReportCacheSize = 16;
+};
+
+/**
+ * 스태틱 메시 임포트 단계의 인덱스/정점 순서 최적화.
+ * 모든 단계는 결정적(deterministic)이므로 같은 입력은 항상 같은 .bin 캐시를 만듭니다.
+ */
+struct FMeshOptimizer
+{
+public:
+    // 섹션(FGroupInfo) 단위로 재정렬 후 정점 순서를 갱신하고, 전/후 통계를 OutStaticMesh->OptimizationStats에 기록
+    static void OptimizeStaticMesh(FStaticMesh* InOutStaticMesh, const FMeshOptimizationSettings& InSettings = FMeshOptimizationSettings());
+
+    // Forsyth 알고리즘. [InStart, InStart + InCount) 인덱스 범위의 삼각형 순서만 바꿉니다.
+    static void OptimizeVertexCache(TArray<uint32>& InOutIndices, uint32 InStart, uint32 InCount, uint32 InVertexCount);
+
+    // Sander et al. (Tipsify) 방식 클러스터 분할 + 바깥을 향하는 클러스터 우선 정렬
+    static void OptimizeOverdraw(TArray<uint32>& InOutIndices, uint32 InStart, uint32 InCount, const TArray<FNormalVertex>& InVertices, float InThreshold);
+
+    // 인덱스 버퍼에서 처음 참조되는 순서로 정점을 재배치하고 인덱스를 리맵합니다. 참조되지 않는 정점은 제거됩니다.
+    static void OptimizeVertexFetch(TArray<FNormalVertex>& InOutVertices, TArray<uint32>& InOutIndices);
+
+    // 시뮬레이션 캐시로 ACMR/ATVR 측정 (GPU 불필요)
+    static FVertexCacheStats AnalyzeVertexCache(const TArray<uint32>& InIndices, uint32 InVertexCount, uint32 InCacheSize, EVertexCacheModel InModel);
+};
@@ -0,0 +1,176 @@
+﻿#include "pch.h"
+#include "MeshOptimizer.h"
+#include "SelfTest.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+
+namespace
+{
+    constexpr uint32 FloatsPerVertex = 16;
+    using FVertexKey = std::array<float, FloatsPerVertex>;
+    using FTriangleKey = std::array<float, FloatsPerVertex * 3>;
+
+    FVertexKey MakeVertexKey(const FNormalVertex& InVertex)
+    {
+        return {
+            InVertex.pos.X, InVertex.pos.Y, InVertex.pos.Z,
+            InVertex.normal.X, InVertex.normal.Y, InVertex.normal.Z,
+            InVertex.tex.X, InVertex.tex.Y,
+            InVertex.Tangent.X, InVertex.Tangent.Y, InVertex.Tangent.Z, InVertex.Tangent.W,
+            InVertex.color.X, InVertex.color.Y, InVertex.color.Z, InVertex.color.W };
+    }
+
+    // 섹션별로 "그려지는 삼각형" 목록 (정점 속성 그대로, 감기 순서를 유지한 채 시작 정점만 정규화해 정렬)
+    TArray<TArray<FTriangleKey>> CollectSectionTriangles(const FStaticMesh& InMesh)
+    {
+        TArray<TArray<FTriangleKey>> Sections;
+        for (const FGroupInfo& Group : InMesh.GroupInfos)
+        {
+            TArray<FTriangleKey> Triangles;
+            for (uint32 i = Group.StartIndex; i + 2 < Group.StartIndex + Group.IndexCount; i += 3)
+            {
+                const FVertexKey Corners[3] = {
+                    MakeVertexKey(InMesh.Vertices[InMesh.Indices[i]]),
+                    MakeVertexKey(InMesh.Vertices[InMesh.Indices[i + 1]]),
+                    MakeVertexKey(InMesh.Vertices[InMesh.Indices[i + 2]]) };
+
+                FTriangleKey Best{};
+                for (uint32 Rotation = 0; Rotation < 3; ++Rotation)
+                {
+                    FTriangleKey Key;
+                    for (uint32 Corner = 0; Corner < 3; ++Corner)
+                    {
+                        std::copy(Corners[(Corner + Rotation) % 3].begin(), Corners[(Corner + Rotation) % 3].end(), Key.begin() + Corner * FloatsPerVertex);
+                    }
+                    if (Rotation == 0 || Key < Best)
+                    {
+                        Best = Key;
+                    }
+                }
+                Triangles.Add(Best);
+            }
+            std::sort(Triangles.begin(), Triangles.end());
+            Sections.Add(Triangles);
+        }
+        return Sections;
+    }
+
+    // 삼각형 순서를 섞은 UV 구 (위/아래 반구를 서로 다른 섹션으로, 참조되지 않는 정점 1개 포함)
+    FStaticMesh MakeShuffledSphere(uint32 InRings, uint32 InSegments)
+    {
+        FStaticMesh Mesh;
+        Mesh.bHasMaterial = false;
+        const float Pi = 3.14159265f;
+        for (uint32 Ring = 0; Ring <= InRings; ++Ring)
+        {
+            const float Theta = Pi * Ring / InRings;
+            for (uint32 Segment = 0; Segment <= InSegments; ++Segment)
+            {
+                const float Phi = 2.0f * Pi * Segment / InSegments;
+                const FVector Normal(std::sin(Theta) * std::cos(Phi), std::sin(Theta) * std::sin(Phi), std::cos(Theta));
+
+                FNormalVertex Vertex{};
+                Vertex.pos = Normal * 10.0f;
+                Vertex.normal = Normal;
+                Vertex.tex = FVector2D(static_cast<float>(Segment) / InSegments, static_cast<float>(Ring) / InRings);
+                Vertex.Tangent = FVector4(-std::sin(Phi), std::cos(Phi), 0.0f, 1.0f);
+                Vertex.color = FVector4(Vertex.tex.X, Vertex.tex.Y, 0.5f, 1.0f);
+                Mesh.Vertices.Add(Vertex);
+            }
+        }
+
+        FNormalVertex Unused{};
+        Unused.pos = FVector(100.0f, 100.0f, 100.0f);
+        Mesh.Vertices.Add(Unused);
+
+        std::mt19937 Rng(26);
+        const uint32 Stride = InSegments + 1;
+        for (uint32 Half = 0; Half < 2; ++Half)
+        {
+            TArray<std::array<uint32, 3>> Triangles;
+            for (uint32 Ring = Half * InRings / 2; Ring < (Half + 1) * InRings / 2; ++Ring)
+            {
+                for (uint32 Segment = 0; Segment < InSegments; ++Segment)
+                {
+                    const uint32 A = Ring * Stride + Segment;
+                    const uint32 B = A + 1;
+                    const uint32 C = A + Stride;
+                    const uint32 D = C + 1;
+                    Triangles.Add({ A, C, B });
+                    Triangles.Add({ B, C, D });
+                }
+            }
+            std::shuffle(Triangles.begin(), Triangles.end(), Rng);
+
+            FGroupInfo Group;
+            Group.StartIndex = static_cast<uint32>(Mesh.Indices.size());
+            Group.IndexCount = static_cast<uint32>(Triangles.size() * 3);
+            for (const std::array<uint32, 3>& Triangle : Triangles)
+            {
+                Mesh.Indices.Add(Triangle[0]);
+                Mesh.Indices.Add(Triangle[1]);
+                Mesh.Indices.Add(Triangle[2]);
+            }
+            Mesh.GroupInfos.Add(Group);
+        }
+        return Mesh;
+    }
+}
+
+IMPLEMENT_SELF_TEST(MeshOptimizer, OptimizedMeshDrawsSameTriangles)
+{
+    const FStaticMesh Original = MakeShuffledSphere(12, 16);
+    FStaticMesh Optimized = Original;
+    FMeshOptimizer::OptimizeStaticMesh(&Optimized);
+
+    // 섹션 경계와 인덱스 수는 그대로, 정점은 참조되지 않는 1개만 빠짐
+    SELF_TEST_CHECK(Optimized.GroupInfos.Num() == Original.GroupInfos.Num());
+    for (int32 i = 0; i < Original.GroupInfos.Num(); ++i)
+    {
+        SELF_TEST_CHECK(Optimized.GroupInfos[i].StartIndex == Original.GroupInfos[i].StartIndex);
+        SELF_TEST_CHECK(Optimized.GroupInfos[i].IndexCount == Original.GroupInfos[i].IndexCount);
+    }
+    SELF_TEST_CHECK(Optimized.Indices.Num() == Original.Indices.Num());
+    SELF_TEST_CHECK(Optimized.Vertices.Num() + 1 == Original.Vertices.Num());
+
+    uint32 OutOfRange = 0;
+    for (uint32 Index : Optimized.Indices)
+    {
+        OutOfRange += (Index >= Optimized.Vertices.size()) ? 1 : 0;
+    }
+    SELF_TEST_CHECK(OutOfRange == 0);
+
+    // 각 섹션이 같은 정점 속성과 감기 순서를 가진 같은 삼각형들을 그리는지
+    if (OutOfRange == 0)
+    {
+        SELF_TEST_CHECK(CollectSectionTriangles(Optimized) == CollectSectionTriangles(Original));
+    }
+
+    // 순서가 실제로 바뀌었고 캐시 효율이 나빠지지 않았는지
+    SELF_TEST_CHECK(Optimized.Indices != Original.Indices);
+    const FMeshOptimizationStats& Stats = Optimized.OptimizationStats;
+    Test.AddInfo("ACMR FIFO %.3f -> %.3f, LRU %.3f -> %.3f", Stats.BeforeFIFO.ACMR, Stats.AfterFIFO.ACMR, Stats.BeforeLRU.ACMR, Stats.AfterLRU.ACMR);
+    SELF_TEST_CHECK(Stats.bOptimized);
+    SELF_TEST_CHECK(Stats.AfterLRU.ACMR < Stats.BeforeLRU.ACMR);
+    SELF_TEST_CHECK(Stats.AfterFIFO.ACMR < Stats.BeforeFIFO.ACMR);
+}
+
+IMPLEMENT_SELF_TEST(MeshOptimizer, OptimizationIsDeterministic)
+{
+    // 같은 입력은 항상 같은 .bin 캐시를 만들어야 함
+    FStaticMesh First = MakeShuffledSphere(12, 16);
+    FStaticMesh Second = MakeShuffledSphere(12, 16);
+    FMeshOptimizer::OptimizeStaticMesh(&First);
+    FMeshOptimizer::OptimizeStaticMesh(&Second);
+
+    SELF_TEST_CHECK(First.Indices == Second.Indices);
+    SELF_TEST_CHECK(First.Vertices.Num() == Second.Vertices.Num());
+    bool bSameVertices = First.Vertices.Num() == Second.Vertices.Num();
+    for (int32 i = 0; bSameVertices && i < First.Vertices.Num(); ++i)
+    {
+        bSameVertices = MakeVertexKey(First.Vertices[i]) == MakeVertexKey(Second.Vertices[i]);
+    }
+    SELF_TEST_CHECK(bSameVertices);
+}
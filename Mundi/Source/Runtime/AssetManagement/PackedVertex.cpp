@@ -0,0 +1,584 @@
+﻿#include "pch.h"
+#include "PackedVertex.h"
+#include "Shader.h"
+
+namespace
+{
+    constexpr float RadToDeg = 57.2957795130823208768f;
+
+    inline float ClampF(float V, float Lo, float Hi) { return V < Lo ? Lo : (V > Hi ? Hi : V); }
+
+    inline FVector SafeNormal(const FVector& V, const FVector& Fallback)
+    {
+        const float LenSq = V.X * V.X + V.Y * V.Y + V.Z * V.Z;
+        if (LenSq < 1e-12f)
+        {
+            return Fallback;
+        }
+        const float InvLen = 1.0f / std::sqrt(LenSq);
+        return FVector(V.X * InvLen, V.Y * InvLen, V.Z * InvLen);
+    }
+
+    // acos는 1 근처에서 float 해상도(~0.02도)가 부족하므로 atan2(|A x B|, A·B) 사용
+    inline float AngleDegrees(const FVector& A, const FVector& B)
+    {
+        const float CX = A.Y * B.Z - A.Z * B.Y;
+        const float CY = A.Z * B.X - A.X * B.Z;
+        const float CZ = A.X * B.Y - A.Y * B.X;
+        const float Dot = A.X * B.X + A.Y * B.Y + A.Z * B.Z;
+        return std::atan2(std::sqrt(CX * CX + CY * CY + CZ * CZ), Dot) * RadToDeg;
+    }
+
+    // 단위 벡터 → 옥타헤드럴 [-1, 1]^2
+    inline void OctWrap(const FVector& N, float& OutU, float& OutV)
+    {
+        const float InvL1 = 1.0f / (std::fabs(N.X) + std::fabs(N.Y) + std::fabs(N.Z));
+        float U = N.X * InvL1;
+        float V = N.Y * InvL1;
+        if (N.Z < 0.0f)
+        {
+            const float OldU = U;
+            U = (1.0f - std::fabs(V)) * (OldU >= 0.0f ? 1.0f : -1.0f);
+            V = (1.0f - std::fabs(OldU)) * (V >= 0.0f ? 1.0f : -1.0f);
+        }
+        OutU = U;
+        OutV = V;
+    }
+
+    // 옥타헤드럴 [-1, 1]^2 → 단위 벡터 (HLSL OctDecode와 동일)
+    inline FVector OctUnwrap(float U, float V)
+    {
+        FVector N(U, V, 1.0f - std::fabs(U) - std::fabs(V));
+        const float T = ClampF(-N.Z, 0.0f, 1.0f);
+        N.X += N.X >= 0.0f ? -T : T;
+        N.Y += N.Y >= 0.0f ? -T : T;
+        return SafeNormal(N, FVector(0.0f, 0.0f, 1.0f));
+    }
+
+    /**
+     * 양자화 격자에서 floor/ceil 4개 후보 중 디코드 오차가 가장 작은 것을 선택 (Cigolle et al. "precise" 변형).
+     * Quantize: [-1,1] → 정수 격자 좌표(실수), Dequantize: 정수 → [-1,1]
+     */
+    template<typename TQuantize, typename TDequantize>
+    inline void OctEncodePrecise(const FVector& InUnit, int32 InMin, int32 InMax, TQuantize Quantize, TDequantize Dequantize, int32& OutX, int32& OutY)
+    {
+        float U, V;
+        OctWrap(InUnit, U, V);
+
+        const float QU = Quantize(U);
+        const float QV = Quantize(V);
+        const int32 BaseX = static_cast<int32>(std::floor(QU));
+        const int32 BaseY = static_cast<int32>(std::floor(QV));
+
+        float BestDot = -2.0f;
+        OutX = std::clamp(BaseX, InMin, InMax);
+        OutY = std::clamp(BaseY, InMin, InMax);
+        for (int32 DY = 0; DY <= 1; ++DY)
+        {
+            for (int32 DX = 0; DX <= 1; ++DX)
+            {
+                const int32 CX = std::clamp(BaseX + DX, InMin, InMax);
+                const int32 CY = std::clamp(BaseY + DY, InMin, InMax);
+                const FVector Decoded = OctUnwrap(Dequantize(CX), Dequantize(CY));
+                const float Dot = Decoded.X * InUnit.X + Decoded.Y * InUnit.Y + Decoded.Z * InUnit.Z;
+                if (Dot > BestDot)
+                {
+                    BestDot = Dot;
+                    OutX = CX;
+                    OutY = CY;
+                }
+            }
+        }
+    }
+
+    // D3D SNORM16 디코드 규칙: max(c / 32767, -1)
+    inline float Snorm16ToFloat(int32 C) { return std::max(static_cast<float>(C) / 32767.0f, -1.0f); }
+    inline float FloatToSnorm16Grid(float V) { return ClampF(V, -1.0f, 1.0f) * 32767.0f; }
+
+    // 탄젠트: X = UNORM16, Y = 하위 15비트 UNORM15
+    inline float Unorm16ToSigned(int32 C) { return static_cast<float>(C) / 65535.0f * 2.0f - 1.0f; }
+    inline float SignedToUnorm16Grid(float V) { return (ClampF(V, -1.0f, 1.0f) * 0.5f + 0.5f) * 65535.0f; }
+    inline float Unorm15ToSigned(int32 C) { return static_cast<float>(C) / 32767.0f * 2.0f - 1.0f; }
+    inline float SignedToUnorm15Grid(float V) { return (ClampF(V, -1.0f, 1.0f) * 0.5f + 0.5f) * 32767.0f; }
+
+    inline uint16 QuantizeUnorm16(float InNormalized)
+    {
+        return static_cast<uint16>(std::lround(ClampF(InNormalized, 0.0f, 1.0f) * 65535.0f));
+    }
+
+    inline uint8 QuantizeUnorm8(float InValue)
+    {
+        return static_cast<uint8>(std::lround(ClampF(InValue, 0.0f, 1.0f) * 255.0f));
+    }
+
+    inline bool IsWhite(const FVector4& C)
+    {
+        return C.X >= 1.0f && C.Y >= 1.0f && C.Z >= 1.0f && C.W >= 1.0f;
+    }
+
+    template<typename T>
+    inline void WriteRaw(uint8* Dst, const T& Value) { memcpy(Dst, &Value, sizeof(T)); }
+}
+
+// ─────────────────────────────
+// FPackedVertexFormat
+// ─────────────────────────────
+uint8 FPackedVertexFormat::GetFlags() const
+{
+    uint8 Flags = PVF_Packed;
+    if (bQuantizedPosition) { Flags |= PVF_QuantizedPosition; }
+    if (bHasVertexColor) { Flags |= PVF_VertexColor; }
+    return Flags;
+}
+
+FPackedVertexFormat FPackedVertexFormat::FromFlags(uint8 InFlags)
+{
+    FPackedVertexFormat Format;
+    Format.bQuantizedPosition = (InFlags & PVF_QuantizedPosition) != 0;
+    Format.bHasVertexColor = (InFlags & PVF_VertexColor) != 0;
+    return Format;
+}
+
+uint32 FPackedVertexFormat::GetStride() const
+{
+    return GetColorOffset() + (bHasVertexColor ? 4 : 0);
+}
+
+TArray<D3D11_INPUT_ELEMENT_DESC> FPackedVertexFormat::GetInputLayout() const
+{
+    TArray<D3D11_INPUT_ELEMENT_DESC> Layout;
+    Layout.Add({ "POSITION", 0, bQuantizedPosition ? DXGI_FORMAT_R16G16B16A16_UNORM : DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    Layout.Add({ "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0, GetNormalOffset(), D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    Layout.Add({ "TANGENT", 0, DXGI_FORMAT_R16G16_UINT, 0, GetTangentOffset(), D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    Layout.Add({ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, GetTexCoordOffset(), D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    if (bHasVertexColor)
+    {
+        Layout.Add({ "COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, GetColorOffset(), D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    }
+    return Layout;
+}
+
+void FPackedVertexFormat::AppendShaderMacros(TArray<FShaderMacro>& InOutMacros) const
+{
+    InOutMacros.Add(FShaderMacro{ "PACKED_VERTEX", "1" });
+    if (bQuantizedPosition)
+    {
+        InOutMacros.Add(FShaderMacro{ "PACKED_POSITION_QUANTIZED", "1" });
+    }
+    if (bHasVertexColor)
+    {
+        InOutMacros.Add(FShaderMacro{ "PACKED_VERTEX_COLOR", "1" });
+    }
+}
+
+bool FPackedVertexFormat::FromShaderMacros(const TArray<FShaderMacro>& InMacros, FPackedVertexFormat& OutFormat)
+{
+    bool bPacked = false;
+    OutFormat = FPackedVertexFormat();
+    OutFormat.bQuantizedPosition = false;
+    for (const FShaderMacro& Macro : InMacros)
+    {
+        if (Macro.Name == "PACKED_VERTEX") { bPacked = true; }
+        else if (Macro.Name == "PACKED_POSITION_QUANTIZED") { OutFormat.bQuantizedPosition = true; }
+        else if (Macro.Name == "PACKED_VERTEX_COLOR") { OutFormat.bHasVertexColor = true; }
+    }
+    return bPacked;
+}
+
+// ─────────────────────────────
+// 스칼라 인코딩
+// ─────────────────────────────
+
+// float32 → float16, round-to-nearest-even (F. Giesen, float_to_half_fast3_rtne)
+uint16 FPackedVertexCodec::FloatToHalf(float InValue)
+{
+    uint32 F;
+    memcpy(&F, &InValue, sizeof(F));
+
+    const uint32 Sign = F & 0x80000000u;
+    F ^= Sign;
+
+    uint16 Out;
+    if (F >= 0x47800000u) // 65536 이상 → Inf, NaN은 quiet NaN
+    {
+        Out = (F > 0x7F800000u) ? 0x7E00 : 0x7C00;
+    }
+    else if (F < 0x38800000u) // half 정규화 범위 미만 → 비정규화/0
+    {
+        // 매직 상수를 더해 FPU의 RTNE 반올림으로 가수 비트를 정렬
+        float Magic;
+        const uint32 DenormMagic = ((127 - 15) + (23 - 10) + 1) << 23;
+        memcpy(&Magic, &DenormMagic, sizeof(Magic));
+        float Fv;
+        memcpy(&Fv, &F, sizeof(Fv));
+        Fv += Magic;
+        uint32 Bits;
+        memcpy(&Bits, &Fv, sizeof(Bits));
+        Out = static_cast<uint16>(Bits - DenormMagic);
+    }
+    else
+    {
+        const uint32 MantOdd = (F >> 13) & 1;
+        F += (static_cast<uint32>(15 - 127) << 23) + 0xFFF;
+        F += MantOdd;
+        Out = static_cast<uint16>(F >> 13);
+    }
+    return static_cast<uint16>(Out | (Sign >> 16));
+}
+
+float FPackedVertexCodec::HalfToFloat(uint16 InHalf)
+{
+    const uint32 Sign = static_cast<uint32>(InHalf & 0x8000) << 16;
+    const uint32 Exp = (InHalf >> 10) & 0x1F;
+    const uint32 Mant = InHalf & 0x3FF;
+
+    uint32 Bits;
+    if (Exp == 0)
+    {
+        // 비정규화: mant * 2^-24
+        const float Value = static_cast<float>(Mant) * (1.0f / 16777216.0f);
+        memcpy(&Bits, &Value, sizeof(Bits));
+        Bits |= Sign;
+    }
+    else if (Exp == 31)
+    {
+        Bits = Sign | 0x7F800000u | (Mant << 13);
+    }
+    else
+    {
+        Bits = Sign | ((Exp + (127 - 15)) << 23) | (Mant << 13);
+    }
+
+    float Out;
+    memcpy(&Out, &Bits, sizeof(Out));
+    return Out;
+}
+
+void FPackedVertexCodec::EncodeOctahedralSnorm16(const FVector& InUnitVector, int16 OutXY[2])
+{
+    const FVector N = SafeNormal(InUnitVector, FVector(0.0f, 0.0f, 1.0f));
+    int32 X, Y;
+    OctEncodePrecise(N, -32767, 32767, FloatToSnorm16Grid, Snorm16ToFloat, X, Y);
+    OutXY[0] = static_cast<int16>(X);
+    OutXY[1] = static_cast<int16>(Y);
+}
+
+FVector FPackedVertexCodec::DecodeOctahedralSnorm16(const int16 InXY[2])
+{
+    return OctUnwrap(Snorm16ToFloat(InXY[0]), Snorm16ToFloat(InXY[1]));
+}
+
+void FPackedVertexCodec::EncodeTangent(const FVector4& InTangent, uint16 OutXY[2])
+{
+    const FVector T = SafeNormal(FVector(InTangent.X, InTangent.Y, InTangent.Z), FVector(1.0f, 0.0f, 0.0f));
+
+    float U, V;
+    OctWrap(T, U, V);
+
+    // X(16비트)와 Y(15비트)의 격자가 달라 축별로 후보를 만듭니다.
+    const int32 BaseX = static_cast<int32>(std::floor(SignedToUnorm16Grid(U)));
+    const int32 BaseY = static_cast<int32>(std::floor(SignedToUnorm15Grid(V)));
+
+    float BestDot = -2.0f;
+    int32 BestX = std::clamp(BaseX, 0, 65535);
+    int32 BestY = std::clamp(BaseY, 0, 32767);
+    for (int32 DY = 0; DY <= 1; ++DY)
+    {
+        for (int32 DX = 0; DX <= 1; ++DX)
+        {
+            const int32 CX = std::clamp(BaseX + DX, 0, 65535);
+            const int32 CY = std::clamp(BaseY + DY, 0, 32767);
+            const FVector Decoded = OctUnwrap(Unorm16ToSigned(CX), Unorm15ToSigned(CY));
+            const float Dot = Decoded.X * T.X + Decoded.Y * T.Y + Decoded.Z * T.Z;
+            if (Dot > BestDot)
+            {
+                BestDot = Dot;
+                BestX = CX;
+                BestY = CY;
+            }
+        }
+    }
+
+    OutXY[0] = static_cast<uint16>(BestX);
+    OutXY[1] = static_cast<uint16>(BestY | (InTangent.W < 0.0f ? 0x8000 : 0));
+}
+
+FVector4 FPackedVertexCodec::DecodeTangent(const uint16 InXY[2])
+{
+    const FVector T = OctUnwrap(Unorm16ToSigned(InXY[0]), Unorm15ToSigned(InXY[1] & 0x7FFF));
+    const float Sign = (InXY[1] & 0x8000) ? -1.0f : 1.0f;
+    return FVector4(T.X, T.Y, T.Z, Sign);
+}
+
+// ─────────────────────────────
+// 정점 배열 인코딩/디코딩
+// ─────────────────────────────
+FPackedVertexFormat FPackedVertexCodec::ChooseFormat(const TArray<FNormalVertex>& InVertices, bool bInQuantizePosition)
+{
+    FPackedVertexFormat Format;
+    Format.bQuantizedPosition = bInQuantizePosition;
+    Format.bHasVertexColor = false;
+    for (const FNormalVertex& Vertex : InVertices)
+    {
+        if (!IsWhite(Vertex.color))
+        {
+            Format.bHasVertexColor = true;
+            break;
+        }
+    }
+    return Format;
+}
+
+void FPackedVertexCodec::Encode(const TArray<FNormalVertex>& InVertices, const FPackedVertexFormat& InFormat, FPackedVertexBuffer& OutBuffer)
+{
+    const uint32 Stride = InFormat.GetStride();
+    const uint32 VertexCount = static_cast<uint32>(InVertices.Num());
+
+    OutBuffer.Format = InFormat;
+    OutBuffer.VertexCount = VertexCount;
+    OutBuffer.Data.clear();
+    OutBuffer.Data.resize(static_cast<size_t>(Stride) * VertexCount);
+    OutBuffer.PositionDequantScale = FVector4(1.0f, 1.0f, 1.0f, 0.0f);
+    OutBuffer.PositionDequantBias = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
+
+    if (VertexCount == 0)
+    {
+        return;
+    }
+
+    // 위치 양자화 범위 = 메시 AABB
+    FVector Min = InVertices[0].pos;
+    FVector Max = InVertices[0].pos;
+    for (const FNormalVertex& Vertex : InVertices)
+    {
+        Min = Min.ComponentMin(Vertex.pos);
+        Max = Max.ComponentMax(Vertex.pos);
+    }
+    const FVector Extent = Max - Min;
+    const FVector InvExtent(
+        Extent.X > 0.0f ? 1.0f / Extent.X : 0.0f,
+        Extent.Y > 0.0f ? 1.0f / Extent.Y : 0.0f,
+        Extent.Z > 0.0f ? 1.0f / Extent.Z : 0.0f);
+
+    if (InFormat.bQuantizedPosition)
+    {
+        OutBuffer.PositionDequantScale = FVector4(Extent.X, Extent.Y, Extent.Z, 0.0f);
+        OutBuffer.PositionDequantBias = FVector4(Min.X, Min.Y, Min.Z, 0.0f);
+    }
+
+    uint8* Dst = OutBuffer.Data.data();
+    for (const FNormalVertex& Vertex : InVertices)
+    {
+        if (InFormat.bQuantizedPosition)
+        {
+            const uint16 Q[4] = {
+                QuantizeUnorm16((Vertex.pos.X - Min.X) * InvExtent.X),
+                QuantizeUnorm16((Vertex.pos.Y - Min.Y) * InvExtent.Y),
+                QuantizeUnorm16((Vertex.pos.Z - Min.Z) * InvExtent.Z),
+                0 };
+            WriteRaw(Dst, Q);
+        }
+        else
+        {
+            const float P[3] = { Vertex.pos.X, Vertex.pos.Y, Vertex.pos.Z };
+            WriteRaw(Dst, P);
+        }
+
+        int16 Normal[2];
+        EncodeOctahedralSnorm16(Vertex.normal, Normal);
+        WriteRaw(Dst + InFormat.GetNormalOffset(), Normal);
+
+        uint16 Tangent[2];
+        EncodeTangent(Vertex.Tangent, Tangent);
+        WriteRaw(Dst + InFormat.GetTangentOffset(), Tangent);
+
+        const uint16 UV[2] = { FloatToHalf(Vertex.tex.X), FloatToHalf(Vertex.tex.Y) };
+        WriteRaw(Dst + InFormat.GetTexCoordOffset(), UV);
+
+        if (InFormat.bHasVertexColor)
+        {
+            const uint8 C[4] = {
+                QuantizeUnorm8(Vertex.color.X), QuantizeUnorm8(Vertex.color.Y),
+                QuantizeUnorm8(Vertex.color.Z), QuantizeUnorm8(Vertex.color.W) };
+            WriteRaw(Dst + InFormat.GetColorOffset(), C);
+        }
+
+        Dst += Stride;
+    }
+}
+
+void FPackedVertexCodec::Decode(const FPackedVertexBuffer& InBuffer, TArray<FNormalVertex>& OutVertices)
+{
+    const FPackedVertexFormat& Format = InBuffer.Format;
+    const uint32 Stride = Format.GetStride();
+
+    OutVertices.clear();
+    OutVertices.resize(InBuffer.VertexCount);
+
+    const uint8* Src = InBuffer.Data.data();
+    for (uint32 i = 0; i < InBuffer.VertexCount; ++i, Src += Stride)
+    {
+        FNormalVertex& Vertex = OutVertices[i];
+
+        if (Format.bQuantizedPosition)
+        {
+            uint16 Raw[4];
+            memcpy(Raw, Src, sizeof(Raw));
+            Vertex.pos = FVector(
+                static_cast<float>(Raw[0]) / 65535.0f * InBuffer.PositionDequantScale.X + InBuffer.PositionDequantBias.X,
+                static_cast<float>(Raw[1]) / 65535.0f * InBuffer.PositionDequantScale.Y + InBuffer.PositionDequantBias.Y,
+                static_cast<float>(Raw[2]) / 65535.0f * InBuffer.PositionDequantScale.Z + InBuffer.PositionDequantBias.Z);
+        }
+        else
+        {
+            float P[3];
+            memcpy(P, Src, sizeof(P));
+            Vertex.pos = FVector(P[0], P[1], P[2]);
+        }
+
+        int16 Normal[2];
+        memcpy(Normal, Src + Format.GetNormalOffset(), sizeof(Normal));
+        Vertex.normal = DecodeOctahedralSnorm16(Normal);
+
+        uint16 Tangent[2];
+        memcpy(Tangent, Src + Format.GetTangentOffset(), sizeof(Tangent));
+        Vertex.Tangent = DecodeTangent(Tangent);
+
+        uint16 UV[2];
+        memcpy(UV, Src + Format.GetTexCoordOffset(), sizeof(UV));
+        Vertex.tex = FVector2D(HalfToFloat(UV[0]), HalfToFloat(UV[1]));
+
+        if (Format.bHasVertexColor)
+        {
+            uint8 C[4];
+            memcpy(C, Src + Format.GetColorOffset(), sizeof(C));
+            Vertex.color = FVector4(C[0] / 255.0f, C[1] / 255.0f, C[2] / 255.0f, C[3] / 255.0f);
+        }
+        else
+        {
+            Vertex.color = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+        }
+    }
+}
+
+FPackedVertexErrorStats FPackedVertexCodec::Verify(const TArray<FNormalVertex>& InVertices, const FPackedVertexBuffer& InBuffer, const FPackedVertexTolerance& InTolerance)
+{
+    FPackedVertexErrorStats Stats;
+    if (InBuffer.VertexCount != static_cast<uint32>(InVertices.Num()))
+    {
+        Stats.bWithinTolerance = false;
+        return Stats;
+    }
+
+    TArray<FNormalVertex> Decoded;
+    Decode(InBuffer, Decoded);
+
+    // 축별 양자화 스텝 (float 위치면 비교 기준은 0 오차)
+    const FPackedVertexFormat& Format = InBuffer.Format;
+    const float Step[3] = {
+        InBuffer.PositionDequantScale.X / 65535.0f,
+        InBuffer.PositionDequantScale.Y / 65535.0f,
+        InBuffer.PositionDequantScale.Z / 65535.0f };
+    const float Bias[3] = { InBuffer.PositionDequantBias.X, InBuffer.PositionDequantBias.Y, InBuffer.PositionDequantBias.Z };
+
+    for (int32 i = 0; i < InVertices.Num(); ++i)
+    {
+        const FNormalVertex& Src = InVertices[i];
+        const FNormalVertex& Dst = Decoded[i];
+
+        // 위치: 축별 |오차| ≤ Step * Scale (+ float 연산 오차)
+        const float PosSrc[3] = { Src.pos.X, Src.pos.Y, Src.pos.Z };
+        const float PosDst[3] = { Dst.pos.X, Dst.pos.Y, Dst.pos.Z };
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            const float Error = std::fabs(PosSrc[Axis] - PosDst[Axis]);
+            // 역양자화(q / 65535 * Scale + Bias) 자체의 float 반올림 오차
+            const float Ulp = (std::fabs(PosSrc[Axis]) + std::fabs(Bias[Axis]) + Step[Axis] * 65535.0f) * 8.0f * std::numeric_limits<float>::epsilon();
+            Stats.MaxPositionError = std::max(Stats.MaxPositionError, Error);
+            if (Format.bQuantizedPosition && Step[Axis] > 0.0f)
+            {
+                Stats.MaxPositionErrorInSteps = std::max(Stats.MaxPositionErrorInSteps, Error / Step[Axis]);
+            }
+            const float Allowed = (Format.bQuantizedPosition ? Step[Axis] * InTolerance.PositionStepScale : 0.0f) + Ulp;
+            if (Error > Allowed)
+            {
+                Stats.bWithinTolerance = false;
+            }
+        }
+
+        // 노멀/탄젠트: 정규화된 원본과의 각도 (길이 0 입력은 비교하지 않음)
+        const float NormalLenSq = Src.normal.X * Src.normal.X + Src.normal.Y * Src.normal.Y + Src.normal.Z * Src.normal.Z;
+        if (NormalLenSq > 1e-12f)
+        {
+            const float Degrees = AngleDegrees(SafeNormal(Src.normal, FVector(0, 0, 1)), Dst.normal);
+            Stats.MaxNormalDegrees = std::max(Stats.MaxNormalDegrees, Degrees);
+        }
+
+        const FVector SrcTangent(Src.Tangent.X, Src.Tangent.Y, Src.Tangent.Z);
+        const float TangentLenSq = SrcTangent.X * SrcTangent.X + SrcTangent.Y * SrcTangent.Y + SrcTangent.Z * SrcTangent.Z;
+        if (TangentLenSq > 1e-12f)
+        {
+            const float Degrees = AngleDegrees(SafeNormal(SrcTangent, FVector(1, 0, 0)), FVector(Dst.Tangent.X, Dst.Tangent.Y, Dst.Tangent.Z));
+            Stats.MaxTangentDegrees = std::max(Stats.MaxTangentDegrees, Degrees);
+        }
+        if ((Src.Tangent.W < 0.0f) != (Dst.Tangent.W < 0.0f))
+        {
+            ++Stats.TangentSignMismatches;
+        }
+
+        // UV: 절대 허용치, 단 |uv| ≥ 2 (타일링)는 half 상대 정밀도(2^-11) 기준
+        const float UVSrc[2] = { Src.tex.X, Src.tex.Y };
+        const float UVDst[2] = { Dst.tex.X, Dst.tex.Y };
+        for (int32 Axis = 0; Axis < 2; ++Axis)
+        {
+            const float Error = std::fabs(UVSrc[Axis] - UVDst[Axis]);
+            Stats.MaxTexCoordError = std::max(Stats.MaxTexCoordError, Error);
+            const float Allowed = std::max(InTolerance.TexCoord, std::fabs(UVSrc[Axis]) * (1.0f / 2048.0f));
+            if (!(Error <= Allowed))
+            {
+                Stats.bWithinTolerance = false;
+            }
+        }
+
+        // 색상: 색상 스트림을 생략했다면 원본이 흰색이어야 함
+        const float ColSrc[4] = { Src.color.X, Src.color.Y, Src.color.Z, Src.color.W };
+        const float ColDst[4] = { Dst.color.X, Dst.color.Y, Dst.color.Z, Dst.color.W };
+        for (int32 Channel = 0; Channel < 4; ++Channel)
+        {
+            const float Error = std::fabs(ColSrc[Channel] - ColDst[Channel]);
+            Stats.MaxColorError = std::max(Stats.MaxColorError, Error);
+        }
+    }
+
+    if (Stats.MaxNormalDegrees > InTolerance.NormalDegrees ||
+        Stats.MaxTangentDegrees > InTolerance.TangentDegrees ||
+        Stats.MaxColorError > InTolerance.Color ||
+        Stats.TangentSignMismatches > 0)
+    {
+        Stats.bWithinTolerance = false;
+    }
+
+    return Stats;
+}
+
+FVertexMemoryReport FPackedVertexCodec::BuildMemoryReport(const FStaticMesh& InStaticMesh, const FPackedVertexFormat& InFormat)
+{
+    FVertexMemoryReport Report;
+    Report.VertexCount = static_cast<uint32>(InStaticMesh.Vertices.Num());
+    Report.IndexCount = static_cast<uint32>(InStaticMesh.Indices.Num());
+    Report.FullStride = sizeof(FVertexDynamic);
+    Report.PackedStride = InFormat.GetStride();
+
+    Report.FullVertexBytes = static_cast<uint64>(Report.FullStride) * Report.VertexCount;
+    Report.PackedVertexBytes = static_cast<uint64>(Report.PackedStride) * Report.VertexCount;
+    Report.IndexBytes = sizeof(uint32) * static_cast<uint64>(Report.IndexCount);
+
+    // 임포트 시 시뮬레이션한 FIFO 캐시 미스 정점 수를 페치 횟수로 사용 (통계가 없으면 인덱스 수)
+    const uint64 FetchedVertices = InStaticMesh.OptimizationStats.bOptimized
+        ? InStaticMesh.OptimizationStats.AfterFIFO.TransformedVertexCount
+        : Report.IndexCount;
+    Report.FullFetchBytesPerDraw = FetchedVertices * Report.FullStride + Report.IndexBytes;
+    Report.PackedFetchBytesPerDraw = FetchedVertices * Report.PackedStride + Report.IndexBytes;
+
+    return Report;
+}
@@ -0,0 +1,127 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Vector.h"
+#include "Enums.h"
+
+struct FShaderMacro;
+
+// 패킹된 정점 포맷 비트 마스크. FMeshBatchElement 및 셰이더 Variant 선택에 사용 (0 = FVertexDynamic)
+enum EPackedVertexFlags : uint8
+{
+    PVF_None = 0,
+    PVF_Packed = 1 << 0,                // 패킹 레이아웃 사용
+    PVF_QuantizedPosition = 1 << 1,     // 위치: 메시 바운드 기준 UNORM16x4 (아니면 float3)
+    PVF_VertexColor = 1 << 2,           // 정점 색상: RGBA8 UNORM (아니면 생략, 셰이더에서 흰색)
+};
+
+/**
+ * 스태틱 메시 압축 정점 레이아웃
+ *
+ *   Position  : R32G32B32_FLOAT (12B) 또는 R16G16B16A16_UNORM (8B, 바운드 기준 역양자화)
+ *   Normal    : R16G16_SNORM   (4B, 옥타헤드럴)
+ *   Tangent   : R16G16_UINT    (4B, 옥타헤드럴 16+15비트, y 최상위 비트 = 바이탱전트 부호)
+ *   TexCoord  : R16G16_FLOAT   (4B, half)
+ *   Color     : R8G8B8A8_UNORM (4B, 선택)
+ *
+ * FNormalVertex(64B) 대비 20~28B.
+ */
+struct FPackedVertexFormat
+{
+    bool bQuantizedPosition = true;
+    bool bHasVertexColor = false;
+
+    uint8 GetFlags() const;
+    static FPackedVertexFormat FromFlags(uint8 InFlags);
+
+    // PACKED_VERTEX 매크로가 있으면 true (UShader가 InputLayout 선택에 사용)
+    static bool FromShaderMacros(const TArray<FShaderMacro>& InMacros, FPackedVertexFormat& OutFormat);
+
+    uint32 GetStride() const;
+    uint32 GetNormalOffset() const { return bQuantizedPosition ? 8 : 12; }
+    uint32 GetTangentOffset() const { return GetNormalOffset() + 4; }
+    uint32 GetTexCoordOffset() const { return GetNormalOffset() + 8; }
+    uint32 GetColorOffset() const { return GetNormalOffset() + 12; }
+
+    TArray<D3D11_INPUT_ELEMENT_DESC> GetInputLayout() const;
+    void AppendShaderMacros(TArray<FShaderMacro>& InOutMacros) const;
+};
+
+// 인코딩 결과. Data는 GPU 정점 버퍼에 그대로 업로드 가능
+struct FPackedVertexBuffer
+{
+    FPackedVertexFormat Format;
+    uint32 VertexCount = 0;
+    TArray<uint8> Data;
+
+    // 로컬 위치 = UNORM 값 * Scale + Bias (float 위치면 Scale = 1, Bias = 0)
+    FVector4 PositionDequantScale = FVector4(1.0f, 1.0f, 1.0f, 0.0f);
+    FVector4 PositionDequantBias = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
+};
+
+// 디코드 결과와 원본의 최대 오차 허용치
+struct FPackedVertexTolerance
+{
+    float PositionStepScale = 0.5f + 1e-3f;  // 양자화 스텝(축별 범위/65535) 대비 허용 배수
+    float NormalDegrees = 0.05f;
+    float TangentDegrees = 0.1f;
+    float TexCoord = 1.0f / 1024.0f;         // 1024 텍스처의 한 텍셀
+    float Color = 0.5f / 255.0f + 1e-4f;
+};
+
+struct FPackedVertexErrorStats
+{
+    float MaxPositionError = 0.0f;      // 절대 오차 (로컬 단위)
+    float MaxPositionErrorInSteps = 0.0f;
+    float MaxNormalDegrees = 0.0f;
+    float MaxTangentDegrees = 0.0f;
+    float MaxTexCoordError = 0.0f;
+    float MaxColorError = 0.0f;
+    uint32 TangentSignMismatches = 0;
+    bool bWithinTolerance = true;
+};
+
+// 메시 단위 메모리/대역폭 리포트
+struct FVertexMemoryReport
+{
+    uint32 VertexCount = 0;
+    uint32 IndexCount = 0;
+    uint32 FullStride = 0;
+    uint32 PackedStride = 0;
+
+    uint64 FullVertexBytes = 0;
+    uint64 PackedVertexBytes = 0;
+    uint64 IndexBytes = 0;
+
+    // 드로우 1회당 정점 페치량 추정 (시뮬레이션 캐시 미스 정점 수 × stride)
+    uint64 FullFetchBytesPerDraw = 0;
+    uint64 PackedFetchBytesPerDraw = 0;
+
+    float GetVertexCompressionRatio() const { return PackedVertexBytes > 0 ? static_cast<float>(FullVertexBytes) / static_cast<float>(PackedVertexBytes) : 1.0f; }
+};
+
+struct FPackedVertexCodec
+{
+public:
+    // 원본 정점에서 적절한 포맷 선택 (정점 색상이 모두 흰색이면 색상 스트림 생략)
+    static FPackedVertexFormat ChooseFormat(const TArray<FNormalVertex>& InVertices, bool bInQuantizePosition = true);
+
+    static void Encode(const TArray<FNormalVertex>& InVertices, const FPackedVertexFormat& InFormat, FPackedVertexBuffer& OutBuffer);
+    static void Decode(const FPackedVertexBuffer& InBuffer, TArray<FNormalVertex>& OutVertices);
+
+    // Encode → Decode 왕복 후 원본과 비교
+    static FPackedVertexErrorStats Verify(const TArray<FNormalVertex>& InVertices, const FPackedVertexBuffer& InBuffer, const FPackedVertexTolerance& InTolerance = FPackedVertexTolerance());
+
+    static FVertexMemoryReport BuildMemoryReport(const FStaticMesh& InStaticMesh, const FPackedVertexFormat& InFormat);
+
+    // ─────────────────────────────
+    // 개별 인코딩 유틸 (HLSL 디코드와 1:1 대응)
+    // ─────────────────────────────
+    static uint16 FloatToHalf(float InValue);
+    static float HalfToFloat(uint16 InHalf);
+
+    static void EncodeOctahedralSnorm16(const FVector& InUnitVector, int16 OutXY[2]);
+    static FVector DecodeOctahedralSnorm16(const int16 InXY[2]);
+
+    static void EncodeTangent(const FVector4& InTangent, uint16 OutXY[2]);
+    static FVector4 DecodeTangent(const uint16 InXY[2]);
+};
@@ -6,6 +6,7 @@
 #include "ObjManager.h"
 #include "Quad.h"
 #include "MeshBVH.h"
+#include "FileChangeService.h"
 #include "Enums.h"
 #include <filesystem>
 #include <cwctype>
@@ -419,11 +420,58 @@ void UResourceManager::CreateBoxWireframeMesh(const FVector& Min, const FVector&
 
 void UResourceManager::CreateDefaultShader()
 {
-    // 템플릿 Load 멤버함수 호출해서 Resources[UShader의 typeIndex][shader 파일 이름]에 UShader 포인터 할당
-    Load<UShader>("Shaders/Primitives/Primitive.hlsl");
-    Load<UShader>("Shaders/UI/Gizmo.hlsl");
-    Load<UShader>("Shaders/UI/TextBillboard.hlsl");
-    Load<UShader>("Shaders/UI/Billboard.hlsl");
+    // Resources[UShader의 typeIndex][shader 파일 이름]에 UShader 포인터 할당
+    // 첫 프레임에 쓰이는 셰이더까지 한 배치로 미리 컴파일 (캐시 미스만 병렬 컴파일, 이후 Load<UShader>는 맵에서 바로 반환)
+    TArray<TPair<FString, TArray<FShaderMacro>>> ShaderVariants;
+    auto AddVariant = [&ShaderVariants](const FString& InPath, const char* InMacroName = nullptr)
+    {
+        TArray<FShaderMacro> Macros;
+        if (InMacroName)
+        {
+            Macros.push_back(FShaderMacro{ InMacroName, "1" });
+        }
+        ShaderVariants.emplace_back(InPath, std::move(Macros));
+    };
+
+    AddVariant("Shaders/Primitives/Primitive.hlsl");
+    AddVariant("Shaders/UI/Gizmo.hlsl");
+    AddVariant("Shaders/UI/TextBillboard.hlsl");
+    AddVariant("Shaders/UI/Billboard.hlsl");
+    AddVariant("Shaders/UI/SpriteBatch.hlsl");
+    AddVariant("Shaders/UI/ShaderLine.hlsl");
+    AddVariant("Shaders/Materials/UberLit.hlsl", "LIGHTING_MODEL_PHONG");
+    AddVariant("Shaders/Materials/ShadowDepth.hlsl");
+    AddVariant("Shaders/Utility/FullScreenTriangle_VS.hlsl");
+    AddVariant("Shaders/Utility/Blit_PS.hlsl");
+    AddVariant("Shaders/Utility/SceneDepth_PS.hlsl");
+    AddVariant("Shaders/PostProcess/FXAA_PS.hlsl");
+    AddVariant("Shaders/PostProcess/HeightFog_PS.hlsl");
+    PrecompileShaders(ShaderVariants);
+}
+
+void UResourceManager::PrecompileShaders(const TArray<TPair<FString, TArray<FShaderMacro>>>& InShaderVariants)
+{
+    uint8 ShaderTypeIndex = static_cast<uint8>(ResourceType::Shader);
+
+    TArray<TPair<UShader*, TArray<FShaderMacro>>> Requests;
+    Requests.reserve(InShaderVariants.size());
+    for (const TPair<FString, TArray<FShaderMacro>>& Variant : InShaderVariants)
+    {
+        FString NormalizedPath = NormalizePath(Variant.first);
+        UShader* Shader = Get<UShader>(NormalizedPath);
+        if (!Shader)
+        {
+            // Load<UShader>와 같은 등록 절차, 컴파일만 배치로 미룸
+            Shader = NewObject<UShader>();
+            Shader->InitializeSource(NormalizedPath);
+            Shader->SetFilePath(NormalizedPath);
+            Resources[ShaderTypeIndex][NormalizedPath] = Shader;
+            WatchShaderFiles(Shader);
+        }
+        Requests.emplace_back(Shader, Variant.second);
+    }
+
+    UShader::PrecompileVariants(Device, Requests);
 }
 
 void UResourceManager::CreateDefaultMaterial()
@@ -502,6 +550,16 @@ void UResourceManager::InitShaderILMap()
                  D3D11_INPUT_PER_VERTEX_DATA, 0 });
     ShaderToInputLayoutMap["Shaders/UI/Billboard.hlsl"] = layout;
     layout.clear();
+
+    // ────────────────────────────────
+    // 텍스트/빌보드 공유 정점 스트림 (FSpriteVertex)
+    // ────────────────────────────────
+    layout.Add({ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    layout.Add({ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    layout.Add({ "COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, 20, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    layout.Add({ "OBJECTID", 0, DXGI_FORMAT_R32_UINT, 0, 24, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    ShaderToInputLayoutMap["Shaders/UI/SpriteBatch.hlsl"] = layout;
+    layout.clear();
     
 
     // ────────────────────────────────
@@ -555,15 +613,43 @@ void UResourceManager::CreateTextBillboardTexture()
     Add<UTexture>("TextBillboard.dds", TextBillboardTexture);
 }
 
+void UResourceManager::WatchShaderFiles(UShader* InShader)
+{
+    auto WatchFile = [this](const FString& InPath)
+    {
+        if (InPath.empty() || WatchedShaderFiles.Contains(InPath))
+        {
+            return;
+        }
+
+        WatchedShaderFiles.Add(InPath);
+        FFileChangeService::GetInstance().Watch(InPath, [this](const FString& ChangedPath)
+        {
+            ChangedShaderFiles.Add(ChangedPath);
+        });
+    };
+
+    WatchFile(InShader->GetFilePath());
+    for (const FString& IncludedFile : InShader->GetIncludedFiles())
+    {
+        WatchFile(IncludedFile);
+    }
+    ShaderDependencyGraph.SetDependencies(InShader->GetFilePath(), InShader->GetIncludedFiles());
+}
+
 void UResourceManager::CheckAndReloadShaders(float DeltaTime)
 {
-    // Throttle check frequency to reduce file system overhead
-    ShaderCheckTimer += DeltaTime;
-    if (ShaderCheckTimer < ShaderCheckInterval)
+    // 파일 감시는 FFileChangeService가 백그라운드에서 하므로 변경 알림이 없으면 바로 반환
+    if (ChangedShaderFiles.empty())
     {
         return;
     }
-    ShaderCheckTimer = 0.0f;
+
+    TSet<FString> ChangedFiles;
+    ChangedFiles.swap(ChangedShaderFiles);
+
+    // 바뀐 파일은 다시 읽어야 소스 해시가 갱신됨
+    UShader::GetCompileManager().InvalidateFiles(ChangedFiles);
 
     // Get all shader resources
     uint8 ShaderTypeIndex = static_cast<uint8>(ResourceType::Shader);
@@ -572,11 +658,16 @@ void UResourceManager::CheckAndReloadShaders(float DeltaTime)
         return;
     }
 
-    // Check each shader for modifications
+    // 바뀐 파일을 본문이나 include로 쓰는 셰이더만 (의존성 그래프, 여러 파일이 바뀌어도 셰이더당 한 번)
+    // 저장만 하고 내용이 같으면 IsOutdated가 false라 다시 컴파일하지 않음
+    TSet<FString> AffectedShaderPaths;
+    ShaderDependencyGraph.GetAffectedShaders(ChangedFiles, AffectedShaderPaths);
+
     TArray<UShader*> ShadersToReload;
-    for (auto& Pair : Resources[ShaderTypeIndex])
+    for (const FString& ShaderPath : AffectedShaderPaths)
     {
-        UShader* Shader = static_cast<UShader*>(Pair.second);
+        auto Iter = Resources[ShaderTypeIndex].find(ShaderPath);
+        UShader* Shader = Iter != Resources[ShaderTypeIndex].end() ? static_cast<UShader*>(Iter->second) : nullptr;
         if (Shader && Shader->IsOutdated())
         {
             ShadersToReload.push_back(Shader);
@@ -616,6 +707,9 @@ void UResourceManager::CheckAndReloadShaders(float DeltaTime)
             {
                 UE_LOG("Shader Hot Reload Successful: %s", Shader->GetFilePath().c_str());
             }
+
+            // 새로 추가된 include 파일도 감시
+            WatchShaderFiles(Shader);
         }
         else
         {
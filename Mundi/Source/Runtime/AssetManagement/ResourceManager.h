@@ -64,8 +64,12 @@ public:
 	FString& GetProperShader(const FString& InTextureName);
 
 	// --- Shader Hot Reload ---
+	// FFileChangeService가 알려준 변경 파일(셰이더 본문 또는 include)을 쓰는 셰이더만 다시 로드
 	void CheckAndReloadShaders(float DeltaTime);
 
+	// 셰이더 리소스를 만들고 주어진 Variant들을 한 배치로 컴파일 (바이트코드 캐시 미스는 병렬)
+	void PrecompileShaders(const TArray<TPair<FString, TArray<FShaderMacro>>>& InShaderVariants);
+
 	// --- 리소스 생성 및 관리 ---
 	FTextureData* CreateOrGetTextureData(const FWideString& FilePath);
 	void UpdateDynamicVertexBuffer(const FString& name, TArray<FBillboardVertexInfo_GPU>& vertices);
@@ -127,8 +131,12 @@ private:
 	UMaterial* DefaultMaterialInstance;
 
 	// Shader Hot Reload
-	float ShaderCheckTimer = 0.0f;
-	const float ShaderCheckInterval = 0.5f; // Check every 0.5 seconds
+	// 셰이더 본문/include 파일 감시 등록 (파일당 한 번) + 의존성 그래프 갱신
+	void WatchShaderFiles(UShader* InShader);
+
+	TSet<FString> WatchedShaderFiles;
+	TSet<FString> ChangedShaderFiles;
+	FShaderDependencyGraph ShaderDependencyGraph;	// include 파일 -> 셰이더 경로
 };
 
 //-----definition
@@ -192,6 +200,10 @@ inline T* UResourceManager::Load(const FString& InFilePath, Args && ...InArgs)
 		Resource->Load(NormalizedPath, Device, std::forward<Args>(InArgs)...);
 		Resource->SetFilePath(NormalizedPath);
 		Resources[typeIndex][NormalizedPath] = Resource;
+		if constexpr (std::is_same_v<T, UShader>)
+		{
+			WatchShaderFiles(Resource);
+		}
 		return Resource;
 	}
 }
@@ -222,6 +234,7 @@ inline UShader* UResourceManager::Load(const FString& InFilePath, TArray<FShader
 		Resource->SetFilePath(NormalizedPath); // 이름 저장
 
 		Resources[typeIndex][NormalizedPath] = Resource;
+		WatchShaderFiles(Resource);
 		return Resource;
 	}
 }
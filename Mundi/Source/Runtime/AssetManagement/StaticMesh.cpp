@@ -2,6 +2,7 @@
 #include "StaticMesh.h"
 #include "ObjManager.h"
 #include "ResourceManager.h"
+#include "Shader.h"
 
 IMPLEMENT_CLASS(UStaticMesh)
 
@@ -22,7 +23,12 @@ void UStaticMesh::Load(const FString& InFilePath, ID3D11Device* InDevice, EVerte
     if (StaticMeshAsset && 0 < StaticMeshAsset->Vertices.size() && 0 < StaticMeshAsset->Indices.size())
     {
         CacheFilePath = StaticMeshAsset->CacheFilePath;
-        CreateVertexBuffer(StaticMeshAsset, InDevice, InVertexType);
+#ifdef USE_PACKED_STATIC_MESH_VERTEX
+        if (!CreatePackedVertexBufferFromCooked(StaticMeshAsset, InDevice) && !CreatePackedVertexBuffer(StaticMeshAsset, InDevice))
+#endif
+        {
+            CreateVertexBuffer(StaticMeshAsset, InDevice, InVertexType);
+        }
         CreateIndexBuffer(StaticMeshAsset, InDevice);
         CreateLocalBound(StaticMeshAsset);
         VertexCount = static_cast<uint32>(StaticMeshAsset->Vertices.size());
@@ -77,6 +83,7 @@ void UStaticMesh::SetVertexType(EVertexLayoutType InVertexType)
     }
 
     VertexStride = Stride;
+    PackedVertexFlags = PVF_None;   // 패킹 경로는 CreatePackedVertexBuffer에서 다시 설정
 }
 
 bool UStaticMesh::EraseUsingComponets(UStaticMeshComponent* InStaticMeshComponent)
@@ -110,6 +117,91 @@ void UStaticMesh::CreateVertexBuffer(FStaticMesh* InStaticMesh, ID3D11Device* In
     assert(SUCCEEDED(hr));
 }
 
+bool UStaticMesh::CreatePackedVertexBuffer(FStaticMesh* InStaticMesh, ID3D11Device* InDevice)
+{
+    const FPackedVertexFormat Format = FPackedVertexCodec::ChooseFormat(InStaticMesh->Vertices);
+
+    FPackedVertexBuffer Packed;
+    FPackedVertexCodec::Encode(InStaticMesh->Vertices, Format, Packed);
+
+    // 오차 허용치를 넘으면 (비정상 노멀, 범위 밖 색상/UV 등) 기존 FVertexDynamic 경로 사용
+    const FPackedVertexErrorStats Errors = FPackedVertexCodec::Verify(InStaticMesh->Vertices, Packed);
+    if (!Errors.bWithinTolerance)
+    {
+        UE_LOG("[StaticMesh] Packed vertex verification failed, using full vertex format: %s (pos %.2f steps, normal %.4f deg, tangent %.4f deg, uv %.5f, color %.4f)",
+            InStaticMesh->PathFileName.c_str(), Errors.MaxPositionErrorInSteps, Errors.MaxNormalDegrees,
+            Errors.MaxTangentDegrees, Errors.MaxTexCoordError, Errors.MaxColorError);
+        return false;
+    }
+
+    HRESULT hr = D3D11RHI::CreateVertexBufferFromBytes(InDevice, Packed.Data.data(), static_cast<uint32>(Packed.Data.size()), &VertexBuffer);
+    if (FAILED(hr))
+    {
+        return false;
+    }
+
+    VertexStride = Format.GetStride();
+    PackedVertexFlags = Format.GetFlags();
+    PositionDequantScale = Packed.PositionDequantScale;
+    PositionDequantBias = Packed.PositionDequantBias;
+    VertexMemoryReport = FPackedVertexCodec::BuildMemoryReport(*InStaticMesh, Format);
+
+    UE_LOG("[StaticMesh] Packed vertices: %s | stride %u -> %u | VB %.1f KB -> %.1f KB (x%.2f) | IB %.1f KB | fetch/draw %.1f KB -> %.1f KB",
+        InStaticMesh->PathFileName.c_str(), VertexMemoryReport.FullStride, VertexMemoryReport.PackedStride,
+        VertexMemoryReport.FullVertexBytes / 1024.0, VertexMemoryReport.PackedVertexBytes / 1024.0,
+        VertexMemoryReport.GetVertexCompressionRatio(), VertexMemoryReport.IndexBytes / 1024.0,
+        VertexMemoryReport.FullFetchBytesPerDraw / 1024.0, VertexMemoryReport.PackedFetchBytesPerDraw / 1024.0);
+    return true;
+}
+
+bool UStaticMesh::CreatePackedVertexBufferFromCooked(FStaticMesh* InStaticMesh, ID3D11Device* InDevice)
+{
+    // 쿠킹 시 인코딩/검증이 끝나 FCookedStaticMeshView::CopyTo가 함께 복사해 둔 스트림을 그대로 업로드 (파일 재매핑/CRC 재검사, 재인코딩 없음)
+    TArray<uint8>& PackedBytes = InStaticMesh->CookedPackedVertices;
+    if (PackedBytes.empty() || InStaticMesh->CookedPackedVertexFlags == 0)
+    {
+        return false;
+    }
+
+    const FPackedVertexFormat Format = FPackedVertexFormat::FromFlags(static_cast<uint8>(InStaticMesh->CookedPackedVertexFlags));
+    if (PackedBytes.size() != static_cast<size_t>(Format.GetStride()) * InStaticMesh->Vertices.size())
+    {
+        return false;
+    }
+
+    HRESULT hr = D3D11RHI::CreateVertexBufferFromBytes(InDevice, PackedBytes.data(), static_cast<uint32>(PackedBytes.size()), &VertexBuffer);
+    if (FAILED(hr))
+    {
+        return false;
+    }
+
+    VertexStride = Format.GetStride();
+    PackedVertexFlags = Format.GetFlags();
+    const float* Scale = InStaticMesh->CookedPositionDequantScale;
+    const float* Bias = InStaticMesh->CookedPositionDequantBias;
+    PositionDequantScale = FVector4(Scale[0], Scale[1], Scale[2], Scale[3]);
+    PositionDequantBias = FVector4(Bias[0], Bias[1], Bias[2], Bias[3]);
+
+    // GPU에 올라갔으므로 CPU 사본은 해제 (정점/인덱스는 피킹과 BVH용으로 유지)
+    TArray<uint8>().swap(PackedBytes);
+
+    VertexMemoryReport = FPackedVertexCodec::BuildMemoryReport(*InStaticMesh, Format);
+
+    UE_LOG("[StaticMesh] Packed vertices (cooked): %s | stride %u -> %u | VB %.1f KB -> %.1f KB (x%.2f)",
+        InStaticMesh->PathFileName.c_str(), VertexMemoryReport.FullStride, VertexMemoryReport.PackedStride,
+        VertexMemoryReport.FullVertexBytes / 1024.0, VertexMemoryReport.PackedVertexBytes / 1024.0,
+        VertexMemoryReport.GetVertexCompressionRatio());
+    return true;
+}
+
+void UStaticMesh::AppendVertexShaderMacros(TArray<FShaderMacro>& InOutMacros) const
+{
+    if (IsPackedVertex())
+    {
+        FPackedVertexFormat::FromFlags(PackedVertexFlags).AppendShaderMacros(InOutMacros);
+    }
+}
+
 void UStaticMesh::CreateIndexBuffer(FMeshData* InMeshData, ID3D11Device* InDevice)
 {
     HRESULT hr = D3D11RHI::CreateIndexBuffer(InDevice, InMeshData, &IndexBuffer);
@@ -2,6 +2,7 @@
 #include "ResourceBase.h"
 #include "Enums.h"
 #include "MeshBVH.h"
+#include "PackedVertex.h"
 #include <d3d11.h>
 
 class FMeshBVH;
@@ -46,16 +47,28 @@ public:
 
     const FString& GetCacheFilePath() const { return CacheFilePath; }
 
+    // 패킹 정점 스트림 (USE_PACKED_STATIC_MESH_VERTEX). 0이면 FVertexDynamic
+    bool IsPackedVertex() const { return PackedVertexFlags != PVF_None; }
+    uint8 GetPackedVertexFlags() const { return PackedVertexFlags; }
+    const FVector4& GetPositionDequantScale() const { return PositionDequantScale; }
+    const FVector4& GetPositionDequantBias() const { return PositionDequantBias; }
+    const FVertexMemoryReport& GetVertexMemoryReport() const { return VertexMemoryReport; }
+
+    // 패킹 정점이면 PACKED_* 매크로를 덧붙입니다. (머티리얼 매크로 + 이 결과로 셰이더 Variant 선택)
+    void AppendVertexShaderMacros(TArray<FShaderMacro>& InOutMacros) const;
+
 private:
     void CreateVertexBuffer(FMeshData* InMeshData, ID3D11Device* InDevice, EVertexLayoutType InVertexType);
 	void CreateVertexBuffer(FStaticMesh* InStaticMesh, ID3D11Device* InDevice, EVertexLayoutType InVertexType);
+    bool CreatePackedVertexBuffer(FStaticMesh* InStaticMesh, ID3D11Device* InDevice);
+    bool CreatePackedVertexBufferFromCooked(FStaticMesh* InStaticMesh, ID3D11Device* InDevice);
     void CreateIndexBuffer(FMeshData* InMeshData, ID3D11Device* InDevice);
 	void CreateIndexBuffer(FStaticMesh* InStaticMesh, ID3D11Device* InDevice);
     void CreateLocalBound(const FMeshData* InMeshData);
     void CreateLocalBound(const FStaticMesh* InStaticMesh);
     void ReleaseResources();
 
-    FString CacheFilePath;  // 캐시된 소스 경로 (예: DerivedDataCache/cube.obj.bin)
+    FString CacheFilePath;  // 캐시된 소스 경로 (예: DerivedDataCache/cube.obj.umesh)
 
     // GPU 리소스
     ID3D11Buffer* VertexBuffer = nullptr;
@@ -65,6 +78,12 @@ private:
     uint32 VertexStride = 0;
     EVertexLayoutType VertexType = EVertexLayoutType::PositionColorTexturNormal;  // Stride를 계산하기 위한 버텍스 타입
 
+    // 패킹 정점 정보 (EPackedVertexFlags, 위치 역양자화 = unorm * Scale + Bias)
+    uint8 PackedVertexFlags = PVF_None;
+    FVector4 PositionDequantScale = FVector4(1.0f, 1.0f, 1.0f, 0.0f);
+    FVector4 PositionDequantBias = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
+    FVertexMemoryReport VertexMemoryReport;
+
 	// CPU 리소스
     FStaticMesh* StaticMeshAsset = nullptr;
 
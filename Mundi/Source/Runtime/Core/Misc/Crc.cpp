@@ -0,0 +1,64 @@
+﻿#include "pch.h"
+#include "Crc.h"
+
+namespace
+{
+    struct FCrc32Tables
+    {
+        uint32 Table[8][256];
+
+        FCrc32Tables()
+        {
+            constexpr uint32 Polynomial = 0xEDB88320u; // reflected 0x04C11DB7
+            for (uint32 i = 0; i < 256; ++i)
+            {
+                uint32 Crc = i;
+                for (int32 Bit = 0; Bit < 8; ++Bit)
+                {
+                    Crc = (Crc >> 1) ^ ((Crc & 1u) ? Polynomial : 0u);
+                }
+                Table[0][i] = Crc;
+            }
+            for (uint32 i = 0; i < 256; ++i)
+            {
+                for (int32 Slice = 1; Slice < 8; ++Slice)
+                {
+                    Table[Slice][i] = (Table[Slice - 1][i] >> 8) ^ Table[0][Table[Slice - 1][i] & 0xFF];
+                }
+            }
+        }
+    };
+
+    const FCrc32Tables& GetCrc32Tables()
+    {
+        static const FCrc32Tables Tables;
+        return Tables;
+    }
+}
+
+uint32 FCrc::MemCrc32(const void* InData, uint64 InLength, uint32 InCrc)
+{
+    const uint32 (&T)[8][256] = GetCrc32Tables().Table;
+    const uint8* Data = static_cast<const uint8*>(InData);
+    uint32 Crc = ~InCrc;
+
+    // 8바이트 단위 (리틀 엔디언 가정)
+    while (InLength >= 8)
+    {
+        uint32 Lo, Hi;
+        memcpy(&Lo, Data, 4);
+        memcpy(&Hi, Data + 4, 4);
+        Lo ^= Crc;
+        Crc = T[7][Lo & 0xFF] ^ T[6][(Lo >> 8) & 0xFF] ^ T[5][(Lo >> 16) & 0xFF] ^ T[4][Lo >> 24] ^
+              T[3][Hi & 0xFF] ^ T[2][(Hi >> 8) & 0xFF] ^ T[1][(Hi >> 16) & 0xFF] ^ T[0][Hi >> 24];
+        Data += 8;
+        InLength -= 8;
+    }
+
+    while (InLength--)
+    {
+        Crc = (Crc >> 8) ^ T[0][(Crc ^ *Data++) & 0xFF];
+    }
+
+    return ~Crc;
+}
@@ -0,0 +1,13 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+/**
+ * CRC-32 (IEEE 802.3, zlib 호환) 체크섬.
+ * 슬라이싱-by-8 테이블로 바이트당 분기 없이 8바이트씩 처리합니다. 캐시 파일 무결성 검사용입니다.
+ */
+struct FCrc
+{
+public:
+    // InCrc에 이어서 계산합니다. (여러 블록을 순서대로 누적 가능, 시작값 0)
+    static uint32 MemCrc32(const void* InData, uint64 InLength, uint32 InCrc = 0);
+};
@@ -0,0 +1,201 @@
+﻿#include "pch.h"
+#include "Delegate.h"
+#include "PlatformTime.h"
+
+namespace
+{
+    // 비교용: 이전 std::function 기반 구현 (Broadcast 중 제거에 안전하려면 목록을 복사해야 했음)
+    template<typename... Args>
+    class TLegacyMulticastDelegate
+    {
+    public:
+        using HandlerType = std::function<void(Args...)>;
+
+        size_t Add(HandlerType InFunction)
+        {
+            const size_t Handle = NextHandle++;
+            Functions.emplace_back(Handle, InFunction);
+            return Handle;
+        }
+
+        template<typename TObject>
+        size_t AddDynamic(TObject* InObject, void (TObject::*InMethod)(Args...))
+        {
+            return Add([InObject, InMethod](Args... InArgs) { (InObject->*InMethod)(InArgs...); });
+        }
+
+        void Broadcast(Args... InArgs) const
+        {
+            for (const auto& Pair : Functions)
+            {
+                if (Pair.second)
+                {
+                    Pair.second(InArgs...);
+                }
+            }
+        }
+
+        void BroadcastCopy(Args... InArgs) const
+        {
+            const auto Copy = Functions;
+            for (const auto& Pair : Copy)
+            {
+                if (Pair.second)
+                {
+                    Pair.second(InArgs...);
+                }
+            }
+        }
+
+    private:
+        TArray<TPair<size_t, HandlerType>> Functions;
+        size_t NextHandle = 0;
+    };
+
+    struct FDelegateBenchListener
+    {
+        int64 Sum = 0;
+        void OnValue(int32 InValue) { Sum += InValue; }
+    };
+
+    constexpr int32 ListenerCount = 16;
+}
+
+void RunDelegateBenchmark(uint32 InIterationCount)
+{
+    if (InIterationCount == 0)
+    {
+        return;
+    }
+
+    FDelegateBenchListener Listeners[ListenerCount];
+    int64 Sink = 0;
+
+    auto Measure = [&](const char* InName, uint32 InOps, auto&& InBody)
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        InBody();
+        const double Ms = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+        UE_LOG("[DelegateBench] %-36s | %9.3f ms | %7.2f ns/op", InName, Ms, Ms * 1.0e6 / InOps);
+    };
+
+    UE_LOG("[DelegateBench] %u iterations, %d listeners per broadcast (inline buffer %zu bytes)",
+        InIterationCount, ListenerCount, TDelegateInstance<int32>::InlineSize);
+
+    // 1. Bind: 멤버 함수 / 포인터 3개를 캡처한 람다
+    Measure("Bind member      std::function", InIterationCount, [&]()
+    {
+        for (uint32 i = 0; i < InIterationCount; ++i)
+        {
+            FDelegateBenchListener* Listener = &Listeners[i % ListenerCount];
+            auto Method = &FDelegateBenchListener::OnValue;
+            std::function<void(int32)> Function = [Listener, Method](int32 InValue) { (Listener->*Method)(InValue); };
+            Function(1);
+        }
+    });
+    Measure("Bind member      TDelegate", InIterationCount, [&]()
+    {
+        for (uint32 i = 0; i < InIterationCount; ++i)
+        {
+            TDelegate<int32> Delegate;
+            Delegate.BindDynamic(&Listeners[i % ListenerCount], &FDelegateBenchListener::OnValue);
+            Delegate.Execute(1);
+        }
+    });
+    Measure("Bind lambda(24B) std::function", InIterationCount, [&]()
+    {
+        for (uint32 i = 0; i < InIterationCount; ++i)
+        {
+            int64* A = &Sink; FDelegateBenchListener* B = &Listeners[0]; FDelegateBenchListener* C = &Listeners[1];
+            std::function<void(int32)> Function = [A, B, C](int32 InValue) { *A += InValue + B->Sum + C->Sum; };
+            Function(1);
+        }
+    });
+    Measure("Bind lambda(24B) TDelegate", InIterationCount, [&]()
+    {
+        for (uint32 i = 0; i < InIterationCount; ++i)
+        {
+            int64* A = &Sink; FDelegateBenchListener* B = &Listeners[0]; FDelegateBenchListener* C = &Listeners[1];
+            TDelegate<int32> Delegate([A, B, C](int32 InValue) { *A += InValue + B->Sum + C->Sum; });
+            Delegate.Execute(1);
+        }
+    });
+
+    // 2. Broadcast
+    TLegacyMulticastDelegate<int32> Legacy;
+    TMulticastDelegate<int32> Multicast;
+    for (FDelegateBenchListener& Listener : Listeners)
+    {
+        Legacy.AddDynamic(&Listener, &FDelegateBenchListener::OnValue);
+        Multicast.AddDynamic(&Listener, &FDelegateBenchListener::OnValue);
+    }
+
+    const uint32 CallCount = InIterationCount * ListenerCount;
+    Measure("Broadcast        std::function", CallCount, [&]()
+    {
+        for (uint32 i = 0; i < InIterationCount; ++i) { Legacy.Broadcast(1); }
+    });
+    Measure("Broadcast(copy)  std::function", CallCount, [&]()
+    {
+        for (uint32 i = 0; i < InIterationCount; ++i) { Legacy.BroadcastCopy(1); }
+    });
+    Measure("Broadcast        TMulticastDelegate", CallCount, [&]()
+    {
+        for (uint32 i = 0; i < InIterationCount; ++i) { Multicast.Broadcast(1); }
+    });
+
+    // 3. 약한 바인딩: 절반의 소유 객체를 삭제한 뒤에도 안전하게 건너뛰는지
+    TArray<UObject*> Owners;
+    TMulticastDelegate<int32> WeakMulticast;
+    for (int32 i = 0; i < ListenerCount; ++i)
+    {
+        UObject* Owner = NewObject<UObject>();
+        Owners.Add(Owner);
+        FDelegateBenchListener* Listener = &Listeners[i];
+        WeakMulticast.AddWeakLambda(Owner, [Listener](int32 InValue) { Listener->OnValue(InValue); });
+    }
+    Measure("Broadcast weak   TMulticastDelegate", CallCount, [&]()
+    {
+        for (uint32 i = 0; i < InIterationCount; ++i) { WeakMulticast.Broadcast(1); }
+    });
+    for (int32 i = 0; i < ListenerCount; i += 2)
+    {
+        DeleteObject(Owners[i]);
+    }
+    const int64 SumBefore = Listeners[0].Sum + Listeners[1].Sum;
+    WeakMulticast.Broadcast(1);
+    const int64 SumAfter = Listeners[0].Sum + Listeners[1].Sum;
+    UE_LOG("[DelegateBench] Weak binding after deleting owners: %s (bound: %s)",
+        SumAfter - SumBefore == 1 ? "dead owners skipped" : "FAILED",
+        WeakMulticast.IsBound() ? "true" : "false");
+    for (int32 i = 1; i < ListenerCount; i += 2)
+    {
+        DeleteObject(Owners[i]);
+    }
+
+    // 4. Broadcast 중 자기 자신 제거 + 새 바인딩 추가
+    TMulticastDelegate<int32> SelfRemoving;
+    TArray<TMulticastDelegate<int32>::DelegateHandle> Handles(ListenerCount);
+    int32 Calls = 0;
+    for (int32 i = 0; i < ListenerCount; ++i)
+    {
+        Handles[i] = SelfRemoving.Add([&SelfRemoving, &Handles, &Calls, i](int32)
+        {
+            ++Calls;
+            SelfRemoving.RemoveDynamic(Handles[i]);
+            SelfRemoving.Add([&Calls](int32) { ++Calls; });
+        });
+    }
+    SelfRemoving.Broadcast(1);
+    const int32 FirstCalls = Calls;
+    SelfRemoving.Broadcast(1);
+    UE_LOG("[DelegateBench] Remove/add during broadcast: %d then %d calls (expected %d, %d)",
+        FirstCalls, Calls - FirstCalls, ListenerCount, ListenerCount);
+
+    int64 Total = Sink;
+    for (const FDelegateBenchListener& Listener : Listeners)
+    {
+        Total += Listener.Sum;
+    }
+    UE_LOG("[DelegateBench] checksum %lld", Total);
+}
@@ -2,43 +2,294 @@
 
 #include <functional>
 #include <memory>
+#include <new>
+#include <type_traits>
 #include "UEContainer.h"
+#include "WeakPtr.h"
+
+namespace DelegatePrivate
+{
+	template<typename T>
+	struct TIsStdFunction : std::false_type {};
+
+	template<typename TSignature>
+	struct TIsStdFunction<std::function<TSignature>> : std::true_type {};
+}
+
+/**
+ * 델리게이트 하나의 바인딩 (호출 대상 + 선택적 약한 소유자).
+ * 멤버 함수 바인딩과 작은 람다(포인터 4개 크기 이하)는 내부 버퍼에 저장해 힙 할당이 없습니다.
+ * 약한 소유자가 지정되면 그 UObject가 삭제된 뒤에는 IsAlive()가 false가 되어 호출되지 않습니다.
+ */
+template<typename... Args>
+class TDelegateInstance
+{
+public:
+	static constexpr size_t InlineSize = 4 * sizeof(void*);
+
+	TDelegateInstance() = default;
+	~TDelegateInstance() { Reset(); }
+
+	TDelegateInstance(const TDelegateInstance& Other) { CopyFrom(Other); }
+	TDelegateInstance(TDelegateInstance&& Other) noexcept { MoveFrom(Other); }
+
+	TDelegateInstance& operator=(const TDelegateInstance& Other)
+	{
+		if (this != &Other)
+		{
+			Reset();
+			CopyFrom(Other);
+		}
+		return *this;
+	}
+
+	TDelegateInstance& operator=(TDelegateInstance&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			Reset();
+			MoveFrom(Other);
+		}
+		return *this;
+	}
+
+	// 람다, 함수 포인터, std::function 등 호출 가능한 객체 (비어 있으면 해제)
+	template<typename TCallable>
+	void SetCallable(TCallable&& InCallable, UObject* InWeakOwner = nullptr)
+	{
+		using TStored = std::decay_t<TCallable>;
+		static_assert(std::is_copy_constructible_v<TStored>, "Delegate callable must be copyable");
+
+		Reset();
+		if constexpr (std::is_pointer_v<TStored> || DelegatePrivate::TIsStdFunction<TStored>::value)
+		{
+			if (!InCallable)
+			{
+				return;
+			}
+		}
+
+		constexpr bool bInline = sizeof(TStored) <= InlineSize && alignof(TStored) <= alignof(void*) &&
+			std::is_nothrow_move_constructible_v<TStored>;
+		if constexpr (bInline)
+		{
+			new (Storage) TStored(std::forward<TCallable>(InCallable));
+		}
+		else
+		{
+			*reinterpret_cast<TStored**>(Storage) = new TStored(std::forward<TCallable>(InCallable));
+		}
+		Ops = &TOps<TStored, bInline>::Table;
+		SetWeakOwner(InWeakOwner);
+	}
+
+	// 멤버 함수. TObject가 GUObjectArray에 등록된 UObject면 약한 바인딩
+	template<typename TObject>
+	void SetMethod(TObject* InObject, void (TObject::*InMethod)(Args...))
+	{
+		UObject* WeakOwner = nullptr;
+		if constexpr (std::is_base_of_v<UObject, TObject>)
+		{
+			if (InObject && InObject->InternalIndex != UINT32_MAX)
+			{
+				WeakOwner = InObject;
+			}
+		}
+		SetCallable(TMethodCaller<TObject>{ InObject, InMethod }, WeakOwner);
+	}
+
+	void Reset()
+	{
+		if (Ops)
+		{
+			Ops->Destroy(Storage);
+			Ops = nullptr;
+		}
+		WeakOwner.Reset();
+		bWeak = false;
+	}
+
+	bool IsBound() const { return Ops != nullptr; }
+
+	// 바인딩되어 있고 약한 소유자가 (있다면) 아직 살아 있음
+	bool IsAlive() const { return Ops != nullptr && (!bWeak || WeakOwner.IsValid()); }
+
+	bool IsInline() const { return Ops != nullptr && !Ops->bHeap; }
+
+	void Invoke(Args... InArgs) const
+	{
+		Ops->Invoke(const_cast<unsigned char*>(Storage), InArgs...);
+	}
+
+private:
+	template<typename TObject>
+	struct TMethodCaller
+	{
+		TObject* Object;
+		void (TObject::*Method)(Args...);
+
+		void operator()(Args... InArgs) const
+		{
+			(Object->*Method)(InArgs...);
+		}
+	};
+
+	struct FOps
+	{
+		void (*Invoke)(void* InStorage, Args... InArgs);
+		void (*Copy)(void* OutStorage, const void* InStorage);
+		void (*Move)(void* OutStorage, void* InStorage);   // InStorage는 이후 비어 있는 상태
+		void (*Destroy)(void* InStorage);
+		bool bHeap;
+	};
+
+	template<typename TStored, bool bInline>
+	struct TOps
+	{
+		static TStored* Get(void* InStorage)
+		{
+			if constexpr (bInline)
+			{
+				return std::launder(reinterpret_cast<TStored*>(InStorage));
+			}
+			else
+			{
+				return *reinterpret_cast<TStored**>(InStorage);
+			}
+		}
+
+		static void Invoke(void* InStorage, Args... InArgs)
+		{
+			// sol::function 등은 반환값이 있으므로 버림
+			(void)(*Get(InStorage))(InArgs...);
+		}
+
+		static void Copy(void* OutStorage, const void* InStorage)
+		{
+			const TStored& Source = *Get(const_cast<void*>(InStorage));
+			if constexpr (bInline)
+			{
+				new (OutStorage) TStored(Source);
+			}
+			else
+			{
+				*reinterpret_cast<TStored**>(OutStorage) = new TStored(Source);
+			}
+		}
+
+		static void Move(void* OutStorage, void* InStorage)
+		{
+			if constexpr (bInline)
+			{
+				TStored* Source = Get(InStorage);
+				new (OutStorage) TStored(std::move(*Source));
+				Source->~TStored();
+			}
+			else
+			{
+				*reinterpret_cast<TStored**>(OutStorage) = Get(InStorage);
+			}
+		}
+
+		static void Destroy(void* InStorage)
+		{
+			if constexpr (bInline)
+			{
+				Get(InStorage)->~TStored();
+			}
+			else
+			{
+				delete Get(InStorage);
+			}
+		}
+
+		static constexpr FOps Table = { &Invoke, &Copy, &Move, &Destroy, !bInline };
+	};
+
+	void SetWeakOwner(UObject* InWeakOwner)
+	{
+		bWeak = InWeakOwner != nullptr;
+		WeakOwner = InWeakOwner;
+	}
+
+	void CopyFrom(const TDelegateInstance& Other)
+	{
+		if (Other.Ops)
+		{
+			Other.Ops->Copy(Storage, Other.Storage);
+			Ops = Other.Ops;
+		}
+		WeakOwner = Other.WeakOwner;
+		bWeak = Other.bWeak;
+	}
+
+	void MoveFrom(TDelegateInstance& Other)
+	{
+		if (Other.Ops)
+		{
+			Other.Ops->Move(Storage, Other.Storage);
+			Ops = Other.Ops;
+			Other.Ops = nullptr;
+		}
+		WeakOwner = Other.WeakOwner;
+		bWeak = Other.bWeak;
+		Other.WeakOwner.Reset();
+		Other.bWeak = false;
+	}
+
+	alignas(void*) unsigned char Storage[InlineSize];
+	const FOps* Ops = nullptr;
+	TWeakPtr<UObject> WeakOwner;
+	bool bWeak = false;
+};
 
 // 단일 함수 바인딩을 위한 Delegate
 template<typename... Args>
 class TDelegate
 {
 public:
-	using HandlerType = std::function<void(Args...)>;
-
 	TDelegate() = default;
+	TDelegate(std::nullptr_t) {}
+
+	// 람다, 함수 포인터, std::function으로부터 바로 생성 (BindAction 등의 인자로 넘길 때)
+	template<typename TCallable, typename = std::enable_if_t<
+		!std::is_same_v<std::decay_t<TCallable>, TDelegate> && std::is_invocable_v<std::decay_t<TCallable>&, Args...>>>
+	TDelegate(TCallable&& InCallable)
+	{
+		Bind(std::forward<TCallable>(InCallable));
+	}
 
 	// 람다, 함수 포인터, std::function 바인딩
-	void Bind(HandlerType InFunction)
+	template<typename TCallable>
+	void Bind(TCallable&& InCallable)
 	{
-		Function = InFunction;
+		Instance.SetCallable(std::forward<TCallable>(InCallable));
 	}
 
-	// 멤버 함수 바인딩
+	// 멤버 함수 바인딩 (UObject면 객체가 삭제된 뒤 자동으로 호출되지 않음)
 	template<typename TObject>
 	void BindDynamic(TObject* InObject, void (TObject::*InMethod)(Args...))
 	{
-		Function = [InObject, InMethod](Args... InArgs)
-		{
-			(InObject->*InMethod)(InArgs...);
-		};
+		Instance.SetMethod(InObject, InMethod);
+	}
+
+	// InOwner가 살아 있는 동안만 호출되는 람다 바인딩
+	template<typename TCallable>
+	void BindWeakLambda(UObject* InOwner, TCallable&& InCallable)
+	{
+		Instance.SetCallable(std::forward<TCallable>(InCallable), InOwner);
 	}
 
 	// 바인딩 해제
 	void Unbind()
 	{
-		Function = nullptr;
+		Instance.Reset();
 	}
 
-	// 바인딩 여부 확인
+	// 바인딩 여부 확인 (약한 바인딩의 객체가 삭제되었으면 false)
 	bool IsBound() const
 	{
-		return Function != nullptr;
+		return Instance.IsAlive();
 	}
 
 	// 실행
@@ -46,7 +297,7 @@ public:
 	{
 		if (IsBound())
 		{
-			Function(InArgs...);
+			Instance.Invoke(InArgs...);
 		}
 	}
 
@@ -57,72 +308,139 @@ public:
 	}
 
 private:
-	HandlerType Function;
+	TDelegateInstance<Args...> Instance;
 };
 
-// 여러 함수 바인딩을 위한 Multicast Delegate
+/**
+ * 여러 함수 바인딩을 위한 Multicast Delegate
+ * Broadcast 도중 Add/Remove가 불려도 바인딩 목록을 복사하지 않습니다.
+ * - 도중에 제거된 바인딩은 표시만 해 두고 건너뛰며, 가장 바깥 Broadcast가 끝날 때 정리합니다.
+ * - 도중에 추가된 바인딩은 이번 Broadcast에서는 호출되지 않고 끝난 뒤 목록에 합쳐집니다.
+ * - 삭제된 UObject에 대한 약한 바인딩은 건너뛰고 정리합니다.
+ */
 template<typename... Args>
 class TMulticastDelegate
 {
 public:
-	using HandlerType = std::function<void(Args...)>;
 	using DelegateHandle = size_t;
 
 	TMulticastDelegate() = default;
 
 	// 람다, 함수 포인터, std::function 추가
-	DelegateHandle Add(HandlerType InFunction)
+	template<typename TCallable>
+	DelegateHandle Add(TCallable&& InCallable)
 	{
-		DelegateHandle Handle = NextHandle++;
-		Functions.emplace_back(Handle, InFunction);
-		return Handle;
+		FEntry Entry;
+		Entry.Instance.SetCallable(std::forward<TCallable>(InCallable));
+		return AddEntry(std::move(Entry));
 	}
 
-	// 멤버 함수 추가
+	// 멤버 함수 추가 (UObject면 객체가 삭제된 뒤 자동으로 호출되지 않음)
 	template<typename TObject>
 	DelegateHandle AddDynamic(TObject* InObject, void (TObject::*InMethod)(Args...))
 	{
-		auto Function = [InObject, InMethod](Args... InArgs)
-		{
-			(InObject->*InMethod)(InArgs...);
-		};
-		return Add(Function);
+		FEntry Entry;
+		Entry.Instance.SetMethod(InObject, InMethod);
+		return AddEntry(std::move(Entry));
+	}
+
+	// InOwner가 살아 있는 동안만 호출되는 람다 추가
+	template<typename TCallable>
+	DelegateHandle AddWeakLambda(UObject* InOwner, TCallable&& InCallable)
+	{
+		FEntry Entry;
+		Entry.Instance.SetCallable(std::forward<TCallable>(InCallable), InOwner);
+		return AddEntry(std::move(Entry));
 	}
 
 	// 핸들로 제거
 	void RemoveDynamic(DelegateHandle Handle)
 	{
-		Functions.erase(
-			std::remove_if(Functions.begin(), Functions.end(),
-				[Handle](const std::pair<DelegateHandle, HandlerType>& Pair)
+		for (int32 i = 0; i < PendingAdds.Num(); ++i)
+		{
+			if (PendingAdds[i].Handle == Handle)
+			{
+				PendingAdds.RemoveAt(i);
+				return;
+			}
+		}
+
+		for (int32 i = 0; i < Entries.Num(); ++i)
+		{
+			if (Entries[i].Handle == Handle && !Entries[i].bRemoved)
+			{
+				if (BroadcastDepth > 0)
 				{
-					return Pair.first == Handle;
-				}),
-			Functions.end()
-		);
+					// 실행 중인 바인딩일 수 있으므로 Broadcast가 끝난 뒤 파괴
+					Entries[i].bRemoved = true;
+					bHasRemovedEntries = true;
+				}
+				else
+				{
+					Entries.RemoveAt(i);
+				}
+				return;
+			}
+		}
 	}
 
 	// 모두 제거
 	void RemoveAll()
 	{
-		Functions.clear();
+		PendingAdds.clear();
+		if (BroadcastDepth > 0)
+		{
+			for (FEntry& Entry : Entries)
+			{
+				Entry.bRemoved = true;
+			}
+			bHasRemovedEntries = !Entries.IsEmpty();
+		}
+		else
+		{
+			Entries.clear();
+		}
 	}
 
 	// 바인딩 여부 확인
 	bool IsBound() const
 	{
-		return !Functions.empty();
+		for (const FEntry& Entry : Entries)
+		{
+			if (!Entry.bRemoved && Entry.Instance.IsAlive())
+			{
+				return true;
+			}
+		}
+		return !PendingAdds.IsEmpty();
 	}
 
 	// 모든 함수 실행
 	void Broadcast(Args... InArgs) const
 	{
-		for (const auto& Pair : Functions)
+		++BroadcastDepth;
+
+		// 도중 추가는 PendingAdds로 가므로 Entries는 재할당되지 않음
+		const int32 Count = Entries.Num();
+		for (int32 i = 0; i < Count; ++i)
 		{
-			if (Pair.second)
+			FEntry& Entry = Entries[i];
+			if (Entry.bRemoved)
+			{
+				continue;
+			}
+			if (!Entry.Instance.IsAlive())
 			{
-				Pair.second(InArgs...);
+				Entry.bRemoved = true;
+				bHasRemovedEntries = true;
+				continue;
 			}
+			Entry.Instance.Invoke(InArgs...);
+		}
+
+		if (--BroadcastDepth == 0)
+		{
+			FlushPendingChanges();
 		}
 	}
 
@@ -133,10 +451,60 @@ public:
 	}
 
 private:
-	TArray<TPair<DelegateHandle, HandlerType>> Functions;
+	struct FEntry
+	{
+		DelegateHandle Handle = 0;
+		TDelegateInstance<Args...> Instance;
+		bool bRemoved = false;
+	};
+
+	DelegateHandle AddEntry(FEntry&& InEntry)
+	{
+		InEntry.Handle = NextHandle++;
+		const DelegateHandle Handle = InEntry.Handle;
+		if (!InEntry.Instance.IsBound())
+		{
+			return Handle;
+		}
+
+		if (BroadcastDepth > 0)
+		{
+			PendingAdds.emplace_back(std::move(InEntry));
+		}
+		else
+		{
+			Entries.emplace_back(std::move(InEntry));
+		}
+		return Handle;
+	}
+
+	void FlushPendingChanges() const
+	{
+		if (bHasRemovedEntries)
+		{
+			Entries.erase(std::remove_if(Entries.begin(), Entries.end(),
+				[](const FEntry& Entry) { return Entry.bRemoved; }), Entries.end());
+			bHasRemovedEntries = false;
+		}
+
+		for (FEntry& Entry : PendingAdds)
+		{
+			Entries.emplace_back(std::move(Entry));
+		}
+		PendingAdds.clear();
+	}
+
+	// Broadcast(const)에서 약한 바인딩 정리와 도중 변경 반영을 하므로 mutable
+	mutable TArray<FEntry> Entries;
+	mutable TArray<FEntry> PendingAdds;
+	mutable int32 BroadcastDepth = 0;
+	mutable bool bHasRemovedEntries = false;
 	DelegateHandle NextHandle = 0;
 };
 
+// Bind/Broadcast 비용을 이전 std::function 기반 구현과 비교해 UE_LOG로 출력
+void RunDelegateBenchmark(uint32 InIterationCount);
+
 // 매크로 정의 (언리얼 스타일)
 
 // 파라미터가 없는 Delegate 선언
@@ -158,11 +158,54 @@ namespace Serialization {
     }
 }
 
+// 시뮬레이션된 post-transform 정점 캐시 통계 (MeshOptimizer 리포트)
+struct FVertexCacheStats
+{
+    float ACMR = 0.0f;  // Average Cache Miss Ratio: 삼각형당 변환 정점 수 (0.5 ~ 3.0, 낮을수록 좋음)
+    float ATVR = 0.0f;  // Average Transformed Vertex Ratio: 정점당 변환 횟수 (1.0이 최적)
+    uint32 TransformedVertexCount = 0;
+
+    friend FArchive& operator<<(FArchive& Ar, FVertexCacheStats& Stats)
+    {
+        Ar << Stats.ACMR;
+        Ar << Stats.ATVR;
+        Ar << Stats.TransformedVertexCount;
+        return Ar;
+    }
+};
+
+struct FMeshOptimizationStats
+{
+    bool bOptimized = false;
+    uint32 CacheSize = 0;
+
+    // 임포트 직후(파일 순서) / 최적화 후, FIFO·LRU 캐시 모델 각각
+    FVertexCacheStats BeforeFIFO;
+    FVertexCacheStats AfterFIFO;
+    FVertexCacheStats BeforeLRU;
+    FVertexCacheStats AfterLRU;
+
+    friend FArchive& operator<<(FArchive& Ar, FMeshOptimizationStats& Stats)
+    {
+        Ar << Stats.bOptimized;
+        Ar << Stats.CacheSize;
+        Ar << Stats.BeforeFIFO;
+        Ar << Stats.AfterFIFO;
+        Ar << Stats.BeforeLRU;
+        Ar << Stats.AfterLRU;
+        return Ar;
+    }
+};
+
+// .bin 캐시 헤더. 쿠킹 결과(정점/인덱스 순서 등)가 바뀌면 버전을 올려 이전 캐시를 재생성시킵니다.
+constexpr uint32 STATIC_MESH_CACHE_MAGIC = 0x4D534D55; // "UMSM"
+constexpr uint32 STATIC_MESH_CACHE_VERSION = 2;
+
 //// Cooked Data
 struct FStaticMesh
 {
     FString PathFileName;
-    FString CacheFilePath;  // 캐시된 소스 경로 (예: DerivedDataCache/cube.obj.bin)
+    FString CacheFilePath;  // 캐시된 소스 경로 (예: DerivedDataCache/cube.obj.umesh)
 
     TArray<FNormalVertex> Vertices;
     TArray<uint32> Indices;
@@ -171,10 +214,24 @@ struct FStaticMesh
 
     bool bHasMaterial;
 
+    // 임포트 시 수행된 정점 캐시/오버드로우/페치 최적화 결과 (캐시에 함께 저장)
+    FMeshOptimizationStats OptimizationStats;
+
+    // 쿠킹 파일을 읽을 때 함께 복사한 검증된 패킹 정점 스트림 (직렬화하지 않음, GPU 업로드 후 비움)
+    TArray<uint8> CookedPackedVertices;
+    uint32 CookedPackedVertexFlags = 0;
+    float CookedPositionDequantScale[4] = {};
+    float CookedPositionDequantBias[4] = {};
+
     friend FArchive& operator<<(FArchive& Ar, FStaticMesh& Mesh)
     {
         if (Ar.IsSaving())
         {
+            uint32 Magic = STATIC_MESH_CACHE_MAGIC;
+            uint32 Version = STATIC_MESH_CACHE_VERSION;
+            Ar << Magic;
+            Ar << Version;
+
             Serialization::WriteString(Ar, Mesh.PathFileName);
             Serialization::WriteArray(Ar, Mesh.Vertices);
             Serialization::WriteArray(Ar, Mesh.Indices);
@@ -184,9 +241,21 @@ struct FStaticMesh
             for (auto& g : Mesh.GroupInfos) Ar << g;
 
             Ar << Mesh.bHasMaterial;
+            Ar << Mesh.OptimizationStats;
         }
         else if (Ar.IsLoading())
         {
+            uint32 Magic = 0;
+            uint32 Version = 0;
+            Ar << Magic;
+            Ar << Version;
+
+            // 헤더가 없는 구버전 캐시 또는 다른 버전: 호출자가 예외를 받아 캐시를 재생성합니다.
+            if (Magic != STATIC_MESH_CACHE_MAGIC || Version != STATIC_MESH_CACHE_VERSION)
+            {
+                throw std::runtime_error("Cache outdated: static mesh cache version mismatch.");
+            }
+
             Serialization::ReadString(Ar, Mesh.PathFileName);
             Serialization::ReadArray(Ar, Mesh.Vertices);
             Serialization::ReadArray(Ar, Mesh.Indices);
@@ -197,6 +266,7 @@ struct FStaticMesh
             for (auto& g : Mesh.GroupInfos) Ar << g;
 
             Ar << Mesh.bHasMaterial;
+            Ar << Mesh.OptimizationStats;
         }
         return Ar;
     }
@@ -350,10 +420,8 @@ enum class ERTVMode : uint32
 {
 	BackBufferWithDepth,
 	BackBufferWithoutDepth,
-    SceneIdTarget,
     SceneColorTarget,
     SceneColorTargetWithoutDepth,
-    SceneColorTargetWithId, //모델 그릴때만 사용, 후처리는 별도
 };
 
 // RHI가 사용하는 텍스쳐들의 SRV
@@ -416,8 +484,10 @@ enum class EEngineShowFlags : uint64
 
     SF_Billboard = 1ull << 15,
 
+    SF_OcclusionCulling = 1ull << 18, // Enable/disable CPU software occlusion culling of static meshes
+
     // Default enabled flags
-    SF_DefaultEnabled = SF_Primitives | SF_StaticMeshes | SF_Grid | SF_Lighting | SF_Decals | SF_Fog | SF_FXAA | SF_Billboard,
+    SF_DefaultEnabled = SF_Primitives | SF_StaticMeshes | SF_Grid | SF_Lighting | SF_Decals | SF_Fog | SF_FXAA | SF_Billboard | SF_OcclusionCulling,
 
     // All flags (for initialization/reset)
     SF_All = 0xFFFFFFFFFFFFFFFFull
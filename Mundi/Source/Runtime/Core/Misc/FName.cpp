@@ -1,25 +1,273 @@
 ﻿#include "pch.h"
 #include "Name.h"
+#include "PlatformTime.h"
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
 
-TArray<FNameEntry> FNamePool::Entries;
-std::unordered_map<FString, uint32> FNamePool::NameMap;
+namespace
+{
+    constexpr uint32 ChunkSize = 1u << FNamePool::ChunkBits;
+    constexpr uint32 ChunkMask = ChunkSize - 1;
+    constexpr uint32 InvalidIndex = static_cast<uint32>(-1);
+
+    inline char ToLowerAscii(char C)
+    {
+        return (C >= 'A' && C <= 'Z') ? static_cast<char>(C - 'A' + 'a') : C;
+    }
+
+    // InLower는 이미 소문자 (엔트리의 Comparison)
+    bool EqualsIgnoreCase(std::string_view InStr, const FString& InLower)
+    {
+        if (InStr.size() != InLower.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < InStr.size(); ++i)
+        {
+            if (ToLowerAscii(InStr[i]) != InLower[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    struct FNameShard
+    {
+        std::shared_mutex Mutex;
+        std::unordered_multimap<uint64, uint32> Indices;   // 해시 -> 엔트리 인덱스 (충돌 시 여러 개)
+    };
+
+    // 청크는 한 번 할당되면 해제/이동하지 않음 -> 엔트리 참조가 프로그램 종료까지 유효
+    struct FNameStorage
+    {
+        FNameShard Shards[FNamePool::ShardCount];
+        std::atomic<FNameEntry*> Chunks[FNamePool::MaxChunks] = {};
+        std::atomic<uint32> Count{ 0 };
+        std::mutex ChunkMutex;
+
+        FNameEntry& AllocateEntry(uint32& OutIndex)
+        {
+            OutIndex = Count.fetch_add(1, std::memory_order_relaxed);
+            const uint32 ChunkIndex = OutIndex >> FNamePool::ChunkBits;
+            assert(ChunkIndex < FNamePool::MaxChunks && "FNamePool is full");
+
+            FNameEntry* Chunk = Chunks[ChunkIndex].load(std::memory_order_acquire);
+            if (!Chunk)
+            {
+                std::lock_guard<std::mutex> Lock(ChunkMutex);
+                Chunk = Chunks[ChunkIndex].load(std::memory_order_relaxed);
+                if (!Chunk)
+                {
+                    Chunk = new FNameEntry[ChunkSize];
+                    Chunks[ChunkIndex].store(Chunk, std::memory_order_release);
+                }
+            }
+            return Chunk[OutIndex & ChunkMask];
+        }
+    };
+
+    // 정적 초기화 순서와 무관하게 쓸 수 있도록 함수 내 static (종료 시 파괴하지 않음)
+    FNameStorage& GetStorage()
+    {
+        static FNameStorage* Storage = new FNameStorage();
+        return *Storage;
+    }
+
+    // 샤드 락을 잡은 상태에서 호출
+    uint32 FindInShard(const FNameShard& InShard, uint64 InHash, std::string_view InStr)
+    {
+        auto Range = InShard.Indices.equal_range(InHash);
+        for (auto It = Range.first; It != Range.second; ++It)
+        {
+            if (EqualsIgnoreCase(InStr, FNamePool::Get(It->second).Comparison))
+            {
+                return It->second;
+            }
+        }
+        return InvalidIndex;
+    }
+}
 
-uint32 FNamePool::Add(const FString& InStr)
+uint64 FNamePool::HashIgnoreCase(std::string_view InStr)
 {
-    FString Lower = InStr;
-    std::transform(Lower.begin(), Lower.end(), Lower.begin(), ::tolower);
+    uint64 Hash = 14695981039346656037ull;
+    for (char C : InStr)
+    {
+        Hash ^= static_cast<uint8>(ToLowerAscii(C));
+        Hash *= 1099511628211ull;
+    }
+    return Hash;
+}
+
+uint32 FNamePool::Add(std::string_view InStr)
+{
+    FNameStorage& Storage = GetStorage();
+    const uint64 Hash = HashIgnoreCase(InStr);
+    FNameShard& Shard = Storage.Shards[(Hash >> 60) & (ShardCount - 1)];
+
+    // 대부분은 이미 있는 이름이므로 공유 락으로 먼저 조회
+    {
+        std::shared_lock<std::shared_mutex> Lock(Shard.Mutex);
+        const uint32 Found = FindInShard(Shard, Hash, InStr);
+        if (Found != InvalidIndex)
+        {
+            return Found;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> Lock(Shard.Mutex);
+    // 락을 바꾸는 사이 다른 스레드가 같은 이름을 추가했을 수 있음
+    const uint32 Found = FindInShard(Shard, Hash, InStr);
+    if (Found != InvalidIndex)
+    {
+        return Found;
+    }
 
-    auto it = NameMap.find(Lower);
-    if (it != NameMap.end())
-        return it->second;
+    uint32 NewIndex;
+    FNameEntry& Entry = Storage.AllocateEntry(NewIndex);
+    Entry.Display.assign(InStr.data(), InStr.size());
+    Entry.Comparison.resize(InStr.size());
+    std::transform(InStr.begin(), InStr.end(), Entry.Comparison.begin(), ToLowerAscii);
+    Entry.Hash = Hash;
 
-    uint32 NewIndex = (uint32)Entries.size();
-    Entries.push_back({ InStr, Lower });
-    NameMap[Lower] = NewIndex;
+    // 인덱스는 샤드 락 해제(release) 후에 다른 스레드로 전달되므로 엔트리 내용도 함께 보임
+    Shard.Indices.emplace(Hash, NewIndex);
     return NewIndex;
 }
 
 const FNameEntry& FNamePool::Get(uint32 Index)
 {
-    return Entries[Index];
-}
\ No newline at end of file
+    const FNameEntry* Chunk = GetStorage().Chunks[Index >> ChunkBits].load(std::memory_order_acquire);
+    return Chunk[Index & ChunkMask];
+}
+
+uint32 FNamePool::Num()
+{
+    return GetStorage().Count.load(std::memory_order_acquire);
+}
+
+void FNamePool::RunBenchmark(uint32 InNamesPerThread)
+{
+    if (InNamesPerThread == 0)
+    {
+        return;
+    }
+
+    // 풀은 줄어들지 않으므로 실행마다 다른 접두사를 사용 (같은 이름으로 다시 돌리면 "신규 추가"가 조회가 됨)
+    static uint32 RunCounter = 0;
+    const uint32 RunId = RunCounter++;
+
+    const uint32 HardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    TArray<uint32> ThreadCounts = { 1 };
+    for (uint32 Count : { std::min(4u, HardwareThreads), HardwareThreads })
+    {
+        if (Count != ThreadCounts.back())
+        {
+            ThreadCounts.Add(Count);
+        }
+    }
+
+    // 조회 대상: 미리 만들어 둔 이름들을 대소문자를 바꿔서 조회
+    TArray<FString> ExistingNames;
+    TArray<FString> MixedCaseNames;
+    ExistingNames.reserve(1024);
+    MixedCaseNames.reserve(1024);
+    for (uint32 i = 0; i < 1024; ++i)
+    {
+        FString Name = "BenchExisting_" + std::to_string(RunId) + "_Name" + std::to_string(i) + "x";
+        Add(Name);
+        FString Mixed = Name;
+        std::transform(Mixed.begin(), Mixed.end(), Mixed.begin(), [](unsigned char C) { return static_cast<char>(std::toupper(C)); });
+        ExistingNames.Add(std::move(Name));
+        MixedCaseNames.Add(std::move(Mixed));
+    }
+
+    auto RunCase = [&](const char* InCaseName, uint32 InThreadCount, auto&& InBody)
+    {
+        TArray<std::thread> Threads;
+        Threads.reserve(InThreadCount);
+
+        std::atomic<uint32> ReadyCount{ 0 };
+        std::atomic<bool> bGo{ false };
+
+        for (uint32 t = 0; t < InThreadCount; ++t)
+        {
+            Threads.emplace_back([&, t]()
+            {
+                ++ReadyCount;
+                while (!bGo.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+                InBody(t);
+            });
+        }
+
+        while (ReadyCount.load() < InThreadCount)
+        {
+            std::this_thread::yield();
+        }
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        bGo.store(true, std::memory_order_release);
+        for (std::thread& Thread : Threads)
+        {
+            Thread.join();
+        }
+        const double Ms = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        const double TotalOps = static_cast<double>(InNamesPerThread) * InThreadCount;
+        UE_LOG("[NameBench] %-8s | %2u threads | %8.3f ms | %7.1f ns/op | %6.2f Mops/s",
+            InCaseName, InThreadCount, Ms, Ms * 1.0e6 / TotalOps, TotalOps / (Ms * 1.0e3));
+    };
+
+    UE_LOG("[NameBench] %u names per thread, pool size %u", InNamesPerThread, Num());
+
+    for (uint32 ThreadCount : ThreadCounts)
+    {
+        // 신규 추가: 스레드마다 서로 다른 이름 (문자열 준비는 측정 밖에서)
+        TArray<TArray<FString>> UniqueNames(ThreadCount);
+        for (uint32 t = 0; t < ThreadCount; ++t)
+        {
+            UniqueNames[t].reserve(InNamesPerThread);
+            for (uint32 i = 0; i < InNamesPerThread; ++i)
+            {
+                UniqueNames[t].Add("BenchUnique_" + std::to_string(RunId) + "_" + std::to_string(ThreadCount) + "_" +
+                    std::to_string(t) + "_" + std::to_string(i) + "x");
+            }
+        }
+
+        RunCase("Insert", ThreadCount, [&](uint32 t)
+        {
+            for (const FString& Name : UniqueNames[t])
+            {
+                Add(Name);
+            }
+        });
+
+        RunCase("Lookup", ThreadCount, [&](uint32 t)
+        {
+            for (uint32 i = 0; i < InNamesPerThread; ++i)
+            {
+                Add(MixedCaseNames[(i + t * 97) & 1023]);
+            }
+        });
+
+        // 번호 붙은 이름: 같은 기본 이름을 공유하므로 풀이 커지지 않아야 함
+        const uint32 PoolBefore = Num();
+        RunCase("Numbered", ThreadCount, [&](uint32 t)
+        {
+            for (uint32 i = 0; i < InNamesPerThread; ++i)
+            {
+                FName Numbered(ExistingNames[t & 1023], i);
+                (void)Numbered;
+            }
+        });
+        UE_LOG("[NameBench] Numbered names added %u pool entries", Num() - PoolBefore);
+    }
+
+    UE_LOG("[NameBench] pool size %u (%u chunks of %u)", Num(), (Num() + ChunkSize - 1) / ChunkSize, ChunkSize);
+}
@@ -0,0 +1,329 @@
+﻿#include "pch.h"
+#include "FileChangeService.h"
+
+FFileChangeService& FFileChangeService::GetInstance()
+{
+    static FFileChangeService Instance;
+    return Instance;
+}
+
+FFileChangeService::~FFileChangeService()
+{
+    Shutdown();
+}
+
+FString FFileChangeService::MakeKey(const FString& InPath, FString& OutDirectory)
+{
+    // 상대/절대 경로, 구분자, 대소문자가 달라도 같은 파일이면 같은 키
+    std::error_code Ec;
+    fs::path Path = fs::weakly_canonical(fs::path(UTF8ToWide(InPath)), Ec);
+    if (Ec)
+    {
+        Path = fs::absolute(fs::path(UTF8ToWide(InPath)), Ec).lexically_normal();
+    }
+
+    OutDirectory = WideToUTF8(Path.parent_path().wstring());
+
+    FString Key = NormalizePath(WideToUTF8(Path.wstring()));
+    std::transform(Key.begin(), Key.end(), Key.begin(), [](unsigned char C) { return static_cast<char>(std::tolower(C)); });
+    return Key;
+}
+
+FFileWatchHandle FFileChangeService::Watch(const FString& InPath, FOnFileChanged InCallback)
+{
+    FString Directory;
+    const FString Key = MakeKey(InPath, Directory);
+
+    const FFileWatchHandle Handle = NextHandle++;
+    Listeners[Handle] = FListener{ Key, InPath, std::move(InCallback) };
+    ListenersByKey[Key].Add(Handle);
+
+    bool bNewDirectory = false;
+    {
+        std::lock_guard<std::mutex> Lock(Mutex);
+
+        FWatchedFile& File = Files[Key];
+        if (File.ListenerCount++ == 0)
+        {
+            std::error_code Ec;
+            File.Directory = Directory;
+            File.LastWriteTime = fs::last_write_time(fs::path(UTF8ToWide(InPath)), Ec);
+            File.bExists = !Ec;
+
+            TArray<FString>& DirectoryFiles = FilesByDirectory[Directory];
+            if (DirectoryFiles.IsEmpty())
+            {
+                bDirectoriesDirty = true;
+                bNewDirectory = true;
+            }
+            DirectoryFiles.Add(Key);
+        }
+    }
+
+    StartWorker();
+    if (bNewDirectory && WakeEvent)
+    {
+        SetEvent(static_cast<HANDLE>(WakeEvent));
+    }
+    return Handle;
+}
+
+void FFileChangeService::Unwatch(FFileWatchHandle InHandle)
+{
+    FListener* Listener = Listeners.Find(InHandle);
+    if (!Listener)
+    {
+        return;
+    }
+
+    const FString Key = Listener->Key;
+    Listeners.Remove(InHandle);
+
+    if (TArray<FFileWatchHandle>* Handles = ListenersByKey.Find(Key))
+    {
+        Handles->Remove(InHandle);
+        if (Handles->IsEmpty())
+        {
+            ListenersByKey.Remove(Key);
+        }
+    }
+
+    std::lock_guard<std::mutex> Lock(Mutex);
+
+    FWatchedFile* File = Files.Find(Key);
+    if (!File || --File->ListenerCount > 0)
+    {
+        return;
+    }
+
+    if (TArray<FString>* DirectoryFiles = FilesByDirectory.Find(File->Directory))
+    {
+        DirectoryFiles->Remove(Key);
+        if (DirectoryFiles->IsEmpty())
+        {
+            FilesByDirectory.Remove(File->Directory);
+            bDirectoriesDirty = true;
+        }
+    }
+    Files.Remove(Key);
+    PendingKeys.Remove(Key);
+}
+
+void FFileChangeService::DispatchChanges()
+{
+    TSet<FString> ChangedKeys;
+    {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        if (PendingKeys.empty())
+        {
+            return;
+        }
+        ChangedKeys.swap(PendingKeys);
+    }
+
+    for (const FString& Key : ChangedKeys)
+    {
+        TArray<FFileWatchHandle>* Handles = ListenersByKey.Find(Key);
+        if (!Handles)
+        {
+            continue;
+        }
+
+        // 콜백 안에서 Watch/Unwatch가 불릴 수 있으므로 복사본으로 순회
+        const TArray<FFileWatchHandle> HandlesCopy = *Handles;
+        for (FFileWatchHandle Handle : HandlesCopy)
+        {
+            if (FListener* Listener = Listeners.Find(Handle))
+            {
+                FOnFileChanged Callback = Listener->Callback;
+                const FString Path = Listener->Path;
+                Callback(Path);
+            }
+        }
+    }
+}
+
+void FFileChangeService::Shutdown()
+{
+    if (!Worker.joinable())
+    {
+        return;
+    }
+
+    bStopRequested = true;
+    SetEvent(static_cast<HANDLE>(WakeEvent));
+    Worker.join();
+
+    CloseHandle(static_cast<HANDLE>(WakeEvent));
+    WakeEvent = nullptr;
+    bStopRequested = false;
+
+    // 재시작 시 디렉터리 알림을 다시 만들도록
+    std::lock_guard<std::mutex> Lock(Mutex);
+    bDirectoriesDirty = true;
+}
+
+uint32 FFileChangeService::GetWatchedFileCount() const
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+    return static_cast<uint32>(Files.size());
+}
+
+void FFileChangeService::StartWorker()
+{
+    if (Worker.joinable())
+    {
+        return;
+    }
+
+    WakeEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+    if (!WakeEvent)
+    {
+        UE_LOG("[FileChangeService] Failed to create wake event. File watching disabled.");
+        return;
+    }
+
+    bStopRequested = false;
+    Worker = std::thread(&FFileChangeService::WorkerMain, this);
+}
+
+void FFileChangeService::WorkerMain()
+{
+    // 0번은 WakeEvent, 나머지는 디렉터리 알림 (WaitForMultipleObjects 한도를 넘는 디렉터리는 폴링)
+    TArray<HANDLE> WaitHandles;
+    TArray<FString> NotifiedDirectories;
+    TArray<FString> PolledDirectories;
+
+    auto CloseNotifications = [&]()
+    {
+        for (size_t i = 1; i < WaitHandles.size(); ++i)
+        {
+            FindCloseChangeNotification(WaitHandles[i]);
+        }
+        WaitHandles.clear();
+        NotifiedDirectories.clear();
+        PolledDirectories.clear();
+    };
+
+    while (!bStopRequested)
+    {
+        bool bRebuild = false;
+        TArray<FString> Directories;
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            if (bDirectoriesDirty)
+            {
+                bDirectoriesDirty = false;
+                bRebuild = true;
+                for (const auto& Pair : FilesByDirectory)
+                {
+                    Directories.Add(Pair.first);
+                }
+            }
+        }
+
+        if (bRebuild)
+        {
+            CloseNotifications();
+            WaitHandles.Add(static_cast<HANDLE>(WakeEvent));
+
+            for (const FString& Directory : Directories)
+            {
+                HANDLE Notification = INVALID_HANDLE_VALUE;
+                if (WaitHandles.Num() < MAXIMUM_WAIT_OBJECTS)
+                {
+                    Notification = FindFirstChangeNotificationW(UTF8ToWide(Directory).c_str(), FALSE,
+                        FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE);
+                }
+
+                if (Notification != INVALID_HANDLE_VALUE)
+                {
+                    WaitHandles.Add(Notification);
+                    NotifiedDirectories.Add(Directory);
+                }
+                else
+                {
+                    PolledDirectories.Add(Directory);
+                }
+            }
+
+            // 알림을 만드는 사이에 바뀐 파일을 놓치지 않도록 한 번 전체 확인
+            for (const FString& Directory : Directories)
+            {
+                ScanDirectory(Directory);
+            }
+        }
+
+        const DWORD Timeout = PolledDirectories.IsEmpty() ? INFINITE : PollIntervalMs;
+        const DWORD Result = WaitForMultipleObjects(static_cast<DWORD>(WaitHandles.Num()), WaitHandles.data(), FALSE, Timeout);
+
+        if (Result == WAIT_TIMEOUT)
+        {
+            for (const FString& Directory : PolledDirectories)
+            {
+                ScanDirectory(Directory);
+            }
+        }
+        else if (Result > WAIT_OBJECT_0 && Result < WAIT_OBJECT_0 + WaitHandles.Num())
+        {
+            const uint32 Index = Result - WAIT_OBJECT_0;
+            ScanDirectory(NotifiedDirectories[Index - 1]);
+            FindNextChangeNotification(WaitHandles[Index]);
+        }
+        else if (Result == WAIT_FAILED)
+        {
+            // 알림 핸들이 무효해짐 (디렉터리 삭제 등) -> 다음 루프에서 다시 구성
+            std::lock_guard<std::mutex> Lock(Mutex);
+            bDirectoriesDirty = true;
+            Sleep(PollIntervalMs);
+        }
+        // WAIT_OBJECT_0: WakeEvent (디렉터리 목록 변경 또는 종료)
+    }
+
+    CloseNotifications();
+}
+
+void FFileChangeService::ScanDirectory(const FString& InDirectory)
+{
+    TArray<FString> Keys;
+    {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        if (TArray<FString>* DirectoryFiles = FilesByDirectory.Find(InDirectory))
+        {
+            Keys = *DirectoryFiles;
+        }
+    }
+
+    // stat은 락 밖에서 (게임 스레드의 Watch/Dispatch를 막지 않도록)
+    TArray<std::pair<std::filesystem::file_time_type, bool>> Stats;
+    Stats.reserve(Keys.size());
+    for (const FString& Key : Keys)
+    {
+        std::error_code Ec;
+        const auto WriteTime = fs::last_write_time(fs::path(UTF8ToWide(Key)), Ec);
+        Stats.push_back({ WriteTime, !Ec });
+    }
+
+    std::lock_guard<std::mutex> Lock(Mutex);
+    for (size_t i = 0; i < Keys.size(); ++i)
+    {
+        FWatchedFile* File = Files.Find(Keys[i]);
+        if (!File)
+        {
+            continue;   // 그 사이 Unwatch됨
+        }
+
+        const bool bExists = Stats[i].second;
+        if (bExists && (!File->bExists || Stats[i].first != File->LastWriteTime))
+        {
+            // 파일이 지워진 경우는 알리지 않음 (저장 시 지웠다 다시 만드는 에디터가 있음)
+            PendingKeys.insert(Keys[i]);
+        }
+
+        File->bExists = bExists;
+        if (bExists)
+        {
+            File->LastWriteTime = Stats[i].first;
+        }
+    }
+}
@@ -0,0 +1,85 @@
+﻿#pragma once
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "UEContainer.h"
+
+using FFileWatchHandle = uint32;
+
+/**
+ * 파일 변경 감시 서비스 (스크립트/셰이더 핫 리로드 공용).
+ * 백그라운드 스레드가 감시 파일이 있는 디렉터리마다 변경 알림(FindFirstChangeNotification)을 기다렸다가
+ * 알림이 온 디렉터리의 감시 파일만 stat합니다. 알림을 만들 수 없는 디렉터리는 PollInterval 간격으로 폴링합니다.
+ *
+ * 같은 파일을 여러 곳에서 Watch해도 파일은 경로당 하나로 감시되고, 변경 이벤트도 경로당 한 번만 쌓입니다.
+ * 콜백은 DispatchChanges를 호출한 게임 스레드에서 실행됩니다.
+ */
+class FFileChangeService
+{
+public:
+    using FOnFileChanged = std::function<void(const FString& /*InPath*/)>;
+
+    static FFileChangeService& GetInstance();
+
+    // InPath가 바뀌면 다음 DispatchChanges에서 InCallback(InPath) 호출. (게임 스레드 전용)
+    FFileWatchHandle Watch(const FString& InPath, FOnFileChanged InCallback);
+    void Unwatch(FFileWatchHandle InHandle);
+
+    // 백그라운드 스레드가 모은 변경을 경로당 한 번씩 전달 (매 프레임 게임 스레드에서 호출)
+    void DispatchChanges();
+
+    // 감시 스레드 종료 (이후 Watch하면 다시 시작)
+    void Shutdown();
+
+    uint32 GetWatchedFileCount() const;
+
+    static constexpr uint32 PollIntervalMs = 500;
+
+private:
+    FFileChangeService() = default;
+    ~FFileChangeService();
+
+    FFileChangeService(const FFileChangeService&) = delete;
+    FFileChangeService& operator=(const FFileChangeService&) = delete;
+
+    struct FWatchedFile
+    {
+        FString Directory;
+        std::filesystem::file_time_type LastWriteTime{};
+        bool bExists = false;
+        uint32 ListenerCount = 0;
+    };
+
+    struct FListener
+    {
+        FString Key;
+        FString Path;       // Watch에 넘긴 경로 그대로 (콜백 인자)
+        FOnFileChanged Callback;
+    };
+
+    static FString MakeKey(const FString& InPath, FString& OutDirectory);
+
+    void StartWorker();
+    void WorkerMain();
+
+    // InDirectory에 있는 감시 파일들의 수정 시간을 확인해 바뀐 것을 PendingKeys에 추가
+    void ScanDirectory(const FString& InDirectory);
+
+    // --- 워커 스레드와 공유 (Mutex) ---
+    mutable std::mutex Mutex;
+    TMap<FString, FWatchedFile> Files;                  // 정규화된 경로 -> 감시 상태
+    TMap<FString, TArray<FString>> FilesByDirectory;    // 디렉터리 -> 정규화된 경로들
+    TSet<FString> PendingKeys;
+    bool bDirectoriesDirty = false;
+
+    std::thread Worker;
+    std::atomic<bool> bStopRequested{ false };
+    void* WakeEvent = nullptr;                          // 디렉터리 목록 변경/종료 시 워커를 깨움
+
+    // --- 게임 스레드 전용 ---
+    TMap<FFileWatchHandle, FListener> Listeners;
+    TMap<FString, TArray<FFileWatchHandle>> ListenersByKey;
+    FFileWatchHandle NextHandle = 1;
+};
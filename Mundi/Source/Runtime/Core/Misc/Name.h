@@ -2,6 +2,7 @@
 // Name.h
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 #include <algorithm>
 #include <unordered_map>
@@ -13,17 +14,31 @@ struct FNameEntry
 {
     FString Display;    // 원문
     FString Comparison; // lower-case
+    uint64 Hash = 0;    // 대소문자 무시 해시
 };
 
+/**
+ * 스레드 안전한 이름 테이블.
+ * - 대소문자 무시 해시를 임시 문자열 없이 한 번에 계산하고, 해시 상위 비트로 고른 샤드에서만 락을 잡습니다.
+ *   (이미 있는 이름 조회는 공유 락, 새 이름 추가만 배타 락)
+ * - 엔트리는 고정 크기 청크에 저장되어 추가되어도 기존 엔트리가 이동하지 않으므로 Get은 락 없이 읽습니다.
+ */
 class FNamePool
 {
 public:
-    static uint32 Add(const FString& InStr);
+    static uint32 Add(std::string_view InStr);
     static const FNameEntry& Get(uint32 Index);
+    static uint32 Num();
 
-private:
-    static TArray<FNameEntry> Entries; // 정의는 Name.cpp
-    static std::unordered_map<FString, uint32> NameMap; // 빠른 검색용
+    // 대소문자 무시 FNV-1a 64
+    static uint64 HashIgnoreCase(std::string_view InStr);
+
+    // 스레드 수별 신규 추가/기존 조회/번호 붙은 이름 생성 시간을 UE_LOG로 출력
+    static void RunBenchmark(uint32 InNamesPerThread);
+
+    static constexpr uint32 ShardCount = 16;
+    static constexpr uint32 ChunkBits = 14;                 // 청크당 16384개
+    static constexpr uint32 MaxChunks = 4096;
 };
 
 // ──────────────────────────────
@@ -33,20 +48,62 @@ struct FName
 {
     uint32 DisplayIndex = -1;
     uint32 ComparisonIndex = -1;
+    uint32 Number = 0;          // 0이면 접미사 없음, N+1이면 "_N" (풀에는 접미사 없는 이름만 저장)
 
     FName() = default;
-    FName(const char* InStr) { Init(FString(InStr)); }
+    FName(const char* InStr) { Init(std::string_view(InStr)); }
     FName(const FString& InStr) { Init(InStr); }
 
-    void Init(const FString& InStr)
+    // "InBase_InNumber" (새 풀 엔트리를 만들지 않음)
+    FName(std::string_view InBase, uint32 InNumber)
+    {
+        const uint32 Index = FNamePool::Add(InBase);
+        DisplayIndex = Index;
+        ComparisonIndex = Index;
+        Number = InNumber + 1;
+    }
+
+    // 끝의 "_숫자"는 Number로 분리 (0으로 시작하는 숫자는 분리하지 않아 원문 그대로 복원됨)
+    void Init(std::string_view InStr)
     {
-        int32_t Index = FNamePool::Add(InStr);
+        std::string_view Base = InStr;
+        Number = 0;
+
+        const size_t Underscore = InStr.find_last_of('_');
+        if (Underscore != std::string_view::npos && Underscore > 0)
+        {
+            const std::string_view Digits = InStr.substr(Underscore + 1);
+            const bool bValidLength = !Digits.empty() && Digits.size() <= 9;
+            const bool bNoLeadingZero = Digits.size() == 1 || (!Digits.empty() && Digits[0] != '0');
+            if (bValidLength && bNoLeadingZero &&
+                std::all_of(Digits.begin(), Digits.end(), [](char C) { return C >= '0' && C <= '9'; }))
+            {
+                uint32 Value = 0;
+                for (char C : Digits)
+                {
+                    Value = Value * 10 + static_cast<uint32>(C - '0');
+                }
+                Base = InStr.substr(0, Underscore);
+                Number = Value + 1;
+            }
+        }
+
+        const uint32 Index = FNamePool::Add(Base);
         DisplayIndex = Index;
         ComparisonIndex = Index; // 필요시 다른 규칙 적용 가능
     }
 
-    bool operator==(const FName& Other) const { return ComparisonIndex == Other.ComparisonIndex; }
-    FString ToString() const { return FNamePool::Get(DisplayIndex).Display; }
+    bool operator==(const FName& Other) const { return ComparisonIndex == Other.ComparisonIndex && Number == Other.Number; }
+    bool operator!=(const FName& Other) const { return !(*this == Other); }
+
+    FString ToString() const
+    {
+        if (Number == 0)
+        {
+            return FNamePool::Get(DisplayIndex).Display;
+        }
+        return FNamePool::Get(DisplayIndex).Display + "_" + std::to_string(Number - 1);
+    }
 
     friend FName operator+(const FName& A, const FName& B)
     {
@@ -62,4 +119,4 @@ struct FName
     {
         return FName(A + B.ToString());
     }
-};
\ No newline at end of file
+};
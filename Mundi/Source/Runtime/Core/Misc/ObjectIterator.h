@@ -2,19 +2,48 @@
 
 #include "ObjectFactory.h"
 
+/**
+ * TObject와 그 하위 클래스의 살아 있는 객체 순회.
+ * GUObjectArray 전체를 훑지 않고 클래스별 객체 목록(UClass::LiveObjects)만 방문합니다.
+ * 하위 클래스들은 상속 트리 전위 순서로 연속 배치되어 있으므로 [HierarchyBegin, HierarchyEnd) 범위의 클래스만 보면 됩니다.
+ *
+ * 각 목록은 앞에서부터 순회합니다. 이터레이터가 살아 있는 동안 삭제된 객체는 목록에서 슬롯만 비워지므로
+ * (ObjectFactory::BeginObjectIteration) 어떤 객체를 삭제해도 남은 객체를 건너뛰거나 두 번 방문하지 않습니다.
+ * 순회 중 새로 만든 객체는 아직 지나가지 않은 클래스/위치에 추가되면 방문될 수 있습니다.
+ */
 template<typename TObject>
 class TObjectIterator
 {
 public:
 	TObjectIterator()
 	{
-		++(*this); // 첫 번째 유효 객체로 이동
+		ObjectFactory::BeginObjectIteration();
+
+		const UClass* Class = TObject::StaticClass();
+		ClassIndex = Class->HierarchyBegin;
+		ClassEnd = Class->HierarchyEnd;
+		AdvanceToNextValidObject();
+	}
+
+	TObjectIterator(const TObjectIterator& Other)
+		: ClassIndex(Other.ClassIndex)
+		, ClassEnd(Other.ClassEnd)
+		, ObjectIndex(Other.ObjectIndex)
+	{
+		ObjectFactory::BeginObjectIteration();
+	}
+
+	TObjectIterator& operator=(const TObjectIterator& Other) = default;
+
+	~TObjectIterator()
+	{
+		ObjectFactory::EndObjectIteration();
 	}
 
 	// 다음 객체로 이동
 	TObjectIterator& operator++()
 	{
-		++CurrentIndex;
+		++ObjectIndex;
 		AdvanceToNextValidObject();
 		return *this;
 	}
@@ -22,8 +51,8 @@ public:
 	// 현재 객체에 접근
 	TObject* operator*() const
 	{
-		// 이 시점의 CurrentIndex는 유효한 TObject를 가리키고 있어야 함
-		return static_cast<TObject*>(GUObjectArray[CurrentIndex]);
+		// 이 시점의 인덱스는 유효한 TObject를 가리키고 있어야 함
+		return static_cast<TObject*>(GetClassObjects()[ObjectIndex]);
 	}
 
 	// 현재 객체에 접근 (포인터 연산자)
@@ -35,34 +64,44 @@ public:
 	// 비교 연산자
 	bool operator!=(const TObjectIterator& Other) const
 	{
-		return CurrentIndex != Other.CurrentIndex;
+		return ClassIndex != Other.ClassIndex || ObjectIndex != Other.ObjectIndex;
 	}
 
 	// bool 변환 연산자
 	explicit operator bool() const
 	{
-		// CurrentIndex가 배열 범위 내에 있는지 확인
-		return CurrentIndex < GUObjectArray.Num();
+		return ClassIndex < ClassEnd;
 	}
 
 private:
-	// 현재 인덱스부터 시작하여 다음 유효 객체를 찾는 헬퍼 함수
+	const TArray<UObject*>& GetClassObjects() const
+	{
+		return UClass::GetClassesInHierarchyOrder()[ClassIndex]->LiveObjects;
+	}
+
+	// 현재 위치부터 시작하여 다음 유효 객체를 찾는 헬퍼 함수 (순회 중 삭제로 비워진 슬롯은 건너뜀)
 	void AdvanceToNextValidObject()
 	{
-		while (CurrentIndex < GUObjectArray.Num())
+		while (ClassIndex < ClassEnd)
 		{
-			UObject* Object = GUObjectArray[CurrentIndex];
-			// 현재 객체가 유효하고, TObject 타입이면 검색 종료
-			if (Object && Object->IsA<TObject>())
+			const TArray<UObject*>& Objects = GetClassObjects();
+			while (ObjectIndex < Objects.Num() && Objects[ObjectIndex] == nullptr)
+			{
+				++ObjectIndex;
+			}
+			if (ObjectIndex < Objects.Num())
 			{
 				break;
 			}
 
-			// 다음 인덱스로 이동
-			++CurrentIndex;
+			// 다음 클래스로 이동
+			++ClassIndex;
+			ObjectIndex = 0;
 		}
 	}
 
 private:
-	int32 CurrentIndex = -1;
+	uint32 ClassIndex = 0;
+	uint32 ClassEnd = 0;
+	int32 ObjectIndex = 0;
 };
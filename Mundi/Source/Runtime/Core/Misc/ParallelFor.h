@@ -0,0 +1,89 @@
+﻿#pragma once
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "UEContainer.h"
+
+/**
+ * 간단한 병렬 for 루프.
+ * 호출 스레드를 포함해 최대 GetParallelWorkerCount()개의 스레드가 [0, InCount)를 InBatchSize 단위로 나눠 가져갑니다.
+ * 모든 작업이 끝날 때까지 호출 스레드는 반환하지 않으므로, 본문에서는 호출 스레드 전용 상태(UObject 생성, 리소스 매니저, 렌더 상태)를 건드리면 안 됩니다.
+ * 호출 스레드는 작업 중 메시지 루프/렌더링을 돌리지 않으므로 UE_LOG 정도의 공용 출력만 허용됩니다.
+ * 본문이 던진 예외는 워커 스레드 밖으로 나가지 않고(std::terminate 방지) 모든 스레드가 끝난 뒤 호출 스레드에서 다시 던집니다.
+ * 예외가 나면 남은 배치는 시작하지 않으며, 여러 개면 처음 잡힌 것 하나만 전달됩니다.
+ */
+inline uint32 GetParallelWorkerCount()
+{
+    const uint32 HardwareThreads = std::thread::hardware_concurrency();
+    return HardwareThreads > 0 ? HardwareThreads : 4;
+}
+
+template<typename FuncType>
+void ParallelFor(int32 InCount, FuncType&& InBody, int32 InBatchSize = 1, bool bForceSingleThread = false)
+{
+    if (InCount <= 0)
+    {
+        return;
+    }
+
+    InBatchSize = std::max(1, InBatchSize);
+    const int32 BatchCount = (InCount + InBatchSize - 1) / InBatchSize;
+    const int32 ThreadCount = bForceSingleThread ? 1 : std::min<int32>(BatchCount, static_cast<int32>(GetParallelWorkerCount()));
+
+    if (ThreadCount <= 1)
+    {
+        for (int32 Index = 0; Index < InCount; ++Index)
+        {
+            InBody(Index);
+        }
+        return;
+    }
+
+    std::atomic<int32> NextBatch{ 0 };
+    std::exception_ptr FirstException;
+    std::mutex ExceptionMutex;
+    auto Worker = [&]()
+    {
+        try
+        {
+            for (int32 Batch = NextBatch.fetch_add(1); Batch < BatchCount; Batch = NextBatch.fetch_add(1))
+            {
+                const int32 Begin = Batch * InBatchSize;
+                const int32 End = std::min(InCount, Begin + InBatchSize);
+                for (int32 Index = Begin; Index < End; ++Index)
+                {
+                    InBody(Index);
+                }
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> Lock(ExceptionMutex);
+            if (!FirstException)
+            {
+                FirstException = std::current_exception();
+            }
+            NextBatch.store(BatchCount);
+        }
+    };
+
+    std::vector<std::thread> Threads;
+    Threads.reserve(ThreadCount - 1);
+    for (int32 i = 1; i < ThreadCount; ++i)
+    {
+        Threads.emplace_back(Worker);
+    }
+    Worker();
+    for (std::thread& Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    if (FirstException)
+    {
+        std::rethrow_exception(FirstException);
+    }
+}
@@ -0,0 +1,143 @@
+﻿#include "pch.h"
+#include "SelfTest.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <filesystem>
+
+namespace
+{
+    struct FRegisteredSelfTest
+    {
+        FString Name;
+        FSelfTestFunction Function = nullptr;
+    };
+
+    TArray<FRegisteredSelfTest>& GetRegisteredTests()
+    {
+        static TArray<FRegisteredSelfTest> Tests;
+        return Tests;
+    }
+
+    bool ContainsIgnoreCase(const FString& InText, const FString& InPattern)
+    {
+        if (InPattern.empty())
+        {
+            return true;
+        }
+        auto It = std::search(InText.begin(), InText.end(), InPattern.begin(), InPattern.end(),
+            [](char A, char B) { return std::tolower(static_cast<unsigned char>(A)) == std::tolower(static_cast<unsigned char>(B)); });
+        return It != InText.end();
+    }
+
+    void AppendLine(FString& InOutReport, const FString& InLine)
+    {
+        UE_LOG("%s", InLine.c_str());
+        InOutReport += InLine;
+        InOutReport += "\n";
+    }
+}
+
+bool FSelfTestContext::Check(bool bCondition, const char* InExpression, const char* InFile, int32 InLine)
+{
+    ++CheckCount;
+    if (bCondition)
+    {
+        return true;
+    }
+
+    ++FailureCount;
+    const FString FileName = std::filesystem::path(InFile).filename().string();
+    Messages.Add(FileName + "(" + std::to_string(InLine) + "): " + InExpression);
+    return false;
+}
+
+void FSelfTestContext::AddInfo(const char* InFormat, ...)
+{
+    char Buffer[512];
+    va_list Args;
+    va_start(Args, InFormat);
+    vsnprintf(Buffer, sizeof(Buffer), InFormat, Args);
+    va_end(Args);
+    Messages.Add(Buffer);
+}
+
+void FSelfTestRegistry::Register(const char* InName, FSelfTestFunction InFunction)
+{
+    GetRegisteredTests().Add(FRegisteredSelfTest{ InName, InFunction });
+}
+
+int32 FSelfTestRegistry::GetTestCount()
+{
+    return GetRegisteredTests().Num();
+}
+
+int32 FSelfTestRegistry::RunTests(const FString& InFilter, FString* OutReport)
+{
+    // 등록 순서는 정적 초기화 순서라 빌드마다 다를 수 있으므로 이름순으로 실행
+    TArray<FRegisteredSelfTest> Tests = GetRegisteredTests();
+    std::sort(Tests.begin(), Tests.end(), [](const FRegisteredSelfTest& A, const FRegisteredSelfTest& B) { return A.Name < B.Name; });
+
+    FString Report;
+    AppendLine(Report, "=== Self Test" + (InFilter.empty() ? FString() : " (" + InFilter + ")") + " ===");
+
+    int32 RunCount = 0;
+    int32 FailedCount = 0;
+    for (const FRegisteredSelfTest& Registered : Tests)
+    {
+        if (!ContainsIgnoreCase(Registered.Name, InFilter))
+        {
+            continue;
+        }
+        ++RunCount;
+
+        FSelfTestContext Context;
+        const auto StartTime = std::chrono::steady_clock::now();
+        try
+        {
+            Registered.Function(Context);
+        }
+        catch (const std::exception& Exception)
+        {
+            Context.Check(false, Exception.what(), "exception", 0);
+        }
+        const double ElapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - StartTime).count();
+
+        char Line[512];
+        const bool bPassed = Context.GetFailureCount() == 0;
+        snprintf(Line, sizeof(Line), "%s %s (%d checks, %.2f ms)", bPassed ? "[O] PASS:" : "[X] FAIL:",
+            Registered.Name.c_str(), Context.GetCheckCount(), ElapsedMs);
+        AppendLine(Report, Line);
+        for (const FString& Message : Context.GetMessages())
+        {
+            AppendLine(Report, "    " + Message);
+        }
+        if (!bPassed)
+        {
+            ++FailedCount;
+        }
+    }
+
+    AppendLine(Report, "========================================");
+    char Summary[128];
+    if (RunCount == 0)
+    {
+        snprintf(Summary, sizeof(Summary), "[X] NO TESTS MATCHED!");
+        FailedCount = 1;
+    }
+    else if (FailedCount == 0)
+    {
+        snprintf(Summary, sizeof(Summary), "[O] ALL TESTS PASSED! (%d tests)", RunCount);
+    }
+    else
+    {
+        snprintf(Summary, sizeof(Summary), "[X] %d OF %d TESTS FAILED!", FailedCount, RunCount);
+    }
+    AppendLine(Report, Summary);
+
+    if (OutReport)
+    {
+        *OutReport = std::move(Report);
+    }
+    return FailedCount;
+}
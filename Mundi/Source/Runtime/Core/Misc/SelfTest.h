@@ -0,0 +1,58 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+/**
+ * 엔진 내장 단위 테스트 (창/GPU 없이 도는 CPU 코드용).
+ * 테스트는 검증 대상 코드 옆의 *Test.cpp에 IMPLEMENT_SELF_TEST로 정의하면 정적 초기화 때 등록되고,
+ * 콘솔 "TEST [필터]" 또는 헤드리스 실행 "Mundi.exe -test [필터] [-out <file>]"로 돌립니다.
+ * 결과는 main.cpp의 TestDelegate와 같은 [O] PASS / [X] FAIL 형식으로 로그와 보고서에 남습니다.
+ */
+class FSelfTestContext
+{
+public:
+    // 실패하면 위치와 식을 기록하고 false 반환 (테스트는 계속 진행)
+    bool Check(bool bCondition, const char* InExpression, const char* InFile, int32 InLine);
+
+    // 보고서에 남길 부가 정보 (실패 원인 값 등)
+    void AddInfo(const char* InFormat, ...);
+
+    int32 GetCheckCount() const { return CheckCount; }
+    int32 GetFailureCount() const { return FailureCount; }
+    const TArray<FString>& GetMessages() const { return Messages; }
+
+private:
+    int32 CheckCount = 0;
+    int32 FailureCount = 0;
+    TArray<FString> Messages;
+};
+
+using FSelfTestFunction = void(*)(FSelfTestContext& /*Test*/);
+
+class FSelfTestRegistry
+{
+public:
+    static void Register(const char* InName, FSelfTestFunction InFunction);
+
+    // 이름에 InFilter가 들어간 테스트만 실행 (대소문자 무시, 비어 있으면 전부). 실패한 테스트 수 반환
+    // 보고서는 UE_LOG로 출력하고 OutReport가 있으면 같은 내용을 담음
+    static int32 RunTests(const FString& InFilter, FString* OutReport = nullptr);
+
+    static int32 GetTestCount();
+};
+
+struct FSelfTestRegistrar
+{
+    FSelfTestRegistrar(const char* InName, FSelfTestFunction InFunction)
+    {
+        FSelfTestRegistry::Register(InName, InFunction);
+    }
+};
+
+// IMPLEMENT_SELF_TEST(ShaderCache, IncludeResolver) { SELF_TEST_CHECK(...); } -> "ShaderCache.IncludeResolver"
+#define IMPLEMENT_SELF_TEST(GroupName, TestName)                                                            \
+    static void SelfTest_##GroupName##_##TestName(FSelfTestContext& Test);                                  \
+    static FSelfTestRegistrar GSelfTestRegistrar_##GroupName##_##TestName(#GroupName "." #TestName,         \
+        &SelfTest_##GroupName##_##TestName);                                                                \
+    static void SelfTest_##GroupName##_##TestName(FSelfTestContext& Test)
+
+#define SELF_TEST_CHECK(Expression) Test.Check(static_cast<bool>(Expression), #Expression, __FILE__, __LINE__)
@@ -0,0 +1,74 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "PathUtils.h"
+
+/**
+ * 읽기 전용 메모리 매핑 파일 (RAII).
+ * 데이터는 OS 페이지 캐시에서 필요할 때 페이징되므로 파일 전체를 먼저 읽거나 복사하지 않습니다.
+ * 매핑 베이스 주소는 페이지(4KB) 정렬입니다.
+ */
+class FWindowsMappedFile
+{
+public:
+    FWindowsMappedFile() = default;
+    ~FWindowsMappedFile() { Close(); }
+
+    FWindowsMappedFile(const FWindowsMappedFile&) = delete;
+    FWindowsMappedFile& operator=(const FWindowsMappedFile&) = delete;
+
+    bool Open(const FString& Filename)
+    {
+        Close();
+
+        FWideString WFilename = UTF8ToWide(Filename);
+        FileHandle = CreateFileW(WFilename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (FileHandle == INVALID_HANDLE_VALUE)
+        {
+            FileHandle = nullptr;
+            return false;
+        }
+
+        LARGE_INTEGER FileSize = {};
+        if (!GetFileSizeEx(FileHandle, &FileSize) || FileSize.QuadPart <= 0)
+        {
+            Close();
+            return false;
+        }
+
+        MappingHandle = CreateFileMappingW(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!MappingHandle)
+        {
+            Close();
+            return false;
+        }
+
+        Data = static_cast<const uint8*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (!Data)
+        {
+            Close();
+            return false;
+        }
+
+        Size = static_cast<uint64>(FileSize.QuadPart);
+        return true;
+    }
+
+    void Close()
+    {
+        if (Data) { UnmapViewOfFile(Data); Data = nullptr; }
+        if (MappingHandle) { CloseHandle(MappingHandle); MappingHandle = nullptr; }
+        if (FileHandle) { CloseHandle(FileHandle); FileHandle = nullptr; }
+        Size = 0;
+    }
+
+    bool IsOpen() const { return Data != nullptr; }
+    const uint8* GetData() const { return Data; }
+    uint64 GetSize() const { return Size; }
+
+private:
+    HANDLE FileHandle = nullptr;
+    HANDLE MappingHandle = nullptr;
+    const uint8* Data = nullptr;
+    uint64 Size = 0;
+};
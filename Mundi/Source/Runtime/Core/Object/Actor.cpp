@@ -8,6 +8,7 @@
 #include "BillboardComponent.h"
 #include "AABB.h"
 #include "JsonSerializer.h"
+#include "LevelArchive.h"
 #include "World.h"
 #include "CollisionComponent/ShapeComponent.h"
 
@@ -49,20 +50,8 @@ void AActor::Tick(float DeltaSeconds)
 	// 에디터에서 틱 Off면 스킵
 	if (!bTickInEditor && World->bPie == false) return;
 
-	// Lua 스크립트 먼저 실행 (입력 처리를 위해)
-	for (FScript* Script : UScriptManager::GetInstance().GetScriptsOfActor(this))
-	{
-		Script->LuaTemplateFunctions.Tick(DeltaSeconds);
-	}
-
-	// 컴포넌트 Tick (Lua에서 설정한 입력 사용)
-	for (UActorComponent* Comp : OwnedComponents)
-	{
-		if (Comp && Comp->IsComponentTickEnabled())
-		{
-			Comp->TickComponent(DeltaSeconds /*, … 필요 인자*/);
-		}
-	}
+	// Lua 스크립트 Tick은 UWorld::Tick에서 UScriptManager::TickScripts로 먼저 일괄 실행됨
+	// 컴포넌트 Tick은 액터 Tick이 모두 끝난 뒤 월드 틱 매니저가 그룹별로 실행 (Lua/액터에서 설정한 입력 사용)
 }
 void AActor::EndPlay(EEndPlayReason Reason)
 {
@@ -84,13 +73,13 @@ void AActor::Destroy()
 	{
 		return;
 	}
-	MarkPendingDestroy();
-	// 월드가 있으면 월드에 위임 (여기서 더 이상 this 만지지 않기)
+	// 월드가 있으면 월드에 위임 (틱/이벤트 도중에도 안전하도록 프레임 끝에 파괴)
 	if (World) 
 	{ 
-		World->DestroyActor(this); 
+		World->DestroyActorDeferred(this); 
 		return; 
 	}
+	MarkPendingDestroy();
 
 	// 월드가 없을 때만 자체 정리
 	EndPlay(EEndPlayReason::Destroyed);
@@ -425,6 +414,23 @@ void AActor::SetActorHiddenInEditor(bool bNewHidden)
 	GWorld->GetLightManager()->SetDirtyFlag();
 }
 
+void AActor::SetActorEnableCollision(bool bNewActorEnableCollision)
+{
+	if (bActorEnableCollision == bNewActorEnableCollision)
+	{
+		return;
+	}
+	bActorEnableCollision = bNewActorEnableCollision;
+
+	for (UActorComponent* Comp : OwnedComponents)
+	{
+		if (UShapeComponent* Shape = Cast<UShapeComponent>(Comp))
+		{
+			Shape->UpdateCollisionRegistration();
+		}
+	}
+}
+
 bool AActor::IsActorVisible() const
 {
 	return GWorld->bPie ? !bHiddenInGame : !bHiddenInEditor;
@@ -592,22 +598,7 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 			}
 	
 			// 2) 컴포넌트 간 부모 자식 관계 설정
-			for (auto& Component : OwnedComponents)
-			{
-				USceneComponent* SceneComp = Cast<USceneComponent>(Component);
-				if (!SceneComp)
-				{
-					continue;
-				}
-				uint32 ParentId = SceneComp->GetParentId();
-				if (ParentId != 0) // RootComponent가 아니면 부모 설정
-				{
-					USceneComponent** ParentP = SceneComp->GetSceneIdMap().Find(ParentId);
-					USceneComponent* Parent = *ParentP;
-
-					SceneComp->SetupAttachment(Parent, EAttachmentRule::KeepRelative);
-				}
-			}
+			LinkSerializedComponents();
 		}
 
 		// Script 역직렬화
@@ -667,6 +658,124 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void AActor::SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar)
+{
+	Super::SerializeBinary(bInIsLoading, Ar);
+
+	if (bInIsLoading)
+	{
+		uint32 RootUUID = 0;
+		Ar << RootUUID;
+
+		FString NameStrTemp;
+		Ar.SerializeString(NameStrTemp);
+		SetName(NameStrTemp);
+
+		uint32 ComponentCount = 0;
+		Ar << ComponentCount;
+		for (uint32 i = 0; i < ComponentCount; ++i)
+		{
+			UClass* ComponentClass = nullptr;
+			Ar.SerializeClass(ComponentClass);
+			const uint64 Record = Ar.BeginRecord();
+
+			// 현재 빌드에 없는 컴포넌트 클래스는 레코드째 건너뜀
+			if (!ComponentClass || !ComponentClass->IsChildOf(UActorComponent::StaticClass()))
+			{
+				Ar.SkipRecord(Record);
+				continue;
+			}
+
+			UActorComponent* NewComponent = Cast<UActorComponent>(ObjectFactory::NewObject(ComponentClass));
+			NewComponent->SerializeBinary(bInIsLoading, Ar);
+			Ar.EndRecord(Record);
+
+			if (USceneComponent* NewSceneComponent = Cast<USceneComponent>(NewComponent))
+			{
+				if (RootUUID == NewSceneComponent->GetSceneId())
+				{
+					SetRootComponent(NewSceneComponent);
+				}
+			}
+
+			AddOwnedComponent(NewComponent);
+		}
+		LinkSerializedComponents();
+
+		uint32 ScriptCount = 0;
+		Ar << ScriptCount;
+		for (uint32 i = 0; i < ScriptCount; ++i)
+		{
+			FString ScriptName;
+			Ar.SerializeString(ScriptName);
+			if (!ScriptName.empty())
+			{
+				FLuaLocalValue LuaLocalValue;
+				LuaLocalValue.MyActor = this;
+				UScriptManager::GetInstance().AttachScriptTo(LuaLocalValue, ScriptName);
+			}
+		}
+	}
+	else
+	{
+		uint32 RootUUID = RootComponent ? RootComponent->UUID : 0;
+		Ar << RootUUID;
+
+		FString NameStrTemp = GetName().ToString();
+		Ar.SerializeString(NameStrTemp);
+
+		// 에디터 전용 컴포넌트는 직렬화하지 않음 (OnRegister()에서 매번 새로 생성됨)
+		TArray<UActorComponent*> EditableComponents;
+		for (UActorComponent* Component : OwnedComponents)
+		{
+			if (Component->IsEditable())
+			{
+				EditableComponents.Add(Component);
+			}
+		}
+
+		uint32 ComponentCount = static_cast<uint32>(EditableComponents.size());
+		Ar << ComponentCount;
+		for (UActorComponent* Component : EditableComponents)
+		{
+			UClass* ComponentClass = Component->GetClass();
+			Ar.SerializeClass(ComponentClass);
+			const uint64 Record = Ar.BeginRecord();
+			Component->SerializeBinary(bInIsLoading, Ar);
+			Ar.EndRecord(Record);
+		}
+
+		TArray<FScript*> Scripts = UScriptManager::GetInstance().GetScriptsOfActor(this);
+		uint32 ScriptCount = static_cast<uint32>(Scripts.size());
+		Ar << ScriptCount;
+		for (FScript* Script : Scripts)
+		{
+			FString ScriptName = Script ? Script->ScriptName : FString();
+			Ar.SerializeString(ScriptName);
+		}
+	}
+}
+
+void AActor::LinkSerializedComponents()
+{
+	for (auto& Component : OwnedComponents)
+	{
+		USceneComponent* SceneComp = Cast<USceneComponent>(Component);
+		if (!SceneComp)
+		{
+			continue;
+		}
+		uint32 ParentId = SceneComp->GetParentId();
+		if (ParentId != 0) // RootComponent가 아니면 부모 설정
+		{
+			USceneComponent** ParentP = SceneComp->GetSceneIdMap().Find(ParentId);
+			USceneComponent* Parent = *ParentP;
+
+			SceneComp->SetupAttachment(Parent, EAttachmentRule::KeepRelative);
+		}
+	}
+}
+
 //AActor* AActor::Duplicate()
 //{
 //	AActor* NewActor = ObjectFactory::DuplicateObject<AActor>(this); // 모든 멤버 얕은 복사
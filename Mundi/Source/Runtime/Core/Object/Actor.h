@@ -109,6 +109,13 @@ public:
     // 틱 플래그
     void SetTickInEditor(bool b) { bTickInEditor = b; }
     bool GetTickInEditor() const { return bTickInEditor; }
+    // false면 액터/스크립트/컴포넌트 틱을 모두 건너뜀 (풀에 보관 중이거나 파괴 대기 중인 액터)
+    void SetActorTickEnabled(bool bEnabled) { bActorTickEnabled = bEnabled; }
+    bool IsActorTickEnabled() const { return bActorTickEnabled; }
+
+    // 충돌 (false면 소유한 Shape 컴포넌트가 CollisionManager에서 빠지고 Overlap 이벤트를 만들지 않음)
+    void SetActorEnableCollision(bool bNewActorEnableCollision);
+    bool GetActorEnableCollision() const { return bActorEnableCollision; }
 
     // 바운드 및 피킹
     virtual FAABB GetBounds() const { return FAABB(); }
@@ -146,6 +153,7 @@ public:
 
     // Serialize
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+    void SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar) override;
 
 public:
     FName Name;
@@ -168,7 +176,10 @@ protected:
     bool bIsPicked = false;
     bool bCanEverTick = true;
     bool bIsCulled = false;
+    bool bActorTickEnabled = true;
+    bool bActorEnableCollision = true;
 
 private:
-   
+    // 역직렬화된 씬 컴포넌트들을 ParentId 기준으로 다시 붙임
+    void LinkSerializedComponents();
 };
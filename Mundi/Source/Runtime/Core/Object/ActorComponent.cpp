@@ -20,6 +20,7 @@ UActorComponent::UActorComponent()
     , bHasBegunPlay(false)
     , bPendingDestroy(false)
 {
+    PrimaryComponentTick.Target = this;
 }
 
 UActorComponent::~UActorComponent()
@@ -46,6 +47,12 @@ void UActorComponent::RegisterComponent(UWorld* InWorld)
     bRegistered = true;
     OnRegister(InWorld);
 
+    if (bCanEverTick && InWorld)
+    {
+        PrimaryComponentTick.Target = this;
+        PrimaryComponentTick.RegisterTickFunction(InWorld->GetTickManager());
+    }
+
 
     // 여기서는 게임 수명 훅을 직접 부르지 않음.
     // BeginPlay/InitializeComponent는 보통 Actor/World 타이밍에서 호출.
@@ -63,6 +70,7 @@ void UActorComponent::UnregisterComponent()
         bHasBegunPlay = false;
     }
 
+    PrimaryComponentTick.UnregisterTickFunction();
     OnUnregister();
     bRegistered = false;
 }
@@ -123,6 +131,7 @@ void UActorComponent::DuplicateSubObjects()
 
     bCanEverTick = true; // 매 프레임 Tick 가능 여부
     Owner = nullptr; // Actor에서 이거 설정해 줌
+    PrimaryComponentTick.Target = this; // 복사된 틱 함수는 원본을 가리키므로 재설정
 }
 
 void UActorComponent::PostDuplicate()
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Object.h"
+#include "TickManager.h"
 
 class AActor;
 class UWorld;
@@ -28,6 +29,12 @@ public:
     virtual void InitializeComponent();                // BeginPlay 전에 1회
     virtual void BeginPlay();                          // 월드 시작 시 1회
     virtual void TickComponent(float DeltaTime);       // 매 프레임
+
+    // PrimaryComponentTick.bRunOnAnyThread인 컴포넌트용 병렬 틱 (틱 매니저가 TickComponent 대신 호출)
+    // TickComponentParallel: 워커 스레드. 자기 상태만 계산하고 다른 오브젝트/월드에는 쓰지 않음
+    // ApplyParallelTick: 메인 스레드. 계산 결과를 트랜스폼 등에 반영 (등록 순서대로)
+    virtual void TickComponentParallel(float DeltaTime) { }
+    virtual void ApplyParallelTick() { }
     virtual void EndPlay(EEndPlayReason Reason);       // 파괴/월드 제거 시
 
     // ─────────────── Registration (월드/씬 등록 수명)
@@ -54,6 +61,9 @@ public:
     void SetCanEverTick(bool b) { bCanEverTick = b; }
     bool CanEverTick() const { return bCanEverTick; }
 
+    // 틱 그룹/간격/선행 조건/슬립 설정. bCanEverTick이면 RegisterComponent 시 월드 틱 매니저에 등록됨
+    FActorComponentTickFunction PrimaryComponentTick;
+
     bool IsComponentTickEnabled() const
     {
         // 틱을 진짜 돌릴지 최종 판단(액터 Tick에서 이걸로 거른다)
@@ -0,0 +1,757 @@
+﻿#include "pch.h"
+#include "LevelArchive.h"
+#include "Crc.h"
+#include "Material.h"
+
+namespace
+{
+    // 고정 블록 안에서 프로퍼티가 차지하는 크기
+    // Array는 블록 뒤에 가변 길이로, ObjectPtr/Struct는 JSON 직렬화와 동일하게 저장하지 않음
+    uint32 GetBlockSlotSize(EPropertyType InType)
+    {
+        switch (InType)
+        {
+        case EPropertyType::Bool:
+        case EPropertyType::Enum:
+            return 1;
+        case EPropertyType::Int32:
+        case EPropertyType::Float:
+            return 4;
+        case EPropertyType::FVector:
+            return sizeof(FVector);
+        case EPropertyType::FLinearColor:
+            return sizeof(FLinearColor);
+        case EPropertyType::FString:
+        case EPropertyType::FName:
+        case EPropertyType::Texture:
+        case EPropertyType::StaticMesh:
+        case EPropertyType::Material:
+            return sizeof(uint32);  // 문자열 테이블 인덱스
+        default:
+            return 0;
+        }
+    }
+
+    uint32 GetArrayElementSize(EPropertyType InInnerType)
+    {
+        switch (InInnerType)
+        {
+        case EPropertyType::Bool:
+            return 1;
+        case EPropertyType::Int32:
+        case EPropertyType::Float:
+        case EPropertyType::FString:
+            return 4;
+        default:
+            return 0;
+        }
+    }
+
+    inline uint32 ReadSlotIndex(const uint8* InSlot)
+    {
+        uint32 Index;
+        memcpy(&Index, InSlot, sizeof(uint32));
+        return Index;
+    }
+
+    template<typename T>
+    void AppendBytes(TArray<uint8>& OutBytes, const T& InValue)
+    {
+        const uint8* Src = reinterpret_cast<const uint8*>(&InValue);
+        OutBytes.insert(OutBytes.end(), Src, Src + sizeof(T));
+    }
+
+    struct FClassTableEntry
+    {
+        uint32 NameIndex;
+        uint32 SchemaHash;
+        uint32 BlockSize;
+        uint32 PropertyCount;
+    };
+
+    struct FPropertyTableEntry
+    {
+        uint32 NameIndex;
+        uint8 Type;
+        uint8 InnerType;
+        uint16 Padding;
+        uint32 BlockOffset;
+    };
+
+    inline bool Fail(FString* OutError, const char* InMessage)
+    {
+        if (OutError)
+        {
+            *OutError = InMessage;
+        }
+        return false;
+    }
+}
+
+FLevelArchive::FLevelArchive(bool bInIsLoading)
+    : FArchive(bInIsLoading, !bInIsLoading)
+{
+}
+
+void FLevelArchive::Serialize(void* Data, int64 Length)
+{
+    if (Length <= 0)
+    {
+        return;
+    }
+
+    if (bIsSaving)
+    {
+        const uint8* Src = static_cast<const uint8*>(Data);
+        Buffer.insert(Buffer.end(), Src, Src + Length);
+    }
+    else
+    {
+        if (Cursor + static_cast<uint64>(Length) > BodyEnd)
+        {
+            throw std::runtime_error("Level binary corrupt: read past end of data.");
+        }
+        memcpy(Data, Buffer.data() + Cursor, static_cast<size_t>(Length));
+        Cursor += static_cast<uint64>(Length);
+    }
+}
+
+uint32 FLevelArchive::AddString(const FString& InString)
+{
+    if (const uint32* Found = StringLookup.Find(InString))
+    {
+        return *Found;
+    }
+    const uint32 Index = static_cast<uint32>(Strings.size());
+    Strings.Add(InString);
+    StringLookup.Add(InString, Index);
+    return Index;
+}
+
+const FString& FLevelArchive::GetString(uint32 InIndex) const
+{
+    if (InIndex >= Strings.size())
+    {
+        throw std::runtime_error("Level binary corrupt: string index out of range.");
+    }
+    return Strings[InIndex];
+}
+
+void FLevelArchive::SerializeString(FString& InOutString)
+{
+    if (bIsSaving)
+    {
+        WriteValue<uint32>(AddString(InOutString));
+    }
+    else
+    {
+        InOutString = GetString(ReadValue<uint32>());
+    }
+}
+
+void FLevelArchive::SerializeName(FName& InOutName)
+{
+    if (bIsSaving)
+    {
+        WriteValue<uint32>(AddString(InOutName.ToString()));
+    }
+    else
+    {
+        InOutName = FName(GetString(ReadValue<uint32>()));
+    }
+}
+
+uint32 FLevelArchive::ComputeSchemaHash(const UClass* InClass)
+{
+    uint32 Hash = 0;
+    for (const FProperty& Prop : InClass->GetAllProperties())
+    {
+        const uint8 Types[2] = { static_cast<uint8>(Prop.Type), static_cast<uint8>(Prop.InnerType) };
+        Hash = FCrc::MemCrc32(Prop.Name, strlen(Prop.Name), Hash);
+        Hash = FCrc::MemCrc32(Types, sizeof(Types), Hash);
+    }
+    return Hash;
+}
+
+uint32 FLevelArchive::AddClassLayout(UClass* InClass)
+{
+    if (const uint32* Found = ClassLookup.Find(InClass))
+    {
+        return *Found;
+    }
+
+    FLevelClassLayout Layout;
+    Layout.Class = InClass;
+    Layout.NameIndex = AddString(InClass->Name);
+    Layout.SchemaHash = ComputeSchemaHash(InClass);
+
+    const TArray<FProperty>& Properties = InClass->GetAllProperties();
+    Layout.Properties.reserve(Properties.size());
+    for (const FProperty& Prop : Properties)
+    {
+        FLevelPropertyLayout PropLayout;
+        PropLayout.NameIndex = AddString(Prop.Name);
+        PropLayout.Type = Prop.Type;
+        PropLayout.InnerType = Prop.InnerType;
+        PropLayout.BlockOffset = Layout.BlockSize;
+        PropLayout.RuntimeProperty = &Prop;
+        Layout.BlockSize += GetBlockSlotSize(Prop.Type);
+        Layout.Properties.Add(PropLayout);
+    }
+
+    const uint32 Index = static_cast<uint32>(ClassLayouts.size());
+    ClassLayouts.Add(std::move(Layout));
+    ClassLookup.Add(InClass, Index);
+    return Index;
+}
+
+void FLevelArchive::ResolveClassLayout(FLevelClassLayout& InOutLayout)
+{
+    InOutLayout.Class = UClass::FindClass(GetString(InOutLayout.NameIndex));
+    if (!InOutLayout.Class)
+    {
+        InOutLayout.bSchemaMatches = false;
+        return;
+    }
+
+    ClassLookup.Add(InOutLayout.Class, static_cast<uint32>(&InOutLayout - ClassLayouts.data()));
+
+    const TArray<FProperty>& RuntimeProperties = InOutLayout.Class->GetAllProperties();
+    InOutLayout.bSchemaMatches = InOutLayout.SchemaHash == ComputeSchemaHash(InOutLayout.Class)
+        && InOutLayout.Properties.size() == RuntimeProperties.size();
+
+    if (InOutLayout.bSchemaMatches)
+    {
+        // 스키마가 같으면 순서대로 1:1 대응
+        for (size_t i = 0; i < InOutLayout.Properties.size(); ++i)
+        {
+            InOutLayout.Properties[i].RuntimeProperty = &RuntimeProperties[i];
+        }
+        return;
+    }
+
+    // 스키마가 다르면 이름/타입이 같은 프로퍼티만 대응 (없어진 프로퍼티는 건너뛰고, 새 프로퍼티는 기본값 유지)
+    for (FLevelPropertyLayout& PropLayout : InOutLayout.Properties)
+    {
+        const FString& PropName = GetString(PropLayout.NameIndex);
+        for (const FProperty& Prop : RuntimeProperties)
+        {
+            if (Prop.Type == PropLayout.Type && Prop.InnerType == PropLayout.InnerType && PropName == Prop.Name)
+            {
+                PropLayout.RuntimeProperty = &Prop;
+                break;
+            }
+        }
+    }
+}
+
+uint32 FLevelArchive::GetRemappedClassCount() const
+{
+    uint32 Count = 0;
+    for (const FLevelClassLayout& Layout : ClassLayouts)
+    {
+        if (Layout.Class && !Layout.bSchemaMatches)
+        {
+            ++Count;
+        }
+    }
+    return Count;
+}
+
+void FLevelArchive::SerializeClass(UClass*& InOutClass)
+{
+    if (bIsSaving)
+    {
+        WriteValue<uint32>(InOutClass ? AddClassLayout(InOutClass) : UINT32_MAX);
+    }
+    else
+    {
+        const uint32 Index = ReadValue<uint32>();
+        if (Index == UINT32_MAX)
+        {
+            InOutClass = nullptr;
+            return;
+        }
+        if (Index >= ClassLayouts.size())
+        {
+            throw std::runtime_error("Level binary corrupt: class index out of range.");
+        }
+        InOutClass = ClassLayouts[Index].Class;
+    }
+}
+
+void FLevelArchive::SerializeProperties(UObject* InObject)
+{
+    UClass* Class = InObject->GetClass();
+
+    if (bIsSaving)
+    {
+        const FLevelClassLayout& Layout = ClassLayouts[AddClassLayout(Class)];
+
+        const size_t BlockStart = Buffer.size();
+        Buffer.resize(BlockStart + Layout.BlockSize, 0);
+        uint8* Block = Buffer.data() + BlockStart;
+
+        for (const FLevelPropertyLayout& PropLayout : Layout.Properties)
+        {
+            const FProperty& Prop = *PropLayout.RuntimeProperty;
+            uint8* Slot = Block + PropLayout.BlockOffset;
+            uint32 StringIndex = 0;
+
+            switch (Prop.Type)
+            {
+            case EPropertyType::Bool:
+                *Slot = *Prop.GetValuePtr<bool>(InObject) ? 1 : 0;
+                break;
+            case EPropertyType::Enum:
+                *Slot = *Prop.GetValuePtr<uint8>(InObject);
+                break;
+            case EPropertyType::Int32:
+            case EPropertyType::Float:
+            case EPropertyType::FVector:
+            case EPropertyType::FLinearColor:
+                memcpy(Slot, Prop.GetValuePtr<uint8>(InObject), GetBlockSlotSize(Prop.Type));
+                break;
+            case EPropertyType::FString:
+                StringIndex = AddString(*Prop.GetValuePtr<FString>(InObject));
+                memcpy(Slot, &StringIndex, sizeof(uint32));
+                break;
+            case EPropertyType::FName:
+                StringIndex = AddString(Prop.GetValuePtr<FName>(InObject)->ToString());
+                memcpy(Slot, &StringIndex, sizeof(uint32));
+                break;
+            case EPropertyType::Texture:
+            {
+                UTexture* Texture = *Prop.GetValuePtr<UTexture*>(InObject);
+                StringIndex = AddString(Texture ? Texture->GetFilePath() : FString());
+                memcpy(Slot, &StringIndex, sizeof(uint32));
+                break;
+            }
+            case EPropertyType::StaticMesh:
+            {
+                UStaticMesh* StaticMesh = *Prop.GetValuePtr<UStaticMesh*>(InObject);
+                StringIndex = AddString(StaticMesh ? StaticMesh->GetAssetPathFileName() : FString());
+                memcpy(Slot, &StringIndex, sizeof(uint32));
+                break;
+            }
+            case EPropertyType::Material:
+            {
+                UMaterial* Material = *Prop.GetValuePtr<UMaterial*>(InObject);
+                StringIndex = AddString(Material ? Material->GetFilePath() : FString());
+                memcpy(Slot, &StringIndex, sizeof(uint32));
+                break;
+            }
+            default:
+                break;
+            }
+        }
+
+        for (const FLevelPropertyLayout& PropLayout : Layout.Properties)
+        {
+            if (PropLayout.Type == EPropertyType::Array)
+            {
+                SerializeArrayProperty(InObject, PropLayout);
+            }
+        }
+        return;
+    }
+
+    const uint32* LayoutIndex = ClassLookup.Find(Class);
+    if (!LayoutIndex)
+    {
+        throw std::runtime_error("Level binary corrupt: object class has no layout.");
+    }
+    const FLevelClassLayout& Layout = ClassLayouts[*LayoutIndex];
+
+    if (Cursor + Layout.BlockSize > BodyEnd)
+    {
+        throw std::runtime_error("Level binary corrupt: property block out of range.");
+    }
+    const uint8* Block = Buffer.data() + Cursor;
+    Cursor += Layout.BlockSize;
+
+    for (const FLevelPropertyLayout& PropLayout : Layout.Properties)
+    {
+        if (!PropLayout.RuntimeProperty)
+        {
+            continue;
+        }
+
+        const FProperty& Prop = *PropLayout.RuntimeProperty;
+        const uint8* Slot = Block + PropLayout.BlockOffset;
+
+        switch (Prop.Type)
+        {
+        case EPropertyType::Bool:
+            *Prop.GetValuePtr<bool>(InObject) = *Slot != 0;
+            break;
+        case EPropertyType::Enum:
+            *Prop.GetValuePtr<uint8>(InObject) = *Slot;
+            break;
+        case EPropertyType::Int32:
+        case EPropertyType::Float:
+        case EPropertyType::FVector:
+        case EPropertyType::FLinearColor:
+            memcpy(Prop.GetValuePtr<uint8>(InObject), Slot, GetBlockSlotSize(Prop.Type));
+            break;
+        case EPropertyType::FString:
+            *Prop.GetValuePtr<FString>(InObject) = GetString(ReadSlotIndex(Slot));
+            break;
+        case EPropertyType::FName:
+            *Prop.GetValuePtr<FName>(InObject) = FName(GetString(ReadSlotIndex(Slot)));
+            break;
+        case EPropertyType::Texture:
+        {
+            const FString& Path = GetString(ReadSlotIndex(Slot));
+            *Prop.GetValuePtr<UTexture*>(InObject) = Path.empty() ? nullptr : UResourceManager::GetInstance().Load<UTexture>(Path);
+            break;
+        }
+        case EPropertyType::StaticMesh:
+        {
+            const FString& Path = GetString(ReadSlotIndex(Slot));
+            *Prop.GetValuePtr<UStaticMesh*>(InObject) = Path.empty() ? nullptr : UResourceManager::GetInstance().Load<UStaticMesh>(Path);
+            break;
+        }
+        case EPropertyType::Material:
+        {
+            const FString& Path = GetString(ReadSlotIndex(Slot));
+            *Prop.GetValuePtr<UMaterial*>(InObject) = Path.empty() ? nullptr : UResourceManager::GetInstance().Load<UMaterial>(Path);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    for (const FLevelPropertyLayout& PropLayout : Layout.Properties)
+    {
+        if (PropLayout.Type == EPropertyType::Array)
+        {
+            SerializeArrayProperty(InObject, PropLayout);
+        }
+    }
+}
+
+template<typename T>
+void FLevelArchive::SerializePodArray(TArray<T>& InOutArray, uint32 InLoadCount)
+{
+    if (bIsSaving)
+    {
+        WriteValue<uint32>(static_cast<uint32>(InOutArray.size()));
+        Serialize(InOutArray.data(), static_cast<int64>(InOutArray.size() * sizeof(T)));
+    }
+    else
+    {
+        InOutArray.resize(InLoadCount);
+        Serialize(InOutArray.data(), static_cast<int64>(InLoadCount * sizeof(T)));
+    }
+}
+
+void FLevelArchive::SerializeArrayProperty(UObject* InObject, const FLevelPropertyLayout& InLayout)
+{
+    const uint32 ElementSize = GetArrayElementSize(InLayout.InnerType);
+    const FProperty* Prop = InLayout.RuntimeProperty;
+
+    uint32 Count = 0;
+    if (bIsLoading)
+    {
+        Count = ReadValue<uint32>();
+        if (Count > Serialization::MAX_REASONABLE_ARRAY_SIZE || Cursor + static_cast<uint64>(Count) * ElementSize > BodyEnd)
+        {
+            throw std::runtime_error("Level binary corrupt: array size is unreasonable.");
+        }
+
+        // 현재 클래스에 없는 프로퍼티면 건너뜀
+        if (!Prop)
+        {
+            Cursor += static_cast<uint64>(Count) * ElementSize;
+            return;
+        }
+    }
+
+    switch (InLayout.InnerType)
+    {
+    case EPropertyType::Int32:
+        SerializePodArray(*Prop->GetValuePtr<TArray<int32>>(InObject), Count);
+        break;
+    case EPropertyType::Float:
+        SerializePodArray(*Prop->GetValuePtr<TArray<float>>(InObject), Count);
+        break;
+    case EPropertyType::Bool:
+    {
+        // TArray<bool>은 비트 압축(std::vector<bool>)이라 원소 단위로 처리
+        TArray<bool>& Array = *Prop->GetValuePtr<TArray<bool>>(InObject);
+        if (bIsSaving)
+        {
+            WriteValue<uint32>(static_cast<uint32>(Array.size()));
+            for (bool bValue : Array)
+            {
+                WriteValue<uint8>(bValue ? 1 : 0);
+            }
+        }
+        else
+        {
+            Array.clear();
+            for (uint32 i = 0; i < Count; ++i)
+            {
+                Array.Add(ReadValue<uint8>() != 0);
+            }
+        }
+        break;
+    }
+    case EPropertyType::FString:
+    {
+        TArray<FString>& Array = *Prop->GetValuePtr<TArray<FString>>(InObject);
+        if (bIsSaving)
+        {
+            WriteValue<uint32>(static_cast<uint32>(Array.size()));
+            for (const FString& Value : Array)
+            {
+                WriteValue<uint32>(AddString(Value));
+            }
+        }
+        else
+        {
+            Array.clear();
+            Array.reserve(Count);
+            for (uint32 i = 0; i < Count; ++i)
+            {
+                Array.Add(GetString(ReadValue<uint32>()));
+            }
+        }
+        break;
+    }
+    default:
+        // 지원하지 않는 InnerType은 빈 배열로 기록 (JSON 직렬화도 건너뜀)
+        if (bIsSaving)
+        {
+            WriteValue<uint32>(0);
+        }
+        break;
+    }
+}
+
+uint64 FLevelArchive::BeginRecord()
+{
+    if (bIsSaving)
+    {
+        const uint64 SizePosition = Buffer.size();
+        WriteValue<uint32>(0);
+        return SizePosition;
+    }
+
+    const uint32 RecordSize = ReadValue<uint32>();
+    if (Cursor + RecordSize > BodyEnd)
+    {
+        throw std::runtime_error("Level binary corrupt: record out of range.");
+    }
+    return Cursor + RecordSize;
+}
+
+void FLevelArchive::EndRecord(uint64 InRecordToken)
+{
+    if (bIsSaving)
+    {
+        const uint32 RecordSize = static_cast<uint32>(Buffer.size() - InRecordToken - sizeof(uint32));
+        memcpy(Buffer.data() + InRecordToken, &RecordSize, sizeof(uint32));
+    }
+    else if (Cursor != InRecordToken)
+    {
+        throw std::runtime_error("Level binary corrupt: record size mismatch.");
+    }
+}
+
+void FLevelArchive::SkipRecord(uint64 InRecordToken)
+{
+    if (bIsLoading)
+    {
+        Cursor = InRecordToken;
+    }
+}
+
+void FLevelArchive::WriteFileImage(TArray<uint8>& OutBytes) const
+{
+    OutBytes.clear();
+
+    uint64 StringBytes = 0;
+    for (const FString& String : Strings)
+    {
+        StringBytes += sizeof(uint32) + String.size();
+    }
+    OutBytes.reserve(sizeof(FLevelFileHeader) + StringBytes + ClassLayouts.size() * 64 + Buffer.size());
+    OutBytes.resize(sizeof(FLevelFileHeader));
+
+    // 문자열 테이블
+    for (const FString& String : Strings)
+    {
+        AppendBytes(OutBytes, static_cast<uint32>(String.size()));
+        OutBytes.insert(OutBytes.end(), String.begin(), String.end());
+    }
+
+    // 클래스 레이아웃 테이블
+    for (const FLevelClassLayout& Layout : ClassLayouts)
+    {
+        AppendBytes(OutBytes, FClassTableEntry{ Layout.NameIndex, Layout.SchemaHash, Layout.BlockSize, static_cast<uint32>(Layout.Properties.size()) });
+        for (const FLevelPropertyLayout& PropLayout : Layout.Properties)
+        {
+            AppendBytes(OutBytes, FPropertyTableEntry{ PropLayout.NameIndex, static_cast<uint8>(PropLayout.Type), static_cast<uint8>(PropLayout.InnerType), 0, PropLayout.BlockOffset });
+        }
+    }
+
+    // 본문
+    OutBytes.insert(OutBytes.end(), Buffer.begin(), Buffer.end());
+
+    FLevelFileHeader Header = {};
+    Header.Magic = LEVEL_BINARY_MAGIC;
+    Header.Version = LEVEL_BINARY_VERSION;
+    Header.PayloadSize = OutBytes.size() - sizeof(FLevelFileHeader);
+    Header.PayloadChecksum = FCrc::MemCrc32(OutBytes.data() + sizeof(FLevelFileHeader), Header.PayloadSize);
+    Header.StringCount = static_cast<uint32>(Strings.size());
+    Header.ClassCount = static_cast<uint32>(ClassLayouts.size());
+    memcpy(OutBytes.data(), &Header, sizeof(Header));
+}
+
+bool FLevelArchive::SaveToFile(const FString& InFilePath) const
+{
+    TArray<uint8> Bytes;
+    WriteFileImage(Bytes);
+
+    std::ofstream File(std::filesystem::path(UTF8ToWide(InFilePath)), std::ios::binary | std::ios::trunc);
+    if (!File.is_open())
+    {
+        return false;
+    }
+    File.write(reinterpret_cast<const char*>(Bytes.data()), static_cast<std::streamsize>(Bytes.size()));
+    return File.good();
+}
+
+bool FLevelArchive::LoadFromFile(const FString& InFilePath, FString* OutError)
+{
+    std::ifstream File(std::filesystem::path(UTF8ToWide(InFilePath)), std::ios::binary | std::ios::ate);
+    if (!File.is_open())
+    {
+        return Fail(OutError, "Failed to open level file");
+    }
+
+    TArray<uint8> Bytes;
+    Bytes.resize(static_cast<size_t>(File.tellg()));
+    File.seekg(0);
+    File.read(reinterpret_cast<char*>(Bytes.data()), static_cast<std::streamsize>(Bytes.size()));
+    if (!File.good())
+    {
+        return Fail(OutError, "Failed to read level file");
+    }
+    return ReadFileImage(Bytes, OutError);
+}
+
+bool FLevelArchive::ReadFileImage(const TArray<uint8>& InBytes, FString* OutError)
+{
+    if (!bIsLoading)
+    {
+        return Fail(OutError, "Archive is not in loading mode");
+    }
+
+    Buffer = InBytes;
+    Strings.clear();
+    ClassLayouts.clear();
+    ClassLookup.clear();
+
+    if (Buffer.size() < sizeof(FLevelFileHeader))
+    {
+        return Fail(OutError, "File too small");
+    }
+
+    FLevelFileHeader Header;
+    memcpy(&Header, Buffer.data(), sizeof(Header));
+    if (Header.Magic != LEVEL_BINARY_MAGIC)
+    {
+        return Fail(OutError, "Not a binary level file");
+    }
+    if (Header.Version != LEVEL_BINARY_VERSION)
+    {
+        return Fail(OutError, "Unsupported binary level version");
+    }
+    if (Header.PayloadSize != Buffer.size() - sizeof(FLevelFileHeader))
+    {
+        return Fail(OutError, "File size mismatch (truncated?)");
+    }
+    if (FCrc::MemCrc32(Buffer.data() + sizeof(FLevelFileHeader), Header.PayloadSize) != Header.PayloadChecksum)
+    {
+        return Fail(OutError, "Checksum mismatch");
+    }
+
+    Cursor = sizeof(FLevelFileHeader);
+    BodyEnd = Buffer.size();
+
+    try
+    {
+        // 문자열 테이블
+        if (Header.StringCount > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+        {
+            return Fail(OutError, "String count is unreasonable");
+        }
+        Strings.reserve(Header.StringCount);
+        for (uint32 i = 0; i < Header.StringCount; ++i)
+        {
+            const uint32 Length = ReadValue<uint32>();
+            if (Cursor + Length > BodyEnd)
+            {
+                return Fail(OutError, "String out of range");
+            }
+            Strings.Add(FString(reinterpret_cast<const char*>(Buffer.data() + Cursor), Length));
+            Cursor += Length;
+        }
+
+        // 클래스 레이아웃 테이블
+        if (Header.ClassCount > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+        {
+            return Fail(OutError, "Class count is unreasonable");
+        }
+        ClassLayouts.resize(Header.ClassCount);
+        for (FLevelClassLayout& Layout : ClassLayouts)
+        {
+            const FClassTableEntry Entry = ReadValue<FClassTableEntry>();
+            if (Entry.NameIndex >= Strings.size() || Entry.PropertyCount > 4096)
+            {
+                return Fail(OutError, "Invalid class layout");
+            }
+            Layout.NameIndex = Entry.NameIndex;
+            Layout.SchemaHash = Entry.SchemaHash;
+            Layout.BlockSize = Entry.BlockSize;
+            Layout.Properties.resize(Entry.PropertyCount);
+            for (FLevelPropertyLayout& PropLayout : Layout.Properties)
+            {
+                const FPropertyTableEntry PropEntry = ReadValue<FPropertyTableEntry>();
+                PropLayout.NameIndex = PropEntry.NameIndex;
+                PropLayout.Type = static_cast<EPropertyType>(PropEntry.Type);
+                PropLayout.InnerType = static_cast<EPropertyType>(PropEntry.InnerType);
+                PropLayout.BlockOffset = PropEntry.BlockOffset;
+                if (PropLayout.NameIndex >= Strings.size() || PropLayout.BlockOffset + GetBlockSlotSize(PropLayout.Type) > Layout.BlockSize)
+                {
+                    return Fail(OutError, "Invalid property layout");
+                }
+            }
+        }
+    }
+    catch (const std::exception&)
+    {
+        return Fail(OutError, "Table out of range");
+    }
+
+    for (FLevelClassLayout& Layout : ClassLayouts)
+    {
+        ResolveClassLayout(Layout);
+    }
+    return true;
+}
+
+bool FLevelArchive::IsLevelBinaryFile(const FString& InFilePath)
+{
+    std::ifstream File(std::filesystem::path(UTF8ToWide(InFilePath)), std::ios::binary);
+    uint32 Magic = 0;
+    if (!File.is_open() || !File.read(reinterpret_cast<char*>(&Magic), sizeof(Magic)))
+    {
+        return false;
+    }
+    return Magic == LEVEL_BINARY_MAGIC;
+}
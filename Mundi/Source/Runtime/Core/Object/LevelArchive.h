@@ -0,0 +1,126 @@
+﻿#pragma once
+#include "Archive.h"
+#include "Object.h"
+
+/**
+ * 바이너리 레벨 포맷 (.level)
+ *
+ *   [FLevelFileHeader 32B][문자열 테이블][클래스 레이아웃 테이블][본문]
+ *
+ * - 문자열 테이블: FName, 에셋 경로, 클래스/프로퍼티 이름은 한 번만 저장하고 본문에서는 uint32 인덱스로 참조합니다.
+ * - 클래스 레이아웃 테이블: 레벨에 등장하는 클래스마다 GetAllProperties() 순서의 (이름, 타입, 블록 오프셋)과 스키마 해시를 저장합니다.
+ *   로드 시 해시가 현재 클래스와 같으면 그대로 대응시키고, 다르면 이름/타입이 같은 프로퍼티만 골라 읽습니다. (추가/삭제된 프로퍼티 허용)
+ * - 본문: 오브젝트마다 리플렉션 프로퍼티를 고정 크기 블록 하나로 저장합니다. (키 검색/텍스트 파싱 없음)
+ *   블록 뒤에는 배열 프로퍼티와, 각 클래스 SerializeBinary()가 기록하는 리플렉션 외 상태가 이어집니다.
+ * - 헤더 이후 전체에 CRC32를 두어 손상된 파일은 로드하지 않습니다.
+ *
+ * JSON(.scene)은 교환 포맷으로 유지되며 ULevelService::ConvertLevelFile로 상호 변환합니다.
+ */
+constexpr uint32 LEVEL_BINARY_MAGIC = 0x4C56454C; // "LEVL"
+constexpr uint32 LEVEL_BINARY_VERSION = 1;
+
+struct FLevelFileHeader
+{
+    uint32 Magic;
+    uint32 Version;
+    uint64 PayloadSize;         // 헤더 이후 바이트 수
+    uint32 PayloadChecksum;     // 헤더 이후 전체 CRC32
+    uint32 StringCount;
+    uint32 ClassCount;
+    uint32 Reserved;
+};
+static_assert(sizeof(FLevelFileHeader) == 32, "FLevelFileHeader must be 32 bytes");
+
+// 파일에 기록된 프로퍼티 1개의 레이아웃
+struct FLevelPropertyLayout
+{
+    uint32 NameIndex = 0;
+    EPropertyType Type = EPropertyType::Unknown;
+    EPropertyType InnerType = EPropertyType::Unknown;
+    uint32 BlockOffset = 0;                     // 고정 블록 내 오프셋 (배열 등 가변 프로퍼티는 블록 밖)
+    const FProperty* RuntimeProperty = nullptr; // 로드 시 현재 클래스에서 대응되는 프로퍼티 (없으면 건너뜀)
+};
+
+// 클래스 1개의 프로퍼티 블록 레이아웃
+struct FLevelClassLayout
+{
+    UClass* Class = nullptr;                    // 로드 시 현재 빌드에 없는 클래스면 nullptr
+    uint32 NameIndex = 0;
+    uint32 SchemaHash = 0;
+    uint32 BlockSize = 0;
+    bool bSchemaMatches = true;
+    TArray<FLevelPropertyLayout> Properties;
+};
+
+/**
+ * 바이너리 레벨 읽기/쓰기 아카이브 (메모리 버퍼 기반)
+ * 저장: 본문을 메모리에 쌓은 뒤 SaveToFile()에서 문자열/클래스 테이블과 함께 한 번에 기록
+ * 로드: LoadFromFile()에서 파일 전체를 한 번에 읽고 검증한 뒤 본문을 순차적으로 읽음
+ */
+class FLevelArchive : public FArchive
+{
+public:
+    explicit FLevelArchive(bool bInIsLoading);
+
+    void Serialize(void* Data, int64 Length) override;
+    bool Close() override { return true; }
+
+    // 문자열은 문자열 테이블 인덱스(uint32)로 기록
+    void SerializeString(FString& InOutString);
+    void SerializeName(FName& InOutName);
+
+    // 클래스 참조 (클래스 레이아웃 테이블 인덱스로 기록. 로드 시 모르는 클래스면 nullptr)
+    void SerializeClass(UClass*& InOutClass);
+
+    // InObject 클래스의 GetAllProperties() 전체를 프로퍼티 블록 하나로 직렬화
+    void SerializeProperties(UObject* InObject);
+
+    // 가변 길이 레코드. 저장 시 크기를 나중에 채우고, 로드 시 모르는 클래스의 레코드를 통째로 건너뛸 수 있게 함
+    // 저장: 크기 자리를 예약하고 그 위치를 반환 / 로드: 크기를 읽고 레코드 끝 위치를 반환
+    uint64 BeginRecord();
+    void EndRecord(uint64 InRecordToken);
+    void SkipRecord(uint64 InRecordToken);
+
+    bool SaveToFile(const FString& InFilePath) const;
+    bool LoadFromFile(const FString& InFilePath, FString* OutError = nullptr);
+
+    // 메모리 상의 완성된 파일 이미지 (벤치마크/변환용)
+    void WriteFileImage(TArray<uint8>& OutBytes) const;
+    bool ReadFileImage(const TArray<uint8>& InBytes, FString* OutError = nullptr);
+
+    static bool IsLevelBinaryFile(const FString& InFilePath);
+
+    // 프로퍼티 이름/타입/순서로 계산한 해시. 리플렉션 등록이 바뀌면 값이 달라짐
+    static uint32 ComputeSchemaHash(const UClass* InClass);
+
+    uint32 GetStringCount() const { return static_cast<uint32>(Strings.size()); }
+    const TArray<FString>& GetStrings() const { return Strings; }
+    uint32 GetClassCount() const { return static_cast<uint32>(ClassLayouts.size()); }
+    uint32 GetRemappedClassCount() const;
+
+private:
+    uint32 AddString(const FString& InString);
+    const FString& GetString(uint32 InIndex) const;
+
+    uint32 AddClassLayout(UClass* InClass);
+    void ResolveClassLayout(FLevelClassLayout& InOutLayout);
+
+    void SerializeArrayProperty(UObject* InObject, const FLevelPropertyLayout& InLayout);
+    template<typename T>
+    void SerializePodArray(TArray<T>& InOutArray, uint32 InLoadCount);
+
+    template<typename T>
+    void WriteValue(const T& InValue) { Serialize(const_cast<T*>(&InValue), sizeof(T)); }
+    template<typename T>
+    T ReadValue() { T Value; Serialize(&Value, sizeof(T)); return Value; }
+
+    TArray<uint8> Buffer;       // 저장: 본문 / 로드: 파일 전체
+    uint64 Cursor = 0;
+    uint64 BodyEnd = 0;
+
+    TArray<FString> Strings;
+    TMap<FString, uint32> StringLookup;
+
+    TArray<FLevelClassLayout> ClassLayouts;
+    TMap<const UClass*, uint32> ClassLookup;
+};
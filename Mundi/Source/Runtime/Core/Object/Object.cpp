@@ -1,8 +1,177 @@
 ﻿#include "pch.h"
+#include "LevelArchive.h"
+#include "PlatformTime.h"
 
 // UObject를 ObjectFactory에 등록
 IMPLEMENT_CLASS(UObject)
 
+namespace
+{
+    void AssignHierarchyInterval(UClass* InClass, const TMap<const UClass*, TArray<UClass*>>& InChildren, uint32& InOutCounter)
+    {
+        InClass->HierarchyBegin = InOutCounter++;
+        if (const TArray<UClass*>* Children = InChildren.Find(InClass))
+        {
+            for (UClass* Child : *Children)
+            {
+                AssignHierarchyInterval(Child, InChildren, InOutCounter);
+            }
+        }
+        InClass->HierarchyEnd = InOutCounter;
+    }
+
+    bool IsChildOfBySuperChain(const UClass* InClass, const UClass* InBase)
+    {
+        for (const UClass* Class = InClass; Class; Class = Class->Super)
+        {
+            if (Class == InBase) return true;
+        }
+        return false;
+    }
+}
+
+void UClass::SignUpClass(UClass* InClass)
+{
+    if (!InClass)
+    {
+        return;
+    }
+
+    TArray<UClass*>& AllClasses = GetAllClasses();
+    AllClasses.emplace_back(InClass);
+
+    FString LowerName = InClass->Name;
+    std::transform(LowerName.begin(), LowerName.end(), LowerName.begin(), ::tolower);
+    GetClassMap()[LowerName] = InClass;
+
+    // 부모는 자식보다 먼저 등록되므로(자식 StaticClass가 Super::StaticClass를 먼저 호출) 항상 트리가 이어져 있음
+    TMap<const UClass*, TArray<UClass*>> Children;
+    TArray<UClass*> Roots;
+    for (UClass* Class : AllClasses)
+    {
+        if (Class->Super)
+        {
+            Children[Class->Super].Add(Class);
+        }
+        else
+        {
+            Roots.Add(Class);
+        }
+    }
+
+    uint32 Counter = 0;
+    for (UClass* Root : Roots)
+    {
+        AssignHierarchyInterval(Root, Children, Counter);
+    }
+
+    TArray<UClass*>& Ordered = GetClassesInHierarchyOrder();
+    Ordered.SetNum(Counter);
+    for (UClass* Class : AllClasses)
+    {
+        Ordered[Class->HierarchyBegin] = Class;
+    }
+}
+
+UClass* UClass::FindClass(const FName& InClassName)
+{
+    if (InClassName.ComparisonIndex == static_cast<uint32>(-1))
+    {
+        return nullptr;
+    }
+
+    // FName의 비교 문자열이 이미 소문자이므로 그대로 키로 사용
+    // (번호가 붙은 이름은 풀에 기본 이름만 있으므로 전체 문자열로 찾음)
+    if (InClassName.Number != 0)
+    {
+        FString Lower = InClassName.ToString();
+        std::transform(Lower.begin(), Lower.end(), Lower.begin(), [](unsigned char C) { return static_cast<char>(std::tolower(C)); });
+        UClass** Found = GetClassMap().Find(Lower);
+        return Found ? *Found : nullptr;
+    }
+
+    UClass** Found = GetClassMap().Find(FNamePool::Get(InClassName.ComparisonIndex).Comparison);
+    return Found ? *Found : nullptr;
+}
+
+void UClass::RunCastBenchmark(uint32 InIterationCount)
+{
+    TArray<UObject*> Objects;
+    for (UObject* Obj : GUObjectArray)
+    {
+        if (Obj)
+        {
+            Objects.Add(Obj);
+        }
+    }
+
+    const TArray<UClass*>& AllClasses = GetAllClasses();
+    if (Objects.IsEmpty() || AllClasses.IsEmpty() || InIterationCount == 0)
+    {
+        UE_LOG("[CastBench] Nothing to test");
+        return;
+    }
+
+    // 같은 조합을 두 방식으로 판정 (결과 개수가 다르면 구간 번호가 잘못된 것)
+    uint64 IntervalMatches = 0;
+    uint64 StartCycles = FPlatformTime::Cycles64();
+    for (uint32 Iteration = 0; Iteration < InIterationCount; ++Iteration)
+    {
+        for (UObject* Obj : Objects)
+        {
+            const UClass* ObjClass = Obj->GetClass();
+            for (const UClass* Base : AllClasses)
+            {
+                IntervalMatches += ObjClass->IsChildOf(Base) ? 1 : 0;
+            }
+        }
+    }
+    const double IntervalMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+    uint64 ChainMatches = 0;
+    StartCycles = FPlatformTime::Cycles64();
+    for (uint32 Iteration = 0; Iteration < InIterationCount; ++Iteration)
+    {
+        for (UObject* Obj : Objects)
+        {
+            const UClass* ObjClass = Obj->GetClass();
+            for (const UClass* Base : AllClasses)
+            {
+                ChainMatches += IsChildOfBySuperChain(ObjClass, Base) ? 1 : 0;
+            }
+        }
+    }
+    const double ChainMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+    // FindClass: 등록된 모든 클래스 이름 조회 (FName은 미리 만들어 둠)
+    TArray<FName> ClassNames;
+    for (const UClass* Class : AllClasses)
+    {
+        ClassNames.Add(FName(Class->Name));
+    }
+    uint32 FoundCount = 0;
+    StartCycles = FPlatformTime::Cycles64();
+    for (uint32 Iteration = 0; Iteration < InIterationCount; ++Iteration)
+    {
+        for (const FName& ClassName : ClassNames)
+        {
+            FoundCount += FindClass(ClassName) ? 1 : 0;
+        }
+    }
+    const double FindMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+    const double CheckCount = static_cast<double>(InIterationCount) * Objects.Num() * AllClasses.Num();
+    const double LookupCount = static_cast<double>(InIterationCount) * ClassNames.Num();
+    UE_LOG("[CastBench] %d objects x %d classes x %u iterations", Objects.Num(), AllClasses.Num(), InIterationCount);
+    UE_LOG("[CastBench] IsChildOf interval : %8.3f ms (%.2f ns/check)", IntervalMs, IntervalMs * 1.0e6 / CheckCount);
+    UE_LOG("[CastBench] IsChildOf chain    : %8.3f ms (%.2f ns/check)", ChainMs, ChainMs * 1.0e6 / CheckCount);
+    UE_LOG("[CastBench] FindClass          : %8.3f ms (%.2f ns/lookup, %u found)", FindMs, FindMs * 1.0e6 / LookupCount, FoundCount);
+    if (IntervalMatches != ChainMatches)
+    {
+        UE_LOG("[CastBench] MISMATCH: interval %llu vs chain %llu", IntervalMatches, ChainMatches);
+    }
+}
+
 FString UObject::GetName()
 {
     return ObjectName.ToString();
@@ -292,6 +461,12 @@ void UObject::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	OnSerialized();
 }
 
+void UObject::SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar)
+{
+	Ar.SerializeProperties(this);
+	OnSerialized();
+}
+
 void UObject::DuplicateSubObjects()
 {
     UUID = GenerateUUID(); // UUID는 고유값이므로 새로 생성
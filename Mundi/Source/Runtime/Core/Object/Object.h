@@ -13,6 +13,7 @@ using JSON = json::JSON;
 // 전방 선언/외부 심볼 (네 프로젝트 환경 유지)
 class UObject;
 class UWorld;
+class FLevelArchive;
 // ── UClass: 간단한 타입 디스크립터 ─────────────────────────────
 struct UClass
 {
@@ -29,16 +30,22 @@ struct UClass
     mutable TArray<FProperty> CachedAllProperties;  // GetAllProperties() 캐시 (성능 최적화)
     mutable bool bAllPropertiesCached = false;      // 캐시 유효성 플래그
 
+    // 상속 트리 전위 순회 번호 구간 [HierarchyBegin, HierarchyEnd). 자손의 번호는 항상 조상의 구간 안에 있음
+    uint32 HierarchyBegin = 0;
+    uint32 HierarchyEnd = 0;
+
+    // 정확히 이 타입인 살아 있는 객체들 (하위 클래스 객체는 각 클래스 목록에). ObjectFactory가 생성/삭제 시 갱신
+    TArray<UObject*> LiveObjects;
+
     constexpr UClass() = default;
     constexpr UClass(const char* n, const UClass* s, std::size_t z)
         :Name(n), Super(s), Size(z) {
     }
+
+    // Super 체인을 따라가지 않고 정수 비교 두 번으로 판정
     bool IsChildOf(const UClass* Base) const noexcept
     {
-        if (!Base) return false;
-        for (auto c = this; c; c = c->Super)
-            if (c == Base) return true;
-        return false;
+        return Base && Base->HierarchyBegin <= HierarchyBegin && HierarchyBegin < Base->HierarchyEnd;
     }
 
     static TArray<UClass*>& GetAllClasses()
@@ -47,26 +54,32 @@ struct UClass
         return AllClasses;
     }
 
-    static void SignUpClass(UClass* InClass)
+    // HierarchyBegin 순서의 클래스 배열. 한 클래스와 모든 하위 클래스가 [HierarchyBegin, HierarchyEnd)로 연속
+    static TArray<UClass*>& GetClassesInHierarchyOrder()
     {
-        if (InClass)
-        {
-            GetAllClasses().emplace_back(InClass);
-        }
+        static TArray<UClass*> Classes;
+        return Classes;
     }
-    static UClass* FindClass(const FName& InClassName)
-    {
-        for (UClass* Class : GetAllClasses())
-        {
-            if (Class && Class->Name == InClassName)
-            {
-                return Class;
-            }
-        }
 
-        return nullptr;
+    // 소문자 클래스 이름 -> 클래스
+    static TMap<FString, UClass*>& GetClassMap()
+    {
+        static TMap<FString, UClass*> ClassMap;
+        return ClassMap;
     }
 
+    /*
+     * 클래스 등록 시 전체 상속 트리의 구간 번호를 다시 매긴다.
+     * 등록은 StaticClass() 최초 호출(대부분 IMPLEMENT_CLASS의 정적 초기화) 때 한 번씩만 일어나므로
+     * 번호가 바뀌는 것은 사실상 main 이전뿐이다.
+     */
+    static void SignUpClass(UClass* InClass);
+
+    static UClass* FindClass(const FName& InClassName);
+
+    // 구간 비교 IsChildOf와 Super 체인 순회를 살아 있는 객체 x 등록 클래스 조합으로 비교해 UE_LOG로 출력
+    static void RunCastBenchmark(uint32 InIterationCount);
+
     // 리플렉션 시스템 메서드
     // 주의: 프로퍼티는 static 초기화 시점에만 등록되며, 런타임 중 추가/삭제 불가
     void AddProperty(const FProperty& Property)
@@ -157,18 +170,30 @@ public:
 
     // 리플렉션 기반 자동 직렬화 (현재 클래스의 프로퍼티만 처리)
     virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle);
+
+    // 바이너리 레벨 직렬화. 리플렉션 프로퍼티는 프로퍼티 블록으로 일괄 처리되며,
+    // Serialize(JSON)에서 수동으로 다루는 상태가 있는 클래스는 이 함수도 같은 순서로 오버라이드합니다.
+    virtual void SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar);
+
+    // 디테일 패널이 리플렉션 프로퍼티를 직접 수정한 뒤 호출 (Setter를 거치지 않으므로 필요한 동기화를 여기서)
+    virtual void OnPropertyChanged(const FProperty& InProperty) {}
 public:
     // GenerateUUID()에 의해 자동 발급
     uint32_t UUID;
 
     // 팩토리 함수에 의해 자동 발급
     uint32_t InternalIndex;
+    int32    ClassObjectIndex = -1;   // GetClass()->LiveObjects 내 위치
     FName    ObjectName;   // ← 객체 개별 이름 추가
 
     // 정적: 타입 메타 반환 (이름을 StaticClass로!)
     static UClass* StaticClass()
     {
         static UClass Cls{ "UObject", nullptr, sizeof(UObject) };
+        static bool bRegistered = []() {
+            UClass::SignUpClass(&Cls);
+            return true;
+        }();
         return &Cls;
     }
 
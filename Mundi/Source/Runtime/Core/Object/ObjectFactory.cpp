@@ -1,8 +1,73 @@
 ﻿#include "pch.h"
 #include "ObjectFactory.h"
+#include "ObjectIterator.h"
+#include "PlatformTime.h"
 // 전역 오브젝트 배열 정의 (한 번만!)
 TArray<UObject*> GUObjectArray;
 
+namespace
+{
+    // 팩토리가 관리 중인 객체 (삭제 전 생존 확인용: 이미 삭제된 포인터를 역참조하지 않도록)
+    TSet<UObject*>& GetLiveObjects()
+    {
+        static TSet<UObject*> LiveObjects;
+        return LiveObjects;
+    }
+
+    // 진행 중인 TObjectIterator 수, 순회 중 삭제로 빈 슬롯이 생긴 클래스
+    int32 ObjectIterationDepth = 0;
+    TSet<UClass*> ClassesWithEmptySlots;
+
+    void LinkToClassList(UObject* Obj)
+    {
+        TArray<UObject*>& ClassObjects = Obj->GetClass()->LiveObjects;
+        Obj->ClassObjectIndex = ClassObjects.Num();
+        ClassObjects.Add(Obj);
+    }
+
+    // 순회 중이 아니면 swap-remove (마지막 객체를 빈 자리로), 순회 중이면 슬롯만 비움
+    // (swap-remove는 이미 방문한 객체를 아직 방문하지 않은 자리로 옮겨 두 번 방문하게 만듦)
+    void UnlinkFromClassList(UObject* Obj)
+    {
+        UClass* Class = Obj->GetClass();
+        TArray<UObject*>& ClassObjects = Class->LiveObjects;
+        const int32 Index = Obj->ClassObjectIndex;
+        if (Index < 0 || Index >= ClassObjects.Num() || ClassObjects[Index] != Obj)
+        {
+            return;
+        }
+
+        Obj->ClassObjectIndex = -1;
+        if (ObjectIterationDepth > 0)
+        {
+            ClassObjects[Index] = nullptr;
+            ClassesWithEmptySlots.Add(Class);
+            return;
+        }
+
+        UObject* Last = ClassObjects.back();
+        ClassObjects[Index] = Last;
+        Last->ClassObjectIndex = Index;
+        ClassObjects.pop_back();
+    }
+
+    // 빈 슬롯을 제거하며 순서를 유지하고 인덱스를 다시 매김
+    void CompactClassList(UClass* Class)
+    {
+        TArray<UObject*>& ClassObjects = Class->LiveObjects;
+        int32 WriteIndex = 0;
+        for (int32 ReadIndex = 0; ReadIndex < ClassObjects.Num(); ++ReadIndex)
+        {
+            if (UObject* Obj = ClassObjects[ReadIndex])
+            {
+                Obj->ClassObjectIndex = WriteIndex;
+                ClassObjects[WriteIndex++] = Obj;
+            }
+        }
+        ClassObjects.resize(WriteIndex);
+    }
+}
+
 namespace ObjectFactory
 {
     TMap<UClass*, ConstructFunc>& GetRegistry()
@@ -34,18 +99,14 @@ namespace ObjectFactory
         idx = GUObjectArray.Add(Obj);
 
         Obj->InternalIndex = static_cast<uint32>(idx);
+        GetLiveObjects().Add(Obj);
+        LinkToClassList(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
 
-        const std::string base = Class->Name; // FName -> string
-        std::string unique;
-        unique.reserve(base.size() + 1 + 12);            // "_" + 최대 10~12자리 여유
-        unique.append(base);
-        unique.push_back('_');
-        unique.append(std::to_string(Count));
-
-        Obj->ObjectName = FName(unique);
+        // "Class_N" 문자열을 만들지 않고 번호만 붙임 (이름 풀에는 클래스 이름 하나만 남음)
+        Obj->ObjectName = FName(Class->Name, static_cast<uint32>(Count));
 
         return Obj;
     }
@@ -60,43 +121,56 @@ namespace ObjectFactory
         idx = GUObjectArray.Add(Obj);
         //}
         Obj->InternalIndex = static_cast<uint32>(idx);
+        GetLiveObjects().Add(Obj);
+        LinkToClassList(Obj);   // 복사 생성된 객체는 원본의 ClassObjectIndex를 갖고 있으므로 여기서 덮어씀
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
 
-        const std::string base = Class->Name; // FName -> string
-        std::string unique;
-        unique.reserve(base.size() + 1 + 12);            // "_" + 최대 10~12자리 여유
-        unique.append(base);
-        unique.push_back('_');
-        unique.append(std::to_string(Count));
-
-        Obj->ObjectName = FName(unique);
+        // "Class_N" 문자열을 만들지 않고 번호만 붙임 (이름 풀에는 클래스 이름 하나만 남음)
+        Obj->ObjectName = FName(Class->Name, static_cast<uint32>(Count));
 
         return Obj;
     }
 
-    void DeleteObject(UObject* Obj)
+    void BeginObjectIteration()
     {
-        if (!Obj) return;
+        ++ObjectIterationDepth;
+    }
 
-        // Important: DO NOT dereference Obj fields before verifying it is still in GUObjectArray.
-        int32 foundIndex = -1;
-        for (int32 i = 0; i < GUObjectArray.Num(); ++i)
+    void EndObjectIteration()
+    {
+        if (--ObjectIterationDepth > 0 || ClassesWithEmptySlots.empty())
         {
-            if (GUObjectArray[i] == Obj)
-            {
-                foundIndex = i;
-                break;
-            }
+            return;
         }
-        if (foundIndex < 0)
+
+        for (UClass* Class : ClassesWithEmptySlots)
+        {
+            CompactClassList(Class);
+        }
+        ClassesWithEmptySlots.clear();
+    }
+
+    void DeleteObject(UObject* Obj)
+    {
+        if (!Obj) return;
+
+        // Important: DO NOT dereference Obj fields before verifying it is still alive.
+        // (GUObjectArray 전체를 찾는 대신 생존 집합으로 O(1) 확인)
+        if (!GetLiveObjects().Remove(Obj))
         {
             // Not managed or already deleted.
             return;
         }
 
-        GUObjectArray[foundIndex] = nullptr;
+        // 살아 있음이 확인되었으므로 이제 필드 접근 안전
+        const uint32 foundIndex = Obj->InternalIndex;
+        if (foundIndex < static_cast<uint32>(GUObjectArray.Num()) && GUObjectArray[foundIndex] == Obj)
+        {
+            GUObjectArray[foundIndex] = nullptr;
+        }
+        UnlinkFromClassList(Obj);
         // Safe to delete now; Obj still valid since we found it in GUObjectArray
         Obj->DestroyInternal();
     }
@@ -115,6 +189,68 @@ namespace ObjectFactory
         GUObjectArray.Shrink();
     }
 
+    void RunObjectIteratorBenchmark(uint32 InFillerCount)
+    {
+        // 필러 객체: 순회 대상이 아닌 흔한 타입 (UObject 자체)
+        TArray<UObject*> Fillers;
+        Fillers.reserve(InFillerCount);
+        for (uint32 i = 0; i < InFillerCount; ++i)
+        {
+            Fillers.Add(NewObject(UObject::StaticClass()));
+        }
+
+        constexpr uint32 RepeatCount = 20;
+
+        auto Measure = [&](const char* InName, auto&& InBody)
+        {
+            uint64 Visited = 0;
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            for (uint32 Repeat = 0; Repeat < RepeatCount; ++Repeat)
+            {
+                Visited += InBody();
+            }
+            const double AverageMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) / RepeatCount;
+            UE_LOG("[ObjectIteratorBench] %-32s | %9.4f ms | %llu objects", InName, AverageMs, Visited / RepeatCount);
+        };
+
+        auto ScanAll = [](const UClass* InClass) -> uint64
+        {
+            uint64 Count = 0;
+            for (UObject* Obj : GUObjectArray)
+            {
+                if (Obj && Obj->IsA(InClass))
+                {
+                    ++Count;
+                }
+            }
+            return Count;
+        };
+
+        UE_LOG("[ObjectIteratorBench] GUObjectArray slots: %d (fillers: %u, average of %u runs)", GUObjectArray.Num(), InFillerCount, RepeatCount);
+        Measure("UShader   TObjectIterator", []() -> uint64
+        {
+            uint64 Count = 0;
+            for (TObjectIterator<UShader> It; It; ++It) { ++Count; }
+            return Count;
+        });
+        Measure("UShader   GUObjectArray scan", [&]() { return ScanAll(UShader::StaticClass()); });
+        Measure("UObject   TObjectIterator", []() -> uint64
+        {
+            uint64 Count = 0;
+            for (TObjectIterator<UObject> It; It; ++It) { ++Count; }
+            return Count;
+        });
+        Measure("UObject   GUObjectArray scan", [&]() { return ScanAll(UObject::StaticClass()); });
+
+        const uint64 DeleteStart = FPlatformTime::Cycles64();
+        for (UObject* Filler : Fillers)
+        {
+            DeleteObject(Filler);
+        }
+        UE_LOG("[ObjectIteratorBench] Deleted %u fillers in %.3f ms", InFillerCount,
+            FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - DeleteStart));
+    }
+
     // (선택) null 슬롯 압축
     void CompactNullSlots()
     {
@@ -48,6 +48,15 @@ namespace ObjectFactory
     void DeleteAll(bool bCallBeginDestroy = true);
     // Null 슬롯 압축하여 배열 크기 축소
     void CompactNullSlots();
+
+    // TObjectIterator 수명 동안 호출. 순회 중 삭제된 객체는 클래스별 목록에서 슬롯만 비우고(순서 유지),
+    // 마지막 순회가 끝날 때 빈 슬롯을 압축합니다.
+    void BeginObjectIteration();
+    void EndObjectIteration();
+
+    // InFillerCount개의 객체를 추가로 만든 상태에서 드문 클래스(UShader) / 흔한 클래스(UObject 전체) 순회 시간을
+    // TObjectIterator(클래스별 목록)와 GUObjectArray 전체 스캔으로 비교해 UE_LOG로 출력
+    void RunObjectIteratorBenchmark(uint32 InFillerCount);
 }
 
 // ── 등록 매크로 ─────────────────────────────────────────────
@@ -195,10 +195,12 @@ public:
 	Class->Description = InDesc;
 
 
+// OnRegister(UWorld* InWorld) 안에서 사용 (소유 액터의 RegisterAllComponents 순회 도중 추가되므로 여기서 직접 등록)
 #define CREATE_EDITOR_COMPONENT(InVariableName, Type)\
 	InVariableName = NewObject<Type>();\
 	InVariableName->SetOwner(this->GetOwner());\
 	InVariableName->SetupAttachment(this, EAttachmentRule::KeepRelative);\
 	this->GetOwner()->AddOwnedComponent(InVariableName);\
 	InVariableName->SetEditability(false);\
-	InVariableName->SetHiddenInGame(true);
\ No newline at end of file
+	InVariableName->SetHiddenInGame(true);\
+	InVariableName->RegisterComponent(InWorld);
\ No newline at end of file
@@ -0,0 +1,431 @@
+﻿#include "pch.h"
+#include "CapsuleSweep.h"
+#include "AABB.h"
+#include "MeshBVH.h"
+#include "BVHierarchy.h"
+#include "StaticMeshComponent.h"
+#include "StaticMesh.h"
+#include "ResourceManager.h"
+#include <cmath>
+#include <algorithm>
+
+namespace
+{
+	// 부풀린 캡슐 표면까지 이만큼(스킨 대비 비율) 가까워지면 접촉으로 봄
+	constexpr float ContactToleranceRatio = 0.25f;
+	constexpr float MinContactTolerance = 1e-4f;
+
+	// 전진 횟수 상한. 넘으면 그 시점에서 멈춤 (항상 실제 접촉 이전이라 안전)
+	constexpr int32 MaxAdvancementSteps = 32;
+
+	inline float GetContactTolerance(float InSkin)
+	{
+		return std::max(InSkin * ContactToleranceRatio, MinContactTolerance);
+	}
+
+	inline FVector MinVector(const FVector& A, const FVector& B)
+	{
+		return FVector(std::min(A.X, B.X), std::min(A.Y, B.Y), std::min(A.Z, B.Z));
+	}
+
+	inline FVector MaxVector(const FVector& A, const FVector& B)
+	{
+		return FVector(std::max(A.X, B.X), std::max(A.Y, B.Y), std::max(A.Z, B.Z));
+	}
+
+	// 월드 AABB를 InMatrix로 옮긴 공간의 AABB (8개 꼭짓점)
+	FAABB TransformBounds(const FAABB& InBound, const FMatrix& InMatrix)
+	{
+		FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (int32 i = 0; i < 8; ++i)
+		{
+			const FVector Corner(
+				(i & 1) ? InBound.Max.X : InBound.Min.X,
+				(i & 2) ? InBound.Max.Y : InBound.Min.Y,
+				(i & 4) ? InBound.Max.Z : InBound.Min.Z);
+			const FVector P = Corner * InMatrix;
+			Min = MinVector(Min, P);
+			Max = MaxVector(Max, P);
+		}
+		return FAABB(Min, Max);
+	}
+
+	// 모서리를 공유하는 삼각형들은 거의 같은 시점에 닿으므로 이 안의 차이는 같은 시점으로 봄
+	constexpr float SameTimeTolerance = 1e-4f;
+
+	// 닿은 삼각형의 면 법선 (캡슐 쪽). 면적이 0이면 접촉 법선
+	inline FVector GetFaceNormal(const FVector& A, const FVector& B, const FVector& C, const FVector& InContactNormal)
+	{
+		const FVector FaceNormal = FVector::Cross(B - A, C - A);
+		const float Size = FaceNormal.Size();
+		if (Size <= KINDA_SMALL_NUMBER)
+		{
+			return InContactNormal;
+		}
+		return (FVector::Dot(FaceNormal, InContactNormal) < 0.0f) ? -(FaceNormal / Size) : FaceNormal / Size;
+	}
+
+	// 새 충돌이 기존 결과보다 우선하는지.
+	// 관통 > 먼저 막힘 순이고, 같은 시점이면 이동 방향을 가장 정면으로 막는 면 (턱 모서리에서 아래로 내려오면 윗면, 옆으로 오면 옆면)
+	inline bool IsBetterHit(float InTime, bool bInPenetrating, float InDepth, const FVector& InImpactNormal, const FVector& InDelta, const FCapsuleSweepHit& InHit)
+	{
+		if (!InHit.bBlockingHit)
+		{
+			return InTime < InHit.Time || bInPenetrating;
+		}
+		if (bInPenetrating)
+		{
+			return !InHit.bStartPenetrating || InDepth > InHit.PenetrationDepth;
+		}
+		if (InHit.bStartPenetrating)
+		{
+			return false;
+		}
+		if (std::fabs(InTime - InHit.Time) <= SameTimeTolerance)
+		{
+			return FVector::Dot(InImpactNormal, InDelta) < FVector::Dot(InHit.ImpactNormal, InDelta);
+		}
+		return InTime < InHit.Time;
+	}
+}
+
+FVector Collision::ClosestPointOnTriangle(const FVector& P, const FVector& A, const FVector& B, const FVector& C)
+{
+	// Ericson, Real-Time Collision Detection 5.1.5 (보로노이 영역 순서대로 판정)
+	const FVector AB = B - A;
+	const FVector AC = C - A;
+	const FVector AP = P - A;
+	const float D1 = FVector::Dot(AB, AP);
+	const float D2 = FVector::Dot(AC, AP);
+	if (D1 <= 0.0f && D2 <= 0.0f)
+	{
+		return A;
+	}
+
+	const FVector BP = P - B;
+	const float D3 = FVector::Dot(AB, BP);
+	const float D4 = FVector::Dot(AC, BP);
+	if (D3 >= 0.0f && D4 <= D3)
+	{
+		return B;
+	}
+
+	const float VC = D1 * D4 - D3 * D2;
+	if (VC <= 0.0f && D1 >= 0.0f && D3 <= 0.0f)
+	{
+		return A + AB * (D1 / (D1 - D3));
+	}
+
+	const FVector CP = P - C;
+	const float D5 = FVector::Dot(AB, CP);
+	const float D6 = FVector::Dot(AC, CP);
+	if (D6 >= 0.0f && D5 <= D6)
+	{
+		return C;
+	}
+
+	const float VB = D5 * D2 - D1 * D6;
+	if (VB <= 0.0f && D2 >= 0.0f && D6 <= 0.0f)
+	{
+		return A + AC * (D2 / (D2 - D6));
+	}
+
+	const float VA = D3 * D6 - D5 * D4;
+	if (VA <= 0.0f && (D4 - D3) >= 0.0f && (D5 - D6) >= 0.0f)
+	{
+		return B + (C - B) * ((D4 - D3) / ((D4 - D3) + (D5 - D6)));
+	}
+
+	const float Sum = VA + VB + VC;
+	if (Sum <= 0.0f)
+	{
+		// 면적이 0인 삼각형 (변은 선분-변 판정이 처리)
+		return A;
+	}
+	const float InvSum = 1.0f / Sum;
+	return A + AB * (VB * InvSum) + AC * (VC * InvSum);
+}
+
+float Collision::ClosestPointsSegmentSegment(const FVector& P0, const FVector& P1, const FVector& Q0, const FVector& Q1, FVector& OutOnP, FVector& OutOnQ)
+{
+	// Ericson 5.1.9
+	const FVector D1 = P1 - P0;
+	const FVector D2 = Q1 - Q0;
+	const FVector R = P0 - Q0;
+	const float A = FVector::Dot(D1, D1);
+	const float E = FVector::Dot(D2, D2);
+	const float F = FVector::Dot(D2, R);
+
+	float S = 0.0f;
+	float T = 0.0f;
+	if (A <= KINDA_SMALL_NUMBER && E <= KINDA_SMALL_NUMBER)
+	{
+		// 둘 다 점
+	}
+	else if (A <= KINDA_SMALL_NUMBER)
+	{
+		T = std::clamp(F / E, 0.0f, 1.0f);
+	}
+	else
+	{
+		const float C = FVector::Dot(D1, R);
+		if (E <= KINDA_SMALL_NUMBER)
+		{
+			S = std::clamp(-C / A, 0.0f, 1.0f);
+		}
+		else
+		{
+			const float B = FVector::Dot(D1, D2);
+			const float Denom = A * E - B * B;
+			// 평행하면 임의의 S (0)에서 시작
+			S = (Denom > 0.0f) ? std::clamp((B * F - C * E) / Denom, 0.0f, 1.0f) : 0.0f;
+			T = (B * S + F) / E;
+			if (T < 0.0f)
+			{
+				T = 0.0f;
+				S = std::clamp(-C / A, 0.0f, 1.0f);
+			}
+			else if (T > 1.0f)
+			{
+				T = 1.0f;
+				S = std::clamp((B - C) / A, 0.0f, 1.0f);
+			}
+		}
+	}
+
+	OutOnP = P0 + D1 * S;
+	OutOnQ = Q0 + D2 * T;
+	return (OutOnP - OutOnQ).SizeSquared();
+}
+
+float Collision::SegmentTriangleDistanceSquared(const FVector& S0, const FVector& S1, const FVector& A, const FVector& B, const FVector& C, FVector& OutOnSegment, FVector& OutOnTriangle)
+{
+	// 선분이 삼각형 평면을 가로지르는 점이 삼각형 안이면 관통
+	const FVector N = FVector::Cross(B - A, C - A);
+	const float Side0 = FVector::Dot(S0 - A, N);
+	const float Side1 = FVector::Dot(S1 - A, N);
+	if (Side0 != Side1 && ((Side0 <= 0.0f && Side1 >= 0.0f) || (Side0 >= 0.0f && Side1 <= 0.0f)))
+	{
+		const FVector P = S0 + (S1 - S0) * (Side0 / (Side0 - Side1));
+		if (FVector::Dot(FVector::Cross(B - A, P - A), N) >= 0.0f &&
+			FVector::Dot(FVector::Cross(C - B, P - B), N) >= 0.0f &&
+			FVector::Dot(FVector::Cross(A - C, P - C), N) >= 0.0f)
+		{
+			OutOnSegment = P;
+			OutOnTriangle = P;
+			return 0.0f;
+		}
+	}
+
+	// 아니면 최근접 쌍은 (끝점, 면) 또는 (선분, 변) 중 하나
+	FVector OnTriangle = ClosestPointOnTriangle(S0, A, B, C);
+	float BestDistSq = (S0 - OnTriangle).SizeSquared();
+	OutOnSegment = S0;
+	OutOnTriangle = OnTriangle;
+
+	OnTriangle = ClosestPointOnTriangle(S1, A, B, C);
+	float DistSq = (S1 - OnTriangle).SizeSquared();
+	if (DistSq < BestDistSq)
+	{
+		BestDistSq = DistSq;
+		OutOnSegment = S1;
+		OutOnTriangle = OnTriangle;
+	}
+
+	const FVector* Edges[3][2] = { { &A, &B }, { &B, &C }, { &C, &A } };
+	for (int32 i = 0; i < 3; ++i)
+	{
+		FVector OnSegment;
+		DistSq = ClosestPointsSegmentSegment(S0, S1, *Edges[i][0], *Edges[i][1], OnSegment, OnTriangle);
+		if (DistSq < BestDistSq)
+		{
+			BestDistSq = DistSq;
+			OutOnSegment = OnSegment;
+			OutOnTriangle = OnTriangle;
+		}
+	}
+	return BestDistSq;
+}
+
+FAABB Collision::GetCapsuleSweepBounds(const FVector& InStart, const FVector& InDelta, const FCapsuleShape& InCapsule, float InSkin)
+{
+	const float Radius = InCapsule.Radius + InSkin + GetContactTolerance(InSkin);
+	const FVector Extent(Radius, Radius, InCapsule.HalfHeight + Radius);
+	const FVector End = InStart + InDelta;
+	return FAABB(MinVector(InStart, End) - Extent, MaxVector(InStart, End) + Extent);
+}
+
+bool Collision::SweepCapsuleTriangle(const FVector& InStart, const FVector& InDelta, const FCapsuleShape& InCapsule, float InSkin,
+	const FVector& A, const FVector& B, const FVector& C, FCapsuleSweepHit& InOutHit)
+{
+	const FVector Axis(0.0f, 0.0f, InCapsule.HalfHeight);
+	const float ContactRadius = InCapsule.Radius + InSkin;
+	// 스킨 절반까지 파고들 때를 충돌로 보고 스킨 절반만큼 되돌림.
+	// 스킨 두께로 떠 있는 바닥의 이웃 삼각형(같은 평면)은 이 반지름까지 가까워지지 않으므로 변을 넘을 때 걸리지 않음
+	const float HitRadius = InCapsule.Radius + InSkin * 0.5f;
+	const float Tolerance = GetContactTolerance(InSkin);
+
+	float T = 0.0f;
+	float Closing = 0.0f;
+	FVector Normal;
+	FVector OnTriangle;
+	for (int32 Step = 0; Step < MaxAdvancementSteps; ++Step)
+	{
+		const FVector Center = InStart + InDelta * T;
+		FVector OnSegment;
+		const float Dist = std::sqrt(SegmentTriangleDistanceSquared(Center - Axis, Center + Axis, A, B, C, OnSegment, OnTriangle));
+
+		if (Dist > KINDA_SMALL_NUMBER)
+		{
+			Normal = (OnSegment - OnTriangle) / Dist;
+		}
+		else
+		{
+			// 선분이 삼각형에 닿아 있음: 면 법선을 이동 반대쪽(정지 중이면 캡슐 쪽)으로
+			Normal = FVector::Cross(B - A, C - A);
+			const float NormalSize = Normal.Size();
+			if (NormalSize <= KINDA_SMALL_NUMBER)
+			{
+				return false;
+			}
+			Normal /= NormalSize;
+			const float Facing = (InDelta.SizeSquared() > 0.0f) ? -FVector::Dot(InDelta, Normal) : FVector::Dot(Center - A, Normal);
+			if (Facing < 0.0f)
+			{
+				Normal = -Normal;
+			}
+		}
+
+		// T 1당 표면 쪽으로 가까워지는 거리
+		Closing = -FVector::Dot(InDelta, Normal);
+
+		if (Step == 0 && Dist < InCapsule.Radius)
+		{
+			// 시작부터 실제 캡슐이 겹침: 움직이는 방향과 관계없이 밀어낼 방향/깊이를 알려줌
+			const float Depth = ContactRadius - Dist;
+			const FVector ImpactNormal = GetFaceNormal(A, B, C, Normal);
+			if (!IsBetterHit(0.0f, true, Depth, ImpactNormal, InDelta, InOutHit))
+			{
+				return false;
+			}
+			InOutHit.bBlockingHit = true;
+			InOutHit.bStartPenetrating = true;
+			InOutHit.Time = 0.0f;
+			InOutHit.PenetrationDepth = Depth;
+			InOutHit.Normal = Normal;
+			InOutHit.ImpactNormal = ImpactNormal;
+			InOutHit.ImpactPoint = OnTriangle;
+			return true;
+		}
+
+		// 거리가 볼록 함수라 지금 멀어지는 중이면 이후에도 가까워지지 않음
+		if (Closing <= KINDA_SMALL_NUMBER)
+		{
+			return false;
+		}
+
+		const float Gap = Dist - HitRadius;
+		if (Gap <= Tolerance)
+		{
+			break;
+		}
+
+		T += Gap / Closing;
+		if (T >= 1.0f)
+		{
+			return false;
+		}
+	}
+
+	// 접점의 접선으로 되돌리므로 되돌린 위치는 이 삼각형에서 ContactRadius 이상 떨어져 있음
+	const float HitTime = std::max(0.0f, T - (ContactRadius - HitRadius) / Closing);
+	const FVector ImpactNormal = GetFaceNormal(A, B, C, Normal);
+	if (!IsBetterHit(HitTime, false, 0.0f, ImpactNormal, InDelta, InOutHit))
+	{
+		if (InOutHit.bBlockingHit && !InOutHit.bStartPenetrating && HitTime < InOutHit.Time)
+		{
+			InOutHit.Time = HitTime;
+		}
+		return false;
+	}
+	// 같은 시점으로 보고 면만 바꾼 경우에도 더 이른 시점을 유지
+	InOutHit.Time = InOutHit.bBlockingHit ? std::min(HitTime, InOutHit.Time) : HitTime;
+	InOutHit.bBlockingHit = true;
+	InOutHit.bStartPenetrating = false;
+	InOutHit.PenetrationDepth = 0.0f;
+	InOutHit.Normal = Normal;
+	InOutHit.ImpactNormal = ImpactNormal;
+	InOutHit.ImpactPoint = OnTriangle;
+	return true;
+}
+
+bool Collision::SweepCapsuleMesh(const FMeshBVH& InMeshBVH, const FMatrix& InWorldMatrix, const FVector& InStart, const FVector& InDelta,
+	const FCapsuleShape& InCapsule, float InSkin, FCapsuleSweepHit& InOutHit)
+{
+	// 삼각형을 월드로 옮겨 판정 (비균등 스케일이어도 캡슐 모양이 유지됨)
+	const FAABB LocalBounds = TransformBounds(GetCapsuleSweepBounds(InStart, InDelta, InCapsule, InSkin), InWorldMatrix.InverseAffine());
+
+	bool bHit = false;
+	InMeshBVH.ForEachTriangleInBounds(LocalBounds, [&](const FVector& A, const FVector& B, const FVector& C)
+	{
+		bHit |= SweepCapsuleTriangle(InStart, InDelta, InCapsule, InSkin, A * InWorldMatrix, B * InWorldMatrix, C * InWorldMatrix, InOutHit);
+	});
+	return bHit;
+}
+
+bool Collision::IsWalkableNormal(const FVector& InNormal, float InWalkableFloorZ)
+{
+	return InNormal.Z >= InWalkableFloorZ - KINDA_SMALL_NUMBER;
+}
+
+bool Collision::IsWalkableFloorHit(const FVector& InCenter, const FCapsuleSweepHit& InHit, const FCapsuleShape& InCapsule, float InSkin,
+	float InWalkableFloorZ, FVector& OutFloorNormal)
+{
+	OutFloorNormal = InHit.Normal;
+	if (!InHit.bBlockingHit)
+	{
+		return false;
+	}
+	if (IsWalkableNormal(InHit.Normal, InWalkableFloorZ))
+	{
+		return true;
+	}
+
+	const FVector ToImpact(InHit.ImpactPoint.X - InCenter.X, InHit.ImpactPoint.Y - InCenter.Y, 0.0f);
+	const float EdgeRadius = InCapsule.Radius - InSkin;
+	if (IsWalkableNormal(InHit.ImpactNormal, InWalkableFloorZ) && ToImpact.SizeSquared() < EdgeRadius * EdgeRadius)
+	{
+		OutFloorNormal = InHit.ImpactNormal;
+		return true;
+	}
+	return false;
+}
+
+bool Collision::SweepCapsuleWorld(const FBVHierarchy& InBVH, const FVector& InStart, const FVector& InDelta, const FCapsuleShape& InCapsule,
+	float InSkin, const AActor* InIgnoreActor, FCapsuleSweepHit& OutHit)
+{
+	OutHit = FCapsuleSweepHit();
+
+	const FAABB SweepBounds = GetCapsuleSweepBounds(InStart, InDelta, InCapsule, InSkin);
+	InBVH.ForEachComponentInBounds(SweepBounds, [&](UStaticMeshComponent* Component, const FAABB&)
+	{
+		if (InIgnoreActor && Component->GetOwner() == InIgnoreActor)
+		{
+			return;
+		}
+
+		UStaticMesh* MeshRes = Component->GetStaticMesh();
+		FStaticMesh* StaticMesh = MeshRes ? MeshRes->GetStaticMeshAsset() : nullptr;
+		if (!StaticMesh)
+		{
+			return;
+		}
+		FMeshBVH* MeshBVH = UResourceManager::GetInstance().GetOrBuildMeshBVH(MeshRes->GetAssetPathFileName(), StaticMesh);
+		if (MeshBVH && SweepCapsuleMesh(*MeshBVH, Component->GetWorldMatrix(), InStart, InDelta, InCapsule, InSkin, OutHit))
+		{
+			OutHit.Component = Component;
+		}
+	});
+	return OutHit.bBlockingHit;
+}
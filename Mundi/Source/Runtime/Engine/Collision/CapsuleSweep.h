@@ -0,0 +1,72 @@
+﻿#pragma once
+#include "Vector.h"
+
+struct FAABB;
+class FMeshBVH;
+class FBVHierarchy;
+class AActor;
+class UStaticMeshComponent;
+
+// Z축에 정렬된 캡슐: 선분 Center ± (0, 0, HalfHeight)에서 거리 Radius 이내
+struct FCapsuleShape
+{
+	float Radius = 0.0f;
+	float HalfHeight = 0.0f;	// 반구를 제외한 선분의 절반 길이
+
+	FCapsuleShape() = default;
+	FCapsuleShape(float InRadius, float InHalfHeight) : Radius(InRadius), HalfHeight(InHalfHeight) {}
+};
+
+struct FCapsuleSweepHit
+{
+	bool bBlockingHit = false;
+	bool bStartPenetrating = false;	// 시작 위치에서 이미 겹쳐 있음 (Time == 0, Normal 방향으로 PenetrationDepth만큼 밀어내면 스킨 밖)
+	float Time = 1.0f;				// 이동량 Delta 대비 멈춘 지점 [0, 1]
+	float PenetrationDepth = 0.0f;
+	FVector Normal;					// 접촉 법선 (표면 -> 캡슐). 모서리/꼭짓점에 닿으면 기울어짐
+	FVector ImpactNormal;			// 닿은 삼각형의 면 법선 (캡슐 쪽)
+	FVector ImpactPoint;
+	const UStaticMeshComponent* Component = nullptr;
+};
+
+/**
+ * 캡슐 스윕 커널 (보수적 전진, Conservative Advancement).
+ *
+ * 평행 이동만 하는 볼록체 사이의 거리는 시간에 대해 볼록 함수이므로, 현재 거리와 법선 방향 접근 속도로
+ * 구한 다음 시점은 실제 첫 접촉을 절대 넘지 않습니다. 스킨 절반까지 파고드는 시점을 찾은 뒤 접선 방향으로 되돌리므로
+ * 멈춘 위치의 실제 캡슐은 막은 표면에서 Skin 이상 떨어져 있고, 스킨 두께로 떠서 미끄러지는 이동은 막히지 않습니다.
+ * 모든 함수는 힙 할당이 없고 엔진 상태와 무관해 합성 삼각형으로 단독 검증할 수 있습니다 (SweepCapsuleWorld 제외).
+ */
+namespace Collision
+{
+	FVector ClosestPointOnTriangle(const FVector& P, const FVector& A, const FVector& B, const FVector& C);
+
+	// 두 선분의 최근접점 쌍, 반환값은 거리 제곱
+	float ClosestPointsSegmentSegment(const FVector& P0, const FVector& P1, const FVector& Q0, const FVector& Q1, FVector& OutOnP, FVector& OutOnQ);
+
+	// 선분과 삼각형의 최근접점 쌍 (관통하면 0), 반환값은 거리 제곱
+	float SegmentTriangleDistanceSquared(const FVector& S0, const FVector& S1, const FVector& A, const FVector& B, const FVector& C, FVector& OutOnSegment, FVector& OutOnTriangle);
+
+	// Start에서 Start + Delta로 움직이는 캡슐을 감싸는 월드 AABB (Skin 포함)
+	FAABB GetCapsuleSweepBounds(const FVector& InStart, const FVector& InDelta, const FCapsuleShape& InCapsule, float InSkin);
+
+	// InOutHit보다 먼저 막히면 InOutHit을 갱신하고 true (처음 호출 전에는 기본값 FCapsuleSweepHit)
+	bool SweepCapsuleTriangle(const FVector& InStart, const FVector& InDelta, const FCapsuleShape& InCapsule, float InSkin,
+		const FVector& A, const FVector& B, const FVector& C, FCapsuleSweepHit& InOutHit);
+
+	// 메시 BVH(로컬 공간)를 InWorldMatrix로 놓았을 때. 스윕 AABB와 겹치는 삼각형만 검사
+	bool SweepCapsuleMesh(const FMeshBVH& InMeshBVH, const FMatrix& InWorldMatrix, const FVector& InStart, const FVector& InDelta,
+		const FCapsuleShape& InCapsule, float InSkin, FCapsuleSweepHit& InOutHit);
+
+	// 법선의 Z가 InWalkableFloorZ (= cos(걸을 수 있는 최대 경사)) 이상이면 걸을 수 있는 면
+	bool IsWalkableNormal(const FVector& InNormal, float InWalkableFloorZ);
+
+	// InCenter에서 아래로 스윕해 닿은 InHit이 걸을 수 있는 바닥인지. 반구가 턱 모서리에 닿아 접촉 법선이 기울어도
+	// 닿은 면이 걸을 수 있고 접점이 캡슐 가장자리(옆면이 벽을 스치는 경우)가 아니면 모서리에 걸쳐 선 것으로 봄
+	bool IsWalkableFloorHit(const FVector& InCenter, const FCapsuleSweepHit& InHit, const FCapsuleShape& InCapsule, float InSkin,
+		float InWalkableFloorZ, FVector& OutFloorNormal);
+
+	// 월드 BVH의 스태틱 메시 전체 (InIgnoreActor 소유 컴포넌트 제외). 막히면 true
+	bool SweepCapsuleWorld(const FBVHierarchy& InBVH, const FVector& InStart, const FVector& InDelta, const FCapsuleShape& InCapsule,
+		float InSkin, const AActor* InIgnoreActor, FCapsuleSweepHit& OutHit);
+}
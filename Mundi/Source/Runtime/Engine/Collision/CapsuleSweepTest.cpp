@@ -0,0 +1,203 @@
+﻿#include "pch.h"
+#include "CapsuleSweep.h"
+#include "MeshBVH.h"
+#include "SelfTest.h"
+
+namespace
+{
+	// UCharacterMovementComponent 기본값과 같은 캡슐/스킨/경사
+	const FCapsuleShape TestCapsule(34.0f, 54.0f);
+	constexpr float TestSkin = 0.5f;
+	constexpr float TestMaxStepHeight = 45.0f;
+	const float TestWalkableFloorZ = std::cos(DegreesToRadians(44.765f));
+
+	// 바닥에서 스킨만큼 떠 있는 캡슐 중심 높이
+	constexpr float RestingCenterZ = 54.0f + 34.0f + TestSkin;
+
+	struct FCapsuleTestScene
+	{
+		TArray<FNormalVertex> Vertices;
+		TArray<uint32> Indices;
+		FMeshBVH BVH;
+
+		// Origin, Origin + U, Origin + U + V, Origin + V 사각형 (삼각형 둘)
+		void AddQuad(const FVector& Origin, const FVector& U, const FVector& V)
+		{
+			const uint32 Base = static_cast<uint32>(Vertices.Num());
+			for (const FVector& Position : { Origin, Origin + U, Origin + U + V, Origin + V })
+			{
+				FNormalVertex Vertex{};
+				Vertex.pos = Position;
+				Vertices.Add(Vertex);
+			}
+			const uint32 QuadIndices[6] = { 0, 1, 2, 0, 2, 3 };
+			for (uint32 Index : QuadIndices)
+			{
+				Indices.Add(Base + Index);
+			}
+		}
+
+		void AddFloor(float Z = 0.0f)
+		{
+			AddQuad(FVector(-1000.0f, -1000.0f, Z), FVector(2000.0f, 0.0f, 0.0f), FVector(0.0f, 2000.0f, 0.0f));
+		}
+
+		void Build()
+		{
+			BVH.Build(Vertices, Indices);
+		}
+
+		bool Sweep(const FVector& InStart, const FVector& InDelta, FCapsuleSweepHit& OutHit) const
+		{
+			OutHit = FCapsuleSweepHit();
+			return Collision::SweepCapsuleMesh(BVH, FMatrix::Identity(), InStart, InDelta, TestCapsule, TestSkin, OutHit);
+		}
+
+		// CharacterMovementComponent::FindFloor와 같은 순서: 아래로 스윕 -> 바닥 판정
+		bool FindWalkableFloor(const FVector& InCenter, float InSweepDistance, float& OutFloorDist, FVector& OutNormal) const
+		{
+			FCapsuleSweepHit Hit;
+			if (!Sweep(InCenter, FVector(0.0f, 0.0f, -InSweepDistance), Hit))
+			{
+				return false;
+			}
+			OutFloorDist = Hit.bStartPenetrating ? 0.0f : InSweepDistance * Hit.Time;
+			return Collision::IsWalkableFloorHit(InCenter, Hit, TestCapsule, TestSkin, TestWalkableFloorZ, OutNormal);
+		}
+	};
+
+	// 멈춘 캡슐과 표면 사이 간격이 스킨 근처인지 (스킨보다 가깝게 파고들지 않고, 너무 일찍 멈추지도 않음)
+	bool IsSkinGap(float InGap)
+	{
+		return InGap >= TestSkin - 1e-3f && InGap <= TestSkin * 1.5f;
+	}
+
+	bool NearlyEqualVector(const FVector& InA, const FVector& InB, float InTolerance = 1e-3f)
+	{
+		return std::fabs(InA.X - InB.X) <= InTolerance && std::fabs(InA.Y - InB.Y) <= InTolerance && std::fabs(InA.Z - InB.Z) <= InTolerance;
+	}
+}
+
+IMPLEMENT_SELF_TEST(CapsuleSweep, FlatFloor)
+{
+	FCapsuleTestScene Scene;
+	Scene.AddFloor();
+	Scene.Build();
+
+	// 바닥 20 위에서 내려오면 스킨만 남기고 멈추고, 법선은 위쪽
+	const FVector Center(0.0f, 0.0f, 54.0f + 34.0f + 20.0f);
+	float FloorDist = 0.0f;
+	FVector FloorNormal;
+	SELF_TEST_CHECK(Scene.FindWalkableFloor(Center, 100.0f, FloorDist, FloorNormal));
+	SELF_TEST_CHECK(IsSkinGap(20.0f - FloorDist));
+	SELF_TEST_CHECK(NearlyEqualVector(FloorNormal, FVector(0.0f, 0.0f, 1.0f)));
+	Test.AddInfo("FloorDist = %.4f", FloorDist);
+
+	// 스킨만큼 떠서 수평으로 걸으면 바닥 삼각형 경계에 걸리지 않음
+	FCapsuleSweepHit Hit;
+	SELF_TEST_CHECK(!Scene.Sweep(FVector(-600.0f, 13.0f, RestingCenterZ), FVector(1200.0f, 37.0f, 0.0f), Hit));
+
+	// 바닥에 닿지 않는 짧은 검사 거리면 바닥 없음
+	SELF_TEST_CHECK(!Scene.FindWalkableFloor(Center, 10.0f, FloorDist, FloorNormal));
+}
+
+IMPLEMENT_SELF_TEST(CapsuleSweep, StepUp)
+{
+	// 높이 20 턱: X = 100 앞면, 윗면은 X 100 ~ 300
+	FCapsuleTestScene Scene;
+	Scene.AddFloor();
+	Scene.AddQuad(FVector(100.0f, -200.0f, 0.0f), FVector(0.0f, 400.0f, 0.0f), FVector(0.0f, 0.0f, 20.0f));
+	Scene.AddQuad(FVector(100.0f, -200.0f, 20.0f), FVector(200.0f, 0.0f, 0.0f), FVector(0.0f, 400.0f, 0.0f));
+	Scene.Build();
+
+	// 걸어가다 턱 모서리에 반구가 닿음: 걸을 수 없는 법선이지만 높이가 MaxStepHeight 이하라 올라설 수 있는 턱
+	FCapsuleSweepHit Hit;
+	SELF_TEST_CHECK(Scene.Sweep(FVector(0.0f, 0.0f, RestingCenterZ), FVector(200.0f, 0.0f, 0.0f), Hit));
+	SELF_TEST_CHECK(!Hit.bStartPenetrating);
+	SELF_TEST_CHECK(!Collision::IsWalkableNormal(Hit.Normal, TestWalkableFloorZ));
+	const float CapsuleBottom = RestingCenterZ - TestCapsule.HalfHeight - TestCapsule.Radius;
+	const float StepHeight = Hit.ImpactPoint.Z - CapsuleBottom;
+	SELF_TEST_CHECK(StepHeight > 0.0f && StepHeight <= TestMaxStepHeight);
+	Test.AddInfo("step impact height = %.3f", StepHeight);
+
+	// StepUp처럼 MaxStepHeight만큼 올라가 앞으로 간 뒤 내려오면 턱 윗면이 걸을 수 있는 바닥
+	const FVector Raised(200.0f * Hit.Time, 0.0f, RestingCenterZ + TestMaxStepHeight);
+	SELF_TEST_CHECK(!Scene.Sweep(Raised, FVector(60.0f, 0.0f, 0.0f), Hit));
+	float FloorDist = 0.0f;
+	FVector FloorNormal;
+	const FVector StepCenter = Raised + FVector(60.0f, 0.0f, 0.0f);
+	SELF_TEST_CHECK(Scene.FindWalkableFloor(StepCenter, TestMaxStepHeight + TestSkin * 2.0f, FloorDist, FloorNormal));
+	SELF_TEST_CHECK(IsSkinGap(StepCenter.Z - FloorDist - TestCapsule.HalfHeight - TestCapsule.Radius - 20.0f));
+}
+
+IMPLEMENT_SELF_TEST(CapsuleSweep, LedgeEdgeFloor)
+{
+	// 앞면 없는 얇은 발판 (X >= 100, 높이 20): 반구가 모서리에 걸친 경우만 확인
+	FCapsuleTestScene Scene;
+	Scene.AddQuad(FVector(100.0f, -200.0f, 20.0f), FVector(200.0f, 0.0f, 0.0f), FVector(0.0f, 400.0f, 0.0f));
+	Scene.Build();
+
+	const float CenterZ = 20.0f + TestCapsule.HalfHeight + TestCapsule.Radius + 10.0f;
+
+	// 중심이 모서리에서 28 밖: 접촉 법선은 가파르지만 닿은 면은 평평하고 접점이 캡슐 안쪽 -> 바닥
+	float FloorDist = 0.0f;
+	FVector FloorNormal;
+	SELF_TEST_CHECK(Scene.FindWalkableFloor(FVector(72.0f, 0.0f, CenterZ), 40.0f, FloorDist, FloorNormal));
+	SELF_TEST_CHECK(NearlyEqualVector(FloorNormal, FVector(0.0f, 0.0f, 1.0f)));
+
+	// 모서리가 캡슐 가장자리 (Radius - Skin 밖)에 스치면 바닥이 아님
+	SELF_TEST_CHECK(!Scene.FindWalkableFloor(FVector(100.0f - 33.8f, 0.0f, CenterZ), 40.0f, FloorDist, FloorNormal));
+}
+
+IMPLEMENT_SELF_TEST(CapsuleSweep, SlopeWalkableLimit)
+{
+	// X 방향으로 Angle만큼 기운 경사면 위에 내려앉기
+	auto LandOnSlope = [](float InAngleDegrees, FVector& OutNormal) -> bool
+	{
+		const float Radians = DegreesToRadians(InAngleDegrees);
+		FCapsuleTestScene Scene;
+		Scene.AddQuad(FVector(-500.0f * std::cos(Radians), -500.0f, -500.0f * std::sin(Radians)),
+			FVector(1000.0f * std::cos(Radians), 0.0f, 1000.0f * std::sin(Radians)), FVector(0.0f, 1000.0f, 0.0f));
+		Scene.Build();
+
+		float FloorDist = 0.0f;
+		return Scene.FindWalkableFloor(FVector(0.0f, 0.0f, 300.0f), 600.0f, FloorDist, OutNormal);
+	};
+
+	FVector Normal;
+	SELF_TEST_CHECK(LandOnSlope(30.0f, Normal));
+	SELF_TEST_CHECK(std::fabs(Normal.Z - std::cos(DegreesToRadians(30.0f))) <= 1e-3f);
+
+	// 한계(44.765도) 바로 아래는 걸을 수 있고, 넘으면 닿아도 바닥이 아님
+	SELF_TEST_CHECK(LandOnSlope(44.0f, Normal));
+	SELF_TEST_CHECK(!LandOnSlope(46.0f, Normal));
+	SELF_TEST_CHECK(!LandOnSlope(60.0f, Normal));
+}
+
+IMPLEMENT_SELF_TEST(CapsuleSweep, WallHit)
+{
+	// X = 200 에 높이 300 벽
+	FCapsuleTestScene Scene;
+	Scene.AddFloor();
+	Scene.AddQuad(FVector(200.0f, -500.0f, 0.0f), FVector(0.0f, 1000.0f, 0.0f), FVector(0.0f, 0.0f, 300.0f));
+	Scene.Build();
+
+	const FVector Start(0.0f, 0.0f, RestingCenterZ);
+	FCapsuleSweepHit Hit;
+	SELF_TEST_CHECK(Scene.Sweep(Start, FVector(400.0f, 0.0f, 0.0f), Hit));
+	SELF_TEST_CHECK(!Hit.bStartPenetrating);
+	SELF_TEST_CHECK(NearlyEqualVector(Hit.Normal, FVector(-1.0f, 0.0f, 0.0f)));
+	SELF_TEST_CHECK(!Collision::IsWalkableNormal(Hit.Normal, TestWalkableFloorZ));
+
+	const float StopX = Start.X + 400.0f * Hit.Time;
+	SELF_TEST_CHECK(IsSkinGap(200.0f - StopX - TestCapsule.Radius));
+	Test.AddInfo("wall gap = %.4f", 200.0f - StopX - TestCapsule.Radius);
+
+	// 벽에 붙은 채로 벽을 따라 미끄러지면 막히지 않음
+	SELF_TEST_CHECK(!Scene.Sweep(FVector(StopX, 0.0f, RestingCenterZ), FVector(0.0f, 300.0f, 0.0f), Hit));
+
+	// 이미 벽에 파고든 위치에서 시작하면 밀어낼 방향과 깊이를 알려줌
+	SELF_TEST_CHECK(Scene.Sweep(FVector(200.0f - TestCapsule.Radius + 5.0f, 0.0f, RestingCenterZ), FVector(10.0f, 0.0f, 0.0f), Hit));
+	SELF_TEST_CHECK(Hit.bStartPenetrating && Hit.Time == 0.0f);
+	SELF_TEST_CHECK(Hit.Normal.X < -0.99f && Hit.PenetrationDepth >= 5.0f);
+}
@@ -71,7 +71,7 @@ void FCollisionBVH::BulkUpdate(const TArray<UShapeComponent*>& Components)
 {
 	for (UShapeComponent* Comp : Components)
 	{
-		if (Comp && Comp->bGenerateOverlapEvents)
+		if (Comp && Comp->ShouldGenerateOverlapEvents())
 		{
 			// Bounds 강제 업데이트 (World Transform이 설정된 후)
 			Comp->UpdateBounds();
@@ -92,7 +92,7 @@ void FCollisionBVH::Update(UShapeComponent* InComponent)
 		return;
 	}
 
-	if (!InComponent->bGenerateOverlapEvents)
+	if (!InComponent->ShouldGenerateOverlapEvents())
 	{
 		// Overlap 이벤트를 생성하지 않으면 제거
 		Remove(InComponent);
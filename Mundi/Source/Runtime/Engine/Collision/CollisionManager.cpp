@@ -37,20 +37,28 @@ void UCollisionManager::RegisterComponent(UShapeComponent* Component)
 		return;
 	}
 
+	// 지연 등록 구간이면 대기 목록에만 추가 (EndDeferredRegistration에서 일괄 처리)
+	if (DeferredRegistrationDepth > 0)
+	{
+		DeferredComponents.push_back(Component);
+		return;
+	}
+
 	// 이미 등록된 컴포넌트는 무시
-	if (RegisteredComponents.Contains(Component))
+	if (RegisteredSet.Contains(Component))
 	{
 		return;
 	}
 
 	// Overlap 이벤트를 생성하지 않으면 등록하지 않음
-	if (!Component->bGenerateOverlapEvents)
+	if (!Component->ShouldGenerateOverlapEvents())
 	{
 		return;
 	}
 
 	// 컴포넌트 등록
 	RegisteredComponents.push_back(Component);
+	RegisteredSet.Add(Component);
 
 	// BVH에 추가
 	BVH->Update(Component);
@@ -68,17 +76,31 @@ void UCollisionManager::UnregisterComponent(UShapeComponent* Component)
 		return;
 	}
 
+	// 지연 등록 대기 중이던 컴포넌트는 대기 목록에서만 제거
+	DeferredComponents.erase(
+		std::remove(DeferredComponents.begin(), DeferredComponents.end(), Component),
+		DeferredComponents.end()
+	);
+
 	// 등록되지 않은 컴포넌트는 무시
-	if (!RegisteredComponents.Contains(Component))
+	if (!RegisteredSet.Remove(Component))
 	{
 		return;
 	}
 
-	// 컴포넌트 제거
-	RegisteredComponents.erase(
-		std::remove(RegisteredComponents.begin(), RegisteredComponents.end(), Component),
-		RegisteredComponents.end()
-	);
+	// 컴포넌트 제거 (UpdateCollisions 순회 중이면 순서를 유지하도록 슬롯만 비우고 순회 후 정리)
+	if (bUpdatingCollisions)
+	{
+		std::replace(RegisteredComponents.begin(), RegisteredComponents.end(), Component, static_cast<UShapeComponent*>(nullptr));
+		bHasRemovedSlots = true;
+	}
+	else
+	{
+		RegisteredComponents.erase(
+			std::remove(RegisteredComponents.begin(), RegisteredComponents.end(), Component),
+			RegisteredComponents.end()
+		);
+	}
 
 	// BVH에서 제거
 	BVH->Remove(Component);
@@ -94,6 +116,51 @@ void UCollisionManager::UnregisterComponent(UShapeComponent* Component)
 	UE_LOG("CollisionManager: Unregistered component {}", Component->GetName());
 }
 
+void UCollisionManager::BulkRegister(const TArray<UShapeComponent*>& Components)
+{
+	const int32 PreviousCount = RegisteredComponents.Num();
+	RegisteredComponents.reserve(PreviousCount + Components.Num());
+
+	for (UShapeComponent* Component : Components)
+	{
+		if (!Component || !Component->ShouldGenerateOverlapEvents() || RegisteredSet.Contains(Component))
+		{
+			continue;
+		}
+
+		RegisteredComponents.push_back(Component);
+		RegisteredSet.Add(Component);
+	}
+
+	const int32 AddedCount = RegisteredComponents.Num() - PreviousCount;
+	if (AddedCount > 0)
+	{
+		// 컴포넌트별 BVH 삽입 대신 다음 UpdateCollisions()에서 한 번만 재구축
+		bNeedsFullRebuild = true;
+		UE_LOG("CollisionManager: Bulk registered %d components", AddedCount);
+	}
+}
+
+void UCollisionManager::BeginDeferredRegistration()
+{
+	++DeferredRegistrationDepth;
+}
+
+void UCollisionManager::EndDeferredRegistration()
+{
+	if (DeferredRegistrationDepth <= 0)
+	{
+		return;
+	}
+
+	if (--DeferredRegistrationDepth == 0 && !DeferredComponents.empty())
+	{
+		TArray<UShapeComponent*> Pending = std::move(DeferredComponents);
+		DeferredComponents.clear();
+		BulkRegister(Pending);
+	}
+}
+
 void UCollisionManager::MarkComponentDirty(UShapeComponent* Component)
 {
 	if (!Component)
@@ -102,7 +169,7 @@ void UCollisionManager::MarkComponentDirty(UShapeComponent* Component)
 	}
 
 	// 등록된 컴포넌트만 Dirty 마킹
-	if (!RegisteredComponents.Contains(Component))
+	if (!RegisteredSet.Contains(Component))
 	{
 		return;
 	}
@@ -141,9 +208,14 @@ void UCollisionManager::UpdateCollisions(float DeltaTime)
 	BVH->FlushRebuild();
 
 	// 3. 모든 컴포넌트에 대해 충돌 체크
-	for (UShapeComponent* Comp : RegisteredComponents)
+	//    Overlap 이벤트에서 액터가 파괴/풀 반납되어 등록이 바뀔 수 있으므로 인덱스로 순회
+	//    (새로 등록된 컴포넌트는 다음 프레임부터 검사)
+	bUpdatingCollisions = true;
+	const int32 Count = RegisteredComponents.Num();
+	for (int32 Index = 0; Index < Count; ++Index)
 	{
-		if (!Comp || !Comp->bGenerateOverlapEvents)
+		UShapeComponent* Comp = RegisteredComponents[Index];
+		if (!Comp || !Comp->ShouldGenerateOverlapEvents())
 		{
 			continue;
 		}
@@ -163,6 +235,16 @@ void UCollisionManager::UpdateCollisions(float DeltaTime)
 		// UpdateOverlaps가 내부적으로 BeginOverlap/EndOverlap 델리게이트 호출
 		Comp->UpdateOverlaps(PotentialOverlaps);
 	}
+	bUpdatingCollisions = false;
+
+	if (bHasRemovedSlots)
+	{
+		RegisteredComponents.erase(
+			std::remove(RegisteredComponents.begin(), RegisteredComponents.end(), static_cast<UShapeComponent*>(nullptr)),
+			RegisteredComponents.end()
+		);
+		bHasRemovedSlots = false;
+	}
 
 	// 4. Dirty 플래그 초기화
 	ClearDirtyFlags();
@@ -244,7 +326,7 @@ void UCollisionManager::UpdateBVHIncremental()
 	// Dirty 컴포넌트만 증분 업데이트
 	for (UShapeComponent* Comp : DirtyComponents)
 	{
-		if (Comp && Comp->bGenerateOverlapEvents)
+		if (Comp && Comp->ShouldGenerateOverlapEvents())
 		{
 			BVH->Update(Comp);
 		}
@@ -62,6 +62,22 @@ public:
 	 */
 	void UnregisterComponent(UShapeComponent* Component);
 
+	/**
+	 * 여러 ShapeComponent를 한 번에 등록합니다.
+	 * 컴포넌트별 BVH 삽입 없이 목록에만 추가하고, BVH는 마지막에 한 번만 재구축합니다.
+	 *
+	 * @param Components - 등록할 컴포넌트 목록
+	 */
+	void BulkRegister(const TArray<UShapeComponent*>& Components);
+
+	/**
+	 * 지연 등록 구간을 시작/종료합니다.
+	 * 구간 안의 RegisterComponent() 호출은 대기 목록에 쌓였다가 EndDeferredRegistration()에서 BulkRegister로 처리됩니다.
+	 * 레벨 로드, PIE 시작처럼 대량의 BeginPlay가 연달아 호출될 때 사용합니다.
+	 */
+	void BeginDeferredRegistration();
+	void EndDeferredRegistration();
+
 	/**
 	 * 컴포넌트가 이동했음을 알립니다.
 	 * Transform 변경 시 호출하여 BVH 업데이트를 예약합니다.
@@ -167,12 +183,27 @@ private:
 	/** 등록된 모든 컴포넌트 */
 	TArray<UShapeComponent*> RegisteredComponents;
 
+	/** 등록 여부 검사용 (RegisteredComponents와 동일한 내용) */
+	TSet<UShapeComponent*> RegisteredSet;
+
+	/** 지연 등록 대기 목록 */
+	TArray<UShapeComponent*> DeferredComponents;
+
+	/** 지연 등록 구간 중첩 깊이 */
+	int32 DeferredRegistrationDepth = 0;
+
 	/** 이동한 컴포넌트 (증분 업데이트용) */
 	TArray<UShapeComponent*> DirtyComponents;
 
 	/** 완전 재구축 필요 여부 */
 	bool bNeedsFullRebuild = false;
 
+	/** UpdateCollisions 순회 중 여부 (Overlap 이벤트에서 등록 해제되면 슬롯만 비움) */
+	bool bUpdatingCollisions = false;
+
+	/** 순회 중 비운 슬롯이 있는지 (순회 후 RegisteredComponents 정리) */
+	bool bHasRemovedSlots = false;
+
 	/** 이번 프레임에 처리된 충돌 쌍 수 (통계용) */
 	int32 CollisionPairsChecked = 0;
 
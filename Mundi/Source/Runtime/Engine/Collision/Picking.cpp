@@ -22,6 +22,59 @@
 #include"stdio.h"
 #include "WorldPartitionManager.h"
 #include "PlatformTime.h"
+#include "BVHierarchy.h"
+#include "BillboardComponent.h"
+#include "TextRenderComponent.h"
+#include <immintrin.h>
+
+namespace
+{
+	// 월드 레이를 컴포넌트 로컬로. 아핀 변환이라 로컬 t와 월드 t가 같은 점을 가리킴 (월드 Direction이 정규화면 t가 곧 월드 거리)
+	inline FRay ToLocalRay(const FRay& InRay, const FMatrix& InInvWorld)
+	{
+		const FVector4 LocalOrigin4 = FVector4(InRay.Origin.X, InRay.Origin.Y, InRay.Origin.Z, 1.0f) * InInvWorld;
+		const FVector4 LocalDir4 = FVector4(InRay.Direction.X, InRay.Direction.Y, InRay.Direction.Z, 0.0f) * InInvWorld;
+		return FRay{ FVector(LocalOrigin4.X, LocalOrigin4.Y, LocalOrigin4.Z), FVector(LocalDir4.X, LocalDir4.Y, LocalDir4.Z) };
+	}
+
+	inline FMeshBVH* GetComponentMeshBVH(const UStaticMeshComponent* InComponent, FStaticMesh*& OutStaticMesh)
+	{
+		UStaticMesh* MeshRes = InComponent ? InComponent->GetStaticMesh() : nullptr;
+		OutStaticMesh = MeshRes ? MeshRes->GetStaticMeshAsset() : nullptr;
+		if (!OutStaticMesh)
+		{
+			return nullptr;
+		}
+		// 캐시된 BVH 사용 (동일 OBJ 경로는 동일 BVH 공유)
+		return UResourceManager::GetInstance().GetOrBuildMeshBVH(MeshRes->GetAssetPathFileName(), OutStaticMesh);
+	}
+
+	// 두 삼각형으로 된 사각형 (InCorner에서 InAxisA, InAxisB 방향)
+	inline bool IntersectRayQuad(const FRay& InRay, const FVector& InCorner, const FVector& InAxisA, const FVector& InAxisB, float& OutT)
+	{
+		const FVector P0 = InCorner;
+		const FVector P1 = InCorner + InAxisA;
+		const FVector P2 = InCorner + InAxisB;
+		const FVector P3 = InCorner + InAxisA + InAxisB;
+		return IntersectRayTriangleMT(InRay, P0, P1, P2, OutT) || IntersectRayTriangleMT(InRay, P1, P3, P2, OutT);
+	}
+}
+
+void FRayPacket4::Set(const FRay* InRays, int32 InCount)
+{
+	Count = std::clamp(InCount, 0, 4);
+	for (int32 Lane = 0; Lane < 4; ++Lane)
+	{
+		// 비활성 레인은 0번 레이를 복제 (결과는 마스크로 버림)
+		const FRay& Ray = InRays[Lane < Count ? Lane : 0];
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Origin[Axis][Lane] = Ray.Origin[Axis];
+			Direction[Axis][Lane] = Ray.Direction[Axis];
+			InvDirection[Axis][Lane] = SafeInverse(Ray.Direction[Axis]);
+		}
+	}
+}
 
 FRay MakeRayFromMouse(const FMatrix& InView,
 	const FMatrix& InProj)
@@ -225,6 +278,23 @@ bool IntersectRayTriangleMT(const FRay& InRay, const FVector& InA, const FVector
 	return false;
 }
 
+uint32 IntersectRayPacketAABB(const FRayPacket4& InPacket, const FAABB& InBox, const float InMaxDistances[4])
+{
+	__m128 Enter = _mm_setzero_ps();
+	__m128 Exit = _mm_loadu_ps(InMaxDistances);
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const __m128 Origin = _mm_load_ps(InPacket.Origin[Axis]);
+		const __m128 InvDirection = _mm_load_ps(InPacket.InvDirection[Axis]);
+		const __m128 T1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(InBox.Min[Axis]), Origin), InvDirection);
+		const __m128 T2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(InBox.Max[Axis]), Origin), InvDirection);
+		Enter = _mm_max_ps(Enter, _mm_min_ps(T1, T2));
+		Exit = _mm_min_ps(Exit, _mm_max_ps(T1, T2));
+	}
+	const uint32 ActiveMask = (1u << InPacket.Count) - 1u;
+	return static_cast<uint32>(_mm_movemask_ps(_mm_cmple_ps(Enter, Exit))) & ActiveMask;
+}
+
 // PickingSystem 구현
 AActor* CPickingSystem::PerformPicking(const TArray<AActor*>& Actors, ACameraActor* Camera)
 {
@@ -395,6 +465,135 @@ AActor* CPickingSystem::PerformViewportPicking(const TArray<AActor*>& Actors,
 	}
 }
 
+UPrimitiveComponent* CPickingSystem::PerformViewportComponentPicking(ACameraActor* Camera,
+	const FVector2D& ViewportMousePos,
+	const FVector2D& ViewportSize,
+	const FVector2D& ViewportOffset,
+	float ViewportAspectRatio, FViewport* Viewport)
+{
+	if (!Camera) return nullptr;
+	UWorld* CurrentWorld = Camera->GetWorld();
+	if (!CurrentWorld) return nullptr;
+
+	const FMatrix View = Camera->GetViewMatrix();
+	const FMatrix Proj = Camera->GetProjectionMatrix(ViewportAspectRatio, Viewport);
+	const FVector CameraWorldPos = Camera->GetActorLocation();
+	const FVector CameraRight = Camera->GetRight();
+	const FVector CameraUp = Camera->GetUp();
+	const FVector CameraForward = Camera->GetForward();
+
+	FRay ray = MakeRayFromViewport(View, Proj, CameraWorldPos, CameraRight, CameraUp, CameraForward,
+		ViewportMousePos, ViewportSize, ViewportOffset);
+
+	FScopeCycleCounter PickCounter;
+	++TotalPickCount;
+
+	float PickedT = FLT_MAX;
+	UPrimitiveComponent* Picked = nullptr;
+
+	if (UWorldPartitionManager* Partition = CurrentWorld->GetPartitionManager())
+	{
+		if (FBVHierarchy* BVH = Partition->GetBVH())
+		{
+			UStaticMeshComponent* PickedMesh = nullptr;
+			BVH->QueryRayClosestComponent(ray, PickedMesh, PickedT);
+			Picked = PickedMesh;
+		}
+	}
+
+	// 빌보드/텍스트는 월드 BVH에 없으므로 메시 히트보다 가까운 것만 따로 찾음
+	if (UPrimitiveComponent* PickedSprite = PickSpriteComponents(CurrentWorld, ray, CameraRight, CameraUp, PickedT))
+	{
+		Picked = PickedSprite;
+	}
+
+	LastPickTime = PickCounter.Finish();
+	TotalPickTime += LastPickTime;
+	const double Milliseconds = ((double)LastPickTime * FPlatformTime::GetSecondsPerCycle()) * 1000.0f;
+
+	char buf[160];
+	if (Picked)
+	{
+		sprintf_s(buf, "[Pick] Hit component at t=%.3f | time=%.6lf ms\n", PickedT, Milliseconds);
+	}
+	else
+	{
+		sprintf_s(buf, "[Pick] No hit | time=%.6f ms\n", Milliseconds);
+	}
+	UE_LOG(buf);
+	return Picked;
+}
+
+void CPickingSystem::PerformViewportMarqueePicking(ACameraActor* Camera,
+	const FVector2D& InRectStart,
+	const FVector2D& InRectEnd,
+	const FVector2D& ViewportSize,
+	const FVector2D& ViewportOffset,
+	float ViewportAspectRatio, FViewport* Viewport,
+	TArray<UStaticMeshComponent*>& OutComponents,
+	float InRayStep)
+{
+	OutComponents.Empty();
+	if (!Camera) return;
+	UWorld* CurrentWorld = Camera->GetWorld();
+	if (!CurrentWorld) return;
+	UWorldPartitionManager* Partition = CurrentWorld->GetPartitionManager();
+	FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	if (!BVH) return;
+
+	const FMatrix View = Camera->GetViewMatrix();
+	const FMatrix Proj = Camera->GetProjectionMatrix(ViewportAspectRatio, Viewport);
+	const FVector CameraWorldPos = Camera->GetActorLocation();
+	const FVector CameraRight = Camera->GetRight();
+	const FVector CameraUp = Camera->GetUp();
+	const FVector CameraForward = Camera->GetForward();
+
+	const float Step = std::max(InRayStep, 1.0f);
+	const float MinX = std::min(InRectStart.X, InRectEnd.X);
+	const float MaxX = std::max(InRectStart.X, InRectEnd.X);
+	const float MinY = std::min(InRectStart.Y, InRectEnd.Y);
+	const float MaxY = std::max(InRectStart.Y, InRectEnd.Y);
+
+	// 2x2 이웃 레이 4개를 연속으로 넣어 QueryRayPacketClosest가 한 패킷으로 묶도록 (방향이 비슷해 같은 노드를 함께 내려감)
+	TArray<FRay> Rays;
+	const int32 CountX = static_cast<int32>((MaxX - MinX) / Step) + 1;
+	const int32 CountY = static_cast<int32>((MaxY - MinY) / Step) + 1;
+	Rays.Reserve(static_cast<size_t>(CountX + 1) * (CountY + 1));
+	for (int32 BlockY = 0; BlockY < CountY; BlockY += 2)
+	{
+		for (int32 BlockX = 0; BlockX < CountX; BlockX += 2)
+		{
+			for (int32 Sub = 0; Sub < 4; ++Sub)
+			{
+				const int32 IndexX = BlockX + (Sub & 1);
+				const int32 IndexY = BlockY + (Sub >> 1);
+				if (IndexX >= CountX || IndexY >= CountY)
+				{
+					continue;
+				}
+				const FVector2D MousePos(MinX + IndexX * Step, MinY + IndexY * Step);
+				Rays.Add(MakeRayFromViewport(View, Proj, CameraWorldPos, CameraRight, CameraUp, CameraForward,
+					MousePos, ViewportSize, ViewportOffset));
+			}
+		}
+	}
+
+	TArray<UStaticMeshComponent*> Hits;
+	TArray<float> HitDistances;
+	Hits.SetNum(Rays.Num());
+	HitDistances.SetNum(Rays.Num(), FLT_MAX);
+	BVH->QueryRayPacketClosest(Rays.data(), Rays.Num(), Hits.data(), HitDistances.data());
+
+	TSet<UStaticMeshComponent*> Unique;
+	for (UStaticMeshComponent* Hit : Hits)
+	{
+		if (Hit && Unique.insert(Hit).second)
+		{
+			OutComponents.Add(Hit);
+		}
+	}
+}
+
 uint32 CPickingSystem::IsHoveringGizmoForViewport(AGizmoActor* GizmoTransActor, const ACameraActor* Camera,
 	const FVector2D& ViewportMousePos,
 	const FVector2D& ViewportSize,
@@ -652,47 +851,146 @@ bool CPickingSystem::CheckActorPicking(const AActor* Actor, const FRay& Ray, flo
 {
 	if (!Actor) return false;
 
-	// 액터의 모든 SceneComponent 순회
+	// 액터의 모든 StaticMeshComponent 중 가장 가까운 교차
+	bool bHasHit = false;
+	float BestDistance = FLT_MAX;
 	for (auto SceneComponent : Actor->GetSceneComponents())
 	{
 		if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(SceneComponent))
 		{
-			UStaticMesh* MeshRes = StaticMeshComponent->GetStaticMesh();
-			if (!MeshRes) continue;
-
-			FStaticMesh* StaticMesh = MeshRes->GetStaticMeshAsset();
-			if (!StaticMesh) continue;
-
-			// 로컬 공간에서의 레이로 변환
-			const FMatrix WorldMatrix = StaticMeshComponent->GetWorldMatrix();
-			const FMatrix InvWorld = WorldMatrix.InverseAffine();
-			const FVector4 RayOrigin4(Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z, 1.0f);
-			const FVector4 RayDir4(Ray.Direction.X, Ray.Direction.Y, Ray.Direction.Z, 0.0f);
-			const FVector4 LocalOrigin4 = RayOrigin4 * InvWorld;
-			const FVector4 LocalDir4 = RayDir4 * InvWorld;
-			const FRay LocalRay{ FVector(LocalOrigin4.X, LocalOrigin4.Y, LocalOrigin4.Z), FVector(LocalDir4.X, LocalDir4.Y, LocalDir4.Z) };
-
-			// 캐시된 BVH 사용 (동일 OBJ 경로는 동일 BVH 공유)
-			FMeshBVH* BVH = UResourceManager::GetInstance().GetOrBuildMeshBVH(MeshRes->GetAssetPathFileName(), StaticMesh);
-			if (BVH)
+			float HitDistance;
+			if (CheckComponentPicking(StaticMeshComponent, Ray, BestDistance, HitDistance))
 			{
-				float THitLocal;
-				if (BVH->IntersectRay(LocalRay, StaticMesh->Vertices, StaticMesh->Indices, THitLocal))
-				{
-					const FVector HitLocal = FVector(
-						LocalOrigin4.X + LocalDir4.X * THitLocal,
-						LocalOrigin4.Y + LocalDir4.Y * THitLocal,
-						LocalOrigin4.Z + LocalDir4.Z * THitLocal);
-					const FVector4 HitLocal4(HitLocal.X, HitLocal.Y, HitLocal.Z, 1.0f);
-					const FVector4 HitWorld4 = HitLocal4 * WorldMatrix;
-					const FVector HitWorld(HitWorld4.X, HitWorld4.Y, HitWorld4.Z);
-					const float THitWorld = (HitWorld - Ray.Origin).Size();
-					OutDistance = THitWorld;
-					return true;
-				}
+				BestDistance = HitDistance;
+				bHasHit = true;
 			}
 		}
 	}
 
-	return false;
+	if (bHasHit)
+	{
+		OutDistance = BestDistance;
+	}
+	return bHasHit;
+}
+
+bool CPickingSystem::CheckComponentPicking(const UStaticMeshComponent* Component, const FRay& Ray, float InMaxDistance, float& OutDistance)
+{
+	FStaticMesh* StaticMesh = nullptr;
+	FMeshBVH* BVH = GetComponentMeshBVH(Component, StaticMesh);
+	if (!BVH)
+	{
+		return false;
+	}
+
+	// 로컬 공간에서의 레이로 변환 (t는 그대로 월드 거리)
+	const FRay LocalRay = ToLocalRay(Ray, Component->GetWorldMatrix().InverseAffine());
+	return BVH->IntersectRay(LocalRay, OutDistance, InMaxDistance);
+}
+
+uint32 CPickingSystem::CheckComponentPickingPacket(const UStaticMeshComponent* Component, const FRayPacket4& Packet, float InOutDistances[4])
+{
+	FStaticMesh* StaticMesh = nullptr;
+	FMeshBVH* BVH = GetComponentMeshBVH(Component, StaticMesh);
+	if (!BVH || Packet.Count <= 0)
+	{
+		return 0;
+	}
+
+	const FMatrix InvWorld = Component->GetWorldMatrix().InverseAffine();
+	FRay LocalRays[4];
+	for (int32 Lane = 0; Lane < Packet.Count; ++Lane)
+	{
+		const FRay WorldRay{
+			FVector(Packet.Origin[0][Lane], Packet.Origin[1][Lane], Packet.Origin[2][Lane]),
+			FVector(Packet.Direction[0][Lane], Packet.Direction[1][Lane], Packet.Direction[2][Lane]) };
+		LocalRays[Lane] = ToLocalRay(WorldRay, InvWorld);
+	}
+
+	FRayPacket4 LocalPacket;
+	LocalPacket.Set(LocalRays, Packet.Count);
+	return BVH->IntersectRayPacket(LocalPacket, InOutDistances);
+}
+
+UPrimitiveComponent* CPickingSystem::PickSpriteComponents(UWorld* World, const FRay& Ray,
+	const FVector& CameraRight, const FVector& CameraUp, float& InOutBestT)
+{
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	// SceneRenderer의 수집 조건과 같음: 에디터 보조 빌보드는 항상, 일반 빌보드/텍스트는 Billboard ShowFlag
+	const bool bUseBillboard = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Billboard);
+
+	// 월드에 등록된 빌보드/텍스트만 순회 (OnRegister/OnUnregister로 유지, 클릭마다 모든 액터를 훑지 않음)
+	UPrimitiveComponent* Picked = nullptr;
+	for (UPrimitiveComponent* Component : World->GetSpriteComponents())
+	{
+		AActor* Actor = Component->GetOwner();
+		if (!Actor || Actor->IsPendingDestroy() || !Actor->IsActorVisible() || Actor->GetActorHiddenInEditor() || !Component->IsVisible())
+		{
+			continue;
+		}
+
+		float HitT = 0.0f;
+		if (UBillboardComponent* Billboard = Cast<UBillboardComponent>(Component))
+		{
+			if (Billboard->IsEditable() && !bUseBillboard)
+			{
+				continue;
+			}
+
+			// CollectSprites와 같은 쿼드: 가장 큰 스케일 성분을 한 변으로 하는 카메라 정면 사각형
+			const float Size = Billboard->GetRelativeScale().GetMaxValue();
+			const FVector AxisX = CameraRight * Size;
+			const FVector AxisY = CameraUp * Size;
+			const FVector Corner = Billboard->GetWorldLocation() - AxisX * 0.5f - AxisY * 0.5f;
+			if (!IntersectRayQuad(Ray, Corner, AxisX, AxisY, HitT))
+			{
+				continue;
+			}
+		}
+		else if (UTextRenderComponent* Text = Cast<UTextRenderComponent>(Component))
+		{
+			if (!bUseBillboard || Text->GetText().empty())
+			{
+				continue;
+			}
+
+			// TessellateText와 같은 배치: 로컬 (0, X, Y)에서 글자폭 * 유효 글자 수, 높이 1
+			const FGlyphTable& Glyphs = UTextRenderComponent::GetGlyphTable();
+			int32 ValidGlyphs = 0;
+			for (char Ch : Text->GetText())
+			{
+				ValidGlyphs += Glyphs.Get(static_cast<uint8>(Ch)).bValid ? 1 : 0;
+			}
+			if (ValidGlyphs == 0)
+			{
+				continue;
+			}
+
+			const FMatrix WorldMatrix = Text->GetWorldMatrix();
+			const FVector AxisX(WorldMatrix.M[1][0], WorldMatrix.M[1][1], WorldMatrix.M[1][2]);
+			const FVector AxisY(WorldMatrix.M[2][0], WorldMatrix.M[2][1], WorldMatrix.M[2][2]);
+			const FVector Origin(WorldMatrix.M[3][0], WorldMatrix.M[3][1], WorldMatrix.M[3][2]);
+			const float CharWidth = Glyphs.GetAspect();
+			const float StartX = -CharWidth * static_cast<float>(Text->GetText().size() / 2);
+			if (!IntersectRayQuad(Ray, Origin + AxisX * StartX, AxisX * (CharWidth * ValidGlyphs), AxisY, HitT))
+			{
+				continue;
+			}
+		}
+		else
+		{
+			continue;
+		}
+
+		if (HitT < InOutBestT)
+		{
+			InOutBestT = HitT;
+			Picked = Component;
+		}
+	}
+	return Picked;
 }
@@ -5,7 +5,10 @@
 #include "Enums.h"
 
 class UStaticMeshComponent;
+class UPrimitiveComponent;
 class AGizmoActor;
+class UWorld;
+struct FAABB;
 // Forward Declarations
 class AActor;
 class ACameraActor;
@@ -17,6 +20,27 @@ struct alignas(16) FRay
     FVector Direction; // Normalized
 };
 
+// 레이 4개를 SoA로 묶은 패킷 (SIMD 패킷 탐색용, [축][레인]). Count 이후 레인은 비활성
+struct alignas(16) FRayPacket4
+{
+    float Origin[3][4];
+    float Direction[3][4];
+    float InvDirection[3][4];  // 0에 가까운 성분은 부호를 유지한 큰 값 (슬랩 검사에서 NaN 방지)
+    int32 Count = 0;
+
+    void Set(const FRay* InRays, int32 InCount);
+
+    static float SafeInverse(float InValue)
+    {
+        const float Tiny = 1e-20f;
+        if (std::fabs(InValue) < Tiny)
+        {
+            InValue = InValue < 0.0f ? -Tiny : Tiny;
+        }
+        return 1.0f / InValue;
+    }
+};
+
 // Build A world-space ray from the current mouse position and camera/projection info.
 // - InView: view matrix (row-major, row-vector convention; built by LookAtLH)
 // - InProj: projection matrix created by PerspectiveFovLH in this project
@@ -54,6 +78,10 @@ bool IntersectRayTriangleMT(const FRay& InRay,
                             const FVector& InC,
                             float& OutT);
 
+// 레이 패킷 4개 vs AABB (SSE 슬랩 검사). [0, InMaxDistances[i]] 안에서 박스를 지나는 레인 비트마스크
+// InMaxDistances가 음수인 레인은 항상 실패
+uint32 IntersectRayPacketAABB(const FRayPacket4& InPacket, const FAABB& InBox, const float InMaxDistances[4]);
+
 /**
  * PickingSystem
  * - 액터 피킹 관련 로직을 담당하는 클래스
@@ -79,6 +107,25 @@ public:
                                           const FVector2D& ViewportOffset,
                                           float ViewportAspectRatio, FViewport* Viewport);
 
+    // CPU 컴포넌트 피킹 (GPU ID 버퍼 리드백 없음)
+    // 스태틱 메시는 월드 BVH -> 메시 BVH, 빌보드/텍스트는 화면에 그려지는 쿼드로 검사해 가장 가까운 것을 반환
+    static UPrimitiveComponent* PerformViewportComponentPicking(ACameraActor* Camera,
+                                                                const FVector2D& ViewportMousePos,
+                                                                const FVector2D& ViewportSize,
+                                                                const FVector2D& ViewportOffset,
+                                                                float ViewportAspectRatio, FViewport* Viewport);
+
+    // 마키 선택: 사각형 [InRectStart, InRectEnd] (전역 마우스 좌표) 안을 InRayStep 픽셀 간격 레이로 훑어
+    // 보이는 스태틱 메시 컴포넌트를 수집. 2x2 이웃 레이를 패킷 하나로 묶어 탐색
+    static void PerformViewportMarqueePicking(ACameraActor* Camera,
+                                              const FVector2D& InRectStart,
+                                              const FVector2D& InRectEnd,
+                                              const FVector2D& ViewportSize,
+                                              const FVector2D& ViewportOffset,
+                                              float ViewportAspectRatio, FViewport* Viewport,
+                                              TArray<UStaticMeshComponent*>& OutComponents,
+                                              float InRayStep = 4.0f);
+
     // 뷰포트 정보를 명시적으로 받는 기즈모 호버링 검사
     static uint32 IsHoveringGizmoForViewport(AGizmoActor* GizmoActor, const ACameraActor* Camera,
                                              const FVector2D& ViewportMousePos,
@@ -92,6 +139,11 @@ public:
     /** === 헬퍼 함수들 === */
     static bool CheckActorPicking(const AActor* Actor, const FRay& Ray, float& OutDistance);
 
+    // 월드 레이 (Direction 정규화)와 메시 삼각형의 가장 가까운 교차. InMaxDistance보다 가까운 교차만 인정
+    static bool CheckComponentPicking(const UStaticMeshComponent* Component, const FRay& Ray, float InMaxDistance, float& OutDistance);
+    // 패킷 버전. InOutDistances[i]보다 가까운 교차가 있으면 갱신하고 갱신된 레인 비트마스크 반환
+    static uint32 CheckComponentPickingPacket(const UStaticMeshComponent* Component, const FRayPacket4& Packet, float InOutDistances[4]);
+
 
     static uint32 GetPickCount() { return TotalPickCount; }
     static uint64 GetLastPickTime() { return LastPickTime; }
@@ -102,6 +154,11 @@ private:
                                            float ViewWidth, float ViewHeight, const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix,
                                            float& OutDistance, FVector& OutImpactPoint);
 
+    // 빌보드(카메라 정면 쿼드)/텍스트 쿼드 중 InOutBestT보다 가까운 것
+    static UPrimitiveComponent* PickSpriteComponents(UWorld* World, const FRay& Ray,
+                                                     const FVector& CameraRight, const FVector& CameraUp,
+                                                     float& InOutBestT);
+
     static uint32 TotalPickCount;
     static uint64 LastPickTime;
     static uint64 TotalPickTime;
@@ -0,0 +1,171 @@
+﻿#include "pch.h"
+#include "Picking.h"
+#include "MeshBVH.h"
+#include "SelfTest.h"
+#include <random>
+
+namespace
+{
+	// 무작위 삼각형 묶음 + 같은 데이터로 만든 메시 BVH (브루트포스 기준과 비교용)
+	struct FPickingTestMesh
+	{
+		TArray<FNormalVertex> Vertices;
+		TArray<uint32> Indices;
+		FMeshBVH BVH;
+
+		void AddTriangle(const FVector& A, const FVector& B, const FVector& C)
+		{
+			for (const FVector& Position : { A, B, C })
+			{
+				FNormalVertex Vertex{};
+				Vertex.pos = Position;
+				Indices.Add(static_cast<uint32>(Vertices.Num()));
+				Vertices.Add(Vertex);
+			}
+		}
+
+		void BuildRandom(std::mt19937& InRng, int32 InTriangleCount)
+		{
+			std::uniform_real_distribution<float> Center(-20.0f, 20.0f);
+			std::uniform_real_distribution<float> Offset(-1.5f, 1.5f);
+			for (int32 Index = 0; Index < InTriangleCount; ++Index)
+			{
+				const FVector C(Center(InRng), Center(InRng), Center(InRng));
+				AddTriangle(C + FVector(Offset(InRng), Offset(InRng), Offset(InRng)),
+					C + FVector(Offset(InRng), Offset(InRng), Offset(InRng)),
+					C + FVector(Offset(InRng), Offset(InRng), Offset(InRng)));
+			}
+			BVH.Build(Vertices, Indices);
+		}
+
+		// 모든 삼각형을 IntersectRayTriangleMT로 검사한 최단 거리
+		bool BruteForce(const FRay& InRay, float& OutT) const
+		{
+			bool bHit = false;
+			OutT = FLT_MAX;
+			for (int32 Index = 0; Index + 2 < Indices.Num(); Index += 3)
+			{
+				float HitT;
+				if (IntersectRayTriangleMT(InRay, Vertices[Indices[Index]].pos, Vertices[Indices[Index + 1]].pos,
+					Vertices[Indices[Index + 2]].pos, HitT) && HitT < OutT)
+				{
+					OutT = HitT;
+					bHit = true;
+				}
+			}
+			return bHit;
+		}
+	};
+
+	// 원점 주변에서 메시 중심 쪽을 향하는 레이 (절반 정도가 삼각형에 맞도록)
+	FRay MakeRandomRay(std::mt19937& InRng)
+	{
+		std::uniform_real_distribution<float> Origin(-40.0f, 40.0f);
+		std::uniform_real_distribution<float> Target(-15.0f, 15.0f);
+		FRay Ray;
+		Ray.Origin = FVector(Origin(InRng), Origin(InRng), Origin(InRng));
+		Ray.Direction = (FVector(Target(InRng), Target(InRng), Target(InRng)) - Ray.Origin).GetNormalized();
+		return Ray;
+	}
+
+	bool NearlyEqualT(float InA, float InB)
+	{
+		return std::fabs(InA - InB) <= 1e-4f * std::max(1.0f, std::fabs(InB));
+	}
+}
+
+IMPLEMENT_SELF_TEST(Picking, MeshBVHClosestMatchesBruteForce)
+{
+	std::mt19937 Rng(1234);
+	FPickingTestMesh Mesh;
+	Mesh.BuildRandom(Rng, 2000);
+
+	int32 Mismatches = 0;
+	int32 Hits = 0;
+	const int32 RayCount = 4000;
+	for (int32 Index = 0; Index < RayCount; ++Index)
+	{
+		const FRay Ray = MakeRandomRay(Rng);
+		float ExpectedT, ActualT;
+		const bool bExpected = Mesh.BruteForce(Ray, ExpectedT);
+		const bool bActual = Mesh.BVH.IntersectRay(Ray, ActualT);
+		if (bExpected != bActual || (bExpected && !NearlyEqualT(ActualT, ExpectedT)))
+		{
+			++Mismatches;
+		}
+		Hits += bExpected ? 1 : 0;
+	}
+
+	Test.AddInfo("%d rays, %d hits, %d mismatches", RayCount, Hits, Mismatches);
+	SELF_TEST_CHECK(Hits > RayCount / 10);
+	SELF_TEST_CHECK(Mismatches == 0);
+}
+
+IMPLEMENT_SELF_TEST(Picking, MeshBVHReturnsClosestOfOverlappingLayers)
+{
+	// 같은 레이 위에 겹친 면 여러 장: 처음 찾은 리프가 아니라 가장 가까운 면이어야 함
+	FPickingTestMesh Mesh;
+	for (int32 Layer = 0; Layer < 16; ++Layer)
+	{
+		const float X = 30.0f - Layer * 2.0f;
+		Mesh.AddTriangle(FVector(X, -5.0f, -5.0f), FVector(X, 5.0f, -5.0f), FVector(X, 0.0f, 5.0f));
+	}
+	Mesh.BVH.Build(Mesh.Vertices, Mesh.Indices);
+
+	FRay Ray;
+	Ray.Origin = FVector(-10.0f, 0.0f, 0.0f);
+	Ray.Direction = FVector(1.0f, 0.0f, 0.0f);
+
+	float HitT = 0.0f;
+	SELF_TEST_CHECK(Mesh.BVH.IntersectRay(Ray, HitT));
+	// 가장 가까운 면은 X = 30 - 15 * 2 = 0
+	SELF_TEST_CHECK(NearlyEqualT(HitT, 10.0f));
+
+	// 최대 거리 안에 면이 없으면 실패
+	SELF_TEST_CHECK(!Mesh.BVH.IntersectRay(Ray, HitT, 0.5f));
+}
+
+IMPLEMENT_SELF_TEST(Picking, RayPacketMatchesSingleRays)
+{
+	std::mt19937 Rng(99);
+	FPickingTestMesh Mesh;
+	Mesh.BuildRandom(Rng, 2000);
+
+	int32 Mismatches = 0;
+	for (int32 PacketIndex = 0; PacketIndex < 1000; ++PacketIndex)
+	{
+		// 마키 선택처럼 이웃한 레이 묶음, 마지막 몇 패킷은 일부 레인만 사용
+		FRay Rays[4];
+		Rays[0] = MakeRandomRay(Rng);
+		for (int32 Lane = 1; Lane < 4; ++Lane)
+		{
+			Rays[Lane] = Rays[0];
+			Rays[Lane].Direction = (Rays[0].Direction + FVector(0.01f * Lane, -0.01f * Lane, 0.005f)).GetNormalized();
+		}
+		const int32 Count = PacketIndex % 8 == 7 ? 1 + PacketIndex % 3 : 4;
+
+		FRayPacket4 Packet;
+		Packet.Set(Rays, Count);
+		float PacketT[4] = { FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX };
+		const uint32 HitMask = Mesh.BVH.IntersectRayPacket(Packet, PacketT);
+
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			const bool bPacketHit = (HitMask >> Lane) & 1u;
+			if (Lane >= Count)
+			{
+				Mismatches += bPacketHit ? 1 : 0;
+				continue;
+			}
+			float SingleT;
+			const bool bSingleHit = Mesh.BVH.IntersectRay(Rays[Lane], SingleT);
+			if (bSingleHit != bPacketHit || (bSingleHit && !NearlyEqualT(PacketT[Lane], SingleT)))
+			{
+				++Mismatches;
+			}
+		}
+	}
+
+	Test.AddInfo("%d lane mismatches", Mismatches);
+	SELF_TEST_CHECK(Mismatches == 0);
+}
@@ -11,6 +11,8 @@
 #include "JsonSerializer.h"
 #include "LightComponentBase.h"
 #include "MeshBatchElement.h"
+#include "SpriteBatch.h"
+#include "SceneView.h"
 
 IMPLEMENT_CLASS(UBillboardComponent)
 
@@ -44,6 +46,24 @@ void UBillboardComponent::SetTextureName(FString TexturePath)
 	Texture = UResourceManager::GetInstance().Load<UTexture>(TexturePath);
 }
 
+void UBillboardComponent::OnRegister(UWorld* InWorld)
+{
+	Super_t::OnRegister(InWorld);
+	if (InWorld)
+	{
+		InWorld->RegisterSpriteComponent(this);
+	}
+}
+
+void UBillboardComponent::OnUnregister()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->UnregisterSpriteComponent(this);
+	}
+	Super_t::OnUnregister();
+}
+
 UMaterialInterface* UBillboardComponent::GetMaterial(uint32 InSectionIndex) const
 {
 	return Material;
@@ -147,4 +167,28 @@ void UBillboardComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshB
 	BatchElement.InstanceColor = Color;
 
 	OutMeshBatchElements.Add(BatchElement);
-}
\ No newline at end of file
+}
+
+void UBillboardComponent::CollectSprites(FSpriteBatcher& OutBatcher, const FSceneView* View)
+{
+	if (!IsVisible() || !View || !Texture || !Texture->GetShaderResourceView())
+	{
+		return;
+	}
+
+	// 뷰 행렬의 열 0/1 = 월드 공간 카메라 Right/Up (Billboard.hlsl의 InverseViewMatrix 행과 같음)
+	const FMatrix& ViewMatrix = View->ViewMatrix;
+	const FVector CameraRight(ViewMatrix.M[0][0], ViewMatrix.M[1][0], ViewMatrix.M[2][0]);
+	const FVector CameraUp(ViewMatrix.M[0][1], ViewMatrix.M[1][1], ViewMatrix.M[2][1]);
+
+	FLinearColor Color{ 1,1,1,1 };
+	if (ULightComponentBase* LightBase = Cast<ULightComponentBase>(this->GetAttachParent()))
+	{
+		Color = LightBase->GetLightColor();
+	}
+
+	// CollectMeshBatches와 같은 크기: 가장 큰 스케일 성분으로 유니폼 스케일
+	const float Scale = GetRelativeScale().GetMaxValue();
+	OutBatcher.AddBillboard(Texture->GetShaderResourceView(), GetWorldLocation(), Scale, CameraRight, CameraUp,
+		PackSpriteColor(Color.R, Color.G, Color.B, Color.A), InternalIndex);
+}
@@ -6,6 +6,7 @@ class UQuad;
 class UTexture;
 class UMaterial;
 class URenderer;
+class FSpriteBatcher;
 
 class UBillboardComponent : public UPrimitiveComponent
 {
@@ -17,6 +18,8 @@ public:
     ~UBillboardComponent() override = default;
 
     void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
+    // 공유 스프라이트 스트림에 카메라를 향하는 쿼드 하나를 추가 (FSceneRenderer는 이 경로로 그림)
+    void CollectSprites(FSpriteBatcher& OutBatcher, const FSceneView* View);
 
     // Setup
     void SetTextureName( FString TexturePath);
@@ -24,6 +27,10 @@ public:
     UQuad* GetStaticMesh() const { return Quad; }
     FString& GetFilePath() { return TexturePath; }
 
+    // 월드의 피킹용 스프라이트 목록에 등록/해제
+    void OnRegister(UWorld* InWorld) override;
+    void OnUnregister() override;
+
     UMaterialInterface* GetMaterial(uint32 InSectionIndex) const override;
     void SetMaterial(uint32 InElementIndex, UMaterialInterface* InNewMaterial) override;
 
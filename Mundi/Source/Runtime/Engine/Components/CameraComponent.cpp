@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "CameraComponent.h"
 #include "FViewport.h"
+#include "LevelArchive.h"
 
 extern float CLIENTWIDTH;
 extern float CLIENTHEIGHT;
@@ -136,6 +137,18 @@ void UCameraComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
     }
 }
 
+void UCameraComponent::SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar)
+{
+    Super::SerializeBinary(bInIsLoading, Ar);
+
+    int32 ModeInt = static_cast<int32>(ProjectionMode);
+    Ar << ModeInt;
+    if (bInIsLoading)
+    {
+        ProjectionMode = static_cast<ECameraProjectionMode>(ModeInt);
+    }
+}
+
 void UCameraComponent::OnSerialized()
 {
     Super::OnSerialized();
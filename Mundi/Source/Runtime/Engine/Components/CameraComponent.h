@@ -53,6 +53,7 @@ public:
     // Serialization
     virtual void OnSerialized() override;
     virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+    virtual void SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar) override;
 
 
 private:
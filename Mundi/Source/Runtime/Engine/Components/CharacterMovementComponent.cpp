@@ -5,6 +5,12 @@
 #include "pch.h"
 #include "CharacterMovementComponent.h"
 #include "Character.h"
+#include "CapsuleComponent.h"
+#include "CapsuleSweep.h"
+#include "AABB.h"
+#include "BVHierarchy.h"
+#include "World.h"
+#include "WorldPartitionManager.h"
 
 IMPLEMENT_CLASS(UCharacterMovementComponent)
 
@@ -12,6 +18,12 @@ BEGIN_PROPERTIES(UCharacterMovementComponent)
 	ADD_PROPERTY(float, MaxWalkSpeed, "Movement", true, "최대 걷기 속도 (cm/s)")
 	ADD_PROPERTY(float, JumpZVelocity, "Movement", true, "점프 초기 속도 (cm/s)")
 	ADD_PROPERTY(float, GravityScale, "Movement", true, "중력 스케일 (1.0 = 기본 중력)")
+	ADD_PROPERTY_RANGE(float, CapsuleRadius, "Collision", 0.0f, 10000.0f, true, "캡슐 반지름 (CapsuleComponent가 없을 때)")
+	ADD_PROPERTY_RANGE(float, CapsuleHalfHeight, "Collision", 0.0f, 10000.0f, true, "캡슐 반 높이, 반지름 제외 (CapsuleComponent가 없을 때)")
+	ADD_PROPERTY_RANGE(float, MaxStepHeight, "Collision", 0.0f, 1000.0f, true, "걸어서 올라설 수 있는 최대 턱 높이")
+	ADD_PROPERTY_RANGE(float, WalkableFloorAngle, "Collision", 0.0f, 90.0f, true, "걸을 수 있는 최대 경사 (도)")
+	ADD_PROPERTY_RANGE(float, SkinWidth, "Collision", 0.0f, 10.0f, true, "표면과 유지하는 간격")
+	ADD_PROPERTY_RANGE(int32, MaxSlideIterations, "Collision", 1, 8, true, "한 번 이동할 때 면을 따라 미끄러지는 최대 횟수")
 END_PROPERTIES()
 
 // ────────────────────────────────────────────────────────────────────────────
@@ -37,6 +49,20 @@ UCharacterMovementComponent::UCharacterMovementComponent()
 	, JumpZVelocity(420.0f)          // 4.2 m/s
 	, MaxAirTime(2.0f)
 	, bCanJump(true)
+	// 충돌 설정
+	, CapsuleRadius(34.0f)
+	, CapsuleHalfHeight(54.0f)
+	, MaxStepHeight(45.0f)
+	, WalkableFloorAngle(44.765f)
+	, SkinWidth(0.5f)
+	, MaxSlideIterations(4)
+	, CapsuleComponent(nullptr)
+	, bFloorCacheValid(false)
+	, CachedFloorLocation(FVector())
+	, CachedFloorBoundsMin(FVector())
+	, CachedFloorBoundsMax(FVector())
+	, LastValidFloorLocation(FVector())
+	, bHasValidFloor(false)
 {
 	bCanEverTick = true;
 }
@@ -55,6 +81,21 @@ void UCharacterMovementComponent::BeginPlay()
 
 	// Owner를 Character로 캐스팅
 	CharacterOwner = Cast<ACharacter>(GetOwner());
+
+	// 충돌 모양은 Owner의 CapsuleComponent를 따름
+	CapsuleComponent = nullptr;
+	if (CharacterOwner)
+	{
+		for (USceneComponent* SceneComponent : CharacterOwner->GetSceneComponents())
+		{
+			if (UCapsuleComponent* Capsule = Cast<UCapsuleComponent>(SceneComponent))
+			{
+				CapsuleComponent = Capsule;
+				break;
+			}
+		}
+	}
+	bFloorCacheValid = false;
 }
 
 void UCharacterMovementComponent::TickComponent(float DeltaTime)
@@ -66,6 +107,12 @@ void UCharacterMovementComponent::TickComponent(float DeltaTime)
 		return;
 	}
 
+	// 0. 입력도 속도도 없고 바닥이 그대로면 스윕하지 않음 (서 있는 캐릭터는 비용 없음)
+	if (IsGrounded() && PendingInputVector.SizeSquared() == 0.0f && Velocity.SizeSquared() == 0.0f && IsFloorCacheValid())
+	{
+		return;
+	}
+
 	// 1. 속도 업데이트 (입력, 마찰, 가속)
 	UpdateVelocity(DeltaTime);
 
@@ -99,14 +146,15 @@ void UCharacterMovementComponent::TickComponent(float DeltaTime)
 	{
 		TimeInAir += DeltaTime;
 
-		// 너무 오래 공중에 있으면 강제로 착지 (안전장치)
-		if (TimeInAir > MaxAirTime)
+		// 너무 오래 공중에 있으면 마지막으로 서 있던 바닥으로 되돌림 (안전장치)
+		if (TimeInAir > MaxAirTime && bHasValidFloor)
 		{
-			FVector Location = CharacterOwner->GetActorLocation();
-			Location.Z = 0.0f; // 지면으로 이동
-			CharacterOwner->SetActorLocation(Location);
+			CharacterOwner->SetActorLocation(LastValidFloorLocation);
+			Velocity = FVector();
 			SetMovementMode(EMovementMode::Walking);
 			TimeInAir = 0.0f;
+			bIsJumping = false;
+			bFloorCacheValid = false;
 		}
 	}
 
@@ -263,13 +311,164 @@ void UCharacterMovementComponent::MoveUpdatedComponent(float DeltaTime)
 		return;
 	}
 
-	// 새 위치 계산
-	FVector CurrentLocation = CharacterOwner->GetActorLocation();
-	FVector Delta = Velocity * DeltaTime;
-	FVector NewLocation = CurrentLocation + Delta;
+	SafeMoveWithSlide(Velocity * DeltaTime);
+}
+
+void UCharacterMovementComponent::SafeMoveWithSlide(const FVector& Delta)
+{
+	const FVector CapsuleOffset = GetCapsuleOffset();
+	FVector Center = CharacterOwner->GetActorLocation() + CapsuleOffset;
+	FVector Remaining = Delta;
+
+	FVector PrevNormal;
+	bool bHasPrevNormal = false;
+
+	for (int32 Iteration = 0; Iteration < MaxSlideIterations; ++Iteration)
+	{
+		if (Remaining.SizeSquared() <= KINDA_SMALL_NUMBER)
+		{
+			break;
+		}
+
+		FCapsuleSweepHit Hit;
+		if (!SweepCapsule(Center, Remaining, Hit))
+		{
+			Center += Remaining;
+			break;
+		}
+
+		if (Hit.bStartPenetrating)
+		{
+			// 겹친 만큼 밀어내고 남은 이동을 다시 시도
+			Center += Hit.Normal * Hit.PenetrationDepth;
+			continue;
+		}
+
+		Center += Remaining * Hit.Time;
+		Remaining = Remaining * (1.0f - Hit.Time);
+
+		FVector Normal = Hit.Normal;
+		const bool bWalkable = IsWalkable(Normal);
+		if (IsGrounded() && !bWalkable)
+		{
+			// 턱이면 올라서고, 아니면 벽으로 보고 수평으로만 막음 (벽을 타고 올라가지 않도록)
+			if (StepUp(Remaining, Hit, Center))
+			{
+				Remaining = FVector();
+				break;
+			}
+			Normal.Z = 0.0f;
+			if (Normal.SizeSquared() <= KINDA_SMALL_NUMBER)
+			{
+				break;
+			}
+			Normal = Normal.GetNormalized();
+		}
+
+		// 벽/천장/낙하 중 충돌이면 속도에서 표면 안쪽 성분 제거 (걷는 중 경사로는 그대로 따라감)
+		if (!IsGrounded() || !bWalkable)
+		{
+			const float IntoSurface = FVector::Dot(Velocity, Normal);
+			if (IntoSurface < 0.0f)
+			{
+				Velocity -= Normal * IntoSurface;
+			}
+		}
+
+		// 남은 이동을 면을 따라 미끄러뜨림
+		FVector Slide = Remaining - Normal * FVector::Dot(Remaining, Normal);
+		if (bHasPrevNormal && FVector::Dot(Slide, PrevNormal) < 0.0f)
+		{
+			// 두 면 사이 틈: 두 면의 교선 방향으로만 이동
+			FVector Crease = FVector::Cross(PrevNormal, Normal);
+			if (Crease.SizeSquared() <= KINDA_SMALL_NUMBER)
+			{
+				break;
+			}
+			Crease = Crease.GetNormalized();
+			Slide = Crease * FVector::Dot(Remaining, Crease);
+		}
+
+		PrevNormal = Normal;
+		bHasPrevNormal = true;
+		Remaining = Slide;
+	}
+
+	CharacterOwner->SetActorLocation(Center - CapsuleOffset);
+}
+
+bool UCharacterMovementComponent::StepUp(const FVector& Delta, const FCapsuleSweepHit& Hit, FVector& InOutCenter)
+{
+	const FVector Horizontal(Delta.X, Delta.Y, 0.0f);
+	if (MaxStepHeight <= 0.0f || Horizontal.SizeSquared() <= KINDA_SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	// 막은 지점이 캡슐 바닥에서 MaxStepHeight보다 높으면 턱이 아니라 벽
+	const FCapsuleShape Capsule = GetCapsuleShape();
+	const float CapsuleBottom = InOutCenter.Z - Capsule.HalfHeight - Capsule.Radius;
+	if (Hit.ImpactPoint.Z - CapsuleBottom > MaxStepHeight)
+	{
+		return false;
+	}
+
+	FVector Center = InOutCenter;
+	FCapsuleSweepHit StepHit;
+
+	// 1. 위로 (천장에 막히면 거기까지)
+	FVector Up(0.0f, 0.0f, MaxStepHeight);
+	if (SweepCapsule(Center, Up, StepHit))
+	{
+		if (StepHit.bStartPenetrating)
+		{
+			return false;
+		}
+		Up = Up * StepHit.Time;
+	}
+	Center += Up;
+
+	// 2. 앞으로 (조금도 못 나가면 실패)
+	if (SweepCapsule(Center, Horizontal, StepHit))
+	{
+		if (StepHit.bStartPenetrating || StepHit.Time <= KINDA_SMALL_NUMBER)
+		{
+			return false;
+		}
+		Center += Horizontal * StepHit.Time;
+	}
+	else
+	{
+		Center += Horizontal;
+	}
+
+	// 3. 아래로 올라간 만큼 내려서 걸을 수 있는 바닥에 닿아야 성공
+	FFindFloorResult StepFloor;
+	FindFloor(Center, Up.Z + SkinWidth * 2.0f, StepFloor);
+	if (!StepFloor.bWalkableFloor)
+	{
+		return false;
+	}
+	Center.Z -= StepFloor.FloorDist;
+
+	InOutCenter = Center;
+	return true;
+}
+
+void UCharacterMovementComponent::FindFloor(const FVector& Center, float SweepDistance, FFindFloorResult& OutFloor) const
+{
+	OutFloor = FFindFloorResult();
+
+	FCapsuleSweepHit Hit;
+	if (!SweepCapsule(Center, FVector(0.0f, 0.0f, -SweepDistance), Hit))
+	{
+		return;
+	}
 
-	// 위치 업데이트
-	CharacterOwner->SetActorLocation(NewLocation);
+	OutFloor.bBlockingHit = true;
+	OutFloor.bWalkableFloor = Collision::IsWalkableFloorHit(Center, Hit, GetCapsuleShape(), SkinWidth, GetWalkableFloorZ(), OutFloor.Normal);
+	OutFloor.FloorDist = Hit.bStartPenetrating ? 0.0f : SweepDistance * Hit.Time;
+	OutFloor.Component = Hit.Component;
 }
 
 bool UCharacterMovementComponent::CheckGround()
@@ -279,24 +478,125 @@ bool UCharacterMovementComponent::CheckGround()
 		return false;
 	}
 
-	FVector Location = CharacterOwner->GetActorLocation();
+	bFloorCacheValid = false;
+
+	// 올라가는 중이면 바닥에 붙지 않음
+	if (Velocity.Z > 0.0f)
+	{
+		CurrentFloor = FFindFloorResult();
+		return false;
+	}
+
+	// 걷는 중이면 내리막/계단을 따라 내려가도록 턱 높이만큼, 낙하 중이면 스킨 근처만 검사
+	const FVector CapsuleOffset = GetCapsuleOffset();
+	FVector Center = CharacterOwner->GetActorLocation() + CapsuleOffset;
+	const float SweepDistance = (IsGrounded() ? MaxStepHeight : 0.0f) + SkinWidth * 2.0f;
+	FindFloor(Center, SweepDistance, CurrentFloor);
+
+	if (!CurrentFloor.bWalkableFloor)
+	{
+		return false;
+	}
+
+	// 스킨 두께만 남기고 바닥에 붙임
+	if (CurrentFloor.FloorDist > 0.0f)
+	{
+		Center.Z -= CurrentFloor.FloorDist;
+		CharacterOwner->SetActorLocation(Center - CapsuleOffset);
+	}
+
+	const FVector Location = CharacterOwner->GetActorLocation();
+	LastValidFloorLocation = Location;
+	bHasValidFloor = true;
+
+	// 바닥 캐시
+	if (FBVHierarchy* BVH = GetWorldBVH())
+	{
+		if (const FAABB* FloorBounds = BVH->FindComponentBounds(CurrentFloor.Component))
+		{
+			CachedFloorLocation = Location;
+			CachedFloorBoundsMin = FloorBounds->Min;
+			CachedFloorBoundsMax = FloorBounds->Max;
+			bFloorCacheValid = true;
+		}
+	}
+
+	return true;
+}
+
+bool UCharacterMovementComponent::IsFloorCacheValid() const
+{
+	if (!bFloorCacheValid || !CurrentFloor.Component || !CharacterOwner)
+	{
+		return false;
+	}
+
+	// 외부에서 옮겼으면 (텔레포트 등) 다시 찾음
+	const FVector Location = CharacterOwner->GetActorLocation();
+	if (Location.X != CachedFloorLocation.X || Location.Y != CachedFloorLocation.Y || Location.Z != CachedFloorLocation.Z)
+	{
+		return false;
+	}
+
+	// 바닥이 지워졌거나 움직였으면 다시 찾음 (BVH는 포인터 값으로만 찾으므로 지워진 컴포넌트여도 안전)
+	FBVHierarchy* BVH = GetWorldBVH();
+	const FAABB* FloorBounds = BVH ? BVH->FindComponentBounds(CurrentFloor.Component) : nullptr;
+	if (!FloorBounds)
+	{
+		return false;
+	}
+	const FVector& Min = FloorBounds->Min;
+	const FVector& Max = FloorBounds->Max;
+	return Min.X == CachedFloorBoundsMin.X && Min.Y == CachedFloorBoundsMin.Y && Min.Z == CachedFloorBoundsMin.Z &&
+		Max.X == CachedFloorBoundsMax.X && Max.Y == CachedFloorBoundsMax.Y && Max.Z == CachedFloorBoundsMax.Z;
+}
+
+bool UCharacterMovementComponent::IsWalkable(const FVector& Normal) const
+{
+	return Collision::IsWalkableNormal(Normal, GetWalkableFloorZ());
+}
+
+float UCharacterMovementComponent::GetWalkableFloorZ() const
+{
+	return std::cos(DegreesToRadians(FMath::Clamp(WalkableFloorAngle, 0.0f, 90.0f)));
+}
 
-	// 간단한 지면 체크: Y = 0을 지면으로 가정
-	// 나중에 충돌 시스템과 연결하여 제대로 구현
-	constexpr float GroundLevel = 0.0f;
-	constexpr float GroundTolerance = 1.0f; // 1cm 오차 허용
+// ────────────────────────────────────────────────────────────────────────────
+// 캡슐
+// ────────────────────────────────────────────────────────────────────────────
 
-	// 지면 근처에 있고, 아래로 떨어지지 않고 있으면 지면에 있음
-	bool bNearGround = Location.Z <= (GroundLevel + GroundTolerance);
-	bool bNotRising = Velocity.Z <= 0.0f;
+FCapsuleShape UCharacterMovementComponent::GetCapsuleShape() const
+{
+	if (CapsuleComponent)
+	{
+		return FCapsuleShape(CapsuleComponent->GetScaledCapsuleRadius(), CapsuleComponent->GetScaledCapsuleHalfHeight());
+	}
+	return FCapsuleShape(CapsuleRadius, CapsuleHalfHeight);
+}
 
-	if (bNearGround && bNotRising)
+FVector UCharacterMovementComponent::GetCapsuleOffset() const
+{
+	if (CapsuleComponent && CharacterOwner)
 	{
-		// 지면에 정확히 맞춤
-		Location.Z = GroundLevel;
-		CharacterOwner->SetActorLocation(Location);
-		return true;
+		return CapsuleComponent->GetWorldLocation() - CharacterOwner->GetActorLocation();
 	}
+	return FVector(0.0f, 0.0f, CapsuleRadius + CapsuleHalfHeight);
+}
+
+FBVHierarchy* UCharacterMovementComponent::GetWorldBVH() const
+{
+	UWorld* World = GetWorld();
+	UWorldPartitionManager* Partition = World ? World->GetPartitionManager() : nullptr;
+	return Partition ? Partition->GetBVH() : nullptr;
+}
 
-	return false;
+bool UCharacterMovementComponent::SweepCapsule(const FVector& Center, const FVector& Delta, FCapsuleSweepHit& OutHit) const
+{
+	const FBVHierarchy* BVH = GetWorldBVH();
+	if (!BVH)
+	{
+		OutHit = FCapsuleSweepHit();
+		return false;
+	}
+	return Collision::SweepCapsuleWorld(*BVH, Center, Delta, GetCapsuleShape(), SkinWidth, CharacterOwner, OutHit);
 }
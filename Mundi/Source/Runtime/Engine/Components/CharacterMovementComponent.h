@@ -9,6 +9,11 @@
 
 // 전방 선언
 class ACharacter;
+class UCapsuleComponent;
+class UStaticMeshComponent;
+class FBVHierarchy;
+struct FCapsuleShape;
+struct FCapsuleSweepHit;
 
 /**
  * EMovementMode
@@ -30,17 +35,42 @@ enum class EMovementMode : uint8
 	None
 };
 
+/**
+ * FFindFloorResult
+ *
+ * 캡슐 아래 바닥 검사 결과입니다.
+ */
+struct FFindFloorResult
+{
+	/** 아래로 스윕해서 무언가에 닿았는지 */
+	bool bBlockingHit = false;
+
+	/** 닿은 면이 걸을 수 있는 경사인지 */
+	bool bWalkableFloor = false;
+
+	/** 바닥까지 내려갈 수 있는 거리 (스킨 두께 제외) */
+	float FloorDist = 0.0f;
+
+	/** 바닥 법선 */
+	FVector Normal;
+
+	/** 바닥 컴포넌트 */
+	const UStaticMeshComponent* Component = nullptr;
+};
+
 /**
  * UCharacterMovementComponent
  *
  * Character의 이동, 중력, 점프 등을 처리하는 컴포넌트입니다.
- * 기본 물리 시뮬레이션을 수행하며, 나중에 충돌 시스템과 연결됩니다.
+ * 캡슐을 월드 BVH의 스태틱 메시에 스윕해서 움직이며, 바닥은 아래로 스윕해서 찾습니다.
  *
  * 주요 기능:
  * - 중력 적용
  * - 속도/가속도 기반 이동
  * - 점프 (타이머 기반)
  * - 이동 모드 관리 (Walking, Falling, Flying)
+ * - 충돌 면을 따라 미끄러지기, 턱 오르기, 걸을 수 있는 경사 제한
+ * - 바닥 캐시 (제자리에 서 있으면 스윕하지 않음)
  */
 class UCharacterMovementComponent : public UActorComponent
 {
@@ -94,6 +124,28 @@ public:
 	/** 점프 가능 여부 */
 	bool bCanJump;
 
+	// ────────────────────────────────────────────────
+	// 충돌 설정
+	// ────────────────────────────────────────────────
+
+	/** 캡슐 반지름 (Owner에 CapsuleComponent가 없을 때 사용) */
+	float CapsuleRadius;
+
+	/** 캡슐 반 높이 (반지름 제외, Owner에 CapsuleComponent가 없을 때 사용) */
+	float CapsuleHalfHeight;
+
+	/** 걸어서 올라설 수 있는 최대 턱 높이 */
+	float MaxStepHeight;
+
+	/** 걸을 수 있는 최대 경사 (도) */
+	float WalkableFloorAngle;
+
+	/** 표면과 유지하는 간격 */
+	float SkinWidth;
+
+	/** 한 번 이동할 때 면을 따라 미끄러지는 최대 횟수 */
+	int32 MaxSlideIterations;
+
 	// ────────────────────────────────────────────────
 	// 이동 함수
 	// ────────────────────────────────────────────────
@@ -156,6 +208,32 @@ public:
 	 */
 	bool IsFalling() const { return MovementMode == EMovementMode::Falling; }
 
+	// ────────────────────────────────────────────────
+	// 바닥
+	// ────────────────────────────────────────────────
+
+	/**
+	 * 법선이 걸을 수 있는 경사인지 확인합니다.
+	 *
+	 * @param Normal - 표면 법선 (표면 -> 캐릭터)
+	 */
+	bool IsWalkable(const FVector& Normal) const;
+
+	/** WalkableFloorAngle의 코사인 (걸을 수 있는 법선 Z의 최솟값) */
+	float GetWalkableFloorZ() const;
+
+	/**
+	 * 마지막으로 찾은 바닥을 반환합니다.
+	 */
+	const FFindFloorResult& GetCurrentFloor() const { return CurrentFloor; }
+
+	/**
+	 * 바닥 캐시를 버립니다 (다음 Tick에서 바닥을 다시 찾음).
+	 * 캐시는 캐릭터 위치와 바닥 컴포넌트의 바운드가 그대로인 동안만 유지되므로
+	 * 그 밖의 변화(바닥 아래로 들어온 물체 등)를 반영하고 싶을 때 호출합니다.
+	 */
+	void InvalidateFloorCache() { bFloorCacheValid = false; }
+
 protected:
 	// ────────────────────────────────────────────────
 	// 생명주기
@@ -190,13 +268,61 @@ protected:
 	void MoveUpdatedComponent(float DeltaTime);
 
 	/**
-	 * 지면 체크 (나중에 충돌 시스템과 연결)
-	 * 현재는 Y = 0을 지면으로 가정합니다.
+	 * 캡슐을 스윕하며 이동하고, 막히면 남은 이동을 면을 따라 미끄러뜨립니다.
+	 * 걷는 중에 걸을 수 없는 면에 막히면 턱 오르기를 먼저 시도합니다.
+	 *
+	 * @param Delta - 이번 프레임 이동량
+	 */
+	void SafeMoveWithSlide(const FVector& Delta);
+
+	/**
+	 * 위 -> 앞 -> 아래 순서로 스윕해서 턱 위로 올라섭니다.
+	 *
+	 * @param Delta - 남은 이동량
+	 * @param Hit - 앞을 막은 충돌
+	 * @param InOutCenter - 캡슐 중심 (성공하면 올라선 위치로 바뀜)
+	 * @return 올라서면 true
+	 */
+	bool StepUp(const FVector& Delta, const FCapsuleSweepHit& Hit, FVector& InOutCenter);
+
+	/**
+	 * 캡슐을 아래로 스윕해서 바닥을 찾습니다.
+	 *
+	 * @param Center - 캡슐 중심
+	 * @param SweepDistance - 아래로 검사할 거리
+	 * @param OutFloor - 결과
+	 */
+	void FindFloor(const FVector& Center, float SweepDistance, FFindFloorResult& OutFloor) const;
+
+	/**
+	 * 지면 체크
+	 * 걷는 중이면 MaxStepHeight까지 내려 보고, 걸을 수 있는 바닥이면 스킨 두께만 남기고 붙입니다.
 	 *
 	 * @return 지면에 있으면 true
 	 */
 	bool CheckGround();
 
+	/**
+	 * 캐릭터와 바닥이 바닥을 찾았을 때 그대로인지 확인합니다.
+	 */
+	bool IsFloorCacheValid() const;
+
+	// ────────────────────────────────────────────────
+	// 캡슐
+	// ────────────────────────────────────────────────
+
+	/** 월드 스케일이 적용된 캡슐 */
+	FCapsuleShape GetCapsuleShape() const;
+
+	/** 액터 위치 -> 캡슐 중심 오프셋 (CapsuleComponent가 없으면 액터 위치가 캡슐 바닥) */
+	FVector GetCapsuleOffset() const;
+
+	/** 월드 BVH (없으면 nullptr) */
+	FBVHierarchy* GetWorldBVH() const;
+
+	/** Owner를 제외한 월드 스태틱 메시에 캡슐을 스윕 */
+	bool SweepCapsule(const FVector& Center, const FVector& Delta, FCapsuleSweepHit& OutHit) const;
+
 	// ────────────────────────────────────────────────
 	// 멤버 변수
 	// ────────────────────────────────────────────────
@@ -218,4 +344,20 @@ protected:
 
 	/** 점프 중인지 여부 */
 	bool bIsJumping;
+
+	/** Owner의 CapsuleComponent (없으면 CapsuleRadius/CapsuleHalfHeight 사용) */
+	UCapsuleComponent* CapsuleComponent;
+
+	/** 마지막 바닥 검사 결과 */
+	FFindFloorResult CurrentFloor;
+
+	/** 바닥 캐시 (바닥을 찾은 시점의 캐릭터 위치와 바닥 컴포넌트 바운드) */
+	bool bFloorCacheValid;
+	FVector CachedFloorLocation;
+	FVector CachedFloorBoundsMin;
+	FVector CachedFloorBoundsMax;
+
+	/** 마지막으로 걸을 수 있는 바닥에 서 있던 위치 (공중 시간 안전장치용) */
+	FVector LastValidFloorLocation;
+	bool bHasValidFloor;
 };
@@ -66,7 +66,7 @@ void UShapeComponent::DuplicateSubObjects()
  */
 bool UShapeComponent::IsOverlappingComponent(const UShapeComponent* Other) const
 {
-	if (!Other || !bGenerateOverlapEvents || !Other->bGenerateOverlapEvents)
+	if (!Other || !ShouldGenerateOverlapEvents() || !Other->ShouldGenerateOverlapEvents())
 	{
 		return false;
 	}
@@ -86,7 +86,7 @@ bool UShapeComponent::IsOverlappingComponent(const UShapeComponent* Other) const
  */
 void UShapeComponent::UpdateOverlaps(const TArray<UShapeComponent*>& OtherComponents)
 {
-	if (!bGenerateOverlapEvents)
+	if (!ShouldGenerateOverlapEvents())
 	{
 		return;
 	}
@@ -222,6 +222,55 @@ bool UShapeComponent::RemoveOverlapInfo(const UShapeComponent* OtherComponent)
 	return false;
 }
 
+bool UShapeComponent::ShouldGenerateOverlapEvents() const
+{
+	if (!bGenerateOverlapEvents)
+	{
+		return false;
+	}
+
+	const AActor* Owner = GetOwner();
+	return !Owner || Owner->GetActorEnableCollision();
+}
+
+/**
+ * 액터 충돌이 꺼지면 CollisionManager에서 빼고 남은 Overlap을 정리합니다.
+ * 다시 켜지면 재등록되어 다음 UpdateCollisions에서 BeginOverlap이 새로 발생합니다.
+ */
+void UShapeComponent::UpdateCollisionRegistration()
+{
+	// BeginPlay 전이면 BeginPlay에서 ShouldGenerateOverlapEvents() 기준으로 등록됨
+	if (!HasBegunPlay())
+	{
+		return;
+	}
+
+	AActor* Owner = GetOwner();
+	UWorld* World = Owner ? Owner->GetWorld() : nullptr;
+	UCollisionManager* Manager = World ? World->GetCollisionManager() : nullptr;
+	if (!Manager)
+	{
+		return;
+	}
+
+	if (ShouldGenerateOverlapEvents())
+	{
+		Manager->RegisterComponent(this);
+		return;
+	}
+
+	Manager->UnregisterComponent(this);
+
+	// 상대 컴포넌트 쪽 정보는 다음 UpdateOverlaps에서 이 컴포넌트가 빠지면서 EndOverlap으로 정리됨
+	TArray<FOverlapInfo> EndedOverlaps;
+	EndedOverlaps.swap(OverlapInfos);
+	bIsOverlapping = false;
+	for (const FOverlapInfo& Info : EndedOverlaps)
+	{
+		OnComponentEndOverlap.Broadcast(this, Info.OtherActor, Info.OtherComponent, Info.ContactPoint, Info.PenetrationDepth);
+	}
+}
+
 // ────────────────────────────────────────────────────────────────────────────
 // 디버그 렌더링
 // ────────────────────────────────────────────────────────────────────────────
@@ -248,7 +297,9 @@ void UShapeComponent::RenderDebugVolume(URenderer* Renderer) const
  */
 void UShapeComponent::BeginPlay()
 {
-	// World의 CollisionManager에 등록
+	Super::BeginPlay();
+
+	// World의 CollisionManager에 등록 (액터 충돌이 꺼져 있으면 RegisterComponent에서 걸러짐)
 	if (AActor* Owner = GetOwner())
 	{
 		if (UWorld* World = Owner->GetWorld())
@@ -167,6 +167,18 @@ public:
 	 * @return 제거 성공 여부
 	 */
 	bool RemoveOverlapInfo(const UShapeComponent* OtherComponent);
+
+	/**
+	 * 실제로 Overlap 이벤트를 만들어야 하는지 확인합니다.
+	 * bGenerateOverlapEvents가 켜져 있고 소유 액터의 충돌이 활성화된 경우에만 true입니다.
+	 */
+	bool ShouldGenerateOverlapEvents() const;
+
+	/**
+	 * ShouldGenerateOverlapEvents() 결과에 맞춰 CollisionManager 등록 상태를 갱신합니다.
+	 * 해제될 때는 남아 있던 Overlap에 대해 EndOverlap 이벤트를 발생시킵니다.
+	 */
+	void UpdateCollisionRegistration();
 	
 	
 	DECLARE_DUPLICATE(UShapeComponent)
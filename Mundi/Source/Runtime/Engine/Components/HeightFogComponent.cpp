@@ -4,6 +4,7 @@
 #include "Color.h"
 #include "ResourceManager.h"
 #include "BillboardComponent.h"
+#include "LevelArchive.h"
 
 IMPLEMENT_CLASS(UHeightFogComponent)
 
@@ -103,6 +104,20 @@ void UHeightFogComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 
 	}
 }
+
+void UHeightFogComponent::SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar)
+{
+	// 안개 파라미터는 리플렉션 프로퍼티로 처리되므로 셰이더 경로만 추가로 저장
+	Super::SerializeBinary(bInIsLoading, Ar);
+
+	FString ShaderPath = (!bInIsLoading && HeightFogShader) ? HeightFogShader->GetFilePath() : FString();
+	Ar.SerializeString(ShaderPath);
+
+	if (bInIsLoading && !ShaderPath.empty())
+	{
+		HeightFogShader = UResourceManager::GetInstance().Load<UShader>(ShaderPath.c_str());
+	}
+}
 void UHeightFogComponent::OnSerialized()
 {
 	Super::OnSerialized();
@@ -27,12 +27,12 @@ UInputComponent::~UInputComponent()
 // ────────────────────────────────────────────────────────────────────────────
 
 void UInputComponent::BindAction(const FString& ActionName, int32 KeyCode,
-	std::function<void()> PressedCallback,
-	std::function<void()> ReleasedCallback)
+	TDelegate<> PressedCallback,
+	TDelegate<> ReleasedCallback)
 {
 	FInputActionBinding Binding(ActionName, KeyCode);
-	Binding.PressedCallback = PressedCallback;
-	Binding.ReleasedCallback = ReleasedCallback;
+	Binding.PressedCallback = std::move(PressedCallback);
+	Binding.ReleasedCallback = std::move(ReleasedCallback);
 
 	ActionBindings.Add(Binding);
 }
@@ -41,10 +41,10 @@ void UInputComponent::BindAction(const FString& ActionName, int32 KeyCode,
 // 축 바인딩
 // ────────────────────────────────────────────────────────────────────────────
 
-void UInputComponent::BindAxis(const FString& AxisName, int32 KeyCode, float Scale, std::function<void(float)> Callback)
+void UInputComponent::BindAxis(const FString& AxisName, int32 KeyCode, float Scale, TDelegate<float> Callback)
 {
 	FInputAxisBinding Binding(AxisName, KeyCode, Scale);
-	Binding.Callback = Callback;
+	Binding.Callback = std::move(Callback);
 
 	AxisBindings.Add(Binding);
 }
@@ -63,19 +63,13 @@ void UInputComponent::ProcessInput()
 		// 키가 눌렸을 때
 		if (InputManager.IsKeyPressed(Binding.KeyCode))
 		{
-			if (Binding.PressedCallback)
-			{
-				Binding.PressedCallback();
-			}
+			Binding.PressedCallback.Execute();
 		}
 
 		// 키가 떼어졌을 때
 		if (InputManager.IsKeyReleased(Binding.KeyCode))
 		{
-			if (Binding.ReleasedCallback)
-			{
-				Binding.ReleasedCallback();
-			}
+			Binding.ReleasedCallback.Execute();
 		}
 	}
 
@@ -85,10 +79,7 @@ void UInputComponent::ProcessInput()
 		// 키가 눌려있으면 스케일 값 전달
 		if (InputManager.IsKeyDown(Binding.KeyCode))
 		{
-			if (Binding.Callback)
-			{
-				Binding.Callback(Binding.Scale);
-			}
+			Binding.Callback.Execute(Binding.Scale);
 		}
 	}
 }
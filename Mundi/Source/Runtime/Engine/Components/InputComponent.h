@@ -6,7 +6,6 @@
 
 #include "ActorComponent.h"
 #include "Delegate.h"
-#include <functional>
 
 /**
  * FInputActionBinding
@@ -23,24 +22,20 @@ struct FInputActionBinding
 	int32 KeyCode;
 
 	/** 눌렸을 때 호출될 콜백 */
-	std::function<void()> PressedCallback;
+	TDelegate<> PressedCallback;
 
 	/** 떼었을 때 호출될 콜백 */
-	std::function<void()> ReleasedCallback;
+	TDelegate<> ReleasedCallback;
 
 	FInputActionBinding()
 		: ActionName("")
 		, KeyCode(0)
-		, PressedCallback(nullptr)
-		, ReleasedCallback(nullptr)
 	{
 	}
 
 	FInputActionBinding(const FString& InActionName, int32 InKeyCode)
 		: ActionName(InActionName)
 		, KeyCode(InKeyCode)
-		, PressedCallback(nullptr)
-		, ReleasedCallback(nullptr)
 	{
 	}
 };
@@ -63,13 +58,12 @@ struct FInputAxisBinding
 	float Scale;
 
 	/** 매 프레임 호출될 콜백 (float는 축 값) */
-	std::function<void(float)> Callback;
+	TDelegate<float> Callback;
 
 	FInputAxisBinding()
 		: AxisName("")
 		, KeyCode(0)
 		, Scale(1.0f)
-		, Callback(nullptr)
 	{
 	}
 
@@ -77,7 +71,6 @@ struct FInputAxisBinding
 		: AxisName(InAxisName)
 		, KeyCode(InKeyCode)
 		, Scale(InScale)
-		, Callback(nullptr)
 	{
 	}
 };
@@ -114,11 +107,12 @@ public:
 	 * @param ReleasedCallback - 떼었을 때 호출될 함수 (옵션)
 	 */
 	void BindAction(const FString& ActionName, int32 KeyCode,
-		std::function<void()> PressedCallback,
-		std::function<void()> ReleasedCallback = nullptr);
+		TDelegate<> PressedCallback,
+		TDelegate<> ReleasedCallback = nullptr);
 
 	/**
 	 * 템플릿 버전: 멤버 함수를 바인딩합니다.
+	 * UObject면 약한 바인딩이므로 객체가 삭제된 뒤에는 호출되지 않습니다.
 	 *
 	 * @param ActionName - 액션 이름
 	 * @param KeyCode - 바인딩할 키 코드
@@ -132,9 +126,17 @@ public:
 		void (UserClass::*PressedFunc)(),
 		void (UserClass::*ReleasedFunc)() = nullptr)
 	{
-		auto PressedCallback = PressedFunc ? std::bind(PressedFunc, Object) : std::function<void()>();
-		auto ReleasedCallback = ReleasedFunc ? std::bind(ReleasedFunc, Object) : std::function<void()>();
-		BindAction(ActionName, KeyCode, PressedCallback, ReleasedCallback);
+		TDelegate<> PressedCallback;
+		TDelegate<> ReleasedCallback;
+		if (PressedFunc)
+		{
+			PressedCallback.BindDynamic(Object, PressedFunc);
+		}
+		if (ReleasedFunc)
+		{
+			ReleasedCallback.BindDynamic(Object, ReleasedFunc);
+		}
+		BindAction(ActionName, KeyCode, std::move(PressedCallback), std::move(ReleasedCallback));
 	}
 
 	// ────────────────────────────────────────────────
@@ -149,7 +151,7 @@ public:
 	 * @param Scale - 입력 스케일 (보통 1.0 또는 -1.0)
 	 * @param Callback - 매 프레임 호출될 함수
 	 */
-	void BindAxis(const FString& AxisName, int32 KeyCode, float Scale, std::function<void(float)> Callback);
+	void BindAxis(const FString& AxisName, int32 KeyCode, float Scale, TDelegate<float> Callback);
 
 	/**
 	 * 템플릿 버전: 멤버 함수를 바인딩합니다.
@@ -165,8 +167,9 @@ public:
 		UserClass* Object,
 		void (UserClass::*Func)(float))
 	{
-		auto Callback = std::bind(Func, Object, std::placeholders::_1);
-		BindAxis(AxisName, KeyCode, Scale, Callback);
+		TDelegate<float> Callback;
+		Callback.BindDynamic(Object, Func);
+		BindAxis(AxisName, KeyCode, Scale, std::move(Callback));
 	}
 
 	// ────────────────────────────────────────────────
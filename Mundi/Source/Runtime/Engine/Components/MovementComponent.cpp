@@ -54,11 +54,13 @@ void UMovementComponent::TickComponent(float DeltaSeconds)
 void UMovementComponent::SetVelocity(const FVector& NewVelocity)
 {
     Velocity = NewVelocity;
+    PrimaryComponentTick.WakeUp();
 }
 
 void UMovementComponent::SetAcceleration(const FVector& NewAcceleration)
 {
     Acceleration = NewAcceleration;
+    PrimaryComponentTick.WakeUp();
 }
 
 void UMovementComponent::StopMovement()
@@ -2,6 +2,7 @@
 #include "OBB.h"
 #include "PerspectiveDecalComponent.h"
 #include "JsonSerializer.h"
+#include "LevelArchive.h"
 
 IMPLEMENT_CLASS(UPerspectiveDecalComponent)
 
@@ -178,6 +179,18 @@ void UPerspectiveDecalComponent::Serialize(const bool bInIsLoading, JSON& InOutH
 	}
 }
 
+void UPerspectiveDecalComponent::SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar)
+{
+	Super::SerializeBinary(bInIsLoading, Ar);
+
+	float FovYTemp = GetFovY();
+	Ar << FovYTemp;
+	if (bInIsLoading)
+	{
+		SetFovY(FovYTemp);
+	}
+}
+
 void UPerspectiveDecalComponent::OnSerialized()
 {
 	Super::OnSerialized();
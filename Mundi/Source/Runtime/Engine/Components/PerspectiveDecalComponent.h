@@ -33,6 +33,7 @@ public:
 	// Serialize
 	void OnSerialized() override;
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar) override;
 
 private:
 	float FovY = 60;
@@ -9,6 +9,17 @@ void UPrimitiveComponent::SetMaterialByName(uint32 InElementIndex, const FString
     SetMaterial(InElementIndex, UResourceManager::GetInstance().Load<UMaterial>(InMaterialName));
 }
 
+const FMatrix& UPrimitiveComponent::GetNormalMatrix(const FMatrix& InWorldMatrix) const
+{
+    if (!bNormalMatrixCached || std::memcmp(&NormalMatrixSourceWorld, &InWorldMatrix, sizeof(FMatrix)) != 0)
+    {
+        NormalMatrixSourceWorld = InWorldMatrix;
+        CachedNormalMatrix = InWorldMatrix.InverseAffine().Transpose();
+        bNormalMatrixCached = true;
+    }
+    return CachedNormalMatrix;
+}
+
 void UPrimitiveComponent::DuplicateSubObjects()
 {
     Super::DuplicateSubObjects();
@@ -44,6 +44,9 @@ public:
         return bIsCulled;
     }
 
+    // InWorldMatrix의 역전치 (ModelBuffer의 법선 행렬). 월드 행렬이 지난번과 같으면 캐시를 그대로 반환합니다.
+    const FMatrix& GetNormalMatrix(const FMatrix& InWorldMatrix) const;
+
     // ───── 복사 관련 ────────────────────────────
     void DuplicateSubObjects() override;
     DECLARE_DUPLICATE(UPrimitiveComponent)
@@ -53,4 +56,9 @@ public:
 
 protected:
     bool bIsCulled = false;
+
+    // 법선 행렬 캐시 (변환 경로마다 무효화하지 않도록 월드 행렬 자체를 키로 비교)
+    mutable FMatrix NormalMatrixSourceWorld;
+    mutable FMatrix CachedNormalMatrix;
+    mutable bool bNormalMatrixCached = false;
 };
\ No newline at end of file
@@ -3,6 +3,18 @@
 #include "SceneComponent.h"
 #include "Actor.h"
 #include "ObjectFactory.h"
+#include "World.h"
+#include "WorldPartitionManager.h"
+#include "ProjectileManager.h"
+#include "CapsuleSweep.h"
+#include "BVHierarchy.h"
+#include "StaticMeshComponent.h"
+
+namespace
+{
+    // 스윕 접촉 여유. 멈춘 발사체는 표면에서 이만큼 떨어져 있어 다음 스윕이 시작부터 겹치지 않음
+    constexpr float ProjectileSkinWidth = 0.01f;
+}
 
 IMPLEMENT_CLASS(UProjectileMovementComponent)
 
@@ -16,6 +28,16 @@ BEGIN_PROPERTIES(UProjectileMovementComponent)
     ADD_PROPERTY(bool, bAutoDestroyWhenLifespanExceeded, "발사체", true, "생명 시간 초과시 발사체를 파괴합니다")
     ADD_PROPERTY(float, ProjectileLifespan, "발사체", true, "발사체 생명 시간입니다")
     ADD_PROPERTY(float, CurrentLifetime, "발사체", false, "현재 생존 시간입니다 (읽기 전용)")
+    ADD_PROPERTY(bool, bUseBatchedUpdate, "발사체", true, "PIE에서 월드 발사체 매니저가 모든 발사체를 한 번에 갱신합니다")
+    // 충돌 속성
+    ADD_PROPERTY(bool, bSweepCollision, "충돌", true, "이동 경로를 스윕해 스태틱 메시에 막히는지 검사합니다")
+    ADD_PROPERTY(float, CollisionRadius, "충돌", true, "스윕 구의 반지름입니다 (0이면 선분)")
+    ADD_PROPERTY(bool, bShouldBounce, "충돌", true, "막히면 튕깁니다 (끄면 그 자리에서 멈춤)")
+    ADD_PROPERTY(float, Bounciness, "충돌", true, "튕길 때 법선 방향 속도 보존 비율입니다")
+    ADD_PROPERTY(float, Friction, "충돌", true, "튕길 때 접선 방향 속도 감소 비율입니다")
+    ADD_PROPERTY(float, BounceVelocityStopSimulatingThreshold, "충돌", true, "튕긴 뒤 속도가 이보다 작으면 멈춥니다")
+    ADD_PROPERTY(int32, MaxSimulationIterations, "충돌", true, "한 프레임에 튕김을 다시 스윕하는 최대 횟수입니다")
+    ADD_PROPERTY(bool, bDestroyOnStop, "충돌", true, "멈추면 발사체를 파괴합니다 (풀 액터는 풀로 반납)")
     // 호밍 속성
     ADD_PROPERTY(bool, bIsHomingProjectile, "호밍", true, "호밍 기능을 활성화합니다")
     ADD_PROPERTY(float, HomingAccelerationMagnitude, "호밍", true, "호밍 가속도 크기입니다")
@@ -33,6 +55,15 @@ UProjectileMovementComponent::UProjectileMovementComponent()
     , HomingTargetComponent(nullptr)
     , HomingAccelerationMagnitude(0.0f)
     , bIsHomingProjectile(false)
+    , bSweepCollision(true)
+    , CollisionRadius(0.0f)  // 0 = 선분
+    , bShouldBounce(false)
+    , Bounciness(0.6f)
+    , Friction(0.2f)
+    , BounceVelocityStopSimulatingThreshold(0.05f)
+    , MaxSimulationIterations(4)
+    , bDestroyOnStop(false)
+    , bUseBatchedUpdate(true)
     , bRotationFollowsVelocity(true)
     , ProjectileLifespan(0.0f)  // 0 = 무제한
     , CurrentLifetime(0.0f)
@@ -40,20 +71,64 @@ UProjectileMovementComponent::UProjectileMovementComponent()
     , bIsActive(true)
 {
     bCanEverTick = true;
+
+    // 호밍 타겟 위치는 읽기만 하고 자기 상태만 갱신하므로 병렬 계산 가능 (위치 반영은 ApplyParallelTick)
+    PrimaryComponentTick.bRunOnAnyThread = true;
 }
 
 UProjectileMovementComponent::~UProjectileMovementComponent()
 {
 }
 
+void UProjectileMovementComponent::BeginPlay()
+{
+    Super_t::BeginPlay();
+
+    // 배치 갱신이면 개별 틱은 끄고 매니저가 대신 갱신
+    if (GetBatchManager())
+    {
+        PrimaryComponentTick.SetTickFunctionEnable(false);
+        if (!IsIdle())
+        {
+            WakeSimulation();
+        }
+    }
+}
+
+void UProjectileMovementComponent::EndPlay(EEndPlayReason Reason)
+{
+    if (BatchIndex >= 0)
+    {
+        if (UWorld* World = GetWorld())
+        {
+            if (FProjectileManager* Manager = World->GetProjectileManager())
+            {
+                Manager->UnregisterProjectile(this);
+            }
+        }
+    }
+
+    Super_t::EndPlay(Reason);
+}
+
 void UProjectileMovementComponent::TickComponent(float DeltaSeconds)
 {
+    Super_t::TickComponent(DeltaSeconds);
+
+    TickComponentParallel(DeltaSeconds);
+    ApplyParallelTick();
+}
+
+void UProjectileMovementComponent::TickComponentParallel(float DeltaSeconds)
+{
+    PendingOffset = FVector(0.0f, 0.0f, 0.0f);
+    PendingDeltaTime = DeltaSeconds;
+    bPendingExpired = false;
+
     // Editor World에서는 Tick 안함
     if (!GWorld->bPie)
         return;
 
-    Super_t::TickComponent(DeltaSeconds);
-
     if (!bIsActive || !bCanEverTick || !UpdatedComponent)
         return;
 
@@ -63,18 +138,8 @@ void UProjectileMovementComponent::TickComponent(float DeltaSeconds)
         CurrentLifetime += DeltaSeconds;
         if (CurrentLifetime >= ProjectileLifespan)
         {
-            if (bAutoDestroyWhenLifespanExceeded)
-            {
-                // Owner Actor 파괴 (현재 지연 삭제 처리가 없어서 안보이게만 처리.)
-                AActor* Owner = UpdatedComponent->GetOwner();
-                if (Owner)
-                {
-                    //Owner->Destroy();
-                    Owner->SetActorHiddenInGame(true);
-                    return;
-                }
-            }
-            bIsActive = false;
+            // 비활성화/파괴는 다른 오브젝트 변경이므로 Apply에서
+            bPendingExpired = true;
             return;
         }
     }
@@ -94,18 +159,241 @@ void UProjectileMovementComponent::TickComponent(float DeltaSeconds)
     // 5. 속도 제한
     LimitVelocity();
 
-    // 6. 위치 업데이트
-    FVector Delta = Velocity * DeltaSeconds;
-    if (!Delta.IsZero())
+    // 6. 이동량 계산 (스윕/반영은 ApplyParallelTick)
+    PendingOffset = Velocity * DeltaSeconds;
+}
+
+void UProjectileMovementComponent::ApplyParallelTick()
+{
+    if (!UpdatedComponent)
+        return;
+
+    if (bPendingExpired)
+    {
+        bPendingExpired = false;
+        HandleLifespanExpired();
+    }
+
+    // 위치 업데이트 (월드 BVH 스윕, 충돌 이벤트는 메인 스레드에서)
+    if (!PendingOffset.IsZero())
+    {
+        const FVector Offset = PendingOffset;
+        PendingOffset = FVector(0.0f, 0.0f, 0.0f);
+        MoveWithCollision(Offset, PendingDeltaTime);
+    }
+
+    // 할 일이 없으면 틱 스케줄에서 빠짐 (FireInDirection/SetVelocity 등으로 깨어남)
+    if (GWorld->bPie && IsIdle())
+    {
+        PrimaryComponentTick.Sleep();
+    }
+}
+
+bool UProjectileMovementComponent::IsIdle() const
+{
+    if (!bIsActive)
+        return true;
+
+    if (ProjectileLifespan > 0.0f && CurrentLifetime >= ProjectileLifespan)
+        return true;
+
+    // 수명 카운트가 남아 있으면 계속 틱해야 함
+    if (ProjectileLifespan > 0.0f)
+        return false;
+
+    return Velocity.IsZero() && Acceleration.IsZero() && Gravity == 0.0f && !bIsHomingProjectile;
+}
+
+FProjectileManager* UProjectileMovementComponent::GetBatchManager() const
+{
+    if (!bUseBatchedUpdate || !HasBegunPlay())
+        return nullptr;
+
+    UWorld* World = GetWorld();
+    return (World && World->bPie) ? World->GetProjectileManager() : nullptr;
+}
+
+void UProjectileMovementComponent::WakeSimulation()
+{
+    if (FProjectileManager* Manager = GetBatchManager())
     {
-        UpdatedComponent->AddWorldOffset(Delta);
+        if (BatchIndex < 0)
+        {
+            Manager->RegisterProjectile(this);
+        }
+        return;
     }
+    PrimaryComponentTick.WakeUp();
+}
 
-    // 7. 회전 업데이트 (속도 방향 추적)
+void UProjectileMovementComponent::SleepSimulation()
+{
+    if (BatchIndex >= 0)
+    {
+        if (UWorld* World = GetWorld())
+        {
+            if (FProjectileManager* Manager = World->GetProjectileManager())
+            {
+                Manager->UnregisterProjectile(this);
+            }
+        }
+        return;
+    }
+    PrimaryComponentTick.Sleep();
+}
+
+void UProjectileMovementComponent::OnPropertyChanged(const FProperty& InProperty)
+{
+    Super::OnPropertyChanged(InProperty);
+
+    // 읽기 전용 표시값은 제외
+    if (strcmp(InProperty.Name, "CurrentLifetime") != 0)
+    {
+        WakeSimulation();
+    }
+}
+
+void UProjectileMovementComponent::StopSimulating()
+{
+    StopMovement();
+    bIsActive = false;
+    SleepSimulation();
+}
+
+const FBVHierarchy* UProjectileMovementComponent::GetWorldBVH() const
+{
+    UWorld* World = GetWorld();
+    UWorldPartitionManager* Partition = World ? World->GetPartitionManager() : nullptr;
+    return Partition ? Partition->GetBVH() : nullptr;
+}
+
+int32 UProjectileMovementComponent::MoveWithCollision(const FVector& InDelta, float InDeltaTime)
+{
+    if (!UpdatedComponent || InDelta.IsZero())
+        return 0;
+
+    const FBVHierarchy* BVH = bSweepCollision ? GetWorldBVH() : nullptr;
+    const FCapsuleShape Shape(CollisionRadius, 0.0f);
+    AActor* Owner = GetOwner();
+
+    FVector Location = UpdatedComponent->GetWorldLocation();
+    FVector Remaining = InDelta;
+    float TimeLeft = InDeltaTime;
+    int32 HitCount = 0;
+
+    const int32 IterationCount = MaxSimulationIterations > 1 ? MaxSimulationIterations : 1;
+    for (int32 Iteration = 0; Iteration < IterationCount && !Remaining.IsZero(); ++Iteration)
+    {
+        FCapsuleSweepHit Hit;
+        if (!BVH || !Collision::SweepCapsuleWorld(*BVH, Location, Remaining, Shape, ProjectileSkinWidth, Owner, Hit))
+        {
+            Location += Remaining;
+            Remaining = FVector(0.0f, 0.0f, 0.0f);
+            break;
+        }
+
+        if (Hit.bStartPenetrating)
+        {
+            // 시작부터 겹쳐 있음: 밀어낸 위치에서 막힌 것으로 처리
+            Location += Hit.Normal * Hit.PenetrationDepth;
+        }
+        else
+        {
+            Location += Remaining * Hit.Time;
+        }
+        TimeLeft *= (1.0f - Hit.Time);
+        ++HitCount;
+
+        // 이벤트 핸들러가 충돌 위치를 보도록 먼저 반영
+        UpdatedComponent->SetWorldLocation(Location);
+        if (!HandleBlockingHit(Hit))
+        {
+            // 멈췄거나 풀로 반납됨: 더 이상 위치를 건드리지 않음
+            return HitCount;
+        }
+        Remaining = Velocity * TimeLeft;
+    }
+
+    // 반복 횟수를 다 쓰면 남은 이동은 버림 (다음 프레임에 이어서)
+    UpdatedComponent->SetWorldLocation(Location);
+
+    // 회전 업데이트 (속도 방향 추적)
     if (bRotationFollowsVelocity)
     {
         UpdateRotationFromVelocity();
     }
+    return HitCount;
+}
+
+bool UProjectileMovementComponent::HandleBlockingHit(const FCapsuleSweepHit& InHit)
+{
+    FProjectileHitResult Result;
+    Result.ImpactPoint = InHit.ImpactPoint;
+    Result.Normal = InHit.Normal;
+    Result.ImpactNormal = InHit.ImpactNormal;
+    Result.ImpactVelocity = Velocity;
+    Result.Time = InHit.Time;
+    Result.HitComponent = InHit.Component;
+    Result.HitActor = InHit.Component ? InHit.Component->GetOwner() : nullptr;
+
+    OnProjectileHit.Broadcast(this, Result);
+
+    // 핸들러가 멈췄거나 다시 발사했으면 그 상태를 따름
+    if (!bIsActive)
+        return false;
+
+    if (bShouldBounce)
+    {
+        Velocity = ComputeBounceVelocity(Velocity, InHit.Normal);
+        const float StopSpeed = BounceVelocityStopSimulatingThreshold;
+        if (Velocity.SizeSquared() >= StopSpeed * StopSpeed)
+            return true;
+    }
+
+    StopSimulating();
+    OnProjectileStop.Broadcast(this, Result);
+
+    if (bDestroyOnStop)
+    {
+        ReleaseOrDestroyOwner();
+    }
+    return false;
+}
+
+FVector UProjectileMovementComponent::ComputeBounceVelocity(const FVector& InVelocity, const FVector& InNormal) const
+{
+    const float VDotN = FVector::Dot(InVelocity, InNormal);
+    if (VDotN >= 0.0f)
+        return InVelocity;  // 이미 표면에서 멀어지는 중
+
+    const FVector NormalPart = InNormal * VDotN;
+    const FVector TangentPart = (InVelocity - NormalPart) * FMath::Clamp(1.0f - Friction, 0.0f, 1.0f);
+    return TangentPart - NormalPart * Bounciness;
+}
+
+void UProjectileMovementComponent::HandleLifespanExpired()
+{
+    bIsActive = false;
+
+    if (bAutoDestroyWhenLifespanExceeded)
+    {
+        ReleaseOrDestroyOwner();
+    }
+}
+
+void UProjectileMovementComponent::ReleaseOrDestroyOwner()
+{
+    AActor* Owner = GetOwner();
+    UWorld* World = GetWorld();
+    if (!Owner || !World)
+        return;
+
+    FProjectileManager* Manager = World->GetProjectileManager();
+    if (Manager && Manager->ReleaseProjectileActor(Owner))
+        return;
+
+    // 이동/이벤트 도중이므로 프레임 끝에 파괴
+    World->DestroyActorDeferred(Owner);
 }
 
 void UProjectileMovementComponent::FireInDirection(const FVector& ShootDirection)
@@ -119,6 +407,7 @@ void UProjectileMovementComponent::FireInDirection(const FVector& ShootDirection
     // 상태 초기화
     bIsActive = true;
     CurrentLifetime = 0.0f;
+    WakeSimulation();
 }
 
 void UProjectileMovementComponent::SetVelocityInLocalSpace(const FVector& NewVelocity)
@@ -129,18 +418,21 @@ void UProjectileMovementComponent::SetVelocityInLocalSpace(const FVector& NewVel
     // 로컬 공간 속도를 월드 공간으로 변환
     FQuat WorldRotation = UpdatedComponent->GetWorldRotation();
     Velocity = WorldRotation.RotateVector(NewVelocity);
+    WakeSimulation();
 }
 
 void UProjectileMovementComponent::SetHomingTarget(AActor* Target)
 {
     HomingTargetActor = Target;
     HomingTargetComponent = nullptr;  // Component가 우선순위가 높으므로 초기화
+    WakeSimulation();
 }
 
 void UProjectileMovementComponent::SetHomingTarget(USceneComponent* Target)
 {
     HomingTargetComponent = Target;
     HomingTargetActor = nullptr;
+    WakeSimulation();
 }
 
 void UProjectileMovementComponent::LimitVelocity()
@@ -217,9 +509,12 @@ void UProjectileMovementComponent::DuplicateSubObjects()
     HomingTargetActor = nullptr;
     HomingTargetComponent = nullptr;
 
-    // 런타임 상태 초기화
+    // 런타임 상태 초기화 (이벤트 바인딩은 복사하지 않음)
     CurrentLifetime = 0.0f;
     bIsActive = true;
+    BatchIndex = -1;
+    OnProjectileHit.RemoveAll();
+    OnProjectileStop.RemoveAll();
 }
 
 void UProjectileMovementComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -1,14 +1,41 @@
 ﻿#pragma once
 #include "MovementComponent.h"
 #include "Vector.h"
+#include "Delegate.h"
 
 class AActor;
 class USceneComponent;
+class UStaticMeshComponent;
+class FBVHierarchy;
+class FProjectileManager;
+class UProjectileMovementComponent;
+struct FCapsuleSweepHit;
+
+// 발사체가 막힌 지점 (월드 BVH 스윕 결과)
+struct FProjectileHitResult
+{
+    FVector ImpactPoint;
+    FVector Normal;             // 접촉 법선 (표면 -> 발사체). 튕김 방향 계산에 사용
+    FVector ImpactNormal;       // 닿은 삼각형의 면 법선
+    FVector ImpactVelocity;     // 닿기 직전 속도
+    float Time = 1.0f;          // 이번 이동량 대비 [0, 1]
+    const UStaticMeshComponent* HitComponent = nullptr;
+    AActor* HitActor = nullptr;
+};
+
+/**
+ * 발사체 충돌 이벤트. 발사체 이동 도중에 호출되므로 핸들러에서 액터를 없앨 때는
+ * AActor::Destroy / UWorld::DestroyActorDeferred (프레임 끝 파괴) 또는 풀 반납을 사용해야 합니다.
+ */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FProjectileHitSignature, UProjectileMovementComponent*, const FProjectileHitResult&);
 
 /**
  * UProjectileMovementComponent
  * 발사체(Projectile)의 움직임을 시뮬레이션하는 컴포넌트
  * 중력, 바운스, 호밍 등의 기능을 지원
+ *
+ * 이동은 월드 BVH에 대한 구/선분 스윕(CCD)으로 검사하므로 빠른 발사체도 얇은 메시를 통과하지 않습니다.
+ * PIE에서 bUseBatchedUpdate면 개별 틱 대신 월드의 FProjectileManager가 모든 발사체를 한 번에 갱신합니다.
  */
 class UProjectileMovementComponent : public UMovementComponent
 {
@@ -22,14 +49,47 @@ protected:
 
 public:
     // Life Cycle
+    virtual void BeginPlay() override;
+    virtual void EndPlay(EEndPlayReason Reason) override;
     virtual void TickComponent(float DeltaSeconds) override;
 
+    // 병렬 틱: 속도/이동량 계산(워커 스레드) → 위치 반영(메인 스레드).
+    // 수명이 끝났거나 움직일 요인이 없으면 슬립하고, 발사/속도 설정 시 깨어남
+    virtual void TickComponentParallel(float DeltaSeconds) override;
+    virtual void ApplyParallelTick() override;
+
     // 발사 API
     void FireInDirection(const FVector& ShootDirection);
     void SetVelocityInLocalSpace(const FVector& NewVelocity);
 
+    // 속도/가속도를 없애고 비활성화 (다시 발사하기 전까지 갱신하지 않음)
+    void StopSimulating();
+
+    // 충돌 이벤트: 막힐 때마다 / 막혀서 멈췄을 때
+    FProjectileHitSignature OnProjectileHit;
+    FProjectileHitSignature OnProjectileStop;
+
+    // 충돌 속성 Getter/Setter
+    void SetSweepCollision(bool bNewSweep) { bSweepCollision = bNewSweep; }
+    bool GetSweepCollision() const { return bSweepCollision; }
+
+    void SetCollisionRadius(float NewRadius) { CollisionRadius = NewRadius > 0.0f ? NewRadius : 0.0f; }
+    float GetCollisionRadius() const { return CollisionRadius; }
+
+    void SetShouldBounce(bool bNewShouldBounce) { bShouldBounce = bNewShouldBounce; }
+    bool GetShouldBounce() const { return bShouldBounce; }
+
+    void SetBounciness(float NewBounciness) { Bounciness = NewBounciness; }
+    float GetBounciness() const { return Bounciness; }
+
+    void SetFriction(float NewFriction) { Friction = NewFriction; }
+    float GetFriction() const { return Friction; }
+
+    // 막힌 면의 접촉 법선 InNormal 기준 튕긴 속도 (법선 성분은 Bounciness배로 반사, 접선 성분은 Friction만큼 감속)
+    FVector ComputeBounceVelocity(const FVector& InVelocity, const FVector& InNormal) const;
+
     // 물리 속성 Getter/Setter
-    void SetGravity(float NewGravity) { Gravity = NewGravity; }
+    void SetGravity(float NewGravity) { Gravity = NewGravity; WakeSimulation(); }
     float GetGravity() const { return Gravity; }
 
     void SetInitialSpeed(float NewInitialSpeed) { InitialSpeed = NewInitialSpeed; }
@@ -47,7 +107,7 @@ public:
     void SetHomingAccelerationMagnitude(float NewMagnitude) { HomingAccelerationMagnitude = NewMagnitude; }
     float GetHomingAccelerationMagnitude() const { return HomingAccelerationMagnitude; }
 
-    void SetIsHomingProjectile(bool bNewIsHoming) { bIsHomingProjectile = bNewIsHoming; }
+    void SetIsHomingProjectile(bool bNewIsHoming) { bIsHomingProjectile = bNewIsHoming; WakeSimulation(); }
     bool IsHomingProjectile() const { return bIsHomingProjectile; }
 
     // 회전 속성 Getter/Setter
@@ -62,10 +122,10 @@ public:
     bool GetAutoDestroyWhenLifespanExceeded() const { return bAutoDestroyWhenLifespanExceeded; }
 
     // 상태 API
-    void SetActive(bool bNewActive) { bIsActive = bNewActive; }
+    void SetActive(bool bNewActive) { bIsActive = bNewActive; WakeSimulation(); }
     bool IsActive() const { return bIsActive; }
 
-    void ResetLifetime() { CurrentLifetime = 0.0f; }
+    void ResetLifetime() { CurrentLifetime = 0.0f; WakeSimulation(); }
     float GetCurrentLifetime() const { return CurrentLifetime; }
 
     DECLARE_DUPLICATE(UProjectileMovementComponent)
@@ -73,12 +133,37 @@ public:
 
     virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
+    // 디테일 패널 수정은 필드를 직접 쓰므로 잠들어 있었다면 깨움 (여전히 유휴면 다음 틱에 다시 잠듦)
+    virtual void OnPropertyChanged(const FProperty& InProperty) override;
+
 protected:
     // 내부 헬퍼 함수
     void LimitVelocity();
     void ComputeHomingAcceleration(float DeltaTime);
     void UpdateRotationFromVelocity();
 
+    // 더 이상 틱할 필요가 없는지 (수명 종료 또는 속도/가속도/중력/호밍이 모두 없음)
+    bool IsIdle() const;
+
+    // 유휴 상태 진입/해제 (배치 갱신이면 매니저 등록 해제/등록, 아니면 틱 슬립/깨우기)
+    void WakeSimulation();
+    void SleepSimulation();
+    FProjectileManager* GetBatchManager() const;
+
+    // InDelta만큼 스윕하며 이동. 막히면 튕기거나 멈추고, 튕기면 남은 시간만큼 다시 스윕 (최대 MaxSimulationIterations번)
+    // 반환값은 이번 이동에서 막힌 횟수
+    int32 MoveWithCollision(const FVector& InDelta, float InDeltaTime);
+
+    // 충돌 이벤트 후 튕김/정지 처리. 계속 움직이면 true
+    bool HandleBlockingHit(const FCapsuleSweepHit& InHit);
+
+    void HandleLifespanExpired();
+
+    // 풀에서 꺼낸 액터면 풀로 돌려보내고, 아니면 프레임 끝에 파괴
+    void ReleaseOrDestroyOwner();
+
+    const FBVHierarchy* GetWorldBVH() const;
+
 protected:
     // [PIE] 값 복사
 
@@ -104,6 +189,34 @@ protected:
     // 호밍 기능 활성화 여부
     bool bIsHomingProjectile;
 
+    // === 충돌 속성 ===
+    // 이동을 월드 BVH(스태틱 메시)에 스윕해 막히는지 검사
+    bool bSweepCollision;
+
+    // 스윕 구의 반지름, 0이면 선분
+    float CollisionRadius;
+
+    // 막히면 튕길지 (false면 그 자리에서 멈춤)
+    bool bShouldBounce;
+
+    // 튕길 때 법선 방향 속도 보존 비율
+    float Bounciness;
+
+    // 튕길 때 접선 방향 속도 감소 비율 [0, 1]
+    float Friction;
+
+    // 튕긴 뒤 속도가 이보다 작으면 멈춤
+    float BounceVelocityStopSimulatingThreshold;
+
+    // 한 프레임에 튕김을 다시 스윕하는 최대 횟수
+    int32 MaxSimulationIterations;
+
+    // 멈추면 (풀 반납 또는) 파괴
+    bool bDestroyOnStop;
+
+    // PIE에서 월드 발사체 매니저의 배치 갱신 사용 (false면 개별 병렬 틱)
+    bool bUseBatchedUpdate;
+
     // === 회전 속성 ===
     // 속도 방향으로 회전 여부
     bool bRotationFollowsVelocity;
@@ -121,4 +234,15 @@ protected:
     // === 상태 ===
     // 활성화 상태
     bool bIsActive;
+
+private:
+    friend class FProjectileManager;
+
+    // 병렬 틱 계산 결과
+    FVector PendingOffset;
+    float PendingDeltaTime = 0.0f;
+    bool bPendingExpired = false;
+
+    // 배치 갱신 중 매니저 슬롯 (-1이면 미등록)
+    int32 BatchIndex = -1;
 };
@@ -18,6 +18,9 @@ URotatingMovementComponent::URotatingMovementComponent()
     , bRotationInLocalSpace(true)
 {
     bCanEverTick = true;
+
+    // 자기 UpdatedComponent의 트랜스폼만 읽고 계산하므로 같은 단계의 다른 틱과 병렬 계산 가능
+    PrimaryComponentTick.bRunOnAnyThread = true;
 }
 
 URotatingMovementComponent::~URotatingMovementComponent()
@@ -26,13 +29,21 @@ URotatingMovementComponent::~URotatingMovementComponent()
 
 void URotatingMovementComponent::TickComponent(float DeltaSeconds)
 {
+    Super_t::TickComponent(DeltaSeconds);
+
+    TickComponentParallel(DeltaSeconds);
+    ApplyParallelTick();
+}
+
+void URotatingMovementComponent::TickComponentParallel(float DeltaSeconds)
+{
+    bHasPendingTransform = false;
+
     // Editor World에서는 Tick 안함.
     // + GetWorld로 GWorld 받아오면 Dangilng Pointer 버그있음
     if (!GWorld->bPie)
         return;
 
-    Super_t::TickComponent(DeltaSeconds);
-
     if (!bIsActive || !bCanEverTick)
         return;
 
@@ -50,8 +61,9 @@ void URotatingMovementComponent::TickComponent(float DeltaSeconds)
         // 로컬 공간에서 회전 적용
         if (PivotTranslation.IsZero())
         {
-            // 컴포넌트 원점을 중심으로 단순 회전
-            UpdatedComponent->AddLocalRotation(DeltaRotation);
+            // 컴포넌트 원점을 중심으로 단순 회전 (AddLocalRotation과 동일: 로컬은 우측곱)
+            PendingLocation = UpdatedComponent->GetRelativeLocation();
+            PendingRotation = UpdatedComponent->GetRelativeRotation() * DeltaRotation;
         }
         else
         {
@@ -62,11 +74,9 @@ void URotatingMovementComponent::TickComponent(float DeltaSeconds)
             // 피벗 주변 회전
             FVector OffsetFromPivot = CurrentLocation - PivotTranslation;
             FVector RotatedOffset = DeltaRotation.RotateVector(OffsetFromPivot);
-            FVector NewLocation = PivotTranslation + RotatedOffset;
 
-            // 새로운 회전과 위치 적용
-            UpdatedComponent->SetRelativeRotation(DeltaRotation * CurrentRotation);
-            UpdatedComponent->SetRelativeLocation(NewLocation);
+            PendingLocation = PivotTranslation + RotatedOffset;
+            PendingRotation = DeltaRotation * CurrentRotation;
         }
     }
     else
@@ -75,7 +85,8 @@ void URotatingMovementComponent::TickComponent(float DeltaSeconds)
         if (PivotTranslation.IsZero())
         {
             // 컴포넌트 원점을 중심으로 단순 회전
-            UpdatedComponent->AddWorldRotation(DeltaRotation);
+            PendingLocation = UpdatedComponent->GetWorldLocation();
+            PendingRotation = DeltaRotation * UpdatedComponent->GetWorldRotation();
         }
         else
         {
@@ -89,18 +100,53 @@ void URotatingMovementComponent::TickComponent(float DeltaSeconds)
             // 월드 피벗 주변 회전
             FVector OffsetFromPivot = CurrentWorldLocation - WorldPivot;
             FVector RotatedOffset = DeltaRotation.RotateVector(OffsetFromPivot);
-            FVector NewWorldLocation = WorldPivot + RotatedOffset;
 
-            // 새로운 회전과 위치 적용
-            UpdatedComponent->SetWorldRotation(DeltaRotation * CurrentWorldRotation);
-            UpdatedComponent->SetWorldLocation(NewWorldLocation);
+            PendingLocation = WorldPivot + RotatedOffset;
+            PendingRotation = DeltaRotation * CurrentWorldRotation;
         }
     }
+
+    bHasPendingTransform = true;
+}
+
+void URotatingMovementComponent::ApplyParallelTick()
+{
+    if (!bHasPendingTransform || !UpdatedComponent)
+        return;
+
+    bHasPendingTransform = false;
+
+    // 위치/회전을 한 번에 반영 (OnTransformUpdated 1회)
+    if (bRotationInLocalSpace)
+    {
+        UpdatedComponent->SetLocalLocationAndRotation(PendingLocation, PendingRotation);
+    }
+    else
+    {
+        UpdatedComponent->SetWorldLocationAndRotation(PendingLocation, PendingRotation);
+    }
+
+    // 회전하지 않는 동안은 틱 스케줄에서 빠짐 (SetRotationRate로 깨어남)
+    if (RotationRate.IsZero())
+    {
+        PrimaryComponentTick.Sleep();
+    }
 }
 
 void URotatingMovementComponent::SetRotationRate(const FVector& NewRotationRate)
 {
     RotationRate = NewRotationRate;
+    PrimaryComponentTick.WakeUp();
+}
+
+void URotatingMovementComponent::OnPropertyChanged(const FProperty& InProperty)
+{
+    Super::OnPropertyChanged(InProperty);
+
+    if (strcmp(InProperty.Name, "RotationRate") == 0)
+    {
+        PrimaryComponentTick.WakeUp();
+    }
 }
 
 void URotatingMovementComponent::SetPivotTranslation(const FVector& NewPivotTranslation)
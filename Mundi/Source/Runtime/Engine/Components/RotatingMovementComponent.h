@@ -21,6 +21,10 @@ public:
     // Life Cycle
     virtual void TickComponent(float DeltaSeconds) override;
 
+    // 병렬 틱: 새 트랜스폼 계산(워커 스레드) → 반영(메인 스레드). 회전 속도가 0이면 슬립
+    virtual void TickComponentParallel(float DeltaSeconds) override;
+    virtual void ApplyParallelTick() override;
+
     // 회전 API
     void SetRotationRate(const FVector& NewRotationRate);
     FVector GetRotationRate() const { return RotationRate; }
@@ -36,6 +40,9 @@ public:
 
     virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
+    // 디테일 패널에서 RotationRate를 바꾸면 잠든 틱을 깨움
+    virtual void OnPropertyChanged(const FProperty& InProperty) override;
+
 protected:
     // [PIE] 값 복사
     // 초당 회전 속도 (도 단위, Pitch/Yaw/Roll)
@@ -46,4 +53,10 @@ protected:
 
     // true면 로컬 공간에서 회전, false면 월드 공간에서 회전
     bool bRotationInLocalSpace;
+
+private:
+    // 병렬 틱 계산 결과 (bRotationInLocalSpace면 상대, 아니면 월드 트랜스폼)
+    bool bHasPendingTransform = false;
+    FVector PendingLocation;
+    FQuat PendingRotation;
 };
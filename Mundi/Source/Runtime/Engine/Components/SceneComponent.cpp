@@ -5,6 +5,7 @@
 #include "PrimitiveComponent.h"
 #include "WorldPartitionManager.h"
 #include "BillboardComponent.h"
+#include "LevelArchive.h"
 
 IMPLEMENT_CLASS(USceneComponent)
 
@@ -364,6 +365,30 @@ void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void USceneComponent::SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar)
+{
+	Super::SerializeBinary(bInIsLoading, Ar);
+
+	if (bInIsLoading)
+	{
+		Ar << SceneId;
+		SceneIdMap.Add(SceneId, this);
+		Ar << ParentId;
+
+		RelativeRotation = FQuat::MakeFromEulerZYX(RelativeRotationEuler).GetNormalized();
+
+		UpdateRelativeTransform();
+		OnTransformUpdated();
+	}
+	else
+	{
+		uint32 Id = UUID;
+		uint32 AttachParentId = AttachParent ? AttachParent->UUID : 0;
+		Ar << Id;
+		Ar << AttachParentId;
+	}
+}
+
 void USceneComponent::OnRegister(UWorld* InWorld)
 {
     if (!std::strcmp(this->GetClass()->Name , USceneComponent::StaticClass()->Name) && !SpriteComponent)
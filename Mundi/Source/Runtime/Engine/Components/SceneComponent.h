@@ -93,6 +93,7 @@ public:
 
     // Serialize
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+    void SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar) override;
     void OnRegister(UWorld* InWorld) override;
     void OnSerialized() override;
 
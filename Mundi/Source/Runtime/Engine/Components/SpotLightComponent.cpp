@@ -107,6 +107,7 @@ FSpotLightInfo USpotLightComponent::GetLightInfo() const
 	Info.bCastShadow = GetIsCastShadows() ? 1u : 0u;
 	Info.ShadowMapIndex = static_cast<uint32>(GetShadowMapIndex());
 	Info.Padding = 0; // 패딩 초기화
+	Info.ShadowAtlasScaleOffset = ShadowAtlasScaleOffset;
 
 	// Calculate Light View-Projection matrix for shadow mapping
 	if (Info.bCastShadow && Info.ShadowMapIndex != 0xFFFFFFFF)
@@ -46,6 +46,10 @@ public:
 	// - 1.0: InnerConeAngle 안, 원뿔 중심으로 최대 영향
 	float GetConeAttenuation(const FVector& WorldPosition) const;
 
+	// 섀도우 아틀라스 안의 타일 (FShadowManager가 매 프레임 지정, uv * xy + zw)
+	void SetShadowAtlasScaleOffset(const FVector4& InScaleOffset) { ShadowAtlasScaleOffset = InScaleOffset; }
+	const FVector4& GetShadowAtlasScaleOffset() const { return ShadowAtlasScaleOffset; }
+
 	// Light Info
 	FSpotLightInfo GetLightInfo() const;
 
@@ -77,6 +81,8 @@ protected:
 	float PreviousInnerConeAngle = 30.0f;
 	float PreviousOuterConeAngle = 45.0f;
 
+	FVector4 ShadowAtlasScaleOffset = FVector4(1.0f, 1.0f, 0.0f, 0.0f);
+
 	// Direction Gizmo (shows light direction)
 	class UGizmoArrowComponent* DirectionGizmo = nullptr;
 };
@@ -8,6 +8,7 @@
 #include "World.h"
 #include "WorldPartitionManager.h"
 #include "JsonSerializer.h"
+#include "LevelArchive.h"
 #include "CameraActor.h"
 #include "CameraComponent.h"
 #include "MeshBatchElement.h"
@@ -91,6 +92,10 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 	const bool bHasSections = !MeshGroupInfos.IsEmpty();
 	const uint32 NumSectionsToProcess = bHasSections ? static_cast<uint32>(MeshGroupInfos.size()) : 1;
 
+	// 섹션들이 같은 변환을 공유하므로 한 번만 계산 (법선 행렬은 월드 행렬이 바뀔 때만 다시 계산)
+	const FMatrix WorldMatrix = GetWorldMatrix();
+	const FMatrix& NormalMatrix = GetNormalMatrix(WorldMatrix);
+
 	for (uint32 SectionIndex = 0; SectionIndex < NumSectionsToProcess; ++SectionIndex)
 	{
 		uint32 IndexCount = 0;
@@ -120,7 +125,18 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		}
 
 		FMeshBatchElement BatchElement;
-		FShaderVariant* ShaderVariant = ShaderToUse->GetShaderVariant(MaterialToUse->GetShaderMacros());
+		FShaderVariant* ShaderVariant = nullptr;
+		if (StaticMesh->IsPackedVertex())
+		{
+			// 패킹 정점 메시는 PACKED_* 매크로가 추가된 Variant 사용 (처음 요청 시 컴파일)
+			TArray<FShaderMacro> ShaderMacros = MaterialToUse->GetShaderMacros();
+			StaticMesh->AppendVertexShaderMacros(ShaderMacros);
+			ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(UResourceManager::GetInstance().GetDevice(), ShaderMacros);
+		}
+		else
+		{
+			ShaderVariant = ShaderToUse->GetShaderVariant(MaterialToUse->GetShaderMacros());
+		}
 
 		if (ShaderVariant)
 		{
@@ -135,10 +151,14 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		BatchElement.VertexBuffer = StaticMesh->GetVertexBuffer();
 		BatchElement.IndexBuffer = StaticMesh->GetIndexBuffer();
 		BatchElement.VertexStride = StaticMesh->GetVertexStride();
+		BatchElement.PackedVertexFlags = StaticMesh->GetPackedVertexFlags();
+		BatchElement.PositionDequantScale = StaticMesh->GetPositionDequantScale();
+		BatchElement.PositionDequantBias = StaticMesh->GetPositionDequantBias();
 		BatchElement.IndexCount = IndexCount;
 		BatchElement.StartIndex = StartIndex;
 		BatchElement.BaseVertexIndex = 0;
-		BatchElement.WorldMatrix = GetWorldMatrix();
+		BatchElement.WorldMatrix = WorldMatrix;
+		BatchElement.NormalMatrix = &NormalMatrix;
 		BatchElement.ObjectID = InternalIndex;
 		BatchElement.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
 
@@ -496,6 +516,85 @@ void UStaticMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+void UStaticMeshComponent::SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar)
+{
+	Super::SerializeBinary(bInIsLoading, Ar);
+
+	// 슬롯 종류: 0 = 비어 있음, 1 = UMaterial 에셋 경로, 2 = UMaterialInstanceDynamic
+	// (MID 오버라이드는 가변 구조이고 드물기 때문에 기존 JSON 표현을 문자열로 보관)
+	enum : uint8 { SlotNone = 0, SlotMaterial = 1, SlotDynamic = 2 };
+
+	if (bInIsLoading)
+	{
+		ClearDynamicMaterials();
+
+		uint32 SlotCount = 0;
+		Ar << SlotCount;
+		if (SlotCount > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+		{
+			throw std::runtime_error("Level binary corrupt: material slot count is unreasonable.");
+		}
+		MaterialSlots.resize(SlotCount);
+
+		for (uint32 i = 0; i < SlotCount; ++i)
+		{
+			uint8 SlotType = SlotNone;
+			Ar << SlotType;
+
+			FString SlotData;
+			if (SlotType != SlotNone)
+			{
+				Ar.SerializeString(SlotData);
+			}
+
+			UMaterialInterface* LoadedMaterial = nullptr;
+			if (SlotType == SlotDynamic)
+			{
+				JSON SlotJson = JSON::Load(SlotData);
+				UMaterialInstanceDynamic* NewMID = new UMaterialInstanceDynamic();
+				NewMID->Serialize(true, SlotJson);
+				DynamicMaterialInstances.Add(NewMID);
+				LoadedMaterial = NewMID;
+			}
+			else if (SlotType == SlotMaterial && !SlotData.empty())
+			{
+				LoadedMaterial = UResourceManager::GetInstance().Load<UMaterial>(SlotData);
+			}
+
+			MaterialSlots[i] = LoadedMaterial;
+		}
+	}
+	else
+	{
+		uint32 SlotCount = static_cast<uint32>(MaterialSlots.size());
+		Ar << SlotCount;
+
+		for (UMaterialInterface* Mtl : MaterialSlots)
+		{
+			uint8 SlotType = SlotNone;
+			FString SlotData;
+			if (UMaterialInstanceDynamic* MID = Cast<UMaterialInstanceDynamic>(Mtl))
+			{
+				JSON SlotJson = JSON::Make(JSON::Class::Object);
+				MID->Serialize(false, SlotJson);
+				SlotType = SlotDynamic;
+				SlotData = SlotJson.dump();
+			}
+			else if (Mtl)
+			{
+				SlotType = SlotMaterial;
+				SlotData = Mtl->GetFilePath();
+			}
+
+			Ar << SlotType;
+			if (SlotType != SlotNone)
+			{
+				Ar.SerializeString(SlotData);
+			}
+		}
+	}
+}
+
 // 직렬화 완료 직후 호출됨
 void UStaticMeshComponent::OnSerialized()
 {
@@ -26,6 +26,7 @@ public:
 	void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+	void SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar) override;
 	void OnSerialized() override;
 
 	void SetStaticMesh(const FString& PathFileName);
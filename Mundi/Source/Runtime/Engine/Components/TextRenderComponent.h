@@ -1,5 +1,7 @@
 ﻿#pragma once
 #include "MeshComponent.h"
+#include "SpriteBatch.h"
+
 class UTextRenderComponent : public UPrimitiveComponent
 {
 public:
@@ -12,8 +14,17 @@ protected:
 	~UTextRenderComponent() override;
 
 public:
-	void InitCharInfoMap();
-	TArray<FBillboardVertexInfo_GPU> CreateVerticesForString(const FString& text,const FVector& StartPos);
+	// 공유 스프라이트 스트림에 글자 쿼드를 추가 (문자열/트랜스폼이 바뀐 경우에만 다시 테셀레이션)
+	void CollectSprites(FSpriteBatcher& OutBatcher, const FSceneView* View);
+
+	const FString& GetText() const { return Text; }
+	void SetText(const FString& InText) { Text = InText; }
+
+	static const FGlyphTable& GetGlyphTable();
+
+	// 월드의 피킹용 스프라이트 목록에 등록/해제
+	void OnRegister(UWorld* InWorld) override;
+	void OnUnregister() override;
 
 	UQuad* GetStaticMesh() const { return TextQuad; }
 
@@ -29,8 +40,11 @@ public:
 
 private:
 	FString Text;
-	static TMap<char, FBillboardVertexInfo> CharInfoMap; // shared per-process, built once
 	FString TextureFilePath;
-	UMaterialInterface* Material;
+	UMaterialInterface* Material = nullptr;
 	UQuad* TextQuad = nullptr;
+
+	FTextQuadCache TextCache;
+	UTexture* AtlasTexture = nullptr;
+	FString AtlasTexturePath;	// AtlasTexture를 찾은 TextureFilePath (바뀌면 다시 찾음)
 };
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "CameraActor.h"
 #include "ObjectFactory.h"
 #include "CameraComponent.h"
+#include "LevelArchive.h"
 #include "UIManager.h"
 #include "InputManager.h"
 #include "Vector.h"
@@ -208,6 +209,29 @@ void ACameraActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
     }
 }
 
+void ACameraActor::SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar)
+{
+    Super::SerializeBinary(bInIsLoading, Ar);
+    // 수동 직렬화 (프로퍼티로 등록되지 않은 변수들)
+    Ar << MouseSensitivity;
+    Ar << CameraMoveSpeed;
+    Ar << CameraYawDeg;
+    Ar << CameraPitchDeg;
+    Ar << PerspectiveCameraInput;
+
+    if (bInIsLoading)
+    {
+        for (UActorComponent* Component : OwnedComponents)
+        {
+            if (UCameraComponent* CameraComp = Cast<UCameraComponent>(Component))
+            {
+                CameraComponent = CameraComp;
+                break;
+            }
+        }
+    }
+}
+
 void ACameraActor::OnSerialized()
 {
     Super::OnSerialized();
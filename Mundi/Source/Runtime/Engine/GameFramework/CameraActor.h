@@ -61,6 +61,7 @@ public:
     // ───── 직렬화 관련 ────────────────────────────
     void OnSerialized() override;
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+    void SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar) override;
 
     // ───── 복사 관련 ────────────────────────────
     void DuplicateSubObjects() override;
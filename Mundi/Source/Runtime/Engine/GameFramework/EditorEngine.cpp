@@ -8,6 +8,10 @@
 #include "GameStateBase.h"
 #include"RunnerGameMode.h"
 #include"CameraActor.h"
+#include "CollisionManager.h"
+#include "FileChangeService.h"
+#include "InputRecording.h"
+#include "PlatformTime.h"
 float UEditorEngine::ClientWidth = 1024.0f;
 float UEditorEngine::ClientHeight = 1024.0f;
 
@@ -156,7 +160,8 @@ bool UEditorEngine::CreateMainWindow(HINSTANCE hInstance)
     if (clientHeight < 600) clientHeight = 1024;
 
     // Convert client area size to window size (including title bar and borders)
-    DWORD windowStyle = WS_POPUP | WS_VISIBLE | WS_OVERLAPPEDWINDOW;
+    // 헤드리스: D3D 디바이스(리소스 로드)에 필요한 창만 만들고 표시하지 않음
+    DWORD windowStyle = bHeadless ? WS_OVERLAPPEDWINDOW : (WS_POPUP | WS_VISIBLE | WS_OVERLAPPEDWINDOW);
     RECT windowRect = { 0, 0, clientWidth, clientHeight };
     AdjustWindowRect(&windowRect, windowStyle, FALSE);
 
@@ -175,19 +180,26 @@ bool UEditorEngine::CreateMainWindow(HINSTANCE hInstance)
     return true;
 }
 
-bool UEditorEngine::Startup(HINSTANCE hInstance)
+bool UEditorEngine::Startup(HINSTANCE hInstance, bool bInHeadless)
 {
+    bHeadless = bInHeadless;
     LoadIniFile();
 
     if (!CreateMainWindow(hInstance))
         return false;
 
-    //디바이스 리소스 및 렌더러 생성
+    //디바이스 리소스 및 렌더러 생성 (헤드리스도 메시/텍스처 로드에 디바이스가 필요)
     RHIDevice.Initialize(HWnd);
-    Renderer = std::make_unique<URenderer>(&RHIDevice);
+    if (!bHeadless)
+    {
+        Renderer = std::make_unique<URenderer>(&RHIDevice);
+    }
 
     //매니저 초기화
-    UI.Initialize(HWnd, RHIDevice.GetDevice(), RHIDevice.GetDeviceContext());
+    if (!bHeadless)
+    {
+        UI.Initialize(HWnd, RHIDevice.GetDevice(), RHIDevice.GetDeviceContext());
+    }
     INPUT.Initialize(HWnd);
 
     FObjManager::Preload();
@@ -198,12 +210,15 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
     WorldContexts[0].World->Initialize();
     ///////////////////////////////////
 
-    // 슬레이트 매니저 (singleton)
-    FRect ScreenRect(0, 0, ClientWidth, ClientHeight);
-    SLATE.Initialize(RHIDevice.GetDevice(), GWorld, ScreenRect);
+    if (!bHeadless)
+    {
+        // 슬레이트 매니저 (singleton)
+        FRect ScreenRect(0, 0, ClientWidth, ClientHeight);
+        SLATE.Initialize(RHIDevice.GetDevice(), GWorld, ScreenRect);
 
-    //스폰을 위한 월드셋
-    UI.SetWorld(WorldContexts[0].World);
+        //스폰을 위한 월드셋
+        UI.SetWorld(WorldContexts[0].World);
+    }
 
     bRunning = true;
     return true;
@@ -294,30 +309,18 @@ void UEditorEngine::MainLoop()
 
         if (!bRunning) break;
 
-        if (bChangedPieToEditor)
-        {
-            if (GWorld && bPIEActive)
-            {
-                WorldContexts.pop_back();
-                ObjectFactory::DeleteObject(GWorld);
-            }
-
-            GWorld = WorldContexts[0].World;
-            GWorld->GetSelectionManager()->ClearSelection();
-            GWorld->GetLightManager()->SetDirtyFlag();
-            SLATE.SetPIEWorld(GWorld);
-
-            bPIEActive = false;
-            UE_LOG("END PIE CLICKED");
+        ProcessPendingPIEEnd();
 
-            bChangedPieToEditor = false;
-        }
+        // 녹화 중이면 이번 프레임 Tick이 보게 될 입력 상태를 기록
+        FInputRecorder::GetInstance().RecordFrame(DeltaSeconds);
 
         Tick(DeltaSeconds);
         Render();
         
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
         // This ensures all GPU commands are submitted before we check for shader updates
+        // 파일 변경 감시 스레드가 모은 변경을 먼저 전달 (셰이더/스크립트는 바뀐 파일만 다시 로드)
+        FFileChangeService::GetInstance().DispatchChanges();
         UResourceManager::GetInstance().CheckAndReloadShaders(DeltaSeconds);
         UScriptManager::GetInstance().CheckAndHotReloadLuaScript();
 		UScriptManager::GetInstance().UpdateCoroutineState(DeltaSeconds);
@@ -326,8 +329,14 @@ void UEditorEngine::MainLoop()
 
 void UEditorEngine::Shutdown()
 {
+    // 파일 감시 스레드 종료
+    FFileChangeService::GetInstance().Shutdown();
+
     // Release ImGui first (it may hold D3D11 resources)
-    UUIManager::GetInstance().Release();
+    if (!bHeadless)
+    {
+        UUIManager::GetInstance().Release();
+    }
 
     // Delete all UObjects (Components, Actors, Resources)
     // Resource destructors will properly release D3D resources
@@ -350,9 +359,17 @@ void UEditorEngine::Shutdown()
 }
 
 
-void UEditorEngine::StartPIE()
+void UEditorEngine::StartPIE(uint32 InRandomSeed)
 {
     UWorld* EditorWorld = WorldContexts[0].World;
+
+    // 난수 시드를 고정해 두어야 입력 재생 시 같은 결과가 나옴
+    const uint64 Cycles = FPlatformTime::Cycles64();
+    const uint32 RandomSeed = InRandomSeed != 0 ? InRandomSeed : (static_cast<uint32>(Cycles ^ (Cycles >> 32)) | 1u);
+    srand(RandomSeed);
+    UScriptManager::GetInstance().SeedRandom(RandomSeed);
+    FInputRecorder::GetInstance().BeginSession(EditorWorld->GetLevelFilePath(), RandomSeed);
+
     UWorld* PIEWorld = UWorld::DuplicateWorldForPIE(EditorWorld);
 
     GWorld = PIEWorld;
@@ -388,7 +405,14 @@ void UEditorEngine::StartPIE()
     }
 
     // GameHUD에 GameState 설정
-    SLATE.SetPIEWorld(GWorld);
+    if (!bHeadless)
+    {
+        SLATE.SetPIEWorld(GWorld);
+    }
+
+    // ShapeComponent 충돌 등록은 BeginPlay 동안 모아두었다가 BVH 재구축 한 번으로 처리
+    UCollisionManager* CollisionManager = GWorld->GetCollisionManager();
+    if (CollisionManager) CollisionManager->BeginDeferredRegistration();
 
     // Index-based iteration: BeginPlay에서 새 액터가 추가되어도 안전
     const TArray<AActor*>& Actors = GWorld->GetLevel()->GetActors();
@@ -399,15 +423,45 @@ void UEditorEngine::StartPIE()
             Actors[i]->BeginPlay();
         }
     }
+
+    if (CollisionManager) CollisionManager->EndDeferredRegistration();
     UE_LOG("START PIE CLICKED");
 }
 
 void UEditorEngine::EndPIE()
 {
     bChangedPieToEditor = true;
+    FInputRecorder::GetInstance().EndSession();
     
     for (AActor* Actor : GWorld->GetLevel()->GetActors())
     {
         Actor->EndPlay(EEndPlayReason::EndPlayInEditor);
     }
 }
+
+void UEditorEngine::ProcessPendingPIEEnd()
+{
+    if (!bChangedPieToEditor)
+    {
+        return;
+    }
+
+    if (GWorld && bPIEActive)
+    {
+        WorldContexts.pop_back();
+        ObjectFactory::DeleteObject(GWorld);
+    }
+
+    GWorld = WorldContexts[0].World;
+    GWorld->GetSelectionManager()->ClearSelection();
+    GWorld->GetLightManager()->SetDirtyFlag();
+    if (!bHeadless)
+    {
+        SLATE.SetPIEWorld(GWorld);
+    }
+
+    bPIEActive = false;
+    UE_LOG("END PIE CLICKED");
+
+    bChangedPieToEditor = false;
+}
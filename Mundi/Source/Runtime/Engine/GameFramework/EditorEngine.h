@@ -24,13 +24,18 @@ public:
     UEditorEngine();
     ~UEditorEngine();
 
-    bool Startup(HINSTANCE hInstance);
+    // bInHeadless: 창을 표시하지 않고 렌더러/UI/슬레이트 없이 시작 (입력 재생 하네스용)
+    bool Startup(HINSTANCE hInstance, bool bInHeadless = false);
     void MainLoop();
     void Shutdown();
 
-    void StartPIE();
+    // InRandomSeed: srand / math.randomseed에 넣을 값 (0이면 새로 생성, 입력 재생 시 녹화된 값)
+    void StartPIE(uint32 InRandomSeed = 0);
     void EndPIE();
+    // EndPIE 이후 PIE 월드를 정리하고 에디터 월드로 돌아감 (bChangedPieToEditor일 때만)
+    void ProcessPendingPIEEnd();
     bool IsPIEActive() const { return bPIEActive; }
+    bool IsHeadless() const { return bHeadless; }
     
     HWND GetHWND() const { return HWnd; }
     
@@ -69,6 +74,7 @@ private:
     bool bRunning = false;
     bool bUVScrollPaused = true;
     bool bPIEActive = false;
+    bool bHeadless = false;
     float UVScrollTime = 0.0f;
     FVector2D UVScrollSpeed = FVector2D(0.5f, 0.5f);
 
@@ -11,6 +11,9 @@
 #include "AmbientLightComponent.h"
 #include "World.h"
 #include "JsonSerializer.h"
+#include "LevelArchive.h"
+#include "LevelLoader.h"
+#include "PlatformTime.h"
 
 static inline FString RemoveObjExtension(const FString& FileName)
 {
@@ -24,6 +27,49 @@ static inline FString RemoveObjExtension(const FString& FileName)
     return FileName;
 }
 
+namespace
+{
+    struct FPerspectiveCameraData
+    {
+        FVector Location;
+        FVector Rotation;
+        float FOV = 0.0f;
+        float NearClip = 0.0f;
+        float FarClip = 0.0f;
+    };
+
+    void GatherPerspectiveCamera(FPerspectiveCameraData& OutCamData)
+    {
+        const ACameraActor* Camera = UUIManager::GetInstance().GetWorld()->GetCameraActor();
+        if (Camera && Camera->GetCameraComponent())
+        {
+            const UCameraComponent* Cam = Camera->GetCameraComponent();
+            OutCamData.Location = Camera->GetActorLocation();
+            OutCamData.Rotation.X = 0.0f;
+            OutCamData.Rotation.Y = Camera->GetCameraPitch();
+            OutCamData.Rotation.Z = Camera->GetCameraYaw();
+            OutCamData.FOV = Cam->GetFOV();
+            OutCamData.NearClip = Cam->GetNearClip();
+            OutCamData.FarClip = Cam->GetFarClip();
+        }
+    }
+
+    void ApplyPerspectiveCamera(const FPerspectiveCameraData& InCamData)
+    {
+        ACameraActor* CamActor = UUIManager::GetInstance().GetWorld()->GetCameraActor();
+        if (CamActor)
+        {
+            CamActor->SetActorLocation(InCamData.Location);
+            CamActor->SetRotationFromEulerAngles(InCamData.Rotation);
+            if (auto* CamComp = CamActor->GetCameraComponent())
+            {
+                CamComp->SetFOV(InCamData.FOV);
+                CamComp->SetClipPlanes(InCamData.NearClip, InCamData.FarClip);
+            }
+        }
+    }
+}
+
 std::unique_ptr<ULevel> ULevelService::CreateNewLevel()
 {
     std::unique_ptr<ULevel> NewLevel = std::make_unique<ULevel>();
@@ -53,49 +99,32 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
     Super::Serialize(bInIsLoading, InOutHandle);
 
-    struct FPerspectiveCameraData
-    {
-        FVector Location;
-        FVector Rotation;
-        float FOV;
-        float NearClip;
-        float FarClip;
-    };
-
     if (bInIsLoading)
     {
         // 카메라 정보
         JSON PerspectiveCameraData;
         if (FJsonSerializer::ReadObject(InOutHandle, "PerspectiveCamera", PerspectiveCameraData))
         {
-            // 카메라 정보
-            ACameraActor* CamActor = UUIManager::GetInstance().GetWorld()->GetCameraActor();
+            // ReadObject 유틸리티 함수로 해당 뷰포트의 JSON 데이터를 안전하게 가져옴
+            // 유틸리티 함수를 사용하여 반복적인 검사 없이 간결하게 데이터 파싱
+            // 실패 시 각 함수 내부에서 로그를 남기고 기본값을 할당함
             FPerspectiveCameraData CamData;
-            if (CamActor)
-            {
-                // ReadObject 유틸리티 함수로 해당 뷰포트의 JSON 데이터를 안전하게 가져옴
-                // 유틸리티 함수를 사용하여 반복적인 검사 없이 간결하게 데이터 파싱
-                // 실패 시 각 함수 내부에서 로그를 남기고 기본값을 할당함
-                FJsonSerializer::ReadVector(PerspectiveCameraData, "Location", CamData.Location);
-                FJsonSerializer::ReadVector(PerspectiveCameraData, "Rotation", CamData.Rotation);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FOV", CamData.FOV);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "NearClip", CamData.NearClip);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FarClip", CamData.FarClip);
-
-                CamActor->SetActorLocation(CamData.Location);
-                CamActor->SetRotationFromEulerAngles(CamData.Rotation);
-                if (auto* CamComp = CamActor->GetCameraComponent())
-                {
-                    CamComp->SetFOV(CamData.FOV);
-                    CamComp->SetClipPlanes(CamData.NearClip, CamData.FarClip);
-                }
-            }
+            FJsonSerializer::ReadVector(PerspectiveCameraData, "Location", CamData.Location);
+            FJsonSerializer::ReadVector(PerspectiveCameraData, "Rotation", CamData.Rotation);
+            FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FOV", CamData.FOV);
+            FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "NearClip", CamData.NearClip);
+            FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FarClip", CamData.FarClip);
+
+            ApplyPerspectiveCamera(CamData);
         }
 
         // Actors 정보
         JSON ActorListJson;
         if (FJsonSerializer::ReadObject(InOutHandle, "Actors", ActorListJson))
         {
+            const uint32 ActorTotal = static_cast<uint32>(ActorListJson.size());
+            uint32 ActorLoaded = 0;
+
             // ObjectRange()를 사용하여 Primitives 객체의 모든 키-값 쌍을 순회
             for (auto& Pair : ActorListJson.ObjectRange())
             {
@@ -132,6 +161,11 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
                 {
                     NewActor->Serialize(bInIsLoading, ActorDataJson);
                 }
+
+                if (ActorLoadedCallback)
+                {
+                    ActorLoadedCallback(++ActorLoaded, ActorTotal);
+                }
             }
         }
     }
@@ -142,19 +176,8 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         InOutHandle["NextUUID"] = UObject::PeekNextUUID();
 
         // 카메라 정보
-        const ACameraActor* Camera = UUIManager::GetInstance().GetWorld()->GetCameraActor();
         FPerspectiveCameraData CamData;
-        if (Camera && Camera->GetCameraComponent())
-        {
-            const UCameraComponent* Cam = Camera->GetCameraComponent();
-            CamData.Location = Camera->GetActorLocation();
-            CamData.Rotation.X = 0.0f;
-            CamData.Rotation.Y = Camera->GetCameraPitch();
-            CamData.Rotation.Z = Camera->GetCameraYaw();
-            CamData.FOV = Cam->GetFOV();
-            CamData.NearClip = Cam->GetNearClip();
-            CamData.FarClip = Cam->GetFarClip();
-        }
+        GatherPerspectiveCamera(CamData);
 
         JSON CamreaJson = json::Object();
         CamreaJson["Location"] = FJsonSerializer::VectorToJson(CamData.Location);
@@ -179,3 +202,219 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         InOutHandle["Actors"] = ActorListJson;
     }
 }
+
+void ULevel::SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar)
+{
+    Super::SerializeBinary(bInIsLoading, Ar);
+
+    // 카메라 정보
+    FPerspectiveCameraData CamData;
+    if (!bInIsLoading)
+    {
+        GatherPerspectiveCamera(CamData);
+    }
+    Ar << CamData;
+    if (bInIsLoading)
+    {
+        ApplyPerspectiveCamera(CamData);
+    }
+
+    // Actors 정보: [클래스 인덱스][레코드 크기][액터 데이터] 반복
+    uint32 ActorCount = static_cast<uint32>(Actors.size());
+    Ar << ActorCount;
+
+    if (bInIsLoading)
+    {
+        Actors.reserve(Actors.size() + ActorCount);
+        for (uint32 i = 0; i < ActorCount; ++i)
+        {
+            UClass* ActorClass = nullptr;
+            Ar.SerializeClass(ActorClass);
+            const uint64 Record = Ar.BeginRecord();
+
+            // JSON 로드와 달리 레코드 크기를 알고 있으므로 알 수 없는 클래스만 건너뛰고 계속 로드
+            if (!ActorClass || !ActorClass->IsChildOf(AActor::StaticClass()))
+            {
+                UE_LOG("SpawnActor failed: Invalid class in binary level, skipping.");
+                Ar.SkipRecord(Record);
+                continue;
+            }
+
+            AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(ActorClass));
+            if (!NewActor)
+            {
+                UE_LOG("SpawnActor failed: ObjectFactory could not create an instance of %s", ActorClass->Name);
+                Ar.SkipRecord(Record);
+                continue;
+            }
+
+            AddActor(NewActor);
+            NewActor->SerializeBinary(bInIsLoading, Ar);
+            Ar.EndRecord(Record);
+
+            if (ActorLoadedCallback)
+            {
+                ActorLoadedCallback(i + 1, ActorCount);
+            }
+        }
+    }
+    else
+    {
+        for (AActor* Actor : Actors)
+        {
+            UClass* ActorClass = Actor->GetClass();
+            Ar.SerializeClass(ActorClass);
+            const uint64 Record = Ar.BeginRecord();
+            Actor->SerializeBinary(bInIsLoading, Ar);
+            Ar.EndRecord(Record);
+        }
+    }
+}
+
+ELevelFileFormat ULevelService::GetFormatFromPath(const FString& InFilePath)
+{
+    FString Extension = std::filesystem::path(UTF8ToWide(InFilePath)).extension().string();
+    std::transform(Extension.begin(), Extension.end(), Extension.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return Extension == ".level" ? ELevelFileFormat::Binary : ELevelFileFormat::Json;
+}
+
+bool ULevelService::SaveLevelToFile(ULevel* InLevel, const FString& InFilePath, ELevelFileFormat InFormat)
+{
+    if (!InLevel)
+    {
+        return false;
+    }
+
+    if (InFormat == ELevelFileFormat::Binary)
+    {
+        FLevelArchive Ar(false);
+        InLevel->SerializeBinary(false, Ar);
+        return Ar.SaveToFile(InFilePath);
+    }
+
+    JSON LevelJson;
+    InLevel->Serialize(false, LevelJson);
+    return FJsonSerializer::SaveJsonToFile(LevelJson, InFilePath);
+}
+
+std::unique_ptr<ULevel> ULevelService::LoadLevelFromFile(const FString& InFilePath)
+{
+    FLevelLoader Loader;
+    return Loader.Load(InFilePath);
+}
+
+bool ULevelService::ConvertLevelFile(const FString& InSourcePath, const FString& InDestPath)
+{
+    // 주의: 레벨 로드는 에디터 카메라를 파일에 저장된 값으로 옮김 (저장 시 같은 값이 다시 기록됨)
+    std::unique_ptr<ULevel> Level = LoadLevelFromFile(InSourcePath);
+    if (!Level)
+    {
+        return false;
+    }
+
+    const ELevelFileFormat DestFormat = GetFormatFromPath(InDestPath);
+    const bool bSuccess = SaveLevelToFile(Level.get(), InDestPath, DestFormat);
+    UE_LOG("LevelService: Convert '%s' -> '%s' (%s, %d actors) %s", InSourcePath.c_str(), InDestPath.c_str(),
+        DestFormat == ELevelFileFormat::Binary ? "binary" : "json", Level->GetActors().Num(), bSuccess ? "succeeded" : "failed");
+
+    DestroyLevelActors(Level.get());
+    return bSuccess;
+}
+
+void ULevelService::DestroyLevelActors(ULevel* InLevel)
+{
+    for (AActor* Actor : InLevel->GetActors())
+    {
+        ObjectFactory::DeleteObject(Actor);
+    }
+    InLevel->Clear();
+}
+
+void ULevelService::BenchmarkLevelSerialization(ULevel* InLevel, uint32 InIterations)
+{
+    if (!InLevel || InIterations == 0)
+    {
+        return;
+    }
+
+    struct FFormatTimings
+    {
+        double SaveMs = 0.0;
+        double LoadMs = 0.0;
+        uint64 Bytes = 0;
+    };
+    FFormatTimings JsonTimings;
+    FFormatTimings BinaryTimings;
+
+    // 파일 I/O를 제외한 직렬화 비용만 측정 (메모리 상의 텍스트/바이트 이미지 사용)
+    // 에셋은 첫 로드 이후 ResourceManager 캐시에 남으므로 반복 측정에서는 파싱/오브젝트 생성 비용이 주가 됨
+    for (uint32 Iteration = 0; Iteration < InIterations; ++Iteration)
+    {
+        // JSON
+        uint64 StartCycles = FPlatformTime::Cycles64();
+        JSON LevelJson;
+        InLevel->Serialize(false, LevelJson);
+        const FString JsonText = LevelJson.dump();
+        JsonTimings.SaveMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+        JsonTimings.Bytes = JsonText.size();
+
+        StartCycles = FPlatformTime::Cycles64();
+        {
+            std::unique_ptr<ULevel> LoadedLevel = CreateDefaultLevel();
+            JSON LoadedJson = JSON::Load(JsonText);
+            LoadedLevel->Serialize(true, LoadedJson);
+            JsonTimings.LoadMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+            DestroyLevelActors(LoadedLevel.get());
+        }
+
+        // Binary
+        StartCycles = FPlatformTime::Cycles64();
+        TArray<uint8> BinaryImage;
+        {
+            FLevelArchive SaveAr(false);
+            InLevel->SerializeBinary(false, SaveAr);
+            SaveAr.WriteFileImage(BinaryImage);
+        }
+        BinaryTimings.SaveMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+        BinaryTimings.Bytes = BinaryImage.size();
+
+        StartCycles = FPlatformTime::Cycles64();
+        {
+            std::unique_ptr<ULevel> LoadedLevel = CreateDefaultLevel();
+            FLevelArchive LoadAr(true);
+            FString Error;
+            if (!LoadAr.ReadFileImage(BinaryImage, &Error))
+            {
+                UE_LOG("LevelService: Benchmark binary image invalid: %s", Error.c_str());
+                return;
+            }
+            LoadedLevel->SerializeBinary(true, LoadAr);
+            BinaryTimings.LoadMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+            DestroyLevelActors(LoadedLevel.get());
+        }
+    }
+
+    const int32 ActorCount = InLevel->GetActors().Num();
+    auto LogFormat = [&](const char* InName, const FFormatTimings& InTimings)
+    {
+        const double SaveMs = InTimings.SaveMs / InIterations;
+        const double LoadMs = InTimings.LoadMs / InIterations;
+        const double MegaBytes = InTimings.Bytes / (1024.0 * 1024.0);
+        UE_LOG("[LevelBench] %-6s | %8.2f MB | save %9.2f ms (%7.1f MB/s) | load %9.2f ms (%7.1f MB/s, %9.0f actors/s)",
+            InName, MegaBytes,
+            SaveMs, SaveMs > 0.0 ? MegaBytes / (SaveMs / 1000.0) : 0.0,
+            LoadMs, LoadMs > 0.0 ? MegaBytes / (LoadMs / 1000.0) : 0.0,
+            LoadMs > 0.0 ? ActorCount / (LoadMs / 1000.0) : 0.0);
+    };
+
+    UE_LOG("[LevelBench] %d actors, %u iterations (in-memory, excluding file I/O)", ActorCount, InIterations);
+    LogFormat("JSON", JsonTimings);
+    LogFormat("Binary", BinaryTimings);
+    if (BinaryTimings.LoadMs > 0.0 && BinaryTimings.Bytes > 0)
+    {
+        UE_LOG("[LevelBench] Binary vs JSON: load x%.1f faster, save x%.1f faster, %.1f%% of the size",
+            JsonTimings.LoadMs / BinaryTimings.LoadMs, JsonTimings.SaveMs / BinaryTimings.SaveMs,
+            100.0 * BinaryTimings.Bytes / JsonTimings.Bytes);
+    }
+}
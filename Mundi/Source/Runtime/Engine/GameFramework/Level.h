@@ -3,6 +3,7 @@
 #include "UEContainer.h"
 #include "Actor.h"
 #include <algorithm>
+#include <functional>
 
 class ULevel : public UObject
 {
@@ -23,8 +24,22 @@ public:
     void Clear() { Actors.Empty(); }
 
     void Serialize(const bool bInIsLoading, JSON& InOutHandle);
+    void SerializeBinary(const bool bInIsLoading, FLevelArchive& Ar);
+
+    // 로드 중 액터 하나를 역직렬화할 때마다 (완료 수, 전체 수)로 호출 (FLevelLoader 진행률 보고용)
+    using FActorLoadedCallback = std::function<void(uint32, uint32)>;
+    void SetActorLoadedCallback(FActorLoadedCallback InCallback) { ActorLoadedCallback = std::move(InCallback); }
+
 private:
     TArray<AActor*> Actors;
+    FActorLoadedCallback ActorLoadedCallback;
+};
+
+// 레벨 파일 포맷. JSON(.scene)은 사람이 읽을 수 있는 교환 포맷, Binary(.level)는 빠른 로드/저장용
+enum class ELevelFileFormat : uint8
+{
+    Json,
+    Binary,
 };
 
 class ULevelService
@@ -33,4 +48,20 @@ public:
     // Create a new empty level
     static std::unique_ptr<ULevel> CreateNewLevel();
     static std::unique_ptr<ULevel> CreateDefaultLevel();
+
+    // 확장자가 .level이면 Binary, 그 외는 Json
+    static ELevelFileFormat GetFormatFromPath(const FString& InFilePath);
+
+    static bool SaveLevelToFile(ULevel* InLevel, const FString& InFilePath, ELevelFileFormat InFormat);
+    // 파일 내용(매직 넘버)으로 포맷을 판별해 로드. 실패 시 nullptr
+    static std::unique_ptr<ULevel> LoadLevelFromFile(const FString& InFilePath);
+
+    // JSON ↔ Binary 변환 (원본을 임시 레벨로 로드한 뒤 대상 포맷으로 저장)
+    static bool ConvertLevelFile(const FString& InSourcePath, const FString& InDestPath);
+
+    // 현재 레벨을 두 포맷으로 메모리 상에서 반복 저장/로드하여 처리량을 로그로 출력
+    static void BenchmarkLevelSerialization(ULevel* InLevel, uint32 InIterations = 5);
+
+    // 월드에 붙지 않은 임시 레벨의 액터를 삭제하고 비움
+    static void DestroyLevelActors(ULevel* InLevel);
 };
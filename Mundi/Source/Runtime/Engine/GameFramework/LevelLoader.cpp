@@ -0,0 +1,524 @@
+﻿#include "pch.h"
+#include "LevelLoader.h"
+#include "LevelArchive.h"
+#include "AssetRequestQueue.h"
+#include "PlatformTime.h"
+#include "StaticMeshActor.h"
+#include "StaticMeshComponent.h"
+#include "WorldPartitionManager.h"
+#include "ParallelFor.h"
+#include <fstream>
+
+namespace
+{
+    // 단계별 전체 진행률 가중치 (ELevelLoadStage 순서)
+    constexpr float StageWeights[] = { 0.1f, 0.3f, 0.5f, 0.1f };
+
+    // "Actors" 오브젝트 안 액터 레코드 하나의 텍스트 범위 (키는 따옴표 포함)
+    struct FJsonActorRecord
+    {
+        size_t KeyBegin = 0;
+        size_t KeyEnd = 0;
+        size_t ValueBegin = 0;
+        size_t ValueEnd = 0;
+        JSON Value;
+    };
+
+    void SkipJsonWhitespace(const FString& InText, size_t& InOutPos)
+    {
+        while (InOutPos < InText.size() && std::isspace(static_cast<unsigned char>(InText[InOutPos])))
+        {
+            ++InOutPos;
+        }
+    }
+
+    // InOutPos에서 시작하는 값 하나의 끝으로 이동 (문자열과 괄호 깊이만 추적, 값 자체의 검증은 JSON::Load가 함)
+    bool SkipJsonValue(const FString& InText, size_t& InOutPos)
+    {
+        int32 Depth = 0;
+        bool bInString = false;
+        for (size_t Pos = InOutPos; Pos < InText.size(); ++Pos)
+        {
+            const char Ch = InText[Pos];
+            if (bInString)
+            {
+                if (Ch == '\\')
+                {
+                    ++Pos;
+                }
+                else if (Ch == '"')
+                {
+                    bInString = false;
+                    if (Depth == 0)
+                    {
+                        InOutPos = Pos + 1;
+                        return true;
+                    }
+                }
+                continue;
+            }
+
+            switch (Ch)
+            {
+            case '"':
+                bInString = true;
+                break;
+            case '{':
+            case '[':
+                ++Depth;
+                break;
+            case '}':
+            case ']':
+                if (Depth == 0)
+                {
+                    // 숫자/불리언 같은 단순 값을 감싼 오브젝트/배열의 끝
+                    InOutPos = Pos;
+                    return true;
+                }
+                if (--Depth == 0)
+                {
+                    InOutPos = Pos + 1;
+                    return true;
+                }
+                break;
+            case ',':
+                if (Depth == 0)
+                {
+                    InOutPos = Pos;
+                    return true;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * 최상위 오브젝트의 "Actors" 값에서 액터 레코드별 범위를 찾음 (파싱은 하지 않음).
+     * 예상한 모양이 아니면 false (호출 쪽에서 전체를 한 번에 파싱).
+     */
+    bool FindJsonActorRecords(const FString& InText, TArray<FJsonActorRecord>& OutRecords, size_t& OutActorsBegin, size_t& OutActorsEnd)
+    {
+        size_t Pos = 0;
+        SkipJsonWhitespace(InText, Pos);
+        if (Pos >= InText.size() || InText[Pos] != '{')
+        {
+            return false;
+        }
+        ++Pos;
+
+        // 키 문자열과 ':'까지 읽고 값의 시작으로 이동
+        auto ReadKey = [&InText](size_t& InOutPos, size_t& OutKeyBegin, size_t& OutKeyEnd)
+        {
+            SkipJsonWhitespace(InText, InOutPos);
+            if (InOutPos >= InText.size() || InText[InOutPos] != '"')
+            {
+                return false;
+            }
+            OutKeyBegin = InOutPos;
+            if (!SkipJsonValue(InText, InOutPos))
+            {
+                return false;
+            }
+            OutKeyEnd = InOutPos;
+            SkipJsonWhitespace(InText, InOutPos);
+            if (InOutPos >= InText.size() || InText[InOutPos] != ':')
+            {
+                return false;
+            }
+            ++InOutPos;
+            SkipJsonWhitespace(InText, InOutPos);
+            return InOutPos < InText.size();
+        };
+
+        // 다음 멤버로 (',' 소비). 오브젝트 끝이면 '}' 위치에서 false
+        auto NextMember = [&InText](size_t& InOutPos)
+        {
+            SkipJsonWhitespace(InText, InOutPos);
+            if (InOutPos < InText.size() && InText[InOutPos] == ',')
+            {
+                ++InOutPos;
+                return true;
+            }
+            return false;
+        };
+
+        while (true)
+        {
+            SkipJsonWhitespace(InText, Pos);
+            if (Pos >= InText.size() || InText[Pos] == '}')
+            {
+                return false;
+            }
+
+            size_t KeyBegin = 0;
+            size_t KeyEnd = 0;
+            if (!ReadKey(Pos, KeyBegin, KeyEnd))
+            {
+                return false;
+            }
+
+            if (InText.compare(KeyBegin, KeyEnd - KeyBegin, "\"Actors\"") != 0 || InText[Pos] != '{')
+            {
+                if (!SkipJsonValue(InText, Pos) || !NextMember(Pos))
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            OutActorsBegin = Pos++;
+            while (true)
+            {
+                SkipJsonWhitespace(InText, Pos);
+                if (Pos < InText.size() && InText[Pos] == '}')
+                {
+                    OutActorsEnd = Pos + 1;
+                    return true;
+                }
+
+                FJsonActorRecord Record;
+                if (!ReadKey(Pos, Record.KeyBegin, Record.KeyEnd) || InText[Pos] != '{')
+                {
+                    return false;
+                }
+                Record.ValueBegin = Pos;
+                if (!SkipJsonValue(InText, Pos))
+                {
+                    return false;
+                }
+                Record.ValueEnd = Pos;
+                OutRecords.push_back(std::move(Record));
+
+                if (!NextMember(Pos))
+                {
+                    SkipJsonWhitespace(InText, Pos);
+                    if (Pos >= InText.size() || InText[Pos] != '}')
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * JSON 레벨 파일을 읽어 파싱. 액터 레코드는 워커 스레드에서 레코드 단위로 병렬 파싱하고,
+     * 나머지(버전, 카메라 등)만 호출 스레드에서 파싱한 뒤 "Actors"에 옮겨 담음.
+     */
+    bool LoadJsonLevelFile(const FString& InFilePath, JSON& OutLevelJson, uint32& OutParsedRecordCount)
+    {
+        OutParsedRecordCount = 0;
+        std::ifstream File(UTF8ToWide(InFilePath), std::ios::binary);
+        if (!File.is_open())
+        {
+            return false;
+        }
+        const FString Text((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+        File.close();
+
+        TArray<FJsonActorRecord> Records;
+        size_t ActorsBegin = 0;
+        size_t ActorsEnd = 0;
+        if (!FindJsonActorRecords(Text, Records, ActorsBegin, ActorsEnd))
+        {
+            // 예상과 다른 모양 (수동 편집 등): 전체를 한 번에 파싱
+            OutLevelJson = JSON::Load(Text);
+            return OutLevelJson.JSONType() == JSON::Class::Object;
+        }
+
+        ParallelFor(Records.Num(), [&Text, &Records](int32 Index)
+        {
+            FJsonActorRecord& Record = Records[Index];
+            Record.Value = JSON::Load(Text.substr(Record.ValueBegin, Record.ValueEnd - Record.ValueBegin));
+        }, 16);
+
+        OutLevelJson = JSON::Load(Text.substr(0, ActorsBegin) + "{}" + Text.substr(ActorsEnd));
+        if (OutLevelJson.JSONType() != JSON::Class::Object)
+        {
+            return false;
+        }
+
+        JSON& ActorListJson = OutLevelJson["Actors"];
+        for (FJsonActorRecord& Record : Records)
+        {
+            if (Record.Value.JSONType() != JSON::Class::Object)
+            {
+                return false;
+            }
+            const JSON Key = JSON::Load(Text.substr(Record.KeyBegin, Record.KeyEnd - Record.KeyBegin));
+            ActorListJson[Key.ToString()] = std::move(Record.Value);
+        }
+        OutParsedRecordCount = static_cast<uint32>(Records.Num());
+        return true;
+    }
+
+    // JSON 트리의 모든 문자열 값에서 에셋 경로 수집
+    void GatherJsonAssetPaths(const JSON& InJson, FAssetRequestQueue& InOutQueue)
+    {
+        switch (InJson.JSONType())
+        {
+        case JSON::Class::String:
+            InOutQueue.Request(InJson.ToString());
+            break;
+        case JSON::Class::Object:
+            for (const auto& Pair : InJson.ObjectRange())
+            {
+                GatherJsonAssetPaths(Pair.second, InOutQueue);
+            }
+            break;
+        case JSON::Class::Array:
+            for (const JSON& Element : InJson.ArrayRange())
+            {
+                GatherJsonAssetPaths(Element, InOutQueue);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+FLevelLoader::FLevelLoader(FLevelLoadProgressCallback InOnProgress)
+    : OnProgress(std::move(InOnProgress))
+{
+}
+
+void FLevelLoader::ReportProgress(ELevelLoadStage InStage, uint32 InCompleted, uint32 InTotal)
+{
+    if (!OnProgress)
+    {
+        return;
+    }
+
+    FLevelLoadProgress Progress;
+    Progress.Stage = InStage;
+    Progress.Completed = InCompleted;
+    Progress.Total = InTotal;
+
+    const uint32 StageIndex = static_cast<uint32>(InStage);
+    for (uint32 i = 0; i < StageIndex && i < std::size(StageWeights); ++i)
+    {
+        Progress.Overall += StageWeights[i];
+    }
+    if (StageIndex < std::size(StageWeights) && InTotal > 0)
+    {
+        Progress.Overall += StageWeights[StageIndex] * (static_cast<float>(InCompleted) / InTotal);
+    }
+    Progress.Overall = std::min(Progress.Overall, 1.0f);
+
+    OnProgress(Progress);
+}
+
+std::unique_ptr<ULevel> FLevelLoader::Load(const FString& InFilePath)
+{
+    Stats = FLevelLoadStats();
+    const uint64 LoadStartCycles = FPlatformTime::Cycles64();
+
+    // 1) 파일 읽기 + 검증/파싱
+    ReportProgress(ELevelLoadStage::ReadFile, 0, 1);
+    uint64 StageStartCycles = FPlatformTime::Cycles64();
+
+    const bool bBinary = FLevelArchive::IsLevelBinaryFile(InFilePath);
+    FLevelArchive Ar(true);
+    JSON LevelJson;
+    if (bBinary)
+    {
+        FString Error;
+        if (!Ar.LoadFromFile(InFilePath, &Error))
+        {
+            UE_LOG("LevelLoader: Failed to load binary level '%s': %s", InFilePath.c_str(), Error.c_str());
+            return nullptr;
+        }
+        if (Ar.GetRemappedClassCount() > 0)
+        {
+            UE_LOG("LevelLoader: %u class layouts differ from the current build, matching properties by name.", Ar.GetRemappedClassCount());
+        }
+    }
+    else
+    {
+        bool bParsed = false;
+        try
+        {
+            bParsed = LoadJsonLevelFile(InFilePath, LevelJson, Stats.ParsedActorRecords);
+        }
+        catch (const std::exception& Exception)
+        {
+            // 워커 스레드의 파싱 예외도 ParallelFor가 여기(호출 스레드)로 전달
+            UE_LOG("LevelLoader: Failed to parse '%s': %s", InFilePath.c_str(), Exception.what());
+        }
+        if (!bParsed)
+        {
+            UE_LOG("LevelLoader: Failed To Load Level From: %s", InFilePath.c_str());
+            return nullptr;
+        }
+    }
+
+    Stats.ReadMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StageStartCycles);
+    ReportProgress(ELevelLoadStage::ReadFile, 1, 1);
+
+    // 2) 참조 에셋 수집(중복 제거) 및 일괄 로드
+    StageStartCycles = FPlatformTime::Cycles64();
+
+    FAssetRequestQueue AssetQueue;
+    if (bBinary)
+    {
+        // 에셋 경로는 모두 문자열 테이블에 한 번씩만 들어있음
+        for (const FString& String : Ar.GetStrings())
+        {
+            AssetQueue.Request(String);
+        }
+    }
+    else
+    {
+        GatherJsonAssetPaths(LevelJson, AssetQueue);
+    }
+    Stats.AssetRequestCount = AssetQueue.GetRequestCount();
+    Stats.UniqueAssetCount = AssetQueue.GetUniqueCount();
+
+    ReportProgress(ELevelLoadStage::LoadAssets, 0, Stats.UniqueAssetCount);
+    AssetQueue.Flush([this](uint32 InCompleted, uint32 InTotal)
+    {
+        ReportProgress(ELevelLoadStage::LoadAssets, InCompleted, InTotal);
+    });
+    Stats.AssetMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StageStartCycles);
+
+    // 3) 액터 생성/역직렬화 (월드 등록 없음)
+    StageStartCycles = FPlatformTime::Cycles64();
+
+    std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
+    NewLevel->SetActorLoadedCallback([this](uint32 InLoaded, uint32 InTotal)
+    {
+        // 진행률 콜백 비용이 액터 수에 비례하지 않도록 256개 단위로 보고
+        if ((InLoaded & 255) == 0 || InLoaded == InTotal)
+        {
+            ReportProgress(ELevelLoadStage::CreateActors, InLoaded, InTotal);
+        }
+    });
+
+    if (bBinary)
+    {
+        try
+        {
+            NewLevel->SerializeBinary(true, Ar);
+        }
+        catch (const std::exception& Exception)
+        {
+            UE_LOG("LevelLoader: Binary level '%s' is corrupt: %s", InFilePath.c_str(), Exception.what());
+            ULevelService::DestroyLevelActors(NewLevel.get());
+            return nullptr;
+        }
+    }
+    else
+    {
+        NewLevel->Serialize(true, LevelJson);
+    }
+    NewLevel->SetActorLoadedCallback(nullptr);
+
+    Stats.ActorMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StageStartCycles);
+    Stats.ActorCount = NewLevel->GetActors().Num();
+    Stats.TotalMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - LoadStartCycles);
+    return NewLevel;
+}
+
+bool FLevelLoader::LoadIntoWorld(UWorld* InWorld, const FString& InFilePath)
+{
+    if (!InWorld)
+    {
+        return false;
+    }
+
+    std::unique_ptr<ULevel> NewLevel = Load(InFilePath);
+    if (!NewLevel)
+    {
+        return false;
+    }
+
+    // 4) 월드 등록: SetLevel이 파티션 BVH에 전체 액터를 한 번에 등록하고 한 번만 재구축
+    ReportProgress(ELevelLoadStage::RegisterActors, 0, 1);
+    const uint64 StageStartCycles = FPlatformTime::Cycles64();
+    InWorld->SetLevel(std::move(NewLevel));
+    InWorld->SetLevelFilePath(InFilePath);
+    Stats.RegisterMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StageStartCycles);
+    Stats.TotalMs += Stats.RegisterMs;
+    ReportProgress(ELevelLoadStage::RegisterActors, 1, 1);
+    ReportProgress(ELevelLoadStage::Finished, 1, 1);
+
+    UE_LOG("LevelLoader: Loaded '%s' (%u actors) in %.2f ms [read %.2f (%u records parsed in parallel) | assets %.2f (%u refs -> %u unique) | actors %.2f | register %.2f]",
+        InFilePath.c_str(), Stats.ActorCount, Stats.TotalMs, Stats.ReadMs, Stats.ParsedActorRecords, Stats.AssetMs,
+        Stats.AssetRequestCount, Stats.UniqueAssetCount, Stats.ActorMs, Stats.RegisterMs);
+    return true;
+}
+
+void FLevelLoader::RunLoadBenchmark(uint32 InActorCount)
+{
+    if (InActorCount == 0)
+    {
+        return;
+    }
+
+    namespace fs = std::filesystem;
+    fs::create_directories("Scene");
+
+    const FString BasePath = "Scene/__LoadBenchmark_" + std::to_string(InActorCount);
+    const FString JsonPath = BasePath + ".scene";
+    const FString BinaryPath = BasePath + ".level";
+
+    // 1) 격자 배치된 스태틱 메시 액터로 임시 레벨을 만들어 두 포맷으로 저장
+    {
+        const FString MeshPath = GDataDir + "/cube-tex.obj";
+        const uint32 GridSize = static_cast<uint32>(std::ceil(std::sqrt(static_cast<double>(InActorCount))));
+
+        std::unique_ptr<ULevel> SourceLevel = ULevelService::CreateNewLevel();
+        for (uint32 i = 0; i < InActorCount; ++i)
+        {
+            AStaticMeshActor* Actor = NewObject<AStaticMeshActor>();
+            Actor->GetStaticMeshComponent()->SetStaticMesh(MeshPath);
+            Actor->SetActorLocation(FVector((i % GridSize) * 3.0f, (i / GridSize) * 3.0f, 0.0f));
+            SourceLevel->AddActor(Actor);
+        }
+
+        const bool bSaved = ULevelService::SaveLevelToFile(SourceLevel.get(), JsonPath, ELevelFileFormat::Json)
+            && ULevelService::SaveLevelToFile(SourceLevel.get(), BinaryPath, ELevelFileFormat::Binary);
+        ULevelService::DestroyLevelActors(SourceLevel.get());
+
+        if (!bSaved)
+        {
+            UE_LOG("[LevelLoadBench] Failed to write benchmark levels to %s.*", BasePath.c_str());
+            return;
+        }
+    }
+
+    // 2) 단계별 로더로 로드 + 별도 파티션에 일괄 등록 (현재 월드 레벨은 건드리지 않음)
+    const FString Paths[] = { JsonPath, BinaryPath };
+    for (const FString& Path : Paths)
+    {
+        FLevelLoader Loader;
+        std::unique_ptr<ULevel> Level = Loader.Load(Path);
+        if (!Level)
+        {
+            continue;
+        }
+
+        UWorldPartitionManager* Partition = NewObject<UWorldPartitionManager>();
+        const uint64 RegisterStartCycles = FPlatformTime::Cycles64();
+        Partition->BulkRegister(Level->GetActors());
+        const double RegisterMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - RegisterStartCycles);
+        ObjectFactory::DeleteObject(Partition);
+
+        const FLevelLoadStats& Stats = Loader.GetStats();
+        const double TotalMs = Stats.TotalMs + RegisterMs;
+        UE_LOG("[LevelLoadBench] %6u actors | %-6s | %.1f MB | read %8.2f ms | assets %7.2f ms (%u refs -> %u unique) | actors %9.2f ms | register %8.2f ms | total %9.2f ms (%.0f actors/s)",
+            InActorCount, Path == BinaryPath ? "Binary" : "JSON",
+            fs::file_size(Path) / (1024.0 * 1024.0),
+            Stats.ReadMs, Stats.AssetMs, Stats.AssetRequestCount, Stats.UniqueAssetCount,
+            Stats.ActorMs, RegisterMs, TotalMs, TotalMs > 0.0 ? Stats.ActorCount / (TotalMs / 1000.0) : 0.0);
+
+        ULevelService::DestroyLevelActors(Level.get());
+    }
+
+    fs::remove(JsonPath);
+    fs::remove(BinaryPath);
+}
@@ -0,0 +1,71 @@
+﻿#pragma once
+#include "Level.h"
+#include <functional>
+
+class UWorld;
+
+// 단계별 레벨 로드 (순서대로 진행)
+enum class ELevelLoadStage : uint8
+{
+    ReadFile,       // 파일 읽기 + 검증/파싱 (JSON은 액터 레코드 단위 병렬 파싱, 바이너리 CRC 검사)
+    LoadAssets,     // 참조 에셋 수집(중복 제거) 후 일괄 로드 (메시 CPU 로드는 병렬)
+    CreateActors,   // 액터/컴포넌트 생성 및 역직렬화 (파티션/충돌 등록 없음)
+    RegisterActors, // 월드에 붙이며 파티션 BVH 일괄 등록 + 1회 재구축
+    Finished,
+};
+
+struct FLevelLoadProgress
+{
+    ELevelLoadStage Stage = ELevelLoadStage::ReadFile;
+    uint32 Completed = 0;   // 현재 단계 진행 수
+    uint32 Total = 0;       // 현재 단계 전체 수 (0이면 알 수 없음)
+    float Overall = 0.0f;   // 전체 진행률 [0, 1] (단계별 가중치 적용)
+};
+
+struct FLevelLoadStats
+{
+    double ReadMs = 0.0;
+    double AssetMs = 0.0;
+    double ActorMs = 0.0;
+    double RegisterMs = 0.0;
+    double TotalMs = 0.0;
+    uint32 ActorCount = 0;
+    uint32 AssetRequestCount = 0;   // 중복 포함 에셋 참조 수
+    uint32 UniqueAssetCount = 0;    // 실제로 로드 요청된 에셋 수
+    uint32 ParsedActorRecords = 0;  // 워커 스레드에서 병렬 파싱한 JSON 액터 레코드 수 (0이면 전체를 한 번에 파싱)
+};
+
+using FLevelLoadProgressCallback = std::function<void(const FLevelLoadProgress&)>;
+
+/**
+ * 단계별 레벨 로더.
+ * 기존 로드는 액터를 하나씩 만들면서 에셋 로드/등록을 그때그때 수행했지만, 여기서는
+ * 에셋을 먼저 중복 없이 일괄 로드하고, 액터 생성 후 월드 등록을 마지막에 한 번에 수행합니다.
+ *
+ * 병렬 처리: JSON 액터 레코드 파싱(텍스트 -> JSON 트리)과 에셋 CPU 로드는 워커 스레드에서 수행합니다.
+ * UObject 생성(GUObjectArray, UUID, FName 풀)과 리소스 매니저는 스레드 안전하지 않으므로
+ * 파싱된 레코드를 액터/컴포넌트에 적용하는 단계는 호출 스레드에서 수행합니다.
+ * (바이너리 레코드는 고정 블록 memcpy라 파싱 단계가 따로 없음)
+ */
+class FLevelLoader
+{
+public:
+    explicit FLevelLoader(FLevelLoadProgressCallback InOnProgress = nullptr);
+
+    // ReadFile ~ CreateActors. 실패 시 nullptr (생성된 액터는 정리됨)
+    std::unique_ptr<ULevel> Load(const FString& InFilePath);
+
+    // Load 후 InWorld->SetLevel()까지 수행 (RegisterActors 단계)
+    bool LoadIntoWorld(UWorld* InWorld, const FString& InFilePath);
+
+    const FLevelLoadStats& GetStats() const { return Stats; }
+
+    // InActorCount개의 스태틱 메시 액터로 임시 레벨을 만들어 두 포맷으로 저장한 뒤 단계별 로드 시간을 로그로 출력
+    static void RunLoadBenchmark(uint32 InActorCount);
+
+private:
+    void ReportProgress(ELevelLoadStage InStage, uint32 InCompleted, uint32 InTotal);
+
+    FLevelLoadProgressCallback OnProgress;
+    FLevelLoadStats Stats;
+};
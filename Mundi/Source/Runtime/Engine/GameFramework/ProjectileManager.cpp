@@ -0,0 +1,374 @@
+﻿#include "pch.h"
+#include "ProjectileManager.h"
+#include "ProjectileMovementComponent.h"
+#include "SceneComponent.h"
+#include "World.h"
+#include "WorldPartitionManager.h"
+#include "PlatformTime.h"
+#include <cmath>
+#include <algorithm>
+
+void FProjectileSoA::SetNum(int32 InNum)
+{
+	const size_t Count = static_cast<size_t>(InNum);
+	VelocityX.resize(Count); VelocityY.resize(Count); VelocityZ.resize(Count);
+	AccelerationX.resize(Count); AccelerationY.resize(Count); AccelerationZ.resize(Count);
+	Gravity.resize(Count);
+	MaxSpeed.resize(Count);
+	Lifespan.resize(Count);
+	Lifetime.resize(Count);
+	DeltaX.resize(Count); DeltaY.resize(Count); DeltaZ.resize(Count);
+	bExpired.resize(Count);
+}
+
+void IntegrateProjectiles(FProjectileSoA& InOutSoA, float InDeltaTime)
+{
+	const int32 Count = InOutSoA.Num();
+
+	float* __restrict VelX = InOutSoA.VelocityX.data();
+	float* __restrict VelY = InOutSoA.VelocityY.data();
+	float* __restrict VelZ = InOutSoA.VelocityZ.data();
+	const float* __restrict AccX = InOutSoA.AccelerationX.data();
+	const float* __restrict AccY = InOutSoA.AccelerationY.data();
+	const float* __restrict AccZ = InOutSoA.AccelerationZ.data();
+	const float* __restrict Gravity = InOutSoA.Gravity.data();
+	const float* __restrict MaxSpeed = InOutSoA.MaxSpeed.data();
+	const float* __restrict Lifespan = InOutSoA.Lifespan.data();
+	float* __restrict Lifetime = InOutSoA.Lifetime.data();
+	float* __restrict DeltaX = InOutSoA.DeltaX.data();
+	float* __restrict DeltaY = InOutSoA.DeltaY.data();
+	float* __restrict DeltaZ = InOutSoA.DeltaZ.data();
+	uint8* __restrict Expired = InOutSoA.bExpired.data();
+
+	// 개별 틱과 같은 순서: 수명 -> 중력 -> 가속도 -> 속도 제한 -> 이동량. 수명이 끝난 발사체는 속도를 바꾸지 않고 멈춤
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const float Span = Lifespan[i];
+		const float Life = Lifetime[i] + (Span > 0.0f ? InDeltaTime : 0.0f);
+		const bool bDone = Span > 0.0f && Life >= Span;
+		Lifetime[i] = Life;
+		Expired[i] = bDone ? 1 : 0;
+
+		float Vx = VelX[i] + AccX[i] * InDeltaTime;
+		float Vy = VelY[i] + AccY[i] * InDeltaTime;
+		float Vz = VelZ[i] + (Gravity[i] + AccZ[i]) * InDeltaTime;
+
+		const float SpeedSq = Vx * Vx + Vy * Vy + Vz * Vz;
+		const float Max = MaxSpeed[i];
+		const float Scale = (Max > 0.0f && SpeedSq > Max * Max) ? Max / std::sqrt(SpeedSq) : 1.0f;
+		Vx = bDone ? VelX[i] : Vx * Scale;
+		Vy = bDone ? VelY[i] : Vy * Scale;
+		Vz = bDone ? VelZ[i] : Vz * Scale;
+		VelX[i] = Vx;
+		VelY[i] = Vy;
+		VelZ[i] = Vz;
+
+		const float MoveTime = bDone ? 0.0f : InDeltaTime;
+		DeltaX[i] = Vx * MoveTime;
+		DeltaY[i] = Vy * MoveTime;
+		DeltaZ[i] = Vz * MoveTime;
+	}
+}
+
+void FProjectileManager::FBatchTickFunction::ExecuteTick(float DeltaTime)
+{
+	Manager->Tick(DeltaTime);
+}
+
+bool FProjectileManager::FBatchTickFunction::ShouldTick() const
+{
+	return Manager->World && Manager->World->bPie;
+}
+
+FProjectileManager::FProjectileManager(UWorld* InWorld)
+	: World(InWorld)
+{
+	BatchTickFunction.Manager = this;
+	BatchTickFunction.SetTickGroup(ETickingGroup::PrePhysics);
+	if (World && World->GetTickManager())
+	{
+		BatchTickFunction.RegisterTickFunction(World->GetTickManager());
+	}
+}
+
+FProjectileManager::~FProjectileManager()
+{
+	// 등록된 컴포넌트는 월드가 액터를 지울 때 EndPlay에서 먼저 빠짐
+	BatchTickFunction.UnregisterTickFunction();
+}
+
+void FProjectileManager::RegisterProjectile(UProjectileMovementComponent* InComponent)
+{
+	if (!InComponent || InComponent->BatchIndex >= 0)
+	{
+		return;
+	}
+
+	// 틱 도중 등록되면 다음 프레임부터 갱신 (이번 프레임 SoA에는 없음)
+	InComponent->BatchIndex = Projectiles.Num();
+	Projectiles.Add(InComponent);
+}
+
+void FProjectileManager::UnregisterProjectile(UProjectileMovementComponent* InComponent)
+{
+	if (!InComponent || InComponent->BatchIndex < 0)
+	{
+		return;
+	}
+
+	const int32 Slot = InComponent->BatchIndex;
+	InComponent->BatchIndex = -1;
+	if (Slot >= Projectiles.Num() || Projectiles[Slot] != InComponent)
+	{
+		return;
+	}
+
+	if (bTicking)
+	{
+		// 처리 중인 슬롯 순서를 유지하고 틱이 끝난 뒤 정리
+		Projectiles[Slot] = nullptr;
+		bHasRemovedSlots = true;
+		return;
+	}
+
+	UProjectileMovementComponent* Last = Projectiles.back();
+	Projectiles[Slot] = Last;
+	Last->BatchIndex = Slot;
+	Projectiles.pop_back();
+}
+
+void FProjectileManager::CompactProjectiles()
+{
+	int32 WriteIndex = 0;
+	for (int32 ReadIndex = 0; ReadIndex < Projectiles.Num(); ++ReadIndex)
+	{
+		UProjectileMovementComponent* Component = Projectiles[ReadIndex];
+		if (!Component)
+		{
+			continue;
+		}
+		Component->BatchIndex = WriteIndex;
+		Projectiles[WriteIndex++] = Component;
+	}
+	Projectiles.resize(WriteIndex);
+	bHasRemovedSlots = false;
+}
+
+void FProjectileManager::Tick(float DeltaTime)
+{
+	Stats.Simulated = 0;
+	Stats.Swept = 0;
+	Stats.Hits = 0;
+	Stats.Expired = 0;
+	Stats.IntegrateMs = 0.0;
+	Stats.MoveMs = 0.0;
+
+	if (!Projectiles.IsEmpty())
+	{
+		bTicking = true;
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		// 1. 활성 발사체 상태를 SoA로 모음 (호밍은 타겟 위치를 읽어야 해서 여기서 가속도 갱신)
+		FrameSlots.Empty();
+		for (int32 Slot = 0; Slot < Projectiles.Num(); ++Slot)
+		{
+			UProjectileMovementComponent* Component = Projectiles[Slot];
+			if (Component && Component->bIsActive && Component->UpdatedComponent)
+			{
+				FrameSlots.Add(Slot);
+			}
+		}
+
+		const int32 Count = FrameSlots.Num();
+		SoA.SetNum(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			UProjectileMovementComponent* Component = Projectiles[FrameSlots[i]];
+			if (Component->bIsHomingProjectile)
+			{
+				Component->ComputeHomingAcceleration(DeltaTime);
+			}
+
+			SoA.VelocityX[i] = Component->Velocity.X;
+			SoA.VelocityY[i] = Component->Velocity.Y;
+			SoA.VelocityZ[i] = Component->Velocity.Z;
+			SoA.AccelerationX[i] = Component->Acceleration.X;
+			SoA.AccelerationY[i] = Component->Acceleration.Y;
+			SoA.AccelerationZ[i] = Component->Acceleration.Z;
+			SoA.Gravity[i] = Component->Gravity;
+			SoA.MaxSpeed[i] = Component->MaxSpeed;
+			SoA.Lifespan[i] = Component->ProjectileLifespan;
+			SoA.Lifetime[i] = Component->CurrentLifetime;
+		}
+
+		// 2. 전체 적분
+		IntegrateProjectiles(SoA, DeltaTime);
+		const uint64 IntegratedCycles = FPlatformTime::Cycles64();
+
+		// 3. 등록 순서대로 스윕/충돌 반응/위치 반영.
+		//    충돌 이벤트 핸들러가 다른 발사체를 멈추거나 풀로 돌려보낼 수 있으므로 매번 슬롯을 다시 확인
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const int32 Slot = FrameSlots[i];
+			UProjectileMovementComponent* Component = Projectiles[Slot];
+			if (!Component || !Component->bIsActive)
+			{
+				continue;
+			}
+
+			Component->Velocity = FVector(SoA.VelocityX[i], SoA.VelocityY[i], SoA.VelocityZ[i]);
+			Component->CurrentLifetime = SoA.Lifetime[i];
+			++Stats.Simulated;
+
+			if (SoA.bExpired[i])
+			{
+				++Stats.Expired;
+				Component->HandleLifespanExpired();
+			}
+			else
+			{
+				if (Component->bSweepCollision)
+				{
+					++Stats.Swept;
+				}
+				Stats.Hits += Component->MoveWithCollision(FVector(SoA.DeltaX[i], SoA.DeltaY[i], SoA.DeltaZ[i]), DeltaTime);
+			}
+
+			// 할 일이 없으면 배치에서 빠짐 (FireInDirection/SetVelocity 등으로 다시 등록)
+			if (Projectiles[Slot] == Component && Component->IsIdle())
+			{
+				Component->SleepSimulation();
+			}
+		}
+
+		bTicking = false;
+		if (bHasRemovedSlots)
+		{
+			CompactProjectiles();
+		}
+
+		const uint64 EndCycles = FPlatformTime::Cycles64();
+		Stats.IntegrateMs = FPlatformTime::ToMilliseconds(IntegratedCycles - StartCycles);
+		Stats.MoveMs = FPlatformTime::ToMilliseconds(EndCycles - IntegratedCycles);
+	}
+
+	Stats.Registered = static_cast<uint32>(Projectiles.Num());
+	Stats.PooledFree = static_cast<uint32>(ParkedActors.Num());
+}
+
+AActor* FProjectileManager::AcquireProjectileActor(UClass* InClass, const FTransform& InTransform)
+{
+	if (!World || !InClass)
+	{
+		return nullptr;
+	}
+
+	if (TArray<AActor*>* FreeList = FreeActors.Find(InClass))
+	{
+		if (!FreeList->IsEmpty())
+		{
+			AActor* Actor = FreeList->back();
+			FreeList->pop_back();
+			ParkedActors.Remove(Actor);
+
+			// ParkActor에서 끈 것들을 되돌림 (충돌은 새 위치로 옮긴 뒤 다시 등록)
+			Actor->SetActorTransform(InTransform);
+			Actor->SetActorHiddenInGame(false);
+			Actor->SetActorTickEnabled(true);
+			Actor->SetActorEnableCollision(true);
+			World->GetPartitionManager()->Register(Actor);
+			return Actor;
+		}
+	}
+
+	AActor* Actor = World->SpawnActor(InClass, InTransform);
+	if (!Actor)
+	{
+		return nullptr;
+	}
+	PooledActors.Add(Actor);
+
+	// 런타임 스폰이므로 직접 게임 수명 시작
+	if (World->bPie)
+	{
+		Actor->BeginPlay();
+	}
+	return Actor;
+}
+
+bool FProjectileManager::ReleaseProjectileActor(AActor* InActor)
+{
+	if (!InActor || !PooledActors.Contains(InActor))
+	{
+		return false;
+	}
+	if (ParkedActors.Contains(InActor))
+	{
+		return true;
+	}
+
+	ParkActor(InActor);
+	return true;
+}
+
+void FProjectileManager::PrewarmProjectileActors(UClass* InClass, int32 InCount)
+{
+	if (!World || !InClass)
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < InCount; ++i)
+	{
+		AActor* Actor = World->SpawnActor(InClass, FTransform());
+		if (!Actor)
+		{
+			return;
+		}
+		PooledActors.Add(Actor);
+		if (World->bPie)
+		{
+			Actor->BeginPlay();
+		}
+		ParkActor(Actor);
+	}
+}
+
+void FProjectileManager::ParkActor(AActor* InActor)
+{
+	// 발사체는 멈추고 배치에서 빠짐 (다시 쓸 때 FireInDirection으로 재시작)
+	for (UActorComponent* Component : InActor->GetOwnedComponents())
+	{
+		if (UProjectileMovementComponent* Projectile = Cast<UProjectileMovementComponent>(Component))
+		{
+			Projectile->StopSimulating();
+			Projectile->CurrentLifetime = 0.0f;
+		}
+	}
+
+	// 숨기고 월드 파티션/CollisionManager에서 빼서 렌더링/피킹/스윕/Overlap 대상에서 제외,
+	// 스크립트와 나머지 컴포넌트 틱도 멈춤
+	InActor->SetActorHiddenInGame(true);
+	InActor->SetActorTickEnabled(false);
+	InActor->SetActorEnableCollision(false);
+	World->GetPartitionManager()->Unregister(InActor);
+
+	FreeActors[InActor->GetClass()].Add(InActor);
+	ParkedActors.Add(InActor);
+}
+
+void FProjectileManager::OnActorDestroyed(AActor* InActor)
+{
+	if (!PooledActors.Remove(InActor))
+	{
+		return;
+	}
+
+	if (ParkedActors.Remove(InActor))
+	{
+		if (TArray<AActor*>* FreeList = FreeActors.Find(InActor->GetClass()))
+		{
+			FreeList->erase(std::remove(FreeList->begin(), FreeList->end(), InActor), FreeList->end());
+		}
+	}
+}
@@ -0,0 +1,118 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "TickManager.h"
+
+class UWorld;
+class AActor;
+struct UClass;
+class UProjectileMovementComponent;
+struct FTransform;
+
+/**
+ * 발사체 한 프레임 적분용 SoA 배열.
+ * 입력(속도/가속도/중력/최대 속도/수명)을 채운 뒤 IntegrateProjectiles를 부르면 속도/생존 시간이 갱신되고
+ * 이번 프레임 이동량(Delta)과 수명 종료 여부가 채워집니다. 엔진 상태와 무관해 단독으로 검증할 수 있습니다.
+ */
+struct FProjectileSoA
+{
+	TArray<float> VelocityX, VelocityY, VelocityZ;
+	TArray<float> AccelerationX, AccelerationY, AccelerationZ;	// 중력 제외 (호밍 포함)
+	TArray<float> Gravity;
+	TArray<float> MaxSpeed;				// 0이면 제한 없음
+	TArray<float> Lifespan;				// 0이면 무제한
+	TArray<float> Lifetime;
+
+	// 출력
+	TArray<float> DeltaX, DeltaY, DeltaZ;
+	TArray<uint8> bExpired;				// 수명이 끝나 이번 프레임에 움직이지 않음
+
+	int32 Num() const { return Gravity.Num(); }
+	void SetNum(int32 InNum);
+};
+
+// 모든 발사체를 한 루프로 적분 (분기 없는 float 배열 연산이라 컴파일러가 벡터화)
+void IntegrateProjectiles(FProjectileSoA& InOutSoA, float InDeltaTime);
+
+struct FProjectileBatchStats
+{
+	uint32 Registered = 0;
+	uint32 Simulated = 0;				// 지난 프레임 적분한 수
+	uint32 Swept = 0;					// 그중 충돌 스윕을 한 수
+	uint32 Hits = 0;
+	uint32 Expired = 0;
+	uint32 PooledFree = 0;				// 풀에서 대기 중인 액터
+	double IntegrateMs = 0.0;
+	double MoveMs = 0.0;				// 스윕 + 충돌 반응 + 위치 반영
+};
+
+/**
+ * 월드별 발사체 매니저.
+ * bUseBatchedUpdate인 발사체 무브먼트 컴포넌트는 개별 틱 대신 여기 등록되고, PrePhysics 그룹의 틱 함수 하나가
+ * 상태를 SoA로 모아 한 번에 적분한 뒤 등록 순서대로 스윕/충돌 반응/위치 반영을 합니다 (충돌 이벤트 순서가 매 실행 같음).
+ * 유휴(정지/비활성) 발사체는 등록이 해제되고 발사/속도 설정 시 다시 등록됩니다.
+ *
+ * 발사체 액터 풀도 관리합니다. 풀에서 꺼낸 액터는 수명 종료/정지 시 파괴 대신 숨겨지고 월드 파티션에서 빠진 채 대기했다가
+ * 다음 AcquireProjectileActor에서 재사용되므로 총알이 많은 장면에서 액터 생성/삭제가 반복되지 않습니다.
+ */
+class FProjectileManager
+{
+public:
+	explicit FProjectileManager(UWorld* InWorld);
+	~FProjectileManager();
+
+	FProjectileManager(const FProjectileManager&) = delete;
+	FProjectileManager& operator=(const FProjectileManager&) = delete;
+
+	void RegisterProjectile(UProjectileMovementComponent* InComponent);
+	void UnregisterProjectile(UProjectileMovementComponent* InComponent);
+
+	void Tick(float DeltaTime);
+
+	// === 액터 풀 ===
+	// 대기 중인 InClass 액터를 InTransform에 다시 놓거나 새로 스폰 (PIE면 BeginPlay까지). 발사는 호출한 쪽에서 FireInDirection
+	AActor* AcquireProjectileActor(UClass* InClass, const FTransform& InTransform);
+
+	// 풀에서 꺼낸 액터를 대기 상태로 돌림 (발사체 정지, 숨김, 파티션 해제). 풀 액터가 아니면 false
+	bool ReleaseProjectileActor(AActor* InActor);
+
+	// 첫 발사 때 스폰 비용이 몰리지 않도록 미리 만들어 둠
+	void PrewarmProjectileActors(UClass* InClass, int32 InCount);
+
+	bool IsPooledActor(const AActor* InActor) const { return PooledActors.Contains(const_cast<AActor*>(InActor)); }
+
+	// 월드가 액터를 파괴할 때 (풀 목록에서 제거)
+	void OnActorDestroyed(AActor* InActor);
+
+	const FProjectileBatchStats& GetStats() const { return Stats; }
+
+private:
+	struct FBatchTickFunction : public FTickFunction
+	{
+		void ExecuteTick(float DeltaTime) override;
+		bool ShouldTick() const override;
+		FString GetDiagnosticName() const override { return "ProjectileBatch"; }
+
+		FProjectileManager* Manager = nullptr;
+	};
+
+	void CompactProjectiles();
+	void ParkActor(AActor* InActor);
+
+	UWorld* World = nullptr;
+	FBatchTickFunction BatchTickFunction;
+
+	// 등록 순서 = 처리 순서. 틱 도중 해제되면 nullptr로 두고 틱이 끝난 뒤 정리
+	TArray<UProjectileMovementComponent*> Projectiles;
+	bool bTicking = false;
+	bool bHasRemovedSlots = false;
+
+	// 이번 프레임 SoA 인덱스 -> Projectiles 슬롯
+	FProjectileSoA SoA;
+	TArray<int32> FrameSlots;
+
+	TMap<UClass*, TArray<AActor*>> FreeActors;
+	TSet<AActor*> PooledActors;			// 풀이 만든 액터 전체 (사용 중 + 대기)
+	TSet<AActor*> ParkedActors;			// 대기 중
+
+	FProjectileBatchStats Stats;
+};
@@ -0,0 +1,250 @@
+﻿#include "pch.h"
+#include "ProjectileManager.h"
+#include "CapsuleSweep.h"
+#include "MeshBVH.h"
+#include "SelfTest.h"
+#include <random>
+
+namespace
+{
+	// 배치 전 UProjectileMovementComponent 개별 틱과 같은 순서로 한 프레임 진행 (기준값)
+	struct FReferenceProjectile
+	{
+		FVector Velocity;
+		FVector Acceleration;
+		float Gravity = 0.0f;
+		float MaxSpeed = 0.0f;
+		float Lifespan = 0.0f;
+		float Lifetime = 0.0f;
+
+		// 수명이 끝나면 true (이번 프레임 이동 없음)
+		bool Step(float InDeltaTime, FVector& OutDelta)
+		{
+			OutDelta = FVector(0.0f, 0.0f, 0.0f);
+			if (Lifespan > 0.0f)
+			{
+				Lifetime += InDeltaTime;
+				if (Lifetime >= Lifespan)
+				{
+					return true;
+				}
+			}
+
+			Velocity.Z += Gravity * InDeltaTime;
+			Velocity += Acceleration * InDeltaTime;
+			if (MaxSpeed > 0.0f && Velocity.Size() > MaxSpeed)
+			{
+				Velocity = Velocity.GetNormalized() * MaxSpeed;
+			}
+			OutDelta = Velocity * InDeltaTime;
+			return false;
+		}
+	};
+
+	// UProjectileMovementComponent::ComputeBounceVelocity와 같은 반사
+	FVector ComputeTestBounceVelocity(const FVector& InVelocity, const FVector& InNormal, float InBounciness, float InFriction)
+	{
+		const float VDotN = FVector::Dot(InVelocity, InNormal);
+		if (VDotN >= 0.0f)
+		{
+			return InVelocity;
+		}
+		const FVector NormalPart = InNormal * VDotN;
+		return (InVelocity - NormalPart) * FMath::Clamp(1.0f - InFriction, 0.0f, 1.0f) - NormalPart * InBounciness;
+	}
+
+	// X = InX 위치의 두께 0 벽 (100 x 100)
+	struct FThinWall
+	{
+		TArray<FNormalVertex> Vertices;
+		TArray<uint32> Indices;
+		FMeshBVH BVH;
+
+		explicit FThinWall(float InX)
+		{
+			const FVector Corners[4] = {
+				FVector(InX, -50.0f, -50.0f), FVector(InX, 50.0f, -50.0f),
+				FVector(InX, 50.0f, 50.0f), FVector(InX, -50.0f, 50.0f) };
+			for (const FVector& Corner : Corners)
+			{
+				FNormalVertex Vertex{};
+				Vertex.pos = Corner;
+				Vertices.Add(Vertex);
+			}
+			for (uint32 Index : { 0u, 1u, 2u, 0u, 2u, 3u })
+			{
+				Indices.Add(Index);
+			}
+			BVH.Build(Vertices, Indices);
+		}
+	};
+}
+
+IMPLEMENT_SELF_TEST(ProjectileManager, IntegrateMatchesPerProjectileTick)
+{
+	std::mt19937 Rng(7);
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+
+	// 중력 유무, 속도 제한 유무, 무제한/유한 수명을 섞음
+	const int32 Count = 2000;
+	FProjectileSoA SoA;
+	SoA.SetNum(Count);
+	TArray<FReferenceProjectile> References;
+	References.resize(Count);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		FReferenceProjectile& Ref = References[i];
+		Ref.Velocity = FVector(Unit(Rng), Unit(Rng), Unit(Rng)) * 50.0f;
+		Ref.Acceleration = FVector(Unit(Rng), Unit(Rng), Unit(Rng)) * 5.0f;
+		Ref.Gravity = (i % 3 != 0) ? -9.8f : 0.0f;
+		Ref.MaxSpeed = (i % 4 == 0) ? 0.0f : 40.0f + Unit(Rng) * 10.0f;
+		Ref.Lifespan = (i % 5 == 0) ? 0.0f : 1.0f + Unit(Rng) * 0.5f;
+
+		SoA.VelocityX[i] = Ref.Velocity.X;
+		SoA.VelocityY[i] = Ref.Velocity.Y;
+		SoA.VelocityZ[i] = Ref.Velocity.Z;
+		SoA.AccelerationX[i] = Ref.Acceleration.X;
+		SoA.AccelerationY[i] = Ref.Acceleration.Y;
+		SoA.AccelerationZ[i] = Ref.Acceleration.Z;
+		SoA.Gravity[i] = Ref.Gravity;
+		SoA.MaxSpeed[i] = Ref.MaxSpeed;
+		SoA.Lifespan[i] = Ref.Lifespan;
+		SoA.Lifetime[i] = 0.0f;
+	}
+
+	const float DeltaTime = 1.0f / 60.0f;
+	TArray<uint8> bDone;
+	bDone.resize(Count, 0);
+	int32 Mismatches = 0;
+	int32 ExpiredCount = 0;
+	for (int32 Frame = 0; Frame < 120; ++Frame)
+	{
+		IntegrateProjectiles(SoA, DeltaTime);
+
+		for (int32 i = 0; i < Count; ++i)
+		{
+			if (bDone[i])
+			{
+				continue;
+			}
+
+			FVector ExpectedDelta;
+			const bool bExpired = References[i].Step(DeltaTime, ExpectedDelta);
+			const FVector Delta(SoA.DeltaX[i], SoA.DeltaY[i], SoA.DeltaZ[i]);
+			const FVector Velocity(SoA.VelocityX[i], SoA.VelocityY[i], SoA.VelocityZ[i]);
+			if (bExpired != (SoA.bExpired[i] != 0) ||
+				(Delta - ExpectedDelta).Size() > 1e-4f ||
+				(Velocity - References[i].Velocity).Size() > 1e-3f)
+			{
+				++Mismatches;
+			}
+
+			if (bExpired)
+			{
+				// 매니저는 수명이 끝난 발사체를 다음 프레임부터 모으지 않으므로 SoA에서도 멈춰 둠
+				bDone[i] = 1;
+				++ExpiredCount;
+				SoA.Lifespan[i] = 0.0f;
+				SoA.Gravity[i] = 0.0f;
+				SoA.VelocityX[i] = SoA.VelocityY[i] = SoA.VelocityZ[i] = 0.0f;
+				SoA.AccelerationX[i] = SoA.AccelerationY[i] = SoA.AccelerationZ[i] = 0.0f;
+			}
+		}
+	}
+
+	Test.AddInfo("%d projectiles x 120 frames, %d expired, %d mismatches", Count, ExpiredCount, Mismatches);
+	SELF_TEST_CHECK(ExpiredCount > 0);
+	SELF_TEST_CHECK(Mismatches == 0);
+}
+
+IMPLEMENT_SELF_TEST(ProjectileManager, ExpiredProjectileKeepsVelocityAndDoesNotMove)
+{
+	FProjectileSoA SoA;
+	SoA.SetNum(1);
+	SoA.VelocityX[0] = 100.0f;
+	SoA.VelocityY[0] = 0.0f;
+	SoA.VelocityZ[0] = 0.0f;
+	SoA.AccelerationX[0] = SoA.AccelerationY[0] = SoA.AccelerationZ[0] = 0.0f;
+	SoA.Gravity[0] = -9.8f;
+	SoA.MaxSpeed[0] = 0.0f;
+	SoA.Lifespan[0] = 0.5f;
+	SoA.Lifetime[0] = 0.49f;
+
+	IntegrateProjectiles(SoA, 0.1f);
+
+	SELF_TEST_CHECK(SoA.bExpired[0] != 0);
+	SELF_TEST_CHECK(SoA.VelocityX[0] == 100.0f && SoA.VelocityZ[0] == 0.0f);
+	SELF_TEST_CHECK(SoA.DeltaX[0] == 0.0f && SoA.DeltaY[0] == 0.0f && SoA.DeltaZ[0] == 0.0f);
+}
+
+IMPLEMENT_SELF_TEST(ProjectileManager, SweptProjectileDoesNotTunnelThinWall)
+{
+	// 한 프레임 이동량(20 ~ 33)이 벽 두께(0)보다 훨씬 커도 스윕이 벽 앞에서 멈추거나 튕겨야 함
+	const float WallX = 10.0f;
+	FThinWall Wall(WallX);
+	std::mt19937 Rng(11);
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+
+	const float DeltaTime = 1.0f / 30.0f;
+	const float SkinWidth = 0.01f;
+	const int32 MaxIterations = 4;
+
+	for (float Radius : { 0.0f, 0.3f })
+	{
+		for (bool bShouldBounce : { false, true })
+		{
+			const FCapsuleShape Shape(Radius, 0.0f);
+			int32 Tunnels = 0;
+			int32 Hits = 0;
+			for (int32 Shot = 0; Shot < 2000; ++Shot)
+			{
+				FVector Location(Unit(Rng) * 5.0f, Unit(Rng) * 20.0f, Unit(Rng) * 20.0f);
+				FVector Velocity(600.0f + Unit(Rng) * 400.0f, Unit(Rng) * 100.0f, Unit(Rng) * 100.0f);
+				bool bStopped = false;
+
+				for (int32 Frame = 0; Frame < 10 && !bStopped; ++Frame)
+				{
+					// UProjectileMovementComponent::MoveWithCollision과 같은 반복 스윕
+					Velocity.Z += -9.8f * DeltaTime;
+					FVector Remaining = Velocity * DeltaTime;
+					float TimeLeft = DeltaTime;
+					for (int32 Iteration = 0; Iteration < MaxIterations && !Remaining.IsZero(); ++Iteration)
+					{
+						FCapsuleSweepHit Hit;
+						if (!Collision::SweepCapsuleMesh(Wall.BVH, FMatrix::Identity(), Location, Remaining, Shape, SkinWidth, Hit))
+						{
+							Location += Remaining;
+							break;
+						}
+
+						++Hits;
+						Location += Hit.bStartPenetrating ? Hit.Normal * Hit.PenetrationDepth : Remaining * Hit.Time;
+						TimeLeft *= (1.0f - Hit.Time);
+						if (!bShouldBounce)
+						{
+							bStopped = true;
+							break;
+						}
+
+						Velocity = ComputeTestBounceVelocity(Velocity, Hit.Normal, 0.6f, 0.2f);
+						if (Velocity.SizeSquared() < 0.05f * 0.05f)
+						{
+							bStopped = true;
+							break;
+						}
+						Remaining = Velocity * TimeLeft;
+					}
+				}
+
+				if (Location.X > WallX - Radius && std::fabs(Location.Y) < 49.0f && std::fabs(Location.Z) < 49.0f)
+				{
+					++Tunnels;
+				}
+			}
+
+			Test.AddInfo("radius %.1f %s: %d hits, %d tunnels", Radius, bShouldBounce ? "bounce" : "stop", Hits, Tunnels);
+			SELF_TEST_CHECK(Hits > 0);
+			SELF_TEST_CHECK(Tunnels == 0);
+		}
+	}
+}
@@ -0,0 +1,292 @@
+﻿#include "pch.h"
+#include "ReplayHarness.h"
+#include "EditorEngine.h"
+#include "LevelLoader.h"
+#include "InputRecording.h"
+#include "PlatformTime.h"
+#include "Source/Runtime/LuaScripting/UScriptManager.h"
+#include <algorithm>
+
+namespace
+{
+    double Percentile(TArray<double>& InSorted, double InFraction)
+    {
+        if (InSorted.IsEmpty())
+        {
+            return 0.0;
+        }
+        const size_t Index = std::min(InSorted.size() - 1, static_cast<size_t>(InFraction * (InSorted.size() - 1) + 0.5));
+        return InSorted[Index];
+    }
+
+    void EnsureParentDirectory(const FString& InPath)
+    {
+        const fs::path Path(UTF8ToWide(InPath));
+        if (Path.has_parent_path())
+        {
+            std::error_code Ec;
+            fs::create_directories(Path.parent_path(), Ec);
+        }
+    }
+}
+
+// 공백으로 구분, 큰따옴표로 묶인 토큰은 공백 포함
+TArray<FString> FReplayOptions::TokenizeCommandLine(const FString& InCommandLine)
+{
+    TArray<FString> Tokens;
+    FString Current;
+    bool bInQuotes = false;
+    bool bHasToken = false;
+    for (char Ch : InCommandLine)
+    {
+        if (Ch == '"')
+        {
+            bInQuotes = !bInQuotes;
+            bHasToken = true;
+        }
+        else if (!bInQuotes && (Ch == ' ' || Ch == '\t'))
+        {
+            if (bHasToken)
+            {
+                Tokens.Add(Current);
+                Current.clear();
+                bHasToken = false;
+            }
+        }
+        else
+        {
+            Current += Ch;
+            bHasToken = true;
+        }
+    }
+    if (bHasToken)
+    {
+        Tokens.Add(Current);
+    }
+    return Tokens;
+}
+
+bool FReplayOptions::ParseCommandLine(const FString& InCommandLine, FReplayOptions& OutOptions)
+{
+    const TArray<FString> Tokens = TokenizeCommandLine(InCommandLine);
+    bool bReplay = false;
+    for (size_t i = 0; i < Tokens.size(); ++i)
+    {
+        const FString& Token = Tokens[i];
+        const bool bHasValue = i + 1 < Tokens.size();
+        if (_stricmp(Token.c_str(), "-replay") == 0 && bHasValue)
+        {
+            OutOptions.RecordingPath = Tokens[++i];
+            bReplay = true;
+        }
+        else if (_stricmp(Token.c_str(), "-level") == 0 && bHasValue)
+        {
+            OutOptions.LevelPath = Tokens[++i];
+        }
+        else if (_stricmp(Token.c_str(), "-out") == 0 && bHasValue)
+        {
+            OutOptions.OutputPath = Tokens[++i];
+        }
+        else if (_stricmp(Token.c_str(), "-dt") == 0 && bHasValue)
+        {
+            const FString& Value = Tokens[++i];
+            OutOptions.FixedDeltaSeconds = _stricmp(Value.c_str(), "recorded") == 0 ? 0.0f : std::max(0.0f, static_cast<float>(atof(Value.c_str())));
+        }
+        else if (_stricmp(Token.c_str(), "-frames") == 0 && bHasValue)
+        {
+            OutOptions.MaxFrames = static_cast<uint32>(strtoul(Tokens[++i].c_str(), nullptr, 10));
+        }
+    }
+    return bReplay;
+}
+
+int32 FReplayHarness::Run(const FReplayOptions& InOptions)
+{
+    FInputRecording Recording;
+    if (!Recording.LoadFromFile(InOptions.RecordingPath))
+    {
+        return 1;
+    }
+
+    const FString LevelPath = InOptions.LevelPath.empty() ? Recording.LevelPath : InOptions.LevelPath;
+    UWorld* EditorWorld = GEngine.GetDefaultWorld();
+    if (!EditorWorld)
+    {
+        return 1;
+    }
+    if (!LevelPath.empty())
+    {
+        FLevelLoader Loader;
+        if (!Loader.LoadIntoWorld(EditorWorld, LevelPath))
+        {
+            UE_LOG("[Replay] Failed to load level '%s'", LevelPath.c_str());
+            return 2;
+        }
+    }
+
+    const uint32 FrameCount = InOptions.MaxFrames > 0
+        ? std::min<uint32>(InOptions.MaxFrames, static_cast<uint32>(Recording.Frames.Num()))
+        : static_cast<uint32>(Recording.Frames.Num());
+    UE_LOG("[Replay] '%s': %u frames, level '%s', seed %u, dt %s",
+        InOptions.RecordingPath.c_str(), FrameCount, LevelPath.c_str(), Recording.RandomSeed,
+        InOptions.FixedDeltaSeconds > 0.0f ? std::to_string(InOptions.FixedDeltaSeconds).c_str() : "recorded");
+
+    GEngine.StartPIE(Recording.RandomSeed);
+
+    TArray<FReplayFrameTiming> Timings;
+    Timings.reserve(FrameCount);
+
+    UScriptManager& ScriptManager = UScriptManager::GetInstance();
+    UInputManager& InputManager = UInputManager::GetInstance();
+
+    for (uint32 FrameIndex = 0; FrameIndex < FrameCount; ++FrameIndex)
+    {
+        const FInputFrameState& Frame = Recording.Frames[FrameIndex];
+        const float DeltaSeconds = InOptions.FixedDeltaSeconds > 0.0f ? InOptions.FixedDeltaSeconds : Frame.DeltaSeconds;
+
+        FReplayFrameTiming Timing;
+        Timing.Frame = FrameIndex;
+        Timing.DeltaSeconds = DeltaSeconds;
+
+        const uint64 FrameStart = FPlatformTime::Cycles64();
+        InputManager.ApplyFrameState(Frame);
+
+        // UEditorEngine::Tick과 같은 순서 (렌더링/UI 제외)
+        for (const FWorldContext& WorldContext : GEngine.GetWorldContexts())
+        {
+            UWorld* World = WorldContext.World;
+            if (!World)
+            {
+                continue;
+            }
+
+            const uint64 WorldStart = FPlatformTime::Cycles64();
+            World->Tick(DeltaSeconds);
+            const double WorldMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - WorldStart);
+
+            if (World->bPie)
+            {
+                const FWorldTickTimings& Stages = World->GetLastTickTimings();
+                Timing.PartitionMs = Stages.PartitionMs;
+                Timing.ScriptsMs = Stages.ScriptsMs;
+                Timing.ActorsMs = Stages.ActorsMs;
+                Timing.PrePhysicsMs = Stages.PrePhysicsMs;
+                Timing.DuringPhysicsMs = Stages.DuringPhysicsMs;
+                Timing.CollisionMs = Stages.CollisionMs;
+                Timing.PostPhysicsMs = Stages.PostPhysicsMs;
+                Timing.PostUpdateWorkMs = Stages.PostUpdateWorkMs;
+                Timing.GameWorldMs = WorldMs;
+            }
+            else
+            {
+                Timing.EditorWorldMs += WorldMs;
+            }
+        }
+        InputManager.Update();
+
+        const uint64 CoroutineStart = FPlatformTime::Cycles64();
+        ScriptManager.UpdateCoroutineState(DeltaSeconds);
+        Timing.CoroutinesMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - CoroutineStart);
+
+        Timing.FrameMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - FrameStart);
+        Timings.Add(Timing);
+
+        // 게임 코드가 PIE를 끝낸 경우 (녹화도 그 시점에 끝났음)
+        if (GEngine.bChangedPieToEditor)
+        {
+            UE_LOG("[Replay] PIE ended by game code at frame %u", FrameIndex);
+            break;
+        }
+    }
+
+    if (GEngine.IsPIEActive() && !GEngine.bChangedPieToEditor)
+    {
+        GEngine.EndPIE();
+    }
+    GEngine.ProcessPendingPIEEnd();
+
+    const FString Extension = fs::path(InOptions.OutputPath).extension().string();
+    const bool bJson = _stricmp(Extension.c_str(), ".json") == 0;
+    const bool bWritten = bJson
+        ? WriteJson(InOptions.OutputPath, InOptions, LevelPath, Timings)
+        : WriteCsv(InOptions.OutputPath, Timings);
+
+    TArray<double> FrameMs;
+    FrameMs.reserve(Timings.size());
+    double TotalMs = 0.0;
+    for (const FReplayFrameTiming& Timing : Timings)
+    {
+        FrameMs.Add(Timing.FrameMs);
+        TotalMs += Timing.FrameMs;
+    }
+    std::sort(FrameMs.begin(), FrameMs.end());
+
+    UE_LOG("[Replay] %d frames | avg %.3f ms | p50 %.3f | p95 %.3f | p99 %.3f | max %.3f ms",
+        Timings.Num(), Timings.IsEmpty() ? 0.0 : TotalMs / Timings.Num(),
+        Percentile(FrameMs, 0.50), Percentile(FrameMs, 0.95), Percentile(FrameMs, 0.99),
+        FrameMs.IsEmpty() ? 0.0 : FrameMs.back());
+    if (bWritten)
+    {
+        UE_LOG("[Replay] Timings written to '%s'", InOptions.OutputPath.c_str());
+    }
+
+    return bWritten ? 0 : 3;
+}
+
+bool FReplayHarness::WriteCsv(const FString& InPath, const TArray<FReplayFrameTiming>& InFrames)
+{
+    EnsureParentDirectory(InPath);
+    std::ofstream Out(fs::path(UTF8ToWide(InPath)));
+    if (!Out.is_open())
+    {
+        UE_LOG("[Replay] Failed to open '%s' for writing", InPath.c_str());
+        return false;
+    }
+
+    Out << "Frame,DeltaSeconds,PartitionMs,ScriptsMs,ActorsMs,PrePhysicsMs,DuringPhysicsMs,CollisionMs,"
+           "PostPhysicsMs,PostUpdateWorkMs,GameWorldMs,EditorWorldMs,CoroutinesMs,FrameMs\n";
+
+    char Line[512];
+    for (const FReplayFrameTiming& T : InFrames)
+    {
+        snprintf(Line, sizeof(Line), "%u,%.6f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f\n",
+            T.Frame, T.DeltaSeconds, T.PartitionMs, T.ScriptsMs, T.ActorsMs, T.PrePhysicsMs, T.DuringPhysicsMs,
+            T.CollisionMs, T.PostPhysicsMs, T.PostUpdateWorkMs, T.GameWorldMs, T.EditorWorldMs, T.CoroutinesMs, T.FrameMs);
+        Out << Line;
+    }
+    return static_cast<bool>(Out);
+}
+
+bool FReplayHarness::WriteJson(const FString& InPath, const FReplayOptions& InOptions, const FString& InLevelPath,
+    const TArray<FReplayFrameTiming>& InFrames)
+{
+    EnsureParentDirectory(InPath);
+    std::ofstream Out(fs::path(UTF8ToWide(InPath)));
+    if (!Out.is_open())
+    {
+        UE_LOG("[Replay] Failed to open '%s' for writing", InPath.c_str());
+        return false;
+    }
+
+    // 프레임 수가 많을 수 있으므로 JSON 트리를 만들지 않고 바로 씀 (문자열 이스케이프만 JSON에 맡김)
+    Out << "{\n  \"Recording\": " << JSON(InOptions.RecordingPath).dump()
+        << ",\n  \"Level\": " << JSON(InLevelPath).dump()
+        << ",\n  \"FixedDeltaSeconds\": " << InOptions.FixedDeltaSeconds
+        << ",\n  \"Frames\": [\n";
+
+    char Line[640];
+    for (size_t i = 0; i < InFrames.size(); ++i)
+    {
+        const FReplayFrameTiming& T = InFrames[i];
+        snprintf(Line, sizeof(Line),
+            "    {\"Frame\": %u, \"DeltaSeconds\": %.6f, \"PartitionMs\": %.4f, \"ScriptsMs\": %.4f, \"ActorsMs\": %.4f, "
+            "\"PrePhysicsMs\": %.4f, \"DuringPhysicsMs\": %.4f, \"CollisionMs\": %.4f, \"PostPhysicsMs\": %.4f, "
+            "\"PostUpdateWorkMs\": %.4f, \"GameWorldMs\": %.4f, \"EditorWorldMs\": %.4f, \"CoroutinesMs\": %.4f, \"FrameMs\": %.4f}%s\n",
+            T.Frame, T.DeltaSeconds, T.PartitionMs, T.ScriptsMs, T.ActorsMs, T.PrePhysicsMs, T.DuringPhysicsMs,
+            T.CollisionMs, T.PostPhysicsMs, T.PostUpdateWorkMs, T.GameWorldMs, T.EditorWorldMs, T.CoroutinesMs, T.FrameMs,
+            i + 1 < InFrames.size() ? "," : "");
+        Out << Line;
+    }
+    Out << "  ]\n}\n";
+    return static_cast<bool>(Out);
+}
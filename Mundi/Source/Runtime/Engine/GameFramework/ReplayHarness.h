@@ -0,0 +1,63 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+/**
+ * 입력 재생 옵션 (명령줄)
+ *   -replay <file.minput>   재생할 입력 녹화 (필수)
+ *   -level <scene>          녹화 헤더의 레벨 대신 사용할 레벨
+ *   -out <file.csv|json>    프레임별 시간 출력 (확장자가 .json이면 JSON, 그 외 CSV)
+ *   -dt <seconds|recorded>  고정 타임스텝 (기본 1/60, "recorded"면 녹화된 DeltaSeconds)
+ *   -frames <n>             앞에서부터 n 프레임만 재생
+ */
+struct FReplayOptions
+{
+    FString RecordingPath;
+    FString LevelPath;
+    FString OutputPath = "Replays/ReplayTimings.csv";
+    float FixedDeltaSeconds = 1.0f / 60.0f;     // 0이면 녹화된 DeltaSeconds
+    uint32 MaxFrames = 0;                       // 0이면 전체
+
+    // -replay가 없으면 false
+    static bool ParseCommandLine(const FString& InCommandLine, FReplayOptions& OutOptions);
+
+    // 공백으로 나누되 큰따옴표로 묶인 인자는 공백을 포함해 한 토큰으로 (-record 등 다른 인자 파싱에도 사용)
+    static TArray<FString> TokenizeCommandLine(const FString& InCommandLine);
+};
+
+// 재생 중 한 프레임의 시간 (ms)
+struct FReplayFrameTiming
+{
+    uint32 Frame = 0;
+    float DeltaSeconds = 0.0f;
+    double PartitionMs = 0.0;
+    double ScriptsMs = 0.0;
+    double ActorsMs = 0.0;
+    double PrePhysicsMs = 0.0;
+    double DuringPhysicsMs = 0.0;
+    double CollisionMs = 0.0;
+    double PostPhysicsMs = 0.0;
+    double PostUpdateWorkMs = 0.0;
+    double GameWorldMs = 0.0;       // PIE 월드 Tick 전체
+    double EditorWorldMs = 0.0;     // PIE 중에도 에디터 월드는 틱됨
+    double CoroutinesMs = 0.0;
+    double FrameMs = 0.0;
+};
+
+/**
+ * 헤드리스 입력 재생 하네스.
+ * UEditorEngine::Startup(hInstance, true)로 창을 띄우지 않고 시작한 뒤 호출합니다.
+ * 레벨을 로드하고 녹화된 시드로 PIE(ARunnerGameMode)를 시작한 다음,
+ * 매 프레임 녹화된 입력을 UInputManager에 넣고 고정 타임스텝으로 월드를 틱하며 단계별 시간을 기록합니다.
+ * 렌더링/UI 갱신은 하지 않습니다.
+ */
+class FReplayHarness
+{
+public:
+    // 프로세스 종료 코드 반환 (0 성공)
+    static int32 Run(const FReplayOptions& InOptions);
+
+private:
+    static bool WriteCsv(const FString& InPath, const TArray<FReplayFrameTiming>& InFrames);
+    static bool WriteJson(const FString& InPath, const FReplayOptions& InOptions, const FString& InLevelPath,
+        const TArray<FReplayFrameTiming>& InFrames);
+};
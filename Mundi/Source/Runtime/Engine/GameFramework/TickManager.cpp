@@ -0,0 +1,497 @@
+﻿#include "pch.h"
+#include "TickManager.h"
+#include "ActorComponent.h"
+#include "Actor.h"
+#include "World.h"
+#include "ParallelFor.h"
+#include "PlatformTime.h"
+
+namespace
+{
+    constexpr uint32 TickGroupCount = static_cast<uint32>(ETickingGroup::Max);
+
+    // 병렬 단계에서 워커 하나가 한 번에 가져가는 틱 수
+    constexpr int32 ParallelTickBatchSize = 32;
+
+    // 그룹 평균 시간(지수 이동 평균) 가중치
+    constexpr double StatsSmoothing = 0.1;
+
+    // 실행 중 해제된 틱을 목록에서 지움 (순서 유지)
+    void ClearTickFunction(TArray<FTickFunction*>& InOutTicks, const FTickFunction* InTickFunction)
+    {
+        for (FTickFunction*& Tick : InOutTicks)
+        {
+            if (Tick == InTickFunction)
+            {
+                Tick = nullptr;
+            }
+        }
+    }
+
+    // 간격이 있는 틱은 누적 시간이 간격을 넘을 때만 통과하며, 그동안 누적된 시간을 DeltaTime으로 사용
+    bool ConsumeTickInterval(float InInterval, float& InOutAccumulated, float& InOutDeltaTime)
+    {
+        if (InInterval <= 0.0f)
+        {
+            return true;
+        }
+
+        InOutAccumulated += InOutDeltaTime;
+        if (InOutAccumulated < InInterval)
+        {
+            return false;
+        }
+
+        InOutDeltaTime = InOutAccumulated;
+        InOutAccumulated = 0.0f;
+        return true;
+    }
+}
+
+const char* GetTickingGroupName(ETickingGroup InGroup)
+{
+    switch (InGroup)
+    {
+    case ETickingGroup::PrePhysics:     return "PrePhysics";
+    case ETickingGroup::DuringPhysics:  return "DuringPhysics";
+    case ETickingGroup::PostPhysics:    return "PostPhysics";
+    case ETickingGroup::PostUpdateWork: return "PostUpdateWork";
+    default:                            return "Unknown";
+    }
+}
+
+// ─────────────── FTickFunction
+
+FTickFunction::FTickFunction(const FTickFunction& Other)
+    : bRunOnAnyThread(Other.bRunOnAnyThread)
+    , TickGroup(Other.TickGroup)
+    , TickState(Other.TickState == ETickState::Disabled ? ETickState::Disabled : ETickState::Enabled)
+    , TickInterval(Other.TickInterval)
+{
+}
+
+FTickFunction& FTickFunction::operator=(const FTickFunction& Other)
+{
+    if (this != &Other)
+    {
+        bRunOnAnyThread = Other.bRunOnAnyThread;
+        TickInterval = Other.TickInterval;
+        SetTickGroup(Other.TickGroup);
+        SetTickState(Other.TickState == ETickState::Disabled ? ETickState::Disabled : ETickState::Enabled);
+    }
+    return *this;
+}
+
+FTickFunction::~FTickFunction()
+{
+    UnregisterTickFunction();
+
+    // 선행 조건 참조 정리 (양방향)
+    for (FTickFunction* Prerequisite : Prerequisites)
+    {
+        Prerequisite->Dependents.Remove(this);
+    }
+    for (FTickFunction* Dependent : Dependents)
+    {
+        Dependent->Prerequisites.Remove(this);
+        Dependent->MarkScheduleDirty();
+    }
+}
+
+void FTickFunction::RegisterTickFunction(FTickManager* InManager)
+{
+    if (Manager == InManager)
+    {
+        return;
+    }
+
+    UnregisterTickFunction();
+    if (InManager)
+    {
+        InManager->AddTickFunction(this);
+    }
+}
+
+void FTickFunction::UnregisterTickFunction()
+{
+    if (Manager)
+    {
+        Manager->RemoveTickFunction(this);
+    }
+}
+
+void FTickFunction::SetTickState(ETickState InState)
+{
+    if (TickState == InState)
+    {
+        return;
+    }
+
+    TickState = InState;
+    AccumulatedTime = 0.0f;
+    MarkScheduleDirty();
+
+    // 선행 틱이 스케줄에서 빠지거나 돌아오면 의존하는 틱의 단계도 바뀜
+    for (FTickFunction* Dependent : Dependents)
+    {
+        Dependent->MarkScheduleDirty();
+    }
+}
+
+void FTickFunction::SetTickGroup(ETickingGroup InGroup)
+{
+    if (TickGroup == InGroup)
+    {
+        return;
+    }
+
+    TickGroup = InGroup;
+    MarkScheduleDirty();
+    for (FTickFunction* Dependent : Dependents)
+    {
+        Dependent->MarkScheduleDirty();
+    }
+}
+
+void FTickFunction::AddPrerequisite(FTickFunction* InPrerequisite)
+{
+    if (!InPrerequisite || InPrerequisite == this || Prerequisites.Contains(InPrerequisite))
+    {
+        return;
+    }
+
+    Prerequisites.Add(InPrerequisite);
+    InPrerequisite->Dependents.Add(this);
+    MarkScheduleDirty();
+}
+
+void FTickFunction::RemovePrerequisite(FTickFunction* InPrerequisite)
+{
+    if (!InPrerequisite || !Prerequisites.Contains(InPrerequisite))
+    {
+        return;
+    }
+
+    Prerequisites.Remove(InPrerequisite);
+    InPrerequisite->Dependents.Remove(this);
+    MarkScheduleDirty();
+}
+
+void FTickFunction::MarkScheduleDirty()
+{
+    if (Manager)
+    {
+        Manager->bScheduleDirty = true;
+    }
+}
+
+// ─────────────── FActorComponentTickFunction
+
+void FActorComponentTickFunction::ExecuteTick(float DeltaTime)
+{
+    Target->TickComponent(DeltaTime);
+}
+
+void FActorComponentTickFunction::ExecuteParallelTick(float DeltaTime)
+{
+    Target->TickComponentParallel(DeltaTime);
+}
+
+void FActorComponentTickFunction::FinishParallelTick()
+{
+    Target->ApplyParallelTick();
+}
+
+bool FActorComponentTickFunction::ShouldTick() const
+{
+    // 기존 AActor::Tick의 컴포넌트 틱 조건과 동일 (에디터 월드에서는 bTickInEditor 액터만)
+    if (!Target || !Target->IsComponentTickEnabled())
+    {
+        return false;
+    }
+
+    const AActor* Owner = Target->GetOwner();
+    const UWorld* World = Owner ? Owner->GetWorld() : nullptr;
+    return World && !Owner->IsPendingDestroy() && Owner->IsActorTickEnabled() &&
+        (Owner->CanTickInEditor() || World->bPie);
+}
+
+FString FActorComponentTickFunction::GetDiagnosticName() const
+{
+    return Target ? FString(Target->GetClass()->Name) : FString("ActorComponentTick");
+}
+
+// ─────────────── FTickManager
+
+FTickManager::~FTickManager()
+{
+    // 남은 틱 함수가 해제된 매니저를 가리키지 않도록 끊음
+    for (FTickFunction* TickFunction : RegisteredTickFunctions)
+    {
+        TickFunction->Manager = nullptr;
+        TickFunction->RegisteredIndex = -1;
+    }
+}
+
+void FTickManager::AddTickFunction(FTickFunction* InTickFunction)
+{
+    InTickFunction->Manager = this;
+    InTickFunction->RegisteredIndex = RegisteredTickFunctions.Num();
+    InTickFunction->AccumulatedTime = 0.0f;
+    RegisteredTickFunctions.Add(InTickFunction);
+    bScheduleDirty = true;
+}
+
+void FTickManager::RemoveTickFunction(FTickFunction* InTickFunction)
+{
+    // 스왑 제거 (대량 파괴 시 O(N^2) 방지)
+    const int32 Index = InTickFunction->RegisteredIndex;
+    if (Index >= 0 && Index < RegisteredTickFunctions.Num() && RegisteredTickFunctions[Index] == InTickFunction)
+    {
+        FTickFunction* Last = RegisteredTickFunctions.back();
+        RegisteredTickFunctions[Index] = Last;
+        Last->RegisteredIndex = Index;
+        RegisteredTickFunctions.pop_back();
+    }
+
+    // 그룹 실행 중(다른 틱이 액터를 파괴하는 경우)이면 현재 스케줄에서도 즉시 지움
+    if (bIsRunning)
+    {
+        for (TArray<FTickWave>& Waves : Schedule)
+        {
+            for (FTickWave& Wave : Waves)
+            {
+                ClearTickFunction(Wave.SerialTicks, InTickFunction);
+                ClearTickFunction(Wave.ParallelTicks, InTickFunction);
+            }
+        }
+        ClearTickFunction(FrameParallelTicks, InTickFunction);
+    }
+
+    InTickFunction->Manager = nullptr;
+    InTickFunction->RegisteredIndex = -1;
+    bScheduleDirty = true;
+}
+
+ETickingGroup FTickManager::ResolveScheduledGroup(FTickFunction* InTickFunction, uint32 InVisitMark)
+{
+    // InVisitMark: 방문 중, InVisitMark + 1: 완료
+    if (InTickFunction->VisitMark == InVisitMark + 1)
+    {
+        return InTickFunction->ScheduledGroup;
+    }
+
+    InTickFunction->VisitMark = InVisitMark;
+    ETickingGroup Group = InTickFunction->TickGroup;
+
+    for (FTickFunction* Prerequisite : InTickFunction->Prerequisites)
+    {
+        // 다른 월드의 틱이나 스케줄에 없는 틱은 이미 만족된 것으로 취급
+        if (Prerequisite->Manager != this || Prerequisite->TickState != ETickState::Enabled)
+        {
+            continue;
+        }
+        if (Prerequisite->VisitMark == InVisitMark)
+        {
+            UE_LOG("TickManager: Prerequisite cycle detected at %s <- %s, ignoring the edge.",
+                InTickFunction->GetDiagnosticName().c_str(), Prerequisite->GetDiagnosticName().c_str());
+            continue;
+        }
+        Group = std::max(Group, ResolveScheduledGroup(Prerequisite, InVisitMark));
+    }
+
+    InTickFunction->ScheduledGroup = Group;
+    InTickFunction->VisitMark = InVisitMark + 1;
+    return Group;
+}
+
+uint32 FTickManager::ResolveScheduleDepth(FTickFunction* InTickFunction, uint32 InVisitMark)
+{
+    if (InTickFunction->VisitMark == InVisitMark + 1)
+    {
+        return InTickFunction->ScheduleDepth;
+    }
+
+    InTickFunction->VisitMark = InVisitMark;
+    uint32 Depth = 0;
+
+    // 같은 그룹의 선행 틱보다 한 단계 뒤 (이전 그룹의 선행 틱은 이미 실행됨)
+    for (FTickFunction* Prerequisite : InTickFunction->Prerequisites)
+    {
+        if (Prerequisite->Manager != this || Prerequisite->TickState != ETickState::Enabled ||
+            Prerequisite->ScheduledGroup != InTickFunction->ScheduledGroup ||
+            Prerequisite->VisitMark == InVisitMark)
+        {
+            continue;
+        }
+        Depth = std::max(Depth, ResolveScheduleDepth(Prerequisite, InVisitMark) + 1);
+    }
+
+    InTickFunction->ScheduleDepth = Depth;
+    InTickFunction->VisitMark = InVisitMark + 1;
+    return Depth;
+}
+
+void FTickManager::RebuildSchedule()
+{
+    for (TArray<FTickWave>& Waves : Schedule)
+    {
+        Waves.clear();
+    }
+
+    // 1) 선행 조건을 반영한 실제 그룹
+    CurrentVisitMark += 2;
+    const uint32 GroupVisitMark = CurrentVisitMark;
+    for (FTickFunction* TickFunction : RegisteredTickFunctions)
+    {
+        if (TickFunction->TickState == ETickState::Enabled)
+        {
+            ResolveScheduledGroup(TickFunction, GroupVisitMark);
+        }
+    }
+
+    // 2) 그룹 내 선행 조건 깊이 → 단계
+    CurrentVisitMark += 2;
+    const uint32 DepthVisitMark = CurrentVisitMark;
+    for (FTickFunction* TickFunction : RegisteredTickFunctions)
+    {
+        if (TickFunction->TickState != ETickState::Enabled)
+        {
+            continue;
+        }
+
+        const uint32 Depth = ResolveScheduleDepth(TickFunction, DepthVisitMark);
+        TArray<FTickWave>& Waves = Schedule[static_cast<uint32>(TickFunction->ScheduledGroup)];
+        if (Waves.Num() <= static_cast<int32>(Depth))
+        {
+            Waves.resize(Depth + 1);
+        }
+
+        FTickWave& Wave = Waves[Depth];
+        if (TickFunction->bRunOnAnyThread)
+        {
+            Wave.ParallelTicks.Add(TickFunction);
+        }
+        else
+        {
+            Wave.SerialTicks.Add(TickFunction);
+        }
+    }
+
+    for (uint32 GroupIndex = 0; GroupIndex < TickGroupCount; ++GroupIndex)
+    {
+        uint32 ScheduledCount = 0;
+        for (const FTickWave& Wave : Schedule[GroupIndex])
+        {
+            ScheduledCount += static_cast<uint32>(Wave.SerialTicks.Num() + Wave.ParallelTicks.Num());
+        }
+        GroupStats[GroupIndex].ScheduledCount = ScheduledCount;
+    }
+
+    bScheduleDirty = false;
+}
+
+void FTickManager::RunTickGroup(ETickingGroup InGroup, float DeltaTime)
+{
+    if (bScheduleDirty)
+    {
+        RebuildSchedule();
+    }
+
+    const uint32 GroupIndex = static_cast<uint32>(InGroup);
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    uint32 TickCount = 0;
+    uint32 ParallelTickCount = 0;
+
+    bIsRunning = true;
+
+    TArray<FTickWave>& Waves = Schedule[GroupIndex];
+    for (int32 WaveIndex = 0; WaveIndex < Waves.Num(); ++WaveIndex)
+    {
+        // 1) 병렬 틱: 이번 프레임 대상만 모아 워커 스레드에서 계산 → 메인 스레드에서 순서대로 반영
+        FrameParallelTicks.clear();
+        FrameParallelDeltaTimes.clear();
+        for (FTickFunction* TickFunction : Waves[WaveIndex].ParallelTicks)
+        {
+            float TickDeltaTime = DeltaTime;
+            if (TickFunction && TickFunction->ShouldTick() &&
+                ConsumeTickInterval(TickFunction->TickInterval, TickFunction->AccumulatedTime, TickDeltaTime))
+            {
+                FrameParallelTicks.Add(TickFunction);
+                FrameParallelDeltaTimes.Add(TickDeltaTime);
+            }
+        }
+
+        if (!FrameParallelTicks.IsEmpty())
+        {
+            const int32 Count = FrameParallelTicks.Num();
+            const bool bSingleThread = Count < MinParallelBatchCount;
+            ParallelFor(Count, [this](int32 Index)
+            {
+                FrameParallelTicks[Index]->ExecuteParallelTick(FrameParallelDeltaTimes[Index]);
+            }, ParallelTickBatchSize, bSingleThread);
+
+            for (int32 Index = 0; Index < FrameParallelTicks.Num(); ++Index)
+            {
+                if (FTickFunction* TickFunction = FrameParallelTicks[Index])
+                {
+                    TickFunction->FinishParallelTick();
+                }
+            }
+
+            TickCount += static_cast<uint32>(Count);
+            if (!bSingleThread)
+            {
+                ParallelTickCount += static_cast<uint32>(Count);
+            }
+        }
+
+        // 2) 직렬 틱 (인덱스 순회: 실행 중 해제되면 nullptr로 지워짐)
+        TArray<FTickFunction*>& SerialTicks = Waves[WaveIndex].SerialTicks;
+        for (int32 Index = 0; Index < SerialTicks.Num(); ++Index)
+        {
+            FTickFunction* TickFunction = SerialTicks[Index];
+            float TickDeltaTime = DeltaTime;
+            if (TickFunction && TickFunction->ShouldTick() &&
+                ConsumeTickInterval(TickFunction->TickInterval, TickFunction->AccumulatedTime, TickDeltaTime))
+            {
+                TickFunction->ExecuteTick(TickDeltaTime);
+                ++TickCount;
+            }
+        }
+    }
+
+    bIsRunning = false;
+
+    FTickGroupStats& Stats = GroupStats[GroupIndex];
+    Stats.LastMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    Stats.AverageMs += (Stats.LastMs - Stats.AverageMs) * StatsSmoothing;
+    Stats.TickCount = TickCount;
+    Stats.ParallelTickCount = ParallelTickCount;
+}
+
+int32 FTickManager::GetSleepingCount() const
+{
+    int32 SleepingCount = 0;
+    for (const FTickFunction* TickFunction : RegisteredTickFunctions)
+    {
+        if (TickFunction->TickState == ETickState::Sleeping)
+        {
+            ++SleepingCount;
+        }
+    }
+    return SleepingCount;
+}
+
+void FTickManager::DumpStats() const
+{
+    UE_LOG("[Tick] %d registered, %d sleeping, %u worker threads",
+        GetRegisteredCount(), GetSleepingCount(), GetParallelWorkerCount());
+    for (uint32 GroupIndex = 0; GroupIndex < TickGroupCount; ++GroupIndex)
+    {
+        const FTickGroupStats& Stats = GroupStats[GroupIndex];
+        UE_LOG("[Tick] %-14s | scheduled %6u | ticked %6u (parallel %6u) | waves %2d | last %7.3f ms | avg %7.3f ms",
+            GetTickingGroupName(static_cast<ETickingGroup>(GroupIndex)), Stats.ScheduledCount, Stats.TickCount,
+            Stats.ParallelTickCount, Schedule[GroupIndex].Num(), Stats.LastMs, Stats.AverageMs);
+    }
+}
@@ -0,0 +1,172 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+class UWorld;
+class UActorComponent;
+class FTickManager;
+
+/**
+ * 틱 그룹 (UWorld::Tick에서 순서대로 실행)
+ *   [Lua 스크립트] → [액터 Tick] → PrePhysics → DuringPhysics → [충돌 업데이트] → PostPhysics → PostUpdateWork
+ */
+enum class ETickingGroup : uint8
+{
+    PrePhysics,         // 기본값. 이동 등 충돌 검사 전에 반영되어야 하는 틱
+    DuringPhysics,      // 충돌 결과와 무관한 틱
+    PostPhysics,        // 이번 프레임 충돌 결과(오버랩 이벤트)를 보고 동작하는 틱
+    PostUpdateWork,     // 모든 갱신 이후 (카메라/이펙트 후처리 등)
+    Max
+};
+
+const char* GetTickingGroupName(ETickingGroup InGroup);
+
+enum class ETickState : uint8
+{
+    Enabled,
+    Disabled,           // 명시적으로 꺼짐
+    Sleeping,           // 유휴 상태. WakeUp() 전까지 스케줄에서 빠짐 (매 프레임 순회 비용 없음)
+};
+
+/**
+ * 틱 매니저에 등록되는 틱 함수 1개.
+ * 틱 간격/상태/선행 조건은 등록 전후 언제든 바꿀 수 있고, 바뀌면 다음 그룹 실행 전에 스케줄이 다시 구성됩니다.
+ */
+struct FTickFunction
+{
+    FTickFunction() = default;
+    virtual ~FTickFunction();
+
+    // 복사 시 설정(그룹/간격/켜짐 여부/스레드 옵션)만 복사. 등록/선행 조건/슬립은 복사하지 않음 (컴포넌트 Duplicate용)
+    FTickFunction(const FTickFunction& Other);
+    FTickFunction& operator=(const FTickFunction& Other);
+
+    // 직렬 실행 (메인 스레드)
+    virtual void ExecuteTick(float DeltaTime) = 0;
+
+    // bRunOnAnyThread일 때만 사용: 워커 스레드에서 자기 상태만 계산 → 메인 스레드에서 결과 반영
+    virtual void ExecuteParallelTick(float DeltaTime) { }
+    virtual void FinishParallelTick() { }
+
+    // 이번 프레임에 틱할지 (에디터 월드 틱 조건, 컴포넌트 활성 상태 등)
+    virtual bool ShouldTick() const { return true; }
+
+    virtual FString GetDiagnosticName() const { return "TickFunction"; }
+
+    void RegisterTickFunction(FTickManager* InManager);
+    void UnregisterTickFunction();
+    bool IsRegistered() const { return Manager != nullptr; }
+
+    void SetTickState(ETickState InState);
+    ETickState GetTickState() const { return TickState; }
+    void SetTickFunctionEnable(bool bEnabled) { SetTickState(bEnabled ? ETickState::Enabled : ETickState::Disabled); }
+    void Sleep() { if (TickState == ETickState::Enabled) SetTickState(ETickState::Sleeping); }
+    void WakeUp() { if (TickState == ETickState::Sleeping) SetTickState(ETickState::Enabled); }
+
+    void SetTickGroup(ETickingGroup InGroup);
+    ETickingGroup GetTickGroup() const { return TickGroup; }
+
+    // 0이면 매 프레임. 간격이 지나면 누적된 DeltaTime으로 한 번 틱
+    void SetTickInterval(float InInterval) { TickInterval = InInterval > 0.0f ? InInterval : 0.0f; }
+    float GetTickInterval() const { return TickInterval; }
+
+    // 같은 프레임에서 InPrerequisite가 먼저 틱하도록 보장.
+    // 선행 틱이 더 늦은 그룹이면 이 틱이 그 그룹으로 밀려남 (순환이 생기면 경고 후 해당 간선을 무시)
+    void AddPrerequisite(FTickFunction* InPrerequisite);
+    void RemovePrerequisite(FTickFunction* InPrerequisite);
+    const TArray<FTickFunction*>& GetPrerequisites() const { return Prerequisites; }
+
+    // 워커 스레드에서 ExecuteParallelTick을 호출해도 안전한지 (같은 단계의 다른 틱과 병렬 실행됨)
+    bool bRunOnAnyThread = false;
+
+private:
+    friend class FTickManager;
+
+    void MarkScheduleDirty();
+
+    FTickManager* Manager = nullptr;
+    ETickingGroup TickGroup = ETickingGroup::PrePhysics;
+    ETickState TickState = ETickState::Enabled;
+    float TickInterval = 0.0f;
+    TArray<FTickFunction*> Prerequisites;
+    TArray<FTickFunction*> Dependents;   // 나를 선행 조건으로 가진 틱 (해제 시 참조 정리용)
+
+    // 스케줄 구성/실행 중 상태
+    int32 RegisteredIndex = -1;
+    float AccumulatedTime = 0.0f;
+    ETickingGroup ScheduledGroup = ETickingGroup::PrePhysics;
+    uint32 ScheduleDepth = 0;
+    uint32 VisitMark = 0;
+};
+
+// 컴포넌트 기본 틱 (UActorComponent::PrimaryComponentTick)
+struct FActorComponentTickFunction : public FTickFunction
+{
+    void ExecuteTick(float DeltaTime) override;
+    void ExecuteParallelTick(float DeltaTime) override;
+    void FinishParallelTick() override;
+    bool ShouldTick() const override;
+    FString GetDiagnosticName() const override;
+
+    UActorComponent* Target = nullptr;
+};
+
+struct FTickGroupStats
+{
+    double LastMs = 0.0;
+    double AverageMs = 0.0;         // 지수 이동 평균
+    uint32 TickCount = 0;           // 지난 프레임 실제로 틱한 수
+    uint32 ParallelTickCount = 0;   // 그중 워커 스레드에서 계산된 수
+    uint32 ScheduledCount = 0;      // 스케줄에 있는 수 (간격/조건으로 건너뛴 것 포함)
+};
+
+/**
+ * 월드별 틱 매니저.
+ * 그룹마다 선행 조건 깊이별 단계(Wave)로 나눈 스케줄을 유지하고, 같은 단계의 bRunOnAnyThread 틱은 ParallelFor로 계산한 뒤
+ * 메인 스레드에서 스케줄 순서대로 결과를 반영합니다. 스케줄은 등록/상태/그룹/선행 조건이 바뀐 경우에만 다시 구성됩니다.
+ */
+class FTickManager
+{
+public:
+    FTickManager() = default;
+    ~FTickManager();
+
+    FTickManager(const FTickManager&) = delete;
+    FTickManager& operator=(const FTickManager&) = delete;
+
+    void RunTickGroup(ETickingGroup InGroup, float DeltaTime);
+
+    const FTickGroupStats& GetGroupStats(ETickingGroup InGroup) const { return GroupStats[static_cast<uint32>(InGroup)]; }
+    int32 GetRegisteredCount() const { return RegisteredTickFunctions.Num(); }
+    int32 GetSleepingCount() const;
+    void DumpStats() const;
+
+    // 병렬 계산을 쓰는 단계당 최소 틱 수 (작으면 스레드 분배 비용이 더 큼)
+    static constexpr int32 MinParallelBatchCount = 64;
+
+private:
+    friend struct FTickFunction;
+
+    struct FTickWave
+    {
+        TArray<FTickFunction*> SerialTicks;
+        TArray<FTickFunction*> ParallelTicks;
+    };
+
+    void AddTickFunction(FTickFunction* InTickFunction);
+    void RemoveTickFunction(FTickFunction* InTickFunction);
+    void RebuildSchedule();
+    ETickingGroup ResolveScheduledGroup(FTickFunction* InTickFunction, uint32 InVisitMark);
+    uint32 ResolveScheduleDepth(FTickFunction* InTickFunction, uint32 InVisitMark);
+
+    TArray<FTickFunction*> RegisteredTickFunctions;
+    TArray<FTickWave> Schedule[static_cast<uint32>(ETickingGroup::Max)];
+    FTickGroupStats GroupStats[static_cast<uint32>(ETickingGroup::Max)];
+
+    // 단계 실행 중 이번 프레임에 실제로 틱할 병렬 틱과 DeltaTime (실행 중 해제되면 nullptr로 지움)
+    TArray<FTickFunction*> FrameParallelTicks;
+    TArray<float> FrameParallelDeltaTimes;
+
+    bool bScheduleDirty = true;
+    bool bIsRunning = false;
+    uint32 CurrentVisitMark = 0;
+};
@@ -26,8 +26,11 @@
 #include "LightManager.h"
 #include "ShadowManager.h"
 #include "CollisionManager.h"
+#include "TickManager.h"
+#include "ProjectileManager.h"
 #include"Pawn.h"
 #include"PlayerController.h"
+#include "PlatformTime.h"
 
 IMPLEMENT_CLASS(UWorld)
 
@@ -41,11 +44,15 @@ UWorld::UWorld()
 	ShadowManager = std::make_unique<FShadowManager>();
 	CollisionManager = std::make_unique<UCollisionManager>();
 	CollisionManager->SetWorld(this);
-
+	TickManager = std::make_unique<FTickManager>();
+	ProjectileManager = std::make_unique<FProjectileManager>(this);
 }
 
 UWorld::~UWorld()
 {
+	// 이 월드 포인터로 보관된 Lua Tick 배치 제거 (같은 주소에 새 월드가 생겨도 오래된 배치를 쓰지 않도록)
+	UScriptManager::GetInstance().OnWorldDestroyed(this);
+
 	if (Level)
 	{
 		for (AActor* Actor : Level->GetActors())
@@ -102,14 +109,29 @@ void UWorld::InitializeGizmo()
 
 void UWorld::Tick(float DeltaSeconds)
 {
+	// 단계별 시간 측정 (구간 끝마다 Cycles64 한 번)
+	const uint64 TickStartCycles = FPlatformTime::Cycles64();
+	uint64 StageStartCycles = TickStartCycles;
+	auto EndStage = [&StageStartCycles](double& OutMs)
+	{
+		const uint64 Now = FPlatformTime::Cycles64();
+		OutMs = FPlatformTime::ToMilliseconds(Now - StageStartCycles);
+		StageStartCycles = Now;
+	};
+
 	Partition->Update(DeltaSeconds, /*budget*/256);
+	EndStage(LastTickTimings.PartitionMs);
 
 //순서 바꾸면 안댐
+	// Lua Tick을 스크립트 파일별로 묶어 먼저 실행 (입력 처리를 위해 컴포넌트 Tick보다 앞)
+	UScriptManager::GetInstance().TickScripts(this, DeltaSeconds);
+	EndStage(LastTickTimings.ScriptsMs);
+
 	if (Level)
 	{
 		for (AActor* Actor : Level->GetActors())
 		{
-			if (Actor && (Actor->CanTickInEditor() || bPie))
+			if (Actor && Actor->IsActorTickEnabled() && (Actor->CanTickInEditor() || bPie))
 			{
 				Actor->Tick(DeltaSeconds);
 			}
@@ -119,12 +141,31 @@ void UWorld::Tick(float DeltaSeconds)
 	{
 		if (EditorActor && !bPie) EditorActor->Tick(DeltaSeconds);
 	}
+	EndStage(LastTickTimings.ActorsMs);
+
+	// 컴포넌트 틱 (틱 매니저가 그룹별로 실행, 충돌 업데이트 전후로 나뉨)
+	TickManager->RunTickGroup(ETickingGroup::PrePhysics, DeltaSeconds);
+	EndStage(LastTickTimings.PrePhysicsMs);
+	TickManager->RunTickGroup(ETickingGroup::DuringPhysics, DeltaSeconds);
+	EndStage(LastTickTimings.DuringPhysicsMs);
 
 	// 충돌 감지 업데이트
 	if (CollisionManager)
 	{
 		CollisionManager->UpdateCollisions(DeltaSeconds);
 	}
+	EndStage(LastTickTimings.CollisionMs);
+
+	TickManager->RunTickGroup(ETickingGroup::PostPhysics, DeltaSeconds);
+	EndStage(LastTickTimings.PostPhysicsMs);
+	TickManager->RunTickGroup(ETickingGroup::PostUpdateWork, DeltaSeconds);
+	EndStage(LastTickTimings.PostUpdateWorkMs);
+
+	// 틱 도중 요청된 파괴는 모든 갱신이 끝난 뒤 한 번에
+	FlushPendingDestroys();
+	EndStage(LastTickTimings.DeferredDestroyMs);
+
+	LastTickTimings.TotalMs = FPlatformTime::ToMilliseconds(StageStartCycles - TickStartCycles);
 }
 
 UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
@@ -187,6 +228,11 @@ bool UWorld::DestroyActor(AActor* Actor)
 	if (Actor->IsPendingDestroy()) return false;
 	Actor->MarkPendingDestroy();
 
+	return DestroyActorInternal(Actor);
+}
+
+bool UWorld::DestroyActorInternal(AActor* Actor)
+{
 	// 선택/UI 해제
 	if (SelectionMgr) SelectionMgr->DeselectActor(Actor);
 
@@ -205,6 +251,7 @@ bool UWorld::DestroyActor(AActor* Actor)
 
 	// 월드 자료구조에서 소유한 컴포넌트 내리기
 	OnActorDestroyed(Actor);
+	if (ProjectileManager) ProjectileManager->OnActorDestroyed(Actor);
 
 	Actor->UnregisterAllComponents(/*bCallEndPlayOnBegun=*/true);
 	Actor->DestroyAllComponents();
@@ -232,6 +279,34 @@ bool UWorld::DestroyActor(AActor* Actor)
 	return false; // 레벨에 없는 액터
 }
 
+void UWorld::DestroyActorDeferred(AActor* Actor)
+{
+	if (!Actor || Actor->IsPendingDestroy()) return;
+
+	// 파괴 전까지 보이지 않고 액터/스크립트/컴포넌트 틱에서도 빠짐.
+	// 파티션과 CollisionManager에서도 바로 내려 남은 프레임 동안 피킹/스윕/Overlap에 걸리지 않게 함
+	Actor->MarkPendingDestroy();
+	Actor->SetActorTickEnabled(false);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorHiddenInGame(true);
+	Partition->Unregister(Actor);
+	PendingDestroyActors.Add(Actor);
+}
+
+void UWorld::FlushPendingDestroys()
+{
+	// 파괴 중 EndPlay에서 다시 요청될 수 있으므로 빌 때까지
+	while (!PendingDestroyActors.IsEmpty())
+	{
+		TArray<AActor*> Actors;
+		Actors.swap(PendingDestroyActors);
+		for (AActor* Actor : Actors)
+		{
+			DestroyActorInternal(Actor);
+		}
+	}
+}
+
 void UWorld::OnActorSpawned(AActor* Actor)
 {
 	if (!Actor) return;
@@ -27,14 +27,32 @@ class UWorldPartitionManager;
 class AStaticMeshActor;
 class BVHierachy;
 class UStaticMesh;
+class UPrimitiveComponent;
 class FOcclusionCullingManagerCPU;
 struct Frustum;
 struct FCandidateDrawable;
 class FShadowManager;
 class UCollisionManager;
+class FTickManager;
+class FProjectileManager;
 class AGameModeBase;
 class AGameStateBase;
 
+/** UWorld::Tick 단계별 소요 시간 (마지막 Tick 기준, 입력 재생 하네스의 프레임 기록에 사용) */
+struct FWorldTickTimings
+{
+    double PartitionMs = 0.0;
+    double ScriptsMs = 0.0;
+    double ActorsMs = 0.0;
+    double PrePhysicsMs = 0.0;
+    double DuringPhysicsMs = 0.0;
+    double CollisionMs = 0.0;
+    double PostPhysicsMs = 0.0;
+    double PostUpdateWorkMs = 0.0;
+    double DeferredDestroyMs = 0.0;
+    double TotalMs = 0.0;
+};
+
 class UWorld final : public UObject
 {
 public:
@@ -61,6 +79,11 @@ public:
 
     bool DestroyActor(AActor* Actor);
 
+    // 틱 도중(이동/충돌 이벤트 등)에도 안전한 파괴: 바로 숨기고 틱/파티션에서 빼 두었다가 이번 Tick 마지막에 파괴
+    // 월드가 틱하지 않는 중에 호출하면 다음 Tick 끝에 처리됨
+    void DestroyActorDeferred(AActor* Actor);
+    void FlushPendingDestroys();
+
     // Partial hooks
     void OnActorSpawned(AActor* Actor);
     void OnActorDestroyed(AActor* Actor);
@@ -75,6 +98,8 @@ public:
     FLightManager* GetLightManager() const { return LightManager.get(); }
     FShadowManager* GetShadowManager() const { return ShadowManager.get(); }
     UCollisionManager* GetCollisionManager() const { return CollisionManager.get(); }
+    FTickManager* GetTickManager() const { return TickManager.get(); }
+    FProjectileManager* GetProjectileManager() const { return ProjectileManager.get(); }
 
     ACameraActor* GetCameraActor() { return MainCameraActor; }
     void SetCameraActor(ACameraActor* InCamera)
@@ -91,6 +116,11 @@ public:
 
     /** === 타임 / 틱 === */
     virtual void Tick(float DeltaSeconds);
+    const FWorldTickTimings& GetLastTickTimings() const { return LastTickTimings; }
+
+    // 에디터 월드에 마지막으로 로드된 레벨 파일 (입력 녹화 헤더에 기록)
+    const FString& GetLevelFilePath() const { return LevelFilePath; }
+    void SetLevelFilePath(const FString& InPath) { LevelFilePath = InPath; }
 
     /** === 필요한 엑터 게터 === */
     const TArray<AActor*>& GetActors() { static TArray<AActor*> Empty; return Level ? Level->GetActors() : Empty; }
@@ -99,6 +129,11 @@ public:
     AGridActor* GetGridActor() { return GridActor; }
     UWorldPartitionManager* GetPartitionManager() { return Partition.get(); }
 
+    /** === 피킹용 빌보드/텍스트 컴포넌트 (OnRegister/OnUnregister에서 등록, 클릭마다 액터를 순회하지 않도록) === */
+    void RegisterSpriteComponent(UPrimitiveComponent* InComponent) { SpriteComponents.AddUnique(InComponent); }
+    void UnregisterSpriteComponent(UPrimitiveComponent* InComponent) { SpriteComponents.Remove(InComponent); }
+    const TArray<UPrimitiveComponent*>& GetSpriteComponents() const { return SpriteComponents; }
+
     // Per-world render settings
     URenderSettings& GetRenderSettings() { return RenderSettings; }
     const URenderSettings& GetRenderSettings() const { return RenderSettings; }
@@ -136,12 +171,27 @@ private:
     /** === 충돌 매니저 ===*/
     std::unique_ptr<UCollisionManager> CollisionManager;
 
+    /** === 틱 매니저 (컴포넌트 틱 그룹) ===*/
+    std::unique_ptr<FTickManager> TickManager;
+
+    /** === 발사체 매니저 (배치 갱신 + 액터 풀, 틱 매니저보다 먼저 해제) ===*/
+    std::unique_ptr<FProjectileManager> ProjectileManager;
+
+    // 등록된 빌보드/텍스트 컴포넌트 (CPickingSystem::PickSpriteComponents가 순회)
+    TArray<UPrimitiveComponent*> SpriteComponents;
+
+    // 프레임 끝에 파괴할 액터 (DestroyActorDeferred)
+    TArray<AActor*> PendingDestroyActors;
+
     // Object naming system
     TMap<FString, int32> ObjectTypeCounts;
 
     // Internal helper to register spawned actors into current level
     void AddActorToLevel(AActor* Actor);
 
+    // 재진입 가드(MarkPendingDestroy)를 통과한 액터의 실제 파괴
+    bool DestroyActorInternal(AActor* Actor);
+
     // Per-world render settings
     URenderSettings RenderSettings;
 
@@ -150,6 +200,9 @@ private:
 
     // Per-world selection manager
     std::unique_ptr<USelectionManager> SelectionMgr;
+
+    FWorldTickTimings LastTickTimings;
+    FString LevelFilePath;
 };
 
 template<class T>
@@ -64,12 +64,17 @@ void UWorldPartitionManager::BulkRegister(const TArray<AActor*>& Actors)
 	if (Actors.empty()) return;
 	TArray<UStaticMeshComponent*> StaticMeshComponents;
 	StaticMeshComponents.Reserve(Actors.size());
+
+	// 에디터 액터 목록은 한 번만 집합으로 만들어 액터마다 복사/선형 검색하지 않는다.
+	TSet<AActor*> EditorActors;
+	for (AActor* EditorActor : GWorld->GetEditorActors())
+	{
+		EditorActors.Add(EditorActor);
+	}
 	
 	for (AActor* Actor : Actors)
 	{
-		TArray<AActor*> EditorActors = GWorld->GetEditorActors();
-		auto it = std::find(EditorActors.begin(), EditorActors.end(), Actor);
-		if (it != EditorActors.end())
+		if (!Actor || EditorActors.Contains(Actor))
 			continue; // 에디터 액터는 포함하지 않는다.
 		
 		const TArray<USceneComponent*> Components = Actor->GetSceneComponents();
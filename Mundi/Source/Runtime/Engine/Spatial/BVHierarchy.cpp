@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include <algorithm>
+#include <bit>
 #include <cfloat>
 #include <cmath>
 #include <functional>
@@ -394,11 +395,18 @@ int FBVHierarchy::BuildRange(int s, int e)
 
 void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const
 {
-    OutActor = nullptr;
+    UStaticMeshComponent* Component = nullptr;
+    QueryRayClosestComponent(Ray, Component, OutBestT);
+    OutActor = Component ? Component->GetOwner() : nullptr;
+}
+
+void FBVHierarchy::QueryRayClosestComponent(const FRay& Ray, UStaticMeshComponent*& OutComponent, OUT float& OutBestT) const
+{
+    OutComponent = nullptr;
     // Respect caller-provided initial cap (e.g., far plane) if valid
     if (!(std::isfinite(OutBestT) && OutBestT > 0.0f))
     {
-        OutBestT = std::numeric_limits<float>::infinity();
+        OutBestT = FLT_MAX;
     }
 
     if (Nodes.empty()) return;
@@ -406,81 +414,268 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
     float tminRoot, tmaxRoot;
     if (!RayAABB_IntersectT(Ray, Nodes[0].Bounds, tminRoot, tmaxRoot)) return;
 
-    struct HeapItem {
-        int Idx;
+    struct FStackEntry
+    {
+        int32 Idx;
         float TMin;
-        bool operator<(const HeapItem& other) const { return TMin > other.TMin; } // min-heap behavior
     };
 
-    std::priority_queue<HeapItem> heap;
-    heap.push({ 0, tminRoot });
+    // 가까운 자식을 나중에 넣어 먼저 꺼내는 스택 DFS (힙 없이도 앞쪽 히트로 뒤쪽 노드가 빨리 잘림)
+    TArray<FStackEntry> Stack;
+    Stack.reserve(64);
+    Stack.push_back({ 0, tminRoot });
 
-    const float Epsilon = 1e-3f;
-    bool isPick = false;
-    while (!heap.empty())
+    while (!Stack.empty())
     {
-        HeapItem entry = heap.top();
-        heap.pop();
+        const FStackEntry Entry = Stack.back();
+        Stack.pop_back();
 
-        if (OutActor && entry.TMin > OutBestT + Epsilon)
-            break;
+        if (Entry.TMin > OutBestT)
+            continue;
 
-        const FLBVHNode& node = Nodes[entry.Idx];
+        const FLBVHNode& node = Nodes[Entry.Idx];
         if (node.IsLeaf())
         {
             for (int i = 0; i < node.Count; ++i)
             {
                 UStaticMeshComponent* Component = StaticMeshComponentArray[node.First + i];
                 if (!Component) continue;
+
+                // 리빌드 대기 중 제거된 컴포넌트
+                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+                if (!Cached) continue;
+
                 AActor* Owner = Component->GetOwner();
                 if (!Owner) continue;
                 if (Owner->GetActorHiddenInEditor()) continue;
 
-                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
-
                 float tmin, tmax;
-                if (!RayAABB_IntersectT(Ray, Box, tmin, tmax))
+                if (!RayAABB_IntersectT(Ray, *Cached, tmin, tmax))
                     continue;
-                if (OutActor && tmin > OutBestT + Epsilon)
+                if (tmin > OutBestT)
                     continue;
 
                 float hitDistance;
-                if (CPickingSystem::CheckActorPicking(Owner, Ray, hitDistance))
+                if (CPickingSystem::CheckComponentPicking(Component, Ray, OutBestT, hitDistance))
                 {
-                    if (hitDistance < OutBestT)
-                    {
-                        OutBestT = hitDistance;
-                        OutActor = Owner;
-                        isPick = true;
-                    }
+                    OutBestT = hitDistance;
+                    OutComponent = Component;
                 }
             }
             continue;
         }
-        if (isPick == true)
+
+        float tminL = 0.0f, tmaxL = 0.0f, tminR = 0.0f, tmaxR = 0.0f;
+        const bool bLeft = node.Left >= 0 && RayAABB_IntersectT(Ray, Nodes[node.Left].Bounds, tminL, tmaxL) && tminL <= OutBestT;
+        const bool bRight = node.Right >= 0 && RayAABB_IntersectT(Ray, Nodes[node.Right].Bounds, tminR, tmaxR) && tminR <= OutBestT;
+
+        if (bLeft && bRight)
         {
-            break;
+            if (tminL <= tminR)
+            {
+                Stack.push_back({ node.Right, tminR });
+                Stack.push_back({ node.Left, tminL });
+            }
+            else
+            {
+                Stack.push_back({ node.Left, tminL });
+                Stack.push_back({ node.Right, tminR });
+            }
         }
-        // Internal node: push children if intersected and promising
-        if (node.Left >= 0)
+        else if (bLeft)
         {
-            float tminL, tmaxL;
-            if (RayAABB_IntersectT(Ray, Nodes[node.Left].Bounds, tminL, tmaxL))
+            Stack.push_back({ node.Left, tminL });
+        }
+        else if (bRight)
+        {
+            Stack.push_back({ node.Right, tminR });
+        }
+    }
+}
+
+void FBVHierarchy::QueryRayPacketClosest(const FRay* InRays, int32 InCount, UStaticMeshComponent** OutComponents, float* InOutBestT) const
+{
+    for (int32 i = 0; i < InCount; ++i)
+    {
+        OutComponents[i] = nullptr;
+        if (!(std::isfinite(InOutBestT[i]) && InOutBestT[i] > 0.0f))
+        {
+            InOutBestT[i] = FLT_MAX;
+        }
+    }
+
+    if (Nodes.empty()) return;
+
+    TArray<int32> Stack;
+    Stack.reserve(64);
+
+    for (int32 Base = 0; Base < InCount; Base += 4)
+    {
+        FRayPacket4 Packet;
+        Packet.Set(InRays + Base, std::min(4, InCount - Base));
+
+        // 비활성 레인은 음수 거리로 두어 항상 탈락
+        float LaneBestT[4];
+        for (int32 Lane = 0; Lane < 4; ++Lane)
+        {
+            LaneBestT[Lane] = Lane < Packet.Count ? InOutBestT[Base + Lane] : -1.0f;
+        }
+
+        const FVector OrderDirection(Packet.Direction[0][0], Packet.Direction[1][0], Packet.Direction[2][0]);
+
+        Stack.clear();
+        Stack.push_back(0);
+        while (!Stack.empty())
+        {
+            const FLBVHNode& node = Nodes[Stack.back()];
+            Stack.pop_back();
+
+            if (IntersectRayPacketAABB(Packet, node.Bounds, LaneBestT) == 0)
+                continue;
+
+            if (node.IsLeaf())
             {
-                if (!OutActor || tminL <= OutBestT + Epsilon)
-                    heap.push({ node.Left, tminL });
+                for (int i = 0; i < node.Count; ++i)
+                {
+                    UStaticMeshComponent* Component = StaticMeshComponentArray[node.First + i];
+                    if (!Component) continue;
+
+                    const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+                    if (!Cached) continue;
+
+                    AActor* Owner = Component->GetOwner();
+                    if (!Owner) continue;
+                    if (Owner->GetActorHiddenInEditor()) continue;
+
+                    if (IntersectRayPacketAABB(Packet, *Cached, LaneBestT) == 0)
+                        continue;
+
+                    const uint32 HitMask = CPickingSystem::CheckComponentPickingPacket(Component, Packet, LaneBestT);
+                    for (int32 Lane = 0; Lane < Packet.Count; ++Lane)
+                    {
+                        if (HitMask & (1u << Lane))
+                        {
+                            OutComponents[Base + Lane] = Component;
+                        }
+                    }
+                }
+                continue;
             }
+
+            // 패킷 레이들은 방향이 비슷하다고 보고 첫 레인 방향으로 가까운 자식을 정함
+            const FVector LeftToRight = Nodes[node.Right].Bounds.GetCenter() - Nodes[node.Left].Bounds.GetCenter();
+            if (FVector::Dot(LeftToRight, OrderDirection) >= 0.0f)
+            {
+                Stack.push_back(node.Right);
+                Stack.push_back(node.Left);
+            }
+            else
+            {
+                Stack.push_back(node.Left);
+                Stack.push_back(node.Right);
+            }
+        }
+
+        for (int32 Lane = 0; Lane < Packet.Count; ++Lane)
+        {
+            InOutBestT[Base + Lane] = LaneBestT[Lane];
+        }
+    }
+}
+
+namespace {
+    enum class EFrustumOverlap : uint8
+    {
+        Outside,
+        Intersecting,
+        Inside,
+    };
+
+    // IsAABBVisible + IsAABBIntersects를 한 번에 (완전 내부 노드는 하위 검사를 생략하기 위함)
+    inline EFrustumOverlap ClassifyAABB(const FFrustum& F, const FAABB& B)
+    {
+        const FVector Center = (B.Min + B.Max) * 0.5f;
+        const FVector Extents = (B.Max - B.Min) * 0.5f;
+        const FPlane* Planes[6] = { &F.LeftFace, &F.RightFace, &F.TopFace, &F.BottomFace, &F.NearFace, &F.FarFace };
+
+        EFrustumOverlap Result = EFrustumOverlap::Inside;
+        for (const FPlane* P : Planes)
+        {
+            const FVector4& N = P->Normal;
+            const float Distance = N.X * Center.X + N.Y * Center.Y + N.Z * Center.Z - P->Distance;
+            const float Radius = std::abs(N.X) * Extents.X + std::abs(N.Y) * Extents.Y + std::abs(N.Z) * Extents.Z;
+            if (Distance + Radius < 0.0f)
+                return EFrustumOverlap::Outside;
+            if (Distance - Radius < 0.0f)
+                Result = EFrustumOverlap::Intersecting;
+        }
+        return Result;
+    }
+}
+
+void FBVHierarchy::QueryFrustumMasks(const FFrustum* InFrustums, int32 InCount, uint32 InFirstBit, TMap<UStaticMeshComponent*, uint32>& InOutMasks) const
+{
+    InCount = std::min(InCount, 32 - static_cast<int32>(InFirstBit));
+    if (Nodes.empty() || InCount <= 0) return;
+
+    // 비트 i = InFrustums[i]. Test는 아직 걸친 절두체, Inside는 이 노드를 완전히 담는 절두체
+    struct FFrustumStackEntry
+    {
+        int32 Node;
+        uint32 TestMask;
+        uint32 InsideMask;
+    };
+
+    TArray<FFrustumStackEntry> Stack;
+    Stack.reserve(64);
+    Stack.push_back({ 0, InCount == 32 ? ~0u : (1u << InCount) - 1u, 0u });
+
+    while (!Stack.empty())
+    {
+        const FFrustumStackEntry Entry = Stack.back();
+        Stack.pop_back();
+        const FLBVHNode& Node = Nodes[Entry.Node];
+
+        uint32 TestMask = 0;
+        uint32 InsideMask = Entry.InsideMask;
+        for (uint32 Bits = Entry.TestMask; Bits != 0; Bits &= Bits - 1)
+        {
+            const int32 FrustumIndex = std::countr_zero(Bits);
+            const EFrustumOverlap Overlap = ClassifyAABB(InFrustums[FrustumIndex], Node.Bounds);
+            if (Overlap == EFrustumOverlap::Intersecting)
+                TestMask |= 1u << FrustumIndex;
+            else if (Overlap == EFrustumOverlap::Inside)
+                InsideMask |= 1u << FrustumIndex;
         }
-        if (node.Right >= 0)
+        if ((TestMask | InsideMask) == 0)
+            continue;
+
+        if (Node.IsLeaf())
         {
-            float tminR, tmaxR;
-            if (RayAABB_IntersectT(Ray, Nodes[node.Right].Bounds, tminR, tmaxR))
+            for (int32 i = 0; i < Node.Count; ++i)
             {
-                if (!OutActor || tminR <= OutBestT + Epsilon)
-                    heap.push({ node.Right, tminR });
+                UStaticMeshComponent* Component = StaticMeshComponentArray[Node.First + i];
+                if (!Component) continue;
+                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+                if (!Cached) continue;
+
+                uint32 Mask = InsideMask;
+                for (uint32 Bits = TestMask; Bits != 0; Bits &= Bits - 1)
+                {
+                    const int32 FrustumIndex = std::countr_zero(Bits);
+                    if (IsAABBVisible(InFrustums[FrustumIndex], *Cached))
+                        Mask |= 1u << FrustumIndex;
+                }
+                if (Mask != 0)
+                {
+                    InOutMasks[Component] |= Mask << InFirstBit;
+                }
             }
+            continue;
         }
+
+        if (Node.Left >= 0) Stack.push_back({ Node.Left, TestMask, InsideMask });
+        if (Node.Right >= 0) Stack.push_back({ Node.Right, TestMask, InsideMask });
     }
 }
 
@@ -566,3 +761,13 @@ TArray<UStaticMeshComponent*> FBVHierarchy::QueryIntersectedComponents(const FBo
         [](const FAABB& compBound, const FBoundingSphere& inBound) { return Collision::Intersects(compBound, inBound); }
     );
 }
+
+// FFrustum 오버로드 (액터 Culled 플래그를 건드리지 않는 QueryFrustum, 오클루전 컬링 후보 수집용)
+TArray<UStaticMeshComponent*> FBVHierarchy::QueryIntersectedComponents(const FFrustum& InFrustum) const
+{
+    return QueryIntersectedComponentsGeneric(
+        InFrustum,
+        [](const FAABB& nodeBound, const FFrustum& inFrustum) { return IsAABBVisible(inFrustum, nodeBound); },
+        [](const FAABB& compBound, const FFrustum& inFrustum) { return IsAABBVisible(inFrustum, compBound); }
+    );
+}
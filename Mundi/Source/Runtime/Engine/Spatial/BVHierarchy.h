@@ -33,10 +33,26 @@ public:
     void FlushRebuild();
 
     void QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
+    // 가장 가까운 교차 컴포넌트 (가까운 자식부터 내려가며 OutBestT보다 먼 노드는 건너뜀, 삼각형 단위 판정은 FMeshBVH)
+    void QueryRayClosestComponent(const FRay& Ray, UStaticMeshComponent*& OutComponent, OUT float& OutBestT) const;
+    // 레이 InCount개를 4개씩 패킷으로 묶어 탐색 (마키 선택/호버). InOutBestT[i]는 입력 시 레이별 최대 거리
+    void QueryRayPacketClosest(const FRay* InRays, int32 InCount, UStaticMeshComponent** OutComponents, float* InOutBestT) const;
     void QueryFrustum(const FFrustum& InFrustum);
+    // 절두체 InCount개(최대 32)를 한 번의 순회로 판정. 겹치는 컴포넌트마다 비트 (InFirstBit + i)를 InOutMasks에 OR
+    // 노드가 어떤 절두체 완전히 안이면 그 절두체는 하위에서 다시 검사하지 않음 (쿼드 뷰의 뷰별 절두체 질의를 합침)
+    void QueryFrustumMasks(const FFrustum* InFrustums, int32 InCount, uint32 InFirstBit, TMap<UStaticMeshComponent*, uint32>& InOutMasks) const;
     TArray<UStaticMeshComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
     TArray<UStaticMeshComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
     TArray<UStaticMeshComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
+    TArray<UStaticMeshComponent*> QueryIntersectedComponents(const FFrustum& InFrustum) const;
+    // InBound와 겹치는 컴포넌트마다 InFunc(Component, CachedBound) 호출 (고정 크기 스택, 할당 없음. 캡슐 스윕용)
+    template<typename TFunc>
+    void ForEachComponentInBounds(const FAABB& InBound, TFunc&& InFunc) const;
+    // 등록된 컴포넌트의 마지막 월드 AABB (없으면 nullptr). 포인터 값으로만 찾으므로 이미 지워진 컴포넌트여도 안전
+    const FAABB* FindComponentBounds(const UStaticMeshComponent* InComponent) const
+    {
+        return StaticMeshComponentBounds.Find(const_cast<UStaticMeshComponent*>(InComponent));
+    }
 
     void DebugDraw(URenderer* Renderer) const;
 
@@ -84,3 +100,40 @@ private:
 
     bool bPendingRebuild = false;
 };
+
+template<typename TFunc>
+void FBVHierarchy::ForEachComponentInBounds(const FAABB& InBound, TFunc&& InFunc) const
+{
+    if (Nodes.empty())
+        return;
+
+    int32 Stack[64];
+    int32 StackSize = 0;
+    Stack[StackSize++] = 0;
+    while (StackSize > 0)
+    {
+        const FLBVHNode& Node = Nodes[Stack[--StackSize]];
+        if (!Node.Bounds.Intersects(InBound))
+            continue;
+
+        if (Node.IsLeaf())
+        {
+            for (int32 i = 0; i < Node.Count; ++i)
+            {
+                UStaticMeshComponent* Component = StaticMeshComponentArray[Node.First + i];
+                if (!Component)
+                    continue;
+                // 리빌드 대기 중 제거된 컴포넌트
+                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+                if (Cached && Cached->Intersects(InBound))
+                {
+                    InFunc(Component, *Cached);
+                }
+            }
+            continue;
+        }
+
+        if (Node.Left >= 0) Stack[StackSize++] = Node.Left;
+        if (Node.Right >= 0) Stack[StackSize++] = Node.Right;
+    }
+}
@@ -0,0 +1,110 @@
+﻿#include "pch.h"
+#include "BVHierarchy.h"
+#include "Frustum.h"
+#include "StaticMeshComponent.h"
+#include "ObjectFactory.h"
+#include "SelfTest.h"
+#include <random>
+
+namespace
+{
+	// [InMin, InMax] 상자 모양 절두체 (안쪽을 향하는 법선 6개)
+	FFrustum MakeBoxFrustum(const FVector& InMin, const FVector& InMax)
+	{
+		auto MakePlane = [](const FVector& InNormal, float InDistance)
+		{
+			FPlane Plane;
+			Plane.Normal = FVector4(InNormal.X, InNormal.Y, InNormal.Z, 0.0f);
+			Plane.Distance = InDistance;
+			return Plane;
+		};
+
+		FFrustum Frustum;
+		Frustum.LeftFace = MakePlane(FVector(1.0f, 0.0f, 0.0f), InMin.X);
+		Frustum.RightFace = MakePlane(FVector(-1.0f, 0.0f, 0.0f), -InMax.X);
+		Frustum.BottomFace = MakePlane(FVector(0.0f, 1.0f, 0.0f), InMin.Y);
+		Frustum.TopFace = MakePlane(FVector(0.0f, -1.0f, 0.0f), -InMax.Y);
+		Frustum.NearFace = MakePlane(FVector(0.0f, 0.0f, 1.0f), InMin.Z);
+		Frustum.FarFace = MakePlane(FVector(0.0f, 0.0f, -1.0f), -InMax.Z);
+		return Frustum;
+	}
+}
+
+IMPLEMENT_SELF_TEST(BVHierarchy, FrustumMasksMatchPerViewQueries)
+{
+	// 기본 큐브 메시를 가진 스태틱 메시 컴포넌트를 흩어 놓고 BVH 구성 (소유 액터/월드 없음)
+	std::mt19937 Rng(2024);
+	std::uniform_real_distribution<float> Position(-200.0f, 200.0f);
+	std::uniform_real_distribution<float> Scale(0.5f, 8.0f);
+
+	TArray<UStaticMeshComponent*> Components;
+	for (int32 Index = 0; Index < 600; ++Index)
+	{
+		UStaticMeshComponent* Component = NewObject<UStaticMeshComponent>();
+		Component->SetWorldScale(FVector(Scale(Rng), Scale(Rng), Scale(Rng)));
+		Component->SetWorldLocation(FVector(Position(Rng), Position(Rng), Position(Rng)));
+		Components.Add(Component);
+	}
+
+	FBVHierarchy BVH(FAABB(FVector(-1000.0f, -1000.0f, -1000.0f), FVector(1000.0f, 1000.0f, 1000.0f)));
+	BVH.BulkUpdate(Components);
+
+	// 쿼드 뷰처럼 서로 겹치는 뷰, 떨어진 뷰, 전체를 담는 뷰, 아무것도 없는 뷰
+	TArray<FFrustum> Frustums;
+	Frustums.Add(MakeBoxFrustum(FVector(-150.0f, -150.0f, -150.0f), FVector(20.0f, 20.0f, 20.0f)));
+	Frustums.Add(MakeBoxFrustum(FVector(-20.0f, -60.0f, -100.0f), FVector(150.0f, 150.0f, 60.0f)));
+	Frustums.Add(MakeBoxFrustum(FVector(100.0f, -200.0f, 100.0f), FVector(200.0f, -100.0f, 200.0f)));
+	Frustums.Add(MakeBoxFrustum(FVector(-500.0f, -500.0f, -500.0f), FVector(500.0f, 500.0f, 500.0f)));
+	Frustums.Add(MakeBoxFrustum(FVector(600.0f, 600.0f, 600.0f), FVector(700.0f, 700.0f, 700.0f)));
+
+	// 앞의 뷰 몇 개를 다른 비트 위치에 따로 질의해 누적되는지도 확인 (ResolveView의 개별 재질의 경로)
+	const uint32 FirstBit = 3;
+	TMap<UStaticMeshComponent*, uint32> Masks;
+	BVH.QueryFrustumMasks(Frustums.data(), 2, FirstBit, Masks);
+	BVH.QueryFrustumMasks(Frustums.data() + 2, Frustums.Num() - 2, FirstBit + 2, Masks);
+
+	int32 Mismatches = 0;
+	for (int32 ViewIndex = 0; ViewIndex < Frustums.Num(); ++ViewIndex)
+	{
+		const TArray<UStaticMeshComponent*> Expected = BVH.QueryIntersectedComponents(Frustums[ViewIndex]);
+		TSet<UStaticMeshComponent*> ExpectedSet;
+		for (UStaticMeshComponent* Component : Expected)
+		{
+			ExpectedSet.Add(Component);
+		}
+
+		const uint32 Bit = 1u << (FirstBit + ViewIndex);
+		int32 MaskCount = 0;
+		for (UStaticMeshComponent* Component : Components)
+		{
+			const uint32* Mask = Masks.Find(Component);
+			const bool bInMask = Mask && (*Mask & Bit) != 0;
+			MaskCount += bInMask ? 1 : 0;
+			if (bInMask != ExpectedSet.Contains(Component))
+			{
+				++Mismatches;
+			}
+		}
+		Test.AddInfo("view %d: %d expected, %d in mask", ViewIndex, Expected.Num(), MaskCount);
+	}
+
+	// 고른 뷰 구성이 의미 있는지 (겹침 있음, 전체 뷰는 전부, 빈 뷰는 없음)
+	int32 OverlapCount = 0;
+	uint32 UsedBits = 0;
+	for (const auto& Pair : Masks)
+	{
+		const uint32 ViewBits = Pair.second >> FirstBit;
+		OverlapCount += ((ViewBits & 3u) == 3u) ? 1 : 0;
+		UsedBits |= Pair.second;
+	}
+	SELF_TEST_CHECK(OverlapCount > 0);
+	SELF_TEST_CHECK(BVH.QueryIntersectedComponents(Frustums[3]).Num() == Components.Num());
+	SELF_TEST_CHECK(BVH.QueryIntersectedComponents(Frustums[4]).IsEmpty());
+	SELF_TEST_CHECK((UsedBits & ((1u << FirstBit) - 1u)) == 0);
+	SELF_TEST_CHECK(Mismatches == 0);
+
+	for (UStaticMeshComponent* Component : Components)
+	{
+		ObjectFactory::DeleteObject(Component);
+	}
+}
@@ -1,10 +1,12 @@
 ﻿#include "pch.h"
 #include "MeshBVH.h"
+#include <immintrin.h>
 
 void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
 {
 	TriIndices.Empty();
 	Nodes.Empty();
+	TrianglePacks.Empty();
 	uint32 TriCount = Indices.Num() / 3;
 	if (TriCount == 0) return;
 
@@ -13,180 +15,303 @@ void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>
 		TriIndices.Add(t);
 
 	BuildRecursive(0, TriCount, Vertices, Indices);
+	BuildTrianglePacks(Vertices, Indices);
 }
 
-// 삼각형과 맞을 경우 , BVH를 따라 내려가면서 교차 가능성 있는 노드만 검사한다. 
-// Möller–Trumbore로 교차 체크 ! 
-bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
-	const TArray<FNormalVertex>& InVertices,
-	const TArray<uint32>& InIndices,
-	float& OutHitDistance)
+// 리프마다 삼각형을 SoA 묶음으로 복사 (V0, Edge1 = V1 - V0, Edge2 = V2 - V0)
+void FMeshBVH::BuildTrianglePacks(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
 {
-	if (Nodes.Num() == 0)
+	TrianglePacks.Empty();
+	for (FMeshBVHNode& Node : Nodes)
 	{
-		return false;
+		if (!Node.IsLeaf())
+		{
+			continue;
+		}
+
+		FMeshBVHTrianglePack Pack{};
+		for (uint32 Lane = 0; Lane < Node.Count; ++Lane)
+		{
+			const uint32 TriangleID = TriIndices[Node.Start + Lane];
+			const FVector& A = Vertices[Indices[3 * TriangleID + 0]].pos;
+			const FVector& B = Vertices[Indices[3 * TriangleID + 1]].pos;
+			const FVector& C = Vertices[Indices[3 * TriangleID + 2]].pos;
+			const FVector Edge1 = B - A;
+			const FVector Edge2 = C - A;
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				Pack.V0[Axis][Lane] = A[Axis];
+				Pack.Edge1[Axis][Lane] = Edge1[Axis];
+				Pack.Edge2[Axis][Lane] = Edge2[Axis];
+			}
+		}
+
+		Node.Pack = TrianglePacks.Num();
+		TrianglePacks.Add(Pack);
 	}
+}
 
-	float RootEntry, RootExit;
-	if (!Nodes[0].Bounds.IntersectsRay(InLocalRay, RootEntry, RootExit))
+namespace
+{
+	constexpr int32 MaxTraversalStack = 64;
+
+	// 미리 구한 역방향으로 슬랩 검사. [0, InMaxDistance] 구간에서 박스에 들어가는 거리
+	inline bool IntersectSlab(const FAABB& InBox, const FVector& InOrigin, const float InInvDirection[3], float InMaxDistance, float& OutEnter)
 	{
-		return false;
+		float Enter = 0.0f;
+		float Exit = InMaxDistance;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const float T1 = (InBox.Min[Axis] - InOrigin[Axis]) * InInvDirection[Axis];
+			const float T2 = (InBox.Max[Axis] - InOrigin[Axis]) * InInvDirection[Axis];
+			Enter = std::max(Enter, std::min(T1, T2));
+			Exit = std::min(Exit, std::max(T1, T2));
+		}
+		OutEnter = Enter;
+		return Enter <= Exit;
 	}
 
-	struct FHeapItem
+	// 레이 4개 vs 박스 1개. 통과하는 레인 비트마스크 (InMaxDistance가 음수인 레인은 항상 실패)
+	inline int32 IntersectSlab4(const FAABB& InBox, const __m128 InOrigin[3], const __m128 InInvDirection[3], __m128 InMaxDistance)
 	{
-		int NodeIndex;
-		float EntryDistance;
-
-		bool operator>(const FHeapItem& Other) const
+		__m128 Enter = _mm_setzero_ps();
+		__m128 Exit = InMaxDistance;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
 		{
-			return EntryDistance > Other.EntryDistance; // 최소 힙
+			const __m128 T1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(InBox.Min[Axis]), InOrigin[Axis]), InInvDirection[Axis]);
+			const __m128 T2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(InBox.Max[Axis]), InOrigin[Axis]), InInvDirection[Axis]);
+			Enter = _mm_max_ps(Enter, _mm_min_ps(T1, T2));
+			Exit = _mm_min_ps(Exit, _mm_max_ps(T1, T2));
 		}
-	};
+		return _mm_movemask_ps(_mm_cmple_ps(Enter, Exit));
+	}
+
+	// 4레인 Möller–Trumbore. 레인마다 (레이, 삼각형) 한 쌍이며 IntersectRayTriangleMT와 같은 연산 순서/허용 오차
+	// 교차하고 InBestT보다 가까운 레인은 거리, 나머지는 +inf
+	inline __m128 IntersectTriangles4(const __m128 InOrigin[3], const __m128 InDirection[3],
+		const __m128 InV0[3], const __m128 InEdge1[3], const __m128 InEdge2[3], __m128 InBestT)
+	{
+		const __m128 Epsilon = _mm_set1_ps(KINDA_SMALL_NUMBER);
+		const __m128 NegEpsilon = _mm_set1_ps(-KINDA_SMALL_NUMBER);
+		const __m128 OnePlusEpsilon = _mm_set1_ps(1.0f + KINDA_SMALL_NUMBER);
+
+		// Perpendicular = Cross(Direction, Edge2)
+		const __m128 PX = _mm_sub_ps(_mm_mul_ps(InDirection[1], InEdge2[2]), _mm_mul_ps(InDirection[2], InEdge2[1]));
+		const __m128 PY = _mm_sub_ps(_mm_mul_ps(InDirection[2], InEdge2[0]), _mm_mul_ps(InDirection[0], InEdge2[2]));
+		const __m128 PZ = _mm_sub_ps(_mm_mul_ps(InDirection[0], InEdge2[1]), _mm_mul_ps(InDirection[1], InEdge2[0]));
+
+		const __m128 Determinant = _mm_add_ps(_mm_add_ps(_mm_mul_ps(InEdge1[0], PX), _mm_mul_ps(InEdge1[1], PY)), _mm_mul_ps(InEdge1[2], PZ));
+		const __m128 InvDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), Determinant);
+
+		const __m128 SX = _mm_sub_ps(InOrigin[0], InV0[0]);
+		const __m128 SY = _mm_sub_ps(InOrigin[1], InV0[1]);
+		const __m128 SZ = _mm_sub_ps(InOrigin[2], InV0[2]);
+		const __m128 U = _mm_mul_ps(InvDeterminant, _mm_add_ps(_mm_add_ps(_mm_mul_ps(SX, PX), _mm_mul_ps(SY, PY)), _mm_mul_ps(SZ, PZ)));
+
+		// CrossQ = Cross(OriginToA, Edge1)
+		const __m128 QX = _mm_sub_ps(_mm_mul_ps(SY, InEdge1[2]), _mm_mul_ps(SZ, InEdge1[1]));
+		const __m128 QY = _mm_sub_ps(_mm_mul_ps(SZ, InEdge1[0]), _mm_mul_ps(SX, InEdge1[2]));
+		const __m128 QZ = _mm_sub_ps(_mm_mul_ps(SX, InEdge1[1]), _mm_mul_ps(SY, InEdge1[0]));
+		const __m128 V = _mm_mul_ps(InvDeterminant, _mm_add_ps(_mm_add_ps(_mm_mul_ps(InDirection[0], QX), _mm_mul_ps(InDirection[1], QY)), _mm_mul_ps(InDirection[2], QZ)));
+		const __m128 T = _mm_mul_ps(InvDeterminant, _mm_add_ps(_mm_add_ps(_mm_mul_ps(InEdge2[0], QX), _mm_mul_ps(InEdge2[1], QY)), _mm_mul_ps(InEdge2[2], QZ)));
+
+		// 행렬식이 (-Epsilon, Epsilon)이면 평행 (빈 레인은 0이라 여기서 탈락, NaN 비교도 모두 false)
+		__m128 Mask = _mm_or_ps(_mm_cmple_ps(Determinant, NegEpsilon), _mm_cmpge_ps(Determinant, Epsilon));
+		Mask = _mm_and_ps(Mask, _mm_cmpge_ps(U, NegEpsilon));
+		Mask = _mm_and_ps(Mask, _mm_cmple_ps(U, OnePlusEpsilon));
+		Mask = _mm_and_ps(Mask, _mm_cmpge_ps(V, NegEpsilon));
+		Mask = _mm_and_ps(Mask, _mm_cmple_ps(_mm_add_ps(U, V), OnePlusEpsilon));
+		Mask = _mm_and_ps(Mask, _mm_cmpgt_ps(T, Epsilon));
+		Mask = _mm_and_ps(Mask, _mm_cmplt_ps(T, InBestT));
+
+		return _mm_or_ps(_mm_and_ps(Mask, T), _mm_andnot_ps(Mask, _mm_set1_ps(FLT_MAX)));
+	}
+
+	inline float HorizontalMin(__m128 InValue)
+	{
+		InValue = _mm_min_ps(InValue, _mm_shuffle_ps(InValue, InValue, _MM_SHUFFLE(2, 3, 0, 1)));
+		InValue = _mm_min_ps(InValue, _mm_shuffle_ps(InValue, InValue, _MM_SHUFFLE(1, 0, 3, 2)));
+		return _mm_cvtss_f32(InValue);
+	}
+}
+
+// 가까운 자식부터 내려가는 스택 DFS. 이미 찾은 교차보다 먼 노드/삼각형은 건너뛰므로 결과는 항상 최단 교차
+// 리프는 삼각형 묶음 하나를 레이 1개와 SSE로 검사
+bool FMeshBVH::IntersectRay(const FRay& InLocalRay, float& OutHitDistance, float InMaxDistance) const
+{
+	if (Nodes.Num() == 0)
+	{
+		return false;
+	}
+
+	const float InvDirection[3] = {
+		FRayPacket4::SafeInverse(InLocalRay.Direction.X),
+		FRayPacket4::SafeInverse(InLocalRay.Direction.Y),
+		FRayPacket4::SafeInverse(InLocalRay.Direction.Z) };
+
+	float BestT = InMaxDistance;
+	float RootEnter;
+	if (!IntersectSlab(Nodes[0].Bounds, InLocalRay.Origin, InvDirection, BestT, RootEnter))
+	{
+		return false;
+	}
 
-	std::priority_queue<FHeapItem, TArray<FHeapItem>, std::greater<FHeapItem>> Heap;
-	Heap.push({ 0, RootEntry });
+	const __m128 Origin[3] = { _mm_set1_ps(InLocalRay.Origin.X), _mm_set1_ps(InLocalRay.Origin.Y), _mm_set1_ps(InLocalRay.Origin.Z) };
+	const __m128 Direction[3] = { _mm_set1_ps(InLocalRay.Direction.X), _mm_set1_ps(InLocalRay.Direction.Y), _mm_set1_ps(InLocalRay.Direction.Z) };
 
-	while (!Heap.empty())
+	FStackItem Stack[MaxTraversalStack];
+	int32 StackSize = 0;
+	Stack[StackSize++] = { 0, RootEnter };
+	bool bHasHit = false;
+
+	while (StackSize > 0)
 	{
-		FHeapItem Current = Heap.top();
-		Heap.pop();
+		const FStackItem Current = Stack[--StackSize];
+		// 이미 더 가까운 교차가 있으면 무시
+		if (Current.EntryDistance > BestT)
+		{
+			continue;
+		}
 
 		const FMeshBVHNode& Node = Nodes[Current.NodeIndex];
 		if (Node.IsLeaf())
 		{
-			for (uint32 TriOffset = 0; TriOffset < Node.Count; ++TriOffset)
+			const FMeshBVHTrianglePack& Pack = TrianglePacks[Node.Pack];
+			const __m128 V0[3] = { _mm_load_ps(Pack.V0[0]), _mm_load_ps(Pack.V0[1]), _mm_load_ps(Pack.V0[2]) };
+			const __m128 Edge1[3] = { _mm_load_ps(Pack.Edge1[0]), _mm_load_ps(Pack.Edge1[1]), _mm_load_ps(Pack.Edge1[2]) };
+			const __m128 Edge2[3] = { _mm_load_ps(Pack.Edge2[0]), _mm_load_ps(Pack.Edge2[1]), _mm_load_ps(Pack.Edge2[2]) };
+
+			const float LeafT = HorizontalMin(IntersectTriangles4(Origin, Direction, V0, Edge1, Edge2, _mm_set1_ps(BestT)));
+			if (LeafT < BestT)
 			{
-				const uint32 TriangleID = TriIndices[Node.Start + TriOffset];
-				const uint32 V0 = InIndices[3 * TriangleID + 0];
-				const uint32 V1 = InIndices[3 * TriangleID + 1];
-				const uint32 V2 = InIndices[3 * TriangleID + 2];
-
-				const FVector& A = InVertices[V0].pos;
-				const FVector& B = InVertices[V1].pos;
-				const FVector& C = InVertices[V2].pos;
-
-				float HitT = 0.0f;
-				if (IntersectRayTriangleMT(InLocalRay, A, B, C, HitT))
-				{
-					OutHitDistance = HitT;
-					return true; // 🚀 첫 번째 히트 → 바로 종료
-				}
+				BestT = LeafT;
+				bHasHit = true;
 			}
+			continue;
 		}
-		else
+
+		float LeftEnter = 0.0f, RightEnter = 0.0f;
+		const bool bLeft = Node.Left >= 0 && IntersectSlab(Nodes[Node.Left].Bounds, InLocalRay.Origin, InvDirection, BestT, LeftEnter);
+		const bool bRight = Node.Right >= 0 && IntersectSlab(Nodes[Node.Right].Bounds, InLocalRay.Origin, InvDirection, BestT, RightEnter);
+
+		// 먼 자식을 먼저 넣어 가까운 자식이 먼저 나오도록
+		if (bLeft && bRight)
 		{
-			if (Node.Left >= 0)
+			if (LeftEnter <= RightEnter)
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Left].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
-				{
-					Heap.push({ Node.Left, ChildEntry });
-				}
+				Stack[StackSize++] = { Node.Right, RightEnter };
+				Stack[StackSize++] = { Node.Left, LeftEnter };
 			}
-			if (Node.Right >= 0)
+			else
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Right].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
-				{
-					Heap.push({ Node.Right, ChildEntry });
-				}
+				Stack[StackSize++] = { Node.Left, LeftEnter };
+				Stack[StackSize++] = { Node.Right, RightEnter };
 			}
 		}
+		else if (bLeft)
+		{
+			Stack[StackSize++] = { Node.Left, LeftEnter };
+		}
+		else if (bRight)
+		{
+			Stack[StackSize++] = { Node.Right, RightEnter };
+		}
 	}
 
+	if (bHasHit)
+	{
+		OutHitDistance = BestT;
+		return true;
+	}
 	return false;
 }
-//bool FMeshBVH::IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance)
-//{
-//	if (Nodes.Num() == 0)
-//	{
-//		return false;
-//	}
-//
-//	TArray<FStackItem> NodeStack;
-//
-//	float RootEntryDistance, RootExitDistance;
-//	// 루트 노드가 안맞으면 바로 리턴 
-//	if (!Nodes[0].Bounds.RayAABB_IntersectT(InLocalRay, RootEntryDistance, RootExitDistance))
-//	{
-//		return false;
-//	}
-//	// 가장 늦게 나간 RootEntryDistance
-//	// 삼각형 리스트 인덱스 , 디스턴스 값 저장 
-//	NodeStack.Add({ 0, RootEntryDistance });
-//	bool bHasHit = false;
-//	float ClosestHitDistance = std::numeric_limits<float>::infinity();
-//
-//	// 깊이 우선 탐색 (DFS). 
-//	// 이미 더 가까운 교차가 있으면 멀리 있는 노드는 스킵.
-//	while (!NodeStack.IsEmpty())
-//	{
-//		const FStackItem CurrentItem = NodeStack.Pop();
-//		// 이미 가까운 교차가 있으면 무시 
-//		if (CurrentItem.EntryDistance > ClosestHitDistance)
-//		{
-//			continue;
-//		}
-//
-//		const FMeshBVHNode& CurrentNode = Nodes[CurrentItem.NodeIndex];
-//		if (CurrentNode.IsLeaf())
-//		{
-//			// 총 삼각형의 개수 만큼 돈다. 
-//			for (uint32 TriangleOffset = 0; TriangleOffset < CurrentNode.Count; ++TriangleOffset)
-//			{
-//				// 삼각형 배열에서 시작 위치 Start, TriangleOffset 삼각형의 총 개수만큼 돈다. 
-//				// 그쪽 영역의 삼각형이기 때문이다
-//				const uint32 TriangleID = TriIndices[CurrentNode.Start + TriangleOffset];
-//
-//				const uint32 VertexIndex0 = InIndices[3 * TriangleID + 0];
-//				const uint32 VertexIndex1 = InIndices[3 * TriangleID + 1];
-//				const uint32 VertexIndex2 = InIndices[3 * TriangleID + 2];
-//
-//				const FVector& VertexA = InVertices[VertexIndex0].pos;
-//				const FVector& VertexB = InVertices[VertexIndex1].pos;
-//				const FVector& VertexC = InVertices[VertexIndex2].pos;
-//
-//				float HitDistance = 0.0f;
-//				if (IntersectRayTriangleMT(InLocalRay, VertexA, VertexB, VertexC, HitDistance))
-//				{
-//					if (HitDistance < ClosestHitDistance)
-//					{
-//						ClosestHitDistance = HitDistance;
-//						bHasHit = true;
-//					}
-//				}
-//			}
-//			continue;
-//		}
-//
-//		// 내부 노드 → 자식 검사
-//		// 삼각형에 맞으면, 검사 영역에 넣어주고 맞지 않으면 넣어주지 않는다. 
-//		if (CurrentNode.Left >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Left].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Left, ChildEntry });
-//			}
-//		}
-//		if (CurrentNode.Right >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Right].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Right, ChildEntry });
-//			}
-//		}
-//	}
-//
-//	if (bHasHit)
-//	{
-//		OutHitDistance = ClosestHitDistance;
-//		return true;
-//	}
-//	return false;
-//}
+
+// 레이 4개가 노드를 함께 내려감. 노드는 꺼낼 때 현재 레인별 최단 거리로 다시 검사해 살아 있는 레인이 없으면 버림
+// 리프는 삼각형을 하나씩 4레인에 브로드캐스트해 레이 4개와 동시에 검사
+uint32 FMeshBVH::IntersectRayPacket(const FRayPacket4& InLocalPacket, float InOutHitDistances[4]) const
+{
+	if (Nodes.Num() == 0 || InLocalPacket.Count <= 0)
+	{
+		return 0;
+	}
+
+	const __m128 Origin[3] = { _mm_load_ps(InLocalPacket.Origin[0]), _mm_load_ps(InLocalPacket.Origin[1]), _mm_load_ps(InLocalPacket.Origin[2]) };
+	const __m128 Direction[3] = { _mm_load_ps(InLocalPacket.Direction[0]), _mm_load_ps(InLocalPacket.Direction[1]), _mm_load_ps(InLocalPacket.Direction[2]) };
+	const __m128 InvDirection[3] = { _mm_load_ps(InLocalPacket.InvDirection[0]), _mm_load_ps(InLocalPacket.InvDirection[1]), _mm_load_ps(InLocalPacket.InvDirection[2]) };
+
+	// 비활성 레인은 최대 거리를 음수로 두어 슬랩/삼각형 검사에서 항상 탈락
+	const uint32 ActiveMask = (1u << std::min(InLocalPacket.Count, 4)) - 1u;
+	alignas(16) float BestInit[4];
+	for (int32 Lane = 0; Lane < 4; ++Lane)
+	{
+		BestInit[Lane] = (ActiveMask & (1u << Lane)) ? InOutHitDistances[Lane] : -1.0f;
+	}
+	__m128 BestT = _mm_load_ps(BestInit);
+
+	// 자식 순서는 첫 활성 레인의 방향 기준 (패킷 레이들은 방향이 비슷하다고 가정)
+	const FVector OrderDirection(InLocalPacket.Direction[0][0], InLocalPacket.Direction[1][0], InLocalPacket.Direction[2][0]);
+
+	int32 Stack[MaxTraversalStack];
+	int32 StackSize = 0;
+	Stack[StackSize++] = 0;
+	int32 HitMask = 0;
+
+	while (StackSize > 0)
+	{
+		const FMeshBVHNode& Node = Nodes[Stack[--StackSize]];
+		if (IntersectSlab4(Node.Bounds, Origin, InvDirection, BestT) == 0)
+		{
+			continue;
+		}
+
+		if (Node.IsLeaf())
+		{
+			const FMeshBVHTrianglePack& Pack = TrianglePacks[Node.Pack];
+			for (uint32 Tri = 0; Tri < Node.Count; ++Tri)
+			{
+				const __m128 V0[3] = { _mm_set1_ps(Pack.V0[0][Tri]), _mm_set1_ps(Pack.V0[1][Tri]), _mm_set1_ps(Pack.V0[2][Tri]) };
+				const __m128 Edge1[3] = { _mm_set1_ps(Pack.Edge1[0][Tri]), _mm_set1_ps(Pack.Edge1[1][Tri]), _mm_set1_ps(Pack.Edge1[2][Tri]) };
+				const __m128 Edge2[3] = { _mm_set1_ps(Pack.Edge2[0][Tri]), _mm_set1_ps(Pack.Edge2[1][Tri]), _mm_set1_ps(Pack.Edge2[2][Tri]) };
+
+				const __m128 T = IntersectTriangles4(Origin, Direction, V0, Edge1, Edge2, BestT);
+				HitMask |= _mm_movemask_ps(_mm_cmplt_ps(T, _mm_set1_ps(FLT_MAX)));
+				BestT = _mm_min_ps(BestT, T);
+			}
+			continue;
+		}
+
+		if (Node.Left < 0 || Node.Right < 0)
+		{
+			if (Node.Left >= 0) Stack[StackSize++] = Node.Left;
+			if (Node.Right >= 0) Stack[StackSize++] = Node.Right;
+			continue;
+		}
+
+		const FVector LeftToRight = Nodes[Node.Right].Bounds.GetCenter() - Nodes[Node.Left].Bounds.GetCenter();
+		if (FVector::Dot(LeftToRight, OrderDirection) >= 0.0f)
+		{
+			Stack[StackSize++] = Node.Right;
+			Stack[StackSize++] = Node.Left;
+		}
+		else
+		{
+			Stack[StackSize++] = Node.Left;
+			Stack[StackSize++] = Node.Right;
+		}
+	}
+
+	alignas(16) float BestOut[4];
+	_mm_store_ps(BestOut, BestT);
+	const uint32 Updated = static_cast<uint32>(HitMask) & ActiveMask;
+	for (int32 Lane = 0; Lane < 4; ++Lane)
+	{
+		if (Updated & (1u << Lane))
+		{
+			InOutHitDistances[Lane] = BestOut[Lane];
+		}
+	}
+	return Updated;
+}
 
 FAABB FMeshBVH::ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
 {
@@ -217,6 +342,15 @@ FAABB FMeshBVH::ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>&
 		std::max({ VertexA.Z, VertexB.Z, VertexC.Z })
 	);
 
+	// IntersectRayTriangleMT는 무게중심 좌표가 Epsilon만큼 벗어나도 교차로 보므로,
+	// 공유 에지 위의 히트가 양쪽 노드 슬랩 검사에서 모두 빠지지 않도록 그만큼(+ 반올림 여유) 넓힘
+	const FVector Size = MaxCorner - MinCorner;
+	const float Magnitude = std::max({ std::fabs(MinCorner.X), std::fabs(MinCorner.Y), std::fabs(MinCorner.Z),
+		std::fabs(MaxCorner.X), std::fabs(MaxCorner.Y), std::fabs(MaxCorner.Z) });
+	const float Pad = 4.0f * KINDA_SMALL_NUMBER * (std::max({ Size.X, Size.Y, Size.Z }) + Magnitude);
+	MinCorner = MinCorner - FVector(Pad, Pad, Pad);
+	MaxCorner = MaxCorner + FVector(Pad, Pad, Pad);
+
 	// 삼각형의 바운딩 박스 반환
 	return FAABB(MinCorner, MaxCorner);
 }
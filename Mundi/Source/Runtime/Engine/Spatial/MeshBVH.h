@@ -8,10 +8,20 @@ struct FMeshBVHNode
 	int Right = -1;    // 오른쪽 자식 인덱스
 	uint32 Start = 0;  // TriIndices 배열에서 시작 위치
 	uint32 Count = 0;  // 리프 노드라면 포함된 삼각형 개수 
+	int32 Pack = -1;   // 리프 노드라면 TrianglePacks 인덱스
 
 	bool IsLeaf() const { return Count > 0; }
 };
 
+// 리프 하나의 삼각형(최대 LeafSize = 4개)을 SSE 한 번으로 검사하기 위한 SoA 묶음 ([축][레인])
+// 빈 레인은 Edge가 0이라 행렬식이 0 -> 항상 교차 실패
+struct alignas(16) FMeshBVHTrianglePack
+{
+	float V0[3][4];
+	float Edge1[3][4];
+	float Edge2[3][4];
+};
+
 struct FStackItem
 {
 	int32 NodeIndex;
@@ -23,8 +33,51 @@ public:
 
 	void Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
-	bool IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance);
+	// 가장 가까운 교차 (가까운 자식부터 내려가며 현재 최단 거리보다 먼 노드는 건너뜀)
+	// 리프의 삼각형 4개를 SSE로 한 번에 Möller–Trumbore 검사 (IntersectRayTriangleMT와 같은 판정)
+	bool IntersectRay(const FRay& InLocalRay, float& OutHitDistance, float InMaxDistance = FLT_MAX) const;
+
+	// 레이 4개 패킷을 한 번에 탐색. InOutHitDistances[i]는 입력 시 레인별 최대 거리, 더 가까운 교차가 있으면 갱신
+	// 반환값은 갱신된 레인 비트마스크
+	uint32 IntersectRayPacket(const FRayPacket4& InLocalPacket, float InOutHitDistances[4]) const;
 
+	// InLocalBox와 겹치는 리프의 삼각형마다 InFunc(A, B, C) 호출 (로컬 공간, 고정 크기 스택이라 할당 없음)
+	template<typename TFunc>
+	void ForEachTriangleInBounds(const FAABB& InLocalBox, TFunc&& InFunc) const
+	{
+		if (Nodes.Num() == 0)
+		{
+			return;
+		}
+
+		int32 Stack[64];
+		int32 StackSize = 0;
+		Stack[StackSize++] = 0;
+		while (StackSize > 0)
+		{
+			const FMeshBVHNode& Node = Nodes[Stack[--StackSize]];
+			if (!Node.Bounds.Intersects(InLocalBox))
+			{
+				continue;
+			}
+
+			if (Node.IsLeaf())
+			{
+				const FMeshBVHTrianglePack& Pack = TrianglePacks[Node.Pack];
+				for (uint32 Lane = 0; Lane < Node.Count; ++Lane)
+				{
+					const FVector A(Pack.V0[0][Lane], Pack.V0[1][Lane], Pack.V0[2][Lane]);
+					const FVector B = A + FVector(Pack.Edge1[0][Lane], Pack.Edge1[1][Lane], Pack.Edge1[2][Lane]);
+					const FVector C = A + FVector(Pack.Edge2[0][Lane], Pack.Edge2[1][Lane], Pack.Edge2[2][Lane]);
+					InFunc(A, B, C);
+				}
+				continue;
+			}
+
+			if (Node.Left >= 0) Stack[StackSize++] = Node.Left;
+			if (Node.Right >= 0) Stack[StackSize++] = Node.Right;
+		}
+	}
 
 private:
 	// Helper 함수들
@@ -36,12 +89,15 @@ private:
 
 	int BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
+	void BuildTrianglePacks(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
+
 private:
 
 	TArray<FMeshBVHNode> Nodes;
 	//삼각형 ID(번호) 목록 , 삼각형의 인덱스를 의미한다. 
 	//삼각형 순서만 재배치  , 정점 좌표와 인덱스 버퍼를 직접적으로 건들면 안되기 때문이다.
 	TArray<uint32> TriIndices;
+	TArray<FMeshBVHTrianglePack> TrianglePacks;
 	const uint32 LeafSize = 4;
 };
 
@@ -1,228 +1,525 @@
 ﻿#include "pch.h"
 #include "Occlusion.h"
-#include "Frustum.h"
+#include "ParallelFor.h"
+#include "PlatformTime.h"
+#include <immintrin.h>
 
-// NDC Z가 [-1..1]인 프로젝션이면 아래 변환을 켜세요.
-// static inline float To01(float z_ndc) { return z_ndc * 0.5f + 0.5f; }
-static inline void Clamp01(float& v) { v = std::max(0.0f, std::min(1.0f, v)); }
+namespace
+{
+	// 행벡터 규약 p * M (SSE 행 조합)
+	inline __m128 TransformPoint(const FMatrix& M, float X, float Y, float Z)
+	{
+		__m128 Result = _mm_mul_ps(_mm_set1_ps(X), M.Rows[0]);
+		Result = _mm_add_ps(Result, _mm_mul_ps(_mm_set1_ps(Y), M.Rows[1]));
+		Result = _mm_add_ps(Result, _mm_mul_ps(_mm_set1_ps(Z), M.Rows[2]));
+		return _mm_add_ps(Result, M.Rows[3]);
+	}
 
-// 헬퍼: 뷰공간 Z → [0..1] 선형
-static inline float LinearizeZ01(float zView, float zNear, float zFar) {
-	// LH 기준, 카메라 앞 z가 + 방향일 때
-	float z = (zView - zNear) / (zFar - zNear);
-	return std::max(0.f, std::min(1.f, z));
-}
+	// AABB 8코너를 투영해 NDC 범위를 구함. 코너 하나라도 근평면(z_clip < 0) 뒤면 false
+	bool ProjectAABB(const FMatrix& InViewProj, const FAABB& InBound, float OutNdcMin[3], float OutNdcMax[2])
+	{
+		// 축별 항을 먼저 곱해 두고 8코너는 덧셈 조합으로
+		const __m128 XMin = _mm_mul_ps(_mm_set1_ps(InBound.Min.X), InViewProj.Rows[0]);
+		const __m128 XMax = _mm_mul_ps(_mm_set1_ps(InBound.Max.X), InViewProj.Rows[0]);
+		const __m128 YMin = _mm_mul_ps(_mm_set1_ps(InBound.Min.Y), InViewProj.Rows[1]);
+		const __m128 YMax = _mm_mul_ps(_mm_set1_ps(InBound.Max.Y), InViewProj.Rows[1]);
+		const __m128 ZMin = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(InBound.Min.Z), InViewProj.Rows[2]), InViewProj.Rows[3]);
+		const __m128 ZMax = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(InBound.Max.Z), InViewProj.Rows[2]), InViewProj.Rows[3]);
+
+		__m128 NdcMin = _mm_set1_ps(FLT_MAX);
+		__m128 NdcMax = _mm_set1_ps(-FLT_MAX);
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			const __m128 Clip = _mm_add_ps(_mm_add_ps((Corner & 1) ? XMax : XMin, (Corner & 2) ? YMax : YMin), (Corner & 4) ? ZMax : ZMin);
+			alignas(16) float C[4];
+			_mm_store_ps(C, Clip);
+			if (C[2] < 0.0f)
+			{
+				return false;
+			}
+			const __m128 Ndc = _mm_div_ps(Clip, _mm_shuffle_ps(Clip, Clip, _MM_SHUFFLE(3, 3, 3, 3)));
+			NdcMin = _mm_min_ps(NdcMin, Ndc);
+			NdcMax = _mm_max_ps(NdcMax, Ndc);
+		}
 
-// FBound(Min/Max) → 8코너
-static inline void MakeAabbCornersMinMax(const FAABB& B, FVector Corners[8])
-{
-	const FVector& mn = B.Min;
-	const FVector& mx = B.Max;
-	Corners[0] = { mn.X, mn.Y, mn.Z };
-	Corners[1] = { mx.X, mn.Y, mn.Z };
-	Corners[2] = { mn.X, mx.Y, mn.Z };
-	Corners[3] = { mx.X, mx.Y, mn.Z };
-	Corners[4] = { mn.X, mn.Y, mx.Z };
-	Corners[5] = { mx.X, mn.Y, mx.Z };
-	Corners[6] = { mn.X, mx.Y, mx.Z };
-	Corners[7] = { mx.X, mx.Y, mx.Z };
+		alignas(16) float Min[4];
+		alignas(16) float Max[4];
+		_mm_store_ps(Min, NdcMin);
+		_mm_store_ps(Max, NdcMax);
+		OutNdcMin[0] = Min[0]; OutNdcMin[1] = Min[1]; OutNdcMin[2] = Min[2];
+		OutNdcMax[0] = Max[0]; OutNdcMax[1] = Max[1];
+		return true;
+	}
+
+	// 클립 공간 선분과 z = 0 평면의 교점
+	inline void LerpClip(const float* A, const float* B, float* Out)
+	{
+		const float T = A[2] / (A[2] - B[2]);
+		for (int32 i = 0; i < 4; ++i)
+		{
+			Out[i] = A[i] + (B[i] - A[i]) * T;
+		}
+		Out[2] = 0.0f;
+	}
 }
 
-bool FOcclusionCullingManagerCPU::ComputeRectAndMinZ(
-	const FCandidateDrawable& D, int /*ViewW*/, int /*ViewH*/, FOcclusionRect& OutR)
+//====================================================================================
+// FOcclusionDepthBuffer
+//====================================================================================
+void FOcclusionDepthBuffer::Initialize(int32 InWidth, int32 InHeight)
 {
-	FVector C[8];
-	MakeAabbCornersMinMax(D.Bound, C);
-
-	float MinX = +1e9f, MinY = +1e9f, MaxX = -1e9f, MaxY = -1e9f;
-	float MinZLin = +1e9f, MaxZLin = -1e9f; // ★ 선형 깊이(0..1)
+	Width = std::max(1, InWidth);
+	Height = std::max(1, InHeight);
 
-	int used = 0;
-	for (int i = 0; i < 8; i++)
+	Mips.Empty();
+	size_t TotalSize = 0;
+	int32 MipWidth = Width, MipHeight = Height;
+	while (true)
 	{
-		const float p[4] = { C[i].X, C[i].Y, C[i].Z, 1.0f };
+		Mips.Add(FMip{ MipWidth, MipHeight, TotalSize });
+		TotalSize += static_cast<size_t>(MipWidth) * MipHeight;
+		if (MipWidth == 1 && MipHeight == 1)
+		{
+			break;
+		}
+		// 홀수 크기는 올림 (마지막 텍셀은 남은 한 줄만 덮음)
+		MipWidth = (MipWidth + 1) / 2;
+		MipHeight = (MipHeight + 1) / 2;
+	}
 
-		// 1) 화면 사각형용: WVP → NDC
-		float c[4];
-		MulPointRow(p, D.WorldViewProj, c);
-		if (c[3] <= 0.0f) continue;
+	Data.assign(TotalSize, 1.0f);
+}
 
-		const float invW = 1.0f / c[3];
-		const float ndcX = c[0] * invW;  // -1..1
-		const float ndcY = c[1] * invW;  // -1..1
-		// const float ndcZ = c[2] * invW; // 깊이는 쓰지 않음
+void FOcclusionDepthBuffer::Clear()
+{
+	std::fill(Data.begin(), Data.begin() + static_cast<size_t>(Width) * Height, 1.0f);
+}
 
-		const float u = 0.5f * (ndcX + 1.0f);
-		const float v = 0.5f * (ndcY + 1.0f);
+void FOcclusionDepthBuffer::BuildHZB()
+{
+	for (int32 MipIndex = 1; MipIndex < Mips.Num(); ++MipIndex)
+	{
+		const FMip& Src = Mips[MipIndex - 1];
+		const FMip& Dst = Mips[MipIndex];
+		const float* SrcData = Data.data() + Src.Offset;
+		float* DstData = Data.data() + Dst.Offset;
 
-		MinX = std::min(MinX, u); MinY = std::min(MinY, v);
-		MaxX = std::max(MaxX, u); MaxY = std::max(MaxY, v);
+		for (int32 Y = 0; Y < Dst.Height; ++Y)
+		{
+			const float* Row0 = SrcData + static_cast<size_t>(std::min(Y * 2, Src.Height - 1)) * Src.Width;
+			const float* Row1 = SrcData + static_cast<size_t>(std::min(Y * 2 + 1, Src.Height - 1)) * Src.Width;
+			float* Out = DstData + static_cast<size_t>(Y) * Dst.Width;
+
+			// 원본 8픽셀 -> 4텍셀씩 SSE (세로 max 후 짝/홀 열 max)
+			int32 X = 0;
+			for (; X * 2 + 8 <= Src.Width; X += 4)
+			{
+				const __m128 A = _mm_max_ps(_mm_loadu_ps(Row0 + X * 2), _mm_loadu_ps(Row1 + X * 2));
+				const __m128 B = _mm_max_ps(_mm_loadu_ps(Row0 + X * 2 + 4), _mm_loadu_ps(Row1 + X * 2 + 4));
+				const __m128 Even = _mm_shuffle_ps(A, B, _MM_SHUFFLE(2, 0, 2, 0));
+				const __m128 Odd = _mm_shuffle_ps(A, B, _MM_SHUFFLE(3, 1, 3, 1));
+				_mm_storeu_ps(Out + X, _mm_max_ps(Even, Odd));
+			}
+			for (; X < Dst.Width; ++X)
+			{
+				const int32 X0 = std::min(X * 2, Src.Width - 1);
+				const int32 X1 = std::min(X * 2 + 1, Src.Width - 1);
+				Out[X] = std::max(std::max(Row0[X0], Row0[X1]), std::max(Row1[X0], Row1[X1]));
+			}
+		}
+	}
+}
 
-		// 2) 깊이: WorldView로 뷰 공간 z → 선형 0..1
-		float v4[4];
-		MulPointRow(p, D.WorldView, v4);     // p_world * (World*View) == p_world * View (월드좌표니까 View만 와도 OK)
-		const float zView = v4[2];          // LH: +Z 앞
-		const float zLin01 = LinearizeZ01(zView, D.ZNear, D.ZFar);
+float FOcclusionDepthBuffer::GetMaxDepth(int32 MinX, int32 MinY, int32 MaxX, int32 MaxY) const
+{
+	// 한 변이 최대 3텍셀이 되는 가장 낮은 레벨
+	int32 MipIndex = 0;
+	while (MipIndex + 1 < Mips.Num() && ((MaxX >> MipIndex) - (MinX >> MipIndex) > 2 || (MaxY >> MipIndex) - (MinY >> MipIndex) > 2))
+	{
+		++MipIndex;
+	}
 
-		MinZLin = std::min(MinZLin, zLin01);
-		MaxZLin = std::max(MaxZLin, zLin01);
+	const FMip& Mip = Mips[MipIndex];
+	const float* MipData = Data.data() + Mip.Offset;
+	const int32 X0 = MinX >> MipIndex, X1 = std::min(MaxX >> MipIndex, Mip.Width - 1);
+	const int32 Y0 = MinY >> MipIndex, Y1 = std::min(MaxY >> MipIndex, Mip.Height - 1);
 
-		used++;
+	float MaxDepth = 0.0f;
+	for (int32 Y = Y0; Y <= Y1; ++Y)
+	{
+		const float* Row = MipData + static_cast<size_t>(Y) * Mip.Width;
+		for (int32 X = X0; X <= X1; ++X)
+		{
+			MaxDepth = std::max(MaxDepth, Row[X]);
+		}
 	}
+	return MaxDepth;
+}
 
-	if (used == 0) return false;
-	if (MaxX < 0 || MaxY < 0 || MinX > 1 || MinY > 1) return false;
-
-	Clamp01(MinX); Clamp01(MinY); Clamp01(MaxX); Clamp01(MaxY);
-	Clamp01(MinZLin); Clamp01(MaxZLin);
+//====================================================================================
+// FOcclusionCullingManagerCPU
+//====================================================================================
+void FOcclusionCullingManagerCPU::Initialize(const FOcclusionSettings& InSettings)
+{
+	Settings = InSettings;
+	Settings.Width = std::max(4, (Settings.Width + 3) & ~3);	// SSE 4픽셀 블록이 행을 넘지 않도록
+	Settings.Height = std::max(1, Settings.Height);
 
-	OutR.MinX = MinX; OutR.MinY = MinY; OutR.MaxX = MaxX; OutR.MaxY = MaxY;
-	OutR.MinZ = MinZLin;   // ★ 선형 깊이
-	OutR.MaxZ = MaxZLin;
-	OutR.ActorIndex = D.ActorIndex;
-	return true;
+	DepthBuffer.Initialize(Settings.Width, Settings.Height);
+	BinCountX = (Settings.Width + BinWidth - 1) / BinWidth;
+	BinCountY = (Settings.Height + BinHeight - 1) / BinHeight;
 }
-void FOcclusionCullingManagerCPU::BuildOccluderDepth(
-	const TArray<FCandidateDrawable>& Occluders, int ViewW, int ViewH)
-{
-	Grid.Clear();
 
-	const int GW = Grid.GetWidth();
-	const int GH = Grid.GetHeight();
+void FOcclusionCullingManagerCPU::BeginView(const FMatrix& InViewProj)
+{
+	ViewProj = InViewProj;
+	DepthBuffer.Clear();
+	Stats = FOcclusionStats();
+}
 
-	// --- 튜닝 파라미터 ---
-	const float ErodeScale = 0.5f;     // 0.5배 축소
-	const int   Dilate = 1;        // 경계 1px 팽창
-	const int   MinPxEdge = 8;        // 너무 작은 사각형은 erosion 스킵
-	const float MaxCover = 0.6f;     // 화면의 60% 이상 덮으면 erosion 스킵
+void FOcclusionCullingManagerCPU::SelectOccluders(const TArray<FOccluderDesc>& InCandidates, TArray<int32>& OutSelected)
+{
+	OutSelected.clear();
+	Stats.OccluderCandidates = static_cast<uint32>(InCandidates.Num());
 
-	for (const auto& D : Occluders)
+	TArray<TPair<float, int32>> Scored;
+	Scored.reserve(InCandidates.Num());
+	for (int32 Index = 0; Index < InCandidates.Num(); ++Index)
 	{
-		FOcclusionRect R;
-		if (!ComputeRectAndMinZ(D, ViewW, ViewH, R))
+		const FOccluderDesc& Candidate = InCandidates[Index];
+		const uint32 TriangleCount = Candidate.Mesh.GetTriangleCount();
+		if (!Candidate.Mesh.Positions || !Candidate.Mesh.Indices || TriangleCount == 0
+			|| TriangleCount > static_cast<uint32>(Settings.MaxTrianglesPerOccluder))
+		{
 			continue;
+		}
 
-		int minPX = (int)std::floor(R.MinX * GW);
-		int minPY = (int)std::floor(R.MinY * GH);
-		int maxPX = (int)std::ceil(R.MaxX * GW) - 1;
-		int maxPY = (int)std::ceil(R.MaxY * GH) - 1;
+		// 근평면에 걸치면 카메라를 감싸거나 바로 앞에 있는 것이므로 가장 큰 것으로 취급
+		float NdcMin[3], NdcMax[2];
+		float Area = 1.0f;
+		if (ProjectAABB(ViewProj, Candidate.WorldBound, NdcMin, NdcMax))
+		{
+			const float W = std::min(NdcMax[0], 1.0f) - std::max(NdcMin[0], -1.0f);
+			const float H = std::min(NdcMax[1], 1.0f) - std::max(NdcMin[1], -1.0f);
+			Area = (W > 0.0f && H > 0.0f && NdcMin[2] <= 1.0f) ? (W * H) * 0.25f : 0.0f;
+		}
+		if (Area >= Settings.MinOccluderScreenArea)
+		{
+			Scored.Add(TPair<float, int32>(Area, Index));
+		}
+	}
 
-		// --- 화면 사각형 erosion(오클루더 영향 완화) ---
-		int w = std::max(0, maxPX - minPX + 1);
-		int h = std::max(0, maxPY - minPY + 1);
-		const bool bigCover =
-			(w >= int(MaxCover * GW)) || (h >= int(MaxCover * GH));
-		if (ErodeScale < 1.0f && w >= MinPxEdge && h >= MinPxEdge && !bigCover)
+	std::sort(Scored.begin(), Scored.end(), [](const TPair<float, int32>& A, const TPair<float, int32>& B)
 		{
-			const float cx = 0.5f * float(minPX + maxPX);
-			const float cy = 0.5f * float(minPY + maxPY);
-			const float hw = 0.5f * float(w) * ErodeScale;
-			const float hh = 0.5f * float(h) * ErodeScale;
+			return A.first != B.first ? A.first > B.first : A.second < B.second;
+		});
 
-			minPX = int(std::floor(cx - hw));
-			maxPX = int(std::ceil(cx + hw));
-			minPY = int(std::floor(cy - hh));
-			maxPY = int(std::ceil(cy + hh));
+	int32 TriangleBudget = Settings.MaxOccluderTriangles;
+	for (const TPair<float, int32>& Entry : Scored)
+	{
+		if (OutSelected.Num() >= Settings.MaxOccluders)
+		{
+			break;
+		}
+		const int32 TriangleCount = static_cast<int32>(InCandidates[Entry.second].Mesh.GetTriangleCount());
+		if (TriangleCount > TriangleBudget)
+		{
+			continue;
 		}
+		TriangleBudget -= TriangleCount;
+		OutSelected.Add(Entry.second);
+	}
+	Stats.Occluders = static_cast<uint32>(OutSelected.Num());
+}
 
+void FOcclusionCullingManagerCPU::RasterizeOccluders(const TArray<FOccluderDesc>& InCandidates, const TArray<int32>& InSelected)
+{
+	const uint64 Start = FPlatformTime::Cycles64();
 
-		// 화면 경계 클램프
-		minPX = std::max(0, std::min(GW - 1, minPX));
-		minPY = std::max(0, std::min(GH - 1, minPY));
-		maxPX = std::max(0, std::min(GW - 1, maxPX));
-		maxPY = std::max(0, std::min(GH - 1, maxPY));
-		if (minPX > maxPX || minPY > maxPY) continue;
+	// 1. 오클루더마다 변환/클립/삼각형 셋업 (각 작업은 자기 배열만 씀)
+	if (OccluderTriangles.Num() < InSelected.Num())
+	{
+		OccluderTriangles.resize(InSelected.Num());
+	}
+	ParallelFor(InSelected.Num(), [&](int32 Index)
+		{
+			OccluderTriangles[Index].clear();
+			SetupOccluder(InCandidates[InSelected[Index]], OccluderTriangles[Index]);
+		}, 1, !Settings.bParallel);
+	for (int32 Index = InSelected.Num(); Index < OccluderTriangles.Num(); ++Index)
+	{
+		OccluderTriangles[Index].clear();
+	}
 
-		Grid.RasterizeRectDepthMin(minPX, minPY, maxPX, maxPY, R.MaxZ);
+	Stats.OccluderTriangles = 0;
+	for (const TArray<FTriangle>& Triangles : OccluderTriangles)
+	{
+		Stats.OccluderTriangles += static_cast<uint32>(Triangles.Num());
 	}
+
+	// 2. 빈마다 겹치는 삼각형을 오클루더 순서대로 래스터화 (빈끼리 쓰는 픽셀이 겹치지 않음)
+	ParallelFor(BinCountX * BinCountY, [&](int32 BinIndex)
+		{
+			RasterizeBin(BinIndex % BinCountX, BinIndex / BinCountX);
+		}, 1, !Settings.bParallel);
+
+	// 3. 최대값 피라미드
+	DepthBuffer.BuildHZB();
+
+	Stats.RasterMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
 }
 
-// 2) 후보 가시성 판정(HZB 샘플)
-void FOcclusionCullingManagerCPU::TestOcclusion(const TArray<FCandidateDrawable>& Candidates, int ViewW, int ViewH, TArray<uint8_t>& OutVisibleFlags)
+void FOcclusionCullingManagerCPU::SetupOccluder(const FOccluderDesc& InOccluder, TArray<FTriangle>& OutTriangles) const
 {
-	const float eps = 2e-3f;  // 1차 바이어스
-	const float eps2 = 2 * eps;  // 레벨0 재검증 바이어스(조금 더 큼)
-	// --- 크기 보장 ---
-	uint32_t maxId = 0;
-	for (auto& c : Candidates) maxId = std::max(maxId, c.ActorIndex);
-
-	if (OutVisibleFlags.size() <= maxId) OutVisibleFlags.resize(maxId + 1, 1);
-	if (VisibleStreak.size() <= maxId) VisibleStreak.resize(maxId + 1, 0);
-	if (OccludedStreak.size() <= maxId) OccludedStreak.resize(maxId + 1, 0);
-	if (LastState.size() <= maxId) LastState.resize(maxId + 1, 1); // 초기=보임
-
-	for (const auto& D : Candidates)
-	{
-		uint32_t id = D.ActorIndex;
-
-		FOcclusionRect R;
-		if (!ComputeRectAndMinZ(D, ViewW, ViewH, R))
-		{
-			// 화면 밖(또는 w<=0 코너만) → 가려짐으로 처리
-			OutVisibleFlags[id] = 0;
-			// streak 업데이트 (선택): occluded 누적
-			OccludedStreak[id] = std::min<uint8_t>(255, OccludedStreak[id] + 1);
-			VisibleStreak[id] = 0;
-			LastState[id] = 0;
+	const FOcclusionMeshView& Mesh = InOccluder.Mesh;
+	const FMatrix WorldViewProj = InOccluder.WorldMatrix * ViewProj;
+
+	TArray<float> ClipVertices(static_cast<size_t>(Mesh.VertexCount) * 4);
+	for (uint32 VertexIndex = 0; VertexIndex < Mesh.VertexCount; ++VertexIndex)
+	{
+		float Position[3];
+		memcpy(Position, Mesh.Positions + static_cast<size_t>(VertexIndex) * Mesh.PositionStride, sizeof(Position));
+		_mm_storeu_ps(&ClipVertices[static_cast<size_t>(VertexIndex) * 4], TransformPoint(WorldViewProj, Position[0], Position[1], Position[2]));
+	}
+
+	OutTriangles.reserve(Mesh.GetTriangleCount());
+	for (uint32 Tri = 0; Tri + 2 < Mesh.IndexCount; Tri += 3)
+	{
+		const uint32 I0 = Mesh.Indices[Tri], I1 = Mesh.Indices[Tri + 1], I2 = Mesh.Indices[Tri + 2];
+		if (I0 >= Mesh.VertexCount || I1 >= Mesh.VertexCount || I2 >= Mesh.VertexCount)
+		{
 			continue;
 		}
+		const float* V[3] = { &ClipVertices[I0 * 4], &ClipVertices[I1 * 4], &ClipVertices[I2 * 4] };
 
-		const float rw = std::max(0.0f, R.MaxX - R.MinX);
-		const float rh = std::max(0.0f, R.MaxY - R.MinY);
-		const float pxW = rw * GetGrid().GetWidth();
-		const float pxH = rh * GetGrid().GetHeight();
+		const int32 BehindCount = (V[0][2] < 0.0f) + (V[1][2] < 0.0f) + (V[2][2] < 0.0f);
+		if (BehindCount == 3)
+		{
+			continue;
+		}
 
-		// --- 작은 사각형 가드: 한 변이라도 2px 미만이면 컬링하지 않음 ---
-		if (std::min(pxW, pxH) < 2.0f)
+		if (BehindCount == 0)
 		{
-			OutVisibleFlags[id] = 1;
-			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
-			OccludedStreak[id] = 0;
-			LastState[id] = 1;
+			// 한 평면 바깥에 세 정점이 모두 있으면 화면에 닿지 않음
+			auto AllOutside = [&V](int32 Axis, float Sign)
+				{
+					return Sign * V[0][Axis] > V[0][3] && Sign * V[1][Axis] > V[1][3] && Sign * V[2][Axis] > V[2][3];
+				};
+			if (AllOutside(0, 1.0f) || AllOutside(0, -1.0f) || AllOutside(1, 1.0f) || AllOutside(1, -1.0f)
+				|| (V[0][2] > V[0][3] && V[1][2] > V[1][3] && V[2][2] > V[2][3]))
+			{
+				continue;
+			}
+
+			const float Clip[3][4] = {
+				{ V[0][0], V[0][1], V[0][2], V[0][3] },
+				{ V[1][0], V[1][1], V[1][2], V[1][3] },
+				{ V[2][0], V[2][1], V[2][2], V[2][3] } };
+			SetupTriangle(Clip, OutTriangles);
 			continue;
 		}
 
-		// --- 보수적 mip 선택 ---
-		int mip = std::max(0, Grid.ChooseMip(rw, rh) - 1);
-		if (pxW < 48.0f || pxH < 48.0f)
-			mip = std::max(0, mip - 1);
+		// 근평면 클립 (Sutherland-Hodgman, 결과는 3~4각형 -> 부채꼴)
+		float Polygon[4][4];
+		int32 PolygonCount = 0;
+		for (int32 Edge = 0; Edge < 3; ++Edge)
+		{
+			const float* A = V[Edge];
+			const float* B = V[(Edge + 1) % 3];
+			const bool bAInside = A[2] >= 0.0f;
+			const bool bBInside = B[2] >= 0.0f;
+			if (bAInside)
+			{
+				memcpy(Polygon[PolygonCount++], A, sizeof(float) * 4);
+			}
+			if (bAInside != bBInside)
+			{
+				LerpClip(A, B, Polygon[PolygonCount++]);
+			}
+		}
+		for (int32 Fan = 1; Fan + 1 < PolygonCount; ++Fan)
+		{
+			const float Clip[3][4] = {
+				{ Polygon[0][0], Polygon[0][1], Polygon[0][2], Polygon[0][3] },
+				{ Polygon[Fan][0], Polygon[Fan][1], Polygon[Fan][2], Polygon[Fan][3] },
+				{ Polygon[Fan + 1][0], Polygon[Fan + 1][1], Polygon[Fan + 1][2], Polygon[Fan + 1][3] } };
+			SetupTriangle(Clip, OutTriangles);
+		}
+	}
+}
+
+void FOcclusionCullingManagerCPU::SetupTriangle(const float InClip[3][4], TArray<FTriangle>& OutTriangles) const
+{
+	const float Width = static_cast<float>(Settings.Width);
+	const float Height = static_cast<float>(Settings.Height);
+
+	// 픽셀 좌표 (y는 아래로), 깊이는 NDC z
+	float X[3], Y[3], Z[3];
+	for (int32 i = 0; i < 3; ++i)
+	{
+		const float InvW = 1.0f / InClip[i][3];
+		X[i] = (InClip[i][0] * InvW * 0.5f + 0.5f) * Width;
+		Y[i] = (0.5f - InClip[i][1] * InvW * 0.5f) * Height;
+		Z[i] = InClip[i][2] * InvW;
+	}
+
+	const float Dx1 = X[1] - X[0], Dy1 = Y[1] - Y[0], Dz1 = Z[1] - Z[0];
+	const float Dx2 = X[2] - X[0], Dy2 = Y[2] - Y[0], Dz2 = Z[2] - Z[0];
+	const float Area = Dx1 * Dy2 - Dx2 * Dy1;
+	if (std::fabs(Area) < 1e-6f)
+	{
+		return;
+	}
+
+	// 중심이 삼각형 안에 들어갈 수 있는 픽셀 범위
+	const float MinXf = std::min(X[0], std::min(X[1], X[2]));
+	const float MaxXf = std::max(X[0], std::max(X[1], X[2]));
+	const float MinYf = std::min(Y[0], std::min(Y[1], Y[2]));
+	const float MaxYf = std::max(Y[0], std::max(Y[1], Y[2]));
+	FTriangle Triangle;
+	Triangle.MinX = static_cast<int32>(std::max(0.0f, std::ceil(MinXf - 0.5f)));
+	Triangle.MinY = static_cast<int32>(std::max(0.0f, std::ceil(MinYf - 0.5f)));
+	Triangle.MaxX = static_cast<int32>(std::min(Width - 1.0f, std::floor(MaxXf - 0.5f)));
+	Triangle.MaxY = static_cast<int32>(std::min(Height - 1.0f, std::floor(MaxYf - 0.5f)));
+	if (Triangle.MinX > Triangle.MaxX || Triangle.MinY > Triangle.MaxY)
+	{
+		return;
+	}
 
+	// 에지 i: 정점 i -> i+1, 감김 방향과 관계없이 안쪽이 양수가 되도록 부호를 맞춤 (양면 래스터)
+	const float Sign = Area > 0.0f ? 1.0f : -1.0f;
+	for (int32 i = 0; i < 3; ++i)
+	{
+		const int32 j = (i + 1) % 3;
+		Triangle.EdgeA[i] = Sign * (Y[i] - Y[j]);
+		Triangle.EdgeB[i] = Sign * (X[j] - X[i]);
+		Triangle.EdgeC[i] = Sign * (X[i] * Y[j] - X[j] * Y[i]);
+	}
 
-		// --- MAX HZB 적응형 샘플 ---
-		const float hzbMax = Grid.SampleMaxRectAdaptive(R.MinX, R.MinY, R.MaxX, R.MaxY, mip);
+	// 깊이 평면 + 픽셀 안에서 가장 먼 쪽으로의 여유 (중심에서 반 픽셀씩)
+	Triangle.ZDx = (Dz1 * Dy2 - Dz2 * Dy1) / Area;
+	Triangle.ZDy = (Dx1 * Dz2 - Dx2 * Dz1) / Area;
+	Triangle.Z0 = Z[0] - Triangle.ZDx * X[0] - Triangle.ZDy * Y[0] + 0.5f * (std::fabs(Triangle.ZDx) + std::fabs(Triangle.ZDy));
+	Triangle.ZMax = std::max(Z[0], std::max(Z[1], Z[2]));
 
-		bool occluded = ((hzbMax + eps) <= R.MinZ);
+	OutTriangles.Add(Triangle);
+}
 
-		// --- 레벨0 정밀 재검증(occluded일 때만) ---
-		if (occluded)
+void FOcclusionCullingManagerCPU::RasterizeBin(int32 InBinX, int32 InBinY)
+{
+	const int32 BinMinX = InBinX * BinWidth;
+	const int32 BinMinY = InBinY * BinHeight;
+	const int32 BinMaxX = std::min(Settings.Width, BinMinX + BinWidth) - 1;
+	const int32 BinMaxY = std::min(Settings.Height, BinMinY + BinHeight) - 1;
+
+	const __m128 LaneOffset = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+	const __m128 HalfPixel = _mm_set1_ps(0.5f);
+	const __m128 Zero = _mm_setzero_ps();
+
+	for (const TArray<FTriangle>& Triangles : OccluderTriangles)
+	{
+		for (const FTriangle& Triangle : Triangles)
 		{
-			if (!Grid.FullyOccludedAtLevel0(R.MinX, R.MinY, R.MaxX, R.MaxY, R.MinZ, eps2))
-				occluded = false;
+			// 빈닝: 삼각형 경계 사각형이 이 빈과 겹치는 것만
+			const int32 X0 = std::max(Triangle.MinX, BinMinX);
+			const int32 X1 = std::min(Triangle.MaxX, BinMaxX);
+			const int32 Y0 = std::max(Triangle.MinY, BinMinY);
+			const int32 Y1 = std::min(Triangle.MaxY, BinMaxY);
+			if (X0 > X1 || Y0 > Y1)
+			{
+				continue;
+			}
+
+			const __m128 A0 = _mm_set1_ps(Triangle.EdgeA[0]), A1 = _mm_set1_ps(Triangle.EdgeA[1]), A2 = _mm_set1_ps(Triangle.EdgeA[2]);
+			const __m128 ZDx = _mm_set1_ps(Triangle.ZDx);
+			const __m128 ZMax = _mm_set1_ps(Triangle.ZMax);
+			const __m128 SpanMin = _mm_set1_ps(static_cast<float>(X0));
+			const __m128 SpanMax = _mm_set1_ps(static_cast<float>(X1));
+			const int32 StartX = X0 & ~3;
+
+			for (int32 Y = Y0; Y <= Y1; ++Y)
+			{
+				const float PixelY = static_cast<float>(Y) + 0.5f;
+				const __m128 RowE0 = _mm_set1_ps(Triangle.EdgeB[0] * PixelY + Triangle.EdgeC[0]);
+				const __m128 RowE1 = _mm_set1_ps(Triangle.EdgeB[1] * PixelY + Triangle.EdgeC[1]);
+				const __m128 RowE2 = _mm_set1_ps(Triangle.EdgeB[2] * PixelY + Triangle.EdgeC[2]);
+				const __m128 RowZ = _mm_set1_ps(Triangle.Z0 + Triangle.ZDy * PixelY);
+				float* Row = DepthBuffer.GetDepthRow(Y);
+
+				for (int32 X = StartX; X <= X1; X += 4)
+				{
+					const __m128 LaneX = _mm_add_ps(_mm_set1_ps(static_cast<float>(X)), LaneOffset);
+					const __m128 PixelX = _mm_add_ps(LaneX, HalfPixel);
+
+					__m128 Mask = _mm_and_ps(_mm_cmpge_ps(LaneX, SpanMin), _mm_cmple_ps(LaneX, SpanMax));
+					Mask = _mm_and_ps(Mask, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(A0, PixelX), RowE0), Zero));
+					Mask = _mm_and_ps(Mask, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(A1, PixelX), RowE1), Zero));
+					Mask = _mm_and_ps(Mask, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(A2, PixelX), RowE2), Zero));
+					if (_mm_movemask_ps(Mask) == 0)
+					{
+						continue;
+					}
+
+					const __m128 TriangleZ = _mm_min_ps(_mm_add_ps(_mm_mul_ps(ZDx, PixelX), RowZ), ZMax);
+					const __m128 OldZ = _mm_loadu_ps(Row + X);
+					const __m128 NewZ = _mm_min_ps(OldZ, TriangleZ);
+					_mm_storeu_ps(Row + X, _mm_or_ps(_mm_and_ps(Mask, NewZ), _mm_andnot_ps(Mask, OldZ)));
+				}
+			}
 		}
+	}
+}
 
-		// --- 양방향 히스테리시스(2~3프레임 연속일 때만 상태 전환) ---
-		const int thresh = 2; // 2~3 추천
+bool FOcclusionCullingManagerCPU::ProjectBounds(const FAABB& InBound, int32& OutMinX, int32& OutMinY, int32& OutMaxX, int32& OutMaxY, float& OutMinZ) const
+{
+	float NdcMin[3], NdcMax[2];
+	if (!ProjectAABB(ViewProj, InBound, NdcMin, NdcMax))
+	{
+		return false;
+	}
 
-		if (occluded)
-		{
-			OccludedStreak[id] = std::min<uint8_t>(255, OccludedStreak[id] + 1);
-			VisibleStreak[id] = 0;
+	const float Width = static_cast<float>(Settings.Width);
+	const float Height = static_cast<float>(Settings.Height);
+	const float MinX = (NdcMin[0] * 0.5f + 0.5f) * Width;
+	const float MaxX = (NdcMax[0] * 0.5f + 0.5f) * Width;
+	const float MinY = (0.5f - NdcMax[1] * 0.5f) * Height;
+	const float MaxY = (0.5f - NdcMin[1] * 0.5f) * Height;
+	if (MaxX < 0.0f || MaxY < 0.0f || MinX >= Width || MinY >= Height)
+	{
+		return false;
+	}
 
-			// 직전이 보임이면, thresh 미만 동안은 보임 유지
-			if (LastState[id] == 1 && OccludedStreak[id] < thresh)
-				occluded = false;
-		}
-		else
-		{
-			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
-			OccludedStreak[id] = 0;
+	// 조금이라도 닿는 픽셀은 모두 포함
+	OutMinX = static_cast<int32>(std::max(0.0f, std::floor(MinX)));
+	OutMinY = static_cast<int32>(std::max(0.0f, std::floor(MinY)));
+	OutMaxX = static_cast<int32>(std::min(Width - 1.0f, std::floor(MaxX)));
+	OutMaxY = static_cast<int32>(std::min(Height - 1.0f, std::floor(MaxY)));
+	OutMinZ = NdcMin[2];
+	return true;
+}
 
-			// 직전이 가려짐이면, thresh 미만 동안은 가려짐 유지
-			if (LastState[id] == 0 && VisibleStreak[id] < thresh)
-				occluded = true;
-		}
+void FOcclusionCullingManagerCPU::TestBounds(const FAABB* InBounds, int32 InCount, uint8* OutVisible)
+{
+	const uint64 Start = FPlatformTime::Cycles64();
 
-		LastState[id] = occluded ? 0 : 1;
-		OutVisibleFlags[id] = occluded ? 0 : 1;
+	constexpr int32 TestBatchSize = 64;
+	ParallelFor(InCount, [&](int32 Index)
+		{
+			int32 MinX, MinY, MaxX, MaxY;
+			float MinZ;
+			if (!ProjectBounds(InBounds[Index], MinX, MinY, MaxX, MaxY, MinZ))
+			{
+				OutVisible[Index] = 1;
+				return;
+			}
+			// 박스의 가장 가까운 점이 영역 안 오클루더의 가장 먼 깊이보다 뒤에 있어야 가려짐
+			OutVisible[Index] = (MinZ > DepthBuffer.GetMaxDepth(MinX, MinY, MaxX, MaxY)) ? 0 : 1;
+		}, TestBatchSize, !Settings.bParallel || InCount < TestBatchSize * 4);
+
+	Stats.TestedBounds += static_cast<uint32>(InCount);
+	for (int32 Index = 0; Index < InCount; ++Index)
+	{
+		Stats.OccludedBounds += OutVisible[Index] ? 0 : 1;
 	}
-}
\ No newline at end of file
+	Stats.TestMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+}
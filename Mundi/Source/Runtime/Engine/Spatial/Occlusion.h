@@ -1,257 +1,151 @@
 ﻿#pragma once
+#include "AABB.h"
+
+/**
+ * CPU 소프트웨어 오클루전 컬링 (Masked Occlusion Culling 계열의 단순화 버전).
+ *
+ * 1) 화면에서 크게 보이는 메시를 오클루더로 골라 (SelectOccluders)
+ * 2) 삼각형을 클립 공간으로 변환/근평면 클립한 뒤 빈(bin) 단위로 나눠 SSE 4픽셀씩 저해상도 깊이 버퍼에 래스터화하고
+ *    (오클루더 단위 변환 -> 빈 단위 래스터가 각각 ParallelFor 작업)
+ * 3) 2x2 최대값 깊이 피라미드(HZB)를 만든 다음
+ * 4) 후보 AABB를 묶음으로 투영해 해당 영역 HZB 최대 깊이보다 뒤에 있으면 가려진 것으로 판정합니다.
+ *
+ * 깊이는 D3D 규약의 NDC z (0 = 근평면, 1 = 원평면)입니다. 덮임 판정은 픽셀 중심 샘플링이고,
+ * 중심이 덮인 픽셀에는 그 픽셀 안에서 삼각형 평면이 가질 수 있는 가장 먼 깊이를 기록합니다.
+ * 따라서 깊이 방향으로는 보수적이지만 덮임은 근사입니다: 오클루더 가장자리나 오클루더 사이의 픽셀보다 좁은 틈으로만
+ * 보이는 물체는 가려졌다고 판정될 수 있습니다 (픽셀 전체를 덮을 때만 쓰면 메시 안쪽 에지마다 구멍이 생겨 거의 가리지 못함).
+ * 디바이스와 무관하고 결과가 스레드 수/순서에 관계없이 같으므로, 합성 씬으로 단독 검증/벤치마크할 수 있습니다.
+ */
+
+// 오클루더 메시의 CPU 위치/인덱스 (정점 구조체 안의 FVector 위치를 Stride 간격으로 읽음)
+struct FOcclusionMeshView
+{
+	const uint8* Positions = nullptr;
+	uint32 PositionStride = 0;
+	uint32 VertexCount = 0;
+	const uint32* Indices = nullptr;
+	uint32 IndexCount = 0;
 
-struct FVector;
-struct FVector4;
-struct FMatrix; // row-major, p' = p * M 가정(네 컨벤션대로)
-struct FAABB; // AABB
+	uint32 GetTriangleCount() const { return IndexCount / 3; }
+};
 
-struct FCandidateDrawable
+struct FOccluderDesc
 {
-    uint32_t ActorIndex;   // VisibleFlags 인덱스
-    FAABB   Bound;        // 월드 AABB (Min/Max)
-    FMatrix  WorldViewProj;// 행벡터 기준 WVP
-    FMatrix  WorldView;    // ★ 추가: World-space * View  (여기서는 View만 주면 됨)
-    float    ZNear;        // ★ 추가
-    float    ZFar;         // ★ 추가
+	FOcclusionMeshView Mesh;
+	FMatrix WorldMatrix;
+	FAABB WorldBound;
 };
 
-// 교체 (MaxZ 추가)
-struct FOcclusionRect
+struct FOcclusionSettings
 {
-    float MinX, MinY, MaxX, MaxY; // [0..1]
-    float MinZ;                   // 가장 가까운
-    float MaxZ;                   // 가장 먼      <<--- 추가
-    uint32_t ActorIndex;
+	int32 Width = 256;						// 깊이 버퍼 해상도 (가로는 4의 배수로 올림)
+	int32 Height = 128;
+	float MinOccluderScreenArea = 0.01f;	// 화면 대비 투영 사각형 면적이 이보다 작으면 오클루더 제외
+	int32 MaxOccluders = 64;
+	int32 MaxTrianglesPerOccluder = 4096;	// 이보다 복잡한 메시는 오클루더로 쓰지 않음
+	int32 MaxOccluderTriangles = 65536;		// 프레임 전체 오클루더 삼각형 예산
+	bool bParallel = true;
 };
 
-// 저해상도 깊이맵 + HZB(min) - CPU 전용
-class FOcclusionGrid
+struct FOcclusionStats
 {
-public:
-    void Initialize(int InWidth, int InHeight)
-    {
-        Width = InWidth; Height = InHeight;
-        // 교체: 1.0f (Far)
-        Depth.assign(size_t(Width * Height), 1.0f);
-        BuildLevels.clear();
-    }
-    void Clear()
-    {
-        // Clear 도 동일하게 1.0f로
-        std::fill(Depth.begin(), Depth.end(), 1.0f);
-        BuildLevels.clear();
-    }
-
-    /*
-        왜 R.MaxZ를 쓰는데 min 누적을 하나?
-
-        오클루더 AABB가 두껍거나 경계 근사 때문에 일부 픽셀이 원래보다 더 멀게 잡힐 수 있다.
-
-        레벨0은 per-pixel 가장 가까운 오클루더가 들어가야 하므로, 여러 오클루더가 겹칠 때 **min(current, MaxZ)**로 더 가까운 값으로만 낮춘다.
-
-        이렇게 해야 상위 레벨의 MAX 피라미드가 보수적이 됨(=오버컬링 방지).
-    */
-
-    void RasterizeRectDepthMin(int MinPX, int MinPY, int MaxPX, int MaxPY, float MaxZ)
-    {
-        MinPX = std::max(0, MinPX); MinPY = std::max(0, MinPY);
-        MaxPX = std::min(Width - 1, MaxPX); MaxPY = std::min(Height - 1, MaxPY);
-        for (int y = MinPY; y <= MaxPY; ++y)
-        {
-            float* Row = &Depth[size_t(y) * Width];
-            for (int x = MinPX; x <= MaxPX; ++x)
-            {
-                Row[x] = std::min(Row[x], MaxZ); // 가장 가까운 깊이로 갱신
-            }
-        }
-    }
-
-    void BuildHZB()
-    {
-        BuildLevels.clear();
-        BuildLevels.push_back(Depth); // level 0
-
-        int W = Width, H = Height;
-        while (W > 1 || H > 1)
-        {
-            int NW = std::max(1, W >> 1);
-            int NH = std::max(1, H >> 1);
-            TArray<float> Next(size_t(NW * NH), +FLT_MAX);
-
-            for (int y = 0; y < NH; ++y)
-                for (int x = 0; x < NW; ++x)
-                {
-                    int sx = x * 2, sy = y * 2;
-                    float a = SampleSafe(BuildLevels.back(), W, H, sx + 0, sy + 0);
-                    float b = SampleSafe(BuildLevels.back(), W, H, sx + 1, sy + 0);
-                    float c = SampleSafe(BuildLevels.back(), W, H, sx + 0, sy + 1);
-                    float d = SampleSafe(BuildLevels.back(), W, H, sx + 1, sy + 1);
-                    Next[size_t(y) * NW + x] = std::max(std::max(a, b), std::max(c, d));
-                }
-            BuildLevels.push_back(std::move(Next));
-            W = NW; H = NH;
-        }
-    }
-
-    int ChooseMip(float RectW01, float RectH01) const
-    {
-        float pxW = RectW01 * Width;
-        float pxH = RectH01 * Height;
-        float s = std::max(pxW, pxH);
-        int mip = int(std::floor(std::log2(std::max(1.0f, s))));
-        mip = std::max(0, std::min(mip, int(BuildLevels.size() - 1)));
-        return mip;
-    }
-
-    float SampleMaxRect(float MinX01, float MinY01, float MaxX01, float MaxY01, int Mip) const
-    {
-        const TArray<float>& L = BuildLevels[size_t(Mip)];
-        int W = std::max(1, Width >> Mip);
-        int H = std::max(1, Height >> Mip);
-
-        auto ToPx = [&](float u, float v)->std::pair<int, int> {
-            int x = int(u * W + 0.5f);
-            int y = int(v * H + 0.5f);
-            x = std::max(0, std::min(W - 1, x));
-            y = std::max(0, std::min(H - 1, y));
-            return { x,y };
-            };
-        auto Smp = [&](float u, float v)->float {
-            auto [x, y] = ToPx(u, v);
-            return L[size_t(y) * W + x];
-            };
-
-        float cx = 0.5f * (MinX01 + MaxX01);
-        float cy = 0.5f * (MinY01 + MaxY01);
-
-        float s0 = Smp(cx, cy);
-        float s1 = Smp(MinX01, MinY01);
-        float s2 = Smp(MaxX01, MinY01);
-        float s3 = Smp(MinX01, MaxY01);
-        float s4 = Smp(MaxX01, MaxY01);
-
-        return std::max(s0, std::max(s1, std::max(s2, std::max(s3, s4)))); // ★ MAX
-    }
-    // FOcclusionGrid 내부에 추가
-    float SampleMaxRectAdaptive(float MinX01, float MinY01, float MaxX01, float MaxY01, int Mip) const
-    {
-        const TArray<float>& L = BuildLevels[size_t(Mip)];
-        const int W = std::max(1, Width >> Mip);
-        const int H = std::max(1, Height >> Mip);
-
-        auto ToPx = [&](float u, float v)->std::pair<int, int> {
-            int x = int(u * W + 0.5f);
-            int y = int(v * H + 0.5f);
-            x = std::max(0, std::min(W - 1, x));
-            y = std::max(0, std::min(H - 1, y));
-            return { x,y };
-            };
-        auto Smp = [&](float u, float v)->float {
-            auto [x, y] = ToPx(u, v);
-            return L[size_t(y) * W + x];
-            };
-
-        // 샘플 밀도: 화면 픽셀 크기에 비례 (최대 5x5)
-        const int grid = ((MaxX01 - MinX01) * Width + (MaxY01 - MinY01) * Height > 80) ? 5 :
-            ((MaxX01 - MinX01) * Width + (MaxY01 - MinY01) * Height > 30) ? 4 : 3;
-
-        float best = 0.0f; // MAX 피라미드이므로 최댓값을 모음
-        for (int j = 0; j < grid; j++)
-        {
-            float v = std::lerp(MinY01, MaxY01, (grid == 1) ? 0.5f : float(j) / (grid - 1));
-            for (int i = 0; i < grid; i++)
-            {
-                float u = std::lerp(MinX01, MaxX01, (grid == 1) ? 0.5f : float(i) / (grid - 1));
-                best = std::max(best, Smp(u, v));
-            }
-        }
-        return best;
-    }
-    // FOcclusionGrid 내부에 추가 (레벨0 정밀 검사)
-    bool FullyOccludedAtLevel0(float MinX01, float MinY01, float MaxX01, float MaxY01, float MinZ, float eps2) const
-    {
-        const TArray<float>& L0 = BuildLevels[0];
-        const int W = Width, H = Height;
-
-        int x0 = std::max(0, std::min(W - 1, int(MinX01 * W)));
-        int y0 = std::max(0, std::min(H - 1, int(MinY01 * H)));
-        int x1 = std::max(0, std::min(W - 1, int(MaxX01 * W)));
-        int y1 = std::max(0, std::min(H - 1, int(MaxY01 * H)));
+	uint32 OccluderCandidates = 0;
+	uint32 Occluders = 0;
+	uint32 OccluderTriangles = 0;		// 클립/뒤집힘 제거 후 래스터화한 삼각형
+	uint32 TestedBounds = 0;
+	uint32 OccludedBounds = 0;
+	double RasterMs = 0.0;				// 변환 + 빈 래스터 + HZB
+	double TestMs = 0.0;
+};
 
-        // 너무 큰 박스는 샘플링 간격을 둠 (성능)
-        const int maxScan = 128 * 128; // 임계 픽셀수
-        int w = std::max(1, x1 - x0 + 1);
-        int h = std::max(1, y1 - y0 + 1);
-        int step = (w * h > maxScan) ? 2 : 1;
+/**
+ * 저해상도 깊이 버퍼 + 최대값 피라미드.
+ * 레벨 0은 픽셀마다 가장 가까운 오클루더 깊이(min 누적), 상위 레벨은 2x2의 최대값이라
+ * 어떤 영역의 상위 레벨 값은 "그 영역의 모든 픽셀(중심 샘플 기준)이 이 깊이 이내에서 가려져 있다"는 상한입니다.
+ */
+class FOcclusionDepthBuffer
+{
+public:
+	void Initialize(int32 InWidth, int32 InHeight);
+	void Clear();
+	void BuildHZB();
 
-        for (int y = y0; y <= y1; y += step)
-        {
-            const float* row = &L0[size_t(y) * W];
-            for (int x = x0; x <= x1; x += step)
-            {
-                float z = row[x];           // 레벨0의 MAX-기반 값(=멀리 기록한 것들의 min 축약 결과 아님!)
-                // 주의: 우리는 base에 'MaxZ를 min으로 누적'시켰고, HZB는 최대화했음.
-                // 레벨0에서도 보수성 유지: z + eps2 <= MinZ 일 때만 occluded 픽셀로 간주.
-                if (z + eps2 > MinZ)
-                    return false; // 한 픽셀이라도 덮여있지 않음 → 전체 가림 실패
-            }
-        }
-        return true; // 전부 덮임
-    }
-    int GetWidth()  const { return Width; }
-    int GetHeight() const { return Height; }
+	// 픽셀 사각형 [MinX, MaxX] x [MinY, MaxY]의 최대 깊이 (한 변이 2~3 텍셀이 되는 레벨에서 샘플)
+	float GetMaxDepth(int32 MinX, int32 MinY, int32 MaxX, int32 MaxY) const;
 
+	int32 GetWidth() const { return Width; }
+	int32 GetHeight() const { return Height; }
+	int32 GetMipCount() const { return static_cast<int32>(Mips.Num()); }
+	int32 GetMipWidth(int32 InMip) const { return Mips[InMip].Width; }
+	int32 GetMipHeight(int32 InMip) const { return Mips[InMip].Height; }
+	const float* GetMipData(int32 InMip) const { return Data.data() + Mips[InMip].Offset; }
 
-private:
-    static float SampleSafe(const TArray<float>& L, int W, int H, int X, int Y)
-    {
-        X = std::max(0, std::min(W - 1, X));
-        Y = std::max(0, std::min(H - 1, Y));
-        return L[size_t(Y) * W + X];
-    }
+	float* GetDepthRow(int32 InY) { return Data.data() + static_cast<size_t>(InY) * Width; }
 
 private:
-    int Width = 0, Height = 0;
-    TArray<float> Depth;                     // level 0
-    TArray<TArray<float>> BuildLevels;  // [0..N-1], min chain
-
-
+	struct FMip
+	{
+		int32 Width = 0;
+		int32 Height = 0;
+		size_t Offset = 0;
+	};
+
+	int32 Width = 0;
+	int32 Height = 0;
+	TArray<FMip> Mips;
+	TArray<float> Data;		// 모든 레벨을 이어 붙임 (레벨 0이 맨 앞)
 };
 
-// CPU 오클루전 매니저
 class FOcclusionCullingManagerCPU
 {
 public:
-    void Initialize(int GridW, int GridH) { Grid.Initialize(GridW, GridH); }
-    void Shutdown() {}
+	void Initialize(const FOcclusionSettings& InSettings);
+	const FOcclusionSettings& GetSettings() const { return Settings; }
 
-    // 1) 오클루더로 저해상도 Depth 채우기
-    void BuildOccluderDepth(const TArray<FCandidateDrawable>& Occluders, int ViewW, int ViewH);
+	// 이 뷰의 ViewProj (행벡터 규약 p * VP)로 깊이 버퍼를 비움
+	void BeginView(const FMatrix& InViewProj);
 
-    // 2) CPU HZB
-    void BuildHZB() { Grid.BuildHZB(); }
+	// 화면 점유 면적 순으로 오클루더 후보를 골라 인덱스를 반환 (같은 면적이면 입력 순서, 결정적)
+	void SelectOccluders(const TArray<FOccluderDesc>& InCandidates, TArray<int32>& OutSelected);
 
-    // 3) 후보 가시성 판정
-    void TestOcclusion(const TArray<FCandidateDrawable>& Candidates, int ViewW, int ViewH, TArray<uint8_t>& OutVisibleFlags);
+	// 선택된 오클루더를 래스터화하고 HZB까지 만듦
+	void RasterizeOccluders(const TArray<FOccluderDesc>& InCandidates, const TArray<int32>& InSelected);
 
-    const FOcclusionGrid& GetGrid() const { return Grid; }
+	// AABB 묶음 판정: OutVisible[i] = 0이면 가려짐. 근평면에 걸친 박스와 화면 밖 박스는 보이는 것으로 둠
+	void TestBounds(const FAABB* InBounds, int32 InCount, uint8* OutVisible);
 
-private:
-    // AABB(Min/Max) → 화면 사각형 + MinZ (★이제 MinZ는 '선형 깊이 0..1')
-    static bool ComputeRectAndMinZ(const FCandidateDrawable& D, int ViewW, int ViewH, FOcclusionRect& OutRect);
+	const FOcclusionDepthBuffer& GetDepthBuffer() const { return DepthBuffer; }
+	const FOcclusionStats& GetStats() const { return Stats; }
 
-    // 행벡터: Out = In(1x4) * M(4x4)
-    static inline void MulPointRow(const float In[4], const FMatrix& M, float Out[4])
-    {
-        Out[0] = In[0] * M.M[0][0] + In[1] * M.M[1][0] + In[2] * M.M[2][0] + In[3] * M.M[3][0];
-        Out[1] = In[0] * M.M[0][1] + In[1] * M.M[1][1] + In[2] * M.M[2][1] + In[3] * M.M[3][1];
-        Out[2] = In[0] * M.M[0][2] + In[1] * M.M[1][2] + In[2] * M.M[2][2] + In[3] * M.M[3][2];
-        Out[3] = In[0] * M.M[0][3] + In[1] * M.M[1][3] + In[2] * M.M[2][3] + In[3] * M.M[3][3];
-    }
+	static constexpr int32 BinWidth = 64;	// 래스터 작업 단위 (4의 배수)
+	static constexpr int32 BinHeight = 32;
 
 private:
-    FOcclusionGrid Grid;
-    TArray<uint8_t> VisibleStreak;   // 연속 보임 프레임 수
-    TArray<uint8_t> OccludedStreak;  // 연속 가림 프레임 수
-    TArray<uint8_t> LastState;       // 0=occluded, 1=visible
-};
\ No newline at end of file
+	// 래스터 준비가 끝난 화면 공간 삼각형 (픽셀 좌표, 안쪽이 모두 양수가 되도록 방향을 맞춘 에지 함수)
+	struct FTriangle
+	{
+		float EdgeA[3];
+		float EdgeB[3];
+		float EdgeC[3];
+		float Z0, ZDx, ZDy;		// 깊이 평면 z = Z0 + ZDx * x + ZDy * y
+		float ZMax;				// 세 정점의 최대 깊이 (평면 외삽 상한)
+		int32 MinX, MinY, MaxX, MaxY;
+	};
+
+	// 오클루더 하나를 변환/클립/셋업 (작업 스레드에서 호출, OutTriangles만 씀)
+	void SetupOccluder(const FOccluderDesc& InOccluder, TArray<FTriangle>& OutTriangles) const;
+	void SetupTriangle(const float InClip[3][4], TArray<FTriangle>& OutTriangles) const;
+	void RasterizeBin(int32 InBinX, int32 InBinY);
+
+	// 월드 AABB -> 픽셀 사각형 + 최소 NDC 깊이. 근평면에 걸치면 false
+	bool ProjectBounds(const FAABB& InBound, int32& OutMinX, int32& OutMinY, int32& OutMaxX, int32& OutMaxY, float& OutMinZ) const;
+
+	FOcclusionSettings Settings;
+	FOcclusionDepthBuffer DepthBuffer;
+	FMatrix ViewProj;
+	int32 BinCountX = 0;
+	int32 BinCountY = 0;
+
+	TArray<TArray<FTriangle>> OccluderTriangles;	// 선택된 오클루더 순서대로
+	FOcclusionStats Stats;
+};
@@ -0,0 +1,269 @@
+﻿#include "pch.h"
+#include "Occlusion.h"
+#include "SelfTest.h"
+
+namespace
+{
+	// ViewProj = 단위 행렬이면 월드 좌표가 곧 NDC (w = 1) -> 픽셀 좌표를 직접 계산해 비교할 수 있음
+	struct FOcclusionTestScene
+	{
+		TArray<FVector> Positions;
+		TArray<uint32> Indices;
+		TArray<FOccluderDesc> Occluders;
+
+		// NDC 사각형 [X0, X1] x [Y0, Y1], 깊이 Z (삼각형 둘)
+		void AddQuad(float X0, float Y0, float X1, float Y1, float Z)
+		{
+			const uint32 Base = static_cast<uint32>(Positions.Num());
+			Positions.Add(FVector(X0, Y0, Z));
+			Positions.Add(FVector(X1, Y0, Z));
+			Positions.Add(FVector(X1, Y1, Z));
+			Positions.Add(FVector(X0, Y1, Z));
+			const uint32 QuadIndices[6] = { 0, 1, 2, 0, 2, 3 };
+			for (uint32 Index : QuadIndices)
+			{
+				Indices.Add(Base + Index);
+			}
+		}
+
+		void AddTriangle(const FVector& A, const FVector& B, const FVector& C)
+		{
+			const uint32 Base = static_cast<uint32>(Positions.Num());
+			Positions.Add(A);
+			Positions.Add(B);
+			Positions.Add(C);
+			Indices.Add(Base);
+			Indices.Add(Base + 1);
+			Indices.Add(Base + 2);
+		}
+
+		// 지금까지 추가한 삼각형 전체를 오클루더 하나로 (Positions가 더 늘어나지 않은 뒤에 호출)
+		void FinishOccluder()
+		{
+			FOccluderDesc Desc;
+			Desc.Mesh.Positions = reinterpret_cast<const uint8*>(Positions.data());
+			Desc.Mesh.PositionStride = sizeof(FVector);
+			Desc.Mesh.VertexCount = static_cast<uint32>(Positions.Num());
+			Desc.Mesh.Indices = Indices.data();
+			Desc.Mesh.IndexCount = static_cast<uint32>(Indices.Num());
+			Desc.WorldMatrix = FMatrix::Identity();
+			Desc.WorldBound = FAABB(FVector(-1.0f, -1.0f, 0.0f), FVector(1.0f, 1.0f, 1.0f));
+			Occluders.Add(Desc);
+		}
+
+		void Rasterize(FOcclusionCullingManagerCPU& InOutManager, bool bInParallel = true)
+		{
+			FOcclusionSettings Settings;
+			Settings.bParallel = bInParallel;
+			InOutManager.Initialize(Settings);
+			InOutManager.BeginView(FMatrix::Identity());
+
+			TArray<int32> Selected;
+			InOutManager.SelectOccluders(Occluders, Selected);
+			InOutManager.RasterizeOccluders(Occluders, Selected);
+		}
+	};
+
+	// 픽셀 x -> NDC x (기본 256 x 128 버퍼)
+	float PixelToNdcX(float InPixelX) { return InPixelX / 128.0f - 1.0f; }
+	float PixelToNdcY(float InPixelY) { return 1.0f - InPixelY / 64.0f; }
+
+	bool IsVisible(FOcclusionCullingManagerCPU& InManager, const FAABB& InBound)
+	{
+		uint8 Visible = 1;
+		InManager.TestBounds(&InBound, 1, &Visible);
+		return Visible != 0;
+	}
+}
+
+IMPLEMENT_SELF_TEST(Occlusion, HZBMaxIsConservative)
+{
+	FOcclusionDepthBuffer DepthBuffer;
+	DepthBuffer.Initialize(37, 19);	// 홀수 크기: 마지막 텍셀이 한 줄만 덮는 경로
+
+	uint32 Seed = 0x5EEDu;
+	auto NextRandom = [&Seed]() { Seed = Seed * 1664525u + 1013904223u; return Seed >> 8; };
+	for (int32 Y = 0; Y < DepthBuffer.GetHeight(); ++Y)
+	{
+		float* Row = DepthBuffer.GetDepthRow(Y);
+		for (int32 X = 0; X < DepthBuffer.GetWidth(); ++X)
+		{
+			Row[X] = static_cast<float>(NextRandom() % 1000) / 1000.0f;
+		}
+	}
+	DepthBuffer.BuildHZB();
+	SELF_TEST_CHECK(DepthBuffer.GetMipWidth(DepthBuffer.GetMipCount() - 1) == 1);
+	SELF_TEST_CHECK(DepthBuffer.GetMipHeight(DepthBuffer.GetMipCount() - 1) == 1);
+
+	bool bUnderEstimated = false;
+	bool bSinglePixelExact = true;
+	for (int32 Iteration = 0; Iteration < 500; ++Iteration)
+	{
+		int32 MinX = NextRandom() % DepthBuffer.GetWidth(), MaxX = NextRandom() % DepthBuffer.GetWidth();
+		int32 MinY = NextRandom() % DepthBuffer.GetHeight(), MaxY = NextRandom() % DepthBuffer.GetHeight();
+		if (MinX > MaxX) std::swap(MinX, MaxX);
+		if (MinY > MaxY) std::swap(MinY, MaxY);
+
+		float Expected = 0.0f;
+		for (int32 Y = MinY; Y <= MaxY; ++Y)
+		{
+			for (int32 X = MinX; X <= MaxX; ++X)
+			{
+				Expected = std::max(Expected, DepthBuffer.GetMipData(0)[Y * DepthBuffer.GetWidth() + X]);
+			}
+		}
+		bUnderEstimated |= DepthBuffer.GetMaxDepth(MinX, MinY, MaxX, MaxY) < Expected;
+		bSinglePixelExact &= DepthBuffer.GetMaxDepth(MinX, MinY, MinX, MinY) == DepthBuffer.GetMipData(0)[MinY * DepthBuffer.GetWidth() + MinX];
+	}
+	SELF_TEST_CHECK(!bUnderEstimated);
+	SELF_TEST_CHECK(bSinglePixelExact);
+}
+
+IMPLEMENT_SELF_TEST(Occlusion, CenterSampledCoverageWithFarthestDepth)
+{
+	// 무작위 삼각형: 중심이 확실히 안쪽인 픽셀만 기록되고 (바깥이면 비어 있고),
+	// 기록 깊이는 픽셀 안 삼각형 깊이의 최댓값 이상 (깊이 방향 보수성)
+	uint32 Seed = 0xABCDu;
+	auto NextFloat = [&Seed](float InMin, float InMax)
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		return InMin + (InMax - InMin) * static_cast<float>(Seed >> 8) / static_cast<float>(1u << 24);
+	};
+
+	int32 WrittenPixels = 0;
+	int32 BadCoverage = 0;
+	int32 MissedPixels = 0;
+	int32 BadDepth = 0;
+	for (int32 Iteration = 0; Iteration < 40; ++Iteration)
+	{
+		FVector V[3];
+		for (FVector& Vertex : V)
+		{
+			Vertex = FVector(NextFloat(-1.2f, 1.2f), NextFloat(-1.2f, 1.2f), NextFloat(0.1f, 0.9f));
+		}
+
+		FOcclusionTestScene Scene;
+		Scene.AddTriangle(V[0], V[1], V[2]);
+		Scene.FinishOccluder();
+		FOcclusionCullingManagerCPU Manager;
+		Scene.Rasterize(Manager, false);
+
+		// 픽셀 좌표 삼각형과 깊이 평면
+		float PX[3], PY[3];
+		for (int32 i = 0; i < 3; ++i)
+		{
+			PX[i] = (V[i].X * 0.5f + 0.5f) * 256.0f;
+			PY[i] = (0.5f - V[i].Y * 0.5f) * 128.0f;
+		}
+		const float Area = (PX[1] - PX[0]) * (PY[2] - PY[0]) - (PX[2] - PX[0]) * (PY[1] - PY[0]);
+		if (std::fabs(Area) < 1.0f)
+		{
+			continue;
+		}
+		auto Barycentric = [&](float X, float Y, float Out[3])
+		{
+			Out[1] = ((X - PX[0]) * (PY[2] - PY[0]) - (PX[2] - PX[0]) * (Y - PY[0])) / Area;
+			Out[2] = ((PX[1] - PX[0]) * (Y - PY[0]) - (X - PX[0]) * (PY[1] - PY[0])) / Area;
+			Out[0] = 1.0f - Out[1] - Out[2];
+		};
+
+		const float* Depth = Manager.GetDepthBuffer().GetMipData(0);
+		for (int32 Y = 0; Y < 128; ++Y)
+		{
+			for (int32 X = 0; X < 256; ++X)
+			{
+				const float Stored = Depth[Y * 256 + X];
+				const float Epsilon = 1e-3f;
+				float Center[3];
+				Barycentric(static_cast<float>(X) + 0.5f, static_cast<float>(Y) + 0.5f, Center);
+				const float CenterInside = std::min(Center[0], std::min(Center[1], Center[2]));
+				if (Stored >= 1.0f)
+				{
+					MissedPixels += (CenterInside > Epsilon) ? 1 : 0;
+					continue;
+				}
+				++WrittenPixels;
+				BadCoverage += (CenterInside < -Epsilon) ? 1 : 0;
+
+				// 삼각형 밖으로 외삽된 모서리 깊이는 세 정점 최댓값으로 잘림
+				const float MaxVertexZ = std::max(V[0].Z, std::max(V[1].Z, V[2].Z));
+				for (int32 Corner = 0; Corner < 4; ++Corner)
+				{
+					float B[3];
+					Barycentric(static_cast<float>(X + (Corner & 1)), static_cast<float>(Y + (Corner >> 1)), B);
+					const float CornerZ = std::min(B[0] * V[0].Z + B[1] * V[1].Z + B[2] * V[2].Z, MaxVertexZ);
+					if (Stored + Epsilon < CornerZ)
+					{
+						++BadDepth;
+					}
+				}
+			}
+		}
+	}
+	SELF_TEST_CHECK(WrittenPixels > 0);
+	SELF_TEST_CHECK(BadCoverage == 0);
+	SELF_TEST_CHECK(MissedPixels == 0);
+	SELF_TEST_CHECK(BadDepth == 0);
+}
+
+IMPLEMENT_SELF_TEST(Occlusion, QuadOccludesBoundsBehind)
+{
+	// 화면 왼쪽 3/4을 덮는 벽 (HZB는 정렬된 텍셀 단위로 샘플하므로 박스보다 넉넉하게)
+	FOcclusionTestScene Scene;
+	Scene.AddQuad(-1.2f, -1.2f, 0.5f, 1.2f, 0.3f);
+	Scene.FinishOccluder();
+	FOcclusionCullingManagerCPU Manager;
+	Scene.Rasterize(Manager);
+
+	SELF_TEST_CHECK(Manager.GetStats().Occluders == 1);
+	SELF_TEST_CHECK(Manager.GetStats().OccluderTriangles == 2);
+
+	SELF_TEST_CHECK(!IsVisible(Manager, FAABB(FVector(-0.3f, -0.3f, 0.5f), FVector(0.3f, 0.3f, 0.6f))));	// 뒤
+	SELF_TEST_CHECK(IsVisible(Manager, FAABB(FVector(-0.3f, -0.3f, 0.1f), FVector(0.3f, 0.3f, 0.2f))));		// 앞
+	SELF_TEST_CHECK(IsVisible(Manager, FAABB(FVector(-0.3f, -0.3f, 0.25f), FVector(0.3f, 0.3f, 0.6f))));	// 관통
+	SELF_TEST_CHECK(IsVisible(Manager, FAABB(FVector(0.4f, -0.3f, 0.5f), FVector(0.7f, 0.3f, 0.6f))));		// 가장자리에 걸침
+	SELF_TEST_CHECK(IsVisible(Manager, FAABB(FVector(0.6f, 0.6f, 0.5f), FVector(0.8f, 0.8f, 0.6f))));		// 옆
+	SELF_TEST_CHECK(IsVisible(Manager, FAABB(FVector(-0.3f, -0.3f, -0.5f), FVector(0.3f, 0.3f, 0.6f))));	// 근평면에 걸침
+}
+
+IMPLEMENT_SELF_TEST(Occlusion, EdgePixelWithUncoveredCenterStaysVisible)
+{
+	// 오클루더 오른쪽 에지가 픽셀 192의 30% 지점 (중심은 덮지 않음)
+	FOcclusionTestScene Scene;
+	Scene.AddQuad(-0.5f, -0.5f, PixelToNdcX(192.3f), 0.5f, 0.3f);
+	Scene.FinishOccluder();
+	FOcclusionCullingManagerCPU Manager;
+	Scene.Rasterize(Manager);
+
+	// 같은 픽셀 안, 에지 바깥에 있는 뒤쪽 박스
+	const FAABB BeyondEdge(FVector(PixelToNdcX(192.8f), PixelToNdcY(60.0f), 0.5f), FVector(PixelToNdcX(192.95f), PixelToNdcY(50.0f), 0.6f));
+	SELF_TEST_CHECK(IsVisible(Manager, BeyondEdge));
+
+	// 완전히 덮인 바로 왼쪽 픽셀 안의 박스는 가려짐
+	const FAABB InsideEdge(FVector(PixelToNdcX(191.2f), PixelToNdcY(60.0f), 0.5f), FVector(PixelToNdcX(191.8f), PixelToNdcY(50.0f), 0.6f));
+	SELF_TEST_CHECK(!IsVisible(Manager, InsideEdge));
+}
+
+IMPLEMENT_SELF_TEST(Occlusion, ParallelMatchesSerial)
+{
+	FOcclusionTestScene Scene;
+	Scene.AddQuad(-0.9f, -0.9f, 0.1f, 0.2f, 0.4f);
+	Scene.AddQuad(-0.2f, -0.5f, 0.8f, 0.9f, 0.6f);
+	Scene.AddTriangle(FVector(-1.5f, 0.0f, 0.2f), FVector(0.3f, 1.5f, 0.8f), FVector(0.9f, -1.2f, 0.5f));
+	Scene.FinishOccluder();
+
+	FOcclusionCullingManagerCPU Serial;
+	FOcclusionCullingManagerCPU Parallel;
+	Scene.Rasterize(Serial, false);
+	Scene.Rasterize(Parallel, true);
+
+	const FOcclusionDepthBuffer& A = Serial.GetDepthBuffer();
+	const FOcclusionDepthBuffer& B = Parallel.GetDepthBuffer();
+	bool bSame = A.GetMipCount() == B.GetMipCount();
+	for (int32 Mip = 0; bSame && Mip < A.GetMipCount(); ++Mip)
+	{
+		const size_t Count = static_cast<size_t>(A.GetMipWidth(Mip)) * A.GetMipHeight(Mip);
+		bSame = memcmp(A.GetMipData(Mip), B.GetMipData(Mip), Count * sizeof(float)) == 0;
+	}
+	SELF_TEST_CHECK(bSame);
+}
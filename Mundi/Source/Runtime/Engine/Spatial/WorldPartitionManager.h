@@ -37,6 +37,9 @@ public:
 
 	void Update(float DeltaTime, const uint32 BudgetCount = 256);
 
+	// 갱신 대기 중 (BVH의 바운드가 아직 이전 위치일 수 있음)
+	bool IsDirty(UStaticMeshComponent* Smc) const { return ComponentDirtySet.Contains(Smc); }
+
     //void RayQueryOrdered(FRay InRay, OUT TArray<std::pair<AActor*, float>>& Candidates);
     void RayQueryClosest(FRay InRay, OUT AActor*& OutActor, OUT float& OutBestT);
 	void FrustumQuery(FFrustum InFrustum);
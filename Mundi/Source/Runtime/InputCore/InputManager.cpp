@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include <windowsx.h> // GET_X_LPARAM / GET_Y_LPARAM
+#include "InputRecording.h"
 
 #ifndef GET_X_LPARAM
 #define GET_X_LPARAM(lp) ((int)(short)LOWORD(lp))
@@ -444,3 +445,45 @@ void UInputManager::ReleaseCursor()
     MousePosition = LockedCursorPosition;
     PreviousMousePosition = LockedCursorPosition;
 }
+
+void UInputManager::CaptureFrameState(FInputFrameState& OutState) const
+{
+    OutState.MousePosition = MousePosition;
+    OutState.PreviousMousePosition = PreviousMousePosition;
+    OutState.MouseWheelDelta = MouseWheelDelta;
+
+    OutState.MouseButtons = 0;
+    for (int i = 0; i < MaxMouseButtons; ++i)
+    {
+        if (MouseButtons[i])
+        {
+            OutState.MouseButtons |= static_cast<uint8>(1u << i);
+        }
+    }
+
+    memset(OutState.KeyBits, 0, sizeof(OutState.KeyBits));
+    for (int KeyCode = 0; KeyCode < 256; ++KeyCode)
+    {
+        if (KeyStates[KeyCode])
+        {
+            OutState.KeyBits[KeyCode >> 5] |= 1u << (KeyCode & 31);
+        }
+    }
+}
+
+void UInputManager::ApplyFrameState(const FInputFrameState& InState)
+{
+    // Previous* 상태는 직전 프레임 끝의 Update()가 이미 만들어 둠
+    MousePosition = InState.MousePosition;
+    PreviousMousePosition = InState.PreviousMousePosition;
+    MouseWheelDelta = InState.MouseWheelDelta;
+
+    for (int i = 0; i < MaxMouseButtons; ++i)
+    {
+        MouseButtons[i] = (InState.MouseButtons & (1u << i)) != 0;
+    }
+    for (int KeyCode = 0; KeyCode < 256; ++KeyCode)
+    {
+        KeyStates[KeyCode] = (InState.KeyBits[KeyCode >> 5] & (1u << (KeyCode & 31))) != 0;
+    }
+}
@@ -18,6 +18,8 @@ enum EMouseButton
     MaxMouseButtons = 5
 };
 
+struct FInputFrameState;
+
 class UInputManager : public UObject
 {
 public:
@@ -76,6 +78,11 @@ public:
     void ReleaseCursor();
     bool IsCursorLocked() const { return bIsCursorLocked; }
 
+    // 입력 녹화/재생 (InputRecording.h)
+    // Capture: 메시지 처리 후 이번 프레임 상태 저장, Apply: 재생 시 월드 Tick 전에 상태를 덮어씀
+    void CaptureFrameState(FInputFrameState& OutState) const;
+    void ApplyFrameState(const FInputFrameState& InState);
+
 private:
     // 내부 헬퍼 함수들
     void UpdateMousePosition(int X, int Y);
@@ -0,0 +1,224 @@
+﻿#include "pch.h"
+#include "InputRecording.h"
+
+namespace
+{
+    enum EInputFrameFlags : uint8
+    {
+        IFF_Keys = 1 << 0,
+        IFF_MouseButtons = 1 << 1,
+        IFF_MousePosition = 1 << 2,
+        IFF_MouseWheel = 1 << 3,
+    };
+
+    template<typename T>
+    void WritePod(std::ofstream& Out, const T& Value)
+    {
+        Out.write(reinterpret_cast<const char*>(&Value), sizeof(T));
+    }
+
+    template<typename T>
+    bool ReadPod(std::ifstream& In, T& OutValue)
+    {
+        return static_cast<bool>(In.read(reinterpret_cast<char*>(&OutValue), sizeof(T)));
+    }
+}
+
+bool FInputRecording::SaveToFile(const FString& InPath) const
+{
+    const fs::path Path(UTF8ToWide(InPath));
+    if (Path.has_parent_path())
+    {
+        std::error_code Ec;
+        fs::create_directories(Path.parent_path(), Ec);
+    }
+
+    std::ofstream Out(Path, std::ios::binary);
+    if (!Out.is_open())
+    {
+        UE_LOG("[InputRecording] Failed to open '%s' for writing", InPath.c_str());
+        return false;
+    }
+
+    WritePod(Out, FileMagic);
+    WritePod(Out, FileVersion);
+    WritePod(Out, RandomSeed);
+    WritePod(Out, static_cast<uint32>(Frames.Num()));
+    WritePod(Out, static_cast<uint32>(LevelPath.size()));
+    Out.write(LevelPath.data(), LevelPath.size());
+
+    // 이전 프레임 대비 바뀐 것만 기록
+    FInputFrameState Previous;
+    for (const FInputFrameState& Frame : Frames)
+    {
+        uint8 KeyWordMask = 0;
+        for (uint32 Word = 0; Word < 8; ++Word)
+        {
+            if (Frame.KeyBits[Word] != Previous.KeyBits[Word])
+            {
+                KeyWordMask |= static_cast<uint8>(1u << Word);
+            }
+        }
+
+        uint8 Flags = 0;
+        if (KeyWordMask) Flags |= IFF_Keys;
+        if (Frame.MouseButtons != Previous.MouseButtons) Flags |= IFF_MouseButtons;
+        if (Frame.MousePosition != Previous.MousePosition || Frame.PreviousMousePosition != Previous.PreviousMousePosition) Flags |= IFF_MousePosition;
+        if (Frame.MouseWheelDelta != 0.0f) Flags |= IFF_MouseWheel;
+
+        WritePod(Out, Flags);
+        WritePod(Out, Frame.DeltaSeconds);
+        if (Flags & IFF_Keys)
+        {
+            WritePod(Out, KeyWordMask);
+            for (uint32 Word = 0; Word < 8; ++Word)
+            {
+                if (KeyWordMask & (1u << Word))
+                {
+                    WritePod(Out, Frame.KeyBits[Word]);
+                }
+            }
+        }
+        if (Flags & IFF_MouseButtons)
+        {
+            WritePod(Out, Frame.MouseButtons);
+        }
+        if (Flags & IFF_MousePosition)
+        {
+            WritePod(Out, Frame.MousePosition);
+            WritePod(Out, Frame.PreviousMousePosition);
+        }
+        if (Flags & IFF_MouseWheel)
+        {
+            WritePod(Out, Frame.MouseWheelDelta);
+        }
+
+        Previous = Frame;
+    }
+
+    return static_cast<bool>(Out);
+}
+
+bool FInputRecording::LoadFromFile(const FString& InPath)
+{
+    std::ifstream In(fs::path(UTF8ToWide(InPath)), std::ios::binary);
+    if (!In.is_open())
+    {
+        UE_LOG("[InputRecording] Failed to open '%s'", InPath.c_str());
+        return false;
+    }
+
+    uint32 Magic = 0, Version = 0, FrameCount = 0, LevelPathLength = 0;
+    if (!ReadPod(In, Magic) || Magic != FileMagic || !ReadPod(In, Version) || Version != FileVersion)
+    {
+        UE_LOG("[InputRecording] '%s' is not an input recording (or has an unsupported version)", InPath.c_str());
+        return false;
+    }
+    if (!ReadPod(In, RandomSeed) || !ReadPod(In, FrameCount) || !ReadPod(In, LevelPathLength))
+    {
+        UE_LOG("[InputRecording] '%s' has a truncated header", InPath.c_str());
+        return false;
+    }
+
+    LevelPath.resize(LevelPathLength);
+    In.read(LevelPath.data(), LevelPathLength);
+
+    Frames.clear();
+    Frames.reserve(FrameCount);
+
+    FInputFrameState Current;
+    for (uint32 FrameIndex = 0; FrameIndex < FrameCount; ++FrameIndex)
+    {
+        uint8 Flags = 0;
+        bool bOk = ReadPod(In, Flags) && ReadPod(In, Current.DeltaSeconds);
+        if (bOk && (Flags & IFF_Keys))
+        {
+            uint8 KeyWordMask = 0;
+            bOk = ReadPod(In, KeyWordMask);
+            for (uint32 Word = 0; bOk && Word < 8; ++Word)
+            {
+                if (KeyWordMask & (1u << Word))
+                {
+                    bOk = ReadPod(In, Current.KeyBits[Word]);
+                }
+            }
+        }
+        if (bOk && (Flags & IFF_MouseButtons))
+        {
+            bOk = ReadPod(In, Current.MouseButtons);
+        }
+        if (bOk && (Flags & IFF_MousePosition))
+        {
+            bOk = ReadPod(In, Current.MousePosition) && ReadPod(In, Current.PreviousMousePosition);
+        }
+        Current.MouseWheelDelta = 0.0f;
+        if (bOk && (Flags & IFF_MouseWheel))
+        {
+            bOk = ReadPod(In, Current.MouseWheelDelta);
+        }
+
+        if (!bOk)
+        {
+            UE_LOG("[InputRecording] '%s' is truncated at frame %u / %u", InPath.c_str(), FrameIndex, FrameCount);
+            return false;
+        }
+        Frames.Add(Current);
+    }
+
+    return true;
+}
+
+FInputRecorder& FInputRecorder::GetInstance()
+{
+    static FInputRecorder Instance;
+    return Instance;
+}
+
+void FInputRecorder::Arm(const FString& InOutputPath)
+{
+    OutputPath = InOutputPath;
+    UE_LOG("[InputRecording] Armed: next PIE session will be recorded to '%s'", OutputPath.c_str());
+}
+
+void FInputRecorder::BeginSession(const FString& InLevelPath, uint32 InRandomSeed)
+{
+    if (!IsArmed())
+    {
+        return;
+    }
+
+    Recording = FInputRecording();
+    Recording.LevelPath = InLevelPath;
+    Recording.RandomSeed = InRandomSeed;
+    bRecording = true;
+    UE_LOG("[InputRecording] Recording started (level '%s', seed %u)", InLevelPath.c_str(), InRandomSeed);
+}
+
+void FInputRecorder::RecordFrame(float InDeltaSeconds)
+{
+    if (!bRecording)
+    {
+        return;
+    }
+
+    FInputFrameState Frame;
+    UInputManager::GetInstance().CaptureFrameState(Frame);
+    Frame.DeltaSeconds = InDeltaSeconds;
+    Recording.Frames.Add(Frame);
+}
+
+void FInputRecorder::EndSession()
+{
+    if (!bRecording)
+    {
+        return;
+    }
+
+    bRecording = false;
+    if (Recording.SaveToFile(OutputPath))
+    {
+        UE_LOG("[InputRecording] Saved %d frames to '%s'", Recording.Frames.Num(), OutputPath.c_str());
+    }
+    OutputPath.clear();
+    Recording = FInputRecording();
+}
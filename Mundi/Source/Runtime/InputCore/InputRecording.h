@@ -0,0 +1,63 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Vector.h"
+
+/**
+ * 한 프레임의 입력 상태 (UWorld::Tick 시점에 게임 코드가 보는 값).
+ * Previous* 상태는 UInputManager::Update가 프레임 끝에서 만들므로 저장하지 않습니다.
+ */
+struct FInputFrameState
+{
+    float DeltaSeconds = 0.0f;
+    FVector2D MousePosition;
+    FVector2D PreviousMousePosition;
+    float MouseWheelDelta = 0.0f;
+    uint8 MouseButtons = 0;     // EMouseButton 비트
+    uint32 KeyBits[8] = {};     // Virtual Key Code 256개 비트
+};
+
+/**
+ * 입력 녹화 파일 (.minput).
+ * 헤더 뒤에 프레임마다 플래그 1바이트 + DeltaSeconds만 쓰고, 바뀐 상태(키 32비트 워드, 마우스 버튼/위치, 휠)만 덧붙입니다.
+ * 입력이 없는 프레임은 5바이트입니다.
+ */
+struct FInputRecording
+{
+    FString LevelPath;          // 녹화 시작 시 에디터 월드에 로드된 레벨 (없으면 빈 문자열)
+    uint32 RandomSeed = 0;      // PIE 시작 시 srand / math.randomseed에 넣은 값
+    TArray<FInputFrameState> Frames;
+
+    bool SaveToFile(const FString& InPath) const;
+    bool LoadFromFile(const FString& InPath);
+
+    static constexpr uint32 FileMagic = 0x52494E4D;    // "MNIR"
+    static constexpr uint32 FileVersion = 1;
+};
+
+/**
+ * PIE 세션 입력 녹화기.
+ * Arm으로 저장 경로를 정해 두면 다음 PIE 시작에서 녹화를 시작하고 PIE 종료 시 파일로 저장합니다.
+ */
+class FInputRecorder
+{
+public:
+    static FInputRecorder& GetInstance();
+
+    void Arm(const FString& InOutputPath);
+    bool IsArmed() const { return !OutputPath.empty(); }
+    bool IsRecording() const { return bRecording; }
+
+    // PIE 시작 (UEditorEngine::StartPIE)
+    void BeginSession(const FString& InLevelPath, uint32 InRandomSeed);
+    // 메시지 처리 후, 월드 Tick 전에 호출
+    void RecordFrame(float InDeltaSeconds);
+    // PIE 종료 시 파일 저장
+    void EndSession();
+
+private:
+    FInputRecorder() = default;
+
+    FString OutputPath;
+    FInputRecording Recording;
+    bool bRecording = false;
+};
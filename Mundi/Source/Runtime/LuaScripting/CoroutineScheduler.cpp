@@ -1,128 +1,269 @@
 ﻿#include "pch.h"
 
 #include "CoroutineScheduler.h"
+#include "PlatformTime.h"
+
+namespace
+{
+    // std::push_heap은 max-heap이므로 비교를 뒤집어 가장 이른 WakeTime이 front에 오도록 함
+    struct FTimerLater
+    {
+        bool operator()(const FCoroutineTimer& A, const FCoroutineTimer& B) const
+        {
+            if (A.WakeTime != B.WakeTime)
+            {
+                return A.WakeTime > B.WakeTime;
+            }
+            return A.Sequence > B.Sequence;
+        }
+    };
+}
 
 void UCoroutineScheduler::Start(sol::function F)
 {
     sol::thread NewThread = sol::thread::create(F.lua_state());
     sol::coroutine Co(NewThread.state(), F);
 
-    CoroutineEntry E{ NewThread, Co, CurrentTime, nullptr, false, false };
-    Entries.Add(std::move(E));
+    uint32 Slot;
+    if (!FreeSlots.IsEmpty())
+    {
+        Slot = FreeSlots.back();
+        FreeSlots.pop_back();
+    }
+    else
+    {
+        Slot = static_cast<uint32>(Entries.Num());
+        Entries.emplace_back();
+    }
+
+    CoroutineEntry& E = Entries[Slot];
+    E.Thread = std::move(NewThread);
+    E.Co = std::move(Co);
+    E.bInUse = true;
+    ++ActiveCount;
 
-    UE_LOG("[Coroutine] Started new coroutine. Total entries: %zu", Entries.Num());
+    // 시작은 다음 Update에서
+    NextFrameSlots.Add(Slot);
 }
 
 void UCoroutineScheduler::Update(double Dt)
 {
     CurrentTime += Dt;
+    LastResumeCount = 0;
 
-    if (Entries.empty())
+    if (ActiveCount == 0)
     {
 		return;
     }
 
-    for (auto It = Entries.begin(); It != Entries.end();)
+    // 1. 이번 프레임에 깨어날 코루틴 수집 (Resume 중 새로 잠드는 코루틴은 다음 프레임부터 대상)
+    ReadySlots.clear();
+    ReadySlots.swap(NextFrameSlots);
+
+    while (!Timers.IsEmpty() && Timers.front().WakeTime <= CurrentTime)
     {
-        if (It->bFinished)
-        {
-            It = Entries.erase(It);
-            continue;
-        }
-        ++It;
+        std::pop_heap(Timers.begin(), Timers.end(), FTimerLater{});
+        ReadySlots.Add(Timers.back().Slot);
+        Timers.pop_back();
     }
 
-    uint32 index = 0;
-    for (auto It = Entries.begin(); It != Entries.end(); ++It, ++index)
+    for (int32 Index = 0; Index < PredicateWaits.Num();)
     {
-        if(It->bFinished)
+        FCoroutinePredicateWait& Wait = PredicateWaits[Index];
+        if (Wait.NextPollTime > CurrentTime)
         {
+            ++Index;
             continue;
-		}
-
-        bool Ready = false;
-
-        if (It->WaitingNextFrame)
-        {
-            UE_LOG("[Coroutine] Ready: WaitingNextFrame, Entry index %u", index);
-            Ready = true;
-            It->WaitingNextFrame = false;
         }
-        else if (It->WaitUntil)
+
+        sol::protected_function_result R = Wait.Predicate();
+        if (!R.valid())
         {
-            if (It->WaitUntil())
-            {
-                UE_LOG("[Coroutine] Ready: WaitUntil condition met, Entry index %u", index);
-                Ready = true;
-                It->WaitUntil = nullptr;
-            }
+            sol::error Err = R;
+            UE_LOG("[Coroutine Error] WaitUntil predicate: %s", Err.what());
+            Release(Wait.Slot);
         }
-        else if (CurrentTime >= It->WakeTime)
+        else if (R.get<bool>())
         {
-
-            UE_LOG("[Coroutine] Ready: WakeTime reached (CurrentTime: %.3f >= WakeTime: %.3f), Entry index %u",
-                   CurrentTime, It->WakeTime, index);
-            Ready = true;
+            ReadySlots.Add(Wait.Slot);
         }
-
-        if (!Ready) { continue; }
-
-        UE_LOG("[Coroutine] Executing coroutine..., Entry index %u", index);
-        
-		// ✅ auto로 받아서 sol2가 자동으로 타입 추론하도록 함
-        auto result = It->Co(); // 다음 yield에 도달할 때까지 코루틴 실행 -> yield의 인자 리턴
-        
-        // ✅ 에러 체크
-        if (!result.valid())
+        else
         {
-            sol::error err = result;
-            UE_LOG("[Coroutine Error] %s", err.what());
-            It = Entries.erase(It);
+            Wait.NextPollTime = CurrentTime + Wait.PollInterval;
+            ++Index;
             continue;
         }
 
-        // ✅ 코루틴 상태 확인
-        if (It->Co.status() == sol::call_status::ok)
+        // swap-remove
+        if (Index != PredicateWaits.Num() - 1)
         {
-            UE_LOG("[Coroutine] Finished (status: ok), Entry index %u", index);
-            /*It = Entries.erase(It);*/
-			It->bFinished = true;
-            continue;
+            PredicateWaits[Index] = std::move(PredicateWaits.back());
         }
+        PredicateWaits.pop_back();
+    }
 
-        // ✅ yield 값 해석 - sol::object로 명시적 변환
-        sol::object YieldedValue = result;  // auto -> sol::object
-        sol::type ValueType = YieldedValue.get_type();
+    // 2. 실행
+    // Resume 안에서 StartCoroutine이 불려 NextFrameSlots가 커질 수 있으므로 인덱스로 순회
+    for (int32 i = 0; i < ReadySlots.Num(); ++i)
+    {
+        Resume(ReadySlots[i]);
+    }
+    LastResumeCount = static_cast<uint32>(ReadySlots.Num());
+}
 
-        UE_LOG("[Coroutine] Yielded value type: %d, Entry index %u", static_cast<int>(ValueType), index);
+void UCoroutineScheduler::Resume(uint32 Slot)
+{
+    // 코루틴 안에서 StartCoroutine이 호출되면 Entries가 재할당될 수 있으므로
+    // 실행 중인 코루틴은 로컬 사본(같은 Lua 레퍼런스)으로 잡고, 이후 상태는 Slot 인덱스로만 갱신
+    sol::coroutine Co = Entries[Slot].Co;
 
-        // ✅ nil 체크
-        if (ValueType == sol::type::lua_nil)
+    // 다음 yield에 도달할 때까지 코루틴 실행 -> yield의 인자 리턴
+    sol::protected_function_result Result = Co();
+
+    if (!Result.valid())
+    {
+        sol::error Err = Result;
+        UE_LOG("[Coroutine Error] %s", Err.what());
+        Release(Slot);
+        return;
+    }
+
+    if (Co.status() == sol::call_status::ok)
+    {
+        Release(Slot);
+        return;
+    }
+
+    sol::object YieldedValue = Result.get<sol::object>(0);
+    switch (YieldedValue.get_type())
+    {
+    case sol::type::number:
+    {
+        const double Sec = YieldedValue.as<double>();
+        if (Sec > 0.0)
         {
-            UE_LOG("[Coroutine] Yielded: nil (wait next frame), Entry index %u", index);  
-            It->WaitingNextFrame = true;
+            AddTimer(Slot, CurrentTime + Sec);
         }
-        // ✅ number 타입
-        else if (ValueType == sol::type::number)
+        else
         {
-            double Sec = YieldedValue.as<double>();
-            It->WakeTime = CurrentTime + Sec;
-            UE_LOG("[Coroutine] Yielded: %.3f seconds (WakeTime: %.3f), Entry index %u", Sec, It->WakeTime, index);
+            NextFrameSlots.Add(Slot);
         }
-        // ✅ function 타입
-        else if (ValueType == sol::type::function)
+        break;
+    }
+    case sol::type::function:
+    {
+        FCoroutinePredicateWait Wait;
+        Wait.Slot = Slot;
+        Wait.Predicate = YieldedValue.as<sol::protected_function>();
+        if (Result.return_count() > 1)
         {
-            UE_LOG("[Coroutine] Yielded: function (wait until condition), Entry index %u", index);
-            sol::function Pred = YieldedValue.as<sol::function>();
-            It->WaitUntil = [Pred]() {
-                sol::protected_function_result R = Pred();
-                return R.valid() && R.get<bool>();
-            };
+            sol::object Interval = Result.get<sol::object>(1);
+            if (Interval.get_type() == sol::type::number)
+            {
+                Wait.PollInterval = std::max(0.0, Interval.as<double>());
+            }
         }
-        else
+        // 첫 검사는 다음 프레임
+        Wait.NextPollTime = CurrentTime;
+        PredicateWaits.Add(std::move(Wait));
+        break;
+    }
+    default:
+        // nil 또는 알 수 없는 타입 -> 다음 프레임
+        NextFrameSlots.Add(Slot);
+        break;
+    }
+}
+
+void UCoroutineScheduler::Release(uint32 Slot)
+{
+    CoroutineEntry& E = Entries[Slot];
+    E.Co = sol::coroutine();
+    E.Thread = sol::thread();
+    E.bInUse = false;
+
+    FreeSlots.Add(Slot);
+    --ActiveCount;
+}
+
+void UCoroutineScheduler::AddTimer(uint32 Slot, double WakeTime)
+{
+    FCoroutineTimer Timer;
+    Timer.WakeTime = WakeTime;
+    Timer.Sequence = TimerSequence++;
+    Timer.Slot = Slot;
+
+    Timers.Add(Timer);
+    std::push_heap(Timers.begin(), Timers.end(), FTimerLater{});
+}
+
+void UCoroutineScheduler::RunBenchmark(sol::state& Lua, uint32 InCoroutineCount)
+{
+    if (InCoroutineCount == 0)
+    {
+        return;
+    }
+
+    /*
+     * Idle     : 모두 오래 잠든 상태 -> 프레임 비용이 코루틴 수와 무관해야 함
+     * Staggered: 0.5~5초 주기로 나눠 깨어남 -> 프레임 비용이 깨어난 수에 비례해야 함
+     */
+    sol::protected_function_result LoadResult = Lua.load(R"(
+        return function(Period, Cycles)
+            return function()
+                for i = 1, Cycles do
+                    coroutine.yield(Period)
+                end
+            end
+        end
+    )", "=CoroutineBenchmark")();
+    if (!LoadResult.valid())
+    {
+        sol::error Err = LoadResult;
+        UE_LOG("[CoroutineBench] Failed to load benchmark script: %s", Err.what());
+        return;
+    }
+    sol::protected_function MakeSleeper = LoadResult.get<sol::protected_function>();
+
+    constexpr double FrameDt = 1.0 / 60.0;
+    constexpr uint32 FrameCount = 600;
+
+    auto RunCase = [&](const char* InName, auto&& InGetPeriod, uint32 InCycles)
+    {
+        UCoroutineScheduler Scheduler;
+        for (uint32 i = 0; i < InCoroutineCount; ++i)
         {
-            UE_LOG("[Coroutine] Yielded: unknown type (%d) (wait next frame), Entry index %u", static_cast<int>(ValueType), index);
-            It->WaitingNextFrame = true;
+            sol::function Body = MakeSleeper(InGetPeriod(i), InCycles);
+            Scheduler.Start(Body);
         }
-    }
+
+        // 첫 프레임: 전부 시작해서 첫 yield까지 실행
+        uint64 StartCycles = FPlatformTime::Cycles64();
+        Scheduler.Update(FrameDt);
+        const double StartMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        uint64 TotalResumes = 0;
+        double MaxFrameMs = 0.0;
+        StartCycles = FPlatformTime::Cycles64();
+        for (uint32 Frame = 0; Frame < FrameCount; ++Frame)
+        {
+            const uint64 FrameStart = FPlatformTime::Cycles64();
+            Scheduler.Update(FrameDt);
+            MaxFrameMs = std::max(MaxFrameMs, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - FrameStart));
+            TotalResumes += Scheduler.GetLastResumeCount();
+        }
+        const double TotalMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        UE_LOG("[CoroutineBench] %-9s | start %8.3f ms | %u frames avg %.4f ms max %.4f ms | resumes %llu (%.1f/frame, %.1f ns/resume) | active %u",
+            InName, StartMs, FrameCount, TotalMs / FrameCount, MaxFrameMs,
+            TotalResumes, static_cast<double>(TotalResumes) / FrameCount,
+            TotalResumes > 0 ? TotalMs * 1.0e6 / static_cast<double>(TotalResumes) : 0.0,
+            Scheduler.GetActiveCount());
+    };
+
+    UE_LOG("[CoroutineBench] %u coroutines", InCoroutineCount);
+    RunCase("Idle", [](uint32) { return 1.0e6; }, 1);
+    RunCase("Staggered", [](uint32 i) { return 0.5 + (i % 10) * 0.5; }, 1000);
+
+    Lua.collect_garbage();
 }
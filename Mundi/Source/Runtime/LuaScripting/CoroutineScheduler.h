@@ -3,18 +3,40 @@
 
 #include "Object.h"
 
-struct CoroutineEntry 
+struct CoroutineEntry
 {
     sol::thread Thread;
     sol::coroutine Co;
+    bool bInUse = false;
+};
+
+// 시간 대기 (min-heap 원소)
+struct FCoroutineTimer
+{
     double WakeTime = 0.0;
-    std::function<bool()> WaitUntil;
-    bool WaitingNextFrame = false;
+    uint64 Sequence = 0;    // 같은 WakeTime이면 먼저 잠든 코루틴부터
+    uint32 Slot = 0;
+};
 
-    bool bFinished = false;
+// 조건 대기 (PollInterval마다 Predicate 호출, 0이면 매 프레임)
+struct FCoroutinePredicateWait
+{
+    uint32 Slot = 0;
+    sol::protected_function Predicate;
+    double PollInterval = 0.0;
+    double NextPollTime = 0.0;
 };
 
-class UCoroutineScheduler : public UObject 
+/**
+ * Lua 코루틴 스케줄러
+ *   coroutine.yield()             -> 다음 프레임
+ *   coroutine.yield(Sec)          -> Sec초 뒤 (min-heap)
+ *   coroutine.yield(Pred[, Sec])  -> Pred()가 true가 될 때까지 (Sec 간격으로 검사, 생략 시 매 프레임)
+ *
+ * 대기 종류별로 따로 보관하므로 Update 비용은 이번 프레임에 깨어나는 코루틴 수(+ 조건 대기 수)에 비례하고,
+ * 잠들어 있는 코루틴은 순회하지 않습니다. 끝난 코루틴의 슬롯은 프리 리스트로 재사용합니다.
+ */
+class UCoroutineScheduler : public UObject
 {
 public:
     UCoroutineScheduler() = default;
@@ -29,9 +51,34 @@ public:
             Start(f);
         });
 	}
+
+    uint32 GetActiveCount() const { return ActiveCount; }
+    uint32 GetLastResumeCount() const { return LastResumeCount; }
+
+    // InCoroutineCount개의 코루틴을 잠재운 뒤 프레임당 Update 비용을 측정해 UE_LOG로 출력
+    static void RunBenchmark(sol::state& Lua, uint32 InCoroutineCount);
+
 private:
+    // 코루틴을 다음 yield까지 실행하고 yield 값에 따라 대기열에 넣음
+    void Resume(uint32 Slot);
+    void Release(uint32 Slot);
+    void AddTimer(uint32 Slot, double WakeTime);
+
     double CurrentTime = 0.0;
+
     TArray<CoroutineEntry> Entries;
+    TArray<uint32> FreeSlots;
+    uint32 ActiveCount = 0;
+
+    TArray<FCoroutineTimer> Timers;                 // WakeTime 기준 min-heap
+    TArray<uint32> NextFrameSlots;
+    TArray<FCoroutinePredicateWait> PredicateWaits;
+
+    // Update 중 이번 프레임에 깨울 슬롯 (재할당을 피하려고 멤버로 유지)
+    TArray<uint32> ReadySlots;
+
+    uint64 TimerSequence = 0;
+    uint32 LastResumeCount = 0;
 };
 
 // 코루틴 예시
@@ -46,9 +93,9 @@ private:
 //            coroutine.yield(function()
 //                count = count + 1
 //                return count >= 3
-//            end)
+//            end, 0.1)                       -- 0.1초마다 검사
 //            print("[Lua] 끝")
 //        end
 //
 //        StartCoroutine(MyRoutine)
-//    )");
\ No newline at end of file
+//    )");
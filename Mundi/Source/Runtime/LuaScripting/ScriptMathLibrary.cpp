@@ -0,0 +1,377 @@
+﻿#include "pch.h"
+#include "Source/Runtime/LuaScripting/ScriptMathLibrary.h"
+
+#include "Source/Runtime/Core/Object/Actor.h"
+#include "StaticMeshActor.h"
+#include "PlatformTime.h"
+
+namespace
+{
+    using FVec3 = std::tuple<float, float, float>;
+
+    /*
+     * 평탄한 배열 { x1, y1, z1, x2, ... } 접근.
+     * sol 프록시 대신 raw get/set으로 직접 읽고 쓴다. (메타메서드/임시 객체 없음)
+     */
+    template<typename FuncType>
+    int32 ReadTriples(const sol::table& InTable, int32 InMaxCount, FuncType&& InFunc)
+    {
+        lua_State* L = InTable.lua_state();
+        InTable.push();
+        const int TableIndex = lua_gettop(L);
+
+        const int32 Count = std::min<int32>(InMaxCount, static_cast<int32>(lua_rawlen(L, TableIndex) / 3));
+        for (int32 i = 0; i < Count; ++i)
+        {
+            const lua_Integer Base = static_cast<lua_Integer>(i) * 3;
+            lua_rawgeti(L, TableIndex, Base + 1);
+            lua_rawgeti(L, TableIndex, Base + 2);
+            lua_rawgeti(L, TableIndex, Base + 3);
+            const FVector Value(
+                static_cast<float>(lua_tonumber(L, -3)),
+                static_cast<float>(lua_tonumber(L, -2)),
+                static_cast<float>(lua_tonumber(L, -1)));
+            lua_pop(L, 3);
+
+            InFunc(i, Value);
+        }
+
+        lua_pop(L, 1);
+        return Count;
+    }
+
+    // InFunc(i, OutValue)가 true를 반환한 항목만 기록
+    template<typename FuncType>
+    int32 WriteTriples(const sol::table& InTable, int32 InCount, FuncType&& InFunc)
+    {
+        lua_State* L = InTable.lua_state();
+        InTable.push();
+        const int TableIndex = lua_gettop(L);
+
+        int32 Written = 0;
+        FVector Value;
+        for (int32 i = 0; i < InCount; ++i)
+        {
+            if (!InFunc(i, Value))
+            {
+                continue;
+            }
+
+            const lua_Integer Base = static_cast<lua_Integer>(i) * 3;
+            lua_pushnumber(L, Value.X);
+            lua_rawseti(L, TableIndex, Base + 1);
+            lua_pushnumber(L, Value.Y);
+            lua_rawseti(L, TableIndex, Base + 2);
+            lua_pushnumber(L, Value.Z);
+            lua_rawseti(L, TableIndex, Base + 3);
+            ++Written;
+        }
+
+        lua_pop(L, 1);
+        return Written;
+    }
+
+    const char* const BenchmarkScript = R"(
+        local Bench = {}
+
+        -- GC를 멈춘 상태에서 Func 실행 동안 늘어난 Lua 힙 바이트 수
+        function Bench.Measure(Func, ...)
+            collectgarbage("collect")
+            collectgarbage("stop")
+            local Before = collectgarbage("count")
+            Func(...)
+            local After = collectgarbage("count")
+            collectgarbage("restart")
+            return (After - Before) * 1024
+        end
+
+        function Bench.UserdataMath(N)
+            local Acc = FVector.new(0, 0, 0)
+            local Step = FVector.new(1, 2, 3)
+            for i = 1, N do
+                Acc = Acc + Step * 0.5
+            end
+        end
+
+        function Bench.NumberMath(N)
+            local X, Y, Z = 0, 0, 0
+            for i = 1, N do
+                X, Y, Z = Vec.Add(X, Y, Z, Vec.Scale(1, 2, 3, 0.5))
+            end
+        end
+
+        function Bench.PerActorUserdata(Actors, N)
+            local Count = #Actors
+            for i = 1, N do
+                Actors[(i - 1) % Count + 1]:SetLocation(FVector.new(i, 0, 0))
+            end
+        end
+
+        function Bench.PerActorNumbers(Actors, N)
+            local Count = #Actors
+            for i = 1, N do
+                Actors[(i - 1) % Count + 1]:SetLocationXYZ(i, 0, 0)
+            end
+        end
+
+        function Bench.Batch(Batch, Buffer, N)
+            local Count = Batch:Num()
+            for Pass = 1, N // Count do
+                for i = 1, Count * 3, 3 do
+                    Buffer[i] = Pass
+                    Buffer[i + 1] = 0
+                    Buffer[i + 2] = 0
+                end
+                Batch:SetLocations(Buffer)
+            end
+        end
+
+        return Bench
+    )";
+}
+
+// ─────────────── FScriptActorBatch
+
+void FScriptActorBatch::Add(AActor* InActor)
+{
+    if (InActor)
+    {
+        Actors.Add(TWeakPtr<AActor>(InActor));
+    }
+}
+
+int32 FScriptActorBatch::GetLocations(sol::table Out) const
+{
+    return WriteTriples(Out, Actors.Num(), [this](int32 Index, FVector& OutValue)
+    {
+        AActor* Actor = Actors[Index].Get();
+        if (!Actor) return false;
+        OutValue = Actor->GetActorLocation();
+        return true;
+    });
+}
+
+int32 FScriptActorBatch::GetRotationsEuler(sol::table Out) const
+{
+    return WriteTriples(Out, Actors.Num(), [this](int32 Index, FVector& OutValue)
+    {
+        AActor* Actor = Actors[Index].Get();
+        if (!Actor) return false;
+        OutValue = Actor->GetActorRotation().ToEulerZYXDeg();
+        return true;
+    });
+}
+
+int32 FScriptActorBatch::GetScales(sol::table Out) const
+{
+    return WriteTriples(Out, Actors.Num(), [this](int32 Index, FVector& OutValue)
+    {
+        AActor* Actor = Actors[Index].Get();
+        if (!Actor) return false;
+        OutValue = Actor->GetActorScale();
+        return true;
+    });
+}
+
+void FScriptActorBatch::SetLocations(sol::table In)
+{
+    ReadTriples(In, Actors.Num(), [this](int32 Index, const FVector& Value)
+    {
+        if (AActor* Actor = Actors[Index].Get())
+        {
+            Actor->SetActorLocation(Value);
+        }
+    });
+}
+
+void FScriptActorBatch::AddWorldOffsets(sol::table In)
+{
+    ReadTriples(In, Actors.Num(), [this](int32 Index, const FVector& Value)
+    {
+        if (AActor* Actor = Actors[Index].Get())
+        {
+            Actor->AddActorWorldLocation(Value);
+        }
+    });
+}
+
+void FScriptActorBatch::SetRotationsEuler(sol::table In)
+{
+    ReadTriples(In, Actors.Num(), [this](int32 Index, const FVector& Value)
+    {
+        if (AActor* Actor = Actors[Index].Get())
+        {
+            Actor->SetActorRotation(Value);
+        }
+    });
+}
+
+void FScriptActorBatch::SetScales(sol::table In)
+{
+    ReadTriples(In, Actors.Num(), [this](int32 Index, const FVector& Value)
+    {
+        if (AActor* Actor = Actors[Index].Get())
+        {
+            Actor->SetActorScale(Value);
+        }
+    });
+}
+
+void FScriptActorBatch::AddUniformWorldOffset(float X, float Y, float Z)
+{
+    const FVector Delta(X, Y, Z);
+    for (const TWeakPtr<AActor>& WeakActor : Actors)
+    {
+        if (AActor* Actor = WeakActor.Get())
+        {
+            Actor->AddActorWorldLocation(Delta);
+        }
+    }
+}
+
+// ─────────────── 등록
+
+void RegisterScriptMathLibrary(sol::state& Lua)
+{
+    // 숫자 기반 벡터 연산: 인자/반환값이 모두 Lua 숫자라 userdata 할당 없음
+    sol::table Vec = Lua.create_named_table("Vec");
+    Vec.set_function("Add", [](float AX, float AY, float AZ, float BX, float BY, float BZ) -> FVec3
+    {
+        return { AX + BX, AY + BY, AZ + BZ };
+    });
+    Vec.set_function("Sub", [](float AX, float AY, float AZ, float BX, float BY, float BZ) -> FVec3
+    {
+        return { AX - BX, AY - BY, AZ - BZ };
+    });
+    Vec.set_function("Scale", [](float X, float Y, float Z, float S) -> FVec3
+    {
+        return { X * S, Y * S, Z * S };
+    });
+    Vec.set_function("Dot", [](float AX, float AY, float AZ, float BX, float BY, float BZ)
+    {
+        return AX * BX + AY * BY + AZ * BZ;
+    });
+    Vec.set_function("Cross", [](float AX, float AY, float AZ, float BX, float BY, float BZ) -> FVec3
+    {
+        return { AY * BZ - AZ * BY, AZ * BX - AX * BZ, AX * BY - AY * BX };
+    });
+    Vec.set_function("LengthSquared", [](float X, float Y, float Z)
+    {
+        return X * X + Y * Y + Z * Z;
+    });
+    Vec.set_function("Length", [](float X, float Y, float Z)
+    {
+        return std::sqrt(X * X + Y * Y + Z * Z);
+    });
+    Vec.set_function("Distance", [](float AX, float AY, float AZ, float BX, float BY, float BZ)
+    {
+        const float DX = AX - BX, DY = AY - BY, DZ = AZ - BZ;
+        return std::sqrt(DX * DX + DY * DY + DZ * DZ);
+    });
+    Vec.set_function("Normalize", [](float X, float Y, float Z) -> FVec3
+    {
+        const float LengthSq = X * X + Y * Y + Z * Z;
+        if (LengthSq <= 1e-12f)
+        {
+            return { 0.0f, 0.0f, 0.0f };
+        }
+        const float InvLength = 1.0f / std::sqrt(LengthSq);
+        return { X * InvLength, Y * InvLength, Z * InvLength };
+    });
+    Vec.set_function("Lerp", [](float AX, float AY, float AZ, float BX, float BY, float BZ, float T) -> FVec3
+    {
+        return { AX + (BX - AX) * T, AY + (BY - AY) * T, AZ + (BZ - AZ) * T };
+    });
+
+    // 여러 액터 트랜스폼 일괄 읽기/쓰기
+    Lua.new_usertype<FScriptActorBatch>("FActorBatch",
+        sol::constructors<FScriptActorBatch()>(),
+        "Add", &FScriptActorBatch::Add,
+        "Clear", &FScriptActorBatch::Clear,
+        "Num", &FScriptActorBatch::Num,
+        "GetLocations", &FScriptActorBatch::GetLocations,
+        "GetRotationsEuler", &FScriptActorBatch::GetRotationsEuler,
+        "GetScales", &FScriptActorBatch::GetScales,
+        "SetLocations", &FScriptActorBatch::SetLocations,
+        "AddWorldOffsets", &FScriptActorBatch::AddWorldOffsets,
+        "SetRotationsEuler", &FScriptActorBatch::SetRotationsEuler,
+        "SetScales", &FScriptActorBatch::SetScales,
+        "AddUniformWorldOffset", &FScriptActorBatch::AddUniformWorldOffset
+    );
+}
+
+// ─────────────── 벤치마크
+
+void RunScriptMathBenchmark(sol::state& Lua, uint32 InOperationCount)
+{
+    if (InOperationCount == 0)
+    {
+        return;
+    }
+
+    sol::protected_function_result LoadResult = Lua.load(BenchmarkScript, "=ScriptMathBenchmark")();
+    if (!LoadResult.valid())
+    {
+        sol::error Err = LoadResult;
+        UE_LOG("[ScriptMathBench] Failed to load benchmark script: %s", Err.what());
+        return;
+    }
+    sol::table Bench = LoadResult.get<sol::table>();
+    sol::protected_function Measure = Bench["Measure"];
+
+    // 액터 트랜스폼 테스트용 임시 액터 (월드 미등록: 파티션/충돌 갱신 없이 바인딩 비용만 측정)
+    const uint32 ActorCount = std::min<uint32>(InOperationCount, 1000);
+    TArray<AActor*> Actors;
+    Actors.reserve(ActorCount);
+
+    sol::table ActorTable = Lua.create_table(static_cast<int>(ActorCount), 0);
+    sol::table Buffer = Lua.create_table(static_cast<int>(ActorCount * 3), 0);
+    FScriptActorBatch Batch;
+    for (uint32 i = 0; i < ActorCount; ++i)
+    {
+        AActor* Actor = NewObject<AStaticMeshActor>();
+        Actors.Add(Actor);
+        ActorTable[i + 1] = Actor;
+        Batch.Add(Actor);
+    }
+
+    auto RunCase = [&](const char* InName, const char* InFunctionName, auto&&... InArgs)
+    {
+        sol::protected_function Func = Bench[InFunctionName];
+
+        // 첫 호출의 테이블 확장/캐시 생성이 측정에 섞이지 않도록 한 번 미리 실행
+        Measure(Func, InArgs..., std::min<uint32>(InOperationCount, ActorCount));
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        sol::protected_function_result Result = Measure(Func, InArgs..., InOperationCount);
+        const double ElapsedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        if (!Result.valid())
+        {
+            sol::error Err = Result;
+            UE_LOG("[ScriptMathBench] %s failed: %s", InName, Err.what());
+            return;
+        }
+
+        const double AllocatedBytes = std::max(0.0, Result.get<double>());
+        UE_LOG("[ScriptMathBench] %-26s | %8.3f ms | %7.1f ms/10k ops | %12.0f bytes | %7.1f bytes/op",
+            InName, ElapsedMs, ElapsedMs * 10000.0 / InOperationCount, AllocatedBytes, AllocatedBytes / InOperationCount);
+    };
+
+    UE_LOG("[ScriptMathBench] %u operations, %u actors", InOperationCount, ActorCount);
+    RunCase("FVector userdata math", "UserdataMath");
+    RunCase("Vec number math", "NumberMath");
+    RunCase("SetLocation(FVector)", "PerActorUserdata", ActorTable);
+    RunCase("SetLocationXYZ", "PerActorNumbers", ActorTable);
+    RunCase("FActorBatch:SetLocations", "Batch", &Batch, Buffer);
+
+    // Lua 쪽 참조를 먼저 정리한 뒤 액터 삭제
+    ActorTable = sol::lua_nil;
+    Buffer = sol::lua_nil;
+    Lua.collect_garbage();
+
+    for (AActor* Actor : Actors)
+    {
+        ObjectFactory::DeleteObject(Actor);
+    }
+}
@@ -0,0 +1,51 @@
+﻿#pragma once
+#define SOL_ALL_SAFETIES_ON 1
+#include <sol/sol.hpp>
+#include "WeakPtr.h"
+
+class AActor;
+
+/**
+ * 할당 없는 Lua 수학/트랜스폼 API
+ *
+ * FVector/FQuat usertype은 연산마다 Lua userdata를 새로 만들어 GC 부담이 크므로,
+ * 벡터를 숫자 3개(다중 반환값)로 주고받는 경로를 따로 제공합니다. 숫자는 Lua 스택으로만 오가므로 힙 할당이 없습니다.
+ *
+ *   Vec.Add(ax, ay, az, bx, by, bz) -> x, y, z          (Sub, Scale, Cross, Lerp, Normalize도 동일)
+ *   Vec.Dot / Length / LengthSquared / Distance -> number
+ *   MyActor:GetLocationXYZ() -> x, y, z                  MyActor:SetLocationXYZ(x, y, z)
+ *   MyActor:AddWorldLocationXYZ(dx, dy, dz)              MyActor:SetRotationEuler(pitch, yaw, roll) ...
+ *
+ * 여러 액터의 트랜스폼은 FActorBatch로 평탄한 Lua 배열 { x1, y1, z1, x2, y2, z2, ... }과 한 번에 주고받습니다.
+ * 배열은 스크립트에서 한 번 만들어 재사용하면 매 프레임 할당이 없습니다.
+ */
+class FScriptActorBatch
+{
+public:
+    void Add(AActor* InActor);
+    void Clear() { Actors.clear(); }
+    int32 Num() const { return Actors.Num(); }
+
+    // Out에 액터 순서대로 3개씩 기록하고 기록한 액터 수를 반환 (파괴된 액터 자리는 건드리지 않음)
+    int32 GetLocations(sol::table Out) const;
+    int32 GetRotationsEuler(sol::table Out) const;
+    int32 GetScales(sol::table Out) const;
+
+    // In에서 액터 순서대로 3개씩 읽어 적용
+    void SetLocations(sol::table In);
+    void AddWorldOffsets(sol::table In);
+    void SetRotationsEuler(sol::table In);
+    void SetScales(sol::table In);
+
+    // 모든 액터에 같은 이동량 적용
+    void AddUniformWorldOffset(float X, float Y, float Z);
+
+private:
+    TArray<TWeakPtr<AActor>> Actors;
+};
+
+// Vec 라이브러리, FActorBatch usertype 등록 (AActor usertype 등록 이후 호출)
+void RegisterScriptMathLibrary(sol::state& Lua);
+
+// userdata 기반 / 숫자 기반 / 일괄 API의 시간과 GC 할당량을 InOperationCount회 기준으로 비교해 UE_LOG로 출력
+void RunScriptMathBenchmark(sol::state& Lua, uint32 InOperationCount);
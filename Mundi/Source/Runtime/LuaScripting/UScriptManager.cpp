@@ -6,10 +6,13 @@
 #include "Source/Runtime/Core/Object/Actor.h"
 #include "Source/Runtime/Engine/Components/SceneComponent.h"
 #include "Source/Runtime/LuaScripting/ScriptGlobalFunction.h"
+#include "Source/Runtime/LuaScripting/ScriptMathLibrary.h"
 #include "Source/Runtime/Engine/GameFramework/Pawn.h"
 #include "Source/Runtime/Engine/GameFramework/Character.h"
 #include "Source/Runtime/Engine/GameFramework/GameModeBase.h"
 #include "Source/Runtime/Engine/GameFramework/GameStateBase.h"
+#include "PlatformTime.h"
+#include "FileChangeService.h"
 
 IMPLEMENT_CLASS(UScriptManager)
 
@@ -25,18 +28,15 @@ UScriptManager::~UScriptManager()
 
 void UScriptManager::AttachScriptTo(FLuaLocalValue LuaLocalValue, const FString& ScriptName)
 {
-    // 이미 같은 스크립트가 부착되어 있으면 return
-    for (const TPair<AActor* const, TArray<FScript*>>& Script : ScriptsByOwner)
+    // 이미 같은 스크립트가 부착되어 있으면 return (소유자 키로 바로 조회: 레벨 로드 시 액터 수만큼 전체 순회하지 않도록)
+    if (const TArray<FScript*>* OwnerScripts = ScriptsByOwner.Find(LuaLocalValue.MyActor))
     {
-        if (LuaLocalValue.MyActor == Script.first)
+        for (FScript* ScriptData : *OwnerScripts)
         {
-            for (FScript* ScriptData : Script.second)
+            if (ScriptData && ScriptData->ScriptName == ScriptName)
             {
-                if (ScriptData && ScriptData->ScriptName == ScriptName)
-                {
-                    UE_LOG("[Script Manager] Actor alreay have %s", ScriptName.c_str());
-                    return;
-                }
+                UE_LOG("[Script Manager] Actor alreay have %s", ScriptName.c_str());
+                return;
             }
         }
     }
@@ -44,8 +44,10 @@ void UScriptManager::AttachScriptTo(FLuaLocalValue LuaLocalValue, const FString&
     try
     {
         FScript* Script = GetOrCreate(ScriptName);
+        Script->LuaLocalValue = LuaLocalValue;
         RegisterLocalValueToLua(Script->Env, LuaLocalValue);
         ScriptsByOwner[LuaLocalValue.MyActor].push_back(Script);
+        bTickGroupsDirty = true;
         LinkOnOverlapWithShapeComponent(
             LuaLocalValue.MyActor,
             Script->LuaTemplateFunctions.OnOverlap
@@ -89,6 +91,7 @@ void UScriptManager::DetachScriptFrom(AActor* InActor, const FString& ScriptName
                     Script.second.erase(Iter);
 
                     delete Tmp;
+                    bTickGroupsDirty = true;
                     break;
                 }
             }
@@ -107,6 +110,7 @@ void UScriptManager::DetachAllScriptFrom(AActor* InActor)
                 FScript* Tmp = Script.second.back();
                 Script.second.RemoveAt(Script.second.size() - 1);
                 delete Tmp;
+                bTickGroupsDirty = true;
             }
         }
     }
@@ -117,69 +121,297 @@ TMap<AActor*, TArray<FScript*>>& UScriptManager::GetScriptsByOwner()
     return ScriptsByOwner;
 }
 
-TArray<FScript*> UScriptManager::GetScriptsOfActor(AActor* InActor)
+const TArray<FScript*>& UScriptManager::GetScriptsOfActor(AActor* InActor)
 {
+    static const TArray<FScript*> EmptyScripts;
+
     auto Found = ScriptsByOwner.find(InActor);
     // Cache에 Actor가 등록이 되어있지 않으면 빈 배열을 반환한다.
     if (Found == ScriptsByOwner.end())
-        return {};
+        return EmptyScripts;
 
     return Found->second;
 }
 
+void UScriptManager::RebuildTickGroups()
+{
+    // 틱 목록과 월드별 배치를 다시 모음 (프로파일은 ScriptTickStats에 유지)
+    // 핫 리로드는 같은 FScript의 Tick 함수만 바꾸므로 대상 비교로는 알 수 없어 배치를 버리고 다음 틱에서 새로 만든다.
+    for (TPair<const FString, FScriptTickGroup>& GroupPair : TickGroups)
+    {
+        GroupPair.second.Scripts.clear();
+        GroupPair.second.Batches.clear();
+    }
+
+    for (const TPair<AActor* const, TArray<FScript*>>& OwnerScripts : ScriptsByOwner)
+    {
+        for (FScript* Script : OwnerScripts.second)
+        {
+            // Tick이 없는 스크립트는 그룹에 넣지 않음 (매 프레임 호출 자체를 생략)
+            if (Script && Script->LuaTemplateFunctions.Tick.valid())
+            {
+                FScriptTickGroup& Group = TickGroups[Script->ScriptName];
+                Group.Scripts.Add(Script);
+                if (!Group.Stats)
+                {
+                    Group.Stats = &ScriptTickStats[Script->ScriptName];
+                }
+            }
+        }
+    }
+
+    for (auto It = TickGroups.begin(); It != TickGroups.end();)
+    {
+        if (It->second.Scripts.IsEmpty())
+        {
+            It = TickGroups.erase(It);
+        }
+        else
+        {
+            ++It;
+        }
+    }
+
+    bTickGroupsDirty = false;
+}
+
+void UScriptManager::TickScripts(UWorld* InWorld, float DeltaSeconds)
+{
+    if (!InWorld)
+        return;
+
+    if (bTickGroupsDirty)
+        RebuildTickGroups();
+
+    // 그룹 순회 중 Lua Tick이 스크립트를 부착/해제하면 다음 틱에서 다시 구성된다.
+    TArray<FScript*> Targets;
+    for (TPair<const FString, FScriptTickGroup>& GroupPair : TickGroups)
+    {
+        FScriptTickGroup& Group = GroupPair.second;
+
+        // 이번 틱 대상 수집 (기존 AActor::Tick의 틱 조건과 동일)
+        Targets.clear();
+        for (FScript* Script : Group.Scripts)
+        {
+            AActor* Owner = Script->LuaLocalValue.MyActor;
+            if (Owner && Owner->GetWorld() == InWorld && !Owner->IsPendingDestroy() && Owner->IsActorTickEnabled() &&
+                (Owner->CanTickInEditor() || InWorld->bPie))
+            {
+                Targets.Add(Script);
+            }
+        }
+
+        if (Targets.IsEmpty())
+        {
+            Group.Batches.Remove(InWorld);
+            continue;
+        }
+
+        // 대상이 바뀐 경우에만 Lua 배열을 다시 만듦
+        FScriptTickBatch& Batch = Group.Batches[InWorld];
+        if (Batch.Targets != Targets || !Batch.Ticks.valid())
+        {
+            Batch.Ticks = Lua.create_table(static_cast<int>(Targets.Num()), 0);
+            for (int32 i = 0; i < Targets.Num(); ++i)
+            {
+                Batch.Ticks[i + 1] = Targets[i]->LuaTemplateFunctions.Tick;
+            }
+            Batch.Targets = Targets;
+        }
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        sol::protected_function_result Result = TickDispatcher(Batch.Ticks, Targets.Num(), DeltaSeconds);
+        const uint64 ElapsedCycles = FPlatformTime::Cycles64() - StartCycles;
+
+        FScriptTickStats& Stats = *Group.Stats;
+        Stats.TotalCycles += ElapsedCycles;
+        Stats.TotalCalls += Targets.Num();
+        Stats.DispatchCount++;
+        Stats.LastDispatchMs = FPlatformTime::ToMilliseconds(ElapsedCycles);
+        Stats.LastCallCount = static_cast<uint32>(Targets.Num());
+
+        if (!Result.valid())
+        {
+            sol::error Err = Result;
+            Stats.ErrorCount++;
+            UE_LOG("[Script Manager] %s Tick dispatch failed : %s", GroupPair.first.c_str(), Err.what());
+            continue;
+        }
+
+        // 디스패처는 (에러 수, 첫 에러 메시지)를 반환
+        const int32 ErrorCount = Result.get<int32>(0);
+        if (ErrorCount > 0)
+        {
+            Stats.ErrorCount += ErrorCount;
+            const FString FirstError = Result.get<FString>(1);
+            UE_LOG("[Script Manager] %s Tick failed on %d actor(s) : %s", GroupPair.first.c_str(), ErrorCount, FirstError.c_str());
+        }
+    }
+}
+
+void UScriptManager::OnWorldDestroyed(UWorld* InWorld)
+{
+    for (TPair<const FString, FScriptTickGroup>& GroupPair : TickGroups)
+    {
+        GroupPair.second.Batches.Remove(InWorld);
+    }
+}
+
+void UScriptManager::DumpScriptProfile() const
+{
+    if (ScriptTickStats.empty())
+    {
+        UE_LOG("[Script Profile] No script has Tick.");
+        return;
+    }
+
+    // 누적 시간이 큰 순서로 출력 (지금은 인스턴스가 없는 스크립트도 누적치는 남음)
+    TArray<const TPair<const FString, FScriptTickStats>*> SortedStats;
+    for (const TPair<const FString, FScriptTickStats>& StatsPair : ScriptTickStats)
+    {
+        SortedStats.Add(&StatsPair);
+    }
+    std::sort(SortedStats.begin(), SortedStats.end(), [](const auto* A, const auto* B)
+    {
+        return A->second.TotalCycles > B->second.TotalCycles;
+    });
+
+    UE_LOG("[Script Profile] %-24s %9s %12s %12s %10s %10s %7s", "Script", "Instances", "Calls", "Total(ms)", "Avg(us)", "Last(ms)", "Errors");
+    for (const TPair<const FString, FScriptTickStats>* StatsPair : SortedStats)
+    {
+        const FScriptTickStats& Stats = StatsPair->second;
+        const FScriptTickGroup* Group = TickGroups.Find(StatsPair->first);
+        const double TotalMs = FPlatformTime::ToMilliseconds(Stats.TotalCycles);
+        const double AvgUs = Stats.TotalCalls > 0 ? TotalMs * 1000.0 / Stats.TotalCalls : 0.0;
+        UE_LOG("[Script Profile] %-24s %9d %12llu %12.3f %10.3f %10.3f %7u",
+            StatsPair->first.c_str(), Group ? Group->Scripts.Num() : 0, Stats.TotalCalls, TotalMs, AvgUs, Stats.LastDispatchMs, Stats.ErrorCount);
+    }
+}
+
+void UScriptManager::ResetScriptProfile()
+{
+    // 그룹이 항목 주소를 들고 있으므로 맵을 비우지 않고 값만 초기화
+    for (TPair<const FString, FScriptTickStats>& StatsPair : ScriptTickStats)
+    {
+        StatsPair.second = FScriptTickStats();
+    }
+}
+
+void UScriptManager::RunMathBenchmark(uint32 InOperationCount)
+{
+    RunScriptMathBenchmark(Lua, InOperationCount);
+}
+
+void UScriptManager::RunCoroutineBenchmark(uint32 InCoroutineCount)
+{
+    UCoroutineScheduler::RunBenchmark(Lua, InCoroutineCount);
+}
+
+void UScriptManager::SeedRandom(uint32 InSeed)
+{
+    sol::protected_function RandomSeed = Lua["math"]["randomseed"];
+    if (RandomSeed.valid())
+    {
+        RandomSeed(InSeed);
+    }
+}
+
 void UScriptManager::CheckAndHotReloadLuaScript()
 {
+    // 파일 감시는 FFileChangeService가 백그라운드에서 하고, 여기서는 바뀐 파일만 처리 (파일당 한 번)
+    if (PendingScriptReloads.empty())
+    {
+        return;
+    }
+
+    TSet<FString> ScriptNames;
+    ScriptNames.swap(PendingScriptReloads);
+    for (const FString& ScriptName : ScriptNames)
+    {
+        HotReloadScript(ScriptName);
+    }
+}
+
+void UScriptManager::HotReloadScript(const FString& ScriptName)
+{
+    fs::path Path(SCRIPT_FILE_PATH + ScriptName);
+    if (!fs::exists(Path))
+    {
+        return;
+    }
+
+    // 파일은 한 번만 읽고 컴파일, 인스턴스마다 새 environment에서 실행
+    sol::load_result ScriptLoad = Lua.load_file(Path.string());
+    if (!ScriptLoad.valid())
+    {
+        sol::error Err = ScriptLoad;
+        FString ErrorMessage =
+            FString("[Script Manager] Lua Script: ") +
+            ScriptName +
+            " hot reload failed : " + Err.what();
+        UE_LOG(ErrorMessage.c_str());
+        return;
+    }
+    sol::protected_function Chunk = ScriptLoad;
+
+    uint32 ReloadCount = 0;
     for (auto& ScriptPair : ScriptsByOwner)
     {
         for (FScript* Script : ScriptPair.second)
         {
-            // 파일이 존재하지 않을 경우
-            if (!fs::exists(Script->ScriptName))
+            if (!Script || Script->ScriptName != ScriptName)
             {
                 continue;
             }
 
-            auto CurrentWriteTime = std::filesystem::last_write_time(Script->ScriptName);
-            if (CurrentWriteTime > Script->LastModifiedTime)
+            // 기존 상태 백업
+            sol::environment OldEnv = Script->Env;
+            sol::table OldTable = Script->Table;
+            FLuaTemplateFunctions OldFuncs = Script->LuaTemplateFunctions;
+
+            try
             {
-                FString HotReloadMessage =
+                SetLuaScriptField(
+                    Chunk,
+                    Script->Env,
+                    Script->Table,
+                    Script->LuaTemplateFunctions
+                );
+                RegisterLocalValueToLua(Script->Env, Script->LuaLocalValue);
+                ++ReloadCount;
+            }
+            catch (std::exception& e)
+            {
+                FString ErrorMessage =
                     FString("[Script Manager] Lua Script: ") +
-                    Script->ScriptName +
-                    " hot reload.";
-                UE_LOG(HotReloadMessage.c_str());
-
-                // 기존 상태 백업
-                sol::environment OldEnv = Script->Env;
-                sol::table OldTable = Script->Table;
-                FLuaTemplateFunctions OldFuncs = Script->LuaTemplateFunctions;
+                    ScriptName +
+                    " hot reload failed and fall backed : " + e.what();
+                UE_LOG(ErrorMessage.c_str());
 
-                try
-                {
-                    fs::path Path(SCRIPT_FILE_PATH + Script->ScriptName);
-                    SetLuaScriptField(
-                        Path,
-                        Script->Env,
-                        Script->Table,
-                        Script->LuaTemplateFunctions
-                    );
-                    RegisterLocalValueToLua(Script->Env, Script->LuaLocalValue);
-                }
-                catch (std::exception& e)
-                {
-                    FString ErrorMessage =
-                        FString("[Script Manager] Lua Script: ") +
-                        Script->ScriptName +
-                        " hot reload failed and fall backed.";
-
-                    Script->Env = OldEnv;
-                    Script->Table = OldTable;
-                    Script->LuaTemplateFunctions = OldFuncs;
-                }
-
-                Script->LastModifiedTime = CurrentWriteTime;
+                Script->Env = OldEnv;
+                Script->Table = OldTable;
+                Script->LuaTemplateFunctions = OldFuncs;
             }
         }
     }
+
+    bTickGroupsDirty = true;
+    UE_LOG("[Script Manager] Lua Script: %s hot reload. (%u instances)", ScriptName.c_str(), ReloadCount);
+}
+
+void UScriptManager::WatchScriptFile(const FString& ScriptName)
+{
+    if (ScriptFileWatches.Contains(ScriptName))
+    {
+        return;
+    }
+
+    ScriptFileWatches[ScriptName] = FFileChangeService::GetInstance().Watch(
+        SCRIPT_FILE_PATH + ScriptName,
+        [this, ScriptName](const FString&)
+        {
+            PendingScriptReloads.insert(ScriptName);
+        });
 }
 
 
@@ -201,6 +433,25 @@ void UScriptManager::Initialize()
 
     RegisterUserTypeToLua();
     RegisterGlobalFuncToLua();
+
+    /*
+     * 그룹 Tick 디스패처: Ticks[1..Count]를 Lua 안에서 순회하며 pcall로 호출한다.
+     * C++ -> Lua 경계는 그룹당 한 번만 넘고, 한 액터의 에러는 나머지 호출에 영향을 주지 않는다.
+     */
+    TickDispatcher = Lua.load(R"(
+        local pcall = pcall
+        return function(Ticks, Count, Dt)
+            local ErrorCount, FirstError = 0, nil
+            for i = 1, Count do
+                local Ok, Err = pcall(Ticks[i], Dt)
+                if not Ok then
+                    ErrorCount = ErrorCount + 1
+                    FirstError = FirstError or tostring(Err)
+                end
+            end
+            return ErrorCount, FirstError or ""
+        end
+    )", "=ScriptTickDispatcher")().get<sol::protected_function>();
 }
 
 void UScriptManager::Shutdown()
@@ -268,7 +519,25 @@ void UScriptManager::RegisterUserTypeToLua()
         "AddWorldRotation", sol::overload(
             static_cast<void(AActor::*)(const FQuat&)>(&AActor::AddActorWorldRotation)
         ),
-        "GetName", &AActor::GetName
+        "GetName", &AActor::GetName,
+
+        // 숫자 기반 트랜스폼 (FVector userdata를 만들지 않음, ScriptMathLibrary.h 참고)
+        "GetLocationXYZ", [](AActor* Actor) {
+            const FVector L = Actor->GetActorLocation();
+            return std::make_tuple(L.X, L.Y, L.Z);
+        },
+        "SetLocationXYZ", [](AActor* Actor, float X, float Y, float Z) { Actor->SetActorLocation(FVector(X, Y, Z)); },
+        "AddWorldLocationXYZ", [](AActor* Actor, float X, float Y, float Z) { Actor->AddActorWorldLocation(FVector(X, Y, Z)); },
+        "GetRotationEuler", [](AActor* Actor) {
+            const FVector E = Actor->GetActorRotation().ToEulerZYXDeg();
+            return std::make_tuple(E.X, E.Y, E.Z);
+        },
+        "SetRotationEuler", [](AActor* Actor, float Pitch, float Yaw, float Roll) { Actor->SetActorRotation(FVector(Pitch, Yaw, Roll)); },
+        "GetScaleXYZ", [](AActor* Actor) {
+            const FVector S = Actor->GetActorScale();
+            return std::make_tuple(S.X, S.Y, S.Z);
+        },
+        "SetScaleXYZ", [](AActor* Actor, float X, float Y, float Z) { Actor->SetActorScale(FVector(X, Y, Z)); }
     );
 
     // APawn 클래스 등록 (AActor 상속)
@@ -308,6 +577,7 @@ void UScriptManager::RegisterUserTypeToLua()
 void UScriptManager::RegisterGlobalFuncToLua()
 {
     Lua["PrintToConsole"] = PrintToConsole;
+    RegisterScriptMathLibrary(Lua);
 	CoroutineScheduler.RegisterCoroutineTo(Lua);
 }
 
@@ -355,7 +625,7 @@ void UScriptManager::LinkOnOverlapWithShapeComponent(AActor* MyActor, sol::funct
 }
 
 // Lua로부터 Template 함수를 가져온다.
-// 해당 함수가 없으면 Throw한다.
+// 해당 함수가 없으면 Throw한다. (Tick은 선택: 없으면 Tick 그룹에서 제외)
 FLuaTemplateFunctions UScriptManager::GetTemplateFunctionFromScript(
     sol::environment& InEnv
     )
@@ -375,7 +645,7 @@ FLuaTemplateFunctions UScriptManager::GetTemplateFunctionFromScript(
     AssignFunction(LuaTemplateFunctions.BeginPlay, "BeginPlay");
     AssignFunction(LuaTemplateFunctions.EndPlay, "EndPlay");
     AssignFunction(LuaTemplateFunctions.OnOverlap, "OnOverlap");
-    AssignFunction(LuaTemplateFunctions.Tick, "Tick");
+    LuaTemplateFunctions.Tick = InEnv["Tick"];
 
     return LuaTemplateFunctions;
 }
@@ -387,17 +657,29 @@ void UScriptManager::SetLuaScriptField(
     FLuaTemplateFunctions& InLuaTemplateFunction
 )
 {
-    // 새 environment 생성 (globals 기반)
-    InEnv = sol::environment (Lua, sol::create, Lua.globals());
-
-    // 스크립트 실행
+    // 스크립트 로드
     sol::load_result scriptLoad = Lua.load_file(Path.string());
     if (!scriptLoad.valid()) {
         sol::error Err = scriptLoad;
         throw Err;
     }
 
-    sol::protected_function_result result = scriptLoad(InEnv);
+    sol::protected_function Chunk = scriptLoad;
+    SetLuaScriptField(Chunk, InEnv, InScriptTable, InLuaTemplateFunction);
+}
+
+void UScriptManager::SetLuaScriptField(
+    sol::protected_function& InChunk,
+    sol::environment& InEnv,
+    sol::table& InScriptTable,
+    FLuaTemplateFunctions& InLuaTemplateFunction
+)
+{
+    // 새 environment 생성 (globals 기반)
+    InEnv = sol::environment (Lua, sol::create, Lua.globals());
+
+    // 스크립트 실행 (스크립트 첫 줄의 local _ENV = ... 로 environment 전달)
+    sol::protected_function_result result = InChunk(InEnv);
     if (!result.valid()) {
         sol::error Err = result;
         throw Err;
@@ -441,11 +723,8 @@ FScript* UScriptManager::GetOrCreate(FString InScriptName)
     NewScript->Table = Table;
     NewScript->LuaTemplateFunctions = LuaTemplateFunctions;
 
-    // Hot reload를 위해 초기 수정 시간 설정
-    if (fs::exists(Path))
-    {
-        NewScript->LastModifiedTime = fs::last_write_time(Path);
-    }
+    // Hot reload: 같은 파일은 한 번만 감시
+    WatchScriptFile(ScriptName);
 
     return NewScript;
 }
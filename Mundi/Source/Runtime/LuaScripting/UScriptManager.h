@@ -31,7 +31,32 @@ struct FScript
 
     // hot reload support
     FLuaLocalValue LuaLocalValue;
-    fs::file_time_type LastModifiedTime;
+};
+
+// 한 월드에서 같은 스크립트 파일을 쓰는 인스턴스들의 Tick 배치
+struct FScriptTickBatch
+{
+    TArray<FScript*> Targets;   // 이번 틱 대상 (Ticks와 같은 순서)
+    sol::table Ticks;           // Lua 배열 { Tick1, Tick2, ... } - 대상이 바뀔 때만 다시 만듦
+};
+
+// 스크립트 파일 단위 Tick 프로파일링 정보 (그룹 재구성과 무관하게 누적)
+struct FScriptTickStats
+{
+    uint64 TotalCycles = 0;
+    uint64 TotalCalls = 0;
+    uint64 DispatchCount = 0;
+    double LastDispatchMs = 0.0;
+    uint32 LastCallCount = 0;
+    uint32 ErrorCount = 0;
+};
+
+// 스크립트 파일 단위 Tick 그룹
+struct FScriptTickGroup
+{
+    TArray<FScript*> Scripts;                   // Tick이 있는 인스턴스 전체 (부착 순서)
+    TMap<class UWorld*, FScriptTickBatch> Batches;    // 에디터/PIE 월드가 같은 프레임에 각각 틱되므로 월드별로 보관
+    FScriptTickStats* Stats = nullptr;          // ScriptTickStats의 항목 (TMap 노드라 주소가 유지됨)
 };
 
 class UScriptManager : public UObject
@@ -54,9 +79,33 @@ public:
     void PrintDebugLog();
 
     TMap<AActor*, TArray<FScript*>>& GetScriptsByOwner();
-    TArray<FScript*> GetScriptsOfActor(AActor* InActor);
+    const TArray<FScript*>& GetScriptsOfActor(AActor* InActor);
+
+    /*
+     * InWorld에서 틱해야 하는 액터들의 Lua Tick을 스크립트 파일별로 묶어 호출한다.
+     * 그룹마다 C++ -> Lua 호출은 한 번이며, 각 Tick은 Lua 안의 루프에서 pcall로 호출된다.
+     * (한 스크립트의 에러가 같은 그룹의 다른 액터 Tick을 막지 않음)
+     * UWorld::Tick에서 액터 Tick 전에 호출되므로 "Lua 먼저, 컴포넌트 나중" 순서가 유지된다.
+     */
+    void TickScripts(class UWorld* InWorld, float DeltaSeconds);
+
+    // 파괴되는 월드(PIE 종료 등)의 Tick 배치를 제거 (UWorld 소멸자에서 호출)
+    void OnWorldDestroyed(class UWorld* InWorld);
+
+    // 스크립트 파일별 누적 Tick 시간/호출 수 출력 및 초기화
+    void DumpScriptProfile() const;
+    void ResetScriptProfile();
+
+    // Lua 수학/트랜스폼 바인딩 벤치마크 (ScriptMathLibrary.h)
+    void RunMathBenchmark(uint32 InOperationCount);
+
+    // 코루틴 스케줄러 벤치마크 (별도 스케줄러 인스턴스에서 실행)
+    void RunCoroutineBenchmark(uint32 InCoroutineCount);
+
+    // math.randomseed (입력 녹화/재생 시 PIE 시작마다 같은 시드)
+    void SeedRandom(uint32 InSeed);
     
-    // 매 Frame마다 호출되는 함수
+    // 매 Frame마다 호출되는 함수 (FFileChangeService가 알려준 변경 파일만 다시 로드)
     void CheckAndHotReloadLuaScript();
     void UpdateCoroutineState(double Dt)
     {
@@ -90,8 +139,25 @@ private:
         sol::table& InScriptTable,
         FLuaTemplateFunctions& InLuaTemplateFunction
     );
+
+    // 이미 컴파일된 청크를 새 environment에서 실행 (핫 리로드 시 파일당 한 번만 컴파일)
+    void SetLuaScriptField(
+        sol::protected_function& InChunk,
+        sol::environment& InEnv,
+        sol::table& InScriptTable,
+        FLuaTemplateFunctions& InLuaTemplateFunction
+    );
     
     FScript* GetOrCreate(FString InScriptName);
+
+    // ScriptName을 쓰는 모든 인스턴스를 다시 로드
+    void HotReloadScript(const FString& ScriptName);
+
+    // 스크립트 파일 변경 감시 등록 (파일당 한 번)
+    void WatchScriptFile(const FString& ScriptName);
+
+    // ScriptsByOwner로부터 Tick 그룹을 다시 구성 (부착/해제/핫 리로드 후 다음 틱에서 한 번)
+    void RebuildTickGroups();
 private:
     const static inline FString SCRIPT_FILE_PATH{"Scripts/"};
     const static inline FString DEFAULT_FILE_PATH{"Scripts/template.lua"};
@@ -101,5 +167,19 @@ private:
     // 소유자 기반 접근
     TMap<AActor*, TArray<FScript*>> ScriptsByOwner;
 
+    // 스크립트 파일 이름 기반 Tick 그룹
+    TMap<FString, FScriptTickGroup> TickGroups;
+    bool bTickGroupsDirty = true;
+
+    // 스크립트 파일 이름 -> 누적 프로파일 (부착/해제/핫 리로드로 그룹을 다시 만들어도 유지, ResetScriptProfile로만 초기화)
+    TMap<FString, FScriptTickStats> ScriptTickStats;
+
+    // 스크립트 파일 이름 -> 감시 핸들, 변경되어 다시 로드할 스크립트 파일 이름
+    TMap<FString, uint32> ScriptFileWatches;
+    TSet<FString> PendingScriptReloads;
+
+    // Lua 배열의 Tick들을 순회 호출하는 디스패처 (Initialize에서 한 번 컴파일)
+    sol::protected_function TickDispatcher;
+
     UCoroutineScheduler CoroutineScheduler;
 };
\ No newline at end of file
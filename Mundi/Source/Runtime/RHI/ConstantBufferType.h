@@ -7,6 +7,8 @@ struct ModelBufferType // b0
 {
     FMatrix Model;
     FMatrix ModelInverseTranspose;  // For correct normal transformation with non-uniform scale
+    FVector4 PositionDequantScale = FVector4(1.0f, 1.0f, 1.0f, 0.0f);  // 패킹 정점(PACKED_POSITION_QUANTIZED) 위치 = unorm * Scale + Bias
+    FVector4 PositionDequantBias = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
 };
 
 struct ViewProjBufferType // b1 고유번호 고정
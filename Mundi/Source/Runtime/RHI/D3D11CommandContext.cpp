@@ -0,0 +1,149 @@
+﻿#include "pch.h"
+#include "D3D11CommandContext.h"
+
+FD3D11CommandContext::FD3D11CommandContext(ID3D11DeviceContext* InDeviceContext)
+	: DeviceContext(InDeviceContext)
+{
+	if (DeviceContext)
+	{
+		DeviceContext->QueryInterface(__uuidof(ID3D11DeviceContext1), reinterpret_cast<void**>(&DeviceContext1));
+	}
+}
+
+FD3D11CommandContext::~FD3D11CommandContext()
+{
+	if (DeviceContext1)
+	{
+		DeviceContext1->Release();
+		DeviceContext1 = nullptr;
+	}
+}
+
+void FD3D11CommandContext::ExecuteSetInputLayout(ID3D11InputLayout* InInputLayout)
+{
+	DeviceContext->IASetInputLayout(InInputLayout);
+}
+
+void FD3D11CommandContext::ExecuteSetVertexShader(ID3D11VertexShader* InShader)
+{
+	DeviceContext->VSSetShader(InShader, nullptr, 0);
+}
+
+void FD3D11CommandContext::ExecuteSetPixelShader(ID3D11PixelShader* InShader)
+{
+	DeviceContext->PSSetShader(InShader, nullptr, 0);
+}
+
+void FD3D11CommandContext::ExecuteSetVertexBuffer(ID3D11Buffer* InBuffer, uint32 InStride, uint32 InOffset)
+{
+	UINT Stride = InStride;
+	UINT Offset = InOffset;
+	DeviceContext->IASetVertexBuffers(0, InBuffer ? 1 : 0, InBuffer ? &InBuffer : nullptr, InBuffer ? &Stride : nullptr, InBuffer ? &Offset : nullptr);
+}
+
+void FD3D11CommandContext::ExecuteSetIndexBuffer(ID3D11Buffer* InBuffer, DXGI_FORMAT InFormat, uint32 InOffset)
+{
+	DeviceContext->IASetIndexBuffer(InBuffer, InFormat, InOffset);
+}
+
+void FD3D11CommandContext::ExecuteSetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology)
+{
+	DeviceContext->IASetPrimitiveTopology(InTopology);
+}
+
+void FD3D11CommandContext::ExecuteSetPSShaderResources(uint32 InStartSlot, uint32 InCount, ID3D11ShaderResourceView* const* InViews)
+{
+	DeviceContext->PSSetShaderResources(InStartSlot, InCount, InViews);
+}
+
+void FD3D11CommandContext::ExecuteSetVSShaderResources(uint32 InStartSlot, uint32 InCount, ID3D11ShaderResourceView* const* InViews)
+{
+	DeviceContext->VSSetShaderResources(InStartSlot, InCount, InViews);
+}
+
+void FD3D11CommandContext::ExecuteSetPSSamplers(uint32 InStartSlot, uint32 InCount, ID3D11SamplerState* const* InSamplers)
+{
+	DeviceContext->PSSetSamplers(InStartSlot, InCount, InSamplers);
+}
+
+void FD3D11CommandContext::ExecuteUpdateConstantBuffer(ID3D11Buffer* InBuffer, const void* InData, uint32 InSize)
+{
+	D3D11_MAPPED_SUBRESOURCE MSR;
+	if (SUCCEEDED(DeviceContext->Map(InBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MSR)))
+	{
+		memcpy(MSR.pData, InData, InSize);
+		DeviceContext->Unmap(InBuffer, 0);
+	}
+}
+
+void FD3D11CommandContext::ExecuteSetConstantBuffer(ID3D11Buffer* InBuffer, uint32 InSlot, bool bInVS, bool bInPS)
+{
+	if (bInVS)
+	{
+		DeviceContext->VSSetConstantBuffers(InSlot, 1, &InBuffer);
+	}
+	if (bInPS)
+	{
+		DeviceContext->PSSetConstantBuffers(InSlot, 1, &InBuffer);
+	}
+}
+
+uint8* FD3D11CommandContext::ExecuteMapUploadBuffer(ID3D11Buffer* InBuffer, uint32 InOffset, uint32 InSize, bool bInDiscard)
+{
+	D3D11_MAPPED_SUBRESOURCE MSR;
+	if (FAILED(DeviceContext->Map(InBuffer, 0, bInDiscard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE, 0, &MSR)))
+	{
+		return nullptr;
+	}
+	return static_cast<uint8*>(MSR.pData) + InOffset;
+}
+
+void FD3D11CommandContext::ExecuteUnmapUploadBuffer(ID3D11Buffer* InBuffer)
+{
+	DeviceContext->Unmap(InBuffer, 0);
+}
+
+void FD3D11CommandContext::ExecuteSetConstantBufferRange(ID3D11Buffer* InBuffer, uint32 InSlot, uint32 InOffset, uint32 InSize, bool bInVS, bool bInPS)
+{
+	// 단위는 16바이트 상수, 개수는 16의 배수여야 함
+	UINT FirstConstant = InOffset / 16;
+	UINT NumConstants = ((InSize + 255) & ~255u) / 16;
+	if (bInVS)
+	{
+		DeviceContext1->VSSetConstantBuffers1(InSlot, 1, &InBuffer, &FirstConstant, &NumConstants);
+	}
+	if (bInPS)
+	{
+		DeviceContext1->PSSetConstantBuffers1(InSlot, 1, &InBuffer, &FirstConstant, &NumConstants);
+	}
+}
+
+void FD3D11CommandContext::ExecuteSetRasterizerState(ID3D11RasterizerState* InState)
+{
+	DeviceContext->RSSetState(InState);
+}
+
+void FD3D11CommandContext::ExecuteSetBlendState(ID3D11BlendState* InState, const float InBlendFactor[4], uint32 InSampleMask)
+{
+	DeviceContext->OMSetBlendState(InState, InBlendFactor, InSampleMask);
+}
+
+void FD3D11CommandContext::ExecuteSetDepthStencilState(ID3D11DepthStencilState* InState, uint32 InStencilRef)
+{
+	DeviceContext->OMSetDepthStencilState(InState, InStencilRef);
+}
+
+void FD3D11CommandContext::ExecuteSetRenderTargets(uint32 InCount, ID3D11RenderTargetView* const* InRTVs, ID3D11DepthStencilView* InDSV)
+{
+	DeviceContext->OMSetRenderTargets(InCount, InRTVs, InDSV);
+}
+
+void FD3D11CommandContext::ExecuteDraw(uint32 InVertexCount, uint32 InStartVertex)
+{
+	DeviceContext->Draw(InVertexCount, InStartVertex);
+}
+
+void FD3D11CommandContext::ExecuteDrawIndexed(uint32 InIndexCount, uint32 InStartIndex, int32 InBaseVertex)
+{
+	DeviceContext->DrawIndexed(InIndexCount, InStartIndex, InBaseVertex);
+}
@@ -0,0 +1,40 @@
+﻿#pragma once
+#include "RHICommandContext.h"
+#include <d3d11_1.h>
+
+// IRHICommandContext의 D3D11 구현 (ID3D11DeviceContext 즉시 호출)
+class FD3D11CommandContext : public IRHICommandContext
+{
+public:
+	explicit FD3D11CommandContext(ID3D11DeviceContext* InDeviceContext);
+	~FD3D11CommandContext() override;
+
+	// D3D11.1 런타임이면 오프셋 바인딩(*SetConstantBuffers1)을 쓸 수 있음
+	bool SupportsConstantBufferRanges() const { return DeviceContext1 != nullptr; }
+
+protected:
+	void ExecuteSetInputLayout(ID3D11InputLayout* InInputLayout) override;
+	void ExecuteSetVertexShader(ID3D11VertexShader* InShader) override;
+	void ExecuteSetPixelShader(ID3D11PixelShader* InShader) override;
+	void ExecuteSetVertexBuffer(ID3D11Buffer* InBuffer, uint32 InStride, uint32 InOffset) override;
+	void ExecuteSetIndexBuffer(ID3D11Buffer* InBuffer, DXGI_FORMAT InFormat, uint32 InOffset) override;
+	void ExecuteSetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology) override;
+	void ExecuteSetPSShaderResources(uint32 InStartSlot, uint32 InCount, ID3D11ShaderResourceView* const* InViews) override;
+	void ExecuteSetVSShaderResources(uint32 InStartSlot, uint32 InCount, ID3D11ShaderResourceView* const* InViews) override;
+	void ExecuteSetPSSamplers(uint32 InStartSlot, uint32 InCount, ID3D11SamplerState* const* InSamplers) override;
+	void ExecuteUpdateConstantBuffer(ID3D11Buffer* InBuffer, const void* InData, uint32 InSize) override;
+	void ExecuteSetConstantBuffer(ID3D11Buffer* InBuffer, uint32 InSlot, bool bInVS, bool bInPS) override;
+	uint8* ExecuteMapUploadBuffer(ID3D11Buffer* InBuffer, uint32 InOffset, uint32 InSize, bool bInDiscard) override;
+	void ExecuteUnmapUploadBuffer(ID3D11Buffer* InBuffer) override;
+	void ExecuteSetConstantBufferRange(ID3D11Buffer* InBuffer, uint32 InSlot, uint32 InOffset, uint32 InSize, bool bInVS, bool bInPS) override;
+	void ExecuteSetRasterizerState(ID3D11RasterizerState* InState) override;
+	void ExecuteSetBlendState(ID3D11BlendState* InState, const float InBlendFactor[4], uint32 InSampleMask) override;
+	void ExecuteSetDepthStencilState(ID3D11DepthStencilState* InState, uint32 InStencilRef) override;
+	void ExecuteSetRenderTargets(uint32 InCount, ID3D11RenderTargetView* const* InRTVs, ID3D11DepthStencilView* InDSV) override;
+	void ExecuteDraw(uint32 InVertexCount, uint32 InStartVertex) override;
+	void ExecuteDrawIndexed(uint32 InIndexCount, uint32 InStartIndex, int32 InBaseVertex) override;
+
+private:
+	ID3D11DeviceContext* DeviceContext = nullptr;
+	ID3D11DeviceContext1* DeviceContext1 = nullptr;
+};
@@ -1,17 +1,20 @@
 ﻿#include "pch.h"
 #include "StatsOverlayD2D.h"
 #include "Color.h"
+#include "D3D11CommandContext.h"
 
 void D3D11RHI::Initialize(HWND hWindow)
 {
     // 이곳에서 Device, DeviceContext, viewport, swapchain를 초기화한다
     CreateDeviceAndSwapChain(hWindow);
+    D3D11CommandContext = std::make_unique<FD3D11CommandContext>(DeviceContext);
+    CommandContext = D3D11CommandContext.get();
     CreateFrameBuffer();
-    CreateIdBuffer();
     CreateRasterizerState();
     CreateBlendState();
     
     CONSTANT_BUFFER_LIST(CREATE_CONSTANT_BUFFER);
+    CreateUploadRing();
 
 	CreateDepthStencilState();
 	CreateSamplerState();
@@ -21,12 +24,28 @@ void D3D11RHI::Initialize(HWND hWindow)
     UStatsOverlayD2D::Get().Initialize(Device, DeviceContext, SwapChain);
 }
 
+void D3D11RHI::InitializeNull(IRHICommandContext* InContext)
+{
+    CommandContext = InContext;
+
+    // 링 오프셋 계산과 바인딩 명령까지 기록 백엔드로 보냄 (모든 프레임을 GPU가 끝낸 것으로 취급)
+    UploadAllocator.Initialize(UploadRingSize);
+    bUploadRingEnabled = true;
+}
+
 void D3D11RHI::Release()
 {
     // Prevent double Release() calls
     if (bReleased) return;
     bReleased = true;
 
+    // null 모드: 만든 리소스가 없음
+    if (!Device)
+    {
+        CommandContext = nullptr;
+        return;
+    }
+
     // Direct2D 오버레이를 먼저 정리하여 D3D 리소스에 대한 참조를 제거
     UStatsOverlayD2D::Get().Shutdown();
 
@@ -56,6 +75,7 @@ void D3D11RHI::Release()
 
     // 상수버퍼
     CONSTANT_BUFFER_LIST(RELEASE_CONSTANT_BUFFER);
+    ReleaseUploadRing();
 
     // 상태 객체
     if (DepthStencilState) { DepthStencilState->Release(); DepthStencilState = nullptr; }
@@ -77,9 +97,10 @@ void D3D11RHI::Release()
     ReleaseBlendState();
     // RTV/DSV/FrameBuffer
     ReleaseFrameBuffer();
-    ReleaseIdBuffer();
 
     // Device + SwapChain
+    CommandContext = nullptr;
+    D3D11CommandContext.reset();
     ReleaseDeviceAndSwapChain();
 }
 
@@ -89,7 +110,6 @@ void D3D11RHI::ClearAllBuffer()
     float ClearId[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
     DeviceContext->ClearRenderTargetView(BackBufferRTV, ClearColor);
     DeviceContext->ClearRenderTargetView(GetCurrentTargetRTV(), ClearId);
-    DeviceContext->ClearRenderTargetView(IdBufferRTV, ClearId);
     
     ClearDepthBuffer(1.0f, 0);                 // 깊이값 초기화
 }
@@ -305,6 +325,23 @@ HRESULT D3D11RHI::CreateIndexBuffer(ID3D11Device* device, const FMeshData* meshD
     return device->CreateBuffer(&ibd, &iinitData, outBuffer);
 }
 
+HRESULT D3D11RHI::CreateVertexBufferFromBytes(ID3D11Device* device, const void* vertexData, uint32 byteWidth, ID3D11Buffer** outBuffer)
+{
+    if (!vertexData || byteWidth == 0)
+        return E_FAIL;
+
+    D3D11_BUFFER_DESC vbd = {};
+    vbd.Usage = D3D11_USAGE_DEFAULT;
+    vbd.ByteWidth = byteWidth;
+    vbd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    vbd.CPUAccessFlags = 0;
+
+    D3D11_SUBRESOURCE_DATA vinitData = {};
+    vinitData.pSysMem = vertexData;
+
+    return device->CreateBuffer(&vbd, &vinitData, outBuffer);
+}
+
 HRESULT D3D11RHI::CreateIndexBuffer(ID3D11Device* device, const FStaticMesh* mesh, ID3D11Buffer** outBuffer)
 {
     if (!mesh || mesh->Indices.empty())
@@ -324,20 +361,13 @@ HRESULT D3D11RHI::CreateIndexBuffer(ID3D11Device* device, const FStaticMesh* mes
 
 void D3D11RHI::ConstantBufferSet(ID3D11Buffer* ConstantBuffer, uint32 Slot, bool bIsVS, bool bIsPS)
 {
-    if (bIsVS)
-    {
-        DeviceContext->VSSetConstantBuffers(Slot, 1, &ConstantBuffer);
-    }
-    if (bIsPS)
-    {
-        DeviceContext->PSSetConstantBuffers(Slot, 1, &ConstantBuffer);
-    }
+    CommandContext->SetConstantBuffer(ConstantBuffer, Slot, bIsVS, bIsPS);
 }
 
 
 void D3D11RHI::IASetPrimitiveTopology()
 {
-    DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    CommandContext->SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 }
 
 void D3D11RHI::RSSetState(ERasterizerMode ViewModeIndex)
@@ -345,27 +375,27 @@ void D3D11RHI::RSSetState(ERasterizerMode ViewModeIndex)
 	switch (ViewModeIndex)
 	{
 	case ERasterizerMode::Solid:
-		DeviceContext->RSSetState(DefaultRasterizerState);
+		CommandContext->SetRasterizerState(DefaultRasterizerState);
         break;
 
 	case ERasterizerMode::Wireframe:
-		DeviceContext->RSSetState(WireFrameRasterizerState);
+		CommandContext->SetRasterizerState(WireFrameRasterizerState);
         break;
 
 	case ERasterizerMode::Solid_NoCull:
-		DeviceContext->RSSetState(NoCullRasterizerState);
+		CommandContext->SetRasterizerState(NoCullRasterizerState);
         break;
 
 	case ERasterizerMode::Decal:
-		DeviceContext->RSSetState(DecalRasterizerState);
+		CommandContext->SetRasterizerState(DecalRasterizerState);
         break;
 
 	case ERasterizerMode::Shadow:
-		DeviceContext->RSSetState(ShadowRasterizerState);
+		CommandContext->SetRasterizerState(ShadowRasterizerState);
         break;
 
 	default:
-		DeviceContext->RSSetState(DefaultRasterizerState);
+		CommandContext->SetRasterizerState(DefaultRasterizerState);
         break;
 	}
 }
@@ -420,33 +450,21 @@ void D3D11RHI::OMSetRenderTargets(ERTVMode RTVMode)
     switch (RTVMode)
     {
     case ERTVMode::BackBufferWithDepth:
-        DeviceContext->OMSetRenderTargets(1, &BackBufferRTV, DepthStencilView);
+        CommandContext->SetRenderTargets(1, &BackBufferRTV, DepthStencilView);
         break;
     case ERTVMode::BackBufferWithoutDepth:
-        DeviceContext->OMSetRenderTargets(1, &BackBufferRTV, nullptr);
+        CommandContext->SetRenderTargets(1, &BackBufferRTV, nullptr);
         break;
     case ERTVMode::SceneColorTarget:
     {
         ID3D11RenderTargetView* CurrentTargetRTV = GetCurrentTargetRTV();
-        DeviceContext->OMSetRenderTargets(1, &CurrentTargetRTV, DepthStencilView);
-        break;
-    }
-    case ERTVMode::SceneIdTarget:
-    {
-        ID3D11RenderTargetView* RTVList[2]{ nullptr, IdBufferRTV };
-        DeviceContext->OMSetRenderTargets(2, RTVList, DepthStencilView);
-        break;
-    }
-    case ERTVMode::SceneColorTargetWithId:
-    {
-        ID3D11RenderTargetView* RTVList[2]{ GetCurrentTargetRTV(), IdBufferRTV };
-        DeviceContext->OMSetRenderTargets(2, RTVList, DepthStencilView);
+        CommandContext->SetRenderTargets(1, &CurrentTargetRTV, DepthStencilView);
         break;
     }
     case ERTVMode::SceneColorTargetWithoutDepth:
     {
         ID3D11RenderTargetView* CurrentTargetRTV = GetCurrentTargetRTV();
-        DeviceContext->OMSetRenderTargets(1, &CurrentTargetRTV, nullptr);
+        CommandContext->SetRenderTargets(1, &CurrentTargetRTV, nullptr);
         break;
     }
     default:
@@ -459,11 +477,11 @@ void D3D11RHI::OMSetBlendState(bool bIsBlendMode)
     if (bIsBlendMode == true)
     {
         float blendFactor[4] = { 0, 0, 0, 0 };
-        DeviceContext->OMSetBlendState(BlendStateTransparent, blendFactor, 0xffffffff);
+        CommandContext->SetBlendState(BlendStateTransparent, blendFactor, 0xffffffff);
     }
     else
     {
-        DeviceContext->OMSetBlendState(BlendStateOpaque, nullptr, 0xffffffff);
+        CommandContext->SetBlendState(BlendStateOpaque, nullptr, 0xffffffff);
     }
 }
 
@@ -472,13 +490,13 @@ void D3D11RHI::DrawFullScreenQuad()
 {
     // 1. 입력 버퍼를 사용하지 않겠다고 명시적으로 설정합니다.
     //    Input Assembler (IA) 단계가 사실상 생략됩니다.
-    DeviceContext->IASetVertexBuffers(0, 0, nullptr, nullptr, nullptr);
-    DeviceContext->IASetIndexBuffer(nullptr, DXGI_FORMAT_UNKNOWN, 0);
-    DeviceContext->IASetInputLayout(nullptr); // Input Layout도 필요 없습니다.
-    DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    CommandContext->SetVertexBuffer(nullptr, 0, 0);
+    CommandContext->SetIndexBuffer(nullptr, DXGI_FORMAT_UNKNOWN, 0);
+    CommandContext->SetInputLayout(nullptr); // Input Layout도 필요 없습니다.
+    CommandContext->SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
     // 2. 정점 셰이더를 6번 실행하여 큰 삼각형 2개를 그리도록 명령합니다.
-    DeviceContext->Draw(6, 0);
+    CommandContext->Draw(6, 0);
 }
 
 void D3D11RHI::Present()
@@ -594,47 +612,6 @@ void D3D11RHI::CreateFrameBuffer()
     Device->CreateShaderResourceView(DepthBuffer, &srvDesc, &DepthSRV);
 }
 
-void D3D11RHI::CreateIdBuffer()
-{
-
-    DXGI_SWAP_CHAIN_DESC SwapDesc;
-    SwapChain->GetDesc(&SwapDesc);
-
-    D3D11_TEXTURE2D_DESC TextureDesc{};
-    TextureDesc.Format = DXGI_FORMAT_R32_UINT;
-    TextureDesc.CPUAccessFlags = 0;
-    TextureDesc.Usage = D3D11_USAGE_DEFAULT;
-    TextureDesc.Width = SwapDesc.BufferDesc.Width;
-    TextureDesc.Height = SwapDesc.BufferDesc.Height;
-    TextureDesc.MipLevels = 1;
-    TextureDesc.ArraySize = 1;
-    TextureDesc.SampleDesc.Count = 1;
-    TextureDesc.SampleDesc.Quality = 0;
-    TextureDesc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
-
-    Device->CreateTexture2D(&TextureDesc, nullptr, &IdBuffer);
-
-    D3D11_RENDER_TARGET_VIEW_DESC Desc{};
-    Desc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2D;
-    Desc.Format = DXGI_FORMAT_R32_UINT;
-    Device->CreateRenderTargetView(IdBuffer, &Desc, &IdBufferRTV);
-
-    TextureDesc = {};
-
-    TextureDesc.Format = DXGI_FORMAT_R32_UINT;
-    TextureDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
-    TextureDesc.Usage = D3D11_USAGE_STAGING;
-    TextureDesc.Width = 1;
-    TextureDesc.Height = 1;
-    TextureDesc.MipLevels = 1;
-    TextureDesc.ArraySize = 1;
-    TextureDesc.SampleDesc.Count = 1;
-    TextureDesc.SampleDesc.Quality = 0;
-    TextureDesc.BindFlags = 0;
-
-    Device->CreateTexture2D(&TextureDesc, nullptr, &IdStagingBuffer);
-}
-
 void D3D11RHI::CreateRasterizerState()
 {
     D3D11_RASTERIZER_DESC deafultrasterizerdesc = {};
@@ -696,6 +673,123 @@ void D3D11RHI::CreateConstantBuffer(ID3D11Buffer** ConstantBuffer, uint32 Size)
     Device->CreateBuffer(&BufferDesc, nullptr, ConstantBuffer);
 }
 
+void D3D11RHI::CreateUploadRing()
+{
+    // 오프셋 바인딩과 동적 상수 버퍼 NO_OVERWRITE가 모두 되어야 링을 씀 (기능 수준 11_0이라도 11.1 런타임이면 대개 지원)
+    D3D11_FEATURE_DATA_D3D11_OPTIONS Options{};
+    const bool bHasContext1 = static_cast<FD3D11CommandContext*>(D3D11CommandContext.get())->SupportsConstantBufferRanges();
+    if (!bHasContext1
+        || FAILED(Device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &Options, sizeof(Options)))
+        || !Options.ConstantBufferOffsetting || !Options.MapNoOverwriteOnDynamicConstantBuffer)
+    {
+        UE_LOG("[RHI] Constant buffer offsetting not supported: per-draw constant buffer updates");
+        return;
+    }
+
+    D3D11_BUFFER_DESC BufferDesc{};
+    BufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+    BufferDesc.ByteWidth = UploadRingSize;
+    BufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    BufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    if (FAILED(Device->CreateBuffer(&BufferDesc, nullptr, &UploadRingBuffer)))
+    {
+        UE_LOG("[RHI] Failed to create upload ring buffer");
+        return;
+    }
+
+    D3D11_QUERY_DESC QueryDesc{};
+    QueryDesc.Query = D3D11_QUERY_EVENT;
+    for (ID3D11Query*& Fence : UploadFrameFences)
+    {
+        if (FAILED(Device->CreateQuery(&QueryDesc, &Fence)))
+        {
+            ReleaseUploadRing();
+            return;
+        }
+    }
+
+    UploadAllocator.Initialize(UploadRingSize);
+    bUploadRingEnabled = true;
+}
+
+void D3D11RHI::ReleaseUploadRing()
+{
+    for (ID3D11Query*& Fence : UploadFrameFences)
+    {
+        if (Fence) { Fence->Release(); Fence = nullptr; }
+    }
+    if (UploadRingBuffer) { UploadRingBuffer->Release(); UploadRingBuffer = nullptr; }
+    bUploadRingEnabled = false;
+    bUploadRingDiscarded = false;
+}
+
+uint8* D3D11RHI::MapUploadRing(uint32 InSize, uint32& OutOffset)
+{
+    if (!bUploadRingEnabled || !UploadAllocator.Allocate(InSize, OutOffset))
+    {
+        return nullptr;
+    }
+
+    uint8* Data = CommandContext->MapUploadBuffer(UploadRingBuffer, OutOffset, InSize, !bUploadRingDiscarded);
+    bUploadRingDiscarded = bUploadRingDiscarded || (Data != nullptr);
+    return Data;
+}
+
+void D3D11RHI::UnmapUploadRing()
+{
+    CommandContext->UnmapUploadBuffer(UploadRingBuffer);
+}
+
+void D3D11RHI::BeginUploadFrame()
+{
+    if (!bUploadRingEnabled)
+    {
+        return;
+    }
+
+    if (!Device)
+    {
+        CompletedUploadFrame = UploadFrameIndex - 1;
+    }
+    else
+    {
+        // 끝난 펜스는 기다리지 않고 확인만 하고, 이번 프레임이 재사용할 펜스 슬롯의 프레임만 완료까지 기다림
+        while (CompletedUploadFrame + 1 < UploadFrameIndex)
+        {
+            const uint64 OldestFrame = CompletedUploadFrame + 1;
+            const bool bMustWait = UploadFrameIndex - OldestFrame >= MaxUploadFramesInFlight;
+            const HRESULT Result = DeviceContext->GetData(UploadFrameFences[OldestFrame % MaxUploadFramesInFlight], nullptr, 0,
+                bMustWait ? 0 : D3D11_ASYNC_GETDATA_DONOTFLUSH);
+            if (Result == S_OK || FAILED(Result))
+            {
+                // 실패(디바이스 제거 등)는 완료로 보고 무한 대기를 피함
+                CompletedUploadFrame = OldestFrame;
+            }
+            else if (!bMustWait)
+            {
+                break;
+            }
+        }
+    }
+
+    UploadAllocator.BeginFrame(UploadFrameIndex, CompletedUploadFrame);
+}
+
+void D3D11RHI::EndUploadFrame()
+{
+    if (!bUploadRingEnabled)
+    {
+        return;
+    }
+
+    if (Device)
+    {
+        DeviceContext->End(UploadFrameFences[UploadFrameIndex % MaxUploadFramesInFlight]);
+    }
+    UploadAllocator.EndFrame();
+    ++UploadFrameIndex;
+}
+
 void D3D11RHI::UpdateUVScrollConstantBuffers(const FVector2D& Speed, float TimeSec)
 {
     if (!UVScrollCB) return;
@@ -849,25 +943,6 @@ void D3D11RHI::ReleaseFrameBuffer()
     }
 }
 
-void D3D11RHI::ReleaseIdBuffer()
-{
-    if (IdBufferRTV)
-    {
-        IdBufferRTV->Release();
-        IdBufferRTV = nullptr;
-    }
-    if (IdStagingBuffer)
-    {
-        IdStagingBuffer->Release();
-        IdStagingBuffer = nullptr;
-    }
-    if (IdBuffer)
-    {
-        IdBuffer->Release();
-        IdBuffer = nullptr;
-    }
-}
-
 void D3D11RHI::ReleaseDeviceAndSwapChain()
 {
     if (SwapChain)
@@ -894,16 +969,16 @@ void D3D11RHI::OMSetDepthStencilState(EComparisonFunc Func)
     switch (Func)
     {
     case EComparisonFunc::Always:
-        DeviceContext->OMSetDepthStencilState(DepthStencilStateAlwaysNoWrite, 0);
+        CommandContext->SetDepthStencilState(DepthStencilStateAlwaysNoWrite, 0);
         break;
     case EComparisonFunc::LessEqual:
-        DeviceContext->OMSetDepthStencilState(DepthStencilStateLessEqualWrite, 0);
+        CommandContext->SetDepthStencilState(DepthStencilStateLessEqualWrite, 0);
         break;
     case EComparisonFunc::GreaterEqual:
-        DeviceContext->OMSetDepthStencilState(DepthStencilStateGreaterEqualWrite, 0);
+        CommandContext->SetDepthStencilState(DepthStencilStateGreaterEqualWrite, 0);
         break;
     case EComparisonFunc::LessEqualReadOnly:
-        DeviceContext->OMSetDepthStencilState(DepthStencilStateLessEqualReadOnly, 0);
+        CommandContext->SetDepthStencilState(DepthStencilStateLessEqualReadOnly, 0);
         break;
     }
 }
@@ -911,13 +986,13 @@ void D3D11RHI::OMSetDepthStencilState(EComparisonFunc Func)
 void D3D11RHI::OMSetDepthStencilState_OverlayWriteStencil()
 {
     // Stencil ref = 1 (overlay marks)
-    DeviceContext->OMSetDepthStencilState(DepthStencilStateOverlayWriteStencil, 1);
+    CommandContext->SetDepthStencilState(DepthStencilStateOverlayWriteStencil, 1);
 }
 
 void D3D11RHI::OMSetDepthStencilState_StencilRejectOverlay()
 {
     // Stencil ref = 0 (draw only where overlay not marked)
-    DeviceContext->OMSetDepthStencilState(DepthStencilStateStencilRejectOverlay, 0);
+    CommandContext->SetDepthStencilState(DepthStencilStateStencilRejectOverlay, 0);
 }
 
 void D3D11RHI::CreateShader(ID3D11InputLayout** SimpleInputLayout, ID3D11VertexShader** SimpleVertexShader, ID3D11PixelShader** SimplePixelShader)
@@ -964,7 +1039,6 @@ void D3D11RHI::OnResize(UINT NewWidth, UINT NewHeight)
 
     // 기존 리소스 해제
     ReleaseFrameBuffer();
-    ReleaseIdBuffer();
 
     // 스왑체인 버퍼 리사이즈
     HRESULT hr = SwapChain->ResizeBuffers(
@@ -982,7 +1056,6 @@ void D3D11RHI::OnResize(UINT NewWidth, UINT NewHeight)
 
     // 새 프레임버퍼/RTV/DSV 생성
     CreateFrameBuffer();
-    CreateIdBuffer();
 
     // 뷰포트 갱신
     ViewportInfo.TopLeftX = 0.0f;
@@ -1073,12 +1146,12 @@ void D3D11RHI::SetViewport(UINT width, UINT height)
 
 void D3D11RHI::PSSetDefaultSampler(UINT StartSlot)
 {
-	DeviceContext->PSSetSamplers(StartSlot, 1, &DefaultSamplerState);
+	CommandContext->SetPSSamplers(StartSlot, 1, &DefaultSamplerState);
 }
 
 void D3D11RHI::PSSetClampSampler(UINT StartSlot)
 {
-    DeviceContext->PSSetSamplers(StartSlot, 1, &LinearClampSamplerState);
+    CommandContext->SetPSSamplers(StartSlot, 1, &LinearClampSamplerState);
 }
 
 ID3D11SamplerState* D3D11RHI::GetSamplerState(RHI_Sampler_Index SamplerIndex) const
@@ -1130,6 +1203,10 @@ void D3D11RHI::PrepareShader(UShader* InVertexShader, UShader* InPixelShader)
 
 HRESULT D3D11RHI::CreateStructuredBuffer(UINT InElementSize, UINT InElementCount, const void* InInitData, ID3D11Buffer** OutBuffer)
 {
+    // null 모드: GPU 리소스 없음 (갱신/바인딩은 null 버퍼로 기록만 됨)
+    if (!Device)
+        return E_FAIL;
+
     D3D11_BUFFER_DESC bufferDesc = {};
     bufferDesc.Usage = D3D11_USAGE_DYNAMIC;  // CPU에서 업데이트 가능
     bufferDesc.ByteWidth = InElementSize * InElementCount;
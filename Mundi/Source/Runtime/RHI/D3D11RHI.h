@@ -3,6 +3,8 @@
 #include "ResourceManager.h"
 #include "VertexData.h"
 #include "ConstantBufferType.h"
+#include "RHICommandContext.h"
+#include "FrameUploadAllocator.h"
 
 
 #define DECLARE_CONSTANT_BUFFER(TYPE)\
@@ -10,7 +12,7 @@ ID3D11Buffer* TYPE##Buffer{};
 #define CREATE_CONSTANT_BUFFER(TYPE)\
 CreateConstantBuffer(&TYPE##Buffer, sizeof(TYPE));
 #define RELEASE_CONSTANT_BUFFER(TYPE)\
-{TYPE##Buffer->Release(); TYPE##Buffer = nullptr;}
+if (TYPE##Buffer) {TYPE##Buffer->Release(); TYPE##Buffer = nullptr;}
 
 
 #define DECLARE_UPDATE_CONSTANT_BUFFER_FUNC(TYPE) \
@@ -55,6 +57,13 @@ public:
 public:
 	void Initialize(HWND hWindow);
 
+	/**
+	 * 디바이스 없이 명령만 InContext로 보내는 null 모드 (헤드리스 벤치마크용).
+	 * 상태/상수 버퍼 헬퍼와 드로우 제출 경로만 동작하며, 리소스 생성/Present 등은 호출하면 안 됩니다.
+	 */
+	void InitializeNull(IRHICommandContext* InContext);
+	bool IsNull() const { return Device == nullptr; }
+
 	void Release();
 
 
@@ -76,6 +85,9 @@ public:
 	template<typename TVertex>
 	static HRESULT CreateVertexBuffer(ID3D11Device* device, const std::vector<FNormalVertex>& srcVertices, ID3D11Buffer** outBuffer);
 
+	// 이미 GPU 레이아웃으로 인코딩된 정점 데이터 (예: 패킹 정점)
+	static HRESULT CreateVertexBufferFromBytes(ID3D11Device* device, const void* vertexData, uint32 byteWidth, ID3D11Buffer** outBuffer);
+
 	static HRESULT CreateIndexBuffer(ID3D11Device* device, const FMeshData* meshData, ID3D11Buffer** outBuffer);
 
 	static HRESULT CreateIndexBuffer(ID3D11Device* device, const FStaticMesh* mesh, ID3D11Buffer** outBuffer);
@@ -87,11 +99,7 @@ public:
 	template <typename T>
 	void ConstantBufferUpdate(ID3D11Buffer* ConstantBuffer, T& Data)
 	{
-		D3D11_MAPPED_SUBRESOURCE MSR;
-
-		DeviceContext->Map(ConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MSR);
-		memcpy(MSR.pData, &Data, sizeof(T));
-		DeviceContext->Unmap(ConstantBuffer, 0);
+		CommandContext->UpdateConstantBuffer(ConstantBuffer, &Data, sizeof(T));
 	}
 	template <typename T>
 	void ConstantBufferSetUpdate(ID3D11Buffer* ConstantBuffer, T& Data, const uint32 Slot, const bool bIsVS, const bool bIsPS)
@@ -101,6 +109,20 @@ public:
 		
 	}
 	void ConstantBufferSet(ID3D11Buffer* ConstantBuffer, uint32 Slot, bool bIsVS, bool bIsPS);
+
+	/**
+	 * 프레임 업로드 링: 드로우별 상수(모델/색/재질)를 큰 동적 상수 버퍼 하나에 이어 쓰고 오프셋으로 바인딩합니다.
+	 * D3D11.1 런타임의 ConstantBufferOffsetting + 동적 상수 버퍼 NO_OVERWRITE가 필요하며, 없으면 CanBindConstantBufferRanges()가
+	 * false이므로 호출 측은 기존 SetAndUpdateConstantBuffer 경로를 씁니다. 프레임마다 이벤트 쿼리로 GPU 완료를 확인해 구간을 회수합니다.
+	 */
+	bool CanBindConstantBufferRanges() const { return bUploadRingEnabled; }
+	ID3D11Buffer* GetUploadRingBuffer() const { return UploadRingBuffer; }
+	// InSize 바이트를 잘라 매핑 (실패하면 nullptr). 쓰고 나면 드로우 전에 UnmapUploadRing 필수
+	uint8* MapUploadRing(uint32 InSize, uint32& OutOffset);
+	void UnmapUploadRing();
+	void BeginUploadFrame();
+	void EndUploadFrame();
+	const FFrameUploadAllocator& GetUploadAllocator() const { return UploadAllocator; }
     void UpdateUVScrollConstantBuffers(const FVector2D& Speed, float TimeSec);
 	
 	void IASetPrimitiveTopology();
@@ -144,16 +166,12 @@ public:
 	// NOTE: 추후 private 로 이동 필요?
 	// 현재 SRV, RTV 를 다루는 함수
 	ID3D11RenderTargetView* GetCurrentTargetRTV() const;
-	ID3D11RenderTargetView* GetIdBufferRTV() const { return IdBufferRTV; }
 
 	ID3D11DepthStencilView* GetSceneDSV() const;
 
 	ID3D11ShaderResourceView* GetSRV(RHI_SRV_Index SRVIndex) const;
 	ID3D11ShaderResourceView* GetCurrentSourceSRV() const;
 
-	ID3D11Texture2D* GetIdBuffer() const { return IdBuffer; }
-	ID3D11Texture2D* GetIdStagingBuffer() const { return IdStagingBuffer; }
-
 	// [Enum 으로 SRV, RTV 를 다루는 함수]
 
 	ID3D11SamplerState* GetSamplerState(RHI_Sampler_Index SamplerIndex) const;
@@ -174,6 +192,12 @@ public:
 		return SwapChain;
 	}
 
+	// 드로우 제출/상태 변경 명령 (D3D11 즉시 실행 또는 null 모드의 기록 백엔드)
+	inline IRHICommandContext& GetCommandContext()
+	{
+		return *CommandContext;
+	}
+
     // RTV Getters
     ID3D11RenderTargetView* GetBackBufferRTV() const { return BackBufferRTV; }
 
@@ -184,9 +208,10 @@ public:
 private:
 	void CreateDeviceAndSwapChain(HWND hWindow); // 여기서 디바이스, 디바이스 컨택스트, 스왑체인, 뷰포트를 초기화한다
 	void CreateFrameBuffer();
-	void CreateIdBuffer();
 	void CreateRasterizerState();
 	void CreateConstantBuffer(ID3D11Buffer** ConstantBuffer, uint32 Size);
+	void CreateUploadRing();
+	void ReleaseUploadRing();
 	void CreateDepthStencilState();
 	void CreateSamplerState();
 
@@ -195,7 +220,6 @@ private:
 	void ReleaseBlendState();
 	void ReleaseRasterizerState(); // rs
 	void ReleaseFrameBuffer(); // fb, rtv
-	void ReleaseIdBuffer();
 	void ReleaseDeviceAndSwapChain();
 
 	// FSwapGuard 클래스가 D3D11RHI의 private 멤버에 접근할 수 있도록 허용
@@ -212,6 +236,9 @@ private:
 	ID3D11DeviceContext* DeviceContext{};//
 	IDXGISwapChain* SwapChain{};//
 
+	std::unique_ptr<IRHICommandContext> D3D11CommandContext;
+	IRHICommandContext* CommandContext = nullptr;	// D3D11CommandContext 또는 InitializeNull로 받은 컨텍스트
+
 	ID3D11RasterizerState* DefaultRasterizerState{};//
 	ID3D11RasterizerState* WireFrameRasterizerState{};//
 	ID3D11RasterizerState* DecalRasterizerState{};//
@@ -232,10 +259,6 @@ private:
 	ID3D11BlendState* BlendStateOpaque{};
 
 	ID3D11Texture2D* FrameBuffer{};
-	ID3D11Texture2D* IdBuffer{};
-	ID3D11Texture2D* IdStagingBuffer{};
-
-	ID3D11RenderTargetView* IdBufferRTV{};
 	ID3D11RenderTargetView* BackBufferRTV{};
 	ID3D11DepthStencilView* DepthStencilView{};
 
@@ -256,6 +279,17 @@ private:
 	CONSTANT_BUFFER_LIST(DECLARE_CONSTANT_BUFFER)
 	ID3D11Buffer* UVScrollCB{};
 
+	// 프레임 업로드 링
+	static constexpr uint32 UploadRingSize = 32 * 1024 * 1024;
+	static constexpr uint32 MaxUploadFramesInFlight = 3;
+	ID3D11Buffer* UploadRingBuffer = nullptr;
+	ID3D11Query* UploadFrameFences[MaxUploadFramesInFlight] = {};
+	FFrameUploadAllocator UploadAllocator;
+	uint64 UploadFrameIndex = 1;
+	uint64 CompletedUploadFrame = 0;
+	bool bUploadRingEnabled = false;
+	bool bUploadRingDiscarded = false;	// 첫 매핑은 WRITE_DISCARD
+
 	ID3D11SamplerState* DefaultSamplerState = nullptr;
 	ID3D11SamplerState* LinearClampSamplerState = nullptr;
 	ID3D11SamplerState* PointClampSamplerState = nullptr;
@@ -0,0 +1,94 @@
+﻿#include "pch.h"
+#include "FrameUploadAllocator.h"
+
+void FFrameUploadAllocator::Initialize(uint32 InCapacity, uint32 InAlignment)
+{
+	// 정렬은 2의 거듭제곱이어야 Align이 맞음
+	Alignment = (InAlignment > 0 && (InAlignment & (InAlignment - 1)) == 0) ? InAlignment : DefaultAlignment;
+	Capacity = InCapacity & ~(Alignment - 1);
+	Head = 0;
+	Tail = 0;
+	UsedBytes = 0;
+	FrameBytes = 0;
+	PeakFrameBytes = 0;
+	PendingFrames.Empty();
+	FrameStats = FFrameUploadStats();
+	LastFrameStats = FFrameUploadStats();
+}
+
+void FFrameUploadAllocator::BeginFrame(uint64 InFrameIndex, uint64 InCompletedFrame)
+{
+	int32 RetireCount = 0;
+	while (RetireCount < PendingFrames.Num() && PendingFrames[RetireCount].FrameIndex <= InCompletedFrame)
+	{
+		Tail = PendingFrames[RetireCount].EndOffset;
+		UsedBytes -= PendingFrames[RetireCount].Bytes;
+		++RetireCount;
+	}
+	if (RetireCount > 0)
+	{
+		PendingFrames.erase(PendingFrames.begin(), PendingFrames.begin() + RetireCount);
+	}
+
+	FrameIndex = InFrameIndex;
+}
+
+void FFrameUploadAllocator::EndFrame()
+{
+	PendingFrames.Add(FPendingFrame{ FrameIndex, Head, FrameBytes });
+	PeakFrameBytes = std::max<uint64>(PeakFrameBytes, FrameBytes);
+	FrameBytes = 0;
+
+	LastFrameStats = FrameStats;
+	FrameStats = FFrameUploadStats();
+}
+
+bool FFrameUploadAllocator::Allocate(uint32 InSize, uint32& OutOffset)
+{
+	const uint32 Size = Align(InSize, Alignment);
+	if (InSize == 0 || Size > Capacity - UsedBytes)
+	{
+		++FrameStats.FailedAllocations;
+		return false;
+	}
+
+	// 살아 있는 데이터가 없으면 처음부터 (Head == Tail이 비었는지/꽉 찼는지 헷갈리지 않도록)
+	if (UsedBytes == 0)
+	{
+		Head = 0;
+		Tail = 0;
+	}
+
+	uint32 Offset = Head;
+	uint32 Wasted = 0;
+	if (Head >= Tail)
+	{
+		// 빈 구간: [Head, Capacity) + [0, Tail). 끝에 안 들어가면 남은 꼬리는 버리고 0으로 돌아감
+		if (Size > Capacity - Head)
+		{
+			if (Size > Tail)
+			{
+				++FrameStats.FailedAllocations;
+				return false;
+			}
+			Wasted = Capacity - Head;
+			Offset = 0;
+		}
+	}
+	else if (Size > Tail - Head)
+	{
+		// 빈 구간: [Head, Tail)
+		++FrameStats.FailedAllocations;
+		return false;
+	}
+
+	Head = Offset + Size;
+	UsedBytes += Size + Wasted;
+	FrameBytes += Size + Wasted;
+
+	++FrameStats.Allocations;
+	FrameStats.AllocatedBytes += Size + Wasted;
+
+	OutOffset = Offset;
+	return true;
+}
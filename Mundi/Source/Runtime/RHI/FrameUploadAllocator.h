@@ -0,0 +1,63 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+struct FFrameUploadStats
+{
+	uint32 Allocations = 0;
+	uint32 FailedAllocations = 0;
+	uint64 AllocatedBytes = 0;		// 정렬 패딩 + 링 끝에서 버린 구간 포함
+};
+
+/**
+ * 프레임 단위 선형 링 할당기 (드로우별 상수 데이터 업로드용, 바이트 오프셋만 다룸).
+ * 한 프레임 동안 Head부터 정렬된 구간을 선형으로 잘라 주고, EndFrame에서 그 프레임이 쓴 끝 위치를 기록해 둡니다.
+ * BeginFrame에 GPU가 끝낸 프레임 번호를 넘기면 그 프레임까지의 구간을 회수하며,
+ * GPU가 아직 읽을 수 있는 구간과 겹치는 할당은 실패합니다 (호출 측은 기존 상수 버퍼 갱신으로 대체).
+ * 디바이스와 무관한 CPU 코드라 D3D11RHI 없이 단독으로 검증할 수 있습니다.
+ */
+class FFrameUploadAllocator
+{
+public:
+	static constexpr uint32 DefaultAlignment = 256;	// D3D11.1 상수 버퍼 오프셋 바인딩 단위 (16 상수)
+
+	void Initialize(uint32 InCapacity, uint32 InAlignment = DefaultAlignment);
+
+	// InCompletedFrame 이하 프레임이 쓴 구간을 회수하고 InFrameIndex 프레임을 시작
+	void BeginFrame(uint64 InFrameIndex, uint64 InCompletedFrame);
+	void EndFrame();
+
+	bool Allocate(uint32 InSize, uint32& OutOffset);
+
+	static constexpr uint32 Align(uint32 InSize, uint32 InAlignment) { return (InSize + InAlignment - 1) & ~(InAlignment - 1); }
+
+	uint32 GetCapacity() const { return Capacity; }
+	uint32 GetAlignment() const { return Alignment; }
+	uint32 GetUsedBytes() const { return UsedBytes; }
+	uint32 GetPendingFrameCount() const { return static_cast<uint32>(PendingFrames.Num()); }
+	uint64 GetFrameIndex() const { return FrameIndex; }
+	const FFrameUploadStats& GetFrameStats() const { return FrameStats; }
+	const FFrameUploadStats& GetLastFrameStats() const { return LastFrameStats; }
+	uint64 GetPeakFrameBytes() const { return PeakFrameBytes; }
+
+private:
+	// EndFrame까지 끝난, GPU 완료를 기다리는 프레임 구간
+	struct FPendingFrame
+	{
+		uint64 FrameIndex = 0;
+		uint32 EndOffset = 0;		// 이 프레임이 끝났을 때의 Head (회수 시 새 Tail)
+		uint32 Bytes = 0;
+	};
+
+	uint32 Capacity = 0;
+	uint32 Alignment = DefaultAlignment;
+	uint32 Head = 0;				// 다음 할당 위치
+	uint32 Tail = 0;				// 아직 회수되지 않은 가장 오래된 데이터 시작
+	uint32 UsedBytes = 0;
+	uint32 FrameBytes = 0;
+	uint64 FrameIndex = 0;
+	uint64 PeakFrameBytes = 0;
+
+	TArray<FPendingFrame> PendingFrames;	// 오래된 순 (프레임 인 플라이트 수 정도라 앞에서 지워도 충분)
+	FFrameUploadStats FrameStats;
+	FFrameUploadStats LastFrameStats;
+};
@@ -0,0 +1,161 @@
+﻿#include "pch.h"
+#include "FrameUploadAllocator.h"
+#include "SelfTest.h"
+
+IMPLEMENT_SELF_TEST(FrameUploadAllocator, Alignment)
+{
+	FFrameUploadAllocator Allocator;
+	Allocator.Initialize(1000, 256);
+	SELF_TEST_CHECK(Allocator.GetCapacity() == 768);	// 정렬 단위로 내림
+
+	Allocator.BeginFrame(1, 0);
+	uint32 Offset = ~0u;
+	SELF_TEST_CHECK(Allocator.Allocate(1, Offset) && Offset == 0);
+	SELF_TEST_CHECK(Allocator.Allocate(257, Offset) && Offset == 256);
+	SELF_TEST_CHECK(Allocator.GetUsedBytes() == 768);
+	SELF_TEST_CHECK(!Allocator.Allocate(0, Offset));
+	SELF_TEST_CHECK(!Allocator.Allocate(1, Offset));
+	Allocator.EndFrame();
+	SELF_TEST_CHECK(Allocator.GetLastFrameStats().Allocations == 2);
+	SELF_TEST_CHECK(Allocator.GetLastFrameStats().FailedAllocations == 2);
+	SELF_TEST_CHECK(Allocator.GetLastFrameStats().AllocatedBytes == 768);
+
+	// 정렬이 2의 거듭제곱이 아니면 기본값
+	Allocator.Initialize(4096, 100);
+	SELF_TEST_CHECK(Allocator.GetAlignment() == FFrameUploadAllocator::DefaultAlignment);
+}
+
+IMPLEMENT_SELF_TEST(FrameUploadAllocator, FrameFencing)
+{
+	FFrameUploadAllocator Allocator;
+	Allocator.Initialize(1024, 256);
+	uint32 Offset = 0;
+
+	Allocator.BeginFrame(1, 0);
+	SELF_TEST_CHECK(Allocator.Allocate(512, Offset) && Offset == 0);
+	Allocator.EndFrame();
+
+	// 프레임 1이 GPU에서 안 끝났으면 그 구간은 못 씀
+	Allocator.BeginFrame(2, 0);
+	SELF_TEST_CHECK(Allocator.Allocate(512, Offset) && Offset == 512);
+	SELF_TEST_CHECK(!Allocator.Allocate(256, Offset));
+	Allocator.EndFrame();
+	SELF_TEST_CHECK(Allocator.GetPendingFrameCount() == 2);
+
+	// 프레임 1 완료 -> 앞 절반만 회수, 프레임 2 구간은 그대로 보호
+	Allocator.BeginFrame(3, 1);
+	SELF_TEST_CHECK(Allocator.GetPendingFrameCount() == 1);
+	SELF_TEST_CHECK(Allocator.GetUsedBytes() == 512);
+	SELF_TEST_CHECK(Allocator.Allocate(512, Offset) && Offset == 0);
+	SELF_TEST_CHECK(!Allocator.Allocate(256, Offset));
+	Allocator.EndFrame();
+
+	// 전부 완료 -> 비어 있으므로 처음부터
+	Allocator.BeginFrame(4, 3);
+	SELF_TEST_CHECK(Allocator.GetPendingFrameCount() == 0);
+	SELF_TEST_CHECK(Allocator.GetUsedBytes() == 0);
+	SELF_TEST_CHECK(Allocator.Allocate(1024, Offset) && Offset == 0);
+	Allocator.EndFrame();
+	SELF_TEST_CHECK(Allocator.GetFrameIndex() == 4);
+	SELF_TEST_CHECK(Allocator.GetPeakFrameBytes() == 1024);
+}
+
+IMPLEMENT_SELF_TEST(FrameUploadAllocator, RingWrap)
+{
+	FFrameUploadAllocator Allocator;
+	Allocator.Initialize(1024, 256);
+	uint32 Offset = 0;
+
+	Allocator.BeginFrame(1, 0);
+	SELF_TEST_CHECK(Allocator.Allocate(512, Offset) && Offset == 0);
+	Allocator.EndFrame();
+	Allocator.BeginFrame(2, 0);
+	SELF_TEST_CHECK(Allocator.Allocate(256, Offset) && Offset == 512);
+	Allocator.EndFrame();
+
+	// 끝에 256만 남았으므로 512는 0으로 돌아가고, 남은 꼬리 256은 버린 것으로 계산
+	Allocator.BeginFrame(3, 1);
+	SELF_TEST_CHECK(Allocator.Allocate(512, Offset) && Offset == 0);
+	SELF_TEST_CHECK(Allocator.GetUsedBytes() == 1024);
+	SELF_TEST_CHECK(!Allocator.Allocate(256, Offset));
+	Allocator.EndFrame();
+	SELF_TEST_CHECK(Allocator.GetLastFrameStats().AllocatedBytes == 768);
+
+	// 프레임 2만 회수: 프레임 2 구간 [512, 768)만 비고, 버린 꼬리 [768, 1024)는 프레임 3이 끝나야 회수
+	Allocator.BeginFrame(4, 2);
+	SELF_TEST_CHECK(Allocator.GetUsedBytes() == 768);
+	SELF_TEST_CHECK(!Allocator.Allocate(512, Offset));
+	SELF_TEST_CHECK(Allocator.Allocate(256, Offset) && Offset == 512);
+	Allocator.EndFrame();
+
+	// 프레임 3까지 회수하면 프레임 4 구간 [512, 768)만 남음 -> 끝 [768, 1024)에 이어서 할당
+	Allocator.BeginFrame(5, 3);
+	SELF_TEST_CHECK(Allocator.GetUsedBytes() == 256);
+	SELF_TEST_CHECK(Allocator.Allocate(256, Offset) && Offset == 768);
+	SELF_TEST_CHECK(Allocator.Allocate(512, Offset) && Offset == 0);
+	SELF_TEST_CHECK(!Allocator.Allocate(256, Offset));
+	Allocator.EndFrame();
+}
+
+IMPLEMENT_SELF_TEST(FrameUploadAllocator, NoOverlapWithInFlightFrames)
+{
+	// GPU가 2프레임 늦게 끝내는 상황에서 무작위 크기로 할당해, 새 할당이 아직 회수 안 된 구간과 겹치지 않는지 확인
+	constexpr uint32 Capacity = 64 * 1024;
+	constexpr uint32 Alignment = 256;
+	constexpr uint64 FramesInFlight = 2;
+
+	struct FRange
+	{
+		uint64 Frame;
+		uint32 Begin;
+		uint32 End;
+	};
+
+	FFrameUploadAllocator Allocator;
+	Allocator.Initialize(Capacity, Alignment);
+
+	TArray<FRange> LiveRanges;
+	uint32 Seed = 0xC0FFEEu;
+	auto NextRandom = [&Seed]() { Seed = Seed * 1664525u + 1013904223u; return Seed >> 8; };
+
+	uint32 SuccessCount = 0;
+	uint32 FailCount = 0;
+	bool bOverlapFound = false;
+	bool bOutOfRange = false;
+	for (uint64 Frame = 1; Frame <= 500; ++Frame)
+	{
+		const uint64 Completed = Frame > FramesInFlight ? Frame - FramesInFlight - 1 : 0;
+		Allocator.BeginFrame(Frame, Completed);
+		LiveRanges.erase(std::remove_if(LiveRanges.begin(), LiveRanges.end(),
+			[Completed](const FRange& Range) { return Range.Frame <= Completed; }), LiveRanges.end());
+
+		const uint32 AllocationCount = 1 + NextRandom() % 40;
+		for (uint32 i = 0; i < AllocationCount; ++i)
+		{
+			const uint32 Size = 1 + NextRandom() % 2048;
+			uint32 Offset = 0;
+			if (!Allocator.Allocate(Size, Offset))
+			{
+				++FailCount;
+				continue;
+			}
+			++SuccessCount;
+
+			const FRange New{ Frame, Offset, Offset + FFrameUploadAllocator::Align(Size, Alignment) };
+			bOutOfRange |= (New.End > Capacity) || (Offset % Alignment) != 0;
+			for (const FRange& Live : LiveRanges)
+			{
+				bOverlapFound |= (New.Begin < Live.End && Live.Begin < New.End);
+			}
+			LiveRanges.Add(New);
+		}
+		Allocator.EndFrame();
+	}
+
+	SELF_TEST_CHECK(!bOverlapFound);
+	SELF_TEST_CHECK(!bOutOfRange);
+	SELF_TEST_CHECK(SuccessCount > 0);
+	SELF_TEST_CHECK(FailCount > 0);	// 링이 실제로 가득 차는 경로까지 돌았는지
+	SELF_TEST_CHECK(Allocator.GetUsedBytes() <= Capacity);
+	Test.AddInfo("%u allocations, %u rejected", SuccessCount, FailCount);
+}
@@ -0,0 +1,172 @@
+﻿#pragma once
+#include <d3d11.h>
+#include "UEContainer.h"
+
+/**
+ * 렌더러가 매 프레임 GPU에 보내는 명령 수 통계.
+ * 상태 변경 수는 같은 값을 다시 바인딩해도 세므로 "호출 수" 기준입니다 (중복 바인딩이 줄었는지 추적용).
+ */
+struct FRHICommandStats
+{
+	uint32 DrawCalls = 0;
+	uint64 IndexCount = 0;			// DrawIndexed 인덱스 + Draw 정점 합
+	uint32 ShaderChanges = 0;		// VS/PS/InputLayout
+	uint32 VertexBufferBinds = 0;
+	uint32 IndexBufferBinds = 0;
+	uint32 TopologyChanges = 0;
+	uint32 ShaderResourceBinds = 0;
+	uint32 SamplerBinds = 0;
+	uint32 ConstantBufferUpdates = 0;
+	uint64 ConstantBufferBytes = 0;
+	uint32 ConstantBufferBinds = 0;
+	uint32 PipelineStateChanges = 0;	// Rasterizer/Blend/DepthStencil
+	uint32 RenderTargetChanges = 0;
+
+	uint32 GetStateChangeCount() const
+	{
+		return ShaderChanges + VertexBufferBinds + IndexBufferBinds + TopologyChanges + ShaderResourceBinds
+			+ SamplerBinds + ConstantBufferBinds + PipelineStateChanges + RenderTargetChanges;
+	}
+};
+
+/**
+ * RHI 명령 인터페이스.
+ * 렌더러의 드로우 제출 경로 (FSceneRenderer::SubmitMeshBatches, D3D11RHI 상태 헬퍼)는 ID3D11DeviceContext 대신
+ * 이 인터페이스를 호출하므로, 실제 디바이스 없이 FRecordingCommandContext로 CPU 비용과 명령 수를 잴 수 있습니다.
+ * 핸들 타입은 D3D11 포인터를 그대로 쓰며 (RHIDevice.h의 NOTE 참고), 기록 백엔드에서는 불투명 값으로만 다룹니다.
+ *
+ * 통계는 public 비가상 함수에서 한 번만 세고, 백엔드는 Execute* 만 구현합니다.
+ */
+class IRHICommandContext
+{
+public:
+	virtual ~IRHICommandContext() = default;
+
+	void SetInputLayout(ID3D11InputLayout* InInputLayout) { ++Stats.ShaderChanges; ExecuteSetInputLayout(InInputLayout); }
+	void SetVertexShader(ID3D11VertexShader* InShader) { ++Stats.ShaderChanges; ExecuteSetVertexShader(InShader); }
+	void SetPixelShader(ID3D11PixelShader* InShader) { ++Stats.ShaderChanges; ExecuteSetPixelShader(InShader); }
+
+	void SetVertexBuffer(ID3D11Buffer* InBuffer, uint32 InStride, uint32 InOffset)
+	{
+		++Stats.VertexBufferBinds;
+		ExecuteSetVertexBuffer(InBuffer, InStride, InOffset);
+	}
+	void SetIndexBuffer(ID3D11Buffer* InBuffer, DXGI_FORMAT InFormat, uint32 InOffset)
+	{
+		++Stats.IndexBufferBinds;
+		ExecuteSetIndexBuffer(InBuffer, InFormat, InOffset);
+	}
+	void SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology) { ++Stats.TopologyChanges; ExecuteSetPrimitiveTopology(InTopology); }
+
+	void SetPSShaderResources(uint32 InStartSlot, uint32 InCount, ID3D11ShaderResourceView* const* InViews)
+	{
+		Stats.ShaderResourceBinds += InCount;
+		ExecuteSetPSShaderResources(InStartSlot, InCount, InViews);
+	}
+	void SetVSShaderResources(uint32 InStartSlot, uint32 InCount, ID3D11ShaderResourceView* const* InViews)
+	{
+		Stats.ShaderResourceBinds += InCount;
+		ExecuteSetVSShaderResources(InStartSlot, InCount, InViews);
+	}
+	void SetPSSamplers(uint32 InStartSlot, uint32 InCount, ID3D11SamplerState* const* InSamplers)
+	{
+		Stats.SamplerBinds += InCount;
+		ExecuteSetPSSamplers(InStartSlot, InCount, InSamplers);
+	}
+
+	// 동적 상수 버퍼 전체를 WRITE_DISCARD로 갱신
+	void UpdateConstantBuffer(ID3D11Buffer* InBuffer, const void* InData, uint32 InSize)
+	{
+		++Stats.ConstantBufferUpdates;
+		Stats.ConstantBufferBytes += InSize;
+		ExecuteUpdateConstantBuffer(InBuffer, InData, InSize);
+	}
+	void SetConstantBuffer(ID3D11Buffer* InBuffer, uint32 InSlot, bool bInVS, bool bInPS)
+	{
+		Stats.ConstantBufferBinds += (bInVS ? 1 : 0) + (bInPS ? 1 : 0);
+		ExecuteSetConstantBuffer(InBuffer, InSlot, bInVS, bInPS);
+	}
+
+	// 업로드 링(동적 상수 버퍼)을 매핑해 InOffset 위치의 쓰기 포인터를 반환 (bInDiscard면 WRITE_DISCARD, 아니면 NO_OVERWRITE)
+	// InSize는 이번 매핑에서 쓸 바이트 수로, 통계와 기록 백엔드의 임시 메모리 크기에만 쓰임
+	uint8* MapUploadBuffer(ID3D11Buffer* InBuffer, uint32 InOffset, uint32 InSize, bool bInDiscard)
+	{
+		++Stats.ConstantBufferUpdates;
+		Stats.ConstantBufferBytes += InSize;
+		return ExecuteMapUploadBuffer(InBuffer, InOffset, InSize, bInDiscard);
+	}
+	void UnmapUploadBuffer(ID3D11Buffer* InBuffer) { ExecuteUnmapUploadBuffer(InBuffer); }
+
+	// 상수 버퍼의 [InOffset, InOffset + InSize) 구간만 바인딩 (D3D11.1 *SetConstantBuffers1, 오프셋은 256바이트 정렬)
+	void SetConstantBufferRange(ID3D11Buffer* InBuffer, uint32 InSlot, uint32 InOffset, uint32 InSize, bool bInVS, bool bInPS)
+	{
+		Stats.ConstantBufferBinds += (bInVS ? 1 : 0) + (bInPS ? 1 : 0);
+		ExecuteSetConstantBufferRange(InBuffer, InSlot, InOffset, InSize, bInVS, bInPS);
+	}
+
+	void SetRasterizerState(ID3D11RasterizerState* InState) { ++Stats.PipelineStateChanges; ExecuteSetRasterizerState(InState); }
+	void SetBlendState(ID3D11BlendState* InState, const float InBlendFactor[4], uint32 InSampleMask)
+	{
+		++Stats.PipelineStateChanges;
+		ExecuteSetBlendState(InState, InBlendFactor, InSampleMask);
+	}
+	void SetDepthStencilState(ID3D11DepthStencilState* InState, uint32 InStencilRef)
+	{
+		++Stats.PipelineStateChanges;
+		ExecuteSetDepthStencilState(InState, InStencilRef);
+	}
+	void SetRenderTargets(uint32 InCount, ID3D11RenderTargetView* const* InRTVs, ID3D11DepthStencilView* InDSV)
+	{
+		++Stats.RenderTargetChanges;
+		ExecuteSetRenderTargets(InCount, InRTVs, InDSV);
+	}
+
+	void Draw(uint32 InVertexCount, uint32 InStartVertex)
+	{
+		++Stats.DrawCalls;
+		Stats.IndexCount += InVertexCount;
+		ExecuteDraw(InVertexCount, InStartVertex);
+	}
+	void DrawIndexed(uint32 InIndexCount, uint32 InStartIndex, int32 InBaseVertex)
+	{
+		++Stats.DrawCalls;
+		Stats.IndexCount += InIndexCount;
+		ExecuteDrawIndexed(InIndexCount, InStartIndex, InBaseVertex);
+	}
+
+	// 프레임 경계: 현재 통계를 LastFrameStats로 옮기고 0으로 초기화
+	void EndFrame()
+	{
+		LastFrameStats = Stats;
+		Stats = FRHICommandStats();
+	}
+	void ResetStats() { Stats = FRHICommandStats(); }
+
+	const FRHICommandStats& GetStats() const { return Stats; }
+	const FRHICommandStats& GetLastFrameStats() const { return LastFrameStats; }
+
+protected:
+	virtual void ExecuteSetInputLayout(ID3D11InputLayout* InInputLayout) = 0;
+	virtual void ExecuteSetVertexShader(ID3D11VertexShader* InShader) = 0;
+	virtual void ExecuteSetPixelShader(ID3D11PixelShader* InShader) = 0;
+	virtual void ExecuteSetVertexBuffer(ID3D11Buffer* InBuffer, uint32 InStride, uint32 InOffset) = 0;
+	virtual void ExecuteSetIndexBuffer(ID3D11Buffer* InBuffer, DXGI_FORMAT InFormat, uint32 InOffset) = 0;
+	virtual void ExecuteSetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology) = 0;
+	virtual void ExecuteSetPSShaderResources(uint32 InStartSlot, uint32 InCount, ID3D11ShaderResourceView* const* InViews) = 0;
+	virtual void ExecuteSetVSShaderResources(uint32 InStartSlot, uint32 InCount, ID3D11ShaderResourceView* const* InViews) = 0;
+	virtual void ExecuteSetPSSamplers(uint32 InStartSlot, uint32 InCount, ID3D11SamplerState* const* InSamplers) = 0;
+	virtual void ExecuteUpdateConstantBuffer(ID3D11Buffer* InBuffer, const void* InData, uint32 InSize) = 0;
+	virtual void ExecuteSetConstantBuffer(ID3D11Buffer* InBuffer, uint32 InSlot, bool bInVS, bool bInPS) = 0;
+	virtual uint8* ExecuteMapUploadBuffer(ID3D11Buffer* InBuffer, uint32 InOffset, uint32 InSize, bool bInDiscard) = 0;
+	virtual void ExecuteUnmapUploadBuffer(ID3D11Buffer* InBuffer) = 0;
+	virtual void ExecuteSetConstantBufferRange(ID3D11Buffer* InBuffer, uint32 InSlot, uint32 InOffset, uint32 InSize, bool bInVS, bool bInPS) = 0;
+	virtual void ExecuteSetRasterizerState(ID3D11RasterizerState* InState) = 0;
+	virtual void ExecuteSetBlendState(ID3D11BlendState* InState, const float InBlendFactor[4], uint32 InSampleMask) = 0;
+	virtual void ExecuteSetDepthStencilState(ID3D11DepthStencilState* InState, uint32 InStencilRef) = 0;
+	virtual void ExecuteSetRenderTargets(uint32 InCount, ID3D11RenderTargetView* const* InRTVs, ID3D11DepthStencilView* InDSV) = 0;
+	virtual void ExecuteDraw(uint32 InVertexCount, uint32 InStartVertex) = 0;
+	virtual void ExecuteDrawIndexed(uint32 InIndexCount, uint32 InStartIndex, int32 InBaseVertex) = 0;
+
+	FRHICommandStats Stats;
+	FRHICommandStats LastFrameStats;
+};
@@ -0,0 +1,39 @@
+﻿#include "pch.h"
+#include "RecordingCommandContext.h"
+
+uint32 FRecordingCommandContext::CountCommands(ERHICommandType InType) const
+{
+	uint32 Count = 0;
+	for (const FRHICommand& Command : Commands)
+	{
+		Count += (Command.Type == InType) ? 1 : 0;
+	}
+	return Count;
+}
+
+const char* FRecordingCommandContext::GetCommandName(ERHICommandType InType)
+{
+	switch (InType)
+	{
+	case ERHICommandType::SetInputLayout:			return "SetInputLayout";
+	case ERHICommandType::SetVertexShader:			return "SetVertexShader";
+	case ERHICommandType::SetPixelShader:			return "SetPixelShader";
+	case ERHICommandType::SetVertexBuffer:			return "SetVertexBuffer";
+	case ERHICommandType::SetIndexBuffer:			return "SetIndexBuffer";
+	case ERHICommandType::SetPrimitiveTopology:		return "SetPrimitiveTopology";
+	case ERHICommandType::SetPSShaderResources:		return "SetPSShaderResources";
+	case ERHICommandType::SetVSShaderResources:		return "SetVSShaderResources";
+	case ERHICommandType::SetPSSamplers:			return "SetPSSamplers";
+	case ERHICommandType::UpdateConstantBuffer:		return "UpdateConstantBuffer";
+	case ERHICommandType::SetConstantBuffer:		return "SetConstantBuffer";
+	case ERHICommandType::MapUploadBuffer:			return "MapUploadBuffer";
+	case ERHICommandType::SetConstantBufferRange:	return "SetConstantBufferRange";
+	case ERHICommandType::SetRasterizerState:		return "SetRasterizerState";
+	case ERHICommandType::SetBlendState:			return "SetBlendState";
+	case ERHICommandType::SetDepthStencilState:		return "SetDepthStencilState";
+	case ERHICommandType::SetRenderTargets:			return "SetRenderTargets";
+	case ERHICommandType::Draw:						return "Draw";
+	case ERHICommandType::DrawIndexed:				return "DrawIndexed";
+	default:										return "Unknown";
+	}
+}
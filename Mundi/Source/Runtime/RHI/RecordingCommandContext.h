@@ -0,0 +1,143 @@
+﻿#pragma once
+#include "RHICommandContext.h"
+
+enum class ERHICommandType : uint8
+{
+	SetInputLayout,
+	SetVertexShader,
+	SetPixelShader,
+	SetVertexBuffer,
+	SetIndexBuffer,
+	SetPrimitiveTopology,
+	SetPSShaderResources,
+	SetVSShaderResources,
+	SetPSSamplers,
+	UpdateConstantBuffer,
+	SetConstantBuffer,
+	MapUploadBuffer,
+	SetConstantBufferRange,
+	SetRasterizerState,
+	SetBlendState,
+	SetDepthStencilState,
+	SetRenderTargets,
+	Draw,
+	DrawIndexed,
+
+	Count
+};
+
+// 기록된 명령 하나 (리소스는 불투명 포인터, 인자 의미는 명령마다 다름)
+struct FRHICommand
+{
+	ERHICommandType Type = ERHICommandType::Draw;
+	const void* Resource = nullptr;
+	uint32 Arg0 = 0;
+	uint32 Arg1 = 0;
+	int32 Arg2 = 0;
+};
+
+/**
+ * GPU 없이 명령을 메모리에 기록만 하는 null 백엔드.
+ * D3D11RHI::InitializeNull()과 함께 쓰면 드로우 제출 경로를 디바이스 없이 돌려 CPU 비용/명령 수를 잴 수 있습니다.
+ * 상수 버퍼는 내용 없이 크기만 남깁니다.
+ */
+class FRecordingCommandContext : public IRHICommandContext
+{
+public:
+	// false면 명령 목록은 쌓지 않고 통계만 셈 (긴 벤치마크용)
+	void SetRecordCommands(bool bInRecord) { bRecordCommands = bInRecord; }
+
+	const TArray<FRHICommand>& GetCommands() const { return Commands; }
+	void ClearCommands() { Commands.clear(); }
+
+	// 명령 종류별 개수 (Commands 기준)
+	uint32 CountCommands(ERHICommandType InType) const;
+
+	static const char* GetCommandName(ERHICommandType InType);
+
+protected:
+	void ExecuteSetInputLayout(ID3D11InputLayout* InInputLayout) override { Record(ERHICommandType::SetInputLayout, InInputLayout); }
+	void ExecuteSetVertexShader(ID3D11VertexShader* InShader) override { Record(ERHICommandType::SetVertexShader, InShader); }
+	void ExecuteSetPixelShader(ID3D11PixelShader* InShader) override { Record(ERHICommandType::SetPixelShader, InShader); }
+	void ExecuteSetVertexBuffer(ID3D11Buffer* InBuffer, uint32 InStride, uint32 InOffset) override
+	{
+		Record(ERHICommandType::SetVertexBuffer, InBuffer, InStride, InOffset);
+	}
+	void ExecuteSetIndexBuffer(ID3D11Buffer* InBuffer, DXGI_FORMAT InFormat, uint32 InOffset) override
+	{
+		Record(ERHICommandType::SetIndexBuffer, InBuffer, static_cast<uint32>(InFormat), InOffset);
+	}
+	void ExecuteSetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology) override
+	{
+		Record(ERHICommandType::SetPrimitiveTopology, nullptr, static_cast<uint32>(InTopology));
+	}
+	void ExecuteSetPSShaderResources(uint32 InStartSlot, uint32 InCount, ID3D11ShaderResourceView* const* InViews) override
+	{
+		Record(ERHICommandType::SetPSShaderResources, InCount > 0 && InViews ? InViews[0] : nullptr, InStartSlot, InCount);
+	}
+	void ExecuteSetVSShaderResources(uint32 InStartSlot, uint32 InCount, ID3D11ShaderResourceView* const* InViews) override
+	{
+		Record(ERHICommandType::SetVSShaderResources, InCount > 0 && InViews ? InViews[0] : nullptr, InStartSlot, InCount);
+	}
+	void ExecuteSetPSSamplers(uint32 InStartSlot, uint32 InCount, ID3D11SamplerState* const* InSamplers) override
+	{
+		Record(ERHICommandType::SetPSSamplers, InCount > 0 && InSamplers ? InSamplers[0] : nullptr, InStartSlot, InCount);
+	}
+	void ExecuteUpdateConstantBuffer(ID3D11Buffer* InBuffer, const void* InData, uint32 InSize) override
+	{
+		Record(ERHICommandType::UpdateConstantBuffer, InBuffer, InSize);
+	}
+	void ExecuteSetConstantBuffer(ID3D11Buffer* InBuffer, uint32 InSlot, bool bInVS, bool bInPS) override
+	{
+		Record(ERHICommandType::SetConstantBuffer, InBuffer, InSlot, (bInVS ? 1 : 0) | (bInPS ? 2 : 0));
+	}
+	uint8* ExecuteMapUploadBuffer(ID3D11Buffer* InBuffer, uint32 InOffset, uint32 InSize, bool bInDiscard) override
+	{
+		// 쓰기 대상은 버리는 임시 메모리 (메모리 쓰기 비용은 실제와 같게 남김)
+		Record(ERHICommandType::MapUploadBuffer, InBuffer, InOffset, InSize, bInDiscard ? 1 : 0);
+		if (UploadScratch.Num() < static_cast<int32>(InSize))
+		{
+			UploadScratch.resize(InSize);
+		}
+		return UploadScratch.data();
+	}
+	void ExecuteUnmapUploadBuffer(ID3D11Buffer* InBuffer) override {}
+	void ExecuteSetConstantBufferRange(ID3D11Buffer* InBuffer, uint32 InSlot, uint32 InOffset, uint32 InSize, bool bInVS, bool bInPS) override
+	{
+		Record(ERHICommandType::SetConstantBufferRange, InBuffer, InSlot, InOffset, (bInVS ? 1 : 0) | (bInPS ? 2 : 0));
+	}
+	void ExecuteSetRasterizerState(ID3D11RasterizerState* InState) override { Record(ERHICommandType::SetRasterizerState, InState); }
+	void ExecuteSetBlendState(ID3D11BlendState* InState, const float InBlendFactor[4], uint32 InSampleMask) override
+	{
+		Record(ERHICommandType::SetBlendState, InState, InSampleMask);
+	}
+	void ExecuteSetDepthStencilState(ID3D11DepthStencilState* InState, uint32 InStencilRef) override
+	{
+		Record(ERHICommandType::SetDepthStencilState, InState, InStencilRef);
+	}
+	void ExecuteSetRenderTargets(uint32 InCount, ID3D11RenderTargetView* const* InRTVs, ID3D11DepthStencilView* InDSV) override
+	{
+		Record(ERHICommandType::SetRenderTargets, InDSV, InCount);
+	}
+	void ExecuteDraw(uint32 InVertexCount, uint32 InStartVertex) override
+	{
+		Record(ERHICommandType::Draw, nullptr, InVertexCount, InStartVertex);
+	}
+	void ExecuteDrawIndexed(uint32 InIndexCount, uint32 InStartIndex, int32 InBaseVertex) override
+	{
+		Record(ERHICommandType::DrawIndexed, nullptr, InIndexCount, InStartIndex, InBaseVertex);
+	}
+
+private:
+	void Record(ERHICommandType InType, const void* InResource, uint32 InArg0 = 0, uint32 InArg1 = 0, int32 InArg2 = 0)
+	{
+		if (bRecordCommands)
+		{
+			Commands.push_back(FRHICommand{ InType, InResource, InArg0, InArg1, InArg2 });
+		}
+	}
+
+	TArray<FRHICommand> Commands;
+	TArray<uint8> UploadScratch;
+	bool bRecordCommands = true;
+};
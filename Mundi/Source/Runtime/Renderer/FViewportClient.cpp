@@ -11,12 +11,24 @@
 #include "RenderSettings.h"
 #include "EditorEngine.h"
 #include "PrimitiveComponent.h"
+#include "StaticMeshComponent.h"
 #include "Clipboard/ClipboardManager.h"
 #include "InputManager.h"
 #include "USlateManager.h"
 
 FVector FViewportClient::CameraAddPosition{};
 
+namespace
+{
+	// 이 거리(픽셀) 이상 끌어야 클릭이 아닌 마키 선택으로 본다
+	constexpr float MarqueeDragThreshold = 4.0f;
+
+	float GetPickingAspectRatio(const FVector2D& ViewportSize)
+	{
+		return ViewportSize.Y == 0 ? 1.0f : ViewportSize.X / ViewportSize.Y;
+	}
+}
+
 FViewportClient::FViewportClient()
 {
 	ViewportType = EViewportType::Perspective;
@@ -141,6 +153,34 @@ void FViewportClient::Draw(FViewport* Viewport)
 	if (!Viewport || !World) return;
 
 	// 1. 뷰 타입에 따라 카메라 설정 등 사전 작업을 먼저 수행
+	PrepareCamera();
+
+	// 2. 렌더링 호출은 뷰 타입 설정이 모두 끝난 후 마지막에 한 번만 수행
+	URenderer* Renderer = URenderManager::GetInstance().GetRenderer();
+	if (Renderer)
+	{
+		World->GetRenderSettings().SetViewModeIndex(ViewModeIndex);
+
+		// 더 명확한 이름의 함수를 호출
+		Renderer->RenderSceneForView(World, Camera, Viewport);
+	}
+}
+
+void FViewportClient::AddToViewFamily(FViewport* Viewport)
+{
+	if (!Viewport || !World) return;
+
+	PrepareCamera();
+
+	URenderer* Renderer = URenderManager::GetInstance().GetRenderer();
+	if (Renderer)
+	{
+		Renderer->AddViewToFamily(World, Camera, Viewport, ViewModeIndex);
+	}
+}
+
+void FViewportClient::PrepareCamera()
+{
 	switch (ViewportType)
 	{
 	case EViewportType::Perspective:
@@ -155,16 +195,6 @@ void FViewportClient::Draw(FViewport* Viewport)
 		break;
 	}
 	}
-
-	// 2. 렌더링 호출은 뷰 타입 설정이 모두 끝난 후 마지막에 한 번만 수행
-	URenderer* Renderer = URenderManager::GetInstance().GetRenderer();
-	if (Renderer)
-	{
-		World->GetRenderSettings().SetViewModeIndex(ViewModeIndex);
-
-		// 더 명확한 이름의 함수를 호출
-		Renderer->RenderSceneForView(World, Camera, Viewport);
-	}
 }
 
 void FViewportClient::SetupCameraMode()
@@ -222,6 +252,22 @@ void FViewportClient::SetupCameraMode()
 
 void FViewportClient::MouseMove(FViewport* Viewport, int32 X, int32 Y)
 {
+	// 마키 선택 중에는 기즈모 위를 지나가도 드래그가 시작되지 않도록 기즈모 처리를 건너뜀
+	if (bIsMarqueeCandidate && bIsMouseButtonDown)
+	{
+		MarqueeEnd = FVector2D(static_cast<float>(X + Viewport->GetStartX()), static_cast<float>(Y + Viewport->GetStartY()));
+		if (!bIsMarqueeSelecting &&
+			(std::abs(MarqueeEnd.X - MarqueeStart.X) >= MarqueeDragThreshold || std::abs(MarqueeEnd.Y - MarqueeStart.Y) >= MarqueeDragThreshold))
+		{
+			bIsMarqueeSelecting = true;
+		}
+		if (bIsMarqueeSelecting)
+		{
+			UpdateMarqueeHover(Viewport);
+		}
+		return;
+	}
+
 	if (World->GetGizmoActor())
 		World->GetGizmoActor()->ProcessGizmoInteraction(Camera, Viewport, static_cast<float>(X), static_cast<float>(Y));
 
@@ -276,7 +322,6 @@ void FViewportClient::MouseButtonDown(FViewport* Viewport, int32 X, int32 Y, int
 	// X, Y are already local coordinates within the viewport, convert to global coordinates for picking
 	FVector2D ViewportMousePos(static_cast<float>(X) + ViewportOffset.X, static_cast<float>(Y) + ViewportOffset.Y);
 	UPrimitiveComponent* PickedComponent = nullptr;
-	TArray<AActor*> AllActors = World->GetActors();
 	if (Button == 0)
 	{
 		if (!World->GetGizmoActor())
@@ -284,15 +329,22 @@ void FViewportClient::MouseButtonDown(FViewport* Viewport, int32 X, int32 Y, int
 
 		bIsMouseButtonDown = true;
 		// 뷰포트의 실제 aspect ratio 계산
-		float PickingAspectRatio = ViewportSize.X / ViewportSize.Y;
-		if (ViewportSize.Y == 0) PickingAspectRatio = 1.0f; // 0으로 나누기 방지
+		const float PickingAspectRatio = GetPickingAspectRatio(ViewportSize);
 		if (World->GetGizmoActor()->GetbIsHovering())
 		{
 			return;
 		}
 		Camera->SetWorld(World);
-		PickedComponent = URenderManager::GetInstance().GetRenderer()->GetPrimitiveCollided(static_cast<int>(ViewportMousePos.X), static_cast<int>(ViewportMousePos.Y));
-		// PickedActor = CPickingSystem::PerformViewportPicking(AllActors, Camera, ViewportMousePos, ViewportSize, ViewportOffset, PickingAspectRatio,  Viewport);
+
+		// 끌면 마키 선택으로 전환 (MouseMove)
+		bIsMarqueeCandidate = true;
+		bIsMarqueeSelecting = false;
+		MarqueeStart = ViewportMousePos;
+		MarqueeEnd = ViewportMousePos;
+		MarqueeHoveredComponents.Empty();
+
+		// CPU 피킹 (월드 BVH -> 메시 BVH): GPU ID 버퍼 리드백처럼 파이프라인을 멈추지 않음
+		PickedComponent = CPickingSystem::PerformViewportComponentPicking(Camera, ViewportMousePos, ViewportSize, ViewportOffset, PickingAspectRatio, Viewport);
 
 
 		if (PickedComponent)
@@ -322,6 +374,15 @@ void FViewportClient::MouseButtonUp(FViewport* Viewport, int32 X, int32 Y, int32
 	{
 		bIsMouseButtonDown = false;
 
+		if (bIsMarqueeSelecting)
+		{
+			MarqueeEnd = FVector2D(static_cast<float>(X + Viewport->GetStartX()), static_cast<float>(Y + Viewport->GetStartY()));
+			FinishMarqueeSelection(Viewport);
+		}
+		bIsMarqueeCandidate = false;
+		bIsMarqueeSelecting = false;
+		MarqueeHoveredComponents.Empty();
+
 		// 드래그 종료 처리를 위해 한번 더 호출
 		if (World->GetGizmoActor())
 		{
@@ -335,6 +396,44 @@ void FViewportClient::MouseButtonUp(FViewport* Viewport, int32 X, int32 Y, int32
 	}
 }
 
+void FViewportClient::UpdateMarqueeHover(FViewport* Viewport)
+{
+	if (!Viewport || !World || !Camera) return;
+
+	const FVector2D ViewportSize(static_cast<float>(Viewport->GetSizeX()), static_cast<float>(Viewport->GetSizeY()));
+	const FVector2D ViewportOffset(static_cast<float>(Viewport->GetStartX()), static_cast<float>(Viewport->GetStartY()));
+
+	CPickingSystem::PerformViewportMarqueePicking(Camera, MarqueeStart, MarqueeEnd, ViewportSize, ViewportOffset,
+		GetPickingAspectRatio(ViewportSize), Viewport, MarqueeHoveredComponents);
+}
+
+void FViewportClient::FinishMarqueeSelection(FViewport* Viewport)
+{
+	UpdateMarqueeHover(Viewport);
+
+	USelectionManager* SelectionManager = World ? World->GetSelectionManager() : nullptr;
+	if (!SelectionManager) return;
+
+	TArray<AActor*> Actors;
+	Actors.Reserve(MarqueeHoveredComponents.Num());
+	for (UStaticMeshComponent* Component : MarqueeHoveredComponents)
+	{
+		if (AActor* Owner = Component->GetOwner())
+		{
+			Actors.Add(Owner);
+		}
+	}
+
+	if (Actors.IsEmpty())
+	{
+		SelectionManager->ClearSelection();
+	}
+	else
+	{
+		SelectionManager->SelectActors(Actors);
+	}
+}
+
 void FViewportClient::MouseWheel(float DeltaSeconds)
 {
 	if (!Camera) return;
@@ -5,6 +5,7 @@
 class FViewport;
 class UWorld;
 class UCameraComponent;
+class UStaticMeshComponent;
 
 
 /**
@@ -18,6 +19,9 @@ public:
 
     // 렌더링
     virtual void Draw(FViewport* Viewport);
+
+    // 이번 프레임 뷰를 렌더러의 뷰 패밀리에 미리 등록 (모든 뷰포트가 Draw 전에 호출하면 월드 단위 작업을 한 번만 함)
+    void AddToViewFamily(FViewport* Viewport);
     virtual void Tick(float DeltaTime);
 
     // 입력 처리
@@ -48,6 +52,9 @@ public:
 
     // 뷰포트별 카메라 설정
     void SetupCameraMode();
+
+    // 뷰 타입에 맞게 카메라 투영 모드/위치를 맞춤 (Draw, AddToViewFamily 공용)
+    void PrepareCamera();
     void SetViewModeIndex(EViewModeIndex InViewModeIndex) { ViewModeIndex = InViewModeIndex; }
 
     EViewModeIndex GetViewModeIndex() { return ViewModeIndex;}
@@ -58,7 +65,20 @@ public:
     bool IsPiloting() const { return bIsPiloting; }
     AActor* GetPilotActor() const { return PilotTargetActor; }
 
+    // ========== 마키(사각형) 선택 ==========
+    // 좌클릭 드래그 중인지, 사각형 (전역 마우스 좌표), 사각형에 현재 걸친 컴포넌트(호버 미리보기)
+    bool IsMarqueeSelecting() const { return bIsMarqueeSelecting; }
+    const FVector2D& GetMarqueeStart() const { return MarqueeStart; }
+    const FVector2D& GetMarqueeEnd() const { return MarqueeEnd; }
+    const TArray<UStaticMeshComponent*>& GetMarqueeHoveredComponents() const { return MarqueeHoveredComponents; }
+
 protected:
+    // 사각형 안을 레이 패킷으로 훑어 MarqueeHoveredComponents 갱신
+    void UpdateMarqueeHover(FViewport* Viewport);
+    // 마우스를 놓을 때 호버 중이던 컴포넌트의 액터들을 선택
+    void FinishMarqueeSelection(FViewport* Viewport);
+
+
     EViewportType ViewportType = EViewportType::Perspective;
     UWorld* World = nullptr;
     ACameraActor* Camera = nullptr;
@@ -67,6 +87,13 @@ protected:
     bool bIsMouseButtonDown = false;
     bool bIsMouseRightButtonDown = false;
     bool bIsActive = false;  // 뷰포트 활성화 상태
+
+    // 마키 선택 상태 (기즈모가 아닌 곳에서 좌클릭하면 후보, 일정 거리 이상 끌면 선택 시작)
+    bool bIsMarqueeCandidate = false;
+    bool bIsMarqueeSelecting = false;
+    FVector2D MarqueeStart;
+    FVector2D MarqueeEnd;
+    TArray<UStaticMeshComponent*> MarqueeHoveredComponents;
     static FVector CameraAddPosition;
 
 
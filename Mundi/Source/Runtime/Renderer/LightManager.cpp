@@ -64,24 +64,6 @@ void FLightManager::UpdateLightBuffer(D3D11RHI* RHIDevice)
 
 		FLightBufferType LightBuffer{};
 
-		if (AmbientLightList.Num() > 0)
-		{
-			if (AmbientLightList[0]->IsVisible()&&
-				AmbientLightList[0]->GetOwner()->IsActorVisible())
-			{
-				LightBuffer.AmbientLight = AmbientLightList[0]->GetLightInfo();
-			}
-		}
-
-		if (DIrectionalLightList.Num() > 0)
-		{
-			if (DIrectionalLightList[0]->IsVisible() &&
-				DIrectionalLightList[0]->GetOwner()->IsActorVisible())
-			{
-				LightBuffer.DirectionalLight = DIrectionalLightList[0]->GetLightInfo();
-			}
-		}
-
 
 		if (bPointLightDirty)
 		{
@@ -116,23 +98,65 @@ void FLightManager::UpdateLightBuffer(D3D11RHI* RHIDevice)
 			bSpotLightDirty = false;
 		}
 
-		LightBuffer.PointLightCount = PointLightNum;
-		LightBuffer.SpotLightCount = SpotLightNum;
-
-		//슬롯 재활용 하고싶을 시 if문 밖으로 빼서 매 프레임 세팅 해줘야함.
-		RHIDevice->SetAndUpdateConstantBuffer(LightBuffer);
-	
-		ID3D11ShaderResourceView* SRVList[2]{ PointLightBufferSRV, SpotLightBufferSRV };
+		BuildLightConstants(LightBuffer);
+		RHIDevice->UpdateConstantBuffer(LightBuffer);
 
-		//Gouraud shader 사용 여부로 아래 세팅 분기도 가능, 일단 둘다 바인딩함
-		RHIDevice->GetDeviceContext()->PSSetShaderResources(3, 2, SRVList);
-		RHIDevice->GetDeviceContext()->VSSetShaderResources(3, 2, SRVList);
+		//슬롯 재활용 하고싶을 시 매 프레임 BindLightBuffer로 다시 세팅 해줘야함.
+		BindLightBuffer(RHIDevice);
 
 		bHaveToUpdate = false;
 	}
 	
 }
 
+void FLightManager::UpdateViewLightBuffer(D3D11RHI* RHIDevice)
+{
+	// 방향광 CSM 행렬은 이 뷰의 섀도우 패스에서 다시 계산되므로 b8을 새로 채워 올림.
+	// 스팟/포인트 구조체 버퍼는 프레임 첫 뷰에서 올린 것을 그대로 바인딩
+	FLightBufferType LightBuffer{};
+	BuildLightConstants(LightBuffer);
+	RHIDevice->UpdateConstantBuffer(LightBuffer);
+	BindLightBuffer(RHIDevice);
+}
+
+void FLightManager::BuildLightConstants(FLightBufferType& OutLightBuffer) const
+{
+	if (AmbientLightList.Num() > 0)
+	{
+		if (AmbientLightList[0]->IsVisible()&&
+			AmbientLightList[0]->GetOwner()->IsActorVisible())
+		{
+			OutLightBuffer.AmbientLight = AmbientLightList[0]->GetLightInfo();
+		}
+	}
+
+	if (DIrectionalLightList.Num() > 0)
+	{
+		if (DIrectionalLightList[0]->IsVisible() &&
+			DIrectionalLightList[0]->GetOwner()->IsActorVisible())
+		{
+			OutLightBuffer.DirectionalLight = DIrectionalLightList[0]->GetLightInfo();
+		}
+	}
+
+	OutLightBuffer.PointLightCount = PointLightNum;
+	OutLightBuffer.SpotLightCount = SpotLightNum;
+}
+
+void FLightManager::BindLightBuffer(D3D11RHI* RHIDevice)
+{
+	// 상수 버퍼(b8)와 구조체 버퍼 SRV(t3, t4)는 마지막 UpdateLightBuffer 내용 그대로 바인딩만 함
+	// (SetConstantBuffer는 데이터를 쓰지 않고 슬롯에 버퍼만 연결)
+	RHIDevice->SetConstantBuffer(FLightBufferType{});
+
+	ID3D11ShaderResourceView* SRVList[2]{ PointLightBufferSRV, SpotLightBufferSRV };
+
+	//Gouraud shader 사용 여부로 아래 세팅 분기도 가능, 일단 둘다 바인딩함
+	IRHICommandContext& CommandContext = RHIDevice->GetCommandContext();
+	CommandContext.SetPSShaderResources(3, 2, SRVList);
+	CommandContext.SetVSShaderResources(3, 2, SRVList);
+}
+
 void FLightManager::SetDirtyFlag()
 {
 	bHaveToUpdate = true;
@@ -7,6 +7,7 @@ class USpotLightComponent;
 class ULightComponent;
 class D3D11RHI;
 class FShadowMap;
+struct FLightBufferType;
 class USceneComponent;
 
 struct FVector2;
@@ -83,7 +84,8 @@ struct FSpotLightInfo
     uint32 ShadowMapIndex;      // 4 bytes - index to shadow map array (-1 if no shadow)
     FVector Padding;            // 4 bytes - padding
     FMatrix LightViewProjection; // 64 bytes - Light space transformation matrix
-	// Total: 144 bytes
+    FVector4 ShadowAtlasScaleOffset; // 16 bytes - shadow atlas tile (uv * xy + zw)
+	// Total: 160 bytes
 };
 
 class FLightManager
@@ -97,6 +99,10 @@ public:
     void Release();
 
     void UpdateLightBuffer(D3D11RHI* RHIDevice);
+    // 같은 프레임의 다음 뷰: 방향광(CSM 행렬)은 뷰마다 섀도우를 다시 그리므로 b8만 다시 올리고 스팟/포인트 구조체 버퍼는 재사용
+    void UpdateViewLightBuffer(D3D11RHI* RHIDevice);
+    // 라이트 상수 버퍼/구조체 버퍼를 다시 만들지 않고 기존 CB/SRV만 바인딩
+    void BindLightBuffer(D3D11RHI* RHIDevice);
     void SetDirtyFlag();
 
     TArray<FPointLightInfo>& GetPointLightInfoList() { return PointLightInfoList; }
@@ -111,6 +117,9 @@ public:
 
     void ClearAllLightList();
 private:
+    // 앰비언트/방향광/개수로 b8 내용을 채움 (구조체 버퍼는 건드리지 않음)
+    void BuildLightConstants(FLightBufferType& OutLightBuffer) const;
+
     bool bHaveToUpdate = true;
     bool bPointLightDirty = true;
     bool bSpotLightDirty = true;
@@ -0,0 +1,72 @@
+﻿#include "pch.h"
+#include "LightManager.h"
+#include "D3D11RHI.h"
+#include "RecordingCommandContext.h"
+#include "SelfTest.h"
+
+namespace
+{
+	// 기록된 명령 중 InType이면서 Arg0(슬롯)이 InSlot인 것의 개수
+	uint32 CountCommandsAtSlot(const FRecordingCommandContext& InContext, ERHICommandType InType, uint32 InSlot)
+	{
+		uint32 Count = 0;
+		for (const FRHICommand& Command : InContext.GetCommands())
+		{
+			Count += (Command.Type == InType && Command.Arg0 == InSlot) ? 1 : 0;
+		}
+		return Count;
+	}
+}
+
+IMPLEMENT_SELF_TEST(LightManager, BindLightBufferOnlyRebinds)
+{
+	FRecordingCommandContext RecordingContext;
+	D3D11RHI NullRHI;
+	NullRHI.InitializeNull(&RecordingContext);
+	FLightManager LightManager;
+
+	// 첫 뷰: 라이트 상수 버퍼를 갱신하고 b8 + t3/t4를 바인딩
+	LightManager.SetDirtyFlag();
+	LightManager.UpdateLightBuffer(&NullRHI);
+	SELF_TEST_CHECK(RecordingContext.CountCommands(ERHICommandType::UpdateConstantBuffer) == 1);
+	SELF_TEST_CHECK(CountCommandsAtSlot(RecordingContext, ERHICommandType::SetConstantBuffer, FLightBufferTypeSlot) == 1);
+	SELF_TEST_CHECK(CountCommandsAtSlot(RecordingContext, ERHICommandType::SetPSShaderResources, 3) == 1);
+	SELF_TEST_CHECK(CountCommandsAtSlot(RecordingContext, ERHICommandType::SetVSShaderResources, 3) == 1);
+
+	// 쿼드 뷰의 나머지 뷰: 다시 만들지 않고 같은 슬롯에 바인딩만
+	RecordingContext.ClearCommands();
+	RecordingContext.ResetStats();
+	const uint32 LaterViewCount = 3;
+	for (uint32 View = 0; View < LaterViewCount; ++View)
+	{
+		LightManager.BindLightBuffer(&NullRHI);
+	}
+	Test.AddInfo("%d commands for %u rebinds", RecordingContext.GetCommands().Num(), LaterViewCount);
+	SELF_TEST_CHECK(RecordingContext.GetStats().ConstantBufferUpdates == 0);
+	SELF_TEST_CHECK(RecordingContext.CountCommands(ERHICommandType::UpdateConstantBuffer) == 0);
+	SELF_TEST_CHECK(RecordingContext.CountCommands(ERHICommandType::MapUploadBuffer) == 0);
+	SELF_TEST_CHECK(CountCommandsAtSlot(RecordingContext, ERHICommandType::SetConstantBuffer, FLightBufferTypeSlot) == LaterViewCount);
+	SELF_TEST_CHECK(CountCommandsAtSlot(RecordingContext, ERHICommandType::SetPSShaderResources, 3) == LaterViewCount);
+	SELF_TEST_CHECK(CountCommandsAtSlot(RecordingContext, ERHICommandType::SetVSShaderResources, 3) == LaterViewCount);
+	SELF_TEST_CHECK(RecordingContext.GetCommands().Num() == static_cast<int32>(LaterViewCount * 3));
+
+	// 뷰별 갱신: 방향광 캐스케이드 행렬이 담긴 b8만 뷰마다 다시 올리고 구조체 버퍼 SRV는 재사용
+	RecordingContext.ClearCommands();
+	RecordingContext.ResetStats();
+	for (uint32 View = 0; View < LaterViewCount; ++View)
+	{
+		LightManager.UpdateViewLightBuffer(&NullRHI);
+	}
+	SELF_TEST_CHECK(RecordingContext.GetStats().ConstantBufferUpdates == LaterViewCount);
+	SELF_TEST_CHECK(RecordingContext.GetStats().ConstantBufferBytes == LaterViewCount * sizeof(FLightBufferType));
+	SELF_TEST_CHECK(CountCommandsAtSlot(RecordingContext, ERHICommandType::SetConstantBuffer, FLightBufferTypeSlot) == LaterViewCount);
+	SELF_TEST_CHECK(CountCommandsAtSlot(RecordingContext, ERHICommandType::SetPSShaderResources, 3) == LaterViewCount);
+
+	// 바뀐 라이트가 없으면 UpdateLightBuffer도 아무 명령을 내지 않음
+	RecordingContext.ClearCommands();
+	LightManager.UpdateLightBuffer(&NullRHI);
+	SELF_TEST_CHECK(RecordingContext.GetCommands().IsEmpty());
+
+	LightManager.Release();
+	NullRHI.Release();
+}
@@ -44,6 +44,9 @@ struct FMeshBatchElement
 	// 정점 버퍼의 스트라이드(Stride)입니다. (정점 1개의 크기)
 	uint32 VertexStride = 0;
 
+	// 정점 버퍼가 패킹 포맷이면 EPackedVertexFlags, 아니면 0입니다. (셰이더를 덮어쓰는 패스가 Variant 선택에 사용)
+	uint8 PackedVertexFlags = 0;
+
 
 	// --- 3. 인스턴스 데이터 (Instance Data) ---
 	// 드로우 콜마다 고유하게 설정되는 데이터입니다. (정렬 키가 아님)
@@ -51,9 +54,16 @@ struct FMeshBatchElement
 	// 이 오브젝트의 월드 변환 행렬입니다. (Model Matrix)
 	FMatrix WorldMatrix;
 
+	// WorldMatrix의 역전치 (법선 변환용)를 프리미티브가 캐시해 둔 것입니다. 없으면 제출 시 계산합니다.
+	const FMatrix* NormalMatrix = nullptr;
+
 	// 피킹(Picking) 등에 사용될 고유 ID입니다.
 	uint32 ObjectID = 0;
 
+	// 양자화된 위치의 역양자화 파라미터입니다. (ModelBuffer로 전달, 기본값은 항등)
+	FVector4 PositionDequantScale = FVector4(1.0f, 1.0f, 1.0f, 0.0f);
+	FVector4 PositionDequantBias = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
+
 	// 빌보드나 데칼처럼 머티리얼이 아닌 컴포넌트 인스턴스가
 	// 직접 텍스처를 지정해야 할 때 사용합니다.
 	ID3D11ShaderResourceView* InstanceShaderResourceView = nullptr;
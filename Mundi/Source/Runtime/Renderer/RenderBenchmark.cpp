@@ -0,0 +1,239 @@
+﻿#include "pch.h"
+#include "RenderBenchmark.h"
+#include "RecordingCommandContext.h"
+#include "SceneRenderer.h"
+#include "MeshBatchElement.h"
+#include "Material.h"
+#include "PlatformTime.h"
+#include "PathUtils.h"
+#include <algorithm>
+#include <fstream>
+
+namespace
+{
+	constexpr uint32 ShaderCount = 3;		// 셰이딩 모델 수 정도
+	constexpr uint32 MaterialCount = 48;
+	constexpr uint32 MeshCount = 64;
+
+	// 합성 오브젝트 (스태틱 메시 컴포넌트 한 섹션에 해당)
+	struct FSyntheticObject
+	{
+		FVector Location;
+		float Scale = 1.0f;
+		uint32 MeshIndex = 0;
+		uint32 MaterialIndex = 0;
+		uint32 IndexCount = 0;
+		bool bMoving = false;
+		FMatrix NormalMatrix;		// 정지 오브젝트는 프리미티브처럼 캐시된 법선 행렬을 넘김
+	};
+
+	void AddStats(FRHICommandStats& InOutTotal, const FRHICommandStats& InStats)
+	{
+		InOutTotal.DrawCalls += InStats.DrawCalls;
+		InOutTotal.IndexCount += InStats.IndexCount;
+		InOutTotal.ShaderChanges += InStats.ShaderChanges;
+		InOutTotal.VertexBufferBinds += InStats.VertexBufferBinds;
+		InOutTotal.IndexBufferBinds += InStats.IndexBufferBinds;
+		InOutTotal.TopologyChanges += InStats.TopologyChanges;
+		InOutTotal.ShaderResourceBinds += InStats.ShaderResourceBinds;
+		InOutTotal.SamplerBinds += InStats.SamplerBinds;
+		InOutTotal.ConstantBufferUpdates += InStats.ConstantBufferUpdates;
+		InOutTotal.ConstantBufferBytes += InStats.ConstantBufferBytes;
+		InOutTotal.ConstantBufferBinds += InStats.ConstantBufferBinds;
+		InOutTotal.PipelineStateChanges += InStats.PipelineStateChanges;
+		InOutTotal.RenderTargetChanges += InStats.RenderTargetChanges;
+	}
+
+	void EnsureParentDirectory(const FString& InPath)
+	{
+		const fs::path Path(UTF8ToWide(InPath));
+		if (Path.has_parent_path())
+		{
+			std::error_code Ec;
+			fs::create_directories(Path.parent_path(), Ec);
+		}
+	}
+}
+
+void FRenderBenchmark::Run(uint32 InObjectCount, uint32 InFrameCount, const FString& InOutputPath)
+{
+	if (InObjectCount == 0 || InFrameCount == 0)
+	{
+		return;
+	}
+
+	// null 모드 RHI: 모든 명령은 기록 컨텍스트로 (명령 목록은 첫 프레임만 남김)
+	FRecordingCommandContext RecordingContext;
+	D3D11RHI NullRHI;
+	NullRHI.InitializeNull(&RecordingContext);
+
+	// 디바이스 핸들 대신 쓰는 불투명 주소 (역참조되지 않음)
+	TArray<uint8> FakeHandles(ShaderCount * 3 + MeshCount * 2);
+	auto Handle = [&FakeHandles](uint32 InIndex) { return static_cast<void*>(&FakeHandles[InIndex]); };
+
+	TArray<UMaterial*> Materials;
+	for (uint32 i = 0; i < MaterialCount; ++i)
+	{
+		Materials.Add(NewObject<UMaterial>());
+	}
+
+	// 결정적 합성 월드 (LCG)
+	uint32 Seed = 0x1234567u;
+	auto NextRandom = [&Seed]() { Seed = Seed * 1664525u + 1013904223u; return Seed >> 8; };
+
+	TArray<FSyntheticObject> Objects(InObjectCount);
+	for (FSyntheticObject& Object : Objects)
+	{
+		Object.Location = FVector(static_cast<float>(NextRandom() % 2000), static_cast<float>(NextRandom() % 2000), static_cast<float>(NextRandom() % 100));
+		Object.Scale = 0.5f + static_cast<float>(NextRandom() % 100) / 50.0f;
+		Object.MeshIndex = NextRandom() % MeshCount;
+		Object.MaterialIndex = NextRandom() % MaterialCount;
+		Object.IndexCount = 36 + (Object.MeshIndex * 97) % 6000;
+		Object.bMoving = (NextRandom() % 10) == 0;
+		Object.NormalMatrix = (FMatrix::MakeScale(Object.Scale) * FMatrix::MakeTranslation(Object.Location)).InverseAffine().Transpose();
+	}
+
+	TArray<FMeshBatchElement> MeshBatchElements;
+	MeshBatchElements.reserve(InObjectCount);
+	FMeshSubmitScratch SubmitScratch;
+
+	auto CollectBatches = [&](uint32 InFrame)
+	{
+		MeshBatchElements.clear();
+		const float Time = static_cast<float>(InFrame) / 60.0f;
+		for (const FSyntheticObject& Object : Objects)
+		{
+			const uint32 ShaderIndex = Object.MaterialIndex % ShaderCount;
+			const FVector Location = Object.bMoving ? Object.Location + FVector(0.0f, 0.0f, std::sin(Time + Object.Location.X)) : Object.Location;
+
+			FMeshBatchElement BatchElement;
+			BatchElement.VertexShader = static_cast<ID3D11VertexShader*>(Handle(ShaderIndex * 3 + 0));
+			BatchElement.PixelShader = static_cast<ID3D11PixelShader*>(Handle(ShaderIndex * 3 + 1));
+			BatchElement.InputLayout = static_cast<ID3D11InputLayout*>(Handle(ShaderIndex * 3 + 2));
+			BatchElement.Material = Materials[Object.MaterialIndex];
+			BatchElement.VertexBuffer = static_cast<ID3D11Buffer*>(Handle(ShaderCount * 3 + Object.MeshIndex * 2 + 0));
+			BatchElement.IndexBuffer = static_cast<ID3D11Buffer*>(Handle(ShaderCount * 3 + Object.MeshIndex * 2 + 1));
+			BatchElement.VertexStride = 32;
+			BatchElement.IndexCount = Object.IndexCount;
+			BatchElement.WorldMatrix = FMatrix::MakeScale(Object.Scale) * FMatrix::MakeTranslation(Location);
+			BatchElement.NormalMatrix = Object.bMoving ? nullptr : &Object.NormalMatrix;
+			BatchElement.ObjectID = Object.MeshIndex;
+			MeshBatchElements.Add(BatchElement);
+		}
+	};
+
+	// 정렬 효과 비교용: 수집 순서 그대로 제출했을 때의 명령 수
+	RecordingContext.SetRecordCommands(false);
+	CollectBatches(0);
+	NullRHI.BeginUploadFrame();
+	FSceneRenderer::SubmitMeshBatches(&NullRHI, SubmitScratch, MeshBatchElements);
+	NullRHI.EndUploadFrame();
+	const FRHICommandStats UnsortedStats = RecordingContext.GetStats();
+	RecordingContext.ResetStats();
+
+	TArray<FRenderBenchmarkFrame> Frames;
+	Frames.reserve(InFrameCount);
+	uint32 RecordedCommandCount = 0;
+	for (uint32 Frame = 0; Frame < InFrameCount; ++Frame)
+	{
+		RecordingContext.SetRecordCommands(Frame == 0);
+		RecordingContext.ClearCommands();
+
+		FRenderBenchmarkFrame Timing;
+		uint64 Start = FPlatformTime::Cycles64();
+		CollectBatches(Frame);
+		uint64 End = FPlatformTime::Cycles64();
+		Timing.CollectMs = FPlatformTime::ToMilliseconds(End - Start);
+
+		Start = End;
+		MeshBatchElements.Sort();
+		End = FPlatformTime::Cycles64();
+		Timing.SortMs = FPlatformTime::ToMilliseconds(End - Start);
+
+		Start = End;
+		NullRHI.BeginUploadFrame();
+		FSceneRenderer::SubmitMeshBatches(&NullRHI, SubmitScratch, MeshBatchElements);
+		NullRHI.EndUploadFrame();
+		End = FPlatformTime::Cycles64();
+		Timing.SubmitMs = FPlatformTime::ToMilliseconds(End - Start);
+
+		RecordingContext.EndFrame();
+		Timing.Stats = RecordingContext.GetLastFrameStats();
+		if (Frame == 0)
+		{
+			RecordedCommandCount = static_cast<uint32>(RecordingContext.GetCommands().Num());
+		}
+		Frames.Add(Timing);
+	}
+
+	for (UMaterial* Material : Materials)
+	{
+		ObjectFactory::DeleteObject(Material);
+	}
+
+	double CollectMs = 0.0, SortMs = 0.0, SubmitMs = 0.0;
+	FRHICommandStats Total;
+	for (const FRenderBenchmarkFrame& Timing : Frames)
+	{
+		CollectMs += Timing.CollectMs;
+		SortMs += Timing.SortMs;
+		SubmitMs += Timing.SubmitMs;
+		AddStats(Total, Timing.Stats);
+	}
+	const double FrameCount = static_cast<double>(InFrameCount);
+
+	UE_LOG("[RHI Bench] %u objects x %u frames (null RHI, %u shaders / %u materials / %u meshes)",
+		InObjectCount, InFrameCount, ShaderCount, MaterialCount, MeshCount);
+	UE_LOG("[RHI Bench] CPU/frame: collect %.3f ms | sort %.3f ms | submit %.3f ms | total %.3f ms",
+		CollectMs / FrameCount, SortMs / FrameCount, SubmitMs / FrameCount, (CollectMs + SortMs + SubmitMs) / FrameCount);
+	UE_LOG("[RHI Bench] Per frame: %u draws | %u state changes (unsorted %u) | %u CB updates (%.1f KB) | %u commands recorded",
+		Total.DrawCalls / InFrameCount, Total.GetStateChangeCount() / InFrameCount, UnsortedStats.GetStateChangeCount(),
+		Total.ConstantBufferUpdates / InFrameCount, static_cast<double>(Total.ConstantBufferBytes) / FrameCount / 1024.0, RecordedCommandCount);
+	UE_LOG("[RHI Bench] Shader %u | VB %u | IB %u | SRV %u | Sampler %u | CB bind %u (per frame)",
+		Total.ShaderChanges / InFrameCount, Total.VertexBufferBinds / InFrameCount, Total.IndexBufferBinds / InFrameCount,
+		Total.ShaderResourceBinds / InFrameCount, Total.SamplerBinds / InFrameCount, Total.ConstantBufferBinds / InFrameCount);
+
+	if (!InOutputPath.empty())
+	{
+		if (WriteJson(InOutputPath, InObjectCount, UnsortedStats, Frames))
+		{
+			UE_LOG("[RHI Bench] Results written to '%s'", InOutputPath.c_str());
+		}
+		else
+		{
+			UE_LOG("[RHI Bench] Failed to write results to '%s'", InOutputPath.c_str());
+		}
+	}
+}
+
+bool FRenderBenchmark::WriteJson(const FString& InPath, uint32 InObjectCount, const FRHICommandStats& InUnsortedStats,
+	const TArray<FRenderBenchmarkFrame>& InFrames)
+{
+	EnsureParentDirectory(InPath);
+	std::ofstream Out(fs::path(UTF8ToWide(InPath)));
+	if (!Out.is_open())
+	{
+		UE_LOG("[RHI Bench] Failed to open '%s' for writing", InPath.c_str());
+		return false;
+	}
+
+	Out << "{\n  \"Objects\": " << InObjectCount
+		<< ",\n  \"UnsortedStateChanges\": " << InUnsortedStats.GetStateChangeCount()
+		<< ",\n  \"Frames\": [\n";
+
+	char Line[512];
+	for (int32 i = 0; i < InFrames.Num(); ++i)
+	{
+		const FRenderBenchmarkFrame& T = InFrames[i];
+		snprintf(Line, sizeof(Line),
+			"    {\"CollectMs\": %.4f, \"SortMs\": %.4f, \"SubmitMs\": %.4f, \"DrawCalls\": %u, \"StateChanges\": %u, "
+			"\"ShaderChanges\": %u, \"ConstantBufferUpdates\": %u, \"ConstantBufferBytes\": %llu}%s\n",
+			T.CollectMs, T.SortMs, T.SubmitMs, T.Stats.DrawCalls, T.Stats.GetStateChangeCount(),
+			T.Stats.ShaderChanges, T.Stats.ConstantBufferUpdates, static_cast<unsigned long long>(T.Stats.ConstantBufferBytes),
+			i + 1 < InFrames.Num() ? "," : "");
+		Out << Line;
+	}
+	Out << "  ]\n}\n";
+	Out.flush();
+	return static_cast<bool>(Out);
+}
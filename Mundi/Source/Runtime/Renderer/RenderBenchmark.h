@@ -0,0 +1,29 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "RHICommandContext.h"
+
+// 한 프레임의 렌더 CPU 비용 (ms)
+struct FRenderBenchmarkFrame
+{
+	double CollectMs = 0.0;		// 오브젝트 -> FMeshBatchElement
+	double SortMs = 0.0;
+	double SubmitMs = 0.0;		// FSceneRenderer::SubmitMeshBatches (기록 백엔드)
+	FRHICommandStats Stats;
+};
+
+/**
+ * GPU 없이 렌더러 제출 경로를 재는 헤드리스 벤치마크.
+ * null 모드 D3D11RHI + FRecordingCommandContext 위에서 합성 월드 (메시/머티리얼/셰이더 조합)의
+ * 배치 수집 -> 정렬 -> FSceneRenderer::SubmitMeshBatches를 프레임마다 반복하고,
+ * CPU 시간과 드로우/상태 변경/상수 버퍼 바이트 수를 보고합니다.
+ * 결과는 UE_LOG로 출력하고, InOutputPath가 있으면 JSON으로 저장해 시간에 따라 추적할 수 있습니다.
+ */
+class FRenderBenchmark
+{
+public:
+	static void Run(uint32 InObjectCount, uint32 InFrameCount = 120, const FString& InOutputPath = "");
+
+private:
+	static bool WriteJson(const FString& InPath, uint32 InObjectCount, const FRHICommandStats& InUnsortedStats,
+		const TArray<FRenderBenchmarkFrame>& InFrames);
+};
@@ -31,12 +31,23 @@
 #include "DecalStatManager.h"
 #include "SceneRenderer.h"
 #include "SceneView.h"
+#include "SceneViewFamily.h"
+#include "SpriteVertexStream.h"
 
 #include <Windows.h>
 
 URenderer::URenderer(D3D11RHI* InDevice) : RHIDevice(InDevice)
 {
 	InitializeLineBatch();
+
+	SpriteBatcher = std::make_unique<FSpriteBatcher>();
+	SpriteVertexStream = std::make_unique<FSpriteVertexStream>();
+	SpriteVertexStream->Initialize(RHIDevice);
+
+	OcclusionCulling = std::make_unique<FOcclusionCullingManagerCPU>();
+	OcclusionCulling->Initialize(FOcclusionSettings());
+
+	MeshSubmitScratch = std::make_unique<FMeshSubmitScratch>();
 }
 
 URenderer::~URenderer()
@@ -49,6 +60,11 @@ URenderer::~URenderer()
 
 void URenderer::BeginFrame()
 {
+	++FrameNumber;
+
+	// GPU가 끝낸 프레임의 업로드 링 구간 회수
+	RHIDevice->BeginUploadFrame();
+
 	RHIDevice->IASetPrimitiveTopology();
 
 	RHIDevice->OMSetRenderTargets(ERTVMode::BackBufferWithDepth);
@@ -56,12 +72,19 @@ void URenderer::BeginFrame()
 	// 프레임별 데칼 통계를 추적하기 위해 초기화
 	FDecalStatManager::GetInstance().ResetFrameStats();
 
+	ViewFamilies.Empty();
+
 	RHIDevice->ClearAllBuffer();
 }
 
 void URenderer::EndFrame()
 {
+	// 이번 프레임의 드로우/상태 변경 수를 LastFrameStats로 (RHI STATS)
+	RHIDevice->GetCommandContext().EndFrame();
+	RHIDevice->EndUploadFrame();
 	RHIDevice->Present();
+
+	ViewFamilies.Empty();
 }
 
 void URenderer::RenderSceneForView(UWorld* World, ACameraActor* Camera, FViewport* Viewport)
@@ -69,48 +92,43 @@ void URenderer::RenderSceneForView(UWorld* World, ACameraActor* Camera, FViewpor
 	// 1. 렌더에 필요한 정보를 모은 FSceneView를 생성합니다.
 	FSceneView View(Camera, Viewport, World->GetRenderSettings().GetViewModeIndex());	// NOTE: 현재 viewport에 해당하는 ViewMode가 적용되는지 확인 필요
 
-	// 2. FSceneRenderer 생성자에 'View'의 주소(&View)를 전달합니다.
-	FSceneRenderer SceneRenderer(World, &View, this);
+	// 2. FSceneRenderer 생성자에 'View'의 주소(&View)와 이번 프레임 월드 상태를 공유하는 뷰 패밀리를 전달합니다.
+	FSceneRenderer SceneRenderer(World, &View, &GetViewFamily(World), this);
 
 	// 3. 실제로 렌더를 수행합니다.
 	SceneRenderer.Render();
 }
 
-UPrimitiveComponent* URenderer::GetPrimitiveCollided(int MouseX, int MouseY) const
+void URenderer::AddViewToFamily(UWorld* InWorld, ACameraActor* InCamera, FViewport* InViewport, EViewModeIndex InViewMode)
+{
+	if (!InWorld || !InCamera || !InViewport)
+		return;
+
+	GetViewFamily(InWorld).AddView(FSceneView(InCamera, InViewport, InViewMode));
+}
+
+FSceneViewFamily& URenderer::GetViewFamily(UWorld* InWorld)
 {
-	//GPU와 동기화 문제 때문에 Map이 호출될때까지 기다려야해서 피킹 하는 프레임에 엄청난 프레임 드랍이 일어남.
-   //******비동기 방식으로 무조건 바꿔야함****************
-	uint32 PickedId = 0;
-
-	ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
-	//스테이징 버퍼를 가져와야 하는데 이걸 Device 추상 클래스가 Getter로 가지고 있는게 좋은 설계가 아닌 것 같아서 일단 캐스팅함
-
-
-	D3D11_BOX Box{};
-	Box.left = MouseX;
-	Box.right = MouseX + 1;
-	Box.top = MouseY;
-	Box.bottom = MouseY + 1;
-	Box.front = 0;
-	Box.back = 1;
-
-	DeviceContext->CopySubresourceRegion(
-		RHIDevice->GetIdStagingBuffer(),
-		0,
-		0, 0, 0,
-		RHIDevice->GetIdBuffer(),
-		0,
-		&Box);
-	D3D11_MAPPED_SUBRESOURCE MapResource{};
-	if (SUCCEEDED(DeviceContext->Map(RHIDevice->GetIdStagingBuffer(), 0, D3D11_MAP_READ, 0, &MapResource)))
+	for (std::unique_ptr<FSceneViewFamily>& Family : ViewFamilies)
 	{
-		PickedId = *static_cast<uint32*>(MapResource.pData);
-		DeviceContext->Unmap(RHIDevice->GetIdStagingBuffer(), 0);
+		if (Family->GetWorld() != InWorld)
+			continue;
+
+		// 뷰포트 툴바 등에서 프레임 도중 ShowFlag가 바뀌면 수집 결과를 버리고 등록된 뷰만 옮겨 다시 만듦
+		if (Family->GetShowFlags() != InWorld->GetRenderSettings().GetShowFlags())
+		{
+			std::unique_ptr<FSceneViewFamily> NewFamily = std::make_unique<FSceneViewFamily>(InWorld);
+			for (const FSceneView& View : Family->GetViews())
+			{
+				NewFamily->AddView(View);
+			}
+			Family = std::move(NewFamily);
+		}
+		return *Family;
 	}
 
-	if (PickedId == 0)
-		return nullptr;
-	return Cast<UPrimitiveComponent>(GUObjectArray[PickedId]);
+	ViewFamilies.Emplace(std::make_unique<FSceneViewFamily>(InWorld));
+	return *ViewFamilies.back();
 }
 
 void URenderer::InitializeLineBatch()
@@ -11,6 +11,11 @@ class UStaticMesh;
 class UBillboardComponent;
 class UPrimitiveComponent;
 struct FMaterialSlot;
+class FSpriteBatcher;
+class FSpriteVertexStream;
+class FOcclusionCullingManagerCPU;
+class FSceneViewFamily;
+struct FMeshSubmitScratch;
 
 class URenderer
 {
@@ -22,14 +27,20 @@ public:
 public:
 	void RenderSceneForView(UWorld* InWorld, ACameraActor* InCamera, FViewport* InViewport);
 
+	// 이번 프레임에 그릴 뷰를 미리 등록 (쿼드 뷰). 첫 RenderSceneForView가 등록된 모든 뷰의 절두체를 한 번에 질의하고
+	// 프록시 수집/섀도우 캐스터/라이트 버퍼/스팟·포인트 섀도우를 월드당 한 번만 만들어 나머지 뷰가 재사용
+	void AddViewToFamily(UWorld* InWorld, ACameraActor* InCamera, FViewport* InViewport, EViewModeIndex InViewMode);
+
 	void BeginFrame();
 	void EndFrame();
 
+	// BeginFrame마다 1씩 증가 (업로드 링 지원 여부와 무관한 프레임 번호, 첫 프레임은 1)
+	uint64 GetFrameNumber() const { return FrameNumber; }
+
 	// Viewport size for current draw context (used by overlay/gizmo scaling)
 	void SetCurrentViewportSize(uint32 InWidth, uint32 InHeight) { CurrentViewportWidth = InWidth; CurrentViewportHeight = InHeight; }
 	uint32 GetCurrentViewportWidth() const { return CurrentViewportWidth; }
 	uint32 GetCurrentViewportHeight() const { return CurrentViewportHeight; }
-	UPrimitiveComponent* GetPrimitiveCollided(int MouseX, int MouseY) const;
 
 	// Batch Line Rendering System
 	void BeginLineBatch();
@@ -40,6 +51,16 @@ public:
 
 	D3D11RHI* GetRHIDevice() { return RHIDevice; }
 
+	// 텍스트/빌보드 공유 정점 스트림 (뷰마다 FSceneRenderer가 배처를 채워 한 번에 업로드)
+	FSpriteBatcher& GetSpriteBatcher() { return *SpriteBatcher; }
+	FSpriteVertexStream& GetSpriteVertexStream() { return *SpriteVertexStream; }
+
+	// CPU 소프트웨어 오클루전 컬링 (뷰마다 FSceneRenderer가 BeginView부터 다시 채움)
+	FOcclusionCullingManagerCPU& GetOcclusionCulling() { return *OcclusionCulling; }
+
+	// FSceneRenderer::SubmitMeshBatches 작업 배열 (뷰/패스마다 비우고 다시 씀)
+	FMeshSubmitScratch& GetMeshSubmitScratch() { return *MeshSubmitScratch; }
+
 	void SetCurrentCamera(ACameraActor* InCamera) { CurrentCamera = InCamera; }
 	ACameraActor* GetCurrentCamera() const { return CurrentCamera; }
 
@@ -51,6 +72,8 @@ private:
 	uint32 CurrentViewportWidth = 0;
 	uint32 CurrentViewportHeight = 0;
 
+	uint64 FrameNumber = 0;
+
 	// Batch Line Rendering System using UDynamicMesh for efficiency
 	ULineDynamicMesh* DynamicLineMesh = nullptr;
 	FMeshData* LineBatchData = nullptr;
@@ -60,6 +83,17 @@ private:
 
 	void InitializeLineBatch();
 
+	// InWorld의 이번 프레임 뷰 패밀리 (없거나 도중에 ShowFlag가 바뀌었으면 새로 만듦)
+	FSceneViewFamily& GetViewFamily(UWorld* InWorld);
+
+	std::unique_ptr<FSpriteBatcher> SpriteBatcher;
+	std::unique_ptr<FSpriteVertexStream> SpriteVertexStream;
+	std::unique_ptr<FOcclusionCullingManagerCPU> OcclusionCulling;
+	std::unique_ptr<FMeshSubmitScratch> MeshSubmitScratch;
+
+	// 월드별 이번 프레임 뷰 패밀리 (컴포넌트 포인터를 들고 있으므로 BeginFrame/EndFrame에서 비움)
+	TArray<std::unique_ptr<FSceneViewFamily>> ViewFamilies;
+
 	// 이전 drawCall에서 이미 썼던 RnderState면, 다시 Set 하지 않기 위해 만든 변수들
 	EViewModeIndex PreViewModeIndex = EViewModeIndex::VMI_Wireframe; // RSSetState, UpdateColorConstantBuffers
 	//UMaterial* PreUMaterial = nullptr; // SRV, UpdatePixelConstantBuffers
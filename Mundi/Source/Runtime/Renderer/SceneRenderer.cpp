@@ -20,6 +20,7 @@
 #include "BVHierarchy.h"
 #include "SelectionManager.h"
 #include "StaticMeshComponent.h"
+#include "StaticMesh.h"
 #include "DecalStatManager.h"
 #include "BillboardComponent.h"
 #include "TextRenderComponent.h"
@@ -44,15 +45,27 @@
 #include"CollisionManager.h"
 #include "ShadowViewProjection.h"
 #include"CollisionComponent/ShapeComponent.h"
+#include "PackedVertex.h"
+#include "SpriteBatch.h"
+#include "SpriteVertexStream.h"
+#include "SceneViewFamily.h"
 
-FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer)
+// 셰이더를 덮어쓰는 패스(섀도우/데칼)에서 패킹 정점 배치용 Variant를 가져옵니다. (플래그 조합별로 호출 측에서 캐싱)
+static FShaderVariant* GetPackedVertexShaderVariant(UShader* InShader, const TArray<FShaderMacro>& InBaseMacros, uint8 InPackedVertexFlags, ID3D11Device* InDevice)
+{
+	TArray<FShaderMacro> Macros = InBaseMacros;
+	FPackedVertexFormat::FromFlags(InPackedVertexFlags).AppendShaderMacros(Macros);
+	return InShader->GetOrCompileShaderVariant(InDevice, Macros);
+}
+
+FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, FSceneViewFamily* InFamily, URenderer* InOwnerRenderer)
 	: World(InWorld)
 	, View(InView) // 전달받은 FSceneView 저장
+	, Family(InFamily)
+	, ViewIndex(InFamily && InView ? InFamily->ResolveView(*InView) : -1)
 	, OwnerRenderer(InOwnerRenderer)
 	, RHIDevice(InOwnerRenderer->GetRHIDevice())
 {
-	//OcclusionCPU = std::make_unique<FOcclusionCullingManagerCPU>();
-
 	// 타일 라이트 컬러 초기화
 	TileLightCuller = std::make_unique<FTileLightCuller>();
 	uint32 TileSize = World->GetRenderSettings().GetTileSize();
@@ -88,8 +101,17 @@ void FSceneRenderer::Render()
 		RenderShadowPass();
 
 		// 2. 라이트 버퍼 업데이트 및 섀도우 맵 바인딩
-		GWorld->GetLightManager()->SetDirtyFlag();
-		GWorld->GetLightManager()->UpdateLightBuffer(RHIDevice);	// 라이트 구조체 버퍼 업데이트, 바인딩
+		//    스팟/포인트 구조체 버퍼는 프레임당 한 번, b8은 이 뷰의 방향광 캐스케이드 행렬로 뷰마다 갱신
+		if (!Family->bLightBufferUpdated)
+		{
+			GWorld->GetLightManager()->SetDirtyFlag();
+			GWorld->GetLightManager()->UpdateLightBuffer(RHIDevice);	// 라이트 구조체 버퍼 업데이트, 바인딩
+			Family->bLightBufferUpdated = true;
+		}
+		else
+		{
+			GWorld->GetLightManager()->UpdateViewLightBuffer(RHIDevice);
+		}
 		GWorld->GetShadowManager()->BindShadowResources(RHIDevice);	// 섀도우 맵 텍스처 바인딩 (t5)
 		GWorld->GetShadowManager()->UpdateShadowFilterBuffer(RHIDevice);	// 섀도우 필터링 설정 업데이트
 
@@ -137,7 +159,7 @@ void FSceneRenderer::Render()
 
 void FSceneRenderer::RenderLitPath()
 {
-	RHIDevice->OMSetRenderTargets(ERTVMode::SceneColorTargetWithId);
+	RHIDevice->OMSetRenderTargets(ERTVMode::SceneColorTarget);
 
 	// Base Pass
 	RenderOpaquePass(View->ViewMode);
@@ -146,12 +168,7 @@ void FSceneRenderer::RenderLitPath()
 
 void FSceneRenderer::RenderWireframePath()
 {
-	// 깊이 버퍼 초기화 후 ID만 그리기
-	RHIDevice->RSSetState(ERasterizerMode::Solid);
-	RHIDevice->OMSetRenderTargets(ERTVMode::SceneIdTarget);
-	RenderOpaquePass(EViewModeIndex::VMI_Unlit);
-
-	// Wireframe으로 그리기
+	// Wireframe으로 그리기 (피킹은 CPU BVH로 하므로 ID 버퍼 선행 패스 없음)
 	RHIDevice->ClearDepthBuffer(1.0f, 0);
 	RHIDevice->RSSetState(ERasterizerMode::Wireframe);
 	RHIDevice->OMSetRenderTargets(ERTVMode::SceneColorTarget);
@@ -171,7 +188,7 @@ void FSceneRenderer::RenderSceneDepthPath()
 		vpBefore.Width, vpBefore.Height, vpBefore.TopLeftX, vpBefore.TopLeftY);
 
 	// 1. Scene RTV와 Depth Buffer Clear
-	RHIDevice->OMSetRenderTargets(ERTVMode::SceneColorTargetWithId);
+	RHIDevice->OMSetRenderTargets(ERTVMode::SceneColorTarget);
 
 	// ✅ 디버그: SceneRTV 전환 후 viewport 확인
 	D3D11_VIEWPORT vpAfter;
@@ -211,7 +228,7 @@ void FSceneRenderer::RenderSceneDepthPath()
 
 bool FSceneRenderer::IsValid() const
 {
-	return World && View && OwnerRenderer && RHIDevice;
+	return World && View && Family && OwnerRenderer && RHIDevice;
 }
 
 void FSceneRenderer::PrepareView()
@@ -267,135 +284,18 @@ void FSceneRenderer::PrepareView()
 
 void FSceneRenderer::GatherVisibleProxies()
 {
-	// NOTE: 일단 컴포넌트 단위와 데칼 관련 이슈 해결까지 컬링 무시
-	//// 절두체 컬링 수행 -> 결과가 멤버 변수 PotentiallyVisibleActors에 저장됨
-	//PerformFrustumCulling();
-
-	const bool bDrawStaticMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes);
-	const bool bDrawDecals = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Decals);
-	const bool bDrawFog = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Fog);
-	const bool bDrawLight = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Lighting);
-	const bool bUseAntiAliasing = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_FXAA);
-	const bool bUseBillboard = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Billboard);
+	// 월드 단위 수집과 모든 뷰의 절두체 질의는 프레임의 첫 뷰에서 한 번만
+	Family->GatherWorld();
+	const FVisibleRenderProxySet& FamilyProxies = Family->Proxies;
 
 	// 현재 뷰포트에서 piloting 중인 액터 확인
 	FViewportClient* ViewportClient = View->Viewport ? View->Viewport->GetViewportClient() : nullptr;
 	AActor* PilotingActor = ViewportClient ? ViewportClient->GetPilotActor() : nullptr;
 
-	// Helper lambda to collect components from an actor
-	auto CollectComponentsFromActor = [&](AActor* Actor, bool bIsEditorActor)
-		{
-			if (!Actor || !Actor->IsActorVisible())
-			{
-				return;
-			}
-
-			for (USceneComponent* Component : Actor->GetSceneComponents())
-			{
-				if (!Component || !Component->IsVisible())
-				{
-					continue;
-				}
-
-				// 엔진 에디터 액터 컴포넌트
-				if (bIsEditorActor)
-				{
-					if (UGizmoArrowComponent* GizmoComponent = Cast<UGizmoArrowComponent>(Component))
-					{
-						Proxies.OverlayPrimitives.Add(GizmoComponent);
-					}
-					else if (ULineComponent* LineComponent = Cast<ULineComponent>(Component))
-					{
-						Proxies.EditorLines.Add(LineComponent);
-					}
-
-					continue;
-				}
-
-				if (UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Component); PrimitiveComponent)
-				{
-					// 에디터 보조 컴포넌트 (빌보드, 방향 화살표 등)
-					// 현재 뷰포트에서 piloting 중인 액터의 에디터 컴포넌트는 제외
-					if (!PrimitiveComponent->IsEditable())
-					{
-						// Piloting 중인 액터의 에디터 헬퍼는 현재 뷰포트에서 숨김
-						if (PilotingActor && Actor == PilotingActor)
-						{
-							continue;
-						}
-
-						Proxies.EditorPrimitives.Add(PrimitiveComponent);
-						continue;
-					}
-
-					// 일반 컴포넌트
-					if (UMeshComponent* MeshComponent = Cast<UMeshComponent>(PrimitiveComponent))
-					{
-						bool bShouldAdd = true;
-
-						// 메시 타입이 '스태틱 메시'인 경우에만 ShowFlag를 검사하여 추가 여부를 결정
-						if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshComponent))
-						{
-							bShouldAdd = bDrawStaticMeshes;
-						}
-						// else if (USkeletalMeshComponent* SkeletalMeshComponent = ...)
-						// {
-						//     bShouldAdd = bDrawSkeletalMeshes;
-						// }
-
-						if (bShouldAdd)
-						{
-							Proxies.Meshes.Add(MeshComponent);
-						}
-					}
-					else if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(PrimitiveComponent); BillboardComponent && bUseBillboard)
-					{
-						Proxies.Billboards.Add(BillboardComponent);
-					}
-					else if (UDecalComponent* DecalComponent = Cast<UDecalComponent>(PrimitiveComponent); DecalComponent && bDrawDecals)
-					{
-						Proxies.Decals.Add(DecalComponent);
-					}
-				}
-				else
-				{
-					if (UHeightFogComponent* FogComponent = Cast<UHeightFogComponent>(Component); FogComponent && bDrawFog)
-					{
-						SceneGlobals.Fogs.Add(FogComponent);
-					}
-
-					else if (UDirectionalLightComponent* LightComponent = Cast<UDirectionalLightComponent>(Component); LightComponent && bDrawLight)
-					{
-						SceneGlobals.DirectionalLights.Add(LightComponent);
-					}
-
-					else if (UAmbientLightComponent* LightComponent = Cast<UAmbientLightComponent>(Component); LightComponent && bDrawLight)
-					{
-						SceneGlobals.AmbientLights.Add(LightComponent);
-					}
-
-					else if (UPointLightComponent* LightComponent = Cast<UPointLightComponent>(Component); LightComponent && bDrawLight)
-					{
-						if (USpotLightComponent* SpotLightComponent = Cast<USpotLightComponent>(LightComponent); SpotLightComponent)
-						{
-							SceneLocals.SpotLights.Add(SpotLightComponent);
-						}
-						else
-						{
-							SceneLocals.PointLights.Add(LightComponent);
-						}
-					}
-				}
-			}
-		};
-
-	// Collect from Editor Actors (Gizmo, Grid, etc.)
-	// 현재 뷰포트에서 piloting 중인 액터의 기즈모는 숨김
+	// 현재 뷰포트가 선택된 액터를 piloting 중이면 기즈모 숨김
 	AGizmoActor* GizmoActor = World->GetGizmoActor();
 	USelectionManager* SelectionManager = World->GetSelectionManager();
 	bool bHideGizmo = false;
-
-	// 현재 뷰포트가 선택된 액터를 piloting 중이면 기즈모 숨김
 	if (GizmoActor && SelectionManager && PilotingActor)
 	{
 		AActor* SelectedActor = SelectionManager->GetSelectedActor();
@@ -405,22 +305,38 @@ void FSceneRenderer::GatherVisibleProxies()
 		}
 	}
 
-	for (AActor* EditorActor : World->GetEditorActors())
+	Proxies.Meshes = FamilyProxies.Meshes;
+	Proxies.Billboards = FamilyProxies.Billboards;
+	Proxies.Decals = FamilyProxies.Decals;
+	Proxies.Texts = FamilyProxies.Texts;
+
+	// 에디터 액터 컴포넌트: piloting 중이면 Gizmo Actor 것은 제외
+	for (ULineComponent* LineComponent : FamilyProxies.EditorLines)
 	{
-		// 현재 뷰포트에서 piloting 중이면 Gizmo Actor 수집하지 않음
-		if (bHideGizmo && EditorActor == GizmoActor)
+		if (!bHideGizmo || LineComponent->GetOwner() != GizmoActor)
 		{
-			continue;
+			Proxies.EditorLines.Add(LineComponent);
+		}
+	}
+	for (UPrimitiveComponent* OverlayPrimitive : FamilyProxies.OverlayPrimitives)
+	{
+		if (!bHideGizmo || OverlayPrimitive->GetOwner() != GizmoActor)
+		{
+			Proxies.OverlayPrimitives.Add(OverlayPrimitive);
 		}
-
-		CollectComponentsFromActor(EditorActor, true);
 	}
 
-	// Collect from Level Actors (including their Gizmo components)
-	for (AActor* Actor : World->GetActors())
+	// Piloting 중인 액터의 에디터 헬퍼는 현재 뷰포트에서 숨김
+	for (UPrimitiveComponent* EditorPrimitive : FamilyProxies.EditorPrimitives)
 	{
-		CollectComponentsFromActor(Actor, false);
+		if (!PilotingActor || EditorPrimitive->GetOwner() != PilotingActor)
+		{
+			Proxies.EditorPrimitives.Add(EditorPrimitive);
+		}
 	}
+
+	PerformFrustumCulling();
+	PerformOcclusionCulling();
 }
 
 void FSceneRenderer::PerformTileLightCulling()
@@ -482,12 +398,17 @@ void FSceneRenderer::PerformTileLightCulling()
 
 void FSceneRenderer::RenderShadowPass()
 {
+	FShadowManager* ShadowManager = GWorld->GetShadowManager();
+
 	// Step 0: 쉐도우 맵 리소스 언바인딩 (렌더 타겟으로 사용하기 전에 필수!)
-	GWorld->GetShadowManager()->UnbindShadowResources(RHIDevice);
+	ShadowManager->UnbindShadowResources(RHIDevice);
 
-	// Step 1: 섀도우 캐스팅 라이트에 인덱스 할당
-	FShadowCastingLights ShadowLights(SceneGlobals.DirectionalLights, SceneLocals.SpotLights, SceneLocals.PointLights);
-	GWorld->GetShadowManager()->AssignShadowMapIndices(RHIDevice, ShadowLights);
+	// Step 1: 섀도우 캐스팅 라이트에 인덱스 할당 (프레임당 한 번, 패밀리의 모든 뷰 기준으로 스팟 타일 크기 결정)
+	if (!Family->bWorldShadowsRendered)
+	{
+		FShadowCastingLights ShadowLights(Family->SceneGlobals.DirectionalLights, Family->SceneLocals.SpotLights, Family->SceneLocals.PointLights);
+		ShadowManager->AssignShadowMapIndices(RHIDevice, ShadowLights, Family->GetViews(), Family->Proxies.ShadowCasterMeshes, OwnerRenderer->GetFrameNumber());
+	}
 
 	// Step 2: 섀도우 뎁스 셰이더 로드 및 컴파일
 	UShader* ShadowDepthShader = UResourceManager::GetInstance().Load<UShader>("Shaders/Materials/ShadowDepth.hlsl");
@@ -505,17 +426,28 @@ void FSceneRenderer::RenderShadowPass()
 		return;
 	}
 
-	// Step 3: 섀도우 필터 타입 가져오기
-	EShadowFilterType FilterType = GWorld->GetShadowManager()->GetShadowConfiguration().FilterType;
+	// Step 3: 캐스터 배치 수집 + 섀도우 셰이더 오버라이드 (프레임당 한 번, 모든 라이트/캐스케이드/뷰가 재사용)
+	if (!Family->bShadowCastersCollected)
+	{
+		EShadowFilterType FilterType = ShadowManager->GetShadowConfiguration().FilterType;
+		CollectShadowMeshBatches(Family->ShadowCasterBatches);
+		OverrideShadowShader(Family->ShadowCasterBatches, ShadowShaderVariant, FilterType);
+		Family->bShadowCastersCollected = true;
+	}
 
 	// Step 4: 렌더 상태 저장 (RAII 패턴)
 	FSavedRenderState SavedState;
 	SavedState.Save(RHIDevice);
 
 	// Step 5: 라이트 타입별 섀도우 렌더링
-	RenderDirectionalLightShadows(ShadowShaderVariant);
-	RenderSpotLightShadows(ShadowShaderVariant);
-	RenderPointLightShadows(ShadowShaderVariant);
+	// 스팟/포인트는 뷰와 무관해 첫 Lit 뷰에서만, 방향광(CSM)은 카메라 절두체에 맞추므로 뷰마다
+	if (!Family->bWorldShadowsRendered)
+	{
+		RenderSpotLightShadows();
+		RenderPointLightShadows();
+		Family->bWorldShadowsRendered = true;
+	}
+	RenderDirectionalLightShadows();
 
 	// Step 6: 렌더 상태 복구
 	SavedState.Restore(RHIDevice);
@@ -530,12 +462,17 @@ void FSceneRenderer::RenderShadowPass()
 
 void FSceneRenderer::CollectShadowMeshBatches(TArray<FMeshBatchElement>& OutMeshBatches) const
 {
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
+	for (UMeshComponent* MeshComponent : Family->Proxies.ShadowCasterMeshes)
 	{
 		MeshComponent->CollectMeshBatches(OutMeshBatches, View);
 	}
 }
 
+void FSceneRenderer::DrawShadowCasters()
+{
+	DrawMeshBatches(Family->ShadowCasterBatches, false, true);
+}
+
 void FSceneRenderer::OverrideShadowShader(TArray<FMeshBatchElement>& MeshBatches, FShaderVariant* ShadowShaderVariant, EShadowFilterType FilterType)
 {
 	// VS는 항상 ShadowDepthShader의 VS 사용
@@ -546,11 +483,33 @@ void FSceneRenderer::OverrideShadowShader(TArray<FMeshBatchElement>& MeshBatches
 	UShader* PSShader = GWorld->GetShadowManager()->GetShadowPixelShaderForFilterType(FilterType);
 	ID3D11PixelShader* PS = PSShader ? PSShader->GetPixelShader() : nullptr;  // NONE/PCF는 nullptr
 
+	// 패킹 정점 배치는 ShadowDepth의 PACKED_* Variant 사용 (플래그 조합은 최대 8가지)
+	UShader* ShadowDepthShader = nullptr;
+	FShaderVariant* PackedVariants[8] = {};
+
 	for (FMeshBatchElement& BatchElement : MeshBatches)
 	{
 		BatchElement.VertexShader = VS;
 		BatchElement.PixelShader = PS;
 		BatchElement.InputLayout = IL;
+
+		if (BatchElement.PackedVertexFlags != 0)
+		{
+			FShaderVariant*& PackedVariant = PackedVariants[BatchElement.PackedVertexFlags & 7];
+			if (!PackedVariant)
+			{
+				if (!ShadowDepthShader)
+				{
+					ShadowDepthShader = UResourceManager::GetInstance().Load<UShader>("Shaders/Materials/ShadowDepth.hlsl");
+				}
+				PackedVariant = GetPackedVertexShaderVariant(ShadowDepthShader, TArray<FShaderMacro>(), BatchElement.PackedVertexFlags, RHIDevice->GetDevice());
+			}
+			if (PackedVariant)
+			{
+				BatchElement.VertexShader = PackedVariant->VertexShader;
+				BatchElement.InputLayout = PackedVariant->InputLayout;
+			}
+		}
 	}
 }
 
@@ -573,12 +532,11 @@ void FSceneRenderer::UpdateViewProjBufferForShadow(const FShadowRenderContext& S
 	RHIDevice->SetAndUpdateConstantBuffer(ViewProjBuffer);
 }
 
-void FSceneRenderer::RenderDirectionalLightShadows(FShaderVariant* ShadowShaderVariant)
+void FSceneRenderer::RenderDirectionalLightShadows()
 {
 	FShadowManager* ShadowManager = GWorld->GetShadowManager();
-	const FShadowConfiguration& ShadowConfig = ShadowManager->GetShadowConfiguration();
 
-	for (UDirectionalLightComponent* DirLight : SceneGlobals.DirectionalLights)
+	for (UDirectionalLightComponent* DirLight : Family->SceneGlobals.DirectionalLights)
 	{
 		// 유효성 검사
 		if (!IsLightValidForShadowCasting(DirLight))
@@ -617,15 +575,8 @@ void FSceneRenderer::RenderDirectionalLightShadows(FShaderVariant* ShadowShaderV
 				// ViewProj 버퍼 업데이트 (Orthographic)
 				UpdateViewProjBufferForShadow(ShadowContext, true);
 
-				// 메시 수집
-				TArray<FMeshBatchElement> ShadowMeshBatches;
-				CollectShadowMeshBatches(ShadowMeshBatches);
-
-				// 셰이더 오버라이드
-				OverrideShadowShader(ShadowMeshBatches, ShadowShaderVariant, ShadowConfig.FilterType);
-
-				// 그리기
-				DrawMeshBatches(ShadowMeshBatches, true, true);
+				// 캐스터 그리기 (프레임당 한 번 수집한 배치 재사용)
+				DrawShadowCasters();
 
 				// 섀도우 맵 렌더 종료
 				ShadowManager->EndShadowRender(RHIDevice);
@@ -645,15 +596,8 @@ void FSceneRenderer::RenderDirectionalLightShadows(FShaderVariant* ShadowShaderV
 			// ViewProj 버퍼 업데이트 (Orthographic)
 			UpdateViewProjBufferForShadow(ShadowContext, true);
 
-			// 메시 수집
-			TArray<FMeshBatchElement> ShadowMeshBatches;
-			CollectShadowMeshBatches(ShadowMeshBatches);
-
-			// 셰이더 오버라이드
-			OverrideShadowShader(ShadowMeshBatches, ShadowShaderVariant, ShadowConfig.FilterType);
-
-			// 그리기
-			DrawMeshBatches(ShadowMeshBatches, true, true);
+			// 캐스터 그리기 (프레임당 한 번 수집한 배치 재사용)
+			DrawShadowCasters();
 
 			// 섀도우 맵 렌더 종료
 			ShadowManager->EndShadowRender(RHIDevice);
@@ -661,17 +605,20 @@ void FSceneRenderer::RenderDirectionalLightShadows(FShaderVariant* ShadowShaderV
 	}
 }
 
-void FSceneRenderer::RenderSpotLightShadows(FShaderVariant* ShadowShaderVariant)
+void FSceneRenderer::RenderSpotLightShadows()
 {
 	FShadowManager* ShadowManager = GWorld->GetShadowManager();
-	const FShadowConfiguration& ShadowConfig = ShadowManager->GetShadowConfiguration();
 
-	for (USpotLightComponent* SpotLight : SceneLocals.SpotLights)
+	for (USpotLightComponent* SpotLight : Family->SceneLocals.SpotLights)
 	{
 		// 유효성 검사
 		if (!IsLightValidForShadowCasting(SpotLight))
 			continue;
 
+		// 아틀라스 타일에 남은 깊이가 유효하면 (라이트/캐스터 변화 없음) 다시 그리지 않음
+		if (ShadowManager->IsSpotLightShadowCached(SpotLight))
+			continue;
+
 		// ShadowManager에게 섀도우 맵 렌더 시작 요청
 		FShadowRenderContext ShadowContext;
 		if (!ShadowManager->BeginShadowRender(RHIDevice, SpotLight, ShadowContext))
@@ -680,27 +627,19 @@ void FSceneRenderer::RenderSpotLightShadows(FShaderVariant* ShadowShaderVariant)
 		// ViewProj 버퍼 업데이트 (Perspective)
 		UpdateViewProjBufferForShadow(ShadowContext, false);
 
-		// 메시 수집
-		TArray<FMeshBatchElement> ShadowMeshBatches;
-		CollectShadowMeshBatches(ShadowMeshBatches);
-
-		// 셰이더 오버라이드
-		OverrideShadowShader(ShadowMeshBatches, ShadowShaderVariant, ShadowConfig.FilterType);
-
-		// 그리기
-		DrawMeshBatches(ShadowMeshBatches, true, true);
+		// 캐스터 그리기 (프레임당 한 번 수집한 배치 재사용)
+		DrawShadowCasters();
 
 		// 섀도우 맵 렌더 종료
 		GWorld->GetShadowManager()->EndShadowRender(RHIDevice);
 	}
 }
 
-void FSceneRenderer::RenderPointLightShadows(FShaderVariant* ShadowShaderVariant)
+void FSceneRenderer::RenderPointLightShadows()
 {
 	FShadowManager* ShadowManager = GWorld->GetShadowManager();
-	const FShadowConfiguration& ShadowConfig = ShadowManager->GetShadowConfiguration();
 
-	for (UPointLightComponent* PointLight : SceneLocals.PointLights)
+	for (UPointLightComponent* PointLight : Family->SceneLocals.PointLights)
 	{
 		// 유효성 검사
 		if (!IsLightValidForShadowCasting(PointLight))
@@ -727,15 +666,8 @@ void FSceneRenderer::RenderPointLightShadows(FShaderVariant* ShadowShaderVariant
 			// ViewProj 버퍼 업데이트 (Perspective)
 			UpdateViewProjBufferForShadow(ShadowContext, false);
 
-			// 메시 수집
-			TArray<FMeshBatchElement> ShadowMeshBatches;
-			CollectShadowMeshBatches(ShadowMeshBatches);
-
-			// 셰이더 오버라이드
-			OverrideShadowShader(ShadowMeshBatches, ShadowShaderVariant, ShadowConfig.FilterType);
-
-			// 그리기
-			DrawMeshBatches(ShadowMeshBatches, true, true);
+			// 캐스터 그리기 (프레임당 한 번 수집한 배치 재사용)
+			DrawShadowCasters();
 
 			// 섀도우 맵 렌더 종료
 			GWorld->GetShadowManager()->EndShadowRender(RHIDevice);
@@ -800,22 +732,89 @@ void FSceneRenderer::FSavedRenderState::Release()
 
 void FSceneRenderer::PerformFrustumCulling()
 {
-	PotentiallyVisibleComponents.clear();	// 할 필요 없는데 명목적으로 초기화
+	// 절두체 판정은 패밀리가 모든 뷰를 BVH 한 번 순회로 끝내 두었으므로 이 뷰 비트만 확인
+	int32 WriteIndex = 0;
+	for (int32 MeshIndex = 0; MeshIndex < Proxies.Meshes.Num(); ++MeshIndex)
+	{
+		if (!Family->IsCulledInView(Proxies.Meshes[MeshIndex], ViewIndex))
+		{
+			Proxies.Meshes[WriteIndex++] = Proxies.Meshes[MeshIndex];
+		}
+	}
+	Proxies.Meshes.resize(WriteIndex);
+}
 
-	// Todo: 프로스텀 컬링 수행, 추후 프로스텀 컬링이 컴포넌트 단위로 변경되면 적용
+void FSceneRenderer::PerformOcclusionCulling()
+{
+	// 와이어프레임은 가려진 면도 보여야 하므로 제외
+	if (!World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_OcclusionCulling) || View->ViewMode == EViewModeIndex::VMI_Wireframe)
+		return;
 
-	//World->GetPartitionManager()->FrustumQuery(ViewFrustum)
+	if (Proxies.Meshes.IsEmpty())
+		return;
 
-	//for (AActor* Actor : World->GetActors())
-	//{
-	//	if (!Actor || Actor->GetActorHiddenInEditor()) continue;
+	// 패밀리의 절두체 질의에서 이 뷰와 겹친 스태틱 메시만 후보 (수집 순서를 유지해 결과가 결정적)
+	TArray<FOccluderDesc> Candidates;
+	TArray<FAABB> CandidateBounds;
+	TArray<int32> CandidateMeshIndices;		// Proxies.Meshes 인덱스
+	for (int32 MeshIndex = 0; MeshIndex < Proxies.Meshes.Num(); ++MeshIndex)
+	{
+		UStaticMeshComponent* Component = Cast<UStaticMeshComponent>(Proxies.Meshes[MeshIndex]);
+		if (!Component || !Family->IsInViewFrustum(Component, ViewIndex))
+			continue;
+
+		const UStaticMesh* StaticMesh = Component->GetStaticMesh();
+		const FStaticMesh* Asset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+		if (!Asset)
+			continue;
 
-	//	// 절두체 컬링을 통과한 액터만 목록에 추가
-	//	if (ViewFrustum.Intersects(Actor->GetBounds()))
-	//	{
-	//		PotentiallyVisibleActors.Add(Actor);
-	//	}
-	//}
+		FOccluderDesc Desc;
+		Desc.Mesh.Positions = reinterpret_cast<const uint8*>(Asset->Vertices.data());
+		Desc.Mesh.PositionStride = sizeof(FNormalVertex);
+		Desc.Mesh.VertexCount = static_cast<uint32>(Asset->Vertices.Num());
+		Desc.Mesh.Indices = Asset->Indices.data();
+		Desc.Mesh.IndexCount = static_cast<uint32>(Asset->Indices.Num());
+		Desc.WorldMatrix = Component->GetWorldMatrix();
+		Desc.WorldBound = Component->GetWorldAABB();
+
+		Candidates.Add(Desc);
+		CandidateBounds.Add(Desc.WorldBound);
+		CandidateMeshIndices.Add(MeshIndex);
+	}
+
+	FOcclusionCullingManagerCPU& Occlusion = OwnerRenderer->GetOcclusionCulling();
+	Occlusion.BeginView(View->ViewMatrix * View->ProjectionMatrix);
+
+	TArray<int32> Selected;
+	Occlusion.SelectOccluders(Candidates, Selected);
+	if (Selected.IsEmpty())
+		return;
+	Occlusion.RasterizeOccluders(Candidates, Selected);
+
+	TArray<uint8> Visible(CandidateBounds.Num());
+	Occlusion.TestBounds(CandidateBounds.data(), CandidateBounds.Num(), Visible.data());
+
+	// 오클루더 자신은 자기 깊이와 같은 값으로 판정되므로 항상 그림
+	for (int32 CandidateIndex : Selected)
+	{
+		Visible[CandidateIndex] = 1;
+	}
+
+	TArray<uint8> MeshVisible(Proxies.Meshes.Num(), 1);
+	for (int32 CandidateIndex = 0; CandidateIndex < CandidateMeshIndices.Num(); ++CandidateIndex)
+	{
+		MeshVisible[CandidateMeshIndices[CandidateIndex]] = Visible[CandidateIndex];
+	}
+
+	int32 WriteIndex = 0;
+	for (int32 MeshIndex = 0; MeshIndex < Proxies.Meshes.Num(); ++MeshIndex)
+	{
+		if (MeshVisible[MeshIndex])
+		{
+			Proxies.Meshes[WriteIndex++] = Proxies.Meshes[MeshIndex];
+		}
+	}
+	Proxies.Meshes.resize(WriteIndex);
 }
 
 void FSceneRenderer::RenderOpaquePass(EViewModeIndex InRenderViewMode)
@@ -873,24 +872,46 @@ void FSceneRenderer::RenderOpaquePass(EViewModeIndex InRenderViewMode)
 	if (bNeedsShaderOverride && ShaderVariant)
 	{
 		// 수집된 UMeshComponent 배치 요소의 셰이더를 ViewModeShader로 강제 변경
+		// 패킹 정점 배치는 같은 뷰 모드 매크로에 PACKED_*를 더한 Variant 사용 (플래그 조합은 최대 8가지)
+		FShaderVariant* PackedVariants[8] = {};
 		for (FMeshBatchElement& BatchElement : MeshBatchElements)
 		{
-			BatchElement.VertexShader = ShaderVariant->VertexShader;
-			BatchElement.PixelShader = ShaderVariant->PixelShader;
-			BatchElement.InputLayout = ShaderVariant->InputLayout;
+			FShaderVariant* BatchVariant = ShaderVariant;
+			if (BatchElement.PackedVertexFlags != 0)
+			{
+				FShaderVariant*& PackedVariant = PackedVariants[BatchElement.PackedVertexFlags & 7];
+				if (!PackedVariant)
+				{
+					PackedVariant = GetPackedVertexShaderVariant(ViewModeShader, ShaderMacros, BatchElement.PackedVertexFlags, RHIDevice->GetDevice());
+				}
+				if (!PackedVariant)
+				{
+					// 레이아웃이 맞지 않는 Variant로 그리면 깨지므로 건너뜀
+					BatchElement.VertexShader = nullptr;
+					continue;
+				}
+				BatchVariant = PackedVariant;
+			}
+
+			BatchElement.VertexShader = BatchVariant->VertexShader;
+			BatchElement.PixelShader = BatchVariant->PixelShader;
+			BatchElement.InputLayout = BatchVariant->InputLayout;
 		}
 	}
 
+	// 빌보드/텍스트는 공유 스프라이트 스트림에 모아 아틀라스별 드로우로 추가
+	FSpriteBatcher& SpriteBatcher = OwnerRenderer->GetSpriteBatcher();
+	SpriteBatcher.Reset();
 	for (UBillboardComponent* BillboardComponent : Proxies.Billboards)
 	{
-		BillboardComponent->CollectMeshBatches(MeshBatchElements, View);
+		BillboardComponent->CollectSprites(SpriteBatcher, View);
 	}
 
 	for (UTextRenderComponent* TextRenderComponent : Proxies.Texts)
 	{
-		// TODO: UTextRenderComponent도 CollectMeshBatches를 통해 FMeshBatchElement를 생성하도록 구현
-		//TextRenderComponent->CollectMeshBatches(MeshBatchElements, View);
+		TextRenderComponent->CollectSprites(SpriteBatcher, View);
 	}
+	AppendSpriteBatches(SpriteBatcher);
 
 	// --- 2. 정렬 (Sort) ---
 	MeshBatchElements.Sort();
@@ -960,6 +981,8 @@ void FSceneRenderer::RenderDecalPass()
 	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly); // 깊이 쓰기 OFF
 	RHIDevice->OMSetBlendState(true);
 
+	FShaderVariant* PackedDecalVariants[8] = {};
+
 	for (UDecalComponent* Decal : Proxies.Decals)
 	{
 		if (!Decal || !Decal->GetDecalTexture())
@@ -1008,10 +1031,26 @@ void FSceneRenderer::RenderDecalPass()
 		{
 			BatchElement.InstanceShaderResourceView = Decal->GetDecalTexture()->GetShaderResourceView();
 			BatchElement.Material = Decal->GetMaterial(0);
-			BatchElement.InputLayout = ShaderVariant->InputLayout;
-			BatchElement.VertexShader = ShaderVariant->VertexShader;
-			BatchElement.PixelShader = ShaderVariant->PixelShader;
-			BatchElement.VertexStride = sizeof(FVertexDynamic);
+
+			// 패킹 정점 배치는 스트라이드를 유지하고 PACKED_* Variant 사용
+			FShaderVariant* BatchVariant = ShaderVariant;
+			if (BatchElement.PackedVertexFlags != 0)
+			{
+				FShaderVariant*& PackedVariant = PackedDecalVariants[BatchElement.PackedVertexFlags & 7];
+				if (!PackedVariant)
+				{
+					PackedVariant = GetPackedVertexShaderVariant(DecalShader, ShaderMacros, BatchElement.PackedVertexFlags, RHIDevice->GetDevice());
+				}
+				BatchVariant = PackedVariant ? PackedVariant : ShaderVariant;
+			}
+			else
+			{
+				BatchElement.VertexStride = sizeof(FVertexDynamic);
+			}
+
+			BatchElement.InputLayout = BatchVariant->InputLayout;
+			BatchElement.VertexShader = BatchVariant->VertexShader;
+			BatchElement.PixelShader = BatchVariant->PixelShader;
 		}
 		DrawMeshBatches(MeshBatchElements, true);
 
@@ -1030,9 +1069,9 @@ void FSceneRenderer::RenderDecalPass()
 void FSceneRenderer::RenderPostProcessingPasses()
 {
 	UHeightFogComponent* FogComponent = nullptr;
-	if (0 < SceneGlobals.Fogs.Num())
+	if (0 < Family->SceneGlobals.Fogs.Num())
 	{
-		FogComponent = SceneGlobals.Fogs[0];
+		FogComponent = Family->SceneGlobals.Fogs[0];
 	}
 
 	if (!FogComponent)
@@ -1207,14 +1246,69 @@ void FSceneRenderer::RenderTileCullingDebug()
 // 빌보드, 에디터 화살표 그리기 (상호 작용, 피킹 O)
 void FSceneRenderer::RenderEditorPrimitivesPass()
 {
-	RHIDevice->OMSetRenderTargets(ERTVMode::SceneColorTargetWithId);
+	RHIDevice->OMSetRenderTargets(ERTVMode::SceneColorTarget);
+
+	// 라이트 아이콘 등 에디터 빌보드도 스프라이트 스트림으로 묶음
+	FSpriteBatcher& SpriteBatcher = OwnerRenderer->GetSpriteBatcher();
+	SpriteBatcher.Reset();
 	for (UPrimitiveComponent* GizmoComp : Proxies.EditorPrimitives)
 	{
+		if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(GizmoComp))
+		{
+			BillboardComponent->CollectSprites(SpriteBatcher, View);
+			continue;
+		}
 		GizmoComp->CollectMeshBatches(MeshBatchElements, View);
 	}
+	AppendSpriteBatches(SpriteBatcher);
 	DrawMeshBatches(MeshBatchElements, true);
 }
 
+void FSceneRenderer::AppendSpriteBatches(FSpriteBatcher& InBatcher)
+{
+	if (InBatcher.IsEmpty())
+	{
+		return;
+	}
+
+	FSpriteVertexStream& SpriteStream = OwnerRenderer->GetSpriteVertexStream();
+	InBatcher.Build(FSpriteVertexStream::MaxQuadsPerDraw);
+
+	uint32 BaseVertex = 0;
+	if (!SpriteStream.Upload(InBatcher, BaseVertex))
+	{
+		return;
+	}
+
+	UShader* SpriteShader = UResourceManager::GetInstance().Load<UShader>("Shaders/UI/SpriteBatch.hlsl");
+	FShaderVariant* ShaderVariant = SpriteShader ? SpriteShader->GetOrCompileShaderVariant(RHIDevice->GetDevice()) : nullptr;
+	if (!ShaderVariant)
+	{
+		return;
+	}
+
+	// 정점이 이미 월드 공간이므로 WorldMatrix는 항등, ObjectID는 정점마다 들어 있음
+	for (const FSpriteDrawBatch& SpriteBatch : InBatcher.GetBatches())
+	{
+		FMeshBatchElement BatchElement;
+		BatchElement.VertexShader = ShaderVariant->VertexShader;
+		BatchElement.PixelShader = ShaderVariant->PixelShader;
+		BatchElement.InputLayout = ShaderVariant->InputLayout;
+		BatchElement.Material = nullptr;
+		BatchElement.VertexBuffer = SpriteStream.GetVertexBuffer();
+		BatchElement.IndexBuffer = SpriteStream.GetIndexBuffer();
+		BatchElement.VertexStride = FSpriteVertexStream::GetVertexStride();
+		BatchElement.IndexCount = SpriteBatch.QuadCount * 6;
+		BatchElement.StartIndex = 0;
+		BatchElement.BaseVertexIndex = BaseVertex + SpriteBatch.FirstVertex;
+		BatchElement.WorldMatrix = FMatrix::Identity();
+		BatchElement.ObjectID = 0;
+		BatchElement.InstanceShaderResourceView = static_cast<ID3D11ShaderResourceView*>(const_cast<void*>(SpriteBatch.Atlas));
+		BatchElement.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+		MeshBatchElements.Add(BatchElement);
+	}
+}
+
 // 경계, 외곽선 등 표시 (상호 작용, 피킹 X)
 void FSceneRenderer::RenderDebugPass()
 {
@@ -1293,7 +1387,7 @@ void FSceneRenderer::RenderDebugPass()
 void FSceneRenderer::RenderOverayEditorPrimitivesPass()
 {
 	// 후처리된 최종 이미지 위에 원본 씬의 뎁스 버퍼를 사용하여 3D 오버레이를 렌더링합니다.
-	RHIDevice->OMSetRenderTargets(ERTVMode::SceneColorTargetWithId);
+	RHIDevice->OMSetRenderTargets(ERTVMode::SceneColorTarget);
 
 	// 뎁스 버퍼를 Clear하고 LessEqual로 그리기 때문에 오버레이로 표시되는데
 	// 오버레이 끼리는 깊이 테스트가 가능함
@@ -1313,128 +1407,219 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 {
 	if (InMeshBatches.IsEmpty()) return;
 
+	SubmitMeshBatches(RHIDevice, OwnerRenderer->GetMeshSubmitScratch(), InMeshBatches, bIsShadowPass);
+
+	// 루프 종료 후 리스트 비우기 (옵션)
+	if (bClearListAfterDraw)
+	{
+		InMeshBatches.Empty();
+	}
+}
+
+// 업로드 링 슬롯 크기 (오프셋 바인딩 단위인 256바이트로 정렬)
+constexpr uint32 PixelConstRingSlotSize = FFrameUploadAllocator::Align(sizeof(FPixelConstBufferType), FFrameUploadAllocator::DefaultAlignment);
+constexpr uint32 ModelRingSlotSize = FFrameUploadAllocator::Align(sizeof(ModelBufferType), FFrameUploadAllocator::DefaultAlignment);
+constexpr uint32 ColorRingSlotSize = FFrameUploadAllocator::Align(sizeof(ColorBufferType), FFrameUploadAllocator::DefaultAlignment);
+constexpr uint32 PerDrawRingSize = ModelRingSlotSize + ColorRingSlotSize;
+
+static void BuildSubmitPixelState(const FMeshBatchElement& Batch, FSubmitPixelState& OutState)
+{
+	FPixelConstBufferType& PixelConst = OutState.PixelConst;
+	if (Batch.Material)
+	{
+		PixelConst.Material = Batch.Material->GetMaterialInfo();
+		PixelConst.bHasMaterial = true;
+	}
+	else
+	{
+		FMaterialInfo DefaultMaterialInfo;
+		PixelConst.Material = DefaultMaterialInfo;
+		PixelConst.bHasMaterial = false;
+		PixelConst.bHasDiffuseTexture = false;
+		PixelConst.bHasNormalTexture = false;
+	}
+
+	// 1순위: 인스턴스 텍스처 (빌보드)
+	if (Batch.InstanceShaderResourceView)
+	{
+		OutState.SRVs[0] = Batch.InstanceShaderResourceView;
+		PixelConst.bHasDiffuseTexture = true;
+		PixelConst.bHasNormalTexture = false;
+	}
+	// 2순위: 머티리얼 텍스처 (스태틱 메시)
+	else if (Batch.Material)
+	{
+		const FMaterialInfo& MaterialInfo = Batch.Material->GetMaterialInfo();
+		if (!MaterialInfo.DiffuseTextureFileName.empty())
+		{
+			if (UTexture* TextureData = Batch.Material->GetTexture(EMaterialTextureSlot::Diffuse))
+			{
+				OutState.SRVs[0] = TextureData->GetShaderResourceView();
+				PixelConst.bHasDiffuseTexture = (OutState.SRVs[0] != nullptr);
+			}
+		}
+		if (!MaterialInfo.NormalTextureFileName.empty())
+		{
+			if (UTexture* TextureData = Batch.Material->GetTexture(EMaterialTextureSlot::Normal))
+			{
+				OutState.SRVs[1] = TextureData->GetShaderResourceView();
+				PixelConst.bHasNormalTexture = (OutState.SRVs[1] != nullptr);
+			}
+		}
+	}
+}
+
+void FSceneRenderer::SubmitMeshBatches(D3D11RHI* InRHIDevice, FMeshSubmitScratch& InOutScratch, const TArray<FMeshBatchElement>& InMeshBatches, bool bIsShadowPass)
+{
+	if (InMeshBatches.IsEmpty()) return;
+
+	// 모든 GPU 명령은 커맨드 컨텍스트를 거침 (null 모드에서는 기록만 함)
+	IRHICommandContext& Context = InRHIDevice->GetCommandContext();
+
 	// RHI 상태 초기 설정 (Opaque Pass 기본값)
 	// Shadow Pass일 경우 FShadowMap::BeginRender()에서 이미 설정했으므로 덮어쓰지 않음
 	if (!bIsShadowPass)
 	{
-		RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual); // 깊이 쓰기 ON
+		InRHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual); // 깊이 쓰기 ON
+	}
+
+	// --- 1. 그릴 배치와 픽셀 상태 변경 지점을 먼저 골라냄 ---
+	// 상수 데이터를 드로우 전에 한 번에 업로드하기 위함 (배열은 호출 측 scratch를 비워서 재사용)
+	TArray<FSubmitDraw>& Draws = InOutScratch.Draws;
+	TArray<FSubmitPixelState>& PixelStates = InOutScratch.PixelStates;
+	Draws.clear();
+	PixelStates.clear();
+	{
+		UMaterialInterface* CurrentMaterial = nullptr;
+		ID3D11ShaderResourceView* CurrentInstanceSRV = nullptr;
+
+		// Shadow Pass에서는 Pixel Shader가 없을 수 있음 (depth-only rendering)
+		const bool bRequiresPixelShader = !bIsShadowPass;
+		for (const FMeshBatchElement& Batch : InMeshBatches)
+		{
+			if (!Batch.VertexShader ||
+				(bRequiresPixelShader && !Batch.PixelShader) ||
+				!Batch.VertexBuffer ||
+				!Batch.IndexBuffer ||
+				Batch.VertexStride == 0)
+			{
+				// 셰이더나 버퍼, 스트라이드 정보가 없으면 그릴 수 없음
+				continue;
+			}
+
+			FSubmitDraw Draw;
+			Draw.Batch = &Batch;
+
+			// 'Material' 또는 'Instance SRV' 둘 중 하나라도 바뀌면 모든 픽셀 리소스를 다시 바인딩해야 합니다.
+			if (Batch.Material != CurrentMaterial || Batch.InstanceShaderResourceView != CurrentInstanceSRV)
+			{
+				Draw.PixelStateIndex = PixelStates.Num();
+				PixelStates.emplace_back();
+				BuildSubmitPixelState(Batch, PixelStates.back());
+
+				CurrentMaterial = Batch.Material;
+				CurrentInstanceSRV = Batch.InstanceShaderResourceView;
+			}
+			Draws.Add(Draw);
+		}
+	}
+
+	// --- 2. 드로우별 상수 (재질, 모델/법선 행렬, 색)를 업로드 링에 Map 한 번으로 기록 ---
+	// 레이아웃: [기본 재질][재질 변경분...][드로우마다 Model + Color]. 링을 못 쓰면 (미지원/가득 참) 드로우마다 기존 상수 버퍼 갱신
+	FPixelConstBufferType DefaultPixelConst{};
+	ID3D11Buffer* RingBuffer = InRHIDevice->GetUploadRingBuffer();
+	const uint32 PixelConstBytes = PixelConstRingSlotSize * (1 + static_cast<uint32>(PixelStates.Num()));
+	const uint32 UploadSize = PixelConstBytes + PerDrawRingSize * static_cast<uint32>(Draws.Num());
+	uint32 RingOffset = 0;
+	uint8* Upload = InRHIDevice->CanBindConstantBufferRanges() ? InRHIDevice->MapUploadRing(UploadSize, RingOffset) : nullptr;
+	const bool bUseRing = (Upload != nullptr);
+	if (bUseRing)
+	{
+		uint8* Cursor = Upload;
+		memcpy(Cursor, &DefaultPixelConst, sizeof(DefaultPixelConst));
+		Cursor += PixelConstRingSlotSize;
+		for (FSubmitPixelState& PixelState : PixelStates)
+		{
+			PixelState.RingOffset = RingOffset + static_cast<uint32>(Cursor - Upload);
+			memcpy(Cursor, &PixelState.PixelConst, sizeof(PixelState.PixelConst));
+			Cursor += PixelConstRingSlotSize;
+		}
+		for (const FSubmitDraw& Draw : Draws)
+		{
+			const FMeshBatchElement& Batch = *Draw.Batch;
+			const ModelBufferType Model(Batch.WorldMatrix,
+				Batch.NormalMatrix ? *Batch.NormalMatrix : Batch.WorldMatrix.InverseAffine().Transpose(),
+				Batch.PositionDequantScale, Batch.PositionDequantBias);
+			const ColorBufferType Color(Batch.InstanceColor, Batch.ObjectID);
+			memcpy(Cursor, &Model, sizeof(Model));
+			memcpy(Cursor + ModelRingSlotSize, &Color, sizeof(Color));
+			Cursor += PerDrawRingSize;
+		}
+		InRHIDevice->UnmapUploadRing();
 	}
 
 	// PS 리소스 초기화
 	ID3D11ShaderResourceView* nullSRVs[2] = { nullptr, nullptr };
-	RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 2, nullSRVs);
+	Context.SetPSShaderResources(0, 2, nullSRVs);
 	ID3D11SamplerState* nullSamplers[2] = { nullptr, nullptr };
-	RHIDevice->GetDeviceContext()->PSSetSamplers(0, 2, nullSamplers);
-	FPixelConstBufferType DefaultPixelConst{};
-	RHIDevice->SetAndUpdateConstantBuffer(DefaultPixelConst);
+	Context.SetPSSamplers(0, 2, nullSamplers);
+	if (bUseRing)
+	{
+		Context.SetConstantBufferRange(RingBuffer, FPixelConstBufferTypeSlot, RingOffset, sizeof(FPixelConstBufferType),
+			FPixelConstBufferTypeIsVS, FPixelConstBufferTypeIsPS);
+	}
+	else
+	{
+		InRHIDevice->SetAndUpdateConstantBuffer(DefaultPixelConst);
+	}
 
 	// 현재 GPU 상태 캐싱용 변수 (UStaticMesh* 대신 실제 GPU 리소스로 변경)
 	ID3D11VertexShader* CurrentVertexShader = nullptr;
 	ID3D11PixelShader* CurrentPixelShader = nullptr;
-	UMaterialInterface* CurrentMaterial = nullptr;
-	ID3D11ShaderResourceView* CurrentInstanceSRV = nullptr; // [추가] Instance SRV 캐시
 	ID3D11Buffer* CurrentVertexBuffer = nullptr;
 	ID3D11Buffer* CurrentIndexBuffer = nullptr;
 	UINT CurrentVertexStride = 0;
 	D3D11_PRIMITIVE_TOPOLOGY CurrentTopology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
 
 	// 기본 샘플러 미리 가져오기 (루프 내 반복 호출 방지)
-	ID3D11SamplerState* DefaultSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Default);
+	ID3D11SamplerState* DefaultSampler = InRHIDevice->GetSamplerState(RHI_Sampler_Index::Default);
 
-	// 정렬된 리스트 순회
-	for (const FMeshBatchElement& Batch : InMeshBatches)
+	// --- 3. 정렬된 리스트 순회 ---
+	uint32 DrawOffset = RingOffset + PixelConstBytes;
+	for (const FSubmitDraw& Draw : Draws)
 	{
-		// --- 필수 요소 유효성 검사 ---
-		// Shadow Pass에서는 Pixel Shader가 없을 수 있음 (depth-only rendering)
-		bool bRequiresPixelShader = !bIsShadowPass;
-		if (!Batch.VertexShader ||
-			(bRequiresPixelShader && !Batch.PixelShader) ||
-			!Batch.VertexBuffer ||
-			!Batch.IndexBuffer ||
-			Batch.VertexStride == 0)
-		{
-			// 셰이더나 버퍼, 스트라이드 정보가 없으면 그릴 수 없음
-			continue;
-		}
+		const FMeshBatchElement& Batch = *Draw.Batch;
 
 		// 1. 셰이더 상태 변경
 		if (Batch.VertexShader != CurrentVertexShader || Batch.PixelShader != CurrentPixelShader)
 		{
-			RHIDevice->GetDeviceContext()->IASetInputLayout(Batch.InputLayout);
-			RHIDevice->GetDeviceContext()->VSSetShader(Batch.VertexShader, nullptr, 0);
+			Context.SetInputLayout(Batch.InputLayout);
+			Context.SetVertexShader(Batch.VertexShader);
 
-			RHIDevice->GetDeviceContext()->PSSetShader(Batch.PixelShader, nullptr, 0);
+			Context.SetPixelShader(Batch.PixelShader);
 
 			CurrentVertexShader = Batch.VertexShader;
 			CurrentPixelShader = Batch.PixelShader;
 		}
 
-		// --- 2. 픽셀 상태 (텍스처, 샘플러, 재질CBuffer) 변경 (캐싱됨) ---
-		//
-		// 'Material' 또는 'Instance SRV' 둘 중 하나라도 바뀌면
-		// 모든 픽셀 리소스를 다시 바인딩해야 합니다.
-		if (Batch.Material != CurrentMaterial || Batch.InstanceShaderResourceView != CurrentInstanceSRV)
+		// 2. 픽셀 상태 (텍스처, 샘플러, 재질CBuffer) 변경 (1단계에서 바뀌는 지점만 골라 둠)
+		if (Draw.PixelStateIndex >= 0)
 		{
-			ID3D11ShaderResourceView* DiffuseTextureSRV = nullptr; // t0
-			ID3D11ShaderResourceView* NormalTextureSRV = nullptr;  // t1
-			FPixelConstBufferType PixelConst{};
+			const FSubmitPixelState& PixelState = PixelStates[Draw.PixelStateIndex];
+			Context.SetPSShaderResources(0, 2, PixelState.SRVs);
 
-			if (Batch.Material)
+			ID3D11SamplerState* Samplers[2] = { DefaultSampler, DefaultSampler };
+			Context.SetPSSamplers(0, 2, Samplers);
+
+			if (bUseRing)
 			{
-				PixelConst.Material = Batch.Material->GetMaterialInfo();
-				PixelConst.bHasMaterial = true;
+				Context.SetConstantBufferRange(RingBuffer, FPixelConstBufferTypeSlot, PixelState.RingOffset, sizeof(FPixelConstBufferType),
+					FPixelConstBufferTypeIsVS, FPixelConstBufferTypeIsPS);
 			}
 			else
 			{
-				FMaterialInfo DefaultMaterialInfo;
-				PixelConst.Material = DefaultMaterialInfo;
-				PixelConst.bHasMaterial = false;
-				PixelConst.bHasDiffuseTexture = false;
-				PixelConst.bHasNormalTexture = false;
+				InRHIDevice->SetAndUpdateConstantBuffer(PixelState.PixelConst);
 			}
-
-			// 1순위: 인스턴스 텍스처 (빌보드)
-			if (Batch.InstanceShaderResourceView)
-			{
-				DiffuseTextureSRV = Batch.InstanceShaderResourceView;
-				PixelConst.bHasDiffuseTexture = true;
-				PixelConst.bHasNormalTexture = false;
-			}
-			// 2순위: 머티리얼 텍스처 (스태틱 메시)
-			else if (Batch.Material)
-			{
-				const FMaterialInfo& MaterialInfo = Batch.Material->GetMaterialInfo();
-				if (!MaterialInfo.DiffuseTextureFileName.empty())
-				{
-					if (UTexture* TextureData = Batch.Material->GetTexture(EMaterialTextureSlot::Diffuse))
-					{
-						DiffuseTextureSRV = TextureData->GetShaderResourceView();
-						PixelConst.bHasDiffuseTexture = (DiffuseTextureSRV != nullptr);
-					}
-				}
-				if (!MaterialInfo.NormalTextureFileName.empty())
-				{
-					if (UTexture* TextureData = Batch.Material->GetTexture(EMaterialTextureSlot::Normal))
-					{
-						NormalTextureSRV = TextureData->GetShaderResourceView();
-						PixelConst.bHasNormalTexture = (NormalTextureSRV != nullptr);
-					}
-				}
-			}			// --- RHI 상태 업데이트 ---
-			// 1. 텍스처(SRV) 바인딩
-			ID3D11ShaderResourceView* Srvs[2] = { DiffuseTextureSRV, NormalTextureSRV };
-			RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 2, Srvs);
-
-			// 2. 샘플러 바인딩
-			ID3D11SamplerState* Samplers[2] = { DefaultSampler, DefaultSampler };
-			RHIDevice->GetDeviceContext()->PSSetSamplers(0, 2, Samplers);
-
-			// 3. 재질 CBuffer 바인딩
-			RHIDevice->SetAndUpdateConstantBuffer(PixelConst);
-
-			// --- 캐시 업데이트 ---
-			CurrentMaterial = Batch.Material;
-			CurrentInstanceSRV = Batch.InstanceShaderResourceView;
 		}
 
 		// 3. IA (Input Assembler) 상태 변경
@@ -1443,15 +1628,12 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			Batch.VertexStride != CurrentVertexStride ||
 			Batch.PrimitiveTopology != CurrentTopology)
 		{
-			UINT Stride = Batch.VertexStride;
-			UINT Offset = 0;
-
 			// Vertex/Index 버퍼 바인딩
-			RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &Batch.VertexBuffer, &Stride, &Offset);
-			RHIDevice->GetDeviceContext()->IASetIndexBuffer(Batch.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+			Context.SetVertexBuffer(Batch.VertexBuffer, Batch.VertexStride, 0);
+			Context.SetIndexBuffer(Batch.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
 
 			// 토폴로지 설정 (이전 코드의 5번에서 이동하여 최적화)
-			RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(Batch.PrimitiveTopology);
+			Context.SetPrimitiveTopology(Batch.PrimitiveTopology);
 
 			// 현재 IA 상태 캐싱
 			CurrentVertexBuffer = Batch.VertexBuffer;
@@ -1460,18 +1642,23 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			CurrentTopology = Batch.PrimitiveTopology;
 		}
 
-		// 4. 오브젝트별 상수 버퍼 설정 (매번 변경)
-		RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, Batch.WorldMatrix.InverseAffine().Transpose()));
-		RHIDevice->SetAndUpdateConstantBuffer(ColorBufferType(Batch.InstanceColor, Batch.ObjectID));
+		// 4. 오브젝트별 상수 버퍼 설정 (매번 변경, 링에서는 오프셋만 바꿔 바인딩)
+		if (bUseRing)
+		{
+			Context.SetConstantBufferRange(RingBuffer, ModelBufferTypeSlot, DrawOffset, sizeof(ModelBufferType), ModelBufferTypeIsVS, ModelBufferTypeIsPS);
+			Context.SetConstantBufferRange(RingBuffer, ColorBufferTypeSlot, DrawOffset + ModelRingSlotSize, sizeof(ColorBufferType),
+				ColorBufferTypeIsVS, ColorBufferTypeIsPS);
+			DrawOffset += PerDrawRingSize;
+		}
+		else
+		{
+			const FMatrix NormalMatrix = Batch.NormalMatrix ? *Batch.NormalMatrix : Batch.WorldMatrix.InverseAffine().Transpose();
+			InRHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, NormalMatrix, Batch.PositionDequantScale, Batch.PositionDequantBias));
+			InRHIDevice->SetAndUpdateConstantBuffer(ColorBufferType(Batch.InstanceColor, Batch.ObjectID));
+		}
 
 		// 5. 드로우 콜 실행
-		RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
-	}
-
-	// 루프 종료 후 리스트 비우기 (옵션)
-	if (bClearListAfterDraw)
-	{
-		InMeshBatches.Empty();
+		Context.DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
 	}
 }
 
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "Frustum.h"
 #include "ShadowConfiguration.h"
+#include "ConstantBufferType.h"
 
 // 전방 선언 (헤더 파일 의존성 최소화)
 class UWorld;
@@ -23,6 +24,8 @@ class UGizmoArrowComponent;
 class FSceneView;
 class FTileLightCuller;
 class ULineComponent;
+class FSpriteBatcher;
+class FSceneViewFamily;
 struct FShadowRenderContext;
 
 struct FCandidateDrawable;
@@ -32,6 +35,7 @@ struct FVisibleRenderProxySet
 {
 	// --- Type 1: Main Scene (PP O, Depth-Test O) ---
 	TArray<UMeshComponent*> Meshes;
+	TArray<UMeshComponent*> ShadowCasterMeshes;	// 컬링 전 목록 (카메라에서 가려져도 그림자는 드리움, FSceneViewFamily만 채움)
 	TArray<UBillboardComponent*> Billboards; // 인게임 빌보드 (파티클, 잔디 등)
 	TArray<UDecalComponent*> Decals;
 	TArray<UTextRenderComponent*> Texts;
@@ -59,19 +63,51 @@ struct FSceneGlobals
 	TArray<UHeightFogComponent*> Fogs;	// 첫 번째로 찾은 Fog를 사용함
 };
 
+// 재질/인스턴스 SRV가 바뀌는 지점에서 바인딩할 픽셀 상태
+struct FSubmitPixelState
+{
+	ID3D11ShaderResourceView* SRVs[2] = { nullptr, nullptr };	// t0 Diffuse, t1 Normal
+	FPixelConstBufferType PixelConst{};
+	uint32 RingOffset = 0;
+};
+
+// 그릴 수 있는 배치 하나 (PixelStateIndex >= 0이면 이 드로우 전에 픽셀 상태를 바꿈)
+struct FSubmitDraw
+{
+	const FMeshBatchElement* Batch = nullptr;
+	int32 PixelStateIndex = -1;
+};
+
+// SubmitMeshBatches가 호출마다 비우고 다시 채우는 작업 배열.
+// 제출하는 쪽(URenderer, 헤드리스 벤치마크)이 들고 있어 호출 간 용량을 재사용함
+struct FMeshSubmitScratch
+{
+	TArray<FSubmitDraw> Draws;
+	TArray<FSubmitPixelState> PixelStates;
+};
+
 /**
  * @class FSceneRenderer
  * @brief 한 프레임의 특정 뷰(View)에 대한 씬 렌더링을 총괄하는 임시(transient) 클래스.
+ * 프록시/라이트 수집, 스팟/포인트 섀도우, 라이트 버퍼처럼 뷰와 무관한 작업은 FSceneViewFamily에 한 번만 맡기고
+ * 뷰별 필터링, 절두체/오클루전 컬링, 방향광 섀도우(CSM), 정렬과 그리기만 합니다.
  */
 class FSceneRenderer
 {
 public:
-	FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer);
+	FSceneRenderer(UWorld* InWorld, FSceneView* InView, FSceneViewFamily* InFamily, URenderer* InOwnerRenderer);
 	~FSceneRenderer();
 
 	/** @brief 이 씬 렌더러의 모든 렌더링 파이프라인을 실행합니다. */
 	void Render();
 
+	/**
+	 * @brief 정렬된 배치 목록을 RHI 커맨드 컨텍스트로 제출합니다 (DrawMeshBatches의 본체).
+	 * 씬/뷰 상태를 쓰지 않으므로 null 모드 D3D11RHI로 헤드리스 벤치마크할 수 있습니다.
+	 * InOutScratch는 호출 중에만 쓰는 작업 배열입니다 (동시에 두 제출이 같은 것을 쓰면 안 됨).
+	 */
+	static void SubmitMeshBatches(D3D11RHI* InRHIDevice, FMeshSubmitScratch& InOutScratch, const TArray<FMeshBatchElement>& InMeshBatches, bool bIsShadowPass = false);
+
 private:
 	// Render Path
 	void RenderLitPath();
@@ -84,11 +120,14 @@ private:
 	/** @brief 렌더링에 필요한 뷰 행렬, 절두체 등 프레임 데이터를 준비합니다. */
 	void PrepareView();
 
-	/** @brief 월드의 모든 액터를 대상으로 절두체 컬링을 수행합니다. */
+	/** @brief 뷰 패밀리의 다중 절두체 질의 결과로 이 뷰 절두체 밖의 메시를 Proxies.Meshes에서 제외합니다. */
 	void PerformFrustumCulling();
 
+	/** @brief 큰 스태틱 메시로 CPU 깊이 버퍼를 그려 그 뒤에 가려진 스태틱 메시를 Proxies.Meshes에서 제외합니다. */
+	void PerformOcclusionCulling();
 
-	/** @brief 씬을 순회하며 컬링을 통과한 모든 렌더링 대상을 수집합니다. */
+
+	/** @brief 뷰 패밀리가 수집한 대상에서 이 뷰에 그릴 것을 골라내고 컬링합니다. */
 	void GatherVisibleProxies();
 
 	/** @brief 수집한 라이트 정보들로부터 상수 버퍼를 업데이트합니다.*/
@@ -105,6 +144,9 @@ private:
 
 	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw, bool bIsShadowPass = false);
 
+	/** @brief 스프라이트 배처의 정점을 공유 스트림에 올리고 아틀라스별 FMeshBatchElement를 추가합니다. */
+	void AppendSpriteBatches(FSpriteBatcher& InBatcher);
+
 	/** @brief 데칼(Decal)을 렌더링하는 패스입니다. */
 	void RenderDecalPass();
 
@@ -142,6 +184,9 @@ private:
 	/** @brief 섀도우 패스용 메시 배치를 수집합니다. */
 	void CollectShadowMeshBatches(TArray<FMeshBatchElement>& OutMeshBatches) const;
 
+	/** @brief 뷰 패밀리의 섀도우 캐스터 배치를 그립니다 (프레임당 한 번 수집/셰이더 덮어쓰기한 목록을 재사용). */
+	void DrawShadowCasters();
+
 	/** @brief 메시 배치의 셰이더를 섀도우 뎁스 셰이더로 오버라이드합니다.
 	 *  @param MeshBatches 오버라이드할 메시 배치
 	 *  @param ShadowShaderVariant 섀도우 뎁스 VS 셰이더 (VS와 InputLayout 사용)
@@ -152,14 +197,14 @@ private:
 	/** @brief 섀도우 렌더링을 위한 ViewProj 상수 버퍼를 업데이트합니다. */
 	void UpdateViewProjBufferForShadow(const FShadowRenderContext& ShadowContext, bool bIsOrthographic);
 
-	/** @brief DirectionalLight의 섀도우를 렌더링합니다. */
-	void RenderDirectionalLightShadows(FShaderVariant* ShadowShaderVariant);
+	/** @brief DirectionalLight의 섀도우를 렌더링합니다 (CSM은 카메라 절두체를 따르므로 뷰마다). */
+	void RenderDirectionalLightShadows();
 
-	/** @brief SpotLight의 섀도우를 렌더링합니다. */
-	void RenderSpotLightShadows(FShaderVariant* ShadowShaderVariant);
+	/** @brief SpotLight의 섀도우를 렌더링합니다 (뷰와 무관, 프레임당 한 번). */
+	void RenderSpotLightShadows();
 
-	/** @brief PointLight의 섀도우를 렌더링합니다 (Cube Map). */
-	void RenderPointLightShadows(FShaderVariant* ShadowShaderVariant);
+	/** @brief PointLight의 섀도우를 렌더링합니다 (Cube Map, 뷰와 무관, 프레임당 한 번). */
+	void RenderPointLightShadows();
 
 	/** @brief 카메라의 ViewProj 상수 버퍼를 복구합니다. */
 	void RestoreCameraViewProj();
@@ -182,21 +227,14 @@ private:
 	// --- 렌더링 컨텍스트 (외부에서 주입받음) ---
 	UWorld* World;
 	FSceneView* View;
+	FSceneViewFamily* Family;	// 같은 프레임의 다른 뷰와 공유하는 월드 단위 상태 (라이트/포그/섀도우 캐스터)
+	int32 ViewIndex;			// Family의 뷰 비트 (-1이면 절두체 결과 없음)
 	URenderer* OwnerRenderer;
 	D3D11RHI* RHIDevice;
 
-	// 수집된 렌더링 대상 목록
+	// 이 뷰에 그릴 렌더링 대상 목록 (Family 수집 결과를 뷰별로 거르고 컬링)
 	FVisibleRenderProxySet Proxies;
 
-	// 씬 지역 설정
-	FSceneLocals SceneLocals;
-
-	// 씬 전역 설정
-	FSceneGlobals SceneGlobals;
-
-	// 컬링을 거친 가시성 목록, NOTE: 추후 컴포넌트 단위로 수정
-	TArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
-
 	// 각 패스에서 수집된 드로우 콜 정보 리스트
 	TArray<FMeshBatchElement> MeshBatchElements;
 
@@ -0,0 +1,239 @@
+﻿#include "pch.h"
+#include "SceneViewFamily.h"
+#include <cstring>
+
+#include "World.h"
+#include "RenderSettings.h"
+#include "WorldPartitionManager.h"
+#include "BVHierarchy.h"
+#include "PrimitiveComponent.h"
+#include "StaticMeshComponent.h"
+#include "DecalComponent.h"
+#include "BillboardComponent.h"
+#include "TextRenderComponent.h"
+#include "HeightFogComponent.h"
+#include "LineComponent.h"
+#include "Gizmo/GizmoArrowComponent.h"
+#include "DirectionalLightComponent.h"
+#include "AmbientLightComponent.h"
+#include "PointLightComponent.h"
+#include "SpotLightComponent.h"
+
+FSceneViewFamily::FSceneViewFamily(UWorld* InWorld)
+	: World(InWorld)
+	, ShowFlags(InWorld->GetRenderSettings().GetShowFlags())
+{
+}
+
+void FSceneViewFamily::AddView(const FSceneView& InView)
+{
+	ResolveView(InView);
+}
+
+int32 FSceneViewFamily::ResolveView(const FSceneView& InView)
+{
+	for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex)
+	{
+		FSceneView& View = Views[ViewIndex];
+		if (View.Viewport != InView.Viewport)
+			continue;
+
+		const bool bSameCamera = std::memcmp(&View.ViewMatrix, &InView.ViewMatrix, sizeof(FMatrix)) == 0 &&
+			std::memcmp(&View.ProjectionMatrix, &InView.ProjectionMatrix, sizeof(FMatrix)) == 0;
+		View = InView;	// 뷰 모드는 등록 뒤 바뀔 수 있음
+
+		// 등록 뒤 카메라가 바뀌었으면 (툴바에서 뷰 타입 변경 등) 이 뷰 비트만 다시 질의
+		if (!bSameCamera && bGathered)
+		{
+			const uint32 ViewBit = 1u << ViewIndex;
+			for (auto& Pair : FrustumMasks)
+			{
+				Pair.second &= ~ViewBit;
+			}
+			QueryViewFrustums(ViewIndex, 1);
+		}
+		return ViewIndex;
+	}
+
+	if (Views.Num() >= MaxViews)
+		return -1;
+
+	Views.Add(InView);
+	if (bGathered)
+	{
+		QueryViewFrustums(Views.Num() - 1, 1);
+	}
+	return Views.Num() - 1;
+}
+
+void FSceneViewFamily::QueryViewFrustums(int32 InFirstView, int32 InCount)
+{
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	const FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	if (!BVH || InCount <= 0)
+		return;
+
+	TArray<FFrustum> Frustums;
+	Frustums.reserve(InCount);
+	for (int32 ViewIndex = InFirstView; ViewIndex < InFirstView + InCount; ++ViewIndex)
+	{
+		Frustums.Add(Views[ViewIndex].ViewFrustum);
+	}
+	BVH->QueryFrustumMasks(Frustums.data(), InCount, static_cast<uint32>(InFirstView), FrustumMasks);
+}
+
+bool FSceneViewFamily::IsCulledInView(UMeshComponent* InMesh, int32 InViewIndex) const
+{
+	UStaticMeshComponent* Component = Cast<UStaticMeshComponent>(InMesh);
+	if (!Component || InViewIndex < 0)
+		return false;
+
+	// BVH에 없는 메시(등록 전)나 바운드가 아직 이전 위치일 수 있는 메시는 그대로 그림
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	const FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	if (!BVH || !BVH->FindComponentBounds(Component) || Partition->IsDirty(Component))
+		return false;
+
+	return !IsInViewFrustum(Component, InViewIndex);
+}
+
+bool FSceneViewFamily::IsInViewFrustum(UStaticMeshComponent* InComponent, int32 InViewIndex) const
+{
+	if (InViewIndex < 0)
+		return false;
+
+	const uint32* Mask = FrustumMasks.Find(InComponent);
+	return Mask && (*Mask & (1u << InViewIndex)) != 0;
+}
+
+void FSceneViewFamily::GatherWorld()
+{
+	if (bGathered)
+		return;
+	bGathered = true;
+
+	const URenderSettings& RenderSettings = World->GetRenderSettings();
+	const bool bDrawStaticMeshes = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes);
+	const bool bDrawDecals = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Decals);
+	const bool bDrawFog = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Fog);
+	const bool bDrawLight = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Lighting);
+	const bool bUseBillboard = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Billboard);
+
+	// 뷰별로 숨기는 것(파일럿 액터의 에디터 헬퍼, 기즈모)은 여기서 거르지 않고 FSceneRenderer가 소유 액터로 거름
+	auto CollectComponentsFromActor = [&](AActor* Actor, bool bIsEditorActor)
+		{
+			if (!Actor || !Actor->IsActorVisible())
+			{
+				return;
+			}
+
+			for (USceneComponent* Component : Actor->GetSceneComponents())
+			{
+				if (!Component || !Component->IsVisible())
+				{
+					continue;
+				}
+
+				// 엔진 에디터 액터 컴포넌트
+				if (bIsEditorActor)
+				{
+					if (UGizmoArrowComponent* GizmoComponent = Cast<UGizmoArrowComponent>(Component))
+					{
+						Proxies.OverlayPrimitives.Add(GizmoComponent);
+					}
+					else if (ULineComponent* LineComponent = Cast<ULineComponent>(Component))
+					{
+						Proxies.EditorLines.Add(LineComponent);
+					}
+
+					continue;
+				}
+
+				if (UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Component); PrimitiveComponent)
+				{
+					// 에디터 보조 컴포넌트 (빌보드, 방향 화살표 등)
+					if (!PrimitiveComponent->IsEditable())
+					{
+						Proxies.EditorPrimitives.Add(PrimitiveComponent);
+						continue;
+					}
+
+					// 일반 컴포넌트
+					if (UMeshComponent* MeshComponent = Cast<UMeshComponent>(PrimitiveComponent))
+					{
+						bool bShouldAdd = true;
+
+						// 메시 타입이 '스태틱 메시'인 경우에만 ShowFlag를 검사하여 추가 여부를 결정
+						if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshComponent))
+						{
+							bShouldAdd = bDrawStaticMeshes;
+						}
+
+						if (bShouldAdd)
+						{
+							Proxies.Meshes.Add(MeshComponent);
+						}
+					}
+					else if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(PrimitiveComponent); BillboardComponent && bUseBillboard)
+					{
+						Proxies.Billboards.Add(BillboardComponent);
+					}
+					else if (UTextRenderComponent* TextRenderComponent = Cast<UTextRenderComponent>(PrimitiveComponent); TextRenderComponent && bUseBillboard)
+					{
+						Proxies.Texts.Add(TextRenderComponent);
+					}
+					else if (UDecalComponent* DecalComponent = Cast<UDecalComponent>(PrimitiveComponent); DecalComponent && bDrawDecals)
+					{
+						Proxies.Decals.Add(DecalComponent);
+					}
+				}
+				else
+				{
+					if (UHeightFogComponent* FogComponent = Cast<UHeightFogComponent>(Component); FogComponent && bDrawFog)
+					{
+						SceneGlobals.Fogs.Add(FogComponent);
+					}
+
+					else if (UDirectionalLightComponent* LightComponent = Cast<UDirectionalLightComponent>(Component); LightComponent && bDrawLight)
+					{
+						SceneGlobals.DirectionalLights.Add(LightComponent);
+					}
+
+					else if (UAmbientLightComponent* LightComponent = Cast<UAmbientLightComponent>(Component); LightComponent && bDrawLight)
+					{
+						SceneGlobals.AmbientLights.Add(LightComponent);
+					}
+
+					else if (UPointLightComponent* LightComponent = Cast<UPointLightComponent>(Component); LightComponent && bDrawLight)
+					{
+						if (USpotLightComponent* SpotLightComponent = Cast<USpotLightComponent>(LightComponent); SpotLightComponent)
+						{
+							SceneLocals.SpotLights.Add(SpotLightComponent);
+						}
+						else
+						{
+							SceneLocals.PointLights.Add(LightComponent);
+						}
+					}
+				}
+			}
+		};
+
+	// Collect from Editor Actors (Gizmo, Grid, etc.)
+	for (AActor* EditorActor : World->GetEditorActors())
+	{
+		CollectComponentsFromActor(EditorActor, true);
+	}
+
+	// Collect from Level Actors (including their Gizmo components)
+	for (AActor* Actor : World->GetActors())
+	{
+		CollectComponentsFromActor(Actor, false);
+	}
+
+	// 카메라에서 가려져도 그림자는 드리우므로 캐스터는 컬링 전 전체 목록
+	Proxies.ShadowCasterMeshes = Proxies.Meshes;
+
+	// 지금까지 등록된 모든 뷰를 BVH 한 번 순회로 판정
+	QueryViewFrustums(0, Views.Num());
+}
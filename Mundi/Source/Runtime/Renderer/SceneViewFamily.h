@@ -0,0 +1,70 @@
+﻿#pragma once
+#include "SceneRenderer.h"
+#include "SceneView.h"
+#include "MeshBatchElement.h"
+
+class UWorld;
+class UMeshComponent;
+class UStaticMeshComponent;
+
+/**
+ * @class FSceneViewFamily
+ * @brief 한 프레임에 같은 월드를 그리는 뷰들과, 뷰와 무관해 프레임당 한 번만 만드는 월드 단위 렌더 상태.
+ *
+ * 쿼드 뷰 에디터는 뷰포트마다 URenderer::RenderSceneForView를 부르지만 프록시/라이트/포그 수집, 섀도우 캐스터 배치,
+ * 라이트 버퍼, 스팟/포인트 섀도우 맵은 뷰와 무관하므로 첫 뷰에서 한 번만 만들고 나머지 뷰는 재사용합니다.
+ * 미리 등록된 뷰들의 절두체는 BVH 한 번 순회로 판정해 컴포넌트별 뷰 비트마스크로 저장하고,
+ * 각 FSceneRenderer는 자기 비트로 절두체 컬링/오클루전 후보를 고른 뒤 뷰 전용 필터링(파일럿, 기즈모)과 정렬만 합니다.
+ * 수집/절두체 단계(GatherWorld, ResolveView)는 D3D 호출이 없어 null 백엔드에서 단독으로 검증할 수 있습니다.
+ */
+class FSceneViewFamily
+{
+public:
+	static constexpr int32 MaxViews = 32;	// 뷰 비트마스크 폭
+
+	explicit FSceneViewFamily(UWorld* InWorld);
+
+	UWorld* GetWorld() const { return World; }
+	EEngineShowFlags GetShowFlags() const { return ShowFlags; }
+	const TArray<FSceneView>& GetViews() const { return Views; }
+
+	/** @brief 이번 프레임에 그릴 뷰를 미리 등록합니다. 수집 전에 등록된 뷰들은 한 번의 BVH 순회로 판정됩니다. */
+	void AddView(const FSceneView& InView);
+
+	/**
+	 * @brief InView와 같은 뷰포트의 뷰 인덱스(비트 위치)를 반환합니다. 자리가 없으면 -1.
+	 * 미리 등록되지 않았거나 등록 뒤 카메라가 바뀐 뷰는 그 뷰 절두체만 다시 질의합니다.
+	 */
+	int32 ResolveView(const FSceneView& InView);
+
+	/** @brief 월드 단계: 프록시/라이트/포그를 수집하고 등록된 모든 뷰의 절두체를 질의합니다 (최초 한 번). */
+	void GatherWorld();
+
+	/** @brief BVH가 이 뷰 절두체 밖으로 판정한 메시인지 (BVH에 없거나 갱신 대기 중이면 false) */
+	bool IsCulledInView(UMeshComponent* InMesh, int32 InViewIndex) const;
+
+	/** @brief BVH가 이 뷰 절두체와 겹친다고 판정한 스태틱 메시인지 (오클루전 후보) */
+	bool IsInViewFrustum(UStaticMeshComponent* InComponent, int32 InViewIndex) const;
+
+	// === 월드 단계 수집 결과 (뷰별 필터링 전) ===
+	FVisibleRenderProxySet Proxies;
+	FSceneLocals SceneLocals;
+	FSceneGlobals SceneGlobals;
+
+	// === 프레임당 한 번 하는 GPU 작업 (첫 Lit 뷰에서 수행) ===
+	TArray<FMeshBatchElement> ShadowCasterBatches;	// 섀도우 셰이더로 덮어쓴 캐스터 배치 (모든 라이트/캐스케이드가 재사용)
+	bool bShadowCastersCollected = false;
+	bool bWorldShadowsRendered = false;		// 섀도우 맵 인덱스 할당 + 스팟/포인트 섀도우
+	bool bLightBufferUpdated = false;
+
+private:
+	// Views[InFirstView, InFirstView + InCount)의 절두체를 한 번에 질의해 마스크에 누적
+	void QueryViewFrustums(int32 InFirstView, int32 InCount);
+
+	UWorld* World = nullptr;
+	EEngineShowFlags ShowFlags;
+
+	TArray<FSceneView> Views;
+	TMap<UStaticMeshComponent*, uint32> FrustumMasks;	// 비트 i = Views[i] 절두체와 겹침
+	bool bGathered = false;
+};
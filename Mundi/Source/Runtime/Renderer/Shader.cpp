@@ -1,53 +1,157 @@
 ﻿#include "pch.h"
 #include "Shader.h"
+#include "PackedVertex.h"
+#include <filesystem>
 
 IMPLEMENT_CLASS(UShader)
 
-// 컴파일 로직을 처리하는 비공개 헬퍼 함수
-static bool CompileShaderInternal(
-	const FWideString& InFilePath,
-	const char* InEntryPoint,
-	const char* InTarget,
-	UINT InCompileFlags,
-	const D3D_SHADER_MACRO* InDefines,
-	ID3DBlob** OutBlob
-)
+// 캐시 키를 만들 때 해시한 파일 내용(Job.SourceFiles)만 컴파일러에 넘기는 include 핸들러.
+// 컴파일 도중 디스크의 파일이 바뀌어도 캐시 키와 바이트코드가 항상 같은 소스를 가리킴
+class FShaderSnapshotInclude : public ID3DInclude
 {
+public:
+	explicit FShaderSnapshotInclude(const FShaderCompileJob& InJob)
+		: Job(InJob)
+	{
+	}
+
+	HRESULT __stdcall Open(D3D_INCLUDE_TYPE IncludeType, LPCSTR pFileName, LPCVOID pParentData, LPCVOID* ppData, UINT* pBytes) override
+	{
+		// 부모가 본문이면 pParentData는 nullptr
+		const FString* ParentPath = nullptr;
+		for (const auto& Pair : OpenedFiles)
+		{
+			if (Pair.first == pParentData)
+			{
+				ParentPath = &Pair.second;
+				break;
+			}
+		}
+		const FString RootPath = FShaderIncludeResolver::NormalizeShaderPath(Job.SourcePath);
+		const FString Path = FShaderIncludeResolver::ResolveIncludePath(ParentPath ? *ParentPath : RootPath, pFileName);
+
+		const std::shared_ptr<const FString>* Contents = Job.SourceFiles.Find(Path);
+		if (!Contents || !*Contents)
+		{
+			return E_FAIL;
+		}
+		*ppData = (*Contents)->data();
+		*pBytes = static_cast<UINT>((*Contents)->size());
+		OpenedFiles.push_back({ *ppData, Path });
+		return S_OK;
+	}
+
+	HRESULT __stdcall Close(LPCVOID pData) override
+	{
+		// 내용은 Job.SourceFiles가 소유
+		return S_OK;
+	}
+
+private:
+	const FShaderCompileJob& Job;
+	TArray<std::pair<LPCVOID, FString>> OpenedFiles;
+};
+
+// 로드된 d3dcompiler DLL의 버전/파일 정보 (바뀌면 캐시 키가 바뀌어 다시 컴파일)
+static FString GetShaderCompilerId()
+{
+	FString CompilerId = "d3dcompiler_" + std::to_string(D3D_COMPILER_VERSION);
+
+	HMODULE Module = GetModuleHandleW(D3DCOMPILER_DLL_W);
+	wchar_t ModulePath[MAX_PATH] = {};
+	if (Module && GetModuleFileNameW(Module, ModulePath, MAX_PATH) > 0)
+	{
+		std::error_code Ec;
+		const uint64 FileSize = std::filesystem::file_size(ModulePath, Ec);
+		const auto WriteTime = std::filesystem::last_write_time(ModulePath, Ec);
+		CompilerId += "|" + std::to_string(FileSize) + "|" + std::to_string(WriteTime.time_since_epoch().count());
+	}
+	return CompilerId;
+}
+
+// FShaderCompileManager가 워커 스레드에서 부르는 실제 컴파일러 (D3DCompile은 스레드 안전)
+static bool CompileShaderBytecode(const FShaderCompileJob& InJob, TArray<uint8>& OutBytecode, FString& OutError)
+{
+	const FString RootPath = FShaderIncludeResolver::NormalizeShaderPath(InJob.SourcePath);
+	const std::shared_ptr<const FString>* RootContents = InJob.SourceFiles.Find(RootPath);
+	if (!RootContents || !*RootContents)
+	{
+		OutError = "Shader source snapshot missing: " + InJob.SourcePath;
+		return false;
+	}
+
+	TArray<D3D_SHADER_MACRO> Defines;
+	Defines.reserve(InJob.Macros.Num() + 1);
+	for (const FShaderMacro& Macro : InJob.Macros)
+	{
+		Defines.push_back({ Macro.Name.c_str(), Macro.Definition.c_str() });
+	}
+	Defines.push_back({ NULL, NULL }); // 배열의 끝을 알리는 NULL 터미네이터
+
+	FShaderSnapshotInclude Include(InJob);
+	ID3DBlob* Blob = nullptr;
 	ID3DBlob* ErrorBlob = nullptr;
-	HRESULT Hr = D3DCompileFromFile(
-		InFilePath.c_str(),
-		InDefines,
-		D3D_COMPILE_STANDARD_FILE_INCLUDE,
-		InEntryPoint,
-		InTarget,
-		InCompileFlags,
+	HRESULT Hr = D3DCompile(
+		(*RootContents)->data(),
+		(*RootContents)->size(),
+		InJob.SourcePath.c_str(),
+		Defines.data(),
+		&Include,
+		InJob.EntryPoint.c_str(),
+		InJob.Profile.c_str(),
+		InJob.CompileFlags,
 		0,
-		OutBlob,
+		&Blob,
 		&ErrorBlob
 	);
 
 	if (FAILED(Hr))
 	{
-		if (ErrorBlob)
-		{
-			char* Msg = (char*)ErrorBlob->GetBufferPointer();
-
-			// wstring을 UTF-8로 안전하게 변환 (한글 경로 지원)
-			std::string NarrowPath = WideToUTF8(InFilePath);
-
-			// Msg에 %가 포함될 수 있으므로 직접 출력 (포맷 문자열로 해석되지 않도록)
-			std::string ErrorMessage = "Shader '" + NarrowPath + "' compile error: " + std::string(Msg);
-			UE_LOG("%s", ErrorMessage.c_str());
-			ErrorBlob->Release();
-		}
-		if (*OutBlob) { (*OutBlob)->Release(); }
+		// 로그는 게임 스레드에서 (Msg에 %가 포함될 수 있으므로 문자열로만 보관)
+		OutError = ErrorBlob ? FString(static_cast<const char*>(ErrorBlob->GetBufferPointer())) : FString("D3DCompile failed");
+		if (ErrorBlob) { ErrorBlob->Release(); }
+		if (Blob) { Blob->Release(); }
 		return false;
 	}
 
+	const uint8* Bytes = static_cast<const uint8*>(Blob->GetBufferPointer());
+	OutBytecode.assign(Bytes, Bytes + Blob->GetBufferSize());
+	Blob->Release();
 	if (ErrorBlob) { ErrorBlob->Release(); }
 	return true;
 }
 
+// 캐시/컴파일러가 돌려준 바이트코드를 ID3DBlob으로 (InputLayout 생성 등 기존 사용처 유지)
+static ID3DBlob* CreateBlobFromBytecode(const TArray<uint8>& InBytecode)
+{
+	ID3DBlob* Blob = nullptr;
+	if (FAILED(D3DCreateBlob(InBytecode.size(), &Blob)))
+	{
+		return nullptr;
+	}
+	memcpy(Blob->GetBufferPointer(), InBytecode.data(), InBytecode.size());
+	return Blob;
+}
+
+uint32 UShader::GetCompileFlags()
+{
+	UINT CompileFlags = 0;
+#if defined(DEBUG) || defined(_DEBUG)
+	CompileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
+#endif
+	return CompileFlags;
+}
+
+FShaderCompileManager& UShader::GetCompileManager()
+{
+	FShaderCompileManager& Manager = FShaderCompileManager::GetInstance();
+	if (!Manager.IsInitialized())
+	{
+		Manager.Initialize(GCacheDir + "/Shaders", CompileShaderBytecode, GetShaderCompilerId());
+	}
+	return Manager;
+}
+
 UShader::~UShader()
 {
 	ReleaseResources();
@@ -84,21 +188,10 @@ void UShader::Load(const FString& InShaderPath, ID3D11Device* InDevice, const TA
 {
 	assert(InDevice);
 
-	// 1. 최초 로드 시에만 파일 경로 및 타임스탬프 처리
+	// 1. 최초 로드 시에만 파일 경로 및 include 처리
 	if (FilePath.empty())
 	{
-		FilePath = InShaderPath;
-		try
-		{
-			auto FileTime = std::filesystem::last_write_time(FilePath);
-			SetLastModifiedTime(FileTime);
-		}
-		catch (...)
-		{
-			SetLastModifiedTime(std::filesystem::file_time_type::clock::now());
-		}
-		// Include 파일 파싱 (최초 1회)
-		ParseIncludeFiles(FilePath);
+		InitializeSource(InShaderPath);
 	}
 
 	// 2. 실제 컴파일/가져오기 로직은 GetOrCompileShaderVariant에 위임
@@ -106,6 +199,29 @@ void UShader::Load(const FString& InShaderPath, ID3D11Device* InDevice, const TA
 	GetOrCompileShaderVariant(InDevice, InMacros);
 }
 
+void UShader::InitializeSource(const FString& InShaderPath)
+{
+	FilePath = InShaderPath;
+	try
+	{
+		auto FileTime = std::filesystem::last_write_time(FilePath);
+		SetLastModifiedTime(FileTime);
+	}
+	catch (...)
+	{
+		SetLastModifiedTime(std::filesystem::file_time_type::clock::now());
+	}
+	RefreshSourceInfo();
+}
+
+void UShader::RefreshSourceInfo()
+{
+	FShaderSourceInfo Info;
+	GetCompileManager().ResolveSource(FilePath, Info);
+	IncludedFiles = std::move(Info.Dependencies);
+	SourceHash = Info.SourceHash;
+}
+
 /**
  * @brief 외부(예: UMaterial)에서 특정 매크로 조합의 Variant를 요청할 때 사용합니다.
  * 1. 이 셰이더 객체(ActualFilePath)에 대해 해당 매크로 Variant가 이미 컴파일되었는지 확인합니다.
@@ -136,17 +252,15 @@ FShaderVariant* UShader::GetOrCompileShaderVariant(ID3D11Device* InDevice, const
 		return Found; // 찾았으면 즉시 반환
 	}
 
-	// 3. 맵에 없음 -> 새로 컴파일
-	FShaderVariant NewShaderVariant;
-	bool bSuccess = CompileVariantInternal(InDevice, FilePath, InMacros, NewShaderVariant);
+	// 3. 맵에 없음 -> 새로 컴파일 (캐시 조회 후 미스만 컴파일, 성공 시 맵에 추가됨)
+	TArray<TPair<UShader*, TArray<FShaderMacro>>> Requests;
+	Requests.emplace_back(this, InMacros);
+	PrecompileVariants(InDevice, Requests);
 
-	if (bSuccess)
+	if (FShaderVariant* Compiled = ShaderVariantMap.Find(Key))
 	{
-		// 4. 맵에 추가하고, 새로 추가된 항목의 포인터(주소)를 반환
-		// TMap::Add()는 추가된 FShaderVariant의 레퍼런스를 포함하는 TPair를 반환합니다.
-		// .Value의 주소를 가져옵니다.
-		ShaderVariantMap.Add(Key, NewShaderVariant);
-		return &ShaderVariantMap[Key];
+		// 4. 새로 추가된 항목의 포인터(주소)를 반환
+		return Compiled;
 	}
 
 	// 5. 컴파일 실패
@@ -159,38 +273,8 @@ FShaderVariant* UShader::GetOrCompileShaderVariant(ID3D11Device* InDevice, const
 	return nullptr;
 }
 
-/**
- * @brief [신규] 실제 컴파일 로직을 수행하는 private 헬퍼 함수입니다.
- * @param InDevice D3D 디바이스
- * @param InShaderPath 컴파일할 .hlsl 파일 경로 (ActualFilePath)
- * @param InMacros 컴파일에 사용할 매크로
- * @param OutVariant [출력] 컴파일된 리소스(Blob, Shader, Layout)가 채워질 구조체
- * @return 컴파일 성공 시 true, 실패 시 false
- */
-bool UShader::CompileVariantInternal(ID3D11Device* InDevice, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& OutVariant)
+void UShader::AppendCompileJobs(const TArray<FShaderMacro>& InMacros, TArray<FShaderCompileJob>& OutJobs) const
 {
-	FWideString WFilePath = UTF8ToWide(InShaderPath);
-
-	// --- 1. D3D_SHADER_MACRO* 형태로 변환 ---
-	TArray<D3D_SHADER_MACRO> Defines;
-	TArray<TPair<FString, FString>> MacroStrings; // 포인터 유효성 유지를 위한 저장소
-	MacroStrings.reserve(InMacros.Num());
-	for (const FShaderMacro& Macro : InMacros)
-	{
-		MacroStrings.emplace_back(
-			FString(Macro.Name.begin(), Macro.Name.end()),
-			FString(Macro.Definition.begin(), Macro.Definition.end())
-		);
-		Defines.push_back({ MacroStrings.back().first.c_str(), MacroStrings.back().second.c_str() });
-	}
-	Defines.push_back({ NULL, NULL }); // 배열의 끝을 알리는 NULL 터미네이터
-
-	// --- 2. 컴파일 플래그 설정 ---
-	UINT CompileFlags = 0;
-#if defined(DEBUG) || defined(_DEBUG)
-	CompileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
-#endif
-
 	auto EndsWith = [](const FString& str, const FString& suffix)
 		{
 			if (str.size() < suffix.size()) return false;
@@ -198,53 +282,148 @@ bool UShader::CompileVariantInternal(ID3D11Device* InDevice, const FString& InSh
 				[](char a, char b) { return static_cast<char>(::tolower(a)) == static_cast<char>(::tolower(b)); });
 		};
 
+	FShaderCompileJob Job;
+	Job.SourcePath = FilePath;
+	Job.Macros = InMacros;
+	Job.MacroKey = GenerateShaderKey(InMacros);
+	Job.CompileFlags = GetCompileFlags();
+
+	// _VS.hlsl은 VS만, _PS.hlsl은 PS만, 나머지는 VS + PS
+	const bool bPixelOnly = EndsWith(FilePath, "_PS.hlsl");
+	const bool bVertexOnly = EndsWith(FilePath, "_VS.hlsl");
+	if (!bPixelOnly)
+	{
+		Job.EntryPoint = "mainVS";
+		Job.Profile = "vs_5_0";
+		OutJobs.push_back(Job);
+	}
+	if (!bVertexOnly)
+	{
+		Job.EntryPoint = "mainPS";
+		Job.Profile = "ps_5_0";
+		OutJobs.push_back(Job);
+	}
+}
+
+/**
+ * @brief 컴파일(또는 캐시에서 읽은) 바이트코드로 셰이더/InputLayout을 만듭니다. 디바이스 호출이므로 게임 스레드 전용.
+ * @param InJobs 이 Variant의 스테이지별 작업 (AppendCompileJobs 순서: VS, PS)
+ * @return VS 또는 PS 둘 중 하나라도 성공 시 true
+ */
+bool UShader::CreateVariant(ID3D11Device* InDevice, const TArray<FShaderMacro>& InMacros, const FShaderCompileJob* InJobs, int32 InJobCount, FShaderVariant& OutVariant)
+{
 	HRESULT Hr;
 	bool bVsCompiled = false;
 	bool bPsCompiled = false;
 
-	// --- 3. 컴파일 결과를 OutVariant에 저장 ---
-	if (EndsWith(InShaderPath, "_VS.hlsl"))
+	for (int32 i = 0; i < InJobCount; ++i)
 	{
-		bVsCompiled = CompileShaderInternal(WFilePath, "mainVS", "vs_5_0", CompileFlags, Defines.data(), &OutVariant.VSBlob);
-		if (bVsCompiled)
+		const FShaderCompileJob& Job = InJobs[i];
+		if (!Job.bSucceeded)
 		{
+			// Msg에 %가 포함될 수 있으므로 직접 출력 (포맷 문자열로 해석되지 않도록)
+			std::string ErrorMessage = "Shader '" + Job.SourcePath + "' compile error: " + Job.ErrorMessage;
+			UE_LOG("%s", ErrorMessage.c_str());
+			continue;
+		}
+
+		if (Job.Profile[0] == 'v')
+		{
+			OutVariant.VSBlob = CreateBlobFromBytecode(Job.Bytecode);
+			if (!OutVariant.VSBlob)
+			{
+				continue;
+			}
 			Hr = InDevice->CreateVertexShader(OutVariant.VSBlob->GetBufferPointer(), OutVariant.VSBlob->GetBufferSize(), nullptr, &OutVariant.VertexShader);
 			assert(SUCCEEDED(Hr));
-			CreateInputLayout(InDevice, InShaderPath, OutVariant); // OutVariant 전달
+			CreateInputLayout(InDevice, FilePath, InMacros, OutVariant);
+			bVsCompiled = true;
 		}
-	}
-	else if (EndsWith(InShaderPath, "_PS.hlsl"))
-	{
-		bPsCompiled = CompileShaderInternal(WFilePath, "mainPS", "ps_5_0", CompileFlags, Defines.data(), &OutVariant.PSBlob);
-		if (bPsCompiled)
+		else
 		{
+			OutVariant.PSBlob = CreateBlobFromBytecode(Job.Bytecode);
+			if (!OutVariant.PSBlob)
+			{
+				continue;
+			}
 			Hr = InDevice->CreatePixelShader(OutVariant.PSBlob->GetBufferPointer(), OutVariant.PSBlob->GetBufferSize(), nullptr, &OutVariant.PixelShader);
 			assert(SUCCEEDED(Hr));
+			bPsCompiled = true;
 		}
 	}
-	else // (VS + PS)
-	{
-		bVsCompiled = CompileShaderInternal(WFilePath, "mainVS", "vs_5_0", CompileFlags, Defines.data(), &OutVariant.VSBlob);
-		bPsCompiled = CompileShaderInternal(WFilePath, "mainPS", "ps_5_0", CompileFlags, Defines.data(), &OutVariant.PSBlob);
 
-		if (bVsCompiled)
+	// 핫 리로드용 매크로 저장
+	OutVariant.SourceMacros = InMacros;
+
+	return bVsCompiled || bPsCompiled;
+}
+
+void UShader::PrecompileVariants(ID3D11Device* InDevice, const TArray<TPair<UShader*, TArray<FShaderMacro>>>& InRequests)
+{
+	assert(InDevice);
+
+	struct FPendingVariant
+	{
+		UShader* Shader;
+		const TArray<FShaderMacro>* Macros;
+		FString Key;
+		int32 FirstJob;
+		int32 JobCount;
+	};
+
+	// 1. 아직 없는 Variant만 작업으로 (같은 요청이 여러 번 와도 한 번)
+	TArray<FShaderCompileJob> Jobs;
+	TArray<FPendingVariant> Pending;
+	TSet<FString> PendingKeys;
+	for (const TPair<UShader*, TArray<FShaderMacro>>& Request : InRequests)
+	{
+		UShader* Shader = Request.first;
+		if (!Shader || Shader->FilePath.empty())
 		{
-			Hr = InDevice->CreateVertexShader(OutVariant.VSBlob->GetBufferPointer(), OutVariant.VSBlob->GetBufferSize(), nullptr, &OutVariant.VertexShader);
-			assert(SUCCEEDED(Hr));
-			CreateInputLayout(InDevice, InShaderPath, OutVariant);
+			continue;
 		}
-		if (bPsCompiled)
+
+		FString Key = GenerateShaderKey(Request.second);
+		if (Shader->ShaderVariantMap.Find(Key) || PendingKeys.Contains(Shader->FilePath + "|" + Key))
 		{
-			Hr = InDevice->CreatePixelShader(OutVariant.PSBlob->GetBufferPointer(), OutVariant.PSBlob->GetBufferSize(), nullptr, &OutVariant.PixelShader);
-			assert(SUCCEEDED(Hr));
+			continue;
 		}
+		PendingKeys.Add(Shader->FilePath + "|" + Key);
+
+		const int32 FirstJob = Jobs.Num();
+		Shader->AppendCompileJobs(Request.second, Jobs);
+		Pending.push_back({ Shader, &Request.second, std::move(Key), FirstJob, Jobs.Num() - FirstJob });
 	}
 
-	// 4. 핫 리로드용 매크로 저장
-	OutVariant.SourceMacros = InMacros;
+	if (Pending.empty())
+	{
+		return;
+	}
 
-	// 5. 컴파일 성공 여부 반환 (VS 또는 PS 둘 중 하나라도 성공 시)
-	return bVsCompiled || bPsCompiled;
+	// 2. 캐시 조회 + 미스 병렬 컴파일
+	FShaderCompileManager& Manager = GetCompileManager();
+	Manager.CompileBatch(Jobs);
+
+	const FShaderCompileStats& Stats = Manager.GetStats();
+	if (Stats.LastBatchCompiled > 0)
+	{
+		UE_LOG("Shader compile: %u jobs, %u compiled, %u cache hits, %.2f ms",
+			Stats.LastBatchJobs, Stats.LastBatchCompiled, Stats.LastBatchHits, Stats.LastBatchMs);
+	}
+
+	// 3. 디바이스 객체 생성은 게임 스레드에서
+	for (FPendingVariant& Variant : Pending)
+	{
+		FShaderVariant NewShaderVariant;
+		if (Variant.Shader->CreateVariant(InDevice, *Variant.Macros, Jobs.data() + Variant.FirstJob, Variant.JobCount, NewShaderVariant))
+		{
+			Variant.Shader->ShaderVariantMap.Add(Variant.Key, NewShaderVariant);
+		}
+		else
+		{
+			NewShaderVariant.Release();
+		}
+	}
 }
 
 FShaderVariant* UShader::GetShaderVariant(const TArray<FShaderMacro>& InMacros)
@@ -283,9 +462,13 @@ ID3D11PixelShader* UShader::GetPixelShader(const TArray<FShaderMacro>& InMacros)
 	return nullptr;
 }
 
-void UShader::CreateInputLayout(ID3D11Device* Device, const FString& InShaderPath, FShaderVariant& InOutVariant)
+void UShader::CreateInputLayout(ID3D11Device* Device, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& InOutVariant)
 {
-	TArray<D3D11_INPUT_ELEMENT_DESC> descArray = UResourceManager::GetInstance().GetProperInputLayout(InShaderPath);
+	// 패킹 정점 Variant는 셰이더 경로와 무관하게 매크로가 나타내는 패킹 레이아웃 사용
+	FPackedVertexFormat PackedFormat;
+	TArray<D3D11_INPUT_ELEMENT_DESC> descArray = FPackedVertexFormat::FromShaderMacros(InMacros, PackedFormat)
+		? PackedFormat.GetInputLayout()
+		: UResourceManager::GetInstance().GetProperInputLayout(InShaderPath);
 	const D3D11_INPUT_ELEMENT_DESC* layout = descArray.data();
 	uint32 layoutCount = static_cast<uint32>(descArray.size());
 
@@ -314,55 +497,21 @@ void UShader::ReleaseResources()
 
 bool UShader::IsOutdated() const
 {
-	// Use the stored actual file path (not the unique key with macros)
 	if (FilePath.empty())
 	{
 		return false; // No file path stored
 	}
 
-	try
-	{
-		if (!std::filesystem::exists(FilePath))
-		{
-			return false; // File doesn't exist, not outdated
-		}
-
-		// 메인 shader 파일 timestamp 체크
-		auto CurrentFileTime = std::filesystem::last_write_time(FilePath);
-		if (CurrentFileTime > GetLastModifiedTime())
-		{
-			return true;
-		}
-
-		// Include 파일들의 timestamp 체크
-		for (const auto& Pair : IncludedFileTimestamps)
-		{
-			const FString& IncludedFile = Pair.first;
-			const auto& StoredTime = Pair.second;
-
-			// Include 파일이 존재하는지 확인
-			if (!std::filesystem::exists(IncludedFile))
-			{
-				continue; // 파일이 없으면 건너뛰기
-			}
-
-			// Include 파일의 현재 timestamp 확인
-			auto CurrentIncludeTime = std::filesystem::last_write_time(IncludedFile);
-			if (CurrentIncludeTime > StoredTime)
-			{
-				return true; // Include 파일이 변경됨
-			}
-		}
-
-		return false; // 모든 파일이 최신 상태
-	}
-	catch (...)
+	// 타임스탬프 대신 include를 펼친 소스 해시 비교 (바뀐 파일은 호출 측이 InvalidateFiles로 먼저 버려야 함)
+	FShaderSourceInfo Info;
+	if (!GetCompileManager().ResolveSource(FilePath, Info))
 	{
-		return false; // Error checking file, assume not outdated
+		return false; // File doesn't exist, not outdated
 	}
+	return Info.SourceHash != SourceHash;
 }
 
- // 셰이더 파일(.hlsl) 또는 그 #include 파일이 변경되었을 때, 이 셰이더가 관리하는 모든 Variant를 다시 컴파일합니다.
+ // 셰이더 파일(.hlsl) 또는 그 #include 파일의 내용이 바뀌었을 때, 이 셰이더가 관리하는 모든 Variant를 한 배치로 다시 컴파일합니다.
 bool UShader::Reload(ID3D11Device* InDevice)
 {
 	// 1. 유효성 검사 및 핫 리로드 필요 여부 확인
@@ -377,7 +526,7 @@ bool UShader::Reload(ID3D11Device* InDevice)
 		return false;
 	}
 
-	// IsOutdated()는 메인 파일과 Include 파일들을 모두 검사합니다.
+	// IsOutdated()는 메인 파일과 Include 파일들을 모두 포함한 소스 해시를 검사합니다.
 	if (!IsOutdated())
 	{
 		return false; // 변경 사항 없음
@@ -388,20 +537,22 @@ bool UShader::Reload(ID3D11Device* InDevice)
 	// 2. [백업] 현재 맵을 Old 맵으로 이동시킵니다.
 	// (ShaderVariantMap은 이제 비어있습니다)
 	TMap<FString, FShaderVariant> OldShaderVariantMap = std::move(ShaderVariantMap);
+	ShaderVariantMap.Empty();
 
-	bool bAllReloadsSuccessful = true;
+	// 3. [재컴파일] Old 맵에 있던 모든 Variant를 한 배치로 (캐시 미스는 병렬, 되돌린 편집은 캐시 히트)
+	TArray<TPair<UShader*, TArray<FShaderMacro>>> Requests;
+	Requests.reserve(OldShaderVariantMap.size());
+	for (auto& Pair : OldShaderVariantMap)
+	{
+		Requests.emplace_back(this, Pair.second.SourceMacros);
+	}
+	PrecompileVariants(InDevice, Requests);
 
-	// 3. [재시도] Old 맵에 있던 모든 Variant에 대해 Load를 다시 호출합니다.
+	// 4. [검증] 새로 컴파일된 Variant가 유효한지 확인
+	bool bAllReloadsSuccessful = true;
 	for (auto& Pair : OldShaderVariantMap)
 	{
 		const FString& Key = Pair.first;
-		const TArray<FShaderMacro>& MacrosToReload = Pair.second.SourceMacros;
-
-		// Load() 함수는 (이제 비어있는) ShaderVariantMap에
-		// Variant가 없으므로 새로 컴파일을 시도합니다.
-		Load(FilePath, InDevice, MacrosToReload);
-
-		// 4. [검증] 새로 컴파일된 Variant가 유효한지 확인
 		FShaderVariant* NewVariant = ShaderVariantMap.Find(Key); // 새로 로드된 맵에서 찾기
 
 		if (!NewVariant || (!NewVariant->VertexShader && !NewVariant->PixelShader))
@@ -439,13 +590,13 @@ bool UShader::Reload(ID3D11Device* InDevice)
 		}
 		OldShaderVariantMap.Empty();
 
-		// 갱신된 타임스탬프를 설정합니다.
+		// 새 소스 해시/include 목록을 기록합니다.
 		try
 		{
 			SetLastModifiedTime(std::filesystem::last_write_time(FilePath));
-			UpdateIncludeTimestamps(); // Include 파일 타임스탬프도 갱신
 		}
 		catch (...) { /* 무시 */ }
+		RefreshSourceInfo();
 
 		return true;
 	}
@@ -465,129 +616,3 @@ bool UShader::Reload(ID3D11Device* InDevice)
 		return false;
 	}
 }
-
-// Include 파일 파싱 (재귀적으로 처리)
-void UShader::ParseIncludeFiles(const FString& ShaderPath)
-{
-	// 이미 파싱된 파일 목록 초기화
-	IncludedFiles.clear();
-
-	// 파싱할 파일 큐
-	TArray<FString> FilesToParse;
-	FilesToParse.push_back(ShaderPath);
-
-	// 이미 파싱한 파일 추적 (중복 방지 및 순환 참조 방지)
-	TSet<FString> ParsedFiles;
-
-	while (!FilesToParse.empty())
-	{
-		FString CurrentFile = FilesToParse.back();
-		FilesToParse.pop_back();
-
-		// 이미 파싱한 파일은 건너뛰기
-		if (ParsedFiles.find(CurrentFile) != ParsedFiles.end())
-		{
-			continue;
-		}
-		ParsedFiles.insert(CurrentFile);
-
-		// 파일 존재 여부 확인
-		if (!std::filesystem::exists(CurrentFile))
-		{
-			continue;
-		}
-
-		// 파일 열기
-		std::ifstream File(CurrentFile);
-		if (!File.is_open())
-		{
-			continue;
-		}
-
-		// 현재 파일의 디렉토리 경로
-		std::filesystem::path CurrentDir = std::filesystem::path(CurrentFile).parent_path();
-
-		// 한 줄씩 읽으며 #include 찾기
-		FString Line;
-		while (std::getline(File, Line))
-		{
-			// 공백 제거
-			size_t FirstNonSpace = Line.find_first_not_of(" \t\r\n");
-			if (FirstNonSpace == FString::npos)
-			{
-				continue;
-			}
-			Line = Line.substr(FirstNonSpace);
-
-			// #include 지시문 찾기
-			if (Line.compare(0, 8, "#include") == 0)
-			{
-				// #include "filename" 패턴 파싱
-				size_t QuoteStart = Line.find('"');
-				size_t QuoteEnd = Line.find('"', QuoteStart + 1);
-
-				if (QuoteStart != FString::npos && QuoteEnd != FString::npos)
-				{
-					FString IncludedFile = Line.substr(QuoteStart + 1, QuoteEnd - QuoteStart - 1);
-
-					// 상대 경로 해석
-					std::filesystem::path IncludePath;
-					if (std::filesystem::path(IncludedFile).is_absolute())
-					{
-						IncludePath = IncludedFile;
-					}
-					else
-					{
-						IncludePath = CurrentDir / IncludedFile;
-					}
-
-					// 경로 정규화
-					try
-					{
-						IncludePath = std::filesystem::canonical(IncludePath);
-						FString NormalizedPath = IncludePath.string();
-
-						// 포함된 파일 목록에 추가
-						if (std::find(IncludedFiles.begin(), IncludedFiles.end(), NormalizedPath) == IncludedFiles.end())
-						{
-							IncludedFiles.push_back(NormalizedPath);
-							// 재귀적으로 파싱하기 위해 큐에 추가
-							FilesToParse.push_back(NormalizedPath);
-						}
-					}
-					catch (...)
-					{
-						// 파일이 존재하지 않거나 경로 오류 - 무시
-					}
-				}
-			}
-		}
-
-		File.close();
-	}
-
-	// Include 파일들의 timestamp 업데이트
-	UpdateIncludeTimestamps();
-}
-
-// Include 파일들의 timestamp 업데이트
-void UShader::UpdateIncludeTimestamps()
-{
-	IncludedFileTimestamps.clear();
-
-	for (const FString& IncludedFile : IncludedFiles)
-	{
-		try
-		{
-			if (std::filesystem::exists(IncludedFile))
-			{
-				auto FileTime = std::filesystem::last_write_time(IncludedFile);
-				IncludedFileTimestamps[IncludedFile] = FileTime;
-			}
-		}
-		catch (...)
-		{
-			// 파일 타임스탬프 읽기 실패 - 무시
-		}
-	}
-}
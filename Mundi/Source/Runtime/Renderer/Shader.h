@@ -1,19 +1,8 @@
 ﻿#pragma once
 #include "ResourceBase.h"
+#include "ShaderCache.h"
 #include <filesystem>
 
-struct FShaderMacro
-{
-	FString Name;
-	FString Definition;
-
-	// TMap의 키로 사용하기 위해 비교 연산자 정의
-	bool operator==(const FShaderMacro& Other) const
-	{
-		return Name == Other.Name && Definition == Other.Definition;
-	}
-};
-
 // 단일 셰이더 파일의 여러 변형 중 하나
 struct FShaderVariant
 {
@@ -46,16 +35,28 @@ public:
 
 	void Load(const FString& ShaderPath, ID3D11Device* InDevice, const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 
+	// 경로/include 목록만 설정 (컴파일 없이 리소스 등록할 때. Load가 최초 1회 호출)
+	void InitializeSource(const FString& InShaderPath);
+
+	// 여러 셰이더의 Variant를 한 배치로 컴파일 (캐시 미스는 워커 스레드에서 병렬). 이미 있는 Variant는 건너뜀
+	static void PrecompileVariants(ID3D11Device* InDevice, const TArray<TPair<UShader*, TArray<FShaderMacro>>>& InRequests);
+
 	FShaderVariant* GetOrCompileShaderVariant(ID3D11Device* InDevice, const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
-	bool CompileVariantInternal(ID3D11Device* InDevice, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& OutVariant);
 	FShaderVariant* GetShaderVariant(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 	ID3D11InputLayout* GetInputLayout(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 	ID3D11VertexShader* GetVertexShader(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 	ID3D11PixelShader* GetPixelShader(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 
 	// Hot Reload Support
+	// include를 펼친 소스 해시가 마지막 컴파일 때와 다르면 true (저장만 하고 내용이 같으면 false)
 	bool IsOutdated() const;
 	bool Reload(ID3D11Device* InDevice);
+	const TArray<FString>& GetIncludedFiles() const { return IncludedFiles; }
+	uint64 GetSourceHash() const { return SourceHash; }
+
+	static uint32 GetCompileFlags();
+	// 엔진 기본 컴파일러(D3DCompile + 스냅샷 include)와 DerivedDataCache/Shaders 캐시로 초기화된 매니저
+	static FShaderCompileManager& GetCompileManager();
 	//const TArray<FShaderMacro>& GetMacros() const { return Macros; }
 	
 protected:
@@ -67,14 +68,18 @@ private:
 	// Store included files (e.g., "Shaders/Common/LightingCommon.hlsl")
 	// Used for hot reload - if any included file changes, reload this shader
 	TArray<FString> IncludedFiles;
-	TMap<FString, std::filesystem::file_time_type> IncludedFileTimestamps;
+	uint64 SourceHash = 0;
 
-	void CreateInputLayout(ID3D11Device* Device, const FString& InShaderPath, FShaderVariant& InOutVariant);
+	void CreateInputLayout(ID3D11Device* Device, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& InOutVariant);
 	void ReleaseResources();
 
-	// Include 파일 파싱 및 추적
-	void ParseIncludeFiles(const FString& ShaderPath);
-	void UpdateIncludeTimestamps();
+	// 현재 파일 내용 기준으로 IncludedFiles/SourceHash 갱신
+	void RefreshSourceInfo();
+
+	// 파일 이름 규칙(_VS/_PS)에 맞는 스테이지별 컴파일 작업 추가
+	void AppendCompileJobs(const TArray<FShaderMacro>& InMacros, TArray<FShaderCompileJob>& OutJobs) const;
+	// 컴파일 결과(바이트코드)로 디바이스 객체 생성. VS/PS 둘 중 하나라도 성공하면 true
+	bool CreateVariant(ID3D11Device* InDevice, const TArray<FShaderMacro>& InMacros, const FShaderCompileJob* InJobs, int32 InJobCount, FShaderVariant& OutVariant);
 };
 
 struct FVertexPositionColor
@@ -0,0 +1,530 @@
+﻿#include "pch.h"
+#include "ShaderCache.h"
+#include "ParallelFor.h"
+#include "WindowsBinReader.h"
+#include "WindowsBinWriter.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+	bool ReadFileFromDisk(const FString& InPath, FString& OutContents)
+	{
+		std::ifstream File(std::filesystem::path(InPath), std::ios::binary);
+		if (!File.is_open())
+		{
+			return false;
+		}
+		std::ostringstream Stream;
+		Stream << File.rdbuf();
+		OutContents = Stream.str();
+		return true;
+	}
+
+	// "#include "X"" / "# include <X>" 이면 X를 돌려줌
+	bool ParseIncludeDirective(const FString& InLine, FString& OutName)
+	{
+		size_t Pos = InLine.find_first_not_of(" \t");
+		if (Pos == FString::npos || InLine[Pos] != '#')
+		{
+			return false;
+		}
+		Pos = InLine.find_first_not_of(" \t", Pos + 1);
+		if (Pos == FString::npos || InLine.compare(Pos, 7, "include") != 0)
+		{
+			return false;
+		}
+		const size_t Open = InLine.find_first_of("\"<", Pos + 7);
+		if (Open == FString::npos)
+		{
+			return false;
+		}
+		const size_t Close = InLine.find(InLine[Open] == '"' ? '"' : '>', Open + 1);
+		if (Close == FString::npos || Close == Open + 1)
+		{
+			return false;
+		}
+		OutName = InLine.substr(Open + 1, Close - Open - 1);
+		return true;
+	}
+
+	FString ToHex(uint64 InValue)
+	{
+		char Buffer[17];
+		snprintf(Buffer, sizeof(Buffer), "%016llx", static_cast<unsigned long long>(InValue));
+		return Buffer;
+	}
+
+	uint64 HashKeyString(const FString& InKeyString)
+	{
+		FShaderHash Hash;
+		Hash.Update(InKeyString);
+		return Hash.Value;
+	}
+}
+
+// ──────────────────────────────
+// FShaderIncludeResolver
+// ──────────────────────────────
+FShaderIncludeResolver::FShaderIncludeResolver(FShaderFileReader InReader)
+	: Reader(InReader ? std::move(InReader) : FShaderFileReader(ReadFileFromDisk))
+{
+}
+
+FString FShaderIncludeResolver::NormalizeShaderPath(const FString& InPath)
+{
+	return std::filesystem::path(InPath).lexically_normal().generic_string();
+}
+
+FString FShaderIncludeResolver::ResolveIncludePath(const FString& InIncludingFile, const FString& InIncludeName)
+{
+	const std::filesystem::path IncludePath(InIncludeName);
+	if (IncludePath.is_absolute())
+	{
+		return NormalizeShaderPath(InIncludeName);
+	}
+	return (std::filesystem::path(InIncludingFile).parent_path() / IncludePath).lexically_normal().generic_string();
+}
+
+void FShaderIncludeResolver::Invalidate(const FString& InPath)
+{
+	Files.erase(NormalizeShaderPath(InPath));
+}
+
+const FShaderIncludeResolver::FParsedFile& FShaderIncludeResolver::GetParsedFile(const FString& InPath)
+{
+	if (const FParsedFile* Found = Files.Find(InPath))
+	{
+		return *Found;
+	}
+
+	FParsedFile& Parsed = Files[InPath];
+	auto ContentsPtr = std::make_shared<FString>();
+	Parsed.bExists = Reader(InPath, *ContentsPtr);
+	if (!Parsed.bExists)
+	{
+		return Parsed;
+	}
+	Parsed.Contents = ContentsPtr;
+	const FString& Contents = *ContentsPtr;
+
+	// include 줄을 경계로 조각냄 (include 줄 자체는 펼친 소스에 남지 않으므로 해시에서도 뺌)
+	FSegment Current;
+	size_t LineStart = 0;
+	while (LineStart < Contents.size())
+	{
+		size_t LineEnd = Contents.find('\n', LineStart);
+		LineEnd = (LineEnd == FString::npos) ? Contents.size() : LineEnd + 1;
+
+		const FString Line = Contents.substr(LineStart, LineEnd - LineStart);
+		FString IncludeName;
+		if (ParseIncludeDirective(Line, IncludeName))
+		{
+			Current.Include = ResolveIncludePath(InPath, IncludeName);
+			Parsed.Segments.push_back(std::move(Current));
+			Current = FSegment();
+		}
+		else
+		{
+			Current.Text += Line;
+		}
+		LineStart = LineEnd;
+	}
+	if (!Current.Text.empty())
+	{
+		Parsed.Segments.push_back(std::move(Current));
+	}
+	return Parsed;
+}
+
+void FShaderIncludeResolver::HashRecursive(const FString& InPath, TSet<FString>& InOutVisited, FShaderHash& InOutHash, FShaderSourceInfo& OutInfo)
+{
+	if (InOutVisited.Contains(InPath))
+	{
+		return;
+	}
+	InOutVisited.Add(InPath);
+
+	const FParsedFile& Parsed = GetParsedFile(InPath);
+	if (!Parsed.bExists)
+	{
+		// 없는 include도 경로를 해시에 넣어, 나중에 파일이 생기면 키가 바뀌게 함
+		InOutHash.Update(FString("<missing>") + InPath);
+		return;
+	}
+	OutInfo.Files[InPath] = Parsed.Contents;
+
+	for (const FSegment& Segment : Parsed.Segments)
+	{
+		InOutHash.Update(Segment.Text);
+		if (Segment.Include.empty())
+		{
+			continue;
+		}
+		if (!InOutVisited.Contains(Segment.Include))
+		{
+			OutInfo.Dependencies.push_back(Segment.Include);
+		}
+		HashRecursive(Segment.Include, InOutVisited, InOutHash, OutInfo);
+	}
+}
+
+bool FShaderIncludeResolver::Resolve(const FString& InRootPath, FShaderSourceInfo& OutInfo)
+{
+	OutInfo = FShaderSourceInfo();
+
+	const FString RootPath = NormalizeShaderPath(InRootPath);
+	OutInfo.bRootFound = GetParsedFile(RootPath).bExists;
+
+	FShaderHash Hash;
+	TSet<FString> Visited;
+	HashRecursive(RootPath, Visited, Hash, OutInfo);
+	OutInfo.SourceHash = Hash.Value;
+	return OutInfo.bRootFound;
+}
+
+// ──────────────────────────────
+// FShaderBytecodeCache
+// ──────────────────────────────
+FString MakeShaderCacheKeyString(const FShaderCompileJob& InJob, uint64 InSourceHash, const FString& InCompilerId)
+{
+	char Flags[16];
+	snprintf(Flags, sizeof(Flags), "%08x", InJob.CompileFlags);
+
+	FString Key = "v" + std::to_string(FShaderBytecodeCache::Version);
+	Key += "|" + FShaderIncludeResolver::NormalizeShaderPath(InJob.SourcePath);
+	Key += "|" + ToHex(InSourceHash);
+	Key += "|" + InJob.EntryPoint + "|" + InJob.Profile + "|" + Flags;
+	Key += "|" + InJob.MacroKey;
+	Key += "|" + InCompilerId;
+	return Key;
+}
+
+void FShaderBytecodeCache::Initialize(const FString& InDirectory)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+
+	Directory = InDirectory;
+	Index.Empty();
+	TotalBytes = 0;
+
+	std::error_code Ec;
+	std::filesystem::create_directories(Directory, Ec);
+	for (const auto& Entry : std::filesystem::directory_iterator(Directory, Ec))
+	{
+		if (!Entry.is_regular_file(Ec) || Entry.path().extension() != ".shc")
+		{
+			continue;
+		}
+		try
+		{
+			const uint64 KeyHash = std::stoull(Entry.path().stem().string(), nullptr, 16);
+			const uint64 Size = Entry.file_size(Ec);
+			Index[KeyHash] = Size;
+			TotalBytes += Size;
+		}
+		catch (...)
+		{
+			// 캐시 이름 규칙이 아닌 파일은 무시
+		}
+	}
+}
+
+FString FShaderBytecodeCache::GetEntryPath(uint64 InKeyHash) const
+{
+	return Directory + "/" + ToHex(InKeyHash) + ".shc";
+}
+
+bool FShaderBytecodeCache::Find(uint64 InKeyHash, const FString& InKeyString, TArray<uint8>& OutBytecode)
+{
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		if (!Index.Find(InKeyHash))
+		{
+			return false;
+		}
+	}
+
+	const FString Path = GetEntryPath(InKeyHash);
+	bool bValid = false;
+	try
+	{
+		FWindowsBinReader Reader(Path);
+		if (Reader.IsOpen())
+		{
+			uint32 FileMagic = 0;
+			uint32 FileVersion = 0;
+			FString FileKey;
+			Reader << FileMagic << FileVersion;
+			if (FileMagic == Magic && FileVersion == Version)
+			{
+				Serialization::ReadString(Reader, FileKey);
+				if (FileKey == InKeyString)
+				{
+					Serialization::ReadArray(Reader, OutBytecode);
+					bValid = !OutBytecode.empty();
+				}
+			}
+		}
+	}
+	catch (const std::exception&)
+	{
+		bValid = false;
+	}
+
+	if (!bValid)
+	{
+		// 손상되었거나 해시 충돌 -> 엔트리를 버리고 다시 컴파일하게 함
+		std::lock_guard<std::mutex> Lock(Mutex);
+		if (const uint64* Size = Index.Find(InKeyHash))
+		{
+			TotalBytes -= *Size;
+			Index.erase(InKeyHash);
+		}
+		std::error_code Ec;
+		std::filesystem::remove(Path, Ec);
+		OutBytecode.clear();
+	}
+	return bValid;
+}
+
+bool FShaderBytecodeCache::Store(uint64 InKeyHash, const FString& InKeyString, const TArray<uint8>& InBytecode)
+{
+	if (Directory.empty() || InBytecode.empty())
+	{
+		return false;
+	}
+
+	// 임시 파일에 다 쓴 뒤 이름을 바꿔, 중간에 죽어도 반쯤 쓴 엔트리가 남지 않게 함
+	const FString Path = GetEntryPath(InKeyHash);
+	const FString TempPath = Path + ".tmp";
+	{
+		FWindowsBinWriter Writer(TempPath);
+		uint32 FileMagic = Magic;
+		uint32 FileVersion = Version;
+		Writer << FileMagic << FileVersion;
+		Serialization::WriteString(Writer, InKeyString);
+		Serialization::WriteArray(Writer, InBytecode);
+	}
+
+	std::error_code Ec;
+	std::filesystem::rename(TempPath, Path, Ec);
+	if (Ec)
+	{
+		std::filesystem::remove(TempPath, Ec);
+		return false;
+	}
+
+	const uint64 Size = std::filesystem::file_size(Path, Ec);
+	std::lock_guard<std::mutex> Lock(Mutex);
+	if (const uint64* OldSize = Index.Find(InKeyHash))
+	{
+		TotalBytes -= *OldSize;
+	}
+	Index[InKeyHash] = Size;
+	TotalBytes += Size;
+	return true;
+}
+
+void FShaderBytecodeCache::Clear()
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	std::error_code Ec;
+	for (const auto& Pair : Index)
+	{
+		std::filesystem::remove(GetEntryPath(Pair.first), Ec);
+	}
+	Index.Empty();
+	TotalBytes = 0;
+}
+
+uint32 FShaderBytecodeCache::GetEntryCount() const
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	return static_cast<uint32>(Index.Num());
+}
+
+uint64 FShaderBytecodeCache::GetTotalBytes() const
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	return TotalBytes;
+}
+
+// ──────────────────────────────
+// FShaderDependencyGraph
+// ──────────────────────────────
+void FShaderDependencyGraph::SetDependencies(const FString& InShaderPath, const TArray<FString>& InDependencies)
+{
+	RemoveShader(InShaderPath);
+
+	Dependencies[InShaderPath] = InDependencies;
+	Dependents[InShaderPath].Add(InShaderPath);
+	for (const FString& Dependency : InDependencies)
+	{
+		Dependents[Dependency].Add(InShaderPath);
+	}
+}
+
+void FShaderDependencyGraph::RemoveShader(const FString& InShaderPath)
+{
+	const TArray<FString>* OldDependencies = Dependencies.Find(InShaderPath);
+	if (!OldDependencies)
+	{
+		return;
+	}
+
+	auto Unlink = [this, &InShaderPath](const FString& InFile)
+	{
+		if (TSet<FString>* Users = Dependents.Find(InFile))
+		{
+			Users->erase(InShaderPath);
+			if (Users->empty())
+			{
+				Dependents.erase(InFile);
+			}
+		}
+	};
+
+	Unlink(InShaderPath);
+	for (const FString& Dependency : *OldDependencies)
+	{
+		Unlink(Dependency);
+	}
+	Dependencies.erase(InShaderPath);
+}
+
+void FShaderDependencyGraph::GetAffectedShaders(const TSet<FString>& InChangedFiles, TSet<FString>& OutShaderPaths) const
+{
+	for (const FString& ChangedFile : InChangedFiles)
+	{
+		if (const TSet<FString>* Users = Dependents.Find(ChangedFile))
+		{
+			for (const FString& ShaderPath : *Users)
+			{
+				OutShaderPaths.Add(ShaderPath);
+			}
+		}
+	}
+}
+
+// ──────────────────────────────
+// FShaderCompileManager
+// ──────────────────────────────
+FShaderCompileManager& FShaderCompileManager::GetInstance()
+{
+	static FShaderCompileManager Instance;
+	return Instance;
+}
+
+void FShaderCompileManager::Initialize(const FString& InCacheDirectory, FCompileFunction InCompiler, const FString& InCompilerId, FShaderFileReader InReader)
+{
+	Compiler = std::move(InCompiler);
+	CompilerId = InCompilerId;
+	Resolver = FShaderIncludeResolver(std::move(InReader));
+	Cache.Initialize(InCacheDirectory);
+	Stats = FShaderCompileStats();
+}
+
+void FShaderCompileManager::InvalidateFiles(const TSet<FString>& InChangedFiles)
+{
+	for (const FString& ChangedFile : InChangedFiles)
+	{
+		Resolver.Invalidate(ChangedFile);
+	}
+}
+
+void FShaderCompileManager::CompileBatch(TArray<FShaderCompileJob>& InOutJobs)
+{
+	const auto StartTime = std::chrono::steady_clock::now();
+	const int32 JobCount = InOutJobs.Num();
+
+	// 1. 소스 해시 -> 캐시 키 -> 캐시 조회 (게임 스레드, 리졸버 캐시 공유)
+	TArray<FString> KeyStrings(JobCount);
+	TArray<int32> DuplicateOf(JobCount, -1);
+	TArray<int32> Misses;
+	TMap<uint64, int32> FirstMissByKey;
+	uint32 HitCount = 0;
+	for (int32 i = 0; i < JobCount; ++i)
+	{
+		FShaderCompileJob& Job = InOutJobs[i];
+		Job.Bytecode.clear();
+		Job.ErrorMessage.clear();
+		Job.bSucceeded = false;
+		Job.bCacheHit = false;
+		Job.SourceFiles.Empty();
+
+		FShaderSourceInfo Info;
+		if (!Resolver.Resolve(Job.SourcePath, Info))
+		{
+			Job.ErrorMessage = "Shader source not found: " + Job.SourcePath;
+			continue;
+		}
+		Job.Dependencies = std::move(Info.Dependencies);
+		KeyStrings[i] = MakeShaderCacheKeyString(Job, Info.SourceHash, CompilerId);
+		Job.KeyHash = HashKeyString(KeyStrings[i]);
+
+		if (Cache.Find(Job.KeyHash, KeyStrings[i], Job.Bytecode))
+		{
+			Job.bSucceeded = true;
+			Job.bCacheHit = true;
+			++HitCount;
+			continue;
+		}
+
+		// 같은 배치 안의 동일 키는 한 번만 컴파일
+		if (const int32* First = FirstMissByKey.Find(Job.KeyHash))
+		{
+			DuplicateOf[i] = *First;
+			continue;
+		}
+		FirstMissByKey[Job.KeyHash] = i;
+		Job.SourceFiles = std::move(Info.Files);
+		Misses.push_back(i);
+		++Stats.CacheMisses;
+	}
+
+	// 2. 캐시 미스만 워커 스레드에서 컴파일 (D3DCompile 계열은 스레드 안전)
+	if (!Misses.empty() && Compiler)
+	{
+		ParallelFor(Misses.Num(), [&](int32 MissIndex)
+		{
+			const int32 JobIndex = Misses[MissIndex];
+			FShaderCompileJob& Job = InOutJobs[JobIndex];
+			Job.bSucceeded = Compiler(Job, Job.Bytecode, Job.ErrorMessage) && !Job.Bytecode.empty();
+			if (Job.bSucceeded)
+			{
+				Cache.Store(Job.KeyHash, KeyStrings[JobIndex], Job.Bytecode);
+			}
+		});
+	}
+
+	// 3. 중복 작업에 결과 복사 + 통계
+	for (int32 i = 0; i < JobCount; ++i)
+	{
+		FShaderCompileJob& Job = InOutJobs[i];
+		if (DuplicateOf[i] >= 0)
+		{
+			const FShaderCompileJob& Source = InOutJobs[DuplicateOf[i]];
+			Job.Bytecode = Source.Bytecode;
+			Job.ErrorMessage = Source.ErrorMessage;
+			Job.bSucceeded = Source.bSucceeded;
+		}
+		if (!Job.bSucceeded)
+		{
+			++Stats.Failures;
+		}
+	}
+
+	const double ElapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - StartTime).count();
+	Stats.CacheHits += HitCount;
+	Stats.LastBatchJobs = static_cast<uint32>(JobCount);
+	Stats.LastBatchHits = HitCount;
+	Stats.LastBatchCompiled = static_cast<uint32>(Misses.Num());
+	Stats.LastBatchMs = ElapsedMs;
+	if (!Misses.empty())
+	{
+		Stats.TotalCompileMs += ElapsedMs;
+	}
+}
@@ -0,0 +1,222 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include <functional>
+#include <memory>
+#include <mutex>
+
+struct FShaderMacro
+{
+	FString Name;
+	FString Definition;
+
+	// TMap의 키로 사용하기 위해 비교 연산자 정의
+	bool operator==(const FShaderMacro& Other) const
+	{
+		return Name == Other.Name && Definition == Other.Definition;
+	}
+};
+
+// 64비트 FNV-1a (셰이더 캐시 키용, 스트리밍 가능)
+struct FShaderHash
+{
+	static constexpr uint64 OffsetBasis = 14695981039346656037ull;
+	static constexpr uint64 Prime = 1099511628211ull;
+
+	uint64 Value = OffsetBasis;
+
+	void Update(const void* InData, size_t InSize)
+	{
+		const uint8* Bytes = static_cast<const uint8*>(InData);
+		for (size_t i = 0; i < InSize; ++i)
+		{
+			Value = (Value ^ Bytes[i]) * Prime;
+		}
+	}
+	void Update(const FString& InString)
+	{
+		// 길이를 먼저 넣어 "ab"+"c"와 "a"+"bc"가 같은 해시가 되지 않도록 함
+		const uint64 Length = InString.size();
+		Update(&Length, sizeof(Length));
+		Update(InString.data(), InString.size());
+	}
+	void Update(uint64 InValue) { Update(&InValue, sizeof(InValue)); }
+};
+
+// 파일 읽기 함수 (기본은 디스크, 테스트에서는 메모리 파일로 교체)
+using FShaderFileReader = std::function<bool(const FString& /*InPath*/, FString& /*OutContents*/)>;
+
+// 정규화 경로 -> 해시에 들어간 파일 내용 (Resolve 시점 스냅샷, 리졸버 캐시와 공유)
+using FShaderSourceFiles = TMap<FString, std::shared_ptr<const FString>>;
+
+// include를 펼친 셰이더 소스 요약
+struct FShaderSourceInfo
+{
+	uint64 SourceHash = 0;			// 펼친 소스 전체의 해시 (매크로 무관)
+	TArray<FString> Dependencies;	// 본문을 제외한 include 파일 (정규화 경로, 방문 순서)
+	FShaderSourceFiles Files;		// 본문 + 존재하는 include 파일의 내용
+	bool bRootFound = false;
+};
+
+/**
+ * #include "..."를 재귀적으로 따라가 펼친 소스의 해시와 의존 파일 목록을 만듭니다.
+ * 매크로는 평가하지 않으므로 #if 안의 include도 의존성으로 잡힙니다 (보수적).
+ * 같은 파일은 한 번만 펼치고(순환 include 방지), 읽은 파일 내용은 Invalidate할 때까지 재사용합니다.
+ * 해시한 파일 내용은 OutInfo.Files로 넘겨, 컴파일러가 디스크를 다시 읽지 않고 같은 텍스트를 컴파일하게 합니다.
+ * 경로는 include한 파일의 디렉터리 기준으로 풀고 '/' 구분자로 정규화합니다.
+ */
+class FShaderIncludeResolver
+{
+public:
+	explicit FShaderIncludeResolver(FShaderFileReader InReader = nullptr);
+
+	bool Resolve(const FString& InRootPath, FShaderSourceInfo& OutInfo);
+
+	// 바뀐 파일만 다시 읽도록 캐시에서 제거
+	void Invalidate(const FString& InPath);
+
+	static FString NormalizeShaderPath(const FString& InPath);
+	static FString ResolveIncludePath(const FString& InIncludingFile, const FString& InIncludeName);
+
+private:
+	// 파일을 include 지시문 기준으로 자른 조각: Text 다음에 Include(비어 있을 수 있음)가 옴
+	struct FSegment
+	{
+		FString Text;
+		FString Include;
+	};
+	struct FParsedFile
+	{
+		bool bExists = false;
+		std::shared_ptr<const FString> Contents;
+		TArray<FSegment> Segments;
+	};
+
+	const FParsedFile& GetParsedFile(const FString& InPath);
+	void HashRecursive(const FString& InPath, TSet<FString>& InOutVisited, FShaderHash& InOutHash, FShaderSourceInfo& OutInfo);
+
+	FShaderFileReader Reader;
+	TMap<FString, FParsedFile> Files;
+};
+
+// 컴파일 한 건 (셰이더 파일 + 진입점 + 프로파일 + 매크로)
+struct FShaderCompileJob
+{
+	FString SourcePath;
+	FString EntryPoint;
+	FString Profile;
+	TArray<FShaderMacro> Macros;
+	FString MacroKey;				// UShader::GenerateShaderKey (정렬된 매크로)
+	uint32 CompileFlags = 0;
+	FShaderSourceFiles SourceFiles;	// CompileBatch가 채움: 키 해시에 쓴 본문/include 내용 (컴파일러는 이것만 읽음)
+
+	// --- 결과 ---
+	uint64 KeyHash = 0;
+	TArray<uint8> Bytecode;
+	TArray<FString> Dependencies;
+	FString ErrorMessage;
+	bool bSucceeded = false;
+	bool bCacheHit = false;
+};
+
+// 바이트코드 캐시 키를 구성하는 문자열 (해시 충돌/포맷 변경 검증용으로 엔트리에도 저장)
+// InCompilerId는 컴파일러 버전 식별자로, 컴파일러가 바뀌면 이전 바이트코드를 쓰지 않게 함
+FString MakeShaderCacheKeyString(const FShaderCompileJob& InJob, uint64 InSourceHash, const FString& InCompilerId);
+
+/**
+ * 디스크 바이트코드 캐시. 엔트리당 파일 하나(<키 해시 16진수>.shc)이고,
+ * Initialize에서 디렉터리를 훑어 어떤 키가 있는지만 인덱스로 들고 있다가 Find 때 읽습니다.
+ * Find/Store는 여러 워커 스레드에서 동시에 불러도 됩니다.
+ */
+class FShaderBytecodeCache
+{
+public:
+	void Initialize(const FString& InDirectory);
+
+	bool Find(uint64 InKeyHash, const FString& InKeyString, TArray<uint8>& OutBytecode);
+	bool Store(uint64 InKeyHash, const FString& InKeyString, const TArray<uint8>& InBytecode);
+
+	// 디스크 엔트리까지 모두 삭제
+	void Clear();
+
+	uint32 GetEntryCount() const;
+	uint64 GetTotalBytes() const;
+	const FString& GetDirectory() const { return Directory; }
+
+	static constexpr uint32 Magic = 0x4348534D;	// 'MSHC'
+	static constexpr uint32 Version = 1;
+
+private:
+	FString GetEntryPath(uint64 InKeyHash) const;
+
+	FString Directory;
+	mutable std::mutex Mutex;
+	TMap<uint64, uint64> Index;		// 키 해시 -> 파일 크기
+	uint64 TotalBytes = 0;
+};
+
+// include 파일 -> 그 파일을 (직간접적으로) 쓰는 셰이더 파일
+class FShaderDependencyGraph
+{
+public:
+	void SetDependencies(const FString& InShaderPath, const TArray<FString>& InDependencies);
+	void RemoveShader(const FString& InShaderPath);
+
+	// 바뀐 파일 중 하나라도 본문/include로 쓰는 셰이더 경로 (중복 없음)
+	void GetAffectedShaders(const TSet<FString>& InChangedFiles, TSet<FString>& OutShaderPaths) const;
+
+	const TArray<FString>* GetDependencies(const FString& InShaderPath) const { return Dependencies.Find(InShaderPath); }
+
+private:
+	TMap<FString, TArray<FString>> Dependencies;	// 셰이더 -> include 파일
+	TMap<FString, TSet<FString>> Dependents;		// include 파일 -> 셰이더
+};
+
+struct FShaderCompileStats
+{
+	uint32 CacheHits = 0;
+	uint32 CacheMisses = 0;
+	uint32 Failures = 0;
+	uint32 LastBatchJobs = 0;
+	uint32 LastBatchHits = 0;
+	uint32 LastBatchCompiled = 0;
+	double LastBatchMs = 0.0;
+	double TotalCompileMs = 0.0;	// 캐시 미스를 실제로 컴파일한 배치들의 벽시계 시간 합
+};
+
+/**
+ * 셰이더 컴파일 진입점. 배치의 각 작업에 대해 include를 펼친 소스 해시로 캐시 키를 만들고,
+ * 캐시에 없는 것만 ParallelFor로 워커 스레드에서 컴파일한 뒤 캐시에 저장합니다.
+ * 실제 컴파일러는 Initialize로 주입합니다 (엔진은 D3DCompile + 스냅샷 ID3DInclude, 테스트는 스텁).
+ * 컴파일러는 Job.SourceFiles의 텍스트만 읽어야 키와 바이트코드가 같은 소스를 가리킵니다.
+ * CompileBatch는 게임 스레드에서만 호출합니다. 디바이스 객체 생성은 호출 측 몫입니다.
+ */
+class FShaderCompileManager
+{
+public:
+	using FCompileFunction = std::function<bool(const FShaderCompileJob& /*InJob*/, TArray<uint8>& /*OutBytecode*/, FString& /*OutError*/)>;
+
+	// 엔진은 GetInstance(UShader::GetCompileManager)를 쓰고, 테스트는 스텁 컴파일러로 별도 인스턴스를 만듦
+	FShaderCompileManager() = default;
+	static FShaderCompileManager& GetInstance();
+
+	void Initialize(const FString& InCacheDirectory, FCompileFunction InCompiler, const FString& InCompilerId, FShaderFileReader InReader = nullptr);
+	bool IsInitialized() const { return static_cast<bool>(Compiler); }
+
+	void CompileBatch(TArray<FShaderCompileJob>& InOutJobs);
+
+	bool ResolveSource(const FString& InShaderPath, FShaderSourceInfo& OutInfo) { return Resolver.Resolve(InShaderPath, OutInfo); }
+
+	// 파일 변경 알림을 받은 경로의 캐시된 소스를 버림
+	void InvalidateFiles(const TSet<FString>& InChangedFiles);
+
+	FShaderBytecodeCache& GetCache() { return Cache; }
+	const FShaderCompileStats& GetStats() const { return Stats; }
+	const FString& GetCompilerId() const { return CompilerId; }
+
+private:
+	FShaderIncludeResolver Resolver;
+	FShaderBytecodeCache Cache;
+	FCompileFunction Compiler;
+	FString CompilerId;
+	FShaderCompileStats Stats;
+};
@@ -0,0 +1,252 @@
+﻿#include "pch.h"
+#include "ShaderCache.h"
+#include "SelfTest.h"
+#include <atomic>
+#include <filesystem>
+
+namespace
+{
+	// 메모리 파일 시스템 + 스텁 컴파일러 (디바이스/디스크 셰이더 없이 캐시 키와 컴파일 흐름만 검증)
+	struct FShaderCacheTestEnv
+	{
+		TMap<FString, FString> Files;
+		std::atomic<int32> CompileCount{ 0 };
+		FString LastCompiledText;
+		FString CacheDirectory;
+
+		FShaderCacheTestEnv()
+		{
+			Files["Shaders/Materials/A.hlsl"] = "#include \"../Common/L.hlsl\"\n# include <../Common/P.hlsl>\nfloat a;\n";
+			Files["Shaders/Common/L.hlsl"] = "#include \"P.hlsl\"\nfloat l;\n";
+			Files["Shaders/Common/P.hlsl"] = "#include \"L.hlsl\"\nfloat p;\n";	// L <-> P 순환
+			Files["Shaders/Unlit/B.hlsl"] = "float b;\n";
+
+			CacheDirectory = (std::filesystem::temp_directory_path() / "MundiSelfTest" / "ShaderCache").generic_string();
+			std::error_code Ec;
+			std::filesystem::remove_all(CacheDirectory, Ec);
+		}
+
+		~FShaderCacheTestEnv()
+		{
+			std::error_code Ec;
+			std::filesystem::remove_all(CacheDirectory, Ec);
+		}
+
+		FShaderFileReader MakeReader()
+		{
+			return [this](const FString& InPath, FString& OutContents)
+			{
+				const FString* Found = Files.Find(InPath);
+				if (!Found)
+				{
+					return false;
+				}
+				OutContents = *Found;
+				return true;
+			};
+		}
+
+		// 바이트코드 = 진입점 + 스냅샷 본문 (컴파일러가 어떤 텍스트를 받았는지 확인용)
+		FShaderCompileManager::FCompileFunction MakeCompiler()
+		{
+			return [this](const FShaderCompileJob& InJob, TArray<uint8>& OutBytecode, FString& OutError)
+			{
+				++CompileCount;
+				if (InJob.MacroKey == "FAIL=1")
+				{
+					OutError = "stub failure";
+					return false;
+				}
+				const std::shared_ptr<const FString>* Root = InJob.SourceFiles.Find(FShaderIncludeResolver::NormalizeShaderPath(InJob.SourcePath));
+				if (!Root || !*Root)
+				{
+					OutError = "missing snapshot";
+					return false;
+				}
+				const FString Text = InJob.EntryPoint + "|" + **Root;
+				OutBytecode.assign(Text.begin(), Text.end());
+				return true;
+			};
+		}
+
+		void Initialize(FShaderCompileManager& InManager, const FString& InCompilerId = "stub_1")
+		{
+			InManager.Initialize(CacheDirectory, MakeCompiler(), InCompilerId, MakeReader());
+		}
+	};
+
+	FShaderCompileJob MakeJob(const FString& InPath, const FString& InEntry, int32 InVariant)
+	{
+		FShaderCompileJob Job;
+		Job.SourcePath = InPath;
+		Job.EntryPoint = InEntry;
+		Job.Profile = (InEntry == "mainPS") ? "ps_5_0" : "vs_5_0";
+		Job.Macros.push_back({ "VARIANT", std::to_string(InVariant) });
+		Job.MacroKey = "VARIANT=" + std::to_string(InVariant);
+		return Job;
+	}
+
+	// 현재 리졸버 상태 기준 캐시 키 (CompileBatch와 같은 방식)
+	FString ComputeKey(FShaderCompileManager& InManager, const FShaderCompileJob& InJob)
+	{
+		FShaderSourceInfo Info;
+		InManager.ResolveSource(InJob.SourcePath, Info);
+		return MakeShaderCacheKeyString(InJob, Info.SourceHash, InManager.GetCompilerId());
+	}
+}
+
+IMPLEMENT_SELF_TEST(ShaderCache, IncludeResolver)
+{
+	FShaderCacheTestEnv Env;
+	FShaderIncludeResolver Resolver(Env.MakeReader());
+
+	FShaderSourceInfo Info;
+	SELF_TEST_CHECK(Resolver.Resolve("Shaders/Materials/./A.hlsl", Info));
+	SELF_TEST_CHECK(Info.bRootFound);
+
+	// 순환 include는 한 번씩만, 방문 순서대로
+	SELF_TEST_CHECK(Info.Dependencies.Num() == 2);
+	SELF_TEST_CHECK(Info.Dependencies.Num() == 2 && Info.Dependencies[0] == "Shaders/Common/L.hlsl");
+	SELF_TEST_CHECK(Info.Dependencies.Num() == 2 && Info.Dependencies[1] == "Shaders/Common/P.hlsl");
+
+	// 스냅샷에는 본문 + include 파일 내용이 그대로 들어감
+	SELF_TEST_CHECK(Info.Files.Num() == 3);
+	const std::shared_ptr<const FString>* Root = Info.Files.Find("Shaders/Materials/A.hlsl");
+	SELF_TEST_CHECK(Root && *Root && **Root == Env.Files["Shaders/Materials/A.hlsl"]);
+
+	FShaderSourceInfo Missing;
+	SELF_TEST_CHECK(!Resolver.Resolve("Shaders/None.hlsl", Missing));
+	SELF_TEST_CHECK(!Missing.bRootFound);
+}
+
+IMPLEMENT_SELF_TEST(ShaderCache, IncludeChangeChangesKey)
+{
+	FShaderCacheTestEnv Env;
+	FShaderCompileManager Manager;
+	Env.Initialize(Manager);
+
+	const FShaderCompileJob Job = MakeJob("Shaders/Materials/A.hlsl", "mainVS", 0);
+	const FString Before = ComputeKey(Manager, Job);
+
+	// 알림 전에는 리졸버 캐시를 쓰므로 키가 그대로, Invalidate 후에는 바뀜
+	Env.Files["Shaders/Common/P.hlsl"] = "#include \"L.hlsl\"\nfloat p2;\n";
+	SELF_TEST_CHECK(ComputeKey(Manager, Job) == Before);
+
+	TSet<FString> Changed;
+	Changed.Add("Shaders/Common/P.hlsl");
+	Manager.InvalidateFiles(Changed);
+	SELF_TEST_CHECK(ComputeKey(Manager, Job) != Before);
+
+	// 되돌리면 같은 키
+	Env.Files["Shaders/Common/P.hlsl"] = "#include \"L.hlsl\"\nfloat p;\n";
+	Manager.InvalidateFiles(Changed);
+	SELF_TEST_CHECK(ComputeKey(Manager, Job) == Before);
+}
+
+IMPLEMENT_SELF_TEST(ShaderCache, CompilerIdChangesKey)
+{
+	const FShaderCompileJob Job = MakeJob("Shaders/Unlit/B.hlsl", "mainPS", 1);
+	SELF_TEST_CHECK(MakeShaderCacheKeyString(Job, 42, "stub_1") != MakeShaderCacheKeyString(Job, 42, "stub_2"));
+
+	FShaderCacheTestEnv Env;
+	FShaderCompileManager Manager;
+	Env.Initialize(Manager, "stub_1");
+
+	TArray<FShaderCompileJob> Jobs;
+	Jobs.push_back(Job);
+	Manager.CompileBatch(Jobs);
+	SELF_TEST_CHECK(Env.CompileCount == 1);
+
+	// 같은 캐시 디렉터리라도 컴파일러가 바뀌면 다시 컴파일
+	Env.Initialize(Manager, "stub_2");
+	Manager.CompileBatch(Jobs);
+	SELF_TEST_CHECK(Env.CompileCount == 2);
+	SELF_TEST_CHECK(!Jobs[0].bCacheHit);
+}
+
+IMPLEMENT_SELF_TEST(ShaderCache, BatchAndDiskCache)
+{
+	FShaderCacheTestEnv Env;
+	FShaderCompileManager Manager;
+	Env.Initialize(Manager);
+
+	TArray<FShaderCompileJob> Jobs;
+	for (int32 Variant = 0; Variant < 4; ++Variant)
+	{
+		Jobs.push_back(MakeJob("Shaders/Materials/A.hlsl", "mainVS", Variant));
+		Jobs.push_back(MakeJob("Shaders/Materials/A.hlsl", "mainPS", Variant));
+	}
+	Jobs.push_back(Jobs[0]);	// 배치 내 중복
+	FShaderCompileJob Failing = MakeJob("Shaders/Materials/A.hlsl", "mainVS", 0);
+	Failing.MacroKey = "FAIL=1";
+	Jobs.push_back(Failing);
+	Jobs.push_back(MakeJob("Shaders/None.hlsl", "mainVS", 0));
+
+	Manager.CompileBatch(Jobs);
+	SELF_TEST_CHECK(Env.CompileCount == 9);		// 8 variant + 실패 1, 중복/없는 파일은 컴파일 안 함
+	SELF_TEST_CHECK(Jobs[8].bSucceeded && Jobs[8].Bytecode == Jobs[0].Bytecode);
+	SELF_TEST_CHECK(!Jobs[9].bSucceeded && Jobs[9].ErrorMessage == "stub failure");
+	SELF_TEST_CHECK(!Jobs[10].bSucceeded && !Jobs[10].ErrorMessage.empty());
+	SELF_TEST_CHECK(Jobs[0].Dependencies.Num() == 2);
+	SELF_TEST_CHECK(Manager.GetCache().GetEntryCount() == 8);
+	SELF_TEST_CHECK(Manager.GetStats().Failures == 2);
+
+	// 재시작(다시 Initialize)해도 디스크 캐시로 전부 히트
+	Env.Initialize(Manager);
+	Env.CompileCount = 0;
+	Jobs.resize(8);
+	Manager.CompileBatch(Jobs);
+	SELF_TEST_CHECK(Env.CompileCount == 0);
+	SELF_TEST_CHECK(Manager.GetStats().CacheHits == 8);
+	SELF_TEST_CHECK(Jobs[0].bCacheHit && Jobs[0].bSucceeded);
+
+	Manager.GetCache().Clear();
+	SELF_TEST_CHECK(Manager.GetCache().GetEntryCount() == 0);
+}
+
+IMPLEMENT_SELF_TEST(ShaderCache, CompilerReadsHashedSnapshot)
+{
+	FShaderCacheTestEnv Env;
+	FShaderCompileManager Manager;
+	Env.Initialize(Manager);
+
+	const FString Original = Env.Files["Shaders/Unlit/B.hlsl"];
+	FShaderSourceInfo Info;
+	Manager.ResolveSource("Shaders/Unlit/B.hlsl", Info);
+
+	// 해시를 뜬 뒤 디스크만 바뀌고 변경 알림이 아직 안 온 상황: 컴파일러는 해시한 텍스트를 받아야 함
+	Env.Files["Shaders/Unlit/B.hlsl"] = "float b_edited;\n";
+
+	TArray<FShaderCompileJob> Jobs;
+	Jobs.push_back(MakeJob("Shaders/Unlit/B.hlsl", "mainVS", 0));
+	Manager.CompileBatch(Jobs);
+
+	const FString Expected = "mainVS|" + Original;
+	SELF_TEST_CHECK(Jobs[0].bSucceeded);
+	SELF_TEST_CHECK(FString(Jobs[0].Bytecode.begin(), Jobs[0].Bytecode.end()) == Expected);
+}
+
+IMPLEMENT_SELF_TEST(ShaderCache, DependencyGraph)
+{
+	FShaderDependencyGraph Graph;
+	Graph.SetDependencies("Shaders/Materials/A.hlsl", { "Shaders/Common/L.hlsl", "Shaders/Common/P.hlsl" });
+	Graph.SetDependencies("Shaders/Unlit/B.hlsl", {});
+
+	TSet<FString> Changed;
+	Changed.Add("Shaders/Common/P.hlsl");
+	TSet<FString> Affected;
+	Graph.GetAffectedShaders(Changed, Affected);
+	SELF_TEST_CHECK(Affected.Num() == 1 && Affected.Contains("Shaders/Materials/A.hlsl"));
+
+	// 본문 자체가 바뀐 경우
+	TSet<FString> ChangedRoot;
+	ChangedRoot.Add("Shaders/Unlit/B.hlsl");
+	TSet<FString> AffectedRoot;
+	Graph.GetAffectedShaders(ChangedRoot, AffectedRoot);
+	SELF_TEST_CHECK(AffectedRoot.Num() == 1 && AffectedRoot.Contains("Shaders/Unlit/B.hlsl"));
+
+	Graph.RemoveShader("Shaders/Materials/A.hlsl");
+	TSet<FString> AfterRemove;
+	Graph.GetAffectedShaders(Changed, AfterRemove);
+	SELF_TEST_CHECK(AfterRemove.Num() == 0);
+}
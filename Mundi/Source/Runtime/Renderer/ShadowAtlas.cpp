@@ -0,0 +1,345 @@
+﻿#include "pch.h"
+#include "ShadowAtlas.h"
+
+namespace
+{
+	// InValue 이하의 가장 큰 2의 거듭제곱 (0이면 0)
+	uint32 FloorPowerOfTwo(uint32 InValue)
+	{
+		uint32 Result = InValue ? 1u : 0u;
+		while (Result && Result <= InValue / 2)
+		{
+			Result *= 2;
+		}
+		return Result;
+	}
+}
+
+//====================================================================================
+// FShadowAtlasAllocator
+//====================================================================================
+void FShadowAtlasAllocator::Initialize(uint32 InAtlasSize, uint32 InMinTileSize)
+{
+	AtlasSize = FloorPowerOfTwo(InAtlasSize);
+	MinTileSize = std::min(std::max(1u, FloorPowerOfTwo(InMinTileSize)), AtlasSize);
+	Reset();
+}
+
+void FShadowAtlasAllocator::Reset()
+{
+	Nodes.Empty();
+	FreeChildBlocks.Empty();
+	UsedArea = 0;
+
+	FNode Root;
+	Root.Size = AtlasSize;
+	Nodes.Add(Root);
+}
+
+bool FShadowAtlasAllocator::Allocate(uint32 InSize, FShadowAtlasTile& OutTile)
+{
+	if (InSize < MinTileSize || InSize > AtlasSize || (InSize & (InSize - 1)) != 0)
+	{
+		return false;
+	}
+
+	// 요청 이상인 빈 리프 중 가장 작은 것 (같으면 위쪽, 왼쪽 우선 - 슬롯 순서와 무관하게 결정적)
+	int32 Best = -1;
+	for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+	{
+		const FNode& Node = Nodes[Index];
+		if (Node.Size < InSize || Node.FirstChild != -1 || Node.bAllocated)
+		{
+			continue;
+		}
+		if (Best < 0)
+		{
+			Best = Index;
+			continue;
+		}
+		const FNode& Current = Nodes[Best];
+		if (Node.Size != Current.Size ? Node.Size < Current.Size : (Node.Y != Current.Y ? Node.Y < Current.Y : Node.X < Current.X))
+		{
+			Best = Index;
+		}
+	}
+	if (Best < 0)
+	{
+		return false;
+	}
+
+	// 요청 크기가 될 때까지 왼쪽 위 자식으로 내려가며 분할
+	while (Nodes[Best].Size > InSize)
+	{
+		Best = AllocateChildren(Best);
+	}
+
+	FNode& Node = Nodes[Best];
+	Node.bAllocated = true;
+	UsedArea += static_cast<uint64>(Node.Size) * Node.Size;
+
+	OutTile.X = Node.X;
+	OutTile.Y = Node.Y;
+	OutTile.Size = Node.Size;
+	return true;
+}
+
+void FShadowAtlasAllocator::Free(const FShadowAtlasTile& InTile)
+{
+	if (!InTile.IsValid() || Nodes.IsEmpty())
+	{
+		return;
+	}
+
+	// 루트에서 타일이 속한 사분면을 따라 내려감
+	int32 Index = 0;
+	while (Nodes[Index].Size > InTile.Size && Nodes[Index].FirstChild != -1)
+	{
+		const FNode& Node = Nodes[Index];
+		const uint32 Half = Node.Size / 2;
+		const int32 Quadrant = (InTile.X - Node.X >= Half ? 1 : 0) + (InTile.Y - Node.Y >= Half ? 2 : 0);
+		Index = Node.FirstChild + Quadrant;
+	}
+
+	FNode& Node = Nodes[Index];
+	if (!Node.bAllocated || Node.X != InTile.X || Node.Y != InTile.Y || Node.Size != InTile.Size)
+	{
+		return;
+	}
+	Node.bAllocated = false;
+	UsedArea -= static_cast<uint64>(Node.Size) * Node.Size;
+
+	// 네 자식이 모두 빈 리프가 되면 부모로 합침
+	for (int32 Parent = Node.Parent; Parent != -1; Parent = Nodes[Parent].Parent)
+	{
+		const int32 FirstChild = Nodes[Parent].FirstChild;
+		bool bAllFree = true;
+		for (int32 Child = 0; Child < 4; ++Child)
+		{
+			const FNode& ChildNode = Nodes[FirstChild + Child];
+			bAllFree &= !ChildNode.bAllocated && ChildNode.FirstChild == -1;
+		}
+		if (!bAllFree)
+		{
+			break;
+		}
+		ReleaseChildren(Parent);
+	}
+}
+
+int32 FShadowAtlasAllocator::AllocateChildren(int32 InParent)
+{
+	int32 FirstChild;
+	if (!FreeChildBlocks.IsEmpty())
+	{
+		FirstChild = FreeChildBlocks.back();
+		FreeChildBlocks.pop_back();
+	}
+	else
+	{
+		FirstChild = Nodes.Num();
+		Nodes.resize(Nodes.size() + 4);
+	}
+
+	// resize 이후에 부모를 읽어야 함
+	const FNode Parent = Nodes[InParent];
+	const uint32 Half = Parent.Size / 2;
+	for (int32 Child = 0; Child < 4; ++Child)
+	{
+		FNode& Node = Nodes[FirstChild + Child];
+		Node = FNode();
+		Node.X = Parent.X + ((Child & 1) ? Half : 0);
+		Node.Y = Parent.Y + ((Child & 2) ? Half : 0);
+		Node.Size = Half;
+		Node.Parent = InParent;
+	}
+	Nodes[InParent].FirstChild = FirstChild;
+	return FirstChild;
+}
+
+void FShadowAtlasAllocator::ReleaseChildren(int32 InParent)
+{
+	const int32 FirstChild = Nodes[InParent].FirstChild;
+	for (int32 Child = 0; Child < 4; ++Child)
+	{
+		// Size 0은 할당 후보에서 빠지는 빈 슬롯
+		Nodes[FirstChild + Child] = FNode();
+	}
+	FreeChildBlocks.Add(FirstChild);
+	Nodes[InParent].FirstChild = -1;
+}
+
+//====================================================================================
+// FShadowAtlas
+//====================================================================================
+void FShadowAtlas::Initialize(uint32 InAtlasSize, uint32 InMinTileSize, uint32 InMaxTileSize)
+{
+	Allocator.Initialize(InAtlasSize, InMinTileSize);
+	MinTileSize = Allocator.GetMinTileSize();
+	MaxTileSize = std::max(MinTileSize, std::min(FloorPowerOfTwo(InMaxTileSize), Allocator.GetAtlasSize()));
+	Slots.Empty();
+	Stats = FShadowAtlasStats();
+}
+
+void FShadowAtlas::InvalidateAll()
+{
+	for (auto& Pair : Slots)
+	{
+		Pair.second.bContentValid = false;
+	}
+}
+
+uint32 FShadowAtlas::ChooseTileSize(float InDesiredSize, uint32 InCurrentSize) const
+{
+	const float Desired = std::clamp(InDesiredSize, static_cast<float>(MinTileSize), static_cast<float>(MaxTileSize));
+	if (InCurrentSize >= MinTileSize && InCurrentSize <= MaxTileSize
+		&& Desired >= static_cast<float>(InCurrentSize) * 0.75f && Desired < static_cast<float>(InCurrentSize) * 2.5f)
+	{
+		return InCurrentSize;
+	}
+	return std::max(MinTileSize, FloorPowerOfTwo(static_cast<uint32>(Desired)));
+}
+
+bool FShadowAtlas::AllocateWithFallback(uint32 InSize, FShadowAtlasTile& OutTile)
+{
+	for (uint32 Size = InSize; Size >= MinTileSize && Size > 0; Size /= 2)
+	{
+		if (Allocator.Allocate(Size, OutTile))
+		{
+			return true;
+		}
+	}
+	OutTile = FShadowAtlasTile();
+	return false;
+}
+
+void FShadowAtlas::Update(const TArray<FShadowAtlasRequest>& InRequests)
+{
+	Stats = FShadowAtlasStats();
+	Stats.Requests = static_cast<uint32>(InRequests.Num());
+
+	// 1. 이번에 요청하지 않은 라이트의 타일 반환
+	TSet<const void*> Requested;
+	for (const FShadowAtlasRequest& Request : InRequests)
+	{
+		Requested.insert(Request.Owner);
+	}
+	for (auto It = Slots.begin(); It != Slots.end();)
+	{
+		if (Requested.find(It->first) == Requested.end())
+		{
+			Allocator.Free(It->second.Tile);
+			It = Slots.erase(It);
+		}
+		else
+		{
+			++It;
+		}
+	}
+
+	// 2. 중요도 내림차순 (같으면 요청 순서)
+	TArray<int32> Order(InRequests.Num());
+	for (int32 Index = 0; Index < Order.Num(); ++Index)
+	{
+		Order[Index] = Index;
+	}
+	std::sort(Order.begin(), Order.end(), [&InRequests](int32 A, int32 B)
+		{
+			return InRequests[A].Importance != InRequests[B].Importance ? InRequests[A].Importance > InRequests[B].Importance : A < B;
+		});
+
+	// 3. 목표 크기를 정하고 크기가 바뀌는 타일은 먼저 반환 (그 자리를 다른 라이트가 쓸 수 있도록)
+	TArray<uint32> TargetSizes(InRequests.Num());
+	TArray<FShadowAtlasTile> PreviousTiles(InRequests.Num());
+	for (int32 Index = 0; Index < InRequests.Num(); ++Index)
+	{
+		FShadowAtlasSlot& Slot = Slots[InRequests[Index].Owner];
+		PreviousTiles[Index] = Slot.Tile;
+		TargetSizes[Index] = ChooseTileSize(InRequests[Index].DesiredSize, Slot.Tile.Size);
+		if (Slot.Tile.IsValid() && Slot.Tile.Size != TargetSizes[Index])
+		{
+			Allocator.Free(Slot.Tile);
+			Slot.Tile = FShadowAtlasTile();
+		}
+	}
+
+	// 4. 타일이 없는 라이트만 중요도 순으로 할당
+	int32 MostImportantFailure = -1;
+	for (int32 Rank = 0; Rank < Order.Num(); ++Rank)
+	{
+		const int32 Index = Order[Rank];
+		FShadowAtlasSlot& Slot = Slots[InRequests[Index].Owner];
+		if (!Slot.Tile.IsValid() && !AllocateWithFallback(TargetSizes[Index], Slot.Tile) && MostImportantFailure < 0)
+		{
+			MostImportantFailure = Rank;
+		}
+	}
+
+	// 5. 덜 중요한 라이트가 자리를 차지해서 실패했다면 전체를 중요도 순으로 한 번 재배치
+	bool bLessImportantHoldsTile = false;
+	for (int32 Rank = MostImportantFailure + 1; MostImportantFailure >= 0 && Rank < Order.Num(); ++Rank)
+	{
+		bLessImportantHoldsTile |= Slots[InRequests[Order[Rank]].Owner].Tile.IsValid();
+	}
+	if (bLessImportantHoldsTile)
+	{
+		++Stats.Repacks;
+		Allocator.Reset();
+		for (const int32 Index : Order)
+		{
+			AllocateWithFallback(TargetSizes[Index], Slots[InRequests[Index].Owner].Tile);
+		}
+	}
+
+	// 6. 자리가 바뀌었거나 라이트/캐스터 상태가 바뀐 타일은 다시 그림
+	for (int32 Index = 0; Index < InRequests.Num(); ++Index)
+	{
+		FShadowAtlasSlot& Slot = Slots[InRequests[Index].Owner];
+		if (!Slot.Tile.IsValid())
+		{
+			++Stats.Failed;
+			Slot.bContentValid = false;
+			continue;
+		}
+
+		++Stats.Allocated;
+		if (Slot.Tile != PreviousTiles[Index])
+		{
+			++Stats.Reallocated;
+			Slot.bContentValid = false;
+		}
+		if (Slot.ContentHash != InRequests[Index].ContentHash)
+		{
+			Slot.ContentHash = InRequests[Index].ContentHash;
+			Slot.bContentValid = false;
+		}
+		Stats.DirtyTiles += Slot.bContentValid ? 0 : 1;
+	}
+	Stats.UsedArea = Allocator.GetUsedArea();
+}
+
+const FShadowAtlasSlot* FShadowAtlas::FindSlot(const void* InOwner) const
+{
+	return Slots.Find(InOwner);
+}
+
+bool FShadowAtlas::NeedsRender(const void* InOwner) const
+{
+	const FShadowAtlasSlot* Slot = Slots.Find(InOwner);
+	return Slot && Slot->Tile.IsValid() && !Slot->bContentValid;
+}
+
+void FShadowAtlas::MarkRendered(const void* InOwner)
+{
+	if (FShadowAtlasSlot* Slot = Slots.Find(InOwner))
+	{
+		Slot->bContentValid = Slot->Tile.IsValid();
+	}
+}
+
+FVector4 FShadowAtlas::GetScaleOffset(const FShadowAtlasTile& InTile) const
+{
+	const float InvAtlasSize = 1.0f / static_cast<float>(std::max(1u, Allocator.GetAtlasSize()));
+	const float Scale = static_cast<float>(InTile.Size) * InvAtlasSize;
+	return FVector4(Scale, Scale, static_cast<float>(InTile.X) * InvAtlasSize, static_cast<float>(InTile.Y) * InvAtlasSize);
+}
@@ -0,0 +1,123 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Vector.h"
+
+// 아틀라스 안의 정사각형 타일 (픽셀 단위, Size == 0이면 할당 없음)
+struct FShadowAtlasTile
+{
+	uint32 X = 0;
+	uint32 Y = 0;
+	uint32 Size = 0;
+
+	bool IsValid() const { return Size > 0; }
+	bool operator==(const FShadowAtlasTile& Other) const { return X == Other.X && Y == Other.Y && Size == Other.Size; }
+	bool operator!=(const FShadowAtlasTile& Other) const { return !(*this == Other); }
+};
+
+/**
+ * 정사각형 아틀라스를 2의 거듭제곱 타일로 나누는 쿼드트리 할당기.
+ * 요청 크기 이상인 가장 작은 빈 노드를 골라 필요한 만큼 4분할하고, 해제 시 네 자식이 모두 비면 다시 합칩니다.
+ * 같은 순서로 호출하면 항상 같은 배치가 나오며 디바이스와 무관합니다.
+ */
+class FShadowAtlasAllocator
+{
+public:
+	void Initialize(uint32 InAtlasSize, uint32 InMinTileSize);
+	void Reset();
+
+	// InSize는 MinTileSize 이상 AtlasSize 이하의 2의 거듭제곱
+	bool Allocate(uint32 InSize, FShadowAtlasTile& OutTile);
+	void Free(const FShadowAtlasTile& InTile);
+
+	uint32 GetAtlasSize() const { return AtlasSize; }
+	uint32 GetMinTileSize() const { return MinTileSize; }
+	uint64 GetUsedArea() const { return UsedArea; }
+
+private:
+	struct FNode
+	{
+		uint32 X = 0;
+		uint32 Y = 0;
+		uint32 Size = 0;
+		int32 Parent = -1;
+		int32 FirstChild = -1;		// 자식 4개는 연속 슬롯 (-1이면 리프)
+		bool bAllocated = false;
+	};
+
+	int32 AllocateChildren(int32 InParent);
+	void ReleaseChildren(int32 InParent);
+
+	uint32 AtlasSize = 0;
+	uint32 MinTileSize = 0;
+	uint64 UsedArea = 0;
+	TArray<FNode> Nodes;			// 0번이 루트
+	TArray<int32> FreeChildBlocks;	// 재사용할 자식 4개 블록의 시작 슬롯
+};
+
+// 한 프레임 동안 그림자를 원하는 라이트 하나
+struct FShadowAtlasRequest
+{
+	const void* Owner = nullptr;
+	float DesiredSize = 0.0f;		// 화면 점유율로 계산한 한 변 (픽셀, 내부에서 2의 거듭제곱으로 맞춤)
+	float Importance = 0.0f;		// 공간이 모자랄 때 먼저 자리를 받는 순서
+	uint64 ContentHash = 0;			// 라이트 파라미터 + 볼륨 안 캐스터 상태 (바뀌면 다시 그림)
+};
+
+struct FShadowAtlasSlot
+{
+	FShadowAtlasTile Tile;
+	uint64 ContentHash = 0;
+	bool bContentValid = false;		// 아틀라스의 이 타일에 현재 ContentHash로 그린 결과가 남아 있음
+};
+
+struct FShadowAtlasStats
+{
+	uint32 Requests = 0;
+	uint32 Allocated = 0;
+	uint32 Failed = 0;				// 최소 타일도 못 받은 라이트
+	uint32 Reallocated = 0;			// 새로 받았거나 크기/위치가 바뀐 타일
+	uint32 DirtyTiles = 0;			// 이번 업데이트에서 다시 그려야 하는 타일
+	uint32 Repacks = 0;
+	uint64 UsedArea = 0;
+};
+
+/**
+ * 라이트별 섀도우 타일을 프레임 간에 유지하는 아틀라스.
+ * Update에 매 프레임 요청 목록을 넘기면 크기가 히스테리시스 범위 안인 타일은 그 자리에 두고,
+ * 크기가 바뀌거나 새로 생긴 라이트만 중요도 순으로 다시 할당합니다 (실패하면 전체를 중요도 순으로 한 번 재배치).
+ * 타일이 그대로이고 ContentHash도 같으면 이전에 그린 깊이를 재사용할 수 있습니다 (NeedsRender == false).
+ */
+class FShadowAtlas
+{
+public:
+	void Initialize(uint32 InAtlasSize, uint32 InMinTileSize, uint32 InMaxTileSize);
+
+	// 텍스처를 다시 만들었을 때 등, 배치는 유지하고 내용만 무효화
+	void InvalidateAll();
+
+	void Update(const TArray<FShadowAtlasRequest>& InRequests);
+
+	const FShadowAtlasSlot* FindSlot(const void* InOwner) const;
+	bool NeedsRender(const void* InOwner) const;
+	void MarkRendered(const void* InOwner);
+
+	// 라이트 투영 UV [0,1]을 아틀라스 UV로: uv * xy + zw
+	FVector4 GetScaleOffset(const FShadowAtlasTile& InTile) const;
+
+	// 현재 크기 InCurrentSize(0이면 없음)에서 원하는 크기로 갈 타일 크기 (아래/위로 25% 여유를 둬 경계에서 흔들리지 않음)
+	uint32 ChooseTileSize(float InDesiredSize, uint32 InCurrentSize) const;
+
+	uint32 GetAtlasSize() const { return Allocator.GetAtlasSize(); }
+	uint32 GetMinTileSize() const { return MinTileSize; }
+	uint32 GetMaxTileSize() const { return MaxTileSize; }
+	const FShadowAtlasStats& GetStats() const { return Stats; }
+
+private:
+	bool AllocateWithFallback(uint32 InSize, FShadowAtlasTile& OutTile);
+
+	FShadowAtlasAllocator Allocator;
+	uint32 MinTileSize = 0;
+	uint32 MaxTileSize = 0;
+	TMap<const void*, FShadowAtlasSlot> Slots;
+	FShadowAtlasStats Stats;
+};
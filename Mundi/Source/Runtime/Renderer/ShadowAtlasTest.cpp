@@ -0,0 +1,320 @@
+﻿#include "pch.h"
+#include "ShadowAtlas.h"
+#include "SelfTest.h"
+
+namespace
+{
+	bool TilesOverlap(const FShadowAtlasTile& A, const FShadowAtlasTile& B)
+	{
+		return A.X < B.X + B.Size && B.X < A.X + A.Size && A.Y < B.Y + B.Size && B.Y < A.Y + A.Size;
+	}
+
+	// 유효한 타일끼리 겹치지 않고 모두 아틀라스 안에 있는지
+	bool AreTilesDisjoint(const TArray<FShadowAtlasTile>& InTiles, uint32 InAtlasSize)
+	{
+		for (int32 i = 0; i < InTiles.Num(); ++i)
+		{
+			if (!InTiles[i].IsValid())
+			{
+				continue;
+			}
+			if (InTiles[i].X + InTiles[i].Size > InAtlasSize || InTiles[i].Y + InTiles[i].Size > InAtlasSize)
+			{
+				return false;
+			}
+			for (int32 j = i + 1; j < InTiles.Num(); ++j)
+			{
+				if (InTiles[j].IsValid() && TilesOverlap(InTiles[i], InTiles[j]))
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	// 라이트 주소 대신 쓰는 고유 Owner
+	const void* TestOwner(int32 InIndex)
+	{
+		static int32 Owners[16];
+		return &Owners[InIndex];
+	}
+
+	FShadowAtlasRequest MakeRequest(int32 InOwner, float InDesiredSize, float InImportance, uint64 InContentHash = 0)
+	{
+		FShadowAtlasRequest Request;
+		Request.Owner = TestOwner(InOwner);
+		Request.DesiredSize = InDesiredSize;
+		Request.Importance = InImportance;
+		Request.ContentHash = InContentHash;
+		return Request;
+	}
+
+	FShadowAtlasTile GetTile(const FShadowAtlas& InAtlas, int32 InOwner)
+	{
+		const FShadowAtlasSlot* Slot = InAtlas.FindSlot(TestOwner(InOwner));
+		return Slot ? Slot->Tile : FShadowAtlasTile();
+	}
+
+	// 섞인 크기로 할당/일부 해제/재할당하는 고정 시퀀스
+	TArray<FShadowAtlasTile> RunAllocatorSequence(FShadowAtlasAllocator& InAllocator)
+	{
+		TArray<FShadowAtlasTile> Tiles;
+		for (uint32 Size : { 256u, 64u, 512u, 128u, 64u, 256u, 128u })
+		{
+			FShadowAtlasTile Tile;
+			InAllocator.Allocate(Size, Tile);
+			Tiles.Add(Tile);
+		}
+		InAllocator.Free(Tiles[1]);
+		InAllocator.Free(Tiles[3]);
+		for (uint32 Size : { 128u, 64u, 64u })
+		{
+			FShadowAtlasTile Tile;
+			InAllocator.Allocate(Size, Tile);
+			Tiles.Add(Tile);
+		}
+		return Tiles;
+	}
+}
+
+IMPLEMENT_SELF_TEST(ShadowAtlas, AllocatorAllocateFreeAndMerge)
+{
+	FShadowAtlasAllocator Allocator;
+	Allocator.Initialize(1024, 64);
+
+	// 같은 크기는 위쪽, 왼쪽부터 채움
+	FShadowAtlasTile A, B, C;
+	SELF_TEST_CHECK(Allocator.Allocate(256, A));
+	SELF_TEST_CHECK(Allocator.Allocate(256, B));
+	SELF_TEST_CHECK(Allocator.Allocate(512, C));
+	SELF_TEST_CHECK(A == (FShadowAtlasTile{ 0, 0, 256 }));
+	SELF_TEST_CHECK(B == (FShadowAtlasTile{ 256, 0, 256 }));
+	SELF_TEST_CHECK(C == (FShadowAtlasTile{ 512, 0, 512 }));
+	SELF_TEST_CHECK(Allocator.GetUsedArea() == 2ull * 256 * 256 + 512ull * 512);
+
+	// 2의 거듭제곱이 아니거나 범위 밖인 크기, 남은 공간보다 큰 크기는 실패
+	FShadowAtlasTile Invalid;
+	SELF_TEST_CHECK(!Allocator.Allocate(100, Invalid));
+	SELF_TEST_CHECK(!Allocator.Allocate(32, Invalid));
+	SELF_TEST_CHECK(!Allocator.Allocate(1024, Invalid));
+
+	// 해제 후 네 자식이 모두 비면 루트까지 합쳐져 전체 크기를 다시 받을 수 있음
+	Allocator.Free(B);
+	Allocator.Free(A);
+	Allocator.Free(C);
+	SELF_TEST_CHECK(Allocator.GetUsedArea() == 0);
+	FShadowAtlasTile Full;
+	SELF_TEST_CHECK(Allocator.Allocate(1024, Full));
+	SELF_TEST_CHECK(Full == (FShadowAtlasTile{ 0, 0, 1024 }));
+	Allocator.Free(Full);
+
+	// 최소 타일로 꽉 채우면 정확히 (1024 / 64)^2개, 서로 겹치지 않음
+	TArray<FShadowAtlasTile> MinTiles;
+	FShadowAtlasTile Tile;
+	while (Allocator.Allocate(64, Tile))
+	{
+		MinTiles.Add(Tile);
+	}
+	Test.AddInfo("%d min tiles", MinTiles.Num());
+	SELF_TEST_CHECK(MinTiles.Num() == 256);
+	SELF_TEST_CHECK(Allocator.GetUsedArea() == 1024ull * 1024);
+	SELF_TEST_CHECK(AreTilesDisjoint(MinTiles, 1024));
+	for (const FShadowAtlasTile& MinTile : MinTiles)
+	{
+		Allocator.Free(MinTile);
+	}
+	SELF_TEST_CHECK(Allocator.Allocate(1024, Full));
+}
+
+IMPLEMENT_SELF_TEST(ShadowAtlas, AllocatorIsDeterministic)
+{
+	// 같은 순서로 호출하면 노드 재사용 여부와 무관하게 같은 배치
+	FShadowAtlasAllocator First;
+	First.Initialize(1024, 64);
+	const TArray<FShadowAtlasTile> FirstTiles = RunAllocatorSequence(First);
+
+	FShadowAtlasAllocator Second;
+	Second.Initialize(1024, 64);
+	FShadowAtlasTile Warmup;
+	Second.Allocate(64, Warmup);
+	Second.Free(Warmup);
+	const TArray<FShadowAtlasTile> SecondTiles = RunAllocatorSequence(Second);
+
+	First.Reset();
+	const TArray<FShadowAtlasTile> ResetTiles = RunAllocatorSequence(First);
+
+	SELF_TEST_CHECK(FirstTiles == SecondTiles);
+	SELF_TEST_CHECK(FirstTiles == ResetTiles);
+
+	// 해제한 두 타일을 뺀 나머지는 서로 겹치지 않음
+	TArray<FShadowAtlasTile> LiveTiles = FirstTiles;
+	LiveTiles[1] = FShadowAtlasTile();
+	LiveTiles[3] = FShadowAtlasTile();
+	SELF_TEST_CHECK(AreTilesDisjoint(LiveTiles, 1024));
+}
+
+IMPLEMENT_SELF_TEST(ShadowAtlas, HysteresisKeepsTileSize)
+{
+	FShadowAtlas Atlas;
+	Atlas.Initialize(2048, 64, 1024);
+
+	TArray<FShadowAtlasRequest> Requests = { MakeRequest(0, 300.0f, 1.0f) };
+	Atlas.Update(Requests);
+	const FShadowAtlasTile Initial = GetTile(Atlas, 0);
+	SELF_TEST_CHECK(Initial.Size == 256);
+
+	// 화면 크기가 조금 바뀌면 (256의 0.75 ~ 2.5배 안) 타일 크기와 위치를 그대로 둠
+	for (float Desired : { 330.0f, 250.0f, 200.0f, 600.0f, 300.0f })
+	{
+		Requests[0].DesiredSize = Desired;
+		Atlas.Update(Requests);
+		SELF_TEST_CHECK(GetTile(Atlas, 0) == Initial);
+		SELF_TEST_CHECK(Atlas.GetStats().Reallocated == 0);
+	}
+
+	// 범위를 벗어나면 새 크기로 다시 할당
+	Requests[0].DesiredSize = 180.0f;
+	Atlas.Update(Requests);
+	SELF_TEST_CHECK(GetTile(Atlas, 0).Size == 128);
+	SELF_TEST_CHECK(Atlas.GetStats().Reallocated == 1);
+
+	Requests[0].DesiredSize = 700.0f;
+	Atlas.Update(Requests);
+	SELF_TEST_CHECK(GetTile(Atlas, 0).Size == 512);
+
+	// 최대 타일 크기를 넘는 요청은 최대 크기로 제한
+	SELF_TEST_CHECK(Atlas.ChooseTileSize(5000.0f, 0) == 1024);
+	SELF_TEST_CHECK(Atlas.ChooseTileSize(10.0f, 0) == 64);
+}
+
+IMPLEMENT_SELF_TEST(ShadowAtlas, TilesStayStableAcrossFrames)
+{
+	FShadowAtlas Atlas;
+	Atlas.Initialize(2048, 64, 1024);
+
+	TArray<FShadowAtlasRequest> Requests;
+	for (int32 Index = 0; Index < 8; ++Index)
+	{
+		Requests.Add(MakeRequest(Index, 96.0f + Index * 70.0f, static_cast<float>(Index % 3), 100 + Index));
+	}
+	Atlas.Update(Requests);
+	SELF_TEST_CHECK(Atlas.GetStats().Failed == 0);
+
+	TArray<FShadowAtlasTile> FirstTiles;
+	for (int32 Index = 0; Index < Requests.Num(); ++Index)
+	{
+		FirstTiles.Add(GetTile(Atlas, Index));
+		Atlas.MarkRendered(TestOwner(Index));
+	}
+	SELF_TEST_CHECK(AreTilesDisjoint(FirstTiles, Atlas.GetAtlasSize()));
+
+	// 아무것도 바뀌지 않으면 여러 프레임이 지나도 같은 자리, 다시 그릴 타일 없음
+	for (int32 Frame = 0; Frame < 5; ++Frame)
+	{
+		Atlas.Update(Requests);
+		SELF_TEST_CHECK(Atlas.GetStats().Reallocated == 0);
+		SELF_TEST_CHECK(Atlas.GetStats().DirtyTiles == 0);
+		SELF_TEST_CHECK(Atlas.GetStats().Repacks == 0);
+	}
+	for (int32 Index = 0; Index < Requests.Num(); ++Index)
+	{
+		SELF_TEST_CHECK(GetTile(Atlas, Index) == FirstTiles[Index]);
+		SELF_TEST_CHECK(!Atlas.NeedsRender(TestOwner(Index)));
+	}
+
+	// 라이트 하나가 빠져도 나머지는 그대로
+	Requests.erase(Requests.begin() + 3);
+	Atlas.Update(Requests);
+	SELF_TEST_CHECK(Atlas.FindSlot(TestOwner(3)) == nullptr);
+	SELF_TEST_CHECK(Atlas.GetStats().Reallocated == 0);
+	for (int32 Index = 0; Index < FirstTiles.Num(); ++Index)
+	{
+		SELF_TEST_CHECK(Index == 3 || GetTile(Atlas, Index) == FirstTiles[Index]);
+	}
+}
+
+IMPLEMENT_SELF_TEST(ShadowAtlas, RepackWhenAllocationFails)
+{
+	FShadowAtlas Atlas;
+	Atlas.Initialize(1024, 64, 512);
+
+	// 덜 중요한 라이트 4개가 아틀라스를 꽉 채움
+	TArray<FShadowAtlasRequest> Requests;
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		Requests.Add(MakeRequest(Index, 512.0f, 1.0f));
+	}
+	Atlas.Update(Requests);
+	SELF_TEST_CHECK(Atlas.GetStats().Allocated == 4);
+	SELF_TEST_CHECK(Atlas.GetStats().UsedArea == 1024ull * 1024);
+
+	// 중요도가 낮은 새 라이트는 자리가 없으면 그냥 실패 (재배치 없음)
+	Requests.Add(MakeRequest(4, 256.0f, 0.5f));
+	Atlas.Update(Requests);
+	SELF_TEST_CHECK(Atlas.GetStats().Repacks == 0);
+	SELF_TEST_CHECK(Atlas.GetStats().Failed == 1);
+	SELF_TEST_CHECK(!GetTile(Atlas, 4).IsValid());
+	SELF_TEST_CHECK(!Atlas.NeedsRender(TestOwner(4)));
+
+	// 더 중요한 라이트가 할당에 실패하면 중요도 순으로 한 번 재배치해서 자리를 받음
+	Requests[4].Importance = 10.0f;
+	Atlas.Update(Requests);
+	const FShadowAtlasStats& Stats = Atlas.GetStats();
+	Test.AddInfo("repacks %u, allocated %u, failed %u, reallocated %u", Stats.Repacks, Stats.Allocated, Stats.Failed, Stats.Reallocated);
+	SELF_TEST_CHECK(Stats.Repacks == 1);
+	SELF_TEST_CHECK(GetTile(Atlas, 4).Size == 256);
+	SELF_TEST_CHECK(Stats.Reallocated > 1);
+
+	TArray<FShadowAtlasTile> Tiles;
+	for (int32 Index = 0; Index < Requests.Num(); ++Index)
+	{
+		Tiles.Add(GetTile(Atlas, Index));
+	}
+	SELF_TEST_CHECK(AreTilesDisjoint(Tiles, Atlas.GetAtlasSize()));
+
+	// 다음 프레임에는 재배치된 자리에서 안정
+	Atlas.Update(Requests);
+	SELF_TEST_CHECK(Atlas.GetStats().Repacks == 0);
+	SELF_TEST_CHECK(Atlas.GetStats().Reallocated == 0);
+}
+
+IMPLEMENT_SELF_TEST(ShadowAtlas, ContentHashDrivesNeedsRender)
+{
+	FShadowAtlas Atlas;
+	Atlas.Initialize(1024, 64, 512);
+
+	TArray<FShadowAtlasRequest> Requests = { MakeRequest(0, 256.0f, 1.0f, 42) };
+	SELF_TEST_CHECK(!Atlas.NeedsRender(TestOwner(0)));
+
+	// 새 타일은 그려야 하고, 그린 뒤 같은 해시면 재사용
+	Atlas.Update(Requests);
+	SELF_TEST_CHECK(Atlas.NeedsRender(TestOwner(0)));
+	Atlas.MarkRendered(TestOwner(0));
+	SELF_TEST_CHECK(!Atlas.NeedsRender(TestOwner(0)));
+	Atlas.Update(Requests);
+	SELF_TEST_CHECK(!Atlas.NeedsRender(TestOwner(0)));
+	SELF_TEST_CHECK(Atlas.GetStats().DirtyTiles == 0);
+
+	// 라이트/캐스터 상태가 바뀌면 (해시 변경) 같은 자리여도 다시 그림
+	Requests[0].ContentHash = 43;
+	Atlas.Update(Requests);
+	SELF_TEST_CHECK(Atlas.NeedsRender(TestOwner(0)));
+	SELF_TEST_CHECK(Atlas.GetStats().Reallocated == 0);
+	SELF_TEST_CHECK(Atlas.GetStats().DirtyTiles == 1);
+	Atlas.MarkRendered(TestOwner(0));
+	SELF_TEST_CHECK(Atlas.FindSlot(TestOwner(0))->ContentHash == 43);
+
+	// 텍스처를 다시 만든 경우 배치는 그대로 두고 내용만 무효화
+	const FShadowAtlasTile Tile = GetTile(Atlas, 0);
+	Atlas.InvalidateAll();
+	SELF_TEST_CHECK(Atlas.NeedsRender(TestOwner(0)));
+	SELF_TEST_CHECK(GetTile(Atlas, 0) == Tile);
+	Atlas.MarkRendered(TestOwner(0));
+
+	// 자리가 바뀌면 해시가 같아도 다시 그림
+	Requests[0].DesiredSize = 100.0f;
+	Atlas.Update(Requests);
+	SELF_TEST_CHECK(GetTile(Atlas, 0) != Tile);
+	SELF_TEST_CHECK(Atlas.NeedsRender(TestOwner(0)));
+}
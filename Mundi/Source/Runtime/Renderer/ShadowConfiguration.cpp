@@ -11,6 +11,7 @@ FShadowConfiguration FShadowConfiguration::FromQuality(EShadowQuality InQuality)
 	case EShadowQuality::Low:
 		Config.DirectionalLightResolution = 1024;
 		Config.SpotLightResolution = 512;
+		Config.SpotLightAtlasResolution = 2048;
 		Config.PointLightResolution = 512;
 		Config.MaxDirectionalLights = 1;
 		Config.MaxSpotLights = 100;
@@ -25,6 +26,7 @@ FShadowConfiguration FShadowConfiguration::FromQuality(EShadowQuality InQuality)
 	case EShadowQuality::Medium:
 		Config.DirectionalLightResolution = 2048;
 		Config.SpotLightResolution = 1024;
+		Config.SpotLightAtlasResolution = 4096;
 		Config.PointLightResolution = 1024;
 		Config.MaxDirectionalLights = 1;
 		Config.MaxSpotLights = 200;
@@ -39,6 +41,7 @@ FShadowConfiguration FShadowConfiguration::FromQuality(EShadowQuality InQuality)
 	case EShadowQuality::High:
 		Config.DirectionalLightResolution = 4096;
 		Config.SpotLightResolution = 2048;
+		Config.SpotLightAtlasResolution = 8192;
 		Config.PointLightResolution = 1024;
 		Config.MaxDirectionalLights = 1;
 		Config.MaxSpotLights = 300;
@@ -84,6 +87,10 @@ bool FShadowConfiguration::IsValid() const
 		return false;
 	if (!IsResolutionValid(PointLightResolution))
 		return false;
+	if (!IsResolutionValid(SpotLightAtlasResolution) || SpotLightResolution > SpotLightAtlasResolution)
+		return false;
+	if (SpotLightMinTileResolution == 0 || SpotLightMinTileResolution > SpotLightResolution)
+		return false;
 
 	// 최대 라이트 수는 적절한 범위 내
 	if (MaxShadowCastingLights < 1)
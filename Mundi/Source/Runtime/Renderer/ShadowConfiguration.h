@@ -55,9 +55,13 @@ struct FShadowConfiguration
 
 	// 라이트 타입별 쉐도우 맵 해상도
 	uint32 DirectionalLightResolution = 4096;  // Non-CSM용 (legacy)
-	uint32 SpotLightResolution = 1024;
+	uint32 SpotLightResolution = 1024;         // SpotLight 타일 최대 크기
 	uint32 PointLightResolution = 1024;
 
+	// SpotLight 섀도우 아틀라스 (라이트마다 화면 점유율에 맞는 타일을 받음)
+	uint32 SpotLightAtlasResolution = 4096;
+	uint32 SpotLightMinTileResolution = 128;
+
 	// CSM 3-Tier 해상도 설정 (DirectionalLight CSM 전용)
 	FCSMTierConfig CSMTierLow = FCSMTierConfig(512, 16);      // Tier 0: 256~512
 	FCSMTierConfig CSMTierMedium = FCSMTierConfig(2048, 12);  // Tier 1: 1024~2048
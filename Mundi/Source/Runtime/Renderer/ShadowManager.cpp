@@ -7,6 +7,93 @@
 #include "D3D11RHI.h"
 #include "ResourceManager.h"
 #include "Shader.h"
+#include "SceneView.h"
+#include "StaticMeshComponent.h"
+
+namespace
+{
+	// 64비트 FNV-1a (아틀라스 타일 재사용 판정용)
+	void HashBytes(uint64& InOutHash, const void* InData, size_t InSize)
+	{
+		const uint8* Bytes = static_cast<const uint8*>(InData);
+		for (size_t i = 0; i < InSize; ++i)
+		{
+			InOutHash = (InOutHash ^ Bytes[i]) * 1099511628211ull;
+		}
+	}
+
+	// 라이트 영향 구(위치 + 감쇠 반경)가 화면 세로에서 차지하는 비율 (0~1)
+	float ComputeSpotLightScreenCoverage(const USpotLightComponent* Light, const FSceneView* View)
+	{
+		if (!View)
+		{
+			return 1.0f;
+		}
+
+		const FVector Center = Light->GetWorldLocation();
+		const float Radius = Light->GetAttenuationRadius();
+		const float Distance = (Center - View->ViewLocation).Size();
+		if (Distance <= Radius)
+		{
+			return 1.0f;	// 카메라가 영향 범위 안
+		}
+
+		const FVector4 ViewPosition = FVector4(Center.X, Center.Y, Center.Z, 1.0f) * View->ViewMatrix;
+		if (ViewPosition.Z < -Radius)
+		{
+			return 0.0f;	// 영향 범위 전체가 카메라 뒤
+		}
+
+		// 투영 행렬 M[1][1]은 NDC 반높이 대비 스케일이므로 R * M11 / 거리가 화면 세로 비율
+		const float ProjectionScale = View->ProjectionMatrix.M[1][1];
+		if (View->ProjectionMode == ECameraProjectionMode::Orthographic)
+		{
+			return std::min(1.0f, Radius * ProjectionScale);
+		}
+		return std::min(1.0f, Radius * ProjectionScale / Distance);
+	}
+
+	// 라이트 파라미터 + 영향 범위 안 캐스터 상태의 해시. 같으면 지난번에 그린 깊이를 그대로 쓸 수 있음
+	uint64 ComputeSpotLightContentHash(const USpotLightComponent* Light, const TArray<UMeshComponent*>& ShadowCasters)
+	{
+		uint64 Hash = 14695981039346656037ull;
+
+		const FVector Position = Light->GetWorldLocation();
+		const FVector Direction = Light->GetDirection();
+		const float Params[4] = { Light->GetOuterConeAngle(), Light->GetAttenuationRadius(), Light->GetShadowBias(), Light->GetShadowSlopeBias() };
+		HashBytes(Hash, &Position, sizeof(Position));
+		HashBytes(Hash, &Direction, sizeof(Direction));
+		HashBytes(Hash, Params, sizeof(Params));
+
+		const float Radius = Light->GetAttenuationRadius();
+		for (UMeshComponent* Caster : ShadowCasters)
+		{
+			UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Caster);
+			if (!StaticMeshComponent)
+			{
+				continue;
+			}
+
+			// 구-AABB 거리로 영향 범위 밖 캐스터 제외
+			const FAABB Bound = StaticMeshComponent->GetWorldAABB();
+			const FVector Closest(
+				std::clamp(Position.X, Bound.Min.X, Bound.Max.X),
+				std::clamp(Position.Y, Bound.Min.Y, Bound.Max.Y),
+				std::clamp(Position.Z, Bound.Min.Z, Bound.Max.Z));
+			if ((Closest - Position).SizeSquared() > Radius * Radius)
+			{
+				continue;
+			}
+
+			const FMatrix WorldMatrix = StaticMeshComponent->GetWorldMatrix();
+			const UStaticMesh* Mesh = StaticMeshComponent->GetStaticMesh();
+			HashBytes(Hash, &StaticMeshComponent, sizeof(StaticMeshComponent));
+			HashBytes(Hash, &Mesh, sizeof(Mesh));
+			HashBytes(Hash, WorldMatrix.M, sizeof(WorldMatrix.M));
+		}
+		return Hash;
+	}
+}
 
 FShadowManager::FShadowManager()
 	: RHIDevice(nullptr)
@@ -27,7 +114,10 @@ void FShadowManager::Initialize(D3D11RHI* RHI, const FShadowConfiguration& InCon
 	Config = InConfig;
 
 	// Shadow Map Array 초기화 (광원 타입별로 각각의 해상도 사용, 필터 타입 전달)
-	SpotLightShadowMap.Initialize(RHI, Config.SpotLightResolution, Config.SpotLightResolution, Config.MaxSpotLights, false, Config.FilterType);
+	// SpotLight는 한 장의 아틀라스를 나눠 씀 (타일 크기는 MinTile ~ SpotLightResolution)
+	SpotLightShadowMap.Initialize(RHI, Config.SpotLightAtlasResolution, Config.SpotLightAtlasResolution, 1, false, Config.FilterType);
+	SpotLightAtlas.Initialize(Config.SpotLightAtlasResolution, Config.SpotLightMinTileResolution, Config.SpotLightResolution);
+	SpotShadowCoverages.Empty();
 
 	// DirectionalLight Non-CSM (legacy, Default ShadowMapType)
 	constexpr uint32 MaxCascadesPerLight = 6;
@@ -142,7 +232,7 @@ void FShadowManager::SetFilterType(EShadowFilterType NewFilterType)
 	Initialize(RHIDevice, Config);
 }
 
-void FShadowManager::AssignShadowMapIndices(D3D11RHI* RHI, const FShadowCastingLights& InLights)
+void FShadowManager::AssignShadowMapIndices(D3D11RHI* RHI, const FShadowCastingLights& InLights, const TArray<FSceneView>& InViews, const TArray<UMeshComponent*>& InShadowCasters, uint64 InFrameNumber)
 {
 	// Lazy initialization: 최초 호출 시 ShadowMap 초기화
 	if (!bIsInitialized)
@@ -270,8 +360,15 @@ void FShadowManager::AssignShadowMapIndices(D3D11RHI* RHI, const FShadowCastingL
 		PointLightCount++;
 	}
 
-	// 3. SpotLight 처리
-	uint32 SpotLightCount = 0;
+	// 3. SpotLight 처리 - 화면 점유율에 맞는 크기의 아틀라스 타일 요청
+	const uint64 FrameIndex = InFrameNumber;
+	float ViewHeight = InViews.IsEmpty() ? static_cast<float>(Config.SpotLightResolution) : 1.0f;
+	for (const FSceneView& View : InViews)
+	{
+		ViewHeight = std::max(ViewHeight, static_cast<float>(View.ViewRect.Height()));
+	}
+	TArray<FShadowAtlasRequest> AtlasRequests;
+	TArray<USpotLightComponent*> AtlasLights;
 	for (USpotLightComponent* SpotLight : InLights.SpotLights)
 	{
 		// 유효성 검사
@@ -291,9 +388,57 @@ void FShadowManager::AssignShadowMapIndices(D3D11RHI* RHI, const FShadowCastingL
 			continue;
 		}
 
-		SpotLight->SetShadowMapIndex(SpotLightIndex);
+		// 같은 프레임의 다른 뷰와 지난 프레임까지 포함한 최대 점유율로 크기를 정해 뷰마다 타일이 바뀌지 않게 함
+		FSpotShadowCoverage& Coverage = SpotShadowCoverages[SpotLight];
+		if (Coverage.FrameIndex != FrameIndex)
+		{
+			Coverage.Previous = (Coverage.FrameIndex + 1 == FrameIndex) ? Coverage.Current : 0.0f;
+			Coverage.Current = 0.0f;
+			Coverage.FrameIndex = FrameIndex;
+		}
+		if (InViews.IsEmpty())
+		{
+			Coverage.Current = ComputeSpotLightScreenCoverage(SpotLight, nullptr);
+		}
+		for (const FSceneView& View : InViews)
+		{
+			Coverage.Current = std::max(Coverage.Current, ComputeSpotLightScreenCoverage(SpotLight, &View));
+		}
+		const float ScreenCoverage = std::max(Coverage.Current, Coverage.Previous);
+
+		FShadowAtlasRequest Request;
+		Request.Owner = SpotLight;
+		Request.DesiredSize = ScreenCoverage * ViewHeight;
+		Request.Importance = ScreenCoverage;
+		Request.ContentHash = ComputeSpotLightContentHash(SpotLight, InShadowCasters);
+		AtlasRequests.Add(Request);
+		AtlasLights.Add(SpotLight);
 		SpotLightIndex++;
-		SpotLightCount++;
+	}
+
+	// 타일이 그대로인 라이트는 자리를 유지하고, 공간이 모자라면 점유율이 작은 라이트부터 작은 타일/미할당
+	SpotLightAtlas.Update(AtlasRequests);
+
+	uint32 SpotLightCount = 0;
+	for (USpotLightComponent* SpotLight : AtlasLights)
+	{
+		const FShadowAtlasSlot* Slot = SpotLightAtlas.FindSlot(SpotLight);
+		if (Slot && Slot->Tile.IsValid())
+		{
+			SpotLight->SetShadowMapIndex(0);
+			SpotLight->SetShadowAtlasScaleOffset(SpotLightAtlas.GetScaleOffset(Slot->Tile));
+			SpotLightCount++;
+		}
+		else
+		{
+			SpotLight->SetShadowMapIndex(-1);
+		}
+	}
+
+	// 두 프레임 넘게 요청이 없던 라이트의 점유율 기록 정리
+	for (auto It = SpotShadowCoverages.begin(); It != SpotShadowCoverages.end();)
+	{
+		It = (It->second.FrameIndex + 1 < FrameIndex) ? SpotShadowCoverages.erase(It) : std::next(It);
 	}
 
 	// 쉐도우 맵 통계 수집 및 업데이트
@@ -325,7 +470,11 @@ void FShadowManager::AssignShadowMapIndices(D3D11RHI* RHI, const FShadowCastingL
 
 	// 각 쉐도우 맵의 실제 사용 중인 메모리 계산 (활성 라이트 수 기반)
 	Stats.DirectionalLightUsedBytes = DirectionalLightShadowMap.GetUsedMemoryBytes(DirectionalLightCount);
-	Stats.SpotLightUsedBytes = SpotLightShadowMap.GetUsedMemoryBytes(SpotLightCount);
+	const uint64 AtlasArea = static_cast<uint64>(SpotLightAtlas.GetAtlasSize()) * SpotLightAtlas.GetAtlasSize();
+	const FShadowAtlasStats& AtlasStats = SpotLightAtlas.GetStats();
+	Stats.SpotLightUsedBytes = AtlasArea > 0 ? SpotLightShadowMap.GetUsedMemoryBytes(1) * AtlasStats.UsedArea / AtlasArea : 0;
+	Stats.SpotLightAtlasDirtyTiles = AtlasStats.DirtyTiles;
+	Stats.SpotLightAtlasCachedTiles = AtlasStats.Allocated - AtlasStats.DirtyTiles;
 	Stats.PointLightUsedBytes = PointLightCubeShadowMap.GetUsedMemoryBytes(PointLightCount * 6); // 큐브맵이므로 6개 면
 
 	// CSM 티어별 통계 수집
@@ -379,12 +528,26 @@ bool FShadowManager::BeginShadowRender(D3D11RHI* RHI, USpotLightComponent* Light
 	OutContext.ShadowBias = Light->GetShadowBias();
 	OutContext.ShadowSlopeBias = Light->GetShadowSlopeBias();
 
-	// Shadow Map 렌더링 시작 (DSV 바인딩, Viewport 설정)
-	SpotLightShadowMap.BeginRender(RHI, Index, OutContext.ShadowBias, OutContext.ShadowSlopeBias);
+	const FShadowAtlasSlot* Slot = SpotLightAtlas.FindSlot(Light);
+	if (!Slot || !Slot->Tile.IsValid())
+	{
+		return false;
+	}
+
+	// Shadow Map 렌더링 시작 (DSV 바인딩, 타일만 지우고 타일 Viewport 설정)
+	SpotLightShadowMap.BeginRenderTile(RHI, Index, Slot->Tile.X, Slot->Tile.Y, Slot->Tile.Size, OutContext.ShadowBias, OutContext.ShadowSlopeBias);
+
+	// 이어지는 드로우가 이 타일을 채우므로 다음 뷰/프레임부터는 재사용
+	SpotLightAtlas.MarkRendered(Light);
 
 	return true;
 }
 
+bool FShadowManager::IsSpotLightShadowCached(USpotLightComponent* Light) const
+{
+	return Light && Light->GetShadowMapIndex() >= 0 && !SpotLightAtlas.NeedsRender(Light);
+}
+
 bool FShadowManager::BeginShadowRender(D3D11RHI* RHI, UDirectionalLightComponent* Light,
 	const FMatrix& CameraView, const FMatrix& CameraProjection, FShadowRenderContext& OutContext)
 {
@@ -715,7 +878,7 @@ void FShadowManager::UpdateShadowFilterBuffer(D3D11RHI* RHI)
 	ShadowFilterBuffer.PCFSampleCount = static_cast<uint32>(Config.PCFSampleCount);
 	ShadowFilterBuffer.PCFCustomSampleCount = Config.PCFCustomSampleCount;
 	ShadowFilterBuffer.DirectionalLightResolution = static_cast<float>(Config.DirectionalLightResolution);
-	ShadowFilterBuffer.SpotLightResolution = static_cast<float>(Config.SpotLightResolution);
+	ShadowFilterBuffer.SpotLightResolution = static_cast<float>(Config.SpotLightAtlasResolution);	// 아틀라스 UV 기준 텍셀 크기
 	ShadowFilterBuffer.PointLightResolution = static_cast<float>(Config.PointLightResolution);
 
 	// 동적으로 계산된 VSM 파라미터 사용
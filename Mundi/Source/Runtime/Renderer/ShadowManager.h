@@ -2,6 +2,7 @@
 
 #include "ShadowConfiguration.h"
 #include "ShadowMap.h"
+#include "ShadowAtlas.h"
 #include "ShadowStats.h"
 #include "ShadowViewProjection.h"
 
@@ -10,6 +11,8 @@ class D3D11RHI;
 class USpotLightComponent;
 class UPointLightComponent;
 class UDirectionalLightComponent;
+class UMeshComponent;
+class FSceneView;
 struct FMatrix;
 
 /**
@@ -70,9 +73,16 @@ public:
 
     /**
     * @brief 매 프레임에 활성화된 라이트 목록을 기반으로 섀도우 맵 인덱스를 할당합니다.
+    * SpotLight는 화면 점유율에 맞는 크기의 아틀라스 타일을 받고, 라이트와 영향 범위 안 캐스터가 그대로면 이전 깊이를 재사용합니다.
     * @param ShadowLights - 타입별로 그룹화된 섀도우 캐스팅 라이트 구조체
+    * @param InViews - 타일 크기를 정할 이번 프레임의 카메라 뷰들 (가장 크게 보이는 뷰 기준)
+    * @param InShadowCasters - 그림자를 드리우는 메시 (타일 재사용 판정용)
+    * @param InFrameNumber - 렌더러 프레임 번호 (URenderer::GetFrameNumber, 점유율을 프레임 단위로 묶는 데 사용)
     */
-    void AssignShadowMapIndices(D3D11RHI* RHI, const FShadowCastingLights& InLights);
+    void AssignShadowMapIndices(D3D11RHI* RHI, const FShadowCastingLights& InLights, const TArray<FSceneView>& InViews, const TArray<UMeshComponent*>& InShadowCasters, uint64 InFrameNumber);
+
+	// 이 SpotLight의 아틀라스 타일에 이전에 그린 깊이가 유효해서 다시 그릴 필요가 없는지
+	bool IsSpotLightShadowCached(USpotLightComponent* Light) const;
 
 	// Shadow 렌더링 시작 - SpotLight
 	// @param Light - 렌더링할 SpotLight
@@ -138,6 +148,7 @@ public:
 	int32 GetShadowMapIndex(USpotLightComponent* Light) const;
 	FShadowMap& GetSpotLightShadowMap() { return SpotLightShadowMap; }
 	const FShadowMap& GetSpotLightShadowMap() const { return SpotLightShadowMap; }
+	const FShadowAtlas& GetSpotLightAtlas() const { return SpotLightAtlas; }
 	FShadowMap& GetDirectionalLightShadowMap() { return DirectionalLightShadowMap; }
 	const FShadowMap& GetDirectionalLightShadowMap() const { return DirectionalLightShadowMap; }
 	FShadowMap& GetPointLightCubeShadowMap() { return PointLightCubeShadowMap; }
@@ -170,7 +181,7 @@ private:
 	bool bIsInitialized = false;
 
 	// Shadow Map 리소스
-	FShadowMap SpotLightShadowMap;
+	FShadowMap SpotLightShadowMap;             // SpotLight 아틀라스 (슬라이스 1장)
 	FShadowMap DirectionalLightShadowMap;      // Non-CSM용 (legacy, Default ShadowMapType)
 	FShadowMap DirectionalLightShadowMapTiers[3]; // CSM 3-Tier Arrays (Low, Medium, High)
 	FShadowMap PointLightCubeShadowMap;       // PointLight Cube Map (6 faces per light)
@@ -185,6 +196,18 @@ private:
 	TArray<FCascadeAllocation> CascadeAllocations; // 전역 캐스케이드 인덱스 → 할당 정보
 	uint32 TierSlotUsage[3];  // 티어별 사용 중인 슬롯 수
 
+	// SpotLight 아틀라스 타일 배치/캐시 상태
+	FShadowAtlas SpotLightAtlas;
+
+	// 라이트별 화면 점유율 (이번/지난 프레임의 모든 뷰 중 최대값, 뷰마다 타일 크기가 흔들리지 않도록)
+	struct FSpotShadowCoverage
+	{
+		float Current = 0.0f;
+		float Previous = 0.0f;
+		uint64 FrameIndex = 0;
+	};
+	TMap<const USpotLightComponent*, FSpotShadowCoverage> SpotShadowCoverages;
+
 	// VSM/ESM/EVSM용 쉐이더 (필터 타입에 따라 사용)
 	class UShader* ShadowVSM_PS;      // VSM 픽셀 쉐이더
 	class UShader* ShadowESM_PS;      // ESM 픽셀 쉐이더
@@ -1,5 +1,7 @@
 ﻿#include "pch.h"
 #include "ShadowMap.h"
+#include "ResourceManager.h"
+#include "Shader.h"
 
 FShadowMap::FShadowMap()
 	: Width(0)
@@ -271,32 +273,7 @@ void FShadowMap::BeginRender(D3D11RHI* RHI, UINT ArrayIndex, float DepthBias, fl
 
 
 	// RasterizerState 캐싱 (DepthBias 조합별로 재사용)
-	FRasterizerStateKey Key = { DepthBias, SlopeScaledDepthBias };
-	ID3D11RasterizerState* RasterizerState = nullptr;
-
-	// 캐시에서 찾기
-	auto it = CachedRasterizerStates.find(Key);
-	if (it != CachedRasterizerStates.end())
-	{
-		// 캐시에 있으면 재사용
-		RasterizerState = it->second;
-	}
-	else
-	{
-		// 캐시에 없으면 새로 생성하고 캐시에 저장
-		D3D11_RASTERIZER_DESC ShadowRasterizerDesc = {};
-		ShadowRasterizerDesc.FillMode = D3D11_FILL_SOLID;
-		ShadowRasterizerDesc.CullMode = D3D11_CULL_BACK;
-		ShadowRasterizerDesc.DepthClipEnable = TRUE;
-		ShadowRasterizerDesc.DepthBias = static_cast<INT>(DepthBias * 100000.0f);
-		ShadowRasterizerDesc.SlopeScaledDepthBias = SlopeScaledDepthBias;
-		ShadowRasterizerDesc.DepthBiasClamp = 0.0f;
-
-		RHI->GetDevice()->CreateRasterizerState(&ShadowRasterizerDesc, &RasterizerState);
-		CachedRasterizerStates[Key] = RasterizerState;
-	}
-
-	pContext->RSSetState(RasterizerState);
+	pContext->RSSetState(GetOrCreateRasterizerState(RHI, DepthBias, SlopeScaledDepthBias));
 
 	// 필터 타입에 따라 다른 렌더링 경로 사용
 	if (FilterType == EShadowFilterType::NONE || FilterType == EShadowFilterType::PCF)
@@ -347,6 +324,109 @@ void FShadowMap::BeginRender(D3D11RHI* RHI, UINT ArrayIndex, float DepthBias, fl
 	pContext->RSSetViewports(1, &ScaledViewport);
 }
 
+void FShadowMap::BeginRenderTile(D3D11RHI* RHI, UINT ArrayIndex, UINT TileX, UINT TileY, UINT TileSize, float DepthBias, float SlopeScaledDepthBias)
+{
+	assert(RHI != nullptr, "RHI is null");
+	assert(ArrayIndex < ArraySize, "Array index out of bounds");
+	assert(TileX + TileSize <= Width && TileY + TileSize <= Height, "Tile out of bounds");
+
+	ID3D11DeviceContext* pContext = RHI->GetDeviceContext();
+
+	// 섀도우 맵 SRV 언바인딩 (BeginRender와 동일)
+	ID3D11ShaderResourceView* pNullSRVs[6] = { nullptr, nullptr, nullptr, nullptr, nullptr, nullptr };
+	pContext->PSSetShaderResources(5, 6, pNullSRVs);
+
+	D3D11_VIEWPORT TileViewport = {};
+	TileViewport.TopLeftX = static_cast<float>(TileX);
+	TileViewport.TopLeftY = static_cast<float>(TileY);
+	TileViewport.Width = static_cast<float>(TileSize);
+	TileViewport.Height = static_cast<float>(TileSize);
+	TileViewport.MinDepth = 0.0f;
+	TileViewport.MaxDepth = 1.0f;
+
+	// Clear*View는 뷰 전체를 지우므로, 타일 뷰포트에 전체 화면 사각형을 그려 타일만 지움
+	UShader* ClearVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
+	if (!ClearVS || !ClearVS->GetVertexShader())
+	{
+		UE_LOG("BeginRenderTile: FullScreenTriangle_VS not loaded");
+		return;
+	}
+	pContext->RSSetState(nullptr);
+
+	if (FilterType == EShadowFilterType::NONE || FilterType == EShadowFilterType::PCF)
+	{
+		ID3D11DepthStencilView* DSV = ShadowMapDSVs[ArrayIndex];
+		ID3D11RenderTargetView* nullRTV = nullptr;
+		pContext->OMSetRenderTargets(1, &nullRTV, DSV);
+
+		// 깊이 범위를 [1, 1]로 고정한 뷰포트 + GreaterEqual 쓰기로 타일 깊이를 1로 덮어씀
+		D3D11_VIEWPORT ClearViewport = TileViewport;
+		ClearViewport.MinDepth = 1.0f;
+		pContext->RSSetViewports(1, &ClearViewport);
+
+		pContext->VSSetShader(ClearVS->GetVertexShader(), nullptr, 0);
+		pContext->PSSetShader(nullptr, nullptr, 0);
+		RHI->OMSetDepthStencilState(EComparisonFunc::GreaterEqual);
+		RHI->DrawFullScreenQuad();
+
+		RHI->OMSetDepthStencilState(EComparisonFunc::LessEqual);
+	}
+	else
+	{
+		ID3D11RenderTargetView* RTV = ShadowMapRTVs[ArrayIndex];
+		if (!RTV)
+		{
+			UE_LOG("BeginRenderTile: RTV is null for ArrayIndex %d (FilterType=%d)", ArrayIndex, (int)FilterType);
+			return;
+		}
+		pContext->OMSetRenderTargets(1, &RTV, nullptr);
+
+		// white = 무한대 depth
+		UShader* ClearPS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/ShadowTileClear_PS.hlsl");
+		if (!ClearPS || !ClearPS->GetPixelShader())
+		{
+			UE_LOG("BeginRenderTile: ShadowTileClear_PS not loaded");
+			return;
+		}
+		pContext->RSSetViewports(1, &TileViewport);
+		RHI->PrepareShader(ClearVS, ClearPS);
+		RHI->OMSetDepthStencilState(EComparisonFunc::Always);
+		RHI->OMSetBlendState(false);
+		RHI->DrawFullScreenQuad();
+	}
+
+	// 이후 드로우는 타일 뷰포트 + 바이어스 래스터 상태로
+	pContext->RSSetState(GetOrCreateRasterizerState(RHI, DepthBias, SlopeScaledDepthBias));
+	pContext->RSSetViewports(1, &TileViewport);
+}
+
+ID3D11RasterizerState* FShadowMap::GetOrCreateRasterizerState(D3D11RHI* RHI, float DepthBias, float SlopeScaledDepthBias)
+{
+	FRasterizerStateKey Key = { DepthBias, SlopeScaledDepthBias };
+
+	// 캐시에서 찾기
+	auto it = CachedRasterizerStates.find(Key);
+	if (it != CachedRasterizerStates.end())
+	{
+		// 캐시에 있으면 재사용
+		return it->second;
+	}
+
+	// 캐시에 없으면 새로 생성하고 캐시에 저장
+	D3D11_RASTERIZER_DESC ShadowRasterizerDesc = {};
+	ShadowRasterizerDesc.FillMode = D3D11_FILL_SOLID;
+	ShadowRasterizerDesc.CullMode = D3D11_CULL_BACK;
+	ShadowRasterizerDesc.DepthClipEnable = TRUE;
+	ShadowRasterizerDesc.DepthBias = static_cast<INT>(DepthBias * 100000.0f);
+	ShadowRasterizerDesc.SlopeScaledDepthBias = SlopeScaledDepthBias;
+	ShadowRasterizerDesc.DepthBiasClamp = 0.0f;
+
+	ID3D11RasterizerState* RasterizerState = nullptr;
+	RHI->GetDevice()->CreateRasterizerState(&ShadowRasterizerDesc, &RasterizerState);
+	CachedRasterizerStates[Key] = RasterizerState;
+	return RasterizerState;
+}
+
 void FShadowMap::EndRender(D3D11RHI* RHI)
 {
 	assert(RHI != nullptr, "RHI is null");
@@ -23,6 +23,10 @@ public:
 	// DepthBias - 섀도우 뎁스 바이어스 (기본값 10)
 	// SlopeScaledDepthBias - 섀도우 슬로프 바이어스 (기본값 1.0f)
 	void BeginRender(D3D11RHI* RHI, UINT ArrayIndex, float DepthBias = 10.0f, float SlopeScaledDepthBias = 1.0f);
+
+	// 슬라이스 안의 정사각형 타일 하나에만 렌더링 시작 (아틀라스용)
+	// 슬라이스 전체가 아니라 타일 영역만 지우므로 다른 타일에 캐시된 깊이는 그대로 남음
+	void BeginRenderTile(D3D11RHI* RHI, UINT ArrayIndex, UINT TileX, UINT TileY, UINT TileSize, float DepthBias = 10.0f, float SlopeScaledDepthBias = 1.0f);
 	void EndRender(D3D11RHI* RHI);
 
 	ID3D11ShaderResourceView* GetSRV() const { return ShadowMapSRV; }
@@ -75,6 +79,9 @@ public:
 	void ClearRemappedSliceCache();
 
 private:
+	// DepthBias 조합별 RasterizerState (없으면 생성해서 캐시)
+	ID3D11RasterizerState* GetOrCreateRasterizerState(D3D11RHI* RHI, float DepthBias, float SlopeScaledDepthBias);
+
 	// 깊이 리매핑 초기화 (DepthRemap.hlsl 셰이더 컴파일 및 리소스 생성)
 	void InitializeDepthRemapResources(D3D11RHI* RHI);
 	void ReleaseDepthRemapResources();
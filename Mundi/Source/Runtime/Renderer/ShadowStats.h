@@ -22,6 +22,10 @@ struct FShadowStats
 	uint64 SpotLightUsedBytes = 0;
 	uint64 PointLightUsedBytes = 0;
 
+	// SpotLight 아틀라스 타일 (이번에 다시 그린 타일 / 지난 깊이를 재사용한 타일)
+	uint32 SpotLightAtlasDirtyTiles = 0;
+	uint32 SpotLightAtlasCachedTiles = 0;
+
 	// 총 사용 중인 메모리 (바이트)
 	uint64 TotalUsedBytes = 0;
 
@@ -46,6 +50,8 @@ struct FShadowStats
 		, DirectionalLightUsedBytes(0)
 		, SpotLightUsedBytes(0)
 		, PointLightUsedBytes(0)
+		, SpotLightAtlasDirtyTiles(0)
+		, SpotLightAtlasCachedTiles(0)
 		, TotalUsedBytes(0)
 		, MaxShadowCastingLights(0)
 		, bUsingCSM(false)
@@ -66,6 +72,8 @@ struct FShadowStats
 		DirectionalLightUsedBytes = 0;
 		SpotLightUsedBytes = 0;
 		PointLightUsedBytes = 0;
+		SpotLightAtlasDirtyTiles = 0;
+		SpotLightAtlasCachedTiles = 0;
 		TotalUsedBytes = 0;
 		bUsingCSM = false;
 		for (int i = 0; i < 3; ++i)
@@ -0,0 +1,378 @@
+﻿#include "pch.h"
+#include "SpriteBatch.h"
+#include "VertexData.h"
+#include "PlatformTime.h"
+
+void FGlyphTable::BuildGrid(float InAtlasSize, float InCellSize, uint32 InColumns, uint8 InFirstChar, uint8 InLastChar)
+{
+    Glyphs.fill(FGlyphInfo());
+
+    const float CellUV = InCellSize / InAtlasSize;
+    for (uint32 Char = InFirstChar; Char <= InLastChar; ++Char)
+    {
+        const uint32 Key = Char - InFirstChar;
+        const uint32 Column = Key % InColumns;
+        const uint32 Row = Key / InColumns;
+
+        FGlyphInfo& Glyph = Glyphs[Char];
+        Glyph.U = Column * CellUV;
+        Glyph.V = Row * CellUV;
+        Glyph.Width = CellUV;
+        Glyph.Height = CellUV;
+        Glyph.bValid = true;
+    }
+
+    Aspect = 1.0f;
+    bBuilt = true;
+}
+
+void FSpriteBatcher::Reset()
+{
+    for (FAtlasBucket& Bucket : Buckets)
+    {
+        Bucket.Vertices.clear();
+    }
+    Batches.clear();
+    Stats = FSpriteBatchStats();
+}
+
+TArray<FSpriteVertex>& FSpriteBatcher::GetBucketVertices(const void* InAtlas)
+{
+    if (LastBucketIndex < Buckets.size() && Buckets[LastBucketIndex].Atlas == InAtlas)
+    {
+        return Buckets[LastBucketIndex].Vertices;
+    }
+
+    for (uint32 Index = 0; Index < Buckets.size(); ++Index)
+    {
+        if (Buckets[Index].Atlas == InAtlas)
+        {
+            LastBucketIndex = Index;
+            return Buckets[Index].Vertices;
+        }
+    }
+
+    // 이번 프레임에 비어 있는 버킷(지난 프레임의 아틀라스)을 재사용
+    for (uint32 Index = 0; Index < Buckets.size(); ++Index)
+    {
+        if (Buckets[Index].Vertices.IsEmpty())
+        {
+            Buckets[Index].Atlas = InAtlas;
+            LastBucketIndex = Index;
+            return Buckets[Index].Vertices;
+        }
+    }
+
+    FAtlasBucket NewBucket;
+    NewBucket.Atlas = InAtlas;
+    Buckets.emplace_back(std::move(NewBucket));
+    LastBucketIndex = static_cast<uint32>(Buckets.size() - 1);
+    return Buckets.back().Vertices;
+}
+
+bool FSpriteBatcher::TessellateText(FTextQuadCache& InOutCache, const FGlyphTable& InGlyphs, const FString& InText,
+    const FMatrix& InWorldMatrix, uint32 InColor, uint32 InObjectID)
+{
+    if (InOutCache.bValid &&
+        InOutCache.Color == InColor &&
+        InOutCache.ObjectID == InObjectID &&
+        memcmp(InOutCache.WorldMatrix.M, InWorldMatrix.M, sizeof(InWorldMatrix.M)) == 0 &&
+        InOutCache.Text == InText)
+    {
+        return false;
+    }
+
+    InOutCache.Text = InText;
+    InOutCache.WorldMatrix = InWorldMatrix;
+    InOutCache.Color = InColor;
+    InOutCache.ObjectID = InObjectID;
+    InOutCache.bValid = true;
+    InOutCache.Vertices.clear();
+    InOutCache.Vertices.reserve(InText.size() * 4);
+
+    // 로컬 (0, X, Y)를 월드로: P = X * Row1 + Y * Row2 + Row3 (행 벡터 규약)
+    const float (&M)[4][4] = InWorldMatrix.M;
+    const FVector AxisX(M[1][0], M[1][1], M[1][2]);
+    const FVector AxisY(M[2][0], M[2][1], M[2][2]);
+    const FVector Origin(M[3][0], M[3][1], M[3][2]);
+
+    const float CharWidth = InGlyphs.GetAspect();
+    const float CharHeight = 1.0f;
+    float CursorX = -CharWidth * static_cast<float>(InText.size() / 2);
+
+    for (char Ch : InText)
+    {
+        const FGlyphInfo& Glyph = InGlyphs.Get(static_cast<uint8>(Ch));
+        if (!Glyph.bValid)
+        {
+            continue;
+        }
+
+        const FVector Left = Origin + AxisX * CursorX;
+        const FVector Right = Origin + AxisX * (CursorX + CharWidth);
+        const FVector Top = AxisY * CharHeight;
+
+        FSpriteVertex Vertex;
+        Vertex.Color = InColor;
+        Vertex.ObjectID = InObjectID;
+
+        Vertex.Position = Left + Top;   Vertex.UV = FVector2D(Glyph.U, Glyph.V);                              InOutCache.Vertices.Add(Vertex);
+        Vertex.Position = Right + Top;  Vertex.UV = FVector2D(Glyph.U + Glyph.Width, Glyph.V);                InOutCache.Vertices.Add(Vertex);
+        Vertex.Position = Left;         Vertex.UV = FVector2D(Glyph.U, Glyph.V + Glyph.Height);               InOutCache.Vertices.Add(Vertex);
+        Vertex.Position = Right;        Vertex.UV = FVector2D(Glyph.U + Glyph.Width, Glyph.V + Glyph.Height); InOutCache.Vertices.Add(Vertex);
+
+        CursorX += CharWidth;
+    }
+
+    return true;
+}
+
+void FSpriteBatcher::AddText(const void* InAtlas, FTextQuadCache& InOutCache, const FGlyphTable& InGlyphs, const FString& InText,
+    const FMatrix& InWorldMatrix, uint32 InColor, uint32 InObjectID)
+{
+    if (TessellateText(InOutCache, InGlyphs, InText, InWorldMatrix, InColor, InObjectID))
+    {
+        ++Stats.TextRebuildCount;
+    }
+    ++Stats.TextCount;
+
+    if (InOutCache.Vertices.IsEmpty())
+    {
+        return;
+    }
+
+    TArray<FSpriteVertex>& Bucket = GetBucketVertices(InAtlas);
+    Bucket.insert(Bucket.end(), InOutCache.Vertices.begin(), InOutCache.Vertices.end());
+    Stats.QuadCount += static_cast<uint32>(InOutCache.Vertices.size() / 4);
+}
+
+void FSpriteBatcher::AddBillboard(const void* InAtlas, const FVector& InCenter, float InSize, const FVector& InRight, const FVector& InUp,
+    uint32 InColor, uint32 InObjectID)
+{
+    const float HalfSize = InSize * 0.5f;
+    const FVector Right = InRight * HalfSize;
+    const FVector Up = InUp * HalfSize;
+
+    TArray<FSpriteVertex>& Bucket = GetBucketVertices(InAtlas);
+    const size_t Base = Bucket.size();
+    Bucket.resize(Base + 4);
+
+    FSpriteVertex* Quad = Bucket.data() + Base;
+    Quad[0].Position = InCenter - Right + Up;   Quad[0].UV = FVector2D(0.0f, 0.0f);
+    Quad[1].Position = InCenter + Right + Up;   Quad[1].UV = FVector2D(1.0f, 0.0f);
+    Quad[2].Position = InCenter - Right - Up;   Quad[2].UV = FVector2D(0.0f, 1.0f);
+    Quad[3].Position = InCenter + Right - Up;   Quad[3].UV = FVector2D(1.0f, 1.0f);
+    for (int32 i = 0; i < 4; ++i)
+    {
+        Quad[i].Color = InColor;
+        Quad[i].ObjectID = InObjectID;
+    }
+
+    ++Stats.BillboardCount;
+    ++Stats.QuadCount;
+}
+
+void FSpriteBatcher::Build(uint32 InMaxQuadsPerBatch)
+{
+    Batches.clear();
+
+    uint32 FirstVertex = 0;
+    const uint32 MaxQuads = InMaxQuadsPerBatch > 0 ? InMaxQuadsPerBatch : UINT32_MAX;
+    for (const FAtlasBucket& Bucket : Buckets)
+    {
+        if (Bucket.Vertices.IsEmpty())
+        {
+            continue;
+        }
+
+        const uint32 BucketQuads = static_cast<uint32>(Bucket.Vertices.size() / 4);
+
+        // 공유 인덱스 버퍼 크기를 넘는 아틀라스는 여러 드로우로 나눔
+        for (uint32 QuadOffset = 0; QuadOffset < BucketQuads; QuadOffset += MaxQuads)
+        {
+            FSpriteDrawBatch Batch;
+            Batch.Atlas = Bucket.Atlas;
+            Batch.FirstVertex = FirstVertex + QuadOffset * 4;
+            Batch.QuadCount = std::min(MaxQuads, BucketQuads - QuadOffset);
+            Batches.Add(Batch);
+        }
+        FirstVertex += BucketQuads * 4;
+    }
+
+    Stats.BatchCount = static_cast<uint32>(Batches.size());
+}
+
+void FSpriteBatcher::CopyVertices(FSpriteVertex* OutDest) const
+{
+    for (const FAtlasBucket& Bucket : Buckets)
+    {
+        if (!Bucket.Vertices.IsEmpty())
+        {
+            memcpy(OutDest, Bucket.Vertices.data(), Bucket.Vertices.size() * sizeof(FSpriteVertex));
+            OutDest += Bucket.Vertices.size();
+        }
+    }
+}
+
+namespace
+{
+    // 비교용: 이전 UTextRenderComponent 방식 (TMap 조회 + 매 프레임 정점 배열 생성)
+    TArray<FBillboardVertexInfo_GPU> LegacyCreateVerticesForString(const TMap<char, FBillboardVertexInfo>& InCharInfoMap, const FString& InText)
+    {
+        TArray<FBillboardVertexInfo_GPU> OutVertices;
+        const FBillboardVertexInfo* ReferenceInfo = InCharInfoMap.Find('A');
+        const float CharWidth = ReferenceInfo->UVRect.Z / ReferenceInfo->UVRect.W;
+        float CursorX = -CharWidth * (InText.size() / 2);
+        for (char Ch : InText)
+        {
+            const FBillboardVertexInfo* CharInfo = InCharInfoMap.Find(Ch);
+            if (!CharInfo)
+            {
+                continue;
+            }
+
+            const float U = CharInfo->UVRect.X, V = CharInfo->UVRect.Y, W = CharInfo->UVRect.Z, H = CharInfo->UVRect.W;
+            const float Corners[4][4] = { { CursorX, 1.f, U, V }, { CursorX + CharWidth, 1.f, U + W, V },
+                                          { CursorX, 0.f, U, V + H }, { CursorX + CharWidth, 0.f, U + W, V + H } };
+            for (const auto& Corner : Corners)
+            {
+                FBillboardVertexInfo_GPU Info{};
+                Info.Position[0] = Corner[0];
+                Info.Position[1] = Corner[1];
+                Info.CharSize[0] = Info.CharSize[1] = 1.f;
+                Info.UVRect[0] = Corner[2];
+                Info.UVRect[1] = Corner[3];
+                OutVertices.push_back(Info);
+            }
+            CursorX += CharWidth;
+        }
+        return OutVertices;
+    }
+}
+
+void FSpriteBatcher::RunBenchmark(uint32 InSpriteCount)
+{
+    if (InSpriteCount == 0)
+    {
+        return;
+    }
+
+    constexpr uint32 FrameCount = 60;
+    constexpr uint32 IconAtlasCount = 4;
+    constexpr uint32 MaxQuadsPerBatch = 16384;
+
+    // 텍스트 InSpriteCount개 (UUID 라벨 길이 정도) + 빌보드 InSpriteCount개
+    TArray<FString> Texts(InSpriteCount);
+    TArray<FMatrix> TextMatrices(InSpriteCount);
+    TArray<FVector> BillboardCenters(InSpriteCount);
+    for (uint32 i = 0; i < InSpriteCount; ++i)
+    {
+        Texts[i] = "UUID : " + std::to_string(100000 + i);
+        TextMatrices[i] = FMatrix::Identity();
+        TextMatrices[i].M[3][0] = static_cast<float>(i % 100);
+        TextMatrices[i].M[3][1] = static_cast<float>(i / 100);
+        BillboardCenters[i] = FVector(static_cast<float>(i % 100), static_cast<float>(i / 100), 2.0f);
+    }
+    const FVector CameraRight(0.0f, 1.0f, 0.0f);
+    const FVector CameraUp(0.0f, 0.0f, 1.0f);
+    const void* FontAtlas = &Texts;
+    const void* IconAtlases[IconAtlasCount] = { &TextMatrices, &BillboardCenters, &CameraRight, &CameraUp };
+
+    // --- 기존 방식 ---
+    TMap<char, FBillboardVertexInfo> CharInfoMap;
+    for (char Ch = 32; Ch <= 126; ++Ch)
+    {
+        const int32 Key = Ch - 32;
+        FBillboardVertexInfo Info;
+        Info.UVRect = FVector4((Key % 16) * 32.f / 512.f, (Key / 16) * 32.f / 512.f, 32.f / 512.f, 32.f / 512.f);
+        CharInfoMap[Ch] = Info;
+    }
+    TArray<FBillboardVertexInfo_GPU> FakeGpuBuffer(400);   // 컴포넌트마다 Map/DISCARD/Unmap 하던 100쿼드 버퍼
+    uint64 LegacyChecksum = 0;
+    uint32 LegacyUploads = 0, LegacyDraws = 0;
+
+    const uint64 LegacyStart = FPlatformTime::Cycles64();
+    for (uint32 Frame = 0; Frame < FrameCount; ++Frame)
+    {
+        for (uint32 i = 0; i < InSpriteCount; ++i)
+        {
+            TArray<FBillboardVertexInfo_GPU> TextVertices = LegacyCreateVerticesForString(CharInfoMap, Texts[i]);
+            const size_t Count = std::min(TextVertices.size(), FakeGpuBuffer.size());
+            memcpy(FakeGpuBuffer.data(), TextVertices.data(), Count * sizeof(FBillboardVertexInfo_GPU));
+            LegacyChecksum += Count;
+            ++LegacyUploads;
+            ++LegacyDraws;
+        }
+        for (uint32 i = 0; i < InSpriteCount; ++i)
+        {
+            // 빌보드마다 월드 행렬을 만들고 드로우 한 번
+            const FMatrix World = FMatrix::MakeScale(1.0f) * FMatrix::MakeTranslation(BillboardCenters[i]);
+            LegacyChecksum += static_cast<uint64>(World.M[3][0]);
+            ++LegacyDraws;
+        }
+    }
+    const double LegacyMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - LegacyStart) / FrameCount;
+
+    // --- 배처 ---
+    FGlyphTable Glyphs;
+    Glyphs.BuildGrid(512.f, 32.f, 16, 32, 126);
+    TArray<FTextQuadCache> Caches(InSpriteCount);
+    FSpriteBatcher Batcher;
+    FRingAllocator Ring(1u << 20);
+    TArray<FSpriteVertex> FakeRingBuffer(Ring.GetCapacity());
+    uint64 BatchedChecksum = 0;
+
+    auto RunFrames = [&](uint32 InChangeEvery, FSpriteBatchStats& OutLastStats, uint32& OutDiscards) -> double
+    {
+        OutDiscards = 0;
+        const uint64 Start = FPlatformTime::Cycles64();
+        for (uint32 Frame = 0; Frame < FrameCount; ++Frame)
+        {
+            Batcher.Reset();
+            for (uint32 i = 0; i < InSpriteCount; ++i)
+            {
+                // InChangeEvery마다 한 개씩 문자열 변경 (0이면 변경 없음)
+                if (InChangeEvery > 0 && (i + Frame) % InChangeEvery == 0)
+                {
+                    Texts[i].back() = static_cast<char>('0' + (Frame / InChangeEvery) % 10);
+                }
+                Batcher.AddText(FontAtlas, Caches[i], Glyphs, Texts[i], TextMatrices[i], 0xFFFFFFFF, i);
+            }
+            for (uint32 i = 0; i < InSpriteCount; ++i)
+            {
+                Batcher.AddBillboard(IconAtlases[i % IconAtlasCount], BillboardCenters[i], 1.0f, CameraRight, CameraUp, 0xFFFFFFFF, i);
+            }
+            Batcher.Build(MaxQuadsPerBatch);
+
+            // 링 버퍼에 한 번에 기록 (GPU 버퍼 대신 CPU 메모리)
+            const uint32 VertexCount = Batcher.GetVertexCount();
+            uint32 Offset = 0;
+            bool bWrapped = false;
+            if (!Ring.Allocate(VertexCount, Offset, bWrapped))
+            {
+                Ring.Reset(VertexCount * 2);
+                FakeRingBuffer.resize(Ring.GetCapacity());
+                Ring.Allocate(VertexCount, Offset, bWrapped);
+            }
+            Batcher.CopyVertices(FakeRingBuffer.data() + Offset);
+            OutDiscards += bWrapped ? 1 : 0;
+            BatchedChecksum += VertexCount + Offset;
+        }
+        OutLastStats = Batcher.GetStats();
+        return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start) / FrameCount;
+    };
+
+    FSpriteBatchStats ColdStats, StaticStats, ChangingStats;
+    uint32 ColdDiscards = 0, StaticDiscards = 0, ChangingDiscards = 0;
+    const double ColdMs = RunFrames(1, ColdStats, ColdDiscards);            // 매 프레임 모든 텍스트 변경
+    const double StaticMs = RunFrames(0, StaticStats, StaticDiscards);      // 변경 없음
+    const double ChangingMs = RunFrames(10, ChangingStats, ChangingDiscards); // 10%만 변경
+
+    UE_LOG("[SpriteBench] %u texts + %u billboards (%u icon atlases), %u frames", InSpriteCount, InSpriteCount, IconAtlasCount, FrameCount);
+    UE_LOG("[SpriteBench] %-28s | %8.3f ms/frame | uploads %6u | draws %6u", "Legacy (per component)", LegacyMs, LegacyUploads / FrameCount, LegacyDraws / FrameCount);
+    UE_LOG("[SpriteBench] %-28s | %8.3f ms/frame | uploads %6u | draws %6u | rebuilt %u", "Batched, all text changing", ColdMs, 1u, ColdStats.BatchCount, ColdStats.TextRebuildCount);
+    UE_LOG("[SpriteBench] %-28s | %8.3f ms/frame | uploads %6u | draws %6u | rebuilt %u", "Batched, 10% text changing", ChangingMs, 1u, ChangingStats.BatchCount, ChangingStats.TextRebuildCount);
+    UE_LOG("[SpriteBench] %-28s | %8.3f ms/frame | uploads %6u | draws %6u | rebuilt %u", "Batched, static text", StaticMs, 1u, StaticStats.BatchCount, StaticStats.TextRebuildCount);
+    UE_LOG("[SpriteBench] quads/frame %u, ring discards %u/%u frames, checksum %llu/%llu",
+        StaticStats.QuadCount, StaticDiscards, FrameCount, LegacyChecksum, BatchedChecksum);
+}
@@ -0,0 +1,191 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Vector.h"
+#include <array>
+
+/**
+ * 텍스트/빌보드 스프라이트 배칭 (CPU 전용, D3D 의존 없음)
+ *
+ * 모든 텍스트 글자와 빌보드 쿼드를 월드 공간 정점으로 만들어 하나의 정점 스트림에 모은 뒤
+ * 아틀라스(텍스처)별로 묶어 소수의 드로우로 그립니다. GPU 업로드는 FSpriteVertexStream이 담당합니다.
+ * 정점 순서는 쿼드마다 좌상/우상/좌하/우하이며, 인덱스는 (0,1,2)(2,1,3) 패턴을 공유합니다.
+ */
+
+// 스프라이트 정점 (28 bytes, Shaders/UI/SpriteBatch.hlsl 입력 레이아웃과 일치)
+struct FSpriteVertex
+{
+    FVector Position;       // 월드 공간
+    FVector2D UV;
+    uint32 Color = 0xFFFFFFFF;  // R8G8B8A8_UNORM (R이 최하위 바이트)
+    uint32 ObjectID = 0;        // 피킹용 UUID
+};
+static_assert(sizeof(FSpriteVertex) == 28, "FSpriteVertex must match the SpriteBatch.hlsl input layout");
+
+inline uint32 PackSpriteColor(float InR, float InG, float InB, float InA)
+{
+    auto ToByte = [](float InValue) -> uint32
+    {
+        const float Clamped = InValue < 0.0f ? 0.0f : (InValue > 1.0f ? 1.0f : InValue);
+        return static_cast<uint32>(Clamped * 255.0f + 0.5f);
+    };
+    return ToByte(InR) | (ToByte(InG) << 8) | (ToByte(InB) << 16) | (ToByte(InA) << 24);
+}
+
+// 글자 하나의 아틀라스 UV 영역
+struct FGlyphInfo
+{
+    float U = 0.0f;
+    float V = 0.0f;
+    float Width = 0.0f;     // UV 단위
+    float Height = 0.0f;
+    bool bValid = false;
+};
+
+/**
+ * 바이트 값으로 바로 인덱싱하는 256칸 글리프 테이블.
+ * 기존 TMap<char, FBillboardVertexInfo> 조회(해시)를 배열 접근으로 대체합니다.
+ */
+class FGlyphTable
+{
+public:
+    // 정사각 셀 격자 아틀라스 (InFirstChar부터 행 우선 배치)
+    void BuildGrid(float InAtlasSize, float InCellSize, uint32 InColumns, uint8 InFirstChar, uint8 InLastChar);
+
+    const FGlyphInfo& Get(uint8 InChar) const { return Glyphs[InChar]; }
+    bool IsEmpty() const { return !bBuilt; }
+
+    // 글자 폭 / 높이 비 (모든 글자가 같은 셀 크기를 쓰므로 하나)
+    float GetAspect() const { return Aspect; }
+
+private:
+    std::array<FGlyphInfo, 256> Glyphs{};
+    float Aspect = 1.0f;
+    bool bBuilt = false;
+};
+
+/**
+ * 텍스트 컴포넌트별 테셀레이션 캐시.
+ * 문자열, 월드 행렬, 색상, ObjectID가 그대로면 이전 프레임의 월드 공간 쿼드를 재사용합니다.
+ */
+struct FTextQuadCache
+{
+    FString Text;
+    FMatrix WorldMatrix;
+    uint32 Color = 0;
+    uint32 ObjectID = 0;
+    bool bValid = false;
+
+    TArray<FSpriteVertex> Vertices;     // 글자당 4개
+
+    void Invalidate() { bValid = false; }
+};
+
+// 아틀라스 하나로 그리는 연속 구간 (정점 스트림 기준)
+struct FSpriteDrawBatch
+{
+    const void* Atlas = nullptr;    // 보통 ID3D11ShaderResourceView*
+    uint32 FirstVertex = 0;
+    uint32 QuadCount = 0;
+};
+
+struct FSpriteBatchStats
+{
+    uint32 TextCount = 0;
+    uint32 TextRebuildCount = 0;    // 이번 프레임에 다시 테셀레이션한 텍스트 수
+    uint32 BillboardCount = 0;
+    uint32 QuadCount = 0;
+    uint32 BatchCount = 0;
+};
+
+/**
+ * 프레임(뷰) 단위 스프라이트 배처.
+ * Reset -> AddText/AddBillboard... -> Build 순으로 호출하면 GetBatches()가 아틀라스마다 (최대 InMaxQuadsPerBatch 쿼드씩)
+ * 드로우 구간을 돌려주고, CopyVertices가 같은 순서로 정점을 매핑된 GPU 메모리에 바로 씁니다 (중간 복사 없음).
+ */
+class FSpriteBatcher
+{
+public:
+    void Reset();
+
+    /**
+     * 텍스트를 캐시에 테셀레이션 (바뀐 경우에만) 합니다.
+     * 레이아웃은 기존 TextBillboard와 같습니다: 로컬 (0, X, Y) 평면에 높이 1, 가운데 정렬.
+     * @return 다시 만들었으면 true
+     */
+    static bool TessellateText(FTextQuadCache& InOutCache, const FGlyphTable& InGlyphs, const FString& InText,
+        const FMatrix& InWorldMatrix, uint32 InColor, uint32 InObjectID);
+
+    // 필요하면 캐시를 다시 테셀레이션한 뒤 글자 쿼드를 추가
+    void AddText(const void* InAtlas, FTextQuadCache& InOutCache, const FGlyphTable& InGlyphs, const FString& InText,
+        const FMatrix& InWorldMatrix, uint32 InColor, uint32 InObjectID);
+
+    // 카메라를 향하는 사각형 (InRight/InUp은 월드 공간 카메라 축, 크기는 한 변 길이)
+    void AddBillboard(const void* InAtlas, const FVector& InCenter, float InSize, const FVector& InRight, const FVector& InUp,
+        uint32 InColor, uint32 InObjectID);
+
+    // 아틀라스 순서대로 배치 목록을 만듭니다.
+    void Build(uint32 InMaxQuadsPerBatch);
+
+    // Build 순서로 정점 GetVertexCount()개를 OutDest에 씁니다.
+    void CopyVertices(FSpriteVertex* OutDest) const;
+    uint32 GetVertexCount() const { return Stats.QuadCount * 4; }
+    const TArray<FSpriteDrawBatch>& GetBatches() const { return Batches; }
+    const FSpriteBatchStats& GetStats() const { return Stats; }
+    bool IsEmpty() const { return Stats.QuadCount == 0; }
+
+    // 스프라이트 수만큼 텍스트/빌보드를 만들어 기존 방식(글자마다 TMap 조회, 컴포넌트마다 정점 배열/업로드/드로우)과 비교
+    static void RunBenchmark(uint32 InSpriteCount);
+
+private:
+    // 아틀라스별 정점 모음 (Reset해도 용량은 유지해 프레임마다 재할당하지 않음)
+    struct FAtlasBucket
+    {
+        const void* Atlas = nullptr;
+        TArray<FSpriteVertex> Vertices;
+    };
+
+    TArray<FSpriteVertex>& GetBucketVertices(const void* InAtlas);
+
+    TArray<FAtlasBucket> Buckets;       // 아틀라스 수는 보통 한 자릿수라 선형 탐색
+    uint32 LastBucketIndex = 0;
+    TArray<FSpriteDrawBatch> Batches;
+    FSpriteBatchStats Stats;
+};
+
+/**
+ * 영구 동적 버퍼의 링 할당기 (단위 무관: 정점, 바이트 등).
+ * 버퍼 끝을 넘으면 처음으로 돌아가며 bOutWrapped를 세웁니다.
+ * 호출 측은 wrap이면 MAP_WRITE_DISCARD, 아니면 MAP_WRITE_NO_OVERWRITE로 매핑합니다.
+ */
+class FRingAllocator
+{
+public:
+    explicit FRingAllocator(uint32 InCapacity = 0) : Capacity(InCapacity) {}
+
+    void Reset(uint32 InCapacity) { Capacity = InCapacity; Head = 0; }
+
+    // InCount가 용량보다 크면 false (버퍼를 키워야 함)
+    bool Allocate(uint32 InCount, uint32& OutOffset, bool& bOutWrapped)
+    {
+        if (InCount == 0 || InCount > Capacity)
+        {
+            return false;
+        }
+
+        bOutWrapped = (Head + InCount > Capacity) || Head == 0;
+        if (Head + InCount > Capacity)
+        {
+            Head = 0;
+        }
+        OutOffset = Head;
+        Head += InCount;
+        return true;
+    }
+
+    uint32 GetCapacity() const { return Capacity; }
+    uint32 GetHead() const { return Head; }
+
+private:
+    uint32 Capacity = 0;
+    uint32 Head = 0;
+};
@@ -0,0 +1,122 @@
+﻿#include "pch.h"
+#include "SpriteVertexStream.h"
+
+FSpriteVertexStream::~FSpriteVertexStream()
+{
+    Release();
+}
+
+void FSpriteVertexStream::Initialize(D3D11RHI* InRHI, uint32 InVertexCapacity)
+{
+    Release();
+    RHIDevice = InRHI;
+    if (!RHIDevice || !RHIDevice->GetDevice())
+    {
+        return;
+    }
+
+    // 공유 쿼드 인덱스 버퍼 (DrawMeshBatches가 R32_UINT로 바인딩)
+    TArray<uint32> Indices;
+    Indices.reserve(MaxQuadsPerDraw * 6);
+    for (uint32 Quad = 0; Quad < MaxQuadsPerDraw; ++Quad)
+    {
+        const uint32 Base = Quad * 4;
+        Indices.Add(Base + 0); Indices.Add(Base + 1); Indices.Add(Base + 2);
+        Indices.Add(Base + 2); Indices.Add(Base + 1); Indices.Add(Base + 3);
+    }
+
+    D3D11_BUFFER_DESC IndexDesc = {};
+    IndexDesc.Usage = D3D11_USAGE_IMMUTABLE;
+    IndexDesc.ByteWidth = static_cast<UINT>(Indices.size() * sizeof(uint32));
+    IndexDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+
+    D3D11_SUBRESOURCE_DATA IndexData = {};
+    IndexData.pSysMem = Indices.data();
+    if (FAILED(RHIDevice->GetDevice()->CreateBuffer(&IndexDesc, &IndexData, &IndexBuffer)))
+    {
+        UE_LOG("FSpriteVertexStream: Failed to create quad index buffer");
+        return;
+    }
+
+    CreateVertexBuffer(InVertexCapacity);
+}
+
+void FSpriteVertexStream::Release()
+{
+    if (VertexBuffer)
+    {
+        VertexBuffer->Release();
+        VertexBuffer = nullptr;
+    }
+    if (IndexBuffer)
+    {
+        IndexBuffer->Release();
+        IndexBuffer = nullptr;
+    }
+    Ring.Reset(0);
+}
+
+bool FSpriteVertexStream::CreateVertexBuffer(uint32 InVertexCapacity)
+{
+    if (VertexBuffer)
+    {
+        VertexBuffer->Release();
+        VertexBuffer = nullptr;
+    }
+
+    D3D11_BUFFER_DESC VertexDesc = {};
+    VertexDesc.Usage = D3D11_USAGE_DYNAMIC;
+    VertexDesc.ByteWidth = InVertexCapacity * sizeof(FSpriteVertex);
+    VertexDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    VertexDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    if (FAILED(RHIDevice->GetDevice()->CreateBuffer(&VertexDesc, nullptr, &VertexBuffer)))
+    {
+        UE_LOG("FSpriteVertexStream: Failed to create vertex buffer (%u vertices)", InVertexCapacity);
+        Ring.Reset(0);
+        return false;
+    }
+
+    Ring.Reset(InVertexCapacity);
+    return true;
+}
+
+bool FSpriteVertexStream::Upload(const FSpriteBatcher& InBatcher, uint32& OutBaseVertex)
+{
+    const uint32 VertexCount = InBatcher.GetVertexCount();
+    if (!RHIDevice || !IndexBuffer || VertexCount == 0)
+    {
+        return false;
+    }
+
+    uint32 Offset = 0;
+    bool bWrapped = false;
+    if (!Ring.Allocate(VertexCount, Offset, bWrapped))
+    {
+        // 한 뷰의 정점이 버퍼보다 많으면 두 배씩 키움 (새 버퍼는 처음부터 DISCARD)
+        uint32 NewCapacity = std::max(Ring.GetCapacity(), 4096u);
+        while (NewCapacity < VertexCount)
+        {
+            NewCapacity *= 2;
+        }
+        if (!CreateVertexBuffer(NewCapacity) || !Ring.Allocate(VertexCount, Offset, bWrapped))
+        {
+            return false;
+        }
+    }
+
+    D3D11_MAPPED_SUBRESOURCE Mapped = {};
+    const D3D11_MAP MapType = bWrapped ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+    if (FAILED(RHIDevice->GetDeviceContext()->Map(VertexBuffer, 0, MapType, 0, &Mapped)))
+    {
+        return false;
+    }
+
+    InBatcher.CopyVertices(static_cast<FSpriteVertex*>(Mapped.pData) + Offset);
+    RHIDevice->GetDeviceContext()->Unmap(VertexBuffer, 0);
+
+    ++UploadCount;
+    DiscardCount += bWrapped ? 1 : 0;
+    OutBaseVertex = Offset;
+    return true;
+}
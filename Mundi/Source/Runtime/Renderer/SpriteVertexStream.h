@@ -0,0 +1,43 @@
+﻿#pragma once
+#include "SpriteBatch.h"
+#include "D3D11RHI.h"
+
+/**
+ * 텍스트/빌보드가 공유하는 영구 동적 정점 스트림.
+ * 뷰마다 FSpriteBatcher의 정점을 한 번의 Map(NO_OVERWRITE, 링이 돌면 DISCARD)으로 기록하고,
+ * 쿼드 인덱스 패턴 (0,1,2)(2,1,3)을 담은 정적 인덱스 버퍼를 모든 배치가 공유합니다.
+ */
+class FSpriteVertexStream
+{
+public:
+    // 한 드로우의 최대 쿼드 수 (공유 인덱스 버퍼 크기)
+    static constexpr uint32 MaxQuadsPerDraw = 16384;
+
+    FSpriteVertexStream() = default;
+    ~FSpriteVertexStream();
+
+    void Initialize(D3D11RHI* InRHI, uint32 InVertexCapacity = 65536);
+    void Release();
+
+    // 정점을 링 버퍼에 기록하고 스트림 내 시작 정점을 반환. 버퍼가 작으면 키움. 실패 시 false
+    bool Upload(const FSpriteBatcher& InBatcher, uint32& OutBaseVertex);
+
+    ID3D11Buffer* GetVertexBuffer() const { return VertexBuffer; }
+    ID3D11Buffer* GetIndexBuffer() const { return IndexBuffer; }
+    static constexpr uint32 GetVertexStride() { return sizeof(FSpriteVertex); }
+
+    uint32 GetUploadCount() const { return UploadCount; }
+    uint32 GetDiscardCount() const { return DiscardCount; }
+
+private:
+    bool CreateVertexBuffer(uint32 InVertexCapacity);
+
+    D3D11RHI* RHIDevice = nullptr;
+    ID3D11Buffer* VertexBuffer = nullptr;
+    ID3D11Buffer* IndexBuffer = nullptr;
+    FRingAllocator Ring;
+
+    // 누적 통계
+    uint32 UploadCount = 0;
+    uint32 DiscardCount = 0;
+};
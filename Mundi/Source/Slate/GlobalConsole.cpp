@@ -1,10 +1,14 @@
 ﻿#include "pch.h"
 #include "Widgets/ConsoleWidget.h"
+#include <mutex>
 
 IMPLEMENT_CLASS(UGlobalConsole)
 
 UConsoleWidget* UGlobalConsole::ConsoleWidget = nullptr;
 
+// 에셋 프리페치 등 워커 스레드에서도 UE_LOG가 호출되므로 출력 버퍼 추가를 직렬화
+static std::mutex GConsoleLogMutex;
+
 void UGlobalConsole::Initialize()
 {
     // Nothing special to initialize
@@ -43,6 +47,7 @@ void UGlobalConsole::Log(const char* fmt, ...)
 
 void UGlobalConsole::LogV(const char* fmt, va_list args)
 {
+    std::lock_guard<std::mutex> Lock(GConsoleLogMutex);
     if (ConsoleWidget)
     {
         ConsoleWidget->VAddLog(fmt, args);
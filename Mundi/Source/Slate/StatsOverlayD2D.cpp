@@ -321,7 +321,7 @@ void UStatsOverlayD2D::Draw()
 			double CSMMediumUsedMB = static_cast<double>(ShadowStats.CSMTierUsedBytes[1]) / (1024.0 * 1024.0);
 			double CSMHighUsedMB = static_cast<double>(ShadowStats.CSMTierUsedBytes[2]) / (1024.0 * 1024.0);
 
-			swprintf_s(Buf, L"[Shadow Map Stats]\n해상도:\n  Dir (CSM):\n    Low: %ux%u (%u개)\n    Med: %ux%u (%u개)\n    High: %ux%u (%u개)\n  Spot: %ux%u\n  Point: %ux%u\n메모리:\n  Dir CSM: %.2f MB\n    Low: %.2f MB\n    Med: %.2f MB\n    High: %.2f MB\n  Spot: %u개 (%.2f MB)\n  Point: %u개 (%.2f MB)\n전체: %u개\n전체 메모리: %.2f MB",
+			swprintf_s(Buf, L"[Shadow Map Stats]\n해상도:\n  Dir (CSM):\n    Low: %ux%u (%u개)\n    Med: %ux%u (%u개)\n    High: %ux%u (%u개)\n  Spot: %ux%u\n  Point: %ux%u\n메모리:\n  Dir CSM: %.2f MB\n    Low: %.2f MB\n    Med: %.2f MB\n    High: %.2f MB\n  Spot: %u개 (%.2f MB)\n    갱신 %u / 재사용 %u\n  Point: %u개 (%.2f MB)\n전체: %u개\n전체 메모리: %.2f MB",
 				ShadowStats.CSMTierResolutions[0], ShadowStats.CSMTierResolutions[0], ShadowStats.CSMTierCascadeCounts[0],
 				ShadowStats.CSMTierResolutions[1], ShadowStats.CSMTierResolutions[1], ShadowStats.CSMTierCascadeCounts[1],
 				ShadowStats.CSMTierResolutions[2], ShadowStats.CSMTierResolutions[2], ShadowStats.CSMTierCascadeCounts[2],
@@ -333,6 +333,8 @@ void UStatsOverlayD2D::Draw()
 				CSMHighUsedMB,
 				ShadowStats.SpotLightCount,
 				SpotUsedMB,
+				ShadowStats.SpotLightAtlasDirtyTiles,
+				ShadowStats.SpotLightAtlasCachedTiles,
 				ShadowStats.PointLightCount,
 				PointUsedMB,
 				ShadowStats.GetTotalLightCount(),
@@ -343,7 +345,7 @@ void UStatsOverlayD2D::Draw()
 			// Non-CSM: 기존 방식 유지
 			double DirUsedMB = static_cast<double>(ShadowStats.DirectionalLightUsedBytes) / (1024.0 * 1024.0);
 
-			swprintf_s(Buf, L"[Shadow Map Stats]\n해상도:\n  Dir: %ux%u\n  Spot: %ux%u\n  Point: %ux%u\n메모리:\n  Dir: %u개 (%.2f MB)\n  Spot: %u개 (%.2f MB)\n  Point: %u개 (%.2f MB)\n전체: %u개\n전체 메모리: %.2f MB",
+			swprintf_s(Buf, L"[Shadow Map Stats]\n해상도:\n  Dir: %ux%u\n  Spot: %ux%u\n  Point: %ux%u\n메모리:\n  Dir: %u개 (%.2f MB)\n  Spot: %u개 (%.2f MB)\n    갱신 %u / 재사용 %u\n  Point: %u개 (%.2f MB)\n전체: %u개\n전체 메모리: %.2f MB",
 				ShadowStats.DirectionalLightResolution,
 				ShadowStats.DirectionalLightResolution,
 				ShadowStats.SpotLightResolution,
@@ -354,6 +356,8 @@ void UStatsOverlayD2D::Draw()
 				DirUsedMB,
 				ShadowStats.SpotLightCount,
 				SpotUsedMB,
+				ShadowStats.SpotLightAtlasDirtyTiles,
+				ShadowStats.SpotLightAtlasCachedTiles,
 				ShadowStats.PointLightCount,
 				PointUsedMB,
 				ShadowStats.GetTotalLightCount(),
@@ -362,7 +366,7 @@ void UStatsOverlayD2D::Draw()
 
 		// 4. 텍스트를 여러 줄 표시해야 하므로 패널 크기를 늘립니다.
 		const float shadowPanelWidth = 280.0f;
-		const float shadowPanelHeight = ShadowStats.bUsingCSM ? 360.0f : 270.0f;
+		const float shadowPanelHeight = ShadowStats.bUsingCSM ? 380.0f : 290.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + shadowPanelWidth, NextY + shadowPanelHeight);
 
 		// 5. DrawTextBlock 함수를 호출하여 화면에 그립니다.
@@ -192,12 +192,34 @@ void USlateManager::SwitchPanel(SWindow* SwitchPanel)
     }
 }
 
+void USlateManager::RegisterViewFamily()
+{
+    if (!TopPanel)
+        return;
+
+    // 4분할이면 네 뷰포트 모두, 단일 레이아웃이면 TopPanel 왼쪽에 놓인 뷰포트 하나만 그려짐
+    const bool bFourSplit = TopPanel->SideLT == LeftPanel;
+    for (SViewportWindow* ViewportWindow : Viewports)
+    {
+        if (!ViewportWindow || (!bFourSplit && TopPanel->SideLT != ViewportWindow))
+            continue;
+
+        FViewportClient* ViewportClient = ViewportWindow->GetViewportClient();
+        if (ViewportClient)
+        {
+            ViewportClient->AddToViewFamily(ViewportWindow->GetViewport());
+        }
+    }
+}
+
 void USlateManager::Render()
 {
     // 메인 툴바 렌더링 (항상 최상단에)
     MainToolbar->RenderWidget();
     if (TopPanel)
     {
+        // 뷰포트를 그리기 전에 모든 뷰를 등록해 두면 프록시 수집/절두체 질의/섀도우가 뷰포트 수와 무관하게 한 번
+        RegisterViewFamily();
         TopPanel->OnRender();
     }
 
@@ -74,6 +74,9 @@ public:
     void StopPilotingActor(AActor* TargetActor);
 
 private:
+    // 이번 프레임에 그려질 뷰포트를 렌더러 뷰 패밀리에 먼저 등록
+    void RegisterViewFamily();
+
     FRect Rect; // 이전엔 SWindow로부터 상속받던 영역 정보
 
     UWorld* World = nullptr;
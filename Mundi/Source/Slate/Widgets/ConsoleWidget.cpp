@@ -3,6 +3,15 @@
 #include "ObjectFactory.h"
 #include "GlobalConsole.h"
 #include "StatsOverlayD2D.h"
+#include "LevelLoader.h"
+#include "TickManager.h"
+#include "Delegate.h"
+#include "InputRecording.h"
+#include "SpriteBatch.h"
+#include "RenderBenchmark.h"
+#include "Renderer.h"
+#include "Occlusion.h"
+#include "SelfTest.h"
 #include <windows.h>
 #include <cstdarg>
 #include <cctype>
@@ -49,6 +58,26 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT ALL");
 	HelpCommandList.Add("STAT NONE");
 	HelpCommandList.Add("STAT LIGHT");
+	HelpCommandList.Add("LEVEL BENCH");
+	HelpCommandList.Add("LEVEL CONVERT");
+	HelpCommandList.Add("LEVEL LOADBENCH");
+	HelpCommandList.Add("SCRIPT PROFILE");
+	HelpCommandList.Add("SCRIPT PROFILE RESET");
+	HelpCommandList.Add("SCRIPT MATHBENCH");
+	HelpCommandList.Add("SCRIPT COROBENCH");
+	HelpCommandList.Add("TICK STATS");
+	HelpCommandList.Add("OBJECT CASTBENCH");
+	HelpCommandList.Add("OBJECT ITERBENCH");
+	HelpCommandList.Add("NAME BENCH");
+	HelpCommandList.Add("DELEGATE BENCH");
+	HelpCommandList.Add("INPUT RECORD");
+	HelpCommandList.Add("SPRITE BENCH");
+	HelpCommandList.Add("RHI BENCH");
+	HelpCommandList.Add("RHI STATS");
+	HelpCommandList.Add("SHADER CACHE");
+	HelpCommandList.Add("SHADER CACHE CLEAR");
+	HelpCommandList.Add("OCCLUSION STATS");
+	HelpCommandList.Add("TEST");
 
 	// Add welcome messages
 	AddLog("=== Console Widget Initialized ===");
@@ -337,6 +366,218 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowShadowMap(false);
 		AddLog("STAT: OFF");
 	}
+	else if (Stricmp(command_line, "LEVEL BENCH") == 0)
+	{
+		// 현재 레벨로 JSON / 바이너리 직렬화 비교 (결과는 UE_LOG로 출력)
+		UWorld* World = UUIManager::GetInstance().GetWorld();
+		if (World && World->GetLevel())
+		{
+			ULevelService::BenchmarkLevelSerialization(World->GetLevel());
+		}
+		else
+		{
+			AddLog("LEVEL BENCH: No level loaded");
+		}
+	}
+	else if (Strnicmp(command_line, "LEVEL LOADBENCH", 15) == 0)
+	{
+		// LEVEL LOADBENCH [액터 수] : 기본은 10k, 50k 두 번 실행 (결과는 UE_LOG로 출력)
+		unsigned int ActorCount = 0;
+		if (sscanf_s(command_line + 15, "%u", &ActorCount) == 1 && ActorCount > 0)
+		{
+			FLevelLoader::RunLoadBenchmark(ActorCount);
+		}
+		else
+		{
+			FLevelLoader::RunLoadBenchmark(10000);
+			FLevelLoader::RunLoadBenchmark(50000);
+		}
+	}
+	else if (Strnicmp(command_line, "LEVEL CONVERT", 13) == 0)
+	{
+		// LEVEL CONVERT <src> <dst> : 대상 확장자로 포맷 결정 (.level: 바이너리, 그 외: JSON)
+		char SourcePath[260] = {};
+		char DestPath[260] = {};
+		if (sscanf_s(command_line + 13, "%259s %259s", SourcePath, (unsigned)sizeof(SourcePath), DestPath, (unsigned)sizeof(DestPath)) == 2)
+		{
+			const bool bSuccess = ULevelService::ConvertLevelFile(SourcePath, DestPath);
+			AddLog("LEVEL CONVERT: %s", bSuccess ? "Done" : "Failed");
+		}
+		else
+		{
+			AddLog("Usage: LEVEL CONVERT <src.scene|src.level> <dst.scene|dst.level>");
+		}
+	}
+	else if (Stricmp(command_line, "SCRIPT PROFILE") == 0)
+	{
+		// 스크립트 파일별 누적 Tick 시간/호출 수 (결과는 UE_LOG로 출력)
+		UScriptManager::GetInstance().DumpScriptProfile();
+	}
+	else if (Strnicmp(command_line, "SCRIPT MATHBENCH", 16) == 0)
+	{
+		// SCRIPT MATHBENCH [연산 수] : 기본 10k (결과는 UE_LOG로 출력)
+		unsigned int OperationCount = 0;
+		if (sscanf_s(command_line + 16, "%u", &OperationCount) != 1 || OperationCount == 0)
+		{
+			OperationCount = 10000;
+		}
+		UScriptManager::GetInstance().RunMathBenchmark(OperationCount);
+	}
+	else if (Strnicmp(command_line, "SCRIPT COROBENCH", 16) == 0)
+	{
+		// SCRIPT COROBENCH [코루틴 수] : 기본 100k (결과는 UE_LOG로 출력)
+		unsigned int CoroutineCount = 0;
+		if (sscanf_s(command_line + 16, "%u", &CoroutineCount) != 1 || CoroutineCount == 0)
+		{
+			CoroutineCount = 100000;
+		}
+		UScriptManager::GetInstance().RunCoroutineBenchmark(CoroutineCount);
+	}
+	else if (Strnicmp(command_line, "OBJECT CASTBENCH", 16) == 0)
+	{
+		// OBJECT CASTBENCH [반복 수] : 기본 100 (결과는 UE_LOG로 출력)
+		unsigned int IterationCount = 0;
+		if (sscanf_s(command_line + 16, "%u", &IterationCount) != 1 || IterationCount == 0)
+		{
+			IterationCount = 100;
+		}
+		UClass::RunCastBenchmark(IterationCount);
+	}
+	else if (Strnicmp(command_line, "OBJECT ITERBENCH", 16) == 0)
+	{
+		// OBJECT ITERBENCH [필러 객체 수] : 기본 200k (결과는 UE_LOG로 출력)
+		unsigned int FillerCount = 0;
+		if (sscanf_s(command_line + 16, "%u", &FillerCount) != 1 || FillerCount == 0)
+		{
+			FillerCount = 200000;
+		}
+		ObjectFactory::RunObjectIteratorBenchmark(FillerCount);
+	}
+	else if (Strnicmp(command_line, "NAME BENCH", 10) == 0)
+	{
+		// NAME BENCH [스레드당 이름 수] : 기본 20k (이름 풀은 줄어들지 않으므로 작게 유지, 결과는 UE_LOG로 출력)
+		unsigned int NamesPerThread = 0;
+		if (sscanf_s(command_line + 10, "%u", &NamesPerThread) != 1 || NamesPerThread == 0)
+		{
+			NamesPerThread = 20000;
+		}
+		FNamePool::RunBenchmark(NamesPerThread);
+	}
+	else if (Strnicmp(command_line, "DELEGATE BENCH", 14) == 0)
+	{
+		// DELEGATE BENCH [반복 수] : 기본 1M (결과는 UE_LOG로 출력)
+		unsigned int IterationCount = 0;
+		if (sscanf_s(command_line + 14, "%u", &IterationCount) != 1 || IterationCount == 0)
+		{
+			IterationCount = 1000000;
+		}
+		RunDelegateBenchmark(IterationCount);
+	}
+	else if (Strnicmp(command_line, "INPUT RECORD", 12) == 0)
+	{
+		// INPUT RECORD [경로] : 다음 PIE 세션의 입력을 녹화 (PIE 종료 시 저장, -replay로 재생)
+		const char* Path = command_line + 12;
+		while (*Path == ' ') ++Path;
+		FInputRecorder::GetInstance().Arm(*Path ? FString(Path) : FString("Replays/LastSession.minput"));
+	}
+	else if (Strnicmp(command_line, "SPRITE BENCH", 12) == 0)
+	{
+		// SPRITE BENCH [텍스트/빌보드 수] : 기본 2000 (결과는 UE_LOG로 출력)
+		unsigned int SpriteCount = 0;
+		if (sscanf_s(command_line + 12, "%u", &SpriteCount) != 1 || SpriteCount == 0)
+		{
+			SpriteCount = 2000;
+		}
+		FSpriteBatcher::RunBenchmark(SpriteCount);
+	}
+	else if (Strnicmp(command_line, "RHI BENCH", 9) == 0)
+	{
+		// RHI BENCH [오브젝트 수] [json 경로] : 기본 10k, null RHI에서 배치 수집/정렬/제출 (결과는 UE_LOG로 출력)
+		unsigned int ObjectCount = 0;
+		char OutputPath[260] = {};
+		const int Parsed = sscanf_s(command_line + 9, "%u %259s", &ObjectCount, OutputPath, static_cast<unsigned>(sizeof(OutputPath)));
+		if (Parsed < 1 || ObjectCount == 0)
+		{
+			ObjectCount = 10000;
+		}
+		FRenderBenchmark::Run(ObjectCount, 120, Parsed >= 2 ? FString(OutputPath) : FString());
+	}
+	else if (Stricmp(command_line, "RHI STATS") == 0)
+	{
+		// 직전 프레임에 GPU로 보낸 명령 수
+		const FRHICommandStats& Stats = GEngine.GetRHIDevice()->GetCommandContext().GetLastFrameStats();
+		UE_LOG("RHI: %u draws, %llu indices, %u state changes (shader %u, VB %u, IB %u, SRV %u, sampler %u, CB bind %u, pipeline %u, RT %u)",
+			Stats.DrawCalls, static_cast<unsigned long long>(Stats.IndexCount), Stats.GetStateChangeCount(), Stats.ShaderChanges,
+			Stats.VertexBufferBinds, Stats.IndexBufferBinds, Stats.ShaderResourceBinds, Stats.SamplerBinds, Stats.ConstantBufferBinds,
+			Stats.PipelineStateChanges, Stats.RenderTargetChanges);
+		UE_LOG("RHI: %u constant buffer updates (%.1f KB)", Stats.ConstantBufferUpdates, static_cast<double>(Stats.ConstantBufferBytes) / 1024.0);
+
+		const D3D11RHI* RHIDevice = GEngine.GetRHIDevice();
+		if (RHIDevice->CanBindConstantBufferRanges())
+		{
+			const FFrameUploadAllocator& Upload = RHIDevice->GetUploadAllocator();
+			UE_LOG("RHI: upload ring %.1f KB/frame (peak %.1f KB, %u failed), %.1f / %.1f KB in flight over %u frames",
+				static_cast<double>(Upload.GetLastFrameStats().AllocatedBytes) / 1024.0, static_cast<double>(Upload.GetPeakFrameBytes()) / 1024.0,
+				Upload.GetLastFrameStats().FailedAllocations, static_cast<double>(Upload.GetUsedBytes()) / 1024.0,
+				static_cast<double>(Upload.GetCapacity()) / 1024.0, Upload.GetPendingFrameCount());
+		}
+		else
+		{
+			UE_LOG("RHI: upload ring unavailable (per-draw constant buffer updates)");
+		}
+	}
+	else if (Stricmp(command_line, "SHADER CACHE CLEAR") == 0)
+	{
+		// 디스크 바이트코드 캐시 삭제 (로드된 Variant는 그대로, 다음 컴파일부터 다시 채워짐)
+		UShader::GetCompileManager().GetCache().Clear();
+		UE_LOG("Shader cache cleared");
+	}
+	else if (Stricmp(command_line, "SHADER CACHE") == 0)
+	{
+		FShaderCompileManager& Manager = UShader::GetCompileManager();
+		const FShaderCompileStats& Stats = Manager.GetStats();
+		UE_LOG("Shader cache: %u entries (%.1f KB) in %s", Manager.GetCache().GetEntryCount(),
+			static_cast<double>(Manager.GetCache().GetTotalBytes()) / 1024.0, Manager.GetCache().GetDirectory().c_str());
+		UE_LOG("Shader cache: %u hits, %u misses, %u failures, %.1f ms compiling", Stats.CacheHits, Stats.CacheMisses, Stats.Failures, Stats.TotalCompileMs);
+	}
+	else if (Stricmp(command_line, "TEST") == 0 || Strnicmp(command_line, "TEST ", 5) == 0)
+	{
+		// TEST [필터] : 등록된 엔진 단위 테스트 실행 (이름에 필터가 들어간 것만, 결과는 UE_LOG로 출력)
+		char Filter[128] = {};
+		if (sscanf_s(command_line + 4, "%127s", Filter, static_cast<unsigned>(sizeof(Filter))) != 1)
+		{
+			Filter[0] = '\0';
+		}
+		FSelfTestRegistry::RunTests(Filter);
+	}
+	else if (Stricmp(command_line, "OCCLUSION STATS") == 0)
+	{
+		// 마지막으로 그린 뷰의 CPU 오클루전 컬링 결과
+		const FOcclusionCullingManagerCPU& Occlusion = GEngine.GetRenderer()->GetOcclusionCulling();
+		const FOcclusionStats& Stats = Occlusion.GetStats();
+		UE_LOG("Occlusion: %u / %u occluders (%u triangles) into %dx%d depth, %.3f ms raster",
+			Stats.Occluders, Stats.OccluderCandidates, Stats.OccluderTriangles,
+			Occlusion.GetDepthBuffer().GetWidth(), Occlusion.GetDepthBuffer().GetHeight(), Stats.RasterMs);
+		UE_LOG("Occlusion: %u / %u bounds occluded, %.3f ms test", Stats.OccludedBounds, Stats.TestedBounds, Stats.TestMs);
+	}
+	else if (Stricmp(command_line, "TICK STATS") == 0)
+	{
+		// 현재 월드 틱 그룹별 시간/틱 수 (결과는 UE_LOG로 출력)
+		UWorld* World = UUIManager::GetInstance().GetWorld();
+		if (World && World->GetTickManager())
+		{
+			World->GetTickManager()->DumpStats();
+		}
+		else
+		{
+			AddLog("TICK STATS: No world");
+		}
+	}
+	else if (Stricmp(command_line, "SCRIPT PROFILE RESET") == 0)
+	{
+		UScriptManager::GetInstance().ResetScriptProfile();
+		AddLog("SCRIPT PROFILE: Reset");
+	}
 	else
 	{
 		AddLog("Unknown command: '%s'", command_line);
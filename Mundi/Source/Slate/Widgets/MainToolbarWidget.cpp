@@ -2,6 +2,7 @@
 #include "MainToolbarWidget.h"
 #include "ImGui/imgui.h"
 #include "Level.h"
+#include "LevelLoader.h"
 #include "JsonSerializer.h"
 #include "SelectionManager.h"
 #include "CameraActor.h"
@@ -518,11 +519,11 @@ void UMainToolbarWidget::OnSaveScene()
             UE_LOG("MainToolbar: Created Scene directory");
         }
 
-        FString FilePath = "Scene/" + SceneName + ".Scene";
+        // 선택한 확장자로 포맷 결정 (.level: 바이너리, 그 외: JSON)
+        const ELevelFileFormat Format = ULevelService::GetFormatFromPath(selectedPath.string());
+        FString FilePath = "Scene/" + SceneName + (Format == ELevelFileFormat::Binary ? ".level" : ".Scene");
 
-        JSON LevelJson;
-        CurrentWorld->GetLevel()->Serialize(false, LevelJson);
-        bool bSuccess = FJsonSerializer::SaveJsonToFile(LevelJson, FilePath);
+        bool bSuccess = ULevelService::SaveLevelToFile(CurrentWorld->GetLevel(), FilePath, Format);
 
         UE_LOG("MainToolbar: Scene saved: %s", SceneName.c_str());
     }
@@ -568,18 +569,22 @@ void UMainToolbarWidget::OnLoadScene()
         UUIManager::GetInstance().ClearTransformWidgetSelection();
         GWorld->GetSelectionManager()->ClearSelection();
 
-        std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-        JSON LevelJsonData;
-        if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, InFilePath))
+        // 단계별 로드 (파일 매직으로 JSON/바이너리 판별, 에셋 일괄 로드 후 액터 생성, 마지막에 일괄 등록)
+        int32 LastReportedPercent = -1;
+        FLevelLoader Loader([&LastReportedPercent](const FLevelLoadProgress& Progress)
         {
-            NewLevel->Serialize(true, LevelJsonData);
-        }
-        else
+            const int32 Percent = static_cast<int32>(Progress.Overall * 100.0f);
+            if (Percent / 10 != LastReportedPercent / 10)
+            {
+                LastReportedPercent = Percent;
+                UE_LOG("MainToolbar: Loading scene... %d%%", Percent);
+            }
+        });
+        if (!Loader.LoadIntoWorld(CurrentWorld, InFilePath))
         {
             UE_LOG("MainToolbar: Failed To Load Level From: %s", InFilePath.c_str());
             return;
         }
-        CurrentWorld->SetLevel(std::move(NewLevel));
 
         UE_LOG("MainToolbar: Scene loaded successfully: %s", InFilePath.c_str());
     }
@@ -607,7 +612,7 @@ std::filesystem::path UMainToolbarWidget::OpenSaveFileDialog()
     ofn.hwndOwner = GetActiveWindow();
     ofn.lpstrFile = szFile;
     ofn.nMaxFile = sizeof(szFile) / sizeof(wchar_t);
-    ofn.lpstrFilter = L"Scene Files\0*.scene\0All Files\0*.*\0";
+    ofn.lpstrFilter = L"Scene Files\0*.scene\0Binary Level Files\0*.level\0All Files\0*.*\0";
     ofn.nFilterIndex = 1;
     ofn.lpstrFileTitle = nullptr;
     ofn.nMaxFileTitle = 0;
@@ -646,7 +651,7 @@ std::filesystem::path UMainToolbarWidget::OpenLoadFileDialog()
     ofn.hwndOwner = GetActiveWindow();
     ofn.lpstrFile = szFile;
     ofn.nMaxFile = sizeof(szFile) / sizeof(wchar_t);
-    ofn.lpstrFilter = L"Scene Files\0*.scene\0All Files\0*.*\0";
+    ofn.lpstrFilter = L"Scene Files\0*.scene\0Binary Level Files\0*.level\0All Files\0*.*\0";
     ofn.nFilterIndex = 1;
     ofn.lpstrFileTitle = nullptr;
     ofn.nMaxFileTitle = 0;
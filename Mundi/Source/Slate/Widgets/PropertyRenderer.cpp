@@ -149,6 +149,8 @@ bool UPropertyRenderer::RenderProperty(const FProperty& Property, void* ObjectIn
 				LightComponent->UpdateLightData();
 			}
 		}
+
+		Obj->OnPropertyChanged(Property);
 	}
 
 	return bChanged;
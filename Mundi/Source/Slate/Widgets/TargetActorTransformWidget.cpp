@@ -639,6 +639,12 @@ void UTargetActorTransformWidget::RenderSelectedComponentDetails(UActorComponent
 				ImGui::Text("Shadow Map Index: %d", ShadowMapIndex);
 				ImGui::Text("Resolution: %u x %u", SpotLightShadowMap.GetWidth(), SpotLightShadowMap.GetHeight());
 
+				// 아틀라스 안의 이 라이트 타일 (uv * xy + zw)
+				const FVector4& AtlasScaleOffset = SpotLight->GetShadowAtlasScaleOffset();
+				const uint32 TileSize = static_cast<uint32>(AtlasScaleOffset.X * SpotLightShadowMap.GetWidth() + 0.5f);
+				ImGui::Text("Atlas Tile: %u x %u (%s)", TileSize, TileSize,
+					ShadowManager->IsSpotLightShadowCached(SpotLight) ? "Cached" : "Dirty");
+
 				// Depth 범위 조절 슬라이더
 				static float SpotLightDepthBegin = 0.0f;
 				static float SpotLightDepthEnd = 1.0f;
@@ -658,7 +664,8 @@ void UTargetActorTransformWidget::RenderSelectedComponentDetails(UActorComponent
 					GEngine.GetRenderer()->GetRHIDevice(),
 					ShadowMapIndex,
 					SpotLightDepthBegin,
-					SpotLightDepthEnd);
+					SpotLightDepthEnd,
+					false);
 				
 				if (ShadowSRV)
 				{
@@ -670,12 +677,12 @@ void UTargetActorTransformWidget::RenderSelectedComponentDetails(UActorComponent
 					ImGui::DragFloat("Display Size", &ShadowMapDisplaySize, 1.0f, 64.0f, 512.0f, "%.0f");
 					ImGui::Spacing();
 
-					// ShadowMap 이미지 표시
+					// ShadowMap 이미지 표시 (아틀라스에서 이 라이트 타일만 잘라서)
 					ImGui::Image(
 						(ImTextureID)ShadowSRV,
 						ImVec2(ShadowMapDisplaySize, ShadowMapDisplaySize),
-						ImVec2(0, 0),  // uv0
-						ImVec2(1, 1),  // uv1
+						ImVec2(AtlasScaleOffset.Z, AtlasScaleOffset.W),  // uv0
+						ImVec2(AtlasScaleOffset.Z + AtlasScaleOffset.X, AtlasScaleOffset.W + AtlasScaleOffset.Y),  // uv1
 						ImVec4(1, 1, 1, 1),  // tint color
 						ImVec4(0.5f, 0.5f, 0.5f, 1.0f)  // border color
 					);
@@ -130,6 +130,8 @@ void SViewportWindow::OnRender()
 
 	if (Viewport)
 		Viewport->Render();
+
+	RenderMarqueeOverlay();
 }
 
 void SViewportWindow::OnUpdate(float DeltaSeconds)
@@ -190,6 +192,25 @@ void SViewportWindow::SetVClientWorld(UWorld* InWorld)
 	}
 }
 
+void SViewportWindow::RenderMarqueeOverlay()
+{
+	if (!ViewportClient || !ViewportClient->IsMarqueeSelecting())
+		return;
+
+	const FVector2D& Start = ViewportClient->GetMarqueeStart();
+	const FVector2D& End = ViewportClient->GetMarqueeEnd();
+	const ImVec2 Min(std::min(Start.X, End.X), std::min(Start.Y, End.Y));
+	const ImVec2 Max(std::max(Start.X, End.X), std::max(Start.Y, End.Y));
+
+	ImDrawList* DrawList = ImGui::GetForegroundDrawList();
+	DrawList->AddRectFilled(Min, Max, IM_COL32(80, 140, 255, 40));
+	DrawList->AddRect(Min, Max, IM_COL32(80, 140, 255, 200));
+
+	char Label[32];
+	sprintf_s(Label, "%d", static_cast<int>(ViewportClient->GetMarqueeHoveredComponents().Num()));
+	DrawList->AddText(ImVec2(Max.x + 4.0f, Max.y + 4.0f), IM_COL32(255, 255, 255, 220), Label);
+}
+
 void SViewportWindow::RenderToolbar()
 {
 	if (!Viewport) return;
@@ -1543,6 +1564,19 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 			ImGui::SetTooltip("충돌 시스템의 BVH(Bounding Volume Hierarchy) 디버그 시각화를 표시합니다.");
 		}
 
+		// Occlusion Culling
+		bool bOcclusionCulling = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_OcclusionCulling);
+		if (ImGui::Checkbox("##OcclusionCulling", &bOcclusionCulling))
+		{
+			RenderSettings.ToggleShowFlag(EEngineShowFlags::SF_OcclusionCulling);
+		}
+		ImGui::SameLine();
+		ImGui::Text(" 오클루전 컬링");
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("큰 스태틱 메시에 가려진 스태틱 메시를 CPU 깊이 버퍼로 판정해 그리지 않습니다.");
+		}
+
 		// Grid
 		bool bGrid = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Grid);
 		if (ImGui::Checkbox("##Grid", &bGrid))
@@ -35,6 +35,8 @@ private:
     void RenderViewModeDropdownMenu();
     void RenderShowFlagDropdownMenu();
     void RenderViewportLayoutSwitchButton();
+    // 마키 선택 사각형과 현재 걸친 오브젝트 수 표시
+    void RenderMarqueeOverlay();
     void LoadToolbarIcons(ID3D11Device* Device);
 
 private:
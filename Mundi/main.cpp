@@ -1,5 +1,9 @@
 ﻿#include "pch.h"
 #include "EditorEngine.h"
+#include "ReplayHarness.h"
+#include "InputRecording.h"
+#include "SelfTest.h"
+#include <fstream>
 
 #if defined(_MSC_VER) && defined(_DEBUG)
 #   define _CRTDBG_MAP_ALLOC
@@ -572,9 +576,62 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     // lua 테스트 실행
     //TestLua();
 
+    // 엔진 내장 단위 테스트 (창/디바이스 없이): Mundi.exe -test [filter] [-out <file>], 종료 코드 = 실패한 테스트 수
+    if (lpCmdLine)
+    {
+        const TArray<FString> Args = FReplayOptions::TokenizeCommandLine(lpCmdLine);
+        if (!Args.IsEmpty() && _stricmp(Args[0].c_str(), "-test") == 0)
+        {
+            FString Filter;
+            FString OutPath = "SelfTestReport.txt";
+            for (int32 i = 1; i < Args.Num(); ++i)
+            {
+                if (_stricmp(Args[i].c_str(), "-out") == 0 && i + 1 < Args.Num())
+                {
+                    OutPath = Args[++i];
+                }
+                else
+                {
+                    Filter = Args[i];
+                }
+            }
+
+            FString Report;
+            const int32 FailedCount = FSelfTestRegistry::RunTests(Filter, &Report);
+            std::ofstream Out(OutPath, std::ios::binary);
+            Out << Report;
+            return FailedCount;
+        }
+    }
+
+    // 헤드리스 입력 재생: Mundi.exe -replay <file.minput> [-level <scene>] [-out <file.csv|json>] [-dt <sec|recorded>] [-frames <n>]
+    FReplayOptions ReplayOptions;
+    if (lpCmdLine && FReplayOptions::ParseCommandLine(lpCmdLine, ReplayOptions))
+    {
+        if (!GEngine.Startup(hInstance, true))
+            return -1;
+
+        const int32 ExitCode = FReplayHarness::Run(ReplayOptions);
+        GEngine.Shutdown();
+        return ExitCode;
+    }
+
     if (!GEngine.Startup(hInstance))
         return -1;
 
+    // 입력 녹화: Mundi.exe -record <file.minput> (다음 PIE 세션을 녹화)
+    if (lpCmdLine)
+    {
+        const TArray<FString> Args = FReplayOptions::TokenizeCommandLine(lpCmdLine);
+        for (int32 i = 0; i + 1 < Args.Num(); ++i)
+        {
+            if (_stricmp(Args[i].c_str(), "-record") == 0)
+            {
+                FInputRecorder::GetInstance().Arm(Args[++i]);
+            }
+        }
+    }
+
     GEngine.MainLoop();
     GEngine.Shutdown();
 
@@ -4,6 +4,8 @@
 // Uncomment to enable DDS texture caching (faster loading, uses Data/TextureCache/)
 #define USE_DDS_CACHE
 #define USE_OBJ_CACHE
+// Comment out to upload static meshes as full-precision FVertexDynamic (64B) instead of packed vertices
+#define USE_PACKED_STATIC_MESH_VERTEX
 
 // Linker
 #pragma comment(lib, "user32")